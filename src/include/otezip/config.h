@@ -21,6 +21,18 @@
 #define OTEZIP_ENABLE_LZMA 1
 #define OTEZIP_ENABLE_BROTLI 1
 
+// Use PCLMULQDQ / ARMv8 CRC32 instructions when the CPU supports them
+#define OTEZIP_ENABLE_HWCRC 1
+
+// Compress queued entries on a pthread worker pool (otezip_batch_commit)
+#define OTEZIP_ENABLE_THREADS 1
+
+// Map ZIP_RDONLY archives with mmap() instead of reading through stdio
+#define OTEZIP_ENABLE_MMAP 1
+
+// Timing counters and per-entry hooks (otezip_set_stats, --stats)
+#define OTEZIP_ENABLE_STATS 1
+
 // ---------------------------------------------- //
 
 // Compression algorithm ID numbers (from ZIP spec)
@@ -33,6 +45,8 @@
 #define OTEZIP_METHOD_LZ4     94
 /* LZFSE is not officially in ZIP spec, using Apple-specific range */
 #define OTEZIP_METHOD_LZFSE  100  /* Apple-specific range */
+/* Not a ZIP method: pick one per entry, storing incompressible data */
+#define OTEZIP_METHOD_AUTO   0xffff
 
 // Compression buffer sizing constants
 #define OTEZIP_LZMA_HEADER_SIZE       13 /* LZMA header size */
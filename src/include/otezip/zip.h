@@ -8,9 +8,10 @@
  *   zip_close
  *   zip_get_num_files
  *   zip_name_locate
- *   zip_fopen_index    (returns the **whole** uncompressed file in memory)
+ *   zip_fopen_index    (stored/deflate entries are decompressed on demand)
  *   zip_fclose
  *   zip_source_buffer  (for adding files)
+ *   zip_source_file / zip_source_function (streamed while added)
  *   zip_file_add       (add file to archive)
  *   zip_set_file_compression (set compression method)
  *
@@ -18,8 +19,10 @@
  * ------------------
  *  • Single-disk, non-spanned ZIP files created with the standard PKZIP spec.
  *  • Compression methods 0 (stored) and 8 (deflate).
- *  • No encrypted entries, no ZIP64.
- *  • Data descriptors (general flag bit 3) supported via central directory.
+ *  • ZIP64 sizes, offsets and entry counts, read and written as needed.
+ *  • No encrypted entries.
+ *  • Data descriptors (general flag bit 3) supported via central directory,
+ *    and written after entries streamed from file or callback sources.
  *
  * License: MIT / 0-BSD – do whatever you want; attribution appreciated.
  */
@@ -68,45 +71,120 @@ static inline void otezip_write_le64(uint8_t *p, uint64_t v) {
 
 typedef uint64_t zip_uint64_t;
 typedef int64_t  zip_int64_t;
-typedef int      zip_flags_t;    /* we don't interpret any flags for now */
+typedef int      zip_flags_t;    /* only ZIP_FL_NOCASE/ZIP_FL_NODIR are interpreted */
 typedef int32_t  zip_int32_t;
 typedef uint32_t zip_uint32_t;
 typedef uint16_t zip_uint16_t;
 typedef uint8_t  zip_uint8_t;
+typedef int8_t   zip_int8_t;
 
-/* an in-memory representation of a single directory entry */
+/* an in-memory representation of a single directory entry; the fields
+ * used to locate and decode the payload are packed together up front */
 struct otezip_entry {
-    char      *name;                /* zero-terminated filename              */
-    uint32_t   local_hdr_ofs;       /* offset of corresponding LFH          */
-    uint32_t   comp_size;
-    uint32_t   uncomp_size;
-    uint16_t   method;              /* 0=store, 8=deflate                   */
+    char      *name;                /* zero-terminated filename (archive string arena) */
+    uint64_t   local_hdr_ofs;       /* offset of corresponding LFH          */
+    uint64_t   comp_size;           /* 64-bit: ZIP64 extra field if needed  */
+    uint64_t   uncomp_size;
     uint32_t   crc32;               /* CRC-32 checksum of uncompressed data */
+    uint16_t   method;              /* 0=store, 8=deflate                   */
     uint16_t   file_time;           /* DOS format file time */
     uint16_t   file_date;           /* DOS format file date */
     uint32_t   external_attr;       /* External file attributes (permissions) */
+    uint16_t   flags;               /* general purpose bit flag */
 };
 
+struct otezip_batch; /* entries queued by otezip_batch_add (internal) */
+struct otezip_names; /* zip_name_locate hash tables (internal) */
+struct otezip_strblock; /* entry name arena (internal) */
+struct otezip_codec_cache; /* codec contexts kept between entries (internal) */
+struct otezip_stats; /* counters filled while attached with otezip_set_stats */
+struct otezip_event; /* per-entry report handed to otezip_set_event_hook */
+struct otezip_lazy; /* undecoded central directory of OTEZIP_LAZY archives (internal) */
+struct otezip_seekpoints; /* deflate access points of one entry (internal) */
+struct otezip_mem; /* buffer behind archives opened in memory (internal) */
+
 /* Use libzip-compatible struct names for full compatibility */
 struct zip {
     FILE               *fp;
     struct otezip_entry  *entries;
     zip_uint64_t        n_entries;
+    zip_uint64_t        entries_cap; /* allocated slots in entries */
     int                 mode;       /* 0=read-only, 1=write */
     zip_uint64_t        next_index; /* Next available index for adding files */
     uint16_t            default_method; /* Default compression method for new entries */
+    zip_uint32_t        comp_flags; /* zip_set_file_compression flags for new entries */
+    struct otezip_batch *batch;     /* queued entries awaiting otezip_batch_commit */
+    zip_uint64_t        file_size;  /* archive size seen when the central directory was read */
+    const uint8_t      *map;        /* read-only mapping of the whole archive, or NULL */
+    struct otezip_names *names;     /* name index, built on first zip_name_locate */
+    struct otezip_strblock *strings; /* arena holding every entry name */
+    struct otezip_codec_cache *codecs; /* codec contexts reused across entries */
+    zip_uint64_t        dead_bytes; /* data of replaced or deleted entries, until otezip_compact */
+    struct otezip_stats *stats;     /* counters to add to, or NULL */
+    void              (*hook)(void *user, const struct otezip_event *ev); /* per-entry report, or NULL */
+    void               *hook_user;
+    zip_uint64_t        open_ns;    /* time zip_open spent loading the central directory */
+    int                 deflate_threads; /* workers per deflate entry, see otezip_set_deflate_threads */
+    struct otezip_lazy *lazy;       /* set for OTEZIP_LAZY: entries[] is filled on demand */
+    zip_uint64_t        seek_span;  /* output between deflate access points, see otezip_set_seek_span */
+    struct otezip_seekpoints *seekpoints; /* access points recorded so far, per entry */
+    struct otezip_mem  *mem;        /* buffer fp reads and writes, for memory archives */
 };
 
 struct zip_file {
-    uint8_t   *data;   /* complete uncompressed data                 */
-    uint32_t   size;
+    uint8_t   *data;   /* complete uncompressed data (NULL when streaming) */
+    zip_uint64_t size; /* uncompressed size of the entry             */
     zip_uint64_t pos;  /* current read position for zip_fread       */
+    /* streaming state: compressed bytes are pulled from the archive on demand */
+    struct zip *za;       /* owning archive                            */
+    uint16_t   method;    /* compression method of the entry           */
+    uint64_t   comp_ofs;  /* file offset of the next compressed byte   */
+    uint64_t   comp_left; /* compressed bytes not yet read from disk   */
+    uint8_t   *inbuf;     /* compressed-input window                   */
+    void      *strm;      /* live z_stream for the decoder             */
+    const struct otezip_codec *stream_codec; /* registration strm came from */
+    uint32_t   crc;       /* running CRC-32 of the bytes returned      */
+    uint32_t   crc_expected;
+    const char *name;
+    int        eof;       /* decoder reached end of stream             */
+    int        borrowed;  /* data is a view into za->map, not owned    */
+    zip_uint64_t index;   /* entry index, for the event hook           */
+    zip_uint64_t codec_ns; /* decoder time so far, when observed       */
+    zip_uint64_t busy_ns; /* total time in zip_fread, when observed    */
+    /* random access (zip_fseek) */
+    uint64_t   data_ofs;  /* file offset of the entry's data           */
+    int        unchecked; /* seeked away: crc no longer covers [0, pos) */
+    uint8_t   *scratch;   /* sink for bytes decoded to skip them       */
+    struct otezip_seekpoints *points; /* access points of the entry, or NULL */
+    int        collect;   /* record access points while decoding       */
+    uint64_t   seek_due;  /* offset from which the next point is due   */
 };
 
+/* zip_source_function commands, numbered as in libzip. otezip issues
+ * OPEN, READ and CLOSE around each add, STAT for the size if the
+ * callback knows it, and FREE when the source is released. */
+enum zip_source_cmd {
+    ZIP_SOURCE_OPEN,
+    ZIP_SOURCE_READ,
+    ZIP_SOURCE_CLOSE,
+    ZIP_SOURCE_STAT,
+    ZIP_SOURCE_ERROR,
+    ZIP_SOURCE_FREE
+};
+
+typedef enum zip_source_cmd zip_source_cmd_t;
+typedef zip_int64_t (*zip_source_callback)(void *userdata, void *data, zip_uint64_t len, zip_source_cmd_t cmd);
+
+/* Data for a new entry: a buffer, or, with buf NULL, a file or callback
+ * read while the entry is written */
 struct zip_source {
     const void *buf;
-    zip_uint64_t len;
+    zip_uint64_t len;  /* bytes in buf or to read, ZIP_UINT64_MAX if unknown */
     int freep;
+    FILE *fp;          /* zip_source_file: read from start on */
+    zip_uint64_t start;
+    zip_source_callback fn; /* zip_source_function */
+    void *userdata;
 };
 
 /* Error information structure */
@@ -121,7 +199,7 @@ typedef struct zip_file    otezip_file;
 typedef struct zip_source  otezip_src_buf;
 
 typedef struct zip         zip_t;      /* opaque archive handle        */
-typedef struct zip_file    zip_file_t; /* opaque file-in-memory handle */
+typedef struct zip_file    zip_file_t; /* opaque open-entry handle     */
 typedef struct zip_source  zip_source_t;/* stub                          */
 typedef struct otezip_error zip_error_t; /* error structure              */
 
@@ -142,10 +220,30 @@ typedef struct otezip_error zip_error_t; /* error structure              */
 #define ZIP_TRUNCATE 8
 #endif
 
+/* otezip extension for read-only opens: check the end of central
+ * directory only and decode entry records when they are first used */
+#define OTEZIP_LAZY 0x1000
+
+/* zip_name_locate / zip_stat flags */
+#ifndef ZIP_FL_NOCASE
+#define ZIP_FL_NOCASE 1u  /* ignore ASCII case */
+#endif
+
+#ifndef ZIP_FL_NODIR
+#define ZIP_FL_NODIR 2u   /* ignore directory component of entry names */
+#endif
+
 /* Compression methods */
 #define ZIP_CM_STORE 0    /* stored (uncompressed) */
 #define ZIP_CM_DEFLATE 8  /* deflated */
 
+/* zip_set_file_compression comp_flags: the low byte is the level (1-9,
+ * 0 for the default) as in libzip; the next byte is the log2 of the LZMA
+ * dictionary size (12-27, 0 for the level default). */
+#define OTEZIP_COMP_LEVEL(flags) ((flags) & 0xffu)
+#define OTEZIP_LZMA_DICT_LOG(flags) (((flags) >> 8) & 0xffu)
+#define OTEZIP_LZMA_DICT(log2) ((zip_uint32_t)(log2) << 8)
+
 /* Maximum value for zip_uint64_t */
 #define ZIP_UINT64_MAX ((zip_uint64_t)-1)
 
@@ -157,7 +255,10 @@ typedef struct otezip_error zip_error_t; /* error structure              */
 #define ZIP_ER_NOZIP 19           /* Not a zip archive */
 #define ZIP_ER_RDONLY 25          /* Read-only archive */
 #define ZIP_ER_OPEN 11            /* Can't open file */
+#define ZIP_ER_MEMORY 14          /* Malloc failure */
 #define ZIP_ER_READ 5             /* Read error */
+#define ZIP_ER_CRC 7              /* CRC error */
+#define ZIP_ER_COMPNOTSUPP 16     /* Compression method not supported */
 #define ZIP_ER_INCONS 21          /* Zip archive inconsistent */
 
 /* zip_stat flags */
@@ -183,6 +284,100 @@ struct zip_stat {
 
 typedef struct zip_stat zip_stat_t;
 
+/* A compression method (otezip extension). Every built-in method is one
+ * of these, and otezip_register_codec adds or replaces one at runtime,
+ * e.g. to route zstd through the system libzstd. */
+struct otezip_codec {
+    const char   *name;    /* name accepted by otezip_method_from_string */
+    zip_uint16_t  method;  /* ZIP compression method id */
+    void         *opaque;  /* handed to init; the ctx when init is NULL */
+    /* Optional: set *ctx up for compress (encode != 0) or decompress
+     * calls, 0 on success. An archive keeps the context for its next
+     * entry, so one ctx serves any number of calls, each on a whole
+     * entry, but only one call at a time. */
+    int    (*init)(void *opaque, int encode, void **ctx);
+    /* Optional: output room compress needs for src_len bytes. Left NULL
+     * it is src_len, enough for codecs that stop when dst is full, since
+     * output that is not smaller than the input is stored instead. */
+    size_t (*bound)(size_t src_len);
+    /* Compress src into dst (room for *dst_len bytes) and set *dst_len to
+     * the compressed size. Returns 0, 1 when the output does not fit, or
+     * -1 on error. NULL makes the method decode-only. */
+    int    (*compress)(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags);
+    /* Decode src into exactly dst_len bytes, 0 on success or -1 */
+    int    (*decompress)(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t dst_len);
+    /* Optional: release what init set up, at zip_close at the latest */
+    void   (*end)(void *ctx);
+};
+
+typedef struct otezip_codec otezip_codec_t;
+
+/* Performance counters (otezip extension). Times are monotonic
+ * nanoseconds; work done on several threads at once adds up, so they can
+ * exceed the wall time. Only I/O on the archive itself is counted, not
+ * reads from the sources being added. */
+#define OTEZIP_STATS_METHODS 16
+
+struct otezip_method_stats {
+    zip_uint16_t method;
+    zip_uint64_t compress_entries;   /* entries (or replacements) encoded */
+    zip_uint64_t compress_in;        /* bytes fed to the encoder          */
+    zip_uint64_t compress_out;       /* bytes it produced                 */
+    zip_uint64_t compress_ns;
+    zip_uint64_t decompress_entries;
+    zip_uint64_t decompress_in;      /* compressed bytes decoded          */
+    zip_uint64_t decompress_out;
+    zip_uint64_t decompress_ns;
+};
+
+struct otezip_stats {
+    zip_uint64_t open_ns;        /* zip_open: finding and parsing the directory */
+    zip_uint64_t bytes_read;
+    zip_uint64_t bytes_written;
+    zip_uint64_t reads;          /* read calls; a mapped archive (ZIP_RDONLY)
+                                  * hands entry data to the codecs in place, so
+                                  * it is paged in during codec and CRC time */
+    zip_uint64_t writes;         /* local header + data, chunk or directory     */
+    zip_uint64_t seeks;
+    zip_uint64_t allocs;         /* entry-sized buffers allocated               */
+    zip_uint64_t io_ns;
+    zip_uint64_t crc_bytes;
+    zip_uint64_t crc_ns;
+    size_t       n_methods;      /* used slots of methods, in first-use order   */
+    struct otezip_method_stats methods[OTEZIP_STATS_METHODS];
+};
+
+typedef struct otezip_method_stats otezip_method_stats_t;
+typedef struct otezip_stats otezip_stats_t;
+
+#define OTEZIP_EVENT_COMPRESS   0 /* an entry was written                   */
+#define OTEZIP_EVENT_DECOMPRESS 1 /* an entry was read (zip_fclose if streamed) */
+#define OTEZIP_EVENT_DIRECTORY  2 /* zip_close wrote the central directory  */
+
+struct otezip_event {
+    int           kind;          /* OTEZIP_EVENT_*                           */
+    const char   *name;          /* entry name, NULL for the directory       */
+    zip_uint64_t  index;         /* entry index; entry count for the directory */
+    zip_uint16_t  method;        /* method the data ended up with            */
+    zip_uint64_t  comp_size;     /* directory: bytes written for it          */
+    zip_uint64_t  uncomp_size;
+    zip_uint64_t  ns;            /* time spent on it: codec, CRC and I/O     */
+};
+
+typedef struct otezip_event otezip_event_t;
+typedef void (*otezip_event_hook)(void *user, const otezip_event_t *ev);
+
+/* Outcome of otezip_test_archive for one entry */
+struct otezip_test_result {
+    zip_uint64_t  index;
+    const char   *name;          /* valid until zip_close, NULL if unreadable */
+    int           error;         /* ZIP_ER_OK, or why the entry failed        */
+    zip_uint64_t  size;          /* bytes it decoded to                       */
+    zip_uint32_t  crc;           /* their CRC-32                              */
+};
+
+typedef struct otezip_test_result otezip_test_result_t;
+
 /* ----------------------------  public API  ----------------------------- */
 
 #ifdef __cplusplus
@@ -197,19 +392,135 @@ zip_uint64_t   zip_get_num_files (zip_t *za);
 zip_int64_t    zip_name_locate   (zip_t *za, const char *fname, zip_flags_t flags);
 const char *   zip_get_name      (zip_t *za, zip_uint64_t index, zip_flags_t flags);
 
+/* Entries are read with positional I/O, so on an archive opened ZIP_RDONLY
+ * several threads may open and read entries concurrently (one zip_file_t
+ * per thread). Not on Windows, which lacks pread(). */
 zip_file_t *   zip_fopen_index   (zip_t *za, zip_uint64_t index, zip_flags_t flags);
 int            zip_fclose        (zip_file_t *zf);
 zip_int64_t    zip_fread         (zip_file_t *zf, void *buf, zip_uint64_t nbytes);
+/* whence is SEEK_SET, SEEK_CUR or SEEK_END; the offset may not go past
+ * the end of the entry. Stored entries are read from the new offset;
+ * deflate ones decode forward, or from the start or the nearest access
+ * point before it (otezip_set_seek_span) when seeking back. The CRC is
+ * only checked for entries read from offset 0 to the end. */
+zip_int8_t     zip_fseek         (zip_file_t *zf, zip_int64_t offset, int whence);
+zip_int64_t    zip_ftell         (zip_file_t *zf);
+/* Write the rest of the entry to the file descriptor fd (otezip
+ * extension) and return the bytes written, or -1. Unless
+ * otezip_verify_crc is set, stored entries are copied by the kernel
+ * (copy_file_range, then sendfile) where available; otherwise they and
+ * decoded entries go through a 1 MiB buffer, checking the CRC. */
+zip_int64_t    otezip_fcopy_fd   (zip_file_t *zf, int fd);
 
 zip_source_t * zip_source_buffer (zip_t *za, const void *data, zip_uint64_t len, int freep);
 zip_source_t * zip_source_buffer_create(const void *data, zip_uint64_t len, int freep, zip_error_t *error);
+/* Streamed sources: large files and callbacks are compressed in chunks
+ * straight into the archive, followed by a data descriptor. len 0 or -1
+ * reads to the end of the file; zip_source_filep closes file when the
+ * source is freed. */
+zip_source_t * zip_source_file   (zip_t *za, const char *fname, zip_uint64_t start, zip_int64_t len);
+zip_source_t * zip_source_filep  (zip_t *za, FILE *file, zip_uint64_t start, zip_int64_t len);
+zip_source_t * zip_source_function(zip_t *za, zip_source_callback fn, void *userdata);
 void           zip_source_free   (zip_source_t *src);
 zip_int64_t    zip_file_add      (zip_t *za, const char *name, zip_source_t *src, zip_flags_t flags);
 int            zip_file_replace  (zip_t *za, zip_uint64_t index, zip_source_t *src, zip_flags_t flags);
 int            zip_replace       (zip_t *za, zip_uint64_t index, zip_source_t *src);
+int            zip_delete        (zip_t *za, zip_uint64_t index);
 zip_int64_t    zip_add           (zip_t *za, const char *name, zip_source_t *src);
 int            zip_set_file_compression(zip_t *za, zip_uint64_t index, zip_int32_t comp, zip_uint32_t comp_flags);
 
+/* Batched adds (otezip extension): queue entries, then compress them on
+ * n_threads workers and write them in queue order. zip_file_add and
+ * zip_close commit anything still queued first. */
+zip_int64_t    otezip_batch_add  (zip_t *za, const char *name, zip_source_t *src);
+int            otezip_batch_commit(zip_t *za, int n_threads);
+
+/* Archives opened with ZIP_CREATE are updated in place: new entries
+ * overwrite the old central directory and zip_close writes the new one.
+ * zip_file_replace and zip_delete leave the old data behind, counted in
+ * za->dead_bytes; otezip_compact (otezip extension) slides the remaining
+ * entries over it. Close entries opened with zip_fopen_index first; if it
+ * fails midway the archive may be damaged. */
+int            otezip_compact    (zip_t *za);
+
+/* Parallel deflate (otezip extension). Deflate entries larger than a
+ * chunk (1 MiB) are cut into chunks compressed on n_threads workers,
+ * each primed with the 32 KiB before it, and joined at sync-flush
+ * boundaries into one stream; streamed sources keep only a few chunks in
+ * memory. 0 or 1 compresses serially, as do batch workers, which are
+ * parallel already. Without thread support it has no effect.
+ * otezip_gzip_file writes in as one gzip member the same way, reading
+ * and writing as it goes; the byte counts may be NULL. */
+int            otezip_set_deflate_threads(zip_t *za, int n_threads);
+int            otezip_gzip_file  (FILE *in, FILE *out, int level, int n_threads, zip_uint64_t *in_len, zip_uint64_t *out_len);
+
+/* Deflate access points (otezip extension). With a span set, reading a
+ * deflate entry larger than span from a ZIP_RDONLY archive records the
+ * decoder state (bit offset and 32 KiB window) at the first block
+ * boundary past every span bytes of output. They are kept with the
+ * archive until zip_close, so once an entry has been read through, or
+ * skipped through by zip_fseek, any later seek in it decodes at most
+ * about span bytes plus a block. 0 (the default) records none. */
+int            otezip_set_seek_span(zip_t *za, zip_uint64_t span);
+
+/* Codec registry (otezip extension). Registering copies the codec and
+ * replaces any codec for the same method; it fails if the name already
+ * selects another method or the table is full. Register before archives
+ * are used: the table is not locked. otezip_get_codec returns NULL for
+ * unknown methods; copy the codec to keep it across a replacement. */
+int            otezip_register_codec(const otezip_codec_t *codec);
+const otezip_codec_t *otezip_get_codec(zip_uint16_t method);
+
+/* Instrumentation (otezip extension, OTEZIP_ENABLE_STATS). otezip_set_stats
+ * zeroes *st and adds what za does to it until detached with NULL; the
+ * caller owns st, so it also holds what zip_close wrote. The hook is called
+ * once per entry on the thread that finished it, so with
+ * otezip_batch_commit or concurrent readers it must be thread-safe. Both
+ * return -1 when built without OTEZIP_ENABLE_STATS; with neither set the
+ * clock is never read. */
+int            otezip_set_stats  (zip_t *za, otezip_stats_t *st);
+int            otezip_set_event_hook(zip_t *za, otezip_event_hook hook, void *user);
+
+/* Lazy opens (otezip extension). With OTEZIP_LAZY, zip_open only checks
+ * the end of central directory and keeps the directory itself as it is;
+ * zip_get_name, zip_stat_index, zip_fopen_index and zip_name_locate
+ * decode the records they need, so za->entries[i] is only filled once
+ * one of them returned entry i. Until every record has been decoded,
+ * lookups read records in order and stop at the first match.
+ * otezip_write_index saves a sidecar for the archive as it is on disk,
+ * with the record offset of every entry and a table of name hashes;
+ * otezip_open_index attaches one to a lazy archive, failing if it does
+ * not match the directory, after which exact-name lookups decode only
+ * the records whose name hash matches. */
+int            otezip_write_index(zip_t *za, const char *path);
+int            otezip_open_index (zip_t *za, const char *path);
+
+/* Memory archives (otezip extension). otezip_open_memory opens the len
+ * bytes at data as an archive without touching the file system. With
+ * ZIP_RDONLY they are read in place and must outlive the archive; with
+ * ZIP_CREATE they are copied (ZIP_TRUNCATE or len 0 start empty) into a
+ * buffer that grows as entries are added. otezip_close_memory closes
+ * like zip_close and hands the finished archive over as a malloc'd
+ * buffer; zip_close drops it. zip_open_from_source opens buffer sources,
+ * and streamed ones once read into memory, the same way; the archive
+ * then owns src and frees it on close. Platforms without stdio cookie
+ * streams (fopencookie or funopen) have no memory archives, and there
+ * zip_open_from_source goes through a temporary file as before. */
+zip_t *        otezip_open_memory(const void *data, zip_uint64_t len, int flags, int *errorp);
+int            otezip_close_memory(zip_t *za, void **data, zip_uint64_t *len);
+
+/* Integrity test (otezip extension). Every entry is decoded and its size
+ * and CRC-32 are checked against the directory; nothing is kept. Stored
+ * and deflate entries go through a 64 KiB scratch buffer per thread
+ * (stored ones of ZIP_RDONLY archives are checked in place); the other
+ * methods decode whole, one entry per thread at a time. Entries of
+ * ZIP_RDONLY archives are spread over n_threads (0 or 1 tests them in
+ * order on the calling thread). results, when not NULL, has room for
+ * zip_get_num_files entries and gets one per entry; error is ZIP_ER_CRC,
+ * ZIP_ER_INCONS (bad offsets, undecodable data or the wrong size) or
+ * ZIP_ER_COMPNOTSUPP. Returns how many entries failed, or -1. */
+zip_int64_t    otezip_test_archive(zip_t *za, int n_threads, otezip_test_result_t *results);
+
 int            zip_stat          (zip_t *za, const char *fname, zip_flags_t flags, zip_stat_t *st);
 int            zip_stat_index    (zip_t *za, zip_uint64_t index, zip_flags_t flags, zip_stat_t *st);
 void           zip_stat_init     (zip_stat_t *st);
@@ -234,4 +545,9 @@ extern int otezip_ignore_zipbomb;
  * Returns the OTEZIP_METHOD_* value or -1 if invalid/not supported. */
 int otezip_method_from_string(const char *method_name);
 
+/* Combine crc1 = CRC-32(A) and crc2 = CRC-32(B) into CRC-32(A || B), where
+ * len2 is the length of B. Lets chunked producers merge per-chunk CRCs
+ * without a second pass over the data. */
+uint32_t otezip_crc32_combine(uint32_t crc1, uint32_t crc2, uint64_t len2);
+
 #endif /* OTEZIP_H_ */
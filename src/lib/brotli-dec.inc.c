@@ -0,0 +1,980 @@
+/* brotli-dec.inc.c - Minimalistic Brotli decoder implementation compatible with zlib-like API
+ * Version: 0.2 (2025-07-27)
+ *
+ * This implementation provides Brotli decoder with zlib-compatible wrappers:
+ *
+ *   brotliDecompressInit
+ *   brotliDecompress
+ *   brotliDecompressReset
+ *   brotliDecompressEnd
+ *
+ * It decodes RFC 7932 streams: uncompressed, metadata and compressed
+ * meta-blocks with block switching, context modeling, two-level prefix
+ * code tables and references into the static dictionary. The input is
+ * gathered until Z_FINISH, then the stream is decoded straight into
+ * next_out while it fits and drained from an internal buffer otherwise.
+ *
+ * License: MIT / 0-BSD - do whatever you want; attribution appreciated.
+ */
+
+#ifndef OBROTLI_DEC_H
+#define OBROTLI_DEC_H
+
+#define BROTLI_ROOT_BITS 8
+#define BROTLI_BLOCK_INFINITE (1u << 28)
+
+/* ------------- Bit reader ------------- */
+
+/* Reads past the end deliver zero bits; brotli_br_overrun tells */
+typedef struct {
+	const uint8_t *src;
+	size_t n;
+	size_t pos; /* next byte to load */
+	uint64_t acc;
+	unsigned cnt; /* valid bits in acc */
+} brotli_br;
+
+static inline uint64_t brotli_le64(const uint8_t *p) {
+	return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+		((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+/* Top up to at least 56 valid bits */
+static inline void brotli_br_fill(brotli_br *br) {
+	if (br->pos + 8 <= br->n) {
+		br->acc |= brotli_le64 (br->src + br->pos) << br->cnt;
+		br->pos += (63 - br->cnt) >> 3;
+		br->cnt |= 56;
+		return;
+	}
+	while (br->cnt <= 56) {
+		if (br->pos < br->n) {
+			br->acc |= (uint64_t)br->src[br->pos] << br->cnt;
+		}
+		br->pos++;
+		br->cnt += 8;
+	}
+}
+
+/* Up to 24 bits */
+static inline uint32_t brotli_br_bits(brotli_br *br, unsigned nb) {
+	if (br->cnt < nb) {
+		brotli_br_fill (br);
+	}
+	uint32_t v = (uint32_t)(br->acc & ((1u << nb) - 1));
+	br->acc >>= nb;
+	br->cnt -= nb;
+	return v;
+}
+
+static inline int brotli_br_overrun(const brotli_br *br) {
+	return br->pos * 8 - br->cnt > br->n * 8;
+}
+
+/* Drop the bits up to the next byte boundary; they must be zero */
+static int brotli_br_align(brotli_br *br) {
+	return brotli_br_bits (br, br->cnt & 7) == 0? 0: -1;
+}
+
+/* Offset of the next unread byte; the reader must be byte aligned */
+static inline size_t brotli_br_byte_pos(const brotli_br *br) {
+	return br->pos - br->cnt / 8;
+}
+
+static inline void brotli_br_seek(brotli_br *br, size_t pos) {
+	br->pos = pos;
+	br->acc = 0;
+	br->cnt = 0;
+}
+
+/* ------------- Prefix code tables ------------- */
+
+/* An entry holds the code length in the low byte and the symbol above.
+ * Root entries with a length past BROTLI_ROOT_BITS point at a second
+ * level table of 1 << (length - BROTLI_ROOT_BITS) entries instead. */
+#define BROTLI_ENTRY(bits, value) ((uint32_t)(bits) | ((uint32_t)(value) << 16))
+
+static inline unsigned brotli_read_sym(brotli_br *br, const uint32_t *t) {
+	if (br->cnt < BROTLI_MAX_CODE_BITS) {
+		brotli_br_fill (br);
+	}
+	uint32_t e = t[br->acc & ((1u << BROTLI_ROOT_BITS) - 1)];
+	unsigned nb = e & 0xff;
+	if (nb > BROTLI_ROOT_BITS) {
+		br->acc >>= BROTLI_ROOT_BITS;
+		br->cnt -= BROTLI_ROOT_BITS;
+		e = t[(e >> 16) + (br->acc & ((1u << (nb - BROTLI_ROOT_BITS)) - 1))];
+		nb = e & 0xff;
+	}
+	br->acc >>= nb;
+	br->cnt -= nb;
+	return e >> 16;
+}
+
+/* Reserve n table entries in the decoder's pool; -1 when out of memory */
+typedef struct {
+	uint32_t *e;
+	size_t len;
+	size_t cap;
+} brotli_pool;
+
+static int64_t brotli_pool_take(brotli_pool *p, size_t n) {
+	if (p->len + n > p->cap) {
+		size_t cap = p->cap? p->cap * 2: 8192;
+		while (cap < p->len + n) {
+			cap *= 2;
+		}
+		uint32_t *e = (uint32_t *)realloc (p->e, cap * sizeof (uint32_t));
+		if (!e) {
+			return -1;
+		}
+		p->e = e;
+		p->cap = cap;
+	}
+	memset (p->e + p->len, 0, n * sizeof (uint32_t));
+	p->len += n;
+	return (int64_t)(p->len - n);
+}
+
+/* Build the canonical code of lens[0..n) into the pool. A single symbol
+ * of length 0 takes no bits. Returns the table offset or -1. */
+static int64_t brotli_build_table(brotli_pool *pool, const uint8_t *lens, unsigned n, int single) {
+	int64_t root = brotli_pool_take (pool, 1u << BROTLI_ROOT_BITS);
+	if (root < 0) {
+		return -1;
+	}
+	if (single >= 0) {
+		for (unsigned i = 0; i < (1u << BROTLI_ROOT_BITS); i++) {
+			pool->e[root + i] = BROTLI_ENTRY (0, single);
+		}
+		return root;
+	}
+	uint16_t count[BROTLI_MAX_CODE_BITS + 1] = { 0 };
+	uint16_t offs[BROTLI_MAX_CODE_BITS + 2];
+	uint16_t sorted[BROTLI_NUM_COMMANDS];
+	for (unsigned s = 0; s < n; s++) {
+		count[lens[s]]++;
+	}
+	offs[1] = 0;
+	for (unsigned l = 1; l <= BROTLI_MAX_CODE_BITS; l++) {
+		offs[l + 1] = offs[l] + count[l];
+	}
+	for (unsigned s = 0; s < n; s++) {
+		if (lens[s]) {
+			sorted[offs[lens[s]]++] = (uint16_t)s;
+		}
+	}
+	unsigned total = offs[BROTLI_MAX_CODE_BITS + 1];
+	uint32_t code = 0;
+	unsigned l = 1;
+	unsigned left = count[1];
+	unsigned i = 0;
+	/* codes up to the root width fill the root table directly */
+	for (; i < total; i++) {
+		while (!left) {
+			code <<= 1;
+			left = count[++l];
+		}
+		if (l > BROTLI_ROOT_BITS) {
+			break;
+		}
+		uint32_t e = BROTLI_ENTRY (l, sorted[i]);
+		for (uint32_t r = brotli_reverse_bits (code, l); r < (1u << BROTLI_ROOT_BITS); r += 1u << l) {
+			pool->e[root + r] = e;
+		}
+		code++;
+		left--;
+	}
+	/* longer codes sharing their first BROTLI_ROOT_BITS bits are
+	 * contiguous; each run gets a table as wide as its longest code */
+	while (i < total) {
+		uint32_t top = code >> (l - BROTLI_ROOT_BITS);
+		unsigned ll = l;
+		uint32_t c = code;
+		unsigned cl = left;
+		unsigned max_len = l;
+		for (unsigned j = i; j < total; j++) {
+			while (!cl) {
+				c <<= 1;
+				cl = count[++ll];
+			}
+			if (c >> (ll - BROTLI_ROOT_BITS) != top) {
+				break;
+			}
+			max_len = ll;
+			c++;
+			cl--;
+		}
+		unsigned sub_bits = max_len - BROTLI_ROOT_BITS;
+		int64_t sub = brotli_pool_take (pool, 1u << sub_bits);
+		if (sub < 0) {
+			return -1;
+		}
+		pool->e[root + brotli_reverse_bits (top, BROTLI_ROOT_BITS)] = BROTLI_ENTRY (max_len, sub - root);
+		for (; i < total; i++) {
+			while (!left) {
+				code <<= 1;
+				left = count[++l];
+			}
+			if (code >> (l - BROTLI_ROOT_BITS) != top) {
+				break;
+			}
+			unsigned nb = l - BROTLI_ROOT_BITS;
+			uint32_t e = BROTLI_ENTRY (nb, sorted[i]);
+			for (uint32_t r = brotli_reverse_bits (code & ((1u << nb) - 1), nb); r < (1u << sub_bits); r += 1u << nb) {
+				pool->e[sub + r] = e;
+			}
+			code++;
+			left--;
+		}
+	}
+	return root;
+}
+
+/* ------------- Decoder state ------------- */
+
+typedef struct {
+	unsigned n_types;
+	unsigned type;
+	unsigned prev_type;
+	uint32_t left; /* symbols until the next block switch */
+	int64_t type_code;
+	int64_t len_code;
+} brotli_blocks;
+
+typedef struct {
+	/* gathered input when it did not come in one Z_FINISH call */
+	uint8_t *in;
+	size_t in_len;
+	size_t in_cap;
+
+	/* decoded output: next_out until it overflows, then our own */
+	uint8_t *out;
+	size_t out_len;
+	size_t out_cap;
+	int out_owned;
+	size_t flush_pos;
+	int done;
+
+	uint32_t window;
+	uint32_t dist_rb[4];
+	unsigned dist_rb_idx;
+
+	brotli_pool pool;
+	brotli_blocks blk[3];
+	unsigned npostfix;
+	unsigned ndirect;
+	int lit_single; /* one literal tree and no literal block switches */
+	uint8_t modes[BROTLI_MAX_BLOCK_TYPES];
+	uint8_t *lit_map;
+	uint8_t *dist_map;
+	int64_t *lit_trees;
+	int64_t *cmd_trees;
+	int64_t *dist_trees;
+	uint8_t lut[4][512];
+} brotli_decompress_context;
+
+/* ------------- Meta-block header ------------- */
+
+static uint32_t brotli_read_var8(brotli_br *br) {
+	if (!brotli_br_bits (br, 1)) {
+		return 0;
+	}
+	uint32_t n = brotli_br_bits (br, 3);
+	return n == 0? 1: (1u << n) + brotli_br_bits (br, n);
+}
+
+/* Read a prefix code over alphabet symbols into the pool; -1 if invalid */
+static int64_t brotli_read_code(brotli_decompress_context *d, brotli_br *br, unsigned alphabet) {
+	uint8_t lens[BROTLI_NUM_COMMANDS];
+	memset (lens, 0, alphabet);
+	uint32_t hskip = brotli_br_bits (br, 2);
+	if (hskip == 1) {
+		/* simple code: up to four listed symbols */
+		unsigned abits = 0;
+		while ((1u << abits) < alphabet) {
+			abits++;
+		}
+		unsigned nsym = brotli_br_bits (br, 2) + 1;
+		uint32_t sym[4];
+		for (unsigned i = 0; i < nsym; i++) {
+			sym[i] = brotli_br_bits (br, abits);
+			if (sym[i] >= alphabet) {
+				return -1;
+			}
+			for (unsigned j = 0; j < i; j++) {
+				if (sym[j] == sym[i]) {
+					return -1;
+				}
+			}
+		}
+		if (nsym == 1) {
+			return brotli_build_table (&d->pool, lens, alphabet, (int)sym[0]);
+		}
+		static const uint8_t simple_lens[5][4] = {
+			{ 0 }, { 0 }, { 1, 1 }, { 1, 2, 2 }, { 2, 2, 2, 2 }
+		};
+		static const uint8_t tree_select_lens[4] = { 1, 2, 3, 3 };
+		const uint8_t *sl = simple_lens[nsym];
+		if (nsym == 4 && brotli_br_bits (br, 1)) {
+			sl = tree_select_lens;
+		}
+		for (unsigned i = 0; i < nsym; i++) {
+			lens[sym[i]] = sl[i];
+		}
+		return brotli_build_table (&d->pool, lens, alphabet, -1);
+	}
+
+	/* complex code: code length code lengths in a fixed variable code */
+	static const uint8_t clen_bits[16] = { 2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 3, 2, 2, 2, 4 };
+	static const uint8_t clen_value[16] = { 0, 4, 3, 2, 0, 4, 3, 1, 0, 4, 3, 2, 0, 4, 3, 5 };
+	uint8_t clens[BROTLI_CODE_LEN_CODES] = { 0 };
+	int space = 32;
+	unsigned num_codes = 0;
+	for (unsigned i = hskip; i < BROTLI_CODE_LEN_CODES && space > 0; i++) {
+		if (br->cnt < 4) {
+			brotli_br_fill (br);
+		}
+		unsigned p = (unsigned)(br->acc & 15);
+		br->acc >>= clen_bits[p];
+		br->cnt -= clen_bits[p];
+		unsigned v = clen_value[p];
+		clens[brotli_code_len_order[i]] = (uint8_t)v;
+		if (v) {
+			space -= 32 >> v;
+			num_codes++;
+		}
+	}
+	if (num_codes != 1 && space != 0) {
+		return -1;
+	}
+	/* flat table over 5 bits for the code length code */
+	uint16_t ctab[32];
+	if (num_codes == 1) {
+		for (unsigned s = 0; s < BROTLI_CODE_LEN_CODES; s++) {
+			if (clens[s]) {
+				for (unsigned r = 0; r < 32; r++) {
+					ctab[r] = (uint16_t)(s << 8);
+				}
+			}
+		}
+	} else {
+		uint32_t code = 0;
+		for (unsigned l = 1; l <= 5; l++) {
+			for (unsigned s = 0; s < BROTLI_CODE_LEN_CODES; s++) {
+				if (clens[s] == l) {
+					for (uint32_t r = brotli_reverse_bits (code, l); r < 32; r += 1u << l) {
+						ctab[r] = (uint16_t)((s << 8) | l);
+					}
+					code++;
+				}
+			}
+			code <<= 1;
+		}
+	}
+
+	unsigned sym = 0;
+	unsigned prev_len = BROTLI_INITIAL_REPEAT_LEN;
+	unsigned repeat = 0;
+	unsigned repeat_len = 0;
+	int32_t left = 32768;
+	while (sym < alphabet && left > 0) {
+		if (br->cnt < 5) {
+			brotli_br_fill (br);
+		}
+		unsigned e = ctab[br->acc & 31];
+		br->acc >>= e & 0xff;
+		br->cnt -= e & 0xff;
+		unsigned c = e >> 8;
+		if (c < BROTLI_REPEAT_PREV) {
+			repeat = 0;
+			lens[sym++] = (uint8_t)c;
+			if (c) {
+				prev_len = c;
+				left -= 32768 >> c;
+			}
+			continue;
+		}
+		unsigned extra = c == BROTLI_REPEAT_PREV? 2: 3;
+		unsigned new_len = c == BROTLI_REPEAT_PREV? prev_len: 0;
+		if (repeat_len != new_len) {
+			repeat = 0;
+			repeat_len = new_len;
+		}
+		unsigned old = repeat;
+		if (repeat > 0) {
+			repeat = (repeat - 2) << extra;
+		}
+		repeat += brotli_br_bits (br, extra) + 3;
+		unsigned delta = repeat - old;
+		if (sym + delta > alphabet) {
+			return -1;
+		}
+		memset (lens + sym, (int)repeat_len, delta);
+		sym += delta;
+		if (repeat_len) {
+			left -= (int32_t)(delta * (32768u >> repeat_len));
+		}
+	}
+	if (left != 0 || brotli_br_overrun (br)) {
+		return -1;
+	}
+	return brotli_build_table (&d->pool, lens, alphabet, -1);
+}
+
+static inline uint32_t brotli_read_block_len(brotli_br *br, const uint32_t *t) {
+	unsigned s = brotli_read_sym (br, t);
+	return brotli_block_len_base[s] + brotli_br_bits (br, brotli_block_len_extra[s]);
+}
+
+static int brotli_read_blocks(brotli_decompress_context *d, brotli_br *br, brotli_blocks *b) {
+	b->n_types = brotli_read_var8 (br) + 1;
+	b->type = 0;
+	b->prev_type = 1;
+	b->left = BROTLI_BLOCK_INFINITE;
+	if (b->n_types < 2) {
+		return 0;
+	}
+	b->type_code = brotli_read_code (d, br, b->n_types + 2);
+	b->len_code = b->type_code < 0? -1: brotli_read_code (d, br, BROTLI_NUM_BLOCK_LENS);
+	if (b->len_code < 0) {
+		return -1;
+	}
+	b->left = brotli_read_block_len (br, d->pool.e + b->len_code);
+	return 0;
+}
+
+static void brotli_switch_block(brotli_decompress_context *d, brotli_br *br, brotli_blocks *b) {
+	unsigned s = brotli_read_sym (br, d->pool.e + b->type_code);
+	unsigned t = s == 0? b->prev_type: s == 1? b->type + 1: s - 2;
+	if (t >= b->n_types) {
+		t -= b->n_types;
+	}
+	b->prev_type = b->type;
+	b->type = t;
+	b->left = brotli_read_block_len (br, d->pool.e + b->len_code);
+}
+
+/* Context map of n entries over n_trees trees, run-length coded zeros
+ * and an optional inverse move-to-front */
+static int brotli_read_context_map(brotli_decompress_context *d, brotli_br *br, uint8_t *map, size_t n, unsigned n_trees) {
+	if (n_trees < 2) {
+		memset (map, 0, n);
+		return 0;
+	}
+	unsigned rle_max = brotli_br_bits (br, 1)? brotli_br_bits (br, 4) + 1: 0;
+	int64_t code = brotli_read_code (d, br, n_trees + rle_max);
+	if (code < 0) {
+		return -1;
+	}
+	for (size_t i = 0; i < n;) {
+		if (brotli_br_overrun (br)) {
+			return -1;
+		}
+		unsigned s = brotli_read_sym (br, d->pool.e + code);
+		if (s == 0) {
+			map[i++] = 0;
+		} else if (s <= rle_max) {
+			uint32_t run = (1u << s) + brotli_br_bits (br, s);
+			if (run > n - i) {
+				return -1;
+			}
+			memset (map + i, 0, run);
+			i += run;
+		} else {
+			map[i++] = (uint8_t)(s - rle_max);
+		}
+	}
+	if (brotli_br_bits (br, 1)) {
+		uint8_t mtf[256];
+		for (unsigned i = 0; i < 256; i++) {
+			mtf[i] = (uint8_t)i;
+		}
+		for (size_t i = 0; i < n; i++) {
+			unsigned idx = map[i];
+			uint8_t v = mtf[idx];
+			map[i] = v;
+			memmove (mtf + 1, mtf, idx);
+			mtf[0] = v;
+		}
+	}
+	return 0;
+}
+
+/* Make room for n more output bytes, leaving next_out for our own
+ * buffer once it is full */
+static int brotli_out_reserve(brotli_decompress_context *d, size_t n) {
+	if (n <= d->out_cap - d->out_len) {
+		return 0;
+	}
+	size_t cap = d->out_cap > 4096? d->out_cap: 4096;
+	while (cap - d->out_len < n) {
+		if (cap > SIZE_MAX / 2) {
+			return -1;
+		}
+		cap *= 2;
+	}
+	uint8_t *out = d->out_owned? (uint8_t *)realloc (d->out, cap): (uint8_t *)malloc (cap);
+	if (!out) {
+		return -1;
+	}
+	if (!d->out_owned && d->out_len) {
+		memcpy (out, d->out, d->out_len);
+	}
+	if (!d->out_owned) {
+		/* what was decoded so far already sits in next_out */
+		d->flush_pos = d->out_len;
+	}
+	d->out = out;
+	d->out_cap = cap;
+	d->out_owned = 1;
+	return 0;
+}
+
+/* Read the trees of a compressed meta-block */
+static int brotli_read_trees(brotli_decompress_context *d, brotli_br *br) {
+	d->pool.len = 0;
+	for (int i = 0; i < 3; i++) {
+		if (brotli_read_blocks (d, br, &d->blk[i]) < 0) {
+			return -1;
+		}
+	}
+	d->npostfix = brotli_br_bits (br, 2);
+	d->ndirect = brotli_br_bits (br, 4) << d->npostfix;
+	unsigned n_lit_types = d->blk[0].n_types;
+	for (unsigned i = 0; i < n_lit_types; i++) {
+		d->modes[i] = (uint8_t)brotli_br_bits (br, 2);
+	}
+	unsigned n_lit_trees = brotli_read_var8 (br) + 1;
+	d->lit_single = n_lit_types == 1 && n_lit_trees == 1;
+	if (brotli_read_context_map (d, br, d->lit_map, (size_t)n_lit_types * BROTLI_LIT_CONTEXTS, n_lit_trees) < 0) {
+		return -1;
+	}
+	unsigned n_dist_trees = brotli_read_var8 (br) + 1;
+	if (brotli_read_context_map (d, br, d->dist_map, (size_t)d->blk[2].n_types * BROTLI_DIST_CONTEXTS, n_dist_trees) < 0) {
+		return -1;
+	}
+	unsigned dist_alphabet = BROTLI_NUM_SHORT_DISTS + d->ndirect + (48u << d->npostfix);
+	for (unsigned i = 0; i < n_lit_trees; i++) {
+		if ((d->lit_trees[i] = brotli_read_code (d, br, BROTLI_NUM_LITERALS)) < 0) {
+			return -1;
+		}
+	}
+	for (unsigned i = 0; i < d->blk[1].n_types; i++) {
+		if ((d->cmd_trees[i] = brotli_read_code (d, br, BROTLI_NUM_COMMANDS)) < 0) {
+			return -1;
+		}
+	}
+	for (unsigned i = 0; i < n_dist_trees; i++) {
+		if ((d->dist_trees[i] = brotli_read_code (d, br, dist_alphabet)) < 0) {
+			return -1;
+		}
+	}
+	return brotli_br_overrun (br)? -1: 0;
+}
+
+/* Distance of code dcode given the ring of recent distances; 0 if the
+ * short code yields none */
+static inline uint32_t brotli_read_distance(brotli_decompress_context *d, brotli_br *br, unsigned dcode) {
+	if (dcode < BROTLI_NUM_SHORT_DISTS) {
+		static const int8_t delta[6] = { -1, 1, -2, 2, -3, 3 };
+		const uint32_t *rb = d->dist_rb;
+		unsigned idx = d->dist_rb_idx;
+		if (dcode < 4) {
+			return rb[(idx - 1 - dcode) & 3];
+		}
+		int64_t base = rb[(idx - (dcode < 10? 1: 2)) & 3];
+		int64_t v = base + delta[(dcode - 4) % 6];
+		return v > 0? (uint32_t)v: 0;
+	}
+	if (dcode < BROTLI_NUM_SHORT_DISTS + d->ndirect) {
+		return dcode - (BROTLI_NUM_SHORT_DISTS - 1);
+	}
+	unsigned x = dcode - BROTLI_NUM_SHORT_DISTS - d->ndirect;
+	unsigned postfix = x & ((1u << d->npostfix) - 1);
+	unsigned hcode = x >> d->npostfix;
+	unsigned nbits = 1 + (x >> (d->npostfix + 1));
+	uint32_t offset = ((2 + (hcode & 1)) << nbits) - 4;
+	uint32_t extra = brotli_br_bits (br, nbits);
+	return ((offset + extra) << d->npostfix) + postfix + d->ndirect + 1;
+}
+
+/* Decode the commands of a compressed meta-block of mlen bytes */
+static int brotli_decode_commands(brotli_decompress_context *d, brotli_br *br, size_t mlen) {
+	uint8_t *out = d->out;
+	size_t pos = d->out_len;
+	size_t end = pos + mlen;
+	brotli_blocks *lb = &d->blk[0];
+	brotli_blocks *cb = &d->blk[1];
+	brotli_blocks *db = &d->blk[2];
+	const uint32_t *pool = d->pool.e;
+	const uint8_t *lit_map = d->lit_map;
+	const uint8_t *lut = d->lut[d->modes[0]];
+	const uint32_t *cmd_tree = pool + d->cmd_trees[0];
+	while (pos < end) {
+		if (brotli_br_overrun (br)) {
+			return -1;
+		}
+		if (!cb->left) {
+			brotli_switch_block (d, br, cb);
+			cmd_tree = pool + d->cmd_trees[cb->type];
+		}
+		cb->left--;
+		unsigned sym = brotli_read_sym (br, cmd_tree);
+		unsigned cell = sym >> 6;
+		unsigned icode = brotli_cell_insert[cell] + ((sym >> 3) & 7);
+		unsigned ccode = brotli_cell_copy[cell] + (sym & 7);
+		uint32_t insert = brotli_insert_base[icode] + brotli_br_bits (br, brotli_insert_extra[icode]);
+		uint32_t copy = brotli_copy_base[ccode] + brotli_br_bits (br, brotli_copy_extra[ccode]);
+		if (insert > end - pos) {
+			return -1;
+		}
+		if (insert) {
+			uint8_t p1 = pos? out[pos - 1]: 0;
+			uint8_t p2 = pos > 1? out[pos - 2]: 0;
+			if (d->lit_single) {
+				/* one literal tree: no context needed */
+				const uint32_t *t = pool + d->lit_trees[0];
+				for (uint32_t i = 0; i < insert; i++) {
+					out[pos++] = (uint8_t)brotli_read_sym (br, t);
+				}
+			} else {
+				for (uint32_t i = 0; i < insert; i++) {
+					if (!lb->left) {
+						brotli_switch_block (d, br, lb);
+						lit_map = d->lit_map + lb->type * BROTLI_LIT_CONTEXTS;
+						lut = d->lut[d->modes[lb->type]];
+					}
+					lb->left--;
+					unsigned ctx = lut[p1] | lut[256 + p2];
+					uint8_t b = (uint8_t)brotli_read_sym (br, pool + d->lit_trees[lit_map[ctx]]);
+					out[pos++] = b;
+					p2 = p1;
+					p1 = b;
+				}
+			}
+		}
+		if (pos == end) {
+			break;
+		}
+		uint32_t dist;
+		int push = 0;
+		if (cell < 2) {
+			dist = d->dist_rb[(d->dist_rb_idx - 1) & 3];
+		} else {
+			if (!db->left) {
+				brotli_switch_block (d, br, db);
+			}
+			db->left--;
+			unsigned ctx = copy > 4? 3: copy - 2;
+			unsigned tree = d->dist_map[db->type * BROTLI_DIST_CONTEXTS + ctx];
+			unsigned dcode = brotli_read_sym (br, pool + d->dist_trees[tree]);
+			dist = brotli_read_distance (d, br, dcode);
+			if (!dist) {
+				return -1;
+			}
+			push = dcode != 0;
+		}
+		size_t max_dist = pos < d->window? pos: d->window;
+		if (dist > max_dist) {
+			/* static dictionary reference */
+			if (copy < BROTLI_DICT_MIN_LEN || copy > BROTLI_DICT_MAX_LEN) {
+				return -1;
+			}
+			uint32_t word_id = dist - (uint32_t)max_dist - 1;
+			unsigned nb = brotli_dict_bits[copy];
+			unsigned tid = word_id >> nb;
+			if (tid >= BROTLI_NUM_TRANSFORMS) {
+				return -1;
+			}
+			uint8_t word[BROTLI_MAX_WORD_OUT];
+			int n = brotli_transform_word (word, copy, word_id & ((1u << nb) - 1), tid);
+			if ((size_t)n > end - pos) {
+				return -1;
+			}
+			memcpy (out + pos, word, (size_t)n);
+			pos += (size_t)n;
+			continue;
+		}
+		if (push) {
+			d->dist_rb[d->dist_rb_idx++ & 3] = dist;
+		}
+		if (copy > end - pos) {
+			return -1;
+		}
+		const uint8_t *from = out + pos - dist;
+		if (dist >= copy) {
+			memcpy (out + pos, from, copy);
+		} else {
+			for (uint32_t i = 0; i < copy; i++) {
+				out[pos + i] = from[i];
+			}
+		}
+		pos += copy;
+	}
+	d->out_len = pos;
+	return brotli_br_overrun (br)? -1: 0;
+}
+
+/* Decode the whole stream in src; Z_STREAM_END or an error code */
+static int brotli_decode(brotli_decompress_context *d, const uint8_t *src, size_t n, size_t *used) {
+	brotli_br br = { src, n, 0, 0, 0 };
+	unsigned wbits = 16;
+	if (brotli_br_bits (&br, 1)) {
+		unsigned v = brotli_br_bits (&br, 3);
+		if (v) {
+			wbits = 17 + v;
+		} else {
+			v = brotli_br_bits (&br, 3);
+			if (v == 1) {
+				return Z_DATA_ERROR; /* large windows are not RFC 7932 */
+			}
+			wbits = v? 8 + v: 17;
+		}
+	}
+	d->window = (1u << wbits) - BROTLI_WINDOW_GAP;
+	for (;;) {
+		unsigned is_last = brotli_br_bits (&br, 1);
+		if (is_last && brotli_br_bits (&br, 1)) {
+			break;
+		}
+		unsigned nibbles = brotli_br_bits (&br, 2) + 4;
+		if (nibbles == 7) {
+			/* metadata: skipped */
+			if (brotli_br_bits (&br, 1)) {
+				return Z_DATA_ERROR;
+			}
+			unsigned nbytes = brotli_br_bits (&br, 2);
+			size_t skip = 0;
+			for (unsigned i = 0; i < nbytes; i++) {
+				uint32_t b = brotli_br_bits (&br, 8);
+				if (i + 1 == nbytes && nbytes > 1 && b == 0) {
+					return Z_DATA_ERROR;
+				}
+				skip |= (size_t)b << (8 * i);
+			}
+			skip += nbytes? 1: 0;
+			if (brotli_br_align (&br) < 0 || brotli_br_overrun (&br)) {
+				return Z_DATA_ERROR;
+			}
+			size_t at = brotli_br_byte_pos (&br);
+			if (skip > n - at) {
+				return Z_DATA_ERROR;
+			}
+			brotli_br_seek (&br, at + skip);
+			if (is_last) {
+				break;
+			}
+			continue;
+		}
+		size_t mlen = 0;
+		for (unsigned i = 0; i < nibbles; i++) {
+			uint32_t v = brotli_br_bits (&br, 4);
+			if (i + 1 == nibbles && nibbles > 4 && v == 0) {
+				return Z_DATA_ERROR;
+			}
+			mlen |= (size_t)v << (4 * i);
+		}
+		mlen++;
+		unsigned raw = is_last? 0: brotli_br_bits (&br, 1);
+		if (brotli_br_overrun (&br) || brotli_out_reserve (d, mlen) < 0) {
+			return brotli_br_overrun (&br)? Z_DATA_ERROR: Z_MEM_ERROR;
+		}
+		if (raw) {
+			if (brotli_br_align (&br) < 0) {
+				return Z_DATA_ERROR;
+			}
+			size_t at = brotli_br_byte_pos (&br);
+			if (mlen > n - at) {
+				return Z_DATA_ERROR;
+			}
+			memcpy (d->out + d->out_len, src + at, mlen);
+			d->out_len += mlen;
+			brotli_br_seek (&br, at + mlen);
+			continue;
+		}
+		if (brotli_read_trees (d, &br) < 0) {
+			return Z_DATA_ERROR;
+		}
+		if (brotli_decode_commands (d, &br, mlen) < 0) {
+			return Z_DATA_ERROR;
+		}
+		if (is_last) {
+			break;
+		}
+	}
+	if (brotli_br_overrun (&br)) {
+		return Z_DATA_ERROR;
+	}
+	*used = (br.pos * 8 - br.cnt + 7) / 8;
+	return Z_STREAM_END;
+}
+
+/* ------------- zlib-like API ------------- */
+
+/* Initialize a decompression stream */
+int brotliDecompressInit(z_stream *strm) {
+	if (!strm) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_decompress_context *d = (brotli_decompress_context *)calloc (1, sizeof (brotli_decompress_context));
+	if (!d) {
+		return Z_MEM_ERROR;
+	}
+	d->lit_map = (uint8_t *)malloc (BROTLI_MAX_BLOCK_TYPES * (BROTLI_LIT_CONTEXTS + BROTLI_DIST_CONTEXTS));
+	d->lit_trees = (int64_t *)malloc (3 * BROTLI_MAX_BLOCK_TYPES * sizeof (int64_t));
+	if (!d->lit_map || !d->lit_trees) {
+		free (d->lit_map);
+		free (d->lit_trees);
+		free (d);
+		return Z_MEM_ERROR;
+	}
+	d->dist_map = d->lit_map + BROTLI_MAX_BLOCK_TYPES * BROTLI_LIT_CONTEXTS;
+	d->cmd_trees = d->lit_trees + BROTLI_MAX_BLOCK_TYPES;
+	d->dist_trees = d->cmd_trees + BROTLI_MAX_BLOCK_TYPES;
+	d->dist_rb[0] = 16;
+	d->dist_rb[1] = 15;
+	d->dist_rb[2] = 11;
+	d->dist_rb[3] = 4;
+	d->dist_rb_idx = 4;
+	brotli_context_lut_init (d->lut);
+	strm->state = (void *)d;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+/* Decompress a Brotli stream. Input is gathered until Z_FINISH, which
+ * decodes it; output that does not fit next_out is handed out by the
+ * following calls. Returns Z_STREAM_END once all of it was delivered. */
+int brotliDecompress(z_stream *strm, int flush) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_decompress_context *d = (brotli_decompress_context *)strm->state;
+	if (!d->done) {
+		if (flush != Z_FINISH || d->in_len) {
+			size_t n = strm->avail_in;
+			if (n > d->in_cap - d->in_len) {
+				size_t cap = d->in_cap? d->in_cap: 65536;
+				while (cap - d->in_len < n) {
+					cap *= 2;
+				}
+				uint8_t *in = (uint8_t *)realloc (d->in, cap);
+				if (!in) {
+					return Z_MEM_ERROR;
+				}
+				d->in = in;
+				d->in_cap = cap;
+			}
+			memcpy (d->in + d->in_len, strm->next_in, n);
+			d->in_len += n;
+			strm->next_in += n;
+			strm->avail_in = 0;
+			strm->total_in += n;
+			if (flush != Z_FINISH) {
+				return n? Z_OK: Z_BUF_ERROR;
+			}
+		}
+		int direct = d->in_len == 0;
+		const uint8_t *src = direct? strm->next_in: d->in;
+		size_t n = direct? strm->avail_in: d->in_len;
+		size_t used = 0;
+		d->out = strm->next_out;
+		d->out_cap = strm->avail_out;
+		int r = brotli_decode (d, src, n, &used);
+		if (r != Z_STREAM_END) {
+			if (!d->out_owned) {
+				d->out = NULL;
+			}
+			return r;
+		}
+		if (direct) {
+			strm->next_in += used;
+			strm->avail_in -= (uInt)used;
+			strm->total_in += used;
+		}
+		d->done = 1;
+		if (!d->out_owned) {
+			d->flush_pos = d->out_len;
+			d->out = NULL;
+		}
+		strm->next_out += d->flush_pos;
+		strm->avail_out -= (uInt)d->flush_pos;
+		strm->total_out += d->flush_pos;
+	}
+	size_t n = d->out_len - d->flush_pos;
+	if (n > strm->avail_out) {
+		n = strm->avail_out;
+	}
+	if (n) {
+		memcpy (strm->next_out, d->out + d->flush_pos, n);
+		strm->next_out += n;
+		strm->avail_out -= (uInt)n;
+		strm->total_out += n;
+		d->flush_pos += n;
+	}
+	if (d->flush_pos < d->out_len) {
+		return n? Z_OK: Z_BUF_ERROR;
+	}
+	return Z_STREAM_END;
+}
+
+/* Get ready for the next stream, keeping the tables and buffers */
+int brotliDecompressReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_decompress_context *d = (brotli_decompress_context *)strm->state;
+	if (d->out_owned) {
+		free (d->out);
+	}
+	d->out = NULL;
+	d->out_len = 0;
+	d->out_cap = 0;
+	d->out_owned = 0;
+	d->flush_pos = 0;
+	d->done = 0;
+	d->in_len = 0;
+	d->pool.len = 0;
+	d->dist_rb[0] = 16;
+	d->dist_rb[1] = 15;
+	d->dist_rb[2] = 11;
+	d->dist_rb[3] = 4;
+	d->dist_rb_idx = 4;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+/* End a decompression stream */
+int brotliDecompressEnd(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_decompress_context *d = (brotli_decompress_context *)strm->state;
+	if (d->out_owned) {
+		free (d->out);
+	}
+	free (d->in);
+	free (d->pool.e);
+	free (d->lit_map);
+	free (d->lit_trees);
+	free (d);
+	strm->state = NULL;
+	return Z_OK;
+}
+
+int brotliDecompressInit2(z_stream *strm, int windowBits) {
+	(void)windowBits;
+	return brotliDecompressInit (strm);
+}
+
+int brotliDecompressInit2_(z_stream *strm, int windowBits, const char *version, int stream_size) {
+	(void)windowBits;
+	(void)version;
+	(void)stream_size;
+	return brotliDecompressInit (strm);
+}
+
+#endif /* OBROTLI_DEC_H */
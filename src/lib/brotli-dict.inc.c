@@ -0,0 +1,2760 @@
+/* brotli-dict.inc.c - RFC 7932 Appendix A static dictionary
+ *
+ * 122784 bytes of words grouped by length, 4 to 24 bytes; see
+ * brotli_dict_bits and brotli_dict_offset in brotli.inc.c for the layout.
+ */
+
+static const char brotli_dict_data[] =
+	"timedownlifeleftbackcodedatashowonlysitecityopenjustlikefreeworktextyear"
+	"overbodyloveformbookplaylivelinehelphomesidemorewordlongthemviewfindpage"
+	"daysfullheadtermeachareafromtruemarkableuponhighdatelandnewsevennextcase"
+	"bothpostusedmadehandherewhatnameLinkblogsizebaseheldmakemainuser') +hold"
+	"endswithNewsreadweresigntakehavegameseencallpathwellplusmenufilmpartjoin"
+	"thislistgoodneedwayswestjobsmindalsologorichuseslastteamarmyfoodkingwill"
+	"eastwardbestfirePageknowaway.pngmovethanloadgiveselfnotemuchfeedmanyrock"
+	"icononcelookhidediedHomerulehostajaxinfoclublawslesshalfsomesuchzone100%"
+	"onescareTimeracebluefourweekfacehopegavehardlostwhenparkkeptpassshiproom"
+	"HTMLplanTypedonesavekeepflaglinksoldfivetookratetownjumpthusdarkcardfile"
+	"fearstaykillthatfallautoever.comtalkshopvotedeepmoderestturnbornbandfell"
+	"roseurl(skinrolecomeactsagesmeetgold.jpgitemvaryfeltthensenddropViewcopy"
+	"1.0\042</a>stopelseliestourpack.gifpastcss\077graymean&gt;rideshotlatesa"
+	"idroadvar feeljohnrickportfast'UA-dead</b>poorbilltypeU.S.woodmust2px;In"
+	"forankwidewantwalllead[0];paulwavesure$('#waitmassarmsgoesgainlangpaid!-"
+	"- lockunitrootwalkfirmwifexml\042songtest20pxkindrowstoolfontmailsafesta"
+	"rmapscorerainflowbabyspansays4px;6px;artsfootrealwikiheatsteptriporg/lak"
+	"eweaktoldFormcastfansbankveryrunsjulytask1px;goalgrewslowedgeid=\042sets"
+	"5px;.js\07740pxif (soonseatnonetubezerosentreedfactintogiftharm18pxcameh"
+	"illboldzoomvoideasyringfillpeakinitcost3px;jacktagsbitsrolleditknewnear<"
+	"!--growJSONdutyNamesaleyou lotspainjazzcoldeyesfishwww.risktabsprev10pxr"
+	"ise25pxBlueding300,ballfordearnwildbox.fairlackverspairjunetechif(!picke"
+	"vil$(\042#warmlorddoespull,000ideadrawhugespotfundburnhrefcellkeystickho"
+	"urlossfuel12pxsuitdealRSS\042agedgreyGET\042easeaimsgirlaids8px;navygrid"
+	"tips#999warsladycars); }php\077helltallwhomzh:\345*/\015\012 100hall."
+	"\012\012A7px;pushchat0px;crew*/</hash75pxflatrare && tellcampontolaidmis"
+	"sskiptentfinemalegetsplot400,\015\012\015\012coolfeet.php<br>ericmostgui"
+	"dbelldeschairmathatom/img&#82luckcent000;tinygonehtmlselldrugFREEnodenic"
+	"k\077id=losenullvastwindRSS wearrelybeensamedukenasacapewishgulfT23:hits"
+	"slotgatekickblurthey15px''););\042>msiewinsbirdsortbetaseekT18:ordstreem"
+	"all60pxfarm\342\200\231sboys[0].');\042POSTbearkids);}}marytend(UK)quadz"
+	"h:\346-siz----prop');\015liftT19:viceandydebt>RSSpoolneckblowT16:dooreva"
+	"lT17:letsfailoralpollnovacolsgene \342\200\224softrometillross<h3>pourfa"
+	"depink<tr>mini)|!(minezh:\350barshear00);milk -->ironfreddiskwentsoilput"
+	"s/js/holyT22:ISBNT20:adamsees<h2>json', 'contT21: RSSloopasiamoon</p>sou"
+	"lLINEfortcartT14:<h1>80px!--<9px;T04:mike:46ZniceinchYorkricezh:\344'));"
+	"puremageparatonebond:37Z_of_']);000,zh:\347tankyardbowlbush:56ZJava30px"
+	"\012|}\012%C3%:34ZjeffEXPIcashvisagolfsnowzh:\351quer.csssickmeatmin.bin"
+	"ddellhirepicsrent:36ZHTTP-201fotowolfEND xbox:54ZBODYdick;\012}\012exit:"
+	"35Zvarsbeat'});diet999;anne}}</[i].Langkm\302\262wiretoysaddssealalex;"
+	"\012\011}echonine.org005)tonyjewssandlegsroof000) 200winegeardogsbootgar"
+	"ycutstyletemption.xmlcockgang$('.50pxPh.Dmiscalanloandeskmileryanunixdis"
+	"c);}\012dustclip).\012\01270px-200DVDs7]><tapedemoi++)wageeurophiloptsho"
+	"leFAQsasin-26TlabspetsURL bulkcook;}\015\012HEAD[0])abbrjuan(198leshtwin"
+	"</i>sonyguysfuckpipe|-\012!002)ndow[1];[];\012Log salt\015\012\011\011ba"
+	"ngtrimbath){\015\01200px\012});ko:\354feesad>\015s:// [];tollplug(){\012"
+	"{\015\012 .js'200pdualboat.JPG);\012}quot);\012\012');\012\015\012}\0152"
+	"014201520162017201820192020202120222023202420252026202720282029203020312"
+	"032203320342035203620372013201220112010200920082007200620052004200320022"
+	"001200019991998199719961995199419931992199119901989198819871986198519841"
+	"983198219811980197919781977197619751974197319721971197019691968196719661"
+	"965196419631962196119601959195819571956195519541953195219511950100010241"
+	"39400009999comom\303\241sesteestaperotodohacecadaa\303\261obiend\303\255"
+	"aas\303\255vidacasootroforosolootracualdijosidograntipotemadebealgoqu"
+	"\303\251estonadatrespococasabajotodasinoaguapuesunosantediceluisellamayo"
+	"zonaamorpisoobraclicellodioshoracasi\320\267\320\260\320\275\320\260\320"
+	"\276\320\274\321\200\320\260\321\200\321\203\321\202\320\260\320\275\320"
+	"\265\320\277\320\276\320\276\321\202\320\270\320\267\320\275\320\276\320"
+	"\264\320\276\321\202\320\276\320\266\320\265\320\276\320\275\320\270\321"
+	"\205\320\235\320\260\320\265\320\265\320\261\321\213\320\274\321\213\320"
+	"\222\321\213\321\201\320\276\320\262\321\213\320\262\320\276\320\235\320"
+	"\276\320\276\320\261\320\237\320\276\320\273\320\270\320\275\320\270\320"
+	"\240\320\244\320\235\320\265\320\234\321\213\321\202\321\213\320\236\320"
+	"\275\320\270\320\274\320\264\320\260\320\227\320\260\320\224\320\260\320"
+	"\235\321\203\320\236\320\261\321\202\320\265\320\230\320\267\320\265\320"
+	"\271\320\275\321\203\320\274\320\274\320\242\321\213\321\203\320\266\331"
+	"\201\331\212\330\243\331\206\331\205\330\247\331\205\330\271\331\203\331"
+	"\204\330\243\331\210\330\261\330\257\331\212\330\247\331\201\331\211\331"
+	"\207\331\210\331\204\331\205\331\204\331\203\330\247\331\210\331\204\331"
+	"\207\330\250\330\263\330\247\331\204\330\245\331\206\331\207\331\212\330"
+	"\243\331\212\331\202\330\257\331\207\331\204\330\253\331\205\330\250\331"
+	"\207\331\204\331\210\331\204\331\212\330\250\331\204\330\247\331\212\330"
+	"\250\331\203\330\264\331\212\330\247\331\205\330\243\331\205\331\206\330"
+	"\252\330\250\331\212\331\204\331\206\330\255\330\250\331\207\331\205\331"
+	"\205\330\264\331\210\330\264firstvideolightworldmediawhitecloseblackrigh"
+	"tsmallbooksplacemusicfieldorderpointvalueleveltableboardhousegroupworksy"
+	"earsstatetodaywaterstartstyledeathpowerphonenighterrorinputabouttermstit"
+	"letoolseventlocaltimeslargewordsgamesshortspacefocusclearmodelblockguide"
+	"radiosharewomenagainmoneyimagenamesyounglineslatercolorgreenfront&amp;wa"
+	"tchforcepricerulesbeginaftervisitissueareasbelowindextotalhourslabelprin"
+	"tpressbuiltlinksspeedstudytradefoundsenseundershownformsrangeaddedstillm"
+	"ovedtakenaboveflashfixedoftenotherviewschecklegalriveritemsquickshapehum"
+	"anexistgoingmoviethirdbasicpeacestagewidthloginideaswrotepagesusersdrive"
+	"storebreaksouthvoicesitesmonthwherebuildwhichearthforumthreesportpartyCl"
+	"icklowerlivesclasslayerentrystoryusagesoundcourtyour birthpopuptypesappl"
+	"yImagebeinguppernoteseveryshowsmeansextramatchtrackknownearlybegansuperp"
+	"apernorthlearngivennamedendedTermspartsGroupbrandusingwomanfalsereadyaud"
+	"iotakeswhile.com/livedcasesdailychildgreatjudgethoseunitsneverbroadcoast"
+	"coverapplefilescyclesceneplansclickwritequeenpieceemailframeolderphotoli"
+	"mitcachecivilscaleenterthemetheretouchboundroyalaskedwholesincestock nam"
+	"efaithheartemptyofferscopeownedmightalbumthinkbloodarraymajortrustcanonu"
+	"nioncountvalidstoneStyleLoginhappyoccurleft:freshquitefilmsgradeneedsurb"
+	"anfightbasishoverauto;route.htmlmixedfinalYour slidetopicbrownalonedrawn"
+	"splitreachRightdatesmarchquotegoodsLinksdoubtasyncthumballowchiefyouthno"
+	"vel10px;serveuntilhandsCheckSpacequeryjamesequaltwice0,000Startpanelsong"
+	"sroundeightshiftworthpostsleadsweeksavoidthesemilesplanesmartalphaplantm"
+	"arksratesplaysclaimsalestextsstarswrong</h3>thing.org/multiheardPowersta"
+	"ndtokensolid(thisbringshipsstafftriedcallsfullyfactsagentThis //-->admin"
+	"egyptEvent15px;Emailtrue\042crossspentblogsbox\042>notedleavechinasizesg"
+	"uest</h4>robotheavytrue,sevengrandcrimesignsawaredancephase><!--en_US&#3"
+	"9;200px_namelatinenjoyajax.ationsmithU.S. holdspeterindianav\042>chainsc"
+	"orecomesdoingpriorShare1990sromanlistsjapanfallstrialowneragree</h2>abus"
+	"ealertopera\042-//WcardshillsteamsPhototruthclean.php\077saintmetallouis"
+	"meantproofbriefrow\042>genretrucklooksValueFrame.net/-->\012<try {\012va"
+	"r makescostsplainadultquesttrainlaborhelpscausemagicmotortheir250pxleast"
+	"stepsCountcouldglasssidesfundshotelawardmouthmovesparisgivesdutchtexasfr"
+	"uitnull,||[];top\042>\012<!--POST\042ocean<br/>floorspeakdepth sizebanks"
+	"catchchart20px;aligndealswould50px;url=\042parksmouseMost ...</amongbrai"
+	"nbody none;basedcarrydraftreferpage_home.meterdelaydreamprovejoint</tr>d"
+	"rugs<!-- aprilidealallenexactforthcodeslogicView seemsblankports (200sav"
+	"ed_linkgoalsgrantgreekhomesringsrated30px;whoseparse();\042 Blocklinuxjo"
+	"nespixel');\042>);if(-leftdavidhorseFocusraiseboxesTrackement</em>bar"
+	"\042>.src=toweralt=\042cablehenry24px;setupitalysharpminortastewantsthis"
+	".resetwheelgirls/css/100%;clubsstuffbiblevotes 1000korea});\015\012bands"
+	"queue= {};80px;cking{\015\012\011\011aheadclockirishlike ratiostatsForm"
+	"\042yahoo)[0];Aboutfinds</h1>debugtasksURL =cells})();12px;primetellstur"
+	"ns0x600.jpg\042spainbeachtaxesmicroangel--></giftssteve-linkbody.});\012"
+	"\011mount (199FAQ</rogerfrankClass28px;feeds<h1><scotttests22px;drink) |"
+	"| lewisshall#039; for lovedwaste00px;ja:\343\202simon<fontreplymeetsunte"
+	"rcheaptightBrand) != dressclipsroomsonkeymobilmain.Name platefunnytreesc"
+	"om/\0421.jpgwmodeparamSTARTleft idden, 201);\012}\012form.viruschairtran"
+	"sworstPagesitionpatch<!--\012o-cacfirmstours,000 asiani++){adobe')[0]id="
+	"10both;menu .2.mi.png\042kevincoachChildbruce2.jpgURL)+.jpg|suitesliceha"
+	"rry120\042 sweettr>\015\012name=diegopage swiss-->\012\012#fff;\042>Log."
+	"com\042treatsheet) && 14px;sleepntentfiledja:\343\203id=\042cName\042wor"
+	"seshots-box-delta\012&lt;bears:48Z<data-rural</a> spendbakershops= \042"
+	"\042;php\042>ction13px;brianhellosize=o=%2F joinmaybe<img img\042>, fjsi"
+	"mg\042 \042)[0]MTopBType\042newlyDanskczechtrailknows</h5>faq\042>zh-cn1"
+	"0);\012-1\042);type=bluestrulydavis.js';>\015\012<!steel you h2>\015\012"
+	"form jesus100% menu.\015\012\011\015\012walesrisksumentddingb-likteachgi"
+	"f\042 vegasdanskeestishqipsuomisobredesdeentretodospuedea\303\261osest"
+	"\303\241tienehastaotrospartedondenuevohacerformamismomejormundoaqu\303"
+	"\255d\303\255ass\303\263loayudafechatodastantomenosdatosotrassitiomuchoa"
+	"horalugarmayorestoshorastenerantesfotosestaspa\303\255snuevasaludforosme"
+	"dioquienmesespoderchileser\303\241vecesdecirjos\303\251estarventagrupohe"
+	"choellostengoamigocosasnivelgentemismaairesjuliotemashaciafavorjuniolibr"
+	"epuntobuenoautorabrilbuenatextomarzosaberlistaluegoc\303\263moenerojuego"
+	"per\303\272haberestoynuncamujervalorfueralibrogustaigualvotoscasosgu\303"
+	"\255apuedosomosavisousteddebennochebuscafaltaeurosseriedichocursoclaveca"
+	"sasle\303\263nplazolargoobrasvistaapoyojuntotratavistocrearcampohemoscin"
+	"cocargopisosordenhacen\303\241readiscopedrocercapuedapapelmenor\303\272t"
+	"ilclarojorgecalleponertardenadiemarcasigueellassiglocochemotosmadreclase"
+	"restoni\303\261oquedapasarbancohijosviajepablo\303\251stevienereinodejar"
+	"fondocanalnorteletracausatomarmanoslunesautosvillavendopesartipostengama"
+	"rcollevapadreunidovamoszonasambosbandamariaabusomuchasubirriojavivirgrad"
+	"ochicaall\303\255jovendichaestantalessalirsuelopesosfinesllamabusco\303"
+	"\251stalleganegroplazahumorpagarjuntadobleislasbolsaba\303\261ohablaluch"
+	"a\303\201readicenjugarnotasvalleall\303\241cargadolorabajoest\303\251gus"
+	"tomentemariofirmacostofichaplatahogarartesleyesaquelmuseobasespocosmitad"
+	"cielochicomiedoganarsantoetapadebesplayaredessietecortecoreadudasdeseovi"
+	"ejodeseaaguas&quot;domaincommonstatuseventsmastersystemactionbannerremov"
+	"escrollupdateglobalmediumfilternumberchangeresultpublicscreenchoosenorma"
+	"ltravelissuessourcetargetspringmodulemobileswitchphotosborderregionitsel"
+	"fsocialactivecolumnrecordfollowtitle>eitherlengthfamilyfriendlayoutautho"
+	"rcreatereviewsummerserverplayedplayerexpandpolicyformatdoublepointsserie"
+	"spersonlivingdesignmonthsforcesuniqueweightpeopleenergynaturesearchfigur"
+	"ehavingcustomoffsetletterwindowsubmitrendergroupsuploadhealthmethodvideo"
+	"sschoolfutureshadowdebatevaluesObjectothersrightsleaguechromesimplenotic"
+	"esharedendingseasonreportonlinesquarebuttonimagesenablemovinglatestwinte"
+	"rFranceperiodstrongrepeatLondondetailformeddemandsecurepassedtoggleplace"
+	"sdevicestaticcitiesstreamyellowattackstreetflighthiddeninfo\042>openedus"
+	"efulvalleycausesleadersecretseconddamagesportsexceptratingsignedthingsef"
+	"fectfieldsstatesofficevisualeditorvolumeReportmuseummoviesparentaccessmo"
+	"stlymother\042 id=\042marketgroundchancesurveybeforesymbolmomentspeechmo"
+	"tioninsidematterCenterobjectexistsmiddleEuropegrowthlegacymannerenoughca"
+	"reeransweroriginportalclientselectrandomclosedtopicscomingfatheroptionsi"
+	"mplyraisedescapechosenchurchdefinereasoncorneroutputmemoryiframepolicemo"
+	"delsNumberduringoffersstyleskilledlistedcalledsilvermargindeletebetterbr"
+	"owselimitsGlobalsinglewidgetcenterbudgetnowrapcreditclaimsenginesafetych"
+	"oicespirit-stylespreadmakingneededrussiapleaseextentScriptbrokenallowsch"
+	"argedividefactormember-basedtheoryconfigaroundworkedhelpedChurchimpactsh"
+	"ouldalwayslogo\042 bottomlist\042>){var prefixorangeHeader.push(couplega"
+	"rdenbridgelaunchReviewtakingvisionlittledatingButtonbeautythemesforgotSe"
+	"archanchoralmostloadedChangereturnstringreloadMobileincomesupplySourceor"
+	"dersviewed&nbsp;courseAbout island<html cookiename=\042amazonmodernadvic"
+	"ein</a>: The dialoghousesBEGIN MexicostartscentreheightaddingIslandasset"
+	"sEmpireSchooleffortdirectnearlymanualSelect.\012\012Onejoinedmenu\042>Ph"
+	"ilipawardshandleimportOfficeregardskillsnationSportsdegreeweekly (e.g.be"
+	"hinddoctorloggedunited</b></beginsplantsassistartistissued300px|canadaag"
+	"encyschemeremainBrazilsamplelogo\042>beyond-scaleacceptservedmarineFoote"
+	"rcamera</h1>\012_form\042leavesstress\042 />\015\012.gif\042 onloadloade"
+	"rOxfordsistersurvivlistenfemaleDesignsize=\042appealtext\042>levelsthank"
+	"shigherforcedanimalanyoneAfricaagreedrecentPeople<br />wonderpricesturne"
+	"d|| {};main\042>inlinesundaywrap\042>failedcensusminutebeaconquotes150px"
+	"|estateremoteemail\042linkedright;signalformal1.htmlsignupprincefloat:.p"
+	"ng\042 forum.AccesspaperssoundsextendHeightsliderUTF-8\042&amp; Before. "
+	"WithstudioownersmanageprofitjQueryannualparamsboughtfamousgooglelongeri+"
+	"+) {israelsayingdecidehome\042>headerensurebranchpiecesblock;statedtop"
+	"\042><racingresize--&gt;pacitysexualbureau.jpg\042 10,000obtaintitlesamo"
+	"unt, Inc.comedymenu\042 lyricstoday.indeedcounty_logo.FamilylookedMarket"
+	"lse ifPlayerturkey);var forestgivingerrorsDomain}else{insertBlog</footer"
+	"login.fasteragents<body 10px 0pragmafridayjuniordollarplacedcoversplugin"
+	"5,000 page\042>boston.test(avatartested_countforumsschemaindex,filledsha"
+	"resreaderalert(appearSubmitline\042>body\042>\012* TheThoughseeingjersey"
+	"News</verifyexpertinjurywidth=CookieSTART across_imagethreadnativepocket"
+	"box\042>\012System DavidcancertablesprovedApril reallydriveritem\042>mor"
+	"e\042>boardscolorscampusfirst || [];media.guitarfinishwidth:showedOther "
+	".php\042 assumelayerswilsonstoresreliefswedenCustomeasily your String"
+	"\012\012Whiltaylorclear:resortfrenchthough\042) + \042<body>buyingbrands"
+	"Membername\042>oppingsector5px;\042>vspacepostermajor coffeemartinmature"
+	"happen</nav>kansaslink\042>Images=falsewhile hspace0&amp; \012\012In  po"
+	"werPolski-colorjordanBottomStart -count2.htmlnews\042>01.jpgOnline-right"
+	"millerseniorISBN 00,000 guidesvalue)ectionrepair.xml\042  rights.html-bl"
+	"ockregExp:hoverwithinvirginphones</tr>\015using \012\011var >');\012\011"
+	"</td>\012</tr>\012bahasabrasilgalegomagyarpolskisrpski\330\261\330\257"
+	"\331\210\344\270\255\346\226\207\347\256\200\344\275\223\347\271\201\351"
+	"\253\224\344\277\241\346\201\257\344\270\255\345\233\275\346\210\221\344"
+	"\273\254\344\270\200\344\270\252\345\205\254\345\217\270\347\256\241\347"
+	"\220\206\350\256\272\345\235\233\345\217\257\344\273\245\346\234\215\345"
+	"\212\241\346\227\266\351\227\264\344\270\252\344\272\272\344\272\247\345"
+	"\223\201\350\207\252\345\267\261\344\274\201\344\270\232\346\237\245\347"
+	"\234\213\345\267\245\344\275\234\350\201\224\347\263\273\346\262\241\346"
+	"\234\211\347\275\221\347\253\231\346\211\200\346\234\211\350\257\204\350"
+	"\256\272\344\270\255\345\277\203\346\226\207\347\253\240\347\224\250\346"
+	"\210\267\351\246\226\351\241\265\344\275\234\350\200\205\346\212\200\346"
+	"\234\257\351\227\256\351\242\230\347\233\270\345\205\263\344\270\213\350"
+	"\275\275\346\220\234\347\264\242\344\275\277\347\224\250\350\275\257\344"
+	"\273\266\345\234\250\347\272\277\344\270\273\351\242\230\350\265\204\346"
+	"\226\231\350\247\206\351\242\221\345\233\236\345\244\215\346\263\250\345"
+	"\206\214\347\275\221\347\273\234\346\224\266\350\227\217\345\206\205\345"
+	"\256\271\346\216\250\350\215\220\345\270\202\345\234\272\346\266\210\346"
+	"\201\257\347\251\272\351\227\264\345\217\221\345\270\203\344\273\200\344"
+	"\271\210\345\245\275\345\217\213\347\224\237\346\264\273\345\233\276\347"
+	"\211\207\345\217\221\345\261\225\345\246\202\346\236\234\346\211\213\346"
+	"\234\272\346\226\260\351\227\273\346\234\200\346\226\260\346\226\271\345"
+	"\274\217\345\214\227\344\272\254\346\217\220\344\276\233\345\205\263\344"
+	"\272\216\346\233\264\345\244\232\350\277\231\344\270\252\347\263\273\347"
+	"\273\237\347\237\245\351\201\223\346\270\270\346\210\217\345\271\277\345"
+	"\221\212\345\205\266\344\273\226\345\217\221\350\241\250\345\256\211\345"
+	"\205\250\347\254\254\344\270\200\344\274\232\345\221\230\350\277\233\350"
+	"\241\214\347\202\271\345\207\273\347\211\210\346\235\203\347\224\265\345"
+	"\255\220\344\270\226\347\225\214\350\256\276\350\256\241\345\205\215\350"
+	"\264\271\346\225\231\350\202\262\345\212\240\345\205\245\346\264\273\345"
+	"\212\250\344\273\226\344\273\254\345\225\206\345\223\201\345\215\232\345"
+	"\256\242\347\216\260\345\234\250\344\270\212\346\265\267\345\246\202\344"
+	"\275\225\345\267\262\347\273\217\347\225\231\350\250\200\350\257\246\347"
+	"\273\206\347\244\276\345\214\272\347\231\273\345\275\225\346\234\254\347"
+	"\253\231\351\234\200\350\246\201\344\273\267\346\240\274\346\224\257\346"
+	"\214\201\345\233\275\351\231\205\351\223\276\346\216\245\345\233\275\345"
+	"\256\266\345\273\272\350\256\276\346\234\213\345\217\213\351\230\205\350"
+	"\257\273\346\263\225\345\276\213\344\275\215\347\275\256\347\273\217\346"
+	"\265\216\351\200\211\346\213\251\350\277\231\346\240\267\345\275\223\345"
+	"\211\215\345\210\206\347\261\273\346\216\222\350\241\214\345\233\240\344"
+	"\270\272\344\272\244\346\230\223\346\234\200\345\220\216\351\237\263\344"
+	"\271\220\344\270\215\350\203\275\351\200\232\350\277\207\350\241\214\344"
+	"\270\232\347\247\221\346\212\200\345\217\257\350\203\275\350\256\276\345"
+	"\244\207\345\220\210\344\275\234\345\244\247\345\256\266\347\244\276\344"
+	"\274\232\347\240\224\347\251\266\344\270\223\344\270\232\345\205\250\351"
+	"\203\250\351\241\271\347\233\256\350\277\231\351\207\214\350\277\230\346"
+	"\230\257\345\274\200\345\247\213\346\203\205\345\206\265\347\224\265\350"
+	"\204\221\346\226\207\344\273\266\345\223\201\347\211\214\345\270\256\345"
+	"\212\251\346\226\207\345\214\226\350\265\204\346\272\220\345\244\247\345"
+	"\255\246\345\255\246\344\271\240\345\234\260\345\235\200\346\265\217\350"
+	"\247\210\346\212\225\350\265\204\345\267\245\347\250\213\350\246\201\346"
+	"\261\202\346\200\216\344\271\210\346\227\266\345\200\231\345\212\237\350"
+	"\203\275\344\270\273\350\246\201\347\233\256\345\211\215\350\265\204\350"
+	"\256\257\345\237\216\345\270\202\346\226\271\346\263\225\347\224\265\345"
+	"\275\261\346\213\233\350\201\230\345\243\260\346\230\216\344\273\273\344"
+	"\275\225\345\201\245\345\272\267\346\225\260\346\215\256\347\276\216\345"
+	"\233\275\346\261\275\350\275\246\344\273\213\347\273\215\344\275\206\346"
+	"\230\257\344\272\244\346\265\201\347\224\237\344\272\247\346\211\200\344"
+	"\273\245\347\224\265\350\257\235\346\230\276\347\244\272\344\270\200\344"
+	"\272\233\345\215\225\344\275\215\344\272\272\345\221\230\345\210\206\346"
+	"\236\220\345\234\260\345\233\276\346\227\205\346\270\270\345\267\245\345"
+	"\205\267\345\255\246\347\224\237\347\263\273\345\210\227\347\275\221\345"
+	"\217\213\345\270\226\345\255\220\345\257\206\347\240\201\351\242\221\351"
+	"\201\223\346\216\247\345\210\266\345\234\260\345\214\272\345\237\272\346"
+	"\234\254\345\205\250\345\233\275\347\275\221\344\270\212\351\207\215\350"
+	"\246\201\347\254\254\344\272\214\345\226\234\346\254\242\350\277\233\345"
+	"\205\245\345\217\213\346\203\205\350\277\231\344\272\233\350\200\203\350"
+	"\257\225\345\217\221\347\216\260\345\237\271\350\256\255\344\273\245\344"
+	"\270\212\346\224\277\345\272\234\346\210\220\344\270\272\347\216\257\345"
+	"\242\203\351\246\231\346\270\257\345\220\214\346\227\266\345\250\261\344"
+	"\271\220\345\217\221\351\200\201\344\270\200\345\256\232\345\274\200\345"
+	"\217\221\344\275\234\345\223\201\346\240\207\345\207\206\346\254\242\350"
+	"\277\216\350\247\243\345\206\263\345\234\260\346\226\271\344\270\200\344"
+	"\270\213\344\273\245\345\217\212\350\264\243\344\273\273\346\210\226\350"
+	"\200\205\345\256\242\346\210\267\344\273\243\350\241\250\347\247\257\345"
+	"\210\206\345\245\263\344\272\272\346\225\260\347\240\201\351\224\200\345"
+	"\224\256\345\207\272\347\216\260\347\246\273\347\272\277\345\272\224\347"
+	"\224\250\345\210\227\350\241\250\344\270\215\345\220\214\347\274\226\350"
+	"\276\221\347\273\237\350\256\241\346\237\245\350\257\242\344\270\215\350"
+	"\246\201\346\234\211\345\205\263\346\234\272\346\236\204\345\276\210\345"
+	"\244\232\346\222\255\346\224\276\347\273\204\347\273\207\346\224\277\347"
+	"\255\226\347\233\264\346\216\245\350\203\275\345\212\233\346\235\245\346"
+	"\272\220\346\231\202\351\226\223\347\234\213\345\210\260\347\203\255\351"
+	"\227\250\345\205\263\351\224\256\344\270\223\345\214\272\351\235\236\345"
+	"\270\270\350\213\261\350\257\255\347\231\276\345\272\246\345\270\214\346"
+	"\234\233\347\276\216\345\245\263\346\257\224\350\276\203\347\237\245\350"
+	"\257\206\350\247\204\345\256\232\345\273\272\350\256\256\351\203\250\351"
+	"\227\250\346\204\217\350\247\201\347\262\276\345\275\251\346\227\245\346"
+	"\234\254\346\217\220\351\253\230\345\217\221\350\250\200\346\226\271\351"
+	"\235\242\345\237\272\351\207\221\345\244\204\347\220\206\346\235\203\351"
+	"\231\220\345\275\261\347\211\207\351\223\266\350\241\214\350\277\230\346"
+	"\234\211\345\210\206\344\272\253\347\211\251\345\223\201\347\273\217\350"
+	"\220\245\346\267\273\345\212\240\344\270\223\345\256\266\350\277\231\347"
+	"\247\215\350\257\235\351\242\230\350\265\267\346\235\245\344\270\232\345"
+	"\212\241\345\205\254\345\221\212\350\256\260\345\275\225\347\256\200\344"
+	"\273\213\350\264\250\351\207\217\347\224\267\344\272\272\345\275\261\345"
+	"\223\215\345\274\225\347\224\250\346\212\245\345\221\212\351\203\250\345"
+	"\210\206\345\277\253\351\200\237\345\222\250\350\257\242\346\227\266\345"
+	"\260\232\346\263\250\346\204\217\347\224\263\350\257\267\345\255\246\346"
+	"\240\241\345\272\224\350\257\245\345\216\206\345\217\262\345\217\252\346"
+	"\230\257\350\277\224\345\233\236\350\264\255\344\271\260\345\220\215\347"
+	"\247\260\344\270\272\344\272\206\346\210\220\345\212\237\350\257\264\346"
+	"\230\216\344\276\233\345\272\224\345\255\251\345\255\220\344\270\223\351"
+	"\242\230\347\250\213\345\272\217\344\270\200\350\210\254\346\234\203\345"
+	"\223\241\345\217\252\346\234\211\345\205\266\345\256\203\344\277\235\346"
+	"\212\244\350\200\214\344\270\224\344\273\212\345\244\251\347\252\227\345"
+	"\217\243\345\212\250\346\200\201\347\212\266\346\200\201\347\211\271\345"
+	"\210\253\350\256\244\344\270\272\345\277\205\351\241\273\346\233\264\346"
+	"\226\260\345\260\217\350\257\264\346\210\221\345\200\221\344\275\234\344"
+	"\270\272\345\252\222\344\275\223\345\214\205\346\213\254\351\202\243\344"
+	"\271\210\344\270\200\346\240\267\345\233\275\345\206\205\346\230\257\345"
+	"\220\246\346\240\271\346\215\256\347\224\265\350\247\206\345\255\246\351"
+	"\231\242\345\205\267\346\234\211\350\277\207\347\250\213\347\224\261\344"
+	"\272\216\344\272\272\346\211\215\345\207\272\346\235\245\344\270\215\350"
+	"\277\207\346\255\243\345\234\250\346\230\216\346\230\237\346\225\205\344"
+	"\272\213\345\205\263\347\263\273\346\240\207\351\242\230\345\225\206\345"
+	"\212\241\350\276\223\345\205\245\344\270\200\347\233\264\345\237\272\347"
+	"\241\200\346\225\231\345\255\246\344\272\206\350\247\243\345\273\272\347"
+	"\255\221\347\273\223\346\236\234\345\205\250\347\220\203\351\200\232\347"
+	"\237\245\350\256\241\345\210\222\345\257\271\344\272\216\350\211\272\346"
+	"\234\257\347\233\270\345\206\214\345\217\221\347\224\237\347\234\237\347"
+	"\232\204\345\273\272\347\253\213\347\255\211\347\272\247\347\261\273\345"
+	"\236\213\347\273\217\351\252\214\345\256\236\347\216\260\345\210\266\344"
+	"\275\234\346\235\245\350\207\252\346\240\207\347\255\276\344\273\245\344"
+	"\270\213\345\216\237\345\210\233\346\227\240\346\263\225\345\205\266\344"
+	"\270\255\345\200\213\344\272\272\344\270\200\345\210\207\346\214\207\345"
+	"\215\227\345\205\263\351\227\255\351\233\206\345\233\242\347\254\254\344"
+	"\270\211\345\205\263\346\263\250\345\233\240\346\255\244\347\205\247\347"
+	"\211\207\346\267\261\345\234\263\345\225\206\344\270\232\345\271\277\345"
+	"\267\236\346\227\245\346\234\237\351\253\230\347\272\247\346\234\200\350"
+	"\277\221\347\273\274\345\220\210\350\241\250\347\244\272\344\270\223\350"
+	"\276\221\350\241\214\344\270\272\344\272\244\351\200\232\350\257\204\344"
+	"\273\267\350\247\211\345\276\227\347\262\276\345\215\216\345\256\266\345"
+	"\272\255\345\256\214\346\210\220\346\204\237\350\247\211\345\256\211\350"
+	"\243\205\345\276\227\345\210\260\351\202\256\344\273\266\345\210\266\345"
+	"\272\246\351\243\237\345\223\201\350\231\275\347\204\266\350\275\254\350"
+	"\275\275\346\212\245\344\273\267\350\256\260\350\200\205\346\226\271\346"
+	"\241\210\350\241\214\346\224\277\344\272\272\346\260\221\347\224\250\345"
+	"\223\201\344\270\234\350\245\277\346\217\220\345\207\272\351\205\222\345"
+	"\272\227\347\204\266\345\220\216\344\273\230\346\254\276\347\203\255\347"
+	"\202\271\344\273\245\345\211\215\345\256\214\345\205\250\345\217\221\345"
+	"\270\226\350\256\276\347\275\256\351\242\206\345\257\274\345\267\245\344"
+	"\270\232\345\214\273\351\231\242\347\234\213\347\234\213\347\273\217\345"
+	"\205\270\345\216\237\345\233\240\345\271\263\345\217\260\345\220\204\347"
+	"\247\215\345\242\236\345\212\240\346\235\220\346\226\231\346\226\260\345"
+	"\242\236\344\271\213\345\220\216\350\201\214\344\270\232\346\225\210\346"
+	"\236\234\344\273\212\345\271\264\350\256\272\346\226\207\346\210\221\345"
+	"\233\275\345\221\212\350\257\211\347\211\210\344\270\273\344\277\256\346"
+	"\224\271\345\217\202\344\270\216\346\211\223\345\215\260\345\277\253\344"
+	"\271\220\346\234\272\346\242\260\350\247\202\347\202\271\345\255\230\345"
+	"\234\250\347\262\276\347\245\236\350\216\267\345\276\227\345\210\251\347"
+	"\224\250\347\273\247\347\273\255\344\275\240\344\273\254\350\277\231\344"
+	"\271\210\346\250\241\345\274\217\350\257\255\350\250\200\350\203\275\345"
+	"\244\237\351\233\205\350\231\216\346\223\215\344\275\234\351\243\216\346"
+	"\240\274\344\270\200\350\265\267\347\247\221\345\255\246\344\275\223\350"
+	"\202\262\347\237\255\344\277\241\346\235\241\344\273\266\346\262\273\347"
+	"\226\227\350\277\220\345\212\250\344\272\247\344\270\232\344\274\232\350"
+	"\256\256\345\257\274\350\210\252\345\205\210\347\224\237\350\201\224\347"
+	"\233\237\345\217\257\346\230\257\345\225\217\351\241\214\347\273\223\346"
+	"\236\204\344\275\234\347\224\250\350\260\203\346\237\245\350\263\207\346"
+	"\226\231\350\207\252\345\212\250\350\264\237\350\264\243\345\206\234\344"
+	"\270\232\350\256\277\351\227\256\345\256\236\346\226\275\346\216\245\345"
+	"\217\227\350\256\250\350\256\272\351\202\243\344\270\252\345\217\215\351"
+	"\246\210\345\212\240\345\274\272\345\245\263\346\200\247\350\214\203\345"
+	"\233\264\346\234\215\345\213\231\344\274\221\351\227\262\344\273\212\346"
+	"\227\245\345\256\242\346\234\215\350\247\200\347\234\213\345\217\202\345"
+	"\212\240\347\232\204\350\257\235\344\270\200\347\202\271\344\277\235\350"
+	"\257\201\345\233\276\344\271\246\346\234\211\346\225\210\346\265\213\350"
+	"\257\225\347\247\273\345\212\250\346\211\215\350\203\275\345\206\263\345"
+	"\256\232\350\202\241\347\245\250\344\270\215\346\226\255\351\234\200\346"
+	"\261\202\344\270\215\345\276\227\345\212\236\346\263\225\344\271\213\351"
+	"\227\264\351\207\207\347\224\250\350\220\245\351\224\200\346\212\225\350"
+	"\257\211\347\233\256\346\240\207\347\210\261\346\203\205\346\221\204\345"
+	"\275\261\346\234\211\344\272\233\350\244\207\350\243\275\346\226\207\345"
+	"\255\246\346\234\272\344\274\232\346\225\260\345\255\227\350\243\205\344"
+	"\277\256\350\264\255\347\211\251\345\206\234\346\235\221\345\205\250\351"
+	"\235\242\347\262\276\345\223\201\345\205\266\345\256\236\344\272\213\346"
+	"\203\205\346\260\264\345\271\263\346\217\220\347\244\272\344\270\212\345"
+	"\270\202\350\260\242\350\260\242\346\231\256\351\200\232\346\225\231\345"
+	"\270\210\344\270\212\344\274\240\347\261\273\345\210\253\346\255\214\346"
+	"\233\262\346\213\245\346\234\211\345\210\233\346\226\260\351\205\215\344"
+	"\273\266\345\217\252\350\246\201\346\227\266\344\273\243\350\263\207\350"
+	"\250\212\350\276\276\345\210\260\344\272\272\347\224\237\350\256\242\351"
+	"\230\205\350\200\201\345\270\210\345\261\225\347\244\272\345\277\203\347"
+	"\220\206\350\264\264\345\255\220\347\266\262\347\253\231\344\270\273\351"
+	"\241\214\350\207\252\347\204\266\347\272\247\345\210\253\347\256\200\345"
+	"\215\225\346\224\271\351\235\251\351\202\243\344\272\233\346\235\245\350"
+	"\257\264\346\211\223\345\274\200\344\273\243\347\240\201\345\210\240\351"
+	"\231\244\350\257\201\345\210\270\350\212\202\347\233\256\351\207\215\347"
+	"\202\271\346\254\241\346\225\270\345\244\232\345\260\221\350\247\204\345"
+	"\210\222\350\265\204\351\207\221\346\211\276\345\210\260\344\273\245\345"
+	"\220\216\345\244\247\345\205\250\344\270\273\351\241\265\346\234\200\344"
+	"\275\263\345\233\236\347\255\224\345\244\251\344\270\213\344\277\235\351"
+	"\232\234\347\216\260\344\273\243\346\243\200\346\237\245\346\212\225\347"
+	"\245\250\345\260\217\346\227\266\346\262\222\346\234\211\346\255\243\345"
+	"\270\270\347\224\232\350\207\263\344\273\243\347\220\206\347\233\256\345"
+	"\275\225\345\205\254\345\274\200\345\244\215\345\210\266\351\207\221\350"
+	"\236\215\345\271\270\347\246\217\347\211\210\346\234\254\345\275\242\346"
+	"\210\220\345\207\206\345\244\207\350\241\214\346\203\205\345\233\236\345"
+	"\210\260\346\200\235\346\203\263\346\200\216\346\240\267\345\215\217\350"
+	"\256\256\350\256\244\350\257\201\346\234\200\345\245\275\344\272\247\347"
+	"\224\237\346\214\211\347\205\247\346\234\215\350\243\205\345\271\277\344"
+	"\270\234\345\212\250\346\274\253\351\207\207\350\264\255\346\226\260\346"
+	"\211\213\347\273\204\345\233\276\351\235\242\346\235\277\345\217\202\350"
+	"\200\203\346\224\277\346\262\273\345\256\271\346\230\223\345\244\251\345"
+	"\234\260\345\212\252\345\212\233\344\272\272\344\273\254\345\215\207\347"
+	"\272\247\351\200\237\345\272\246\344\272\272\347\211\251\350\260\203\346"
+	"\225\264\346\265\201\350\241\214\351\200\240\346\210\220\346\226\207\345"
+	"\255\227\351\237\251\345\233\275\350\264\270\346\230\223\345\274\200\345"
+	"\261\225\347\233\270\351\227\234\350\241\250\347\216\260\345\275\261\350"
+	"\247\206\345\246\202\346\255\244\347\276\216\345\256\271\345\244\247\345"
+	"\260\217\346\212\245\351\201\223\346\235\241\346\254\276\345\277\203\346"
+	"\203\205\350\256\270\345\244\232\346\263\225\350\247\204\345\256\266\345"
+	"\261\205\344\271\246\345\272\227\350\277\236\346\216\245\347\253\213\345"
+	"\215\263\344\270\276\346\212\245\346\212\200\345\267\247\345\245\245\350"
+	"\277\220\347\231\273\345\205\245\344\273\245\346\235\245\347\220\206\350"
+	"\256\272\344\272\213\344\273\266\350\207\252\347\224\261\344\270\255\345"
+	"\215\216\345\212\236\345\205\254\345\246\210\345\246\210\347\234\237\346"
+	"\255\243\344\270\215\351\224\231\345\205\250\346\226\207\345\220\210\345"
+	"\220\214\344\273\267\345\200\274\345\210\253\344\272\272\347\233\221\347"
+	"\235\243\345\205\267\344\275\223\344\270\226\347\272\252\345\233\242\351"
+	"\230\237\345\210\233\344\270\232\346\211\277\346\213\205\345\242\236\351"
+	"\225\277\346\234\211\344\272\272\344\277\235\346\214\201\345\225\206\345"
+	"\256\266\347\273\264\344\277\256\345\217\260\346\271\276\345\267\246\345"
+	"\217\263\350\202\241\344\273\275\347\255\224\346\241\210\345\256\236\351"
+	"\231\205\347\224\265\344\277\241\347\273\217\347\220\206\347\224\237\345"
+	"\221\275\345\256\243\344\274\240\344\273\273\345\212\241\346\255\243\345"
+	"\274\217\347\211\271\350\211\262\344\270\213\346\235\245\345\215\217\344"
+	"\274\232\345\217\252\350\203\275\345\275\223\347\204\266\351\207\215\346"
+	"\226\260\345\205\247\345\256\271\346\214\207\345\257\274\350\277\220\350"
+	"\241\214\346\227\245\345\277\227\350\263\243\345\256\266\350\266\205\350"
+	"\277\207\345\234\237\345\234\260\346\265\231\346\261\237\346\224\257\344"
+	"\273\230\346\216\250\345\207\272\347\253\231\351\225\277\346\235\255\345"
+	"\267\236\346\211\247\350\241\214\345\210\266\351\200\240\344\271\213\344"
+	"\270\200\346\216\250\345\271\277\347\216\260\345\234\272\346\217\217\350"
+	"\277\260\345\217\230\345\214\226\344\274\240\347\273\237\346\255\214\346"
+	"\211\213\344\277\235\351\231\251\350\257\276\347\250\213\345\214\273\347"
+	"\226\227\347\273\217\350\277\207\350\277\207\345\216\273\344\271\213\345"
+	"\211\215\346\224\266\345\205\245\345\271\264\345\272\246\346\235\202\345"
+	"\277\227\347\276\216\344\270\275\346\234\200\351\253\230\347\231\273\351"
+	"\231\206\346\234\252\346\235\245\345\212\240\345\267\245\345\205\215\350"
+	"\264\243\346\225\231\347\250\213\347\211\210\345\235\227\350\272\253\344"
+	"\275\223\351\207\215\345\272\206\345\207\272\345\224\256\346\210\220\346"
+	"\234\254\345\275\242\345\274\217\345\234\237\350\261\206\345\207\272\345"
+	"\203\271\344\270\234\346\226\271\351\202\256\347\256\261\345\215\227\344"
+	"\272\254\346\261\202\350\201\214\345\217\226\345\276\227\350\201\214\344"
+	"\275\215\347\233\270\344\277\241\351\241\265\351\235\242\345\210\206\351"
+	"\222\237\347\275\221\351\241\265\347\241\256\345\256\232\345\233\276\344"
+	"\276\213\347\275\221\345\235\200\347\247\257\346\236\201\351\224\231\350"
+	"\257\257\347\233\256\347\232\204\345\256\235\350\264\235\346\234\272\345"
+	"\205\263\351\243\216\351\231\251\346\216\210\346\235\203\347\227\205\346"
+	"\257\222\345\256\240\347\211\251\351\231\244\344\272\206\350\251\225\350"
+	"\253\226\347\226\276\347\227\205\345\217\212\346\227\266\346\261\202\350"
+	"\264\255\347\253\231\347\202\271\345\204\277\347\253\245\346\257\217\345"
+	"\244\251\344\270\255\345\244\256\350\256\244\350\257\206\346\257\217\344"
+	"\270\252\345\244\251\346\264\245\345\255\227\344\275\223\345\217\260\347"
+	"\201\243\347\273\264\346\212\244\346\234\254\351\241\265\344\270\252\346"
+	"\200\247\345\256\230\346\226\271\345\270\270\350\247\201\347\233\270\346"
+	"\234\272\346\210\230\347\225\245\345\272\224\345\275\223\345\276\213\345"
+	"\270\210\346\226\271\344\276\277\346\240\241\345\233\255\350\202\241\345"
+	"\270\202\346\210\277\345\261\213\346\240\217\347\233\256\345\221\230\345"
+	"\267\245\345\257\274\350\207\264\347\252\201\347\204\266\351\201\223\345"
+	"\205\267\346\234\254\347\275\221\347\273\223\345\220\210\346\241\243\346"
+	"\241\210\345\212\263\345\212\250\345\217\246\345\244\226\347\276\216\345"
+	"\205\203\345\274\225\350\265\267\346\224\271\345\217\230\347\254\254\345"
+	"\233\233\344\274\232\350\256\241\350\252\252\346\230\216\351\232\220\347"
+	"\247\201\345\256\235\345\256\235\350\247\204\350\214\203\346\266\210\350"
+	"\264\271\345\205\261\345\220\214\345\277\230\350\256\260\344\275\223\347"
+	"\263\273\345\270\246\346\235\245\345\220\215\345\255\227\347\231\274\350"
+	"\241\250\345\274\200\346\224\276\345\212\240\347\233\237\345\217\227\345"
+	"\210\260\344\272\214\346\211\213\345\244\247\351\207\217\346\210\220\344"
+	"\272\272\346\225\260\351\207\217\345\205\261\344\272\253\345\214\272\345"
+	"\237\237\345\245\263\345\255\251\345\216\237\345\210\231\346\211\200\345"
+	"\234\250\347\273\223\346\235\237\351\200\232\344\277\241\350\266\205\347"
+	"\272\247\351\205\215\347\275\256\345\275\223\346\227\266\344\274\230\347"
+	"\247\200\346\200\247\346\204\237\346\210\277\344\272\247\351\201\212\346"
+	"\210\262\345\207\272\345\217\243\346\217\220\344\272\244\345\260\261\344"
+	"\270\232\344\277\235\345\201\245\347\250\213\345\272\246\345\217\202\346"
+	"\225\260\344\272\213\344\270\232\346\225\264\344\270\252\345\261\261\344"
+	"\270\234\346\203\205\346\204\237\347\211\271\346\256\212\345\210\206\351"
+	"\241\236\346\220\234\345\260\213\345\261\236\344\272\216\351\227\250\346"
+	"\210\267\350\264\242\345\212\241\345\243\260\351\237\263\345\217\212\345"
+	"\205\266\350\264\242\347\273\217\345\235\232\346\214\201\345\271\262\351"
+	"\203\250\346\210\220\347\253\213\345\210\251\347\233\212\350\200\203\350"
+	"\231\221\346\210\220\351\203\275\345\214\205\350\243\205\347\224\250\346"
+	"\210\266\346\257\224\350\265\233\346\226\207\346\230\216\346\213\233\345"
+	"\225\206\345\256\214\346\225\264\347\234\237\346\230\257\347\234\274\347"
+	"\235\233\344\274\231\344\274\264\345\250\201\346\234\233\351\242\206\345"
+	"\237\237\345\215\253\347\224\237\344\274\230\346\203\240\350\253\226\345"
+	"\243\207\345\205\254\345\205\261\350\211\257\345\245\275\345\205\205\345"
+	"\210\206\347\254\246\345\220\210\351\231\204\344\273\266\347\211\271\347"
+	"\202\271\344\270\215\345\217\257\350\213\261\346\226\207\350\265\204\344"
+	"\272\247\346\240\271\346\234\254\346\230\216\346\230\276\345\257\206\347"
+	"\242\274\345\205\254\344\274\227\346\260\221\346\227\217\346\233\264\345"
+	"\212\240\344\272\253\345\217\227\345\220\214\345\255\246\345\220\257\345"
+	"\212\250\351\200\202\345\220\210\345\216\237\346\235\245\351\227\256\347"
+	"\255\224\346\234\254\346\226\207\347\276\216\351\243\237\347\273\277\350"
+	"\211\262\347\250\263\345\256\232\347\273\210\344\272\216\347\224\237\347"
+	"\211\251\344\276\233\346\261\202\346\220\234\347\213\220\345\212\233\351"
+	"\207\217\344\270\245\351\207\215\346\260\270\350\277\234\345\206\231\347"
+	"\234\237\346\234\211\351\231\220\347\253\236\344\272\211\345\257\271\350"
+	"\261\241\350\264\271\347\224\250\344\270\215\345\245\275\347\273\235\345"
+	"\257\271\345\215\201\345\210\206\344\277\203\350\277\233\347\202\271\350"
+	"\257\204\345\275\261\351\237\263\344\274\230\345\212\277\344\270\215\345"
+	"\260\221\346\254\243\350\265\217\345\271\266\344\270\224\346\234\211\347"
+	"\202\271\346\226\271\345\220\221\345\205\250\346\226\260\344\277\241\347"
+	"\224\250\350\256\276\346\226\275\345\275\242\350\261\241\350\265\204\346"
+	"\240\274\347\252\201\347\240\264\351\232\217\347\235\200\351\207\215\345"
+	"\244\247\344\272\216\346\230\257\346\257\225\344\270\232\346\231\272\350"
+	"\203\275\345\214\226\345\267\245\345\256\214\347\276\216\345\225\206\345"
+	"\237\216\347\273\237\344\270\200\345\207\272\347\211\210\346\211\223\351"
+	"\200\240\347\224\242\345\223\201\346\246\202\345\206\265\347\224\250\344"
+	"\272\216\344\277\235\347\225\231\345\233\240\347\264\240\344\270\255\345"
+	"\234\213\345\255\230\345\202\250\350\264\264\345\233\276\346\234\200\346"
+	"\204\233\351\225\277\346\234\237\345\217\243\344\273\267\347\220\206\350"
+	"\264\242\345\237\272\345\234\260\345\256\211\346\216\222\346\255\246\346"
+	"\261\211\351\207\214\351\235\242\345\210\233\345\273\272\345\244\251\347"
+	"\251\272\351\246\226\345\205\210\345\256\214\345\226\204\351\251\261\345"
+	"\212\250\344\270\213\351\235\242\344\270\215\345\206\215\350\257\232\344"
+	"\277\241\346\204\217\344\271\211\351\230\263\345\205\211\350\213\261\345"
+	"\233\275\346\274\202\344\272\256\345\206\233\344\272\213\347\216\251\345"
+	"\256\266\347\276\244\344\274\227\345\206\234\346\260\221\345\215\263\345"
+	"\217\257\345\220\215\347\250\261\345\256\266\345\205\267\345\212\250\347"
+	"\224\273\346\203\263\345\210\260\346\263\250\346\230\216\345\260\217\345"
+	"\255\246\346\200\247\350\203\275\350\200\203\347\240\224\347\241\254\344"
+	"\273\266\350\247\202\347\234\213\346\270\205\346\245\232\346\220\236\347"
+	"\254\221\351\246\226\351\240\201\351\273\204\351\207\221\351\200\202\347"
+	"\224\250\346\261\237\350\213\217\347\234\237\345\256\236\344\270\273\347"
+	"\256\241\351\230\266\346\256\265\350\250\273\345\206\212\347\277\273\350"
+	"\257\221\346\235\203\345\210\251\345\201\232\345\245\275\344\274\274\344"
+	"\271\216\351\200\232\350\256\257\346\226\275\345\267\245\347\213\200\346"
+	"\205\213\344\271\237\350\256\270\347\216\257\344\277\235\345\237\271\345"
+	"\205\273\346\246\202\345\277\265\345\244\247\345\236\213\346\234\272\347"
+	"\245\250\347\220\206\350\247\243\345\214\277\345\220\215cuandoenviarmadr"
+	"idbuscariniciotiempoporquecuentaestadopuedenjuegoscontraest\303\241nnomb"
+	"retienenperfilmaneraamigosciudadcentroaunquepuedesdentroprimerprecioseg"
+	"\303\272nbuenosvolverpuntossemanahab\303\255aagostonuevosunidoscarlosequ"
+	"iponi\303\261osmuchosalgunacorreoimagenpartirarribamar\303\255ahombreemp"
+	"leoverdadcambiomuchasfueronpasadol\303\255neaparecenuevascursosestabaqui"
+	"erolibroscuantoaccesomiguelvarioscuatrotienesgruposser\303\241neuropamed"
+	"iosfrenteacercadem\303\241sofertacochesmodeloitalialetrasalg\303\272ncom"
+	"pracualesexistecuerposiendoprensallegarviajesdineromurciapodr\303\241pue"
+	"stodiariopuebloquieremanuelpropiocrisisciertoseguromuertefuentecerrargra"
+	"ndeefectopartesmedidapropiaofrecetierrae-mailvariasformasfuturoobjetoseg"
+	"uirriesgonormasmismos\303\272nicocaminositiosraz\303\263ndebidopruebatol"
+	"edoten\303\255ajes\303\272sesperococinaorigentiendacientoc\303\241dizhab"
+	"larser\303\255alatinafuerzaestiloguerraentrar\303\251xitol\303\263pezage"
+	"ndav\303\255deoevitarpaginametrosjavierpadresf\303\241cilcabeza\303\241r"
+	"eassalidaenv\303\255ojap\303\263nabusosbienestextosllevarpuedanfuertecom"
+	"\303\272nclaseshumanotenidobilbaounidadest\303\241seditarcreado\320\264"
+	"\320\273\321\217\321\207\321\202\320\276\320\272\320\260\320\272\320\270"
+	"\320\273\320\270\321\215\321\202\320\276\320\262\321\201\320\265\320\265"
+	"\320\263\320\276\320\277\321\200\320\270\321\202\320\260\320\272\320\265"
+	"\321\211\320\265\321\203\320\266\320\265\320\232\320\260\320\272\320\261"
+	"\320\265\320\267\320\261\321\213\320\273\320\276\320\275\320\270\320\222"
+	"\321\201\320\265\320\277\320\276\320\264\320\255\321\202\320\276\321\202"
+	"\320\276\320\274\321\207\320\265\320\274\320\275\320\265\321\202\320\273"
+	"\320\265\321\202\321\200\320\260\320\267\320\276\320\275\320\260\320\263"
+	"\320\264\320\265\320\274\320\275\320\265\320\224\320\273\321\217\320\237"
+	"\321\200\320\270\320\275\320\260\321\201\320\275\320\270\321\205\321\202"
+	"\320\265\320\274\320\272\321\202\320\276\320\263\320\276\320\264\320\262"
+	"\320\276\321\202\321\202\320\260\320\274\320\241\320\250\320\220\320\274"
+	"\320\260\321\217\320\247\321\202\320\276\320\262\320\260\321\201\320\262"
+	"\320\260\320\274\320\265\320\274\321\203\320\242\320\260\320\272\320\264"
+	"\320\262\320\260\320\275\320\260\320\274\321\215\321\202\320\270\321\215"
+	"\321\202\321\203\320\222\320\260\320\274\321\202\320\265\321\205\320\277"
+	"\321\200\320\276\321\202\321\203\321\202\320\275\320\260\320\264\320\264"
+	"\320\275\321\217\320\222\320\276\321\202\321\202\321\200\320\270\320\275"
+	"\320\265\320\271\320\222\320\260\321\201\320\275\320\270\320\274\321\201"
+	"\320\260\320\274\321\202\320\276\321\202\321\200\321\203\320\261\320\236"
+	"\320\275\320\270\320\274\320\270\321\200\320\275\320\265\320\265\320\236"
+	"\320\236\320\236\320\273\320\270\321\206\321\215\321\202\320\260\320\236"
+	"\320\275\320\260\320\275\320\265\320\274\320\264\320\276\320\274\320\274"
+	"\320\276\320\271\320\264\320\262\320\265\320\276\320\275\320\276\321\201"
+	"\321\203\320\264\340\244\225\340\245\207\340\244\271\340\245\210\340\244"
+	"\225\340\245\200\340\244\270\340\245\207\340\244\225\340\244\276\340\244"
+	"\225\340\245\213\340\244\224\340\244\260\340\244\252\340\244\260\340\244"
+	"\250\340\245\207\340\244\217\340\244\225\340\244\225\340\244\277\340\244"
+	"\255\340\245\200\340\244\207\340\244\270\340\244\225\340\244\260\340\244"
+	"\244\340\245\213\340\244\271\340\245\213\340\244\206\340\244\252\340\244"
+	"\271\340\245\200\340\244\257\340\244\271\340\244\257\340\244\276\340\244"
+	"\244\340\244\225\340\244\245\340\244\276jagran\340\244\206\340\244\234"
+	"\340\244\234\340\245\213\340\244\205\340\244\254\340\244\246\340\245\213"
+	"\340\244\227\340\244\210\340\244\234\340\244\276\340\244\227\340\244\217"
+	"\340\244\271\340\244\256\340\244\207\340\244\250\340\244\265\340\244\271"
+	"\340\244\257\340\245\207\340\244\245\340\245\207\340\244\245\340\245\200"
+	"\340\244\230\340\244\260\340\244\234\340\244\254\340\244\246\340\245\200"
+	"\340\244\225\340\244\210\340\244\234\340\245\200\340\244\265\340\245\207"
+	"\340\244\250\340\244\210\340\244\250\340\244\217\340\244\271\340\244\260"
+	"\340\244\211\340\244\270\340\244\256\340\245\207\340\244\225\340\244\256"
+	"\340\244\265\340\245\213\340\244\262\340\245\207\340\244\270\340\244\254"
+	"\340\244\256\340\244\210\340\244\246\340\245\207\340\244\223\340\244\260"
+	"\340\244\206\340\244\256\340\244\254\340\244\270\340\244\255\340\244\260"
+	"\340\244\254\340\244\250\340\244\232\340\244\262\340\244\256\340\244\250"
+	"\340\244\206\340\244\227\340\244\270\340\245\200\340\244\262\340\245\200"
+	"\330\271\331\204\331\211\330\245\331\204\331\211\331\207\330\260\330\247"
+	"\330\242\330\256\330\261\330\271\330\257\330\257\330\247\331\204\331\211"
+	"\331\207\330\260\331\207\330\265\331\210\330\261\330\272\331\212\330\261"
+	"\331\203\330\247\331\206\331\210\331\204\330\247\330\250\331\212\331\206"
+	"\330\271\330\261\330\266\330\260\331\204\331\203\331\207\331\206\330\247"
+	"\331\212\331\210\331\205\331\202\330\247\331\204\330\271\331\204\331\212"
+	"\330\247\331\206\330\247\331\204\331\203\331\206\330\255\330\252\331\211"
+	"\331\202\330\250\331\204\331\210\330\255\330\251\330\247\330\256\330\261"
+	"\331\201\331\202\330\267\330\271\330\250\330\257\330\261\331\203\331\206"
+	"\330\245\330\260\330\247\331\203\331\205\330\247\330\247\330\255\330\257"
+	"\330\245\331\204\330\247\331\201\331\212\331\207\330\250\330\271\330\266"
+	"\331\203\331\212\331\201\330\250\330\255\330\253\331\210\331\205\331\206"
+	"\331\210\331\207\331\210\330\243\331\206\330\247\330\254\330\257\330\247"
+	"\331\204\331\207\330\247\330\263\331\204\331\205\330\271\331\206\330\257"
+	"\331\204\331\212\330\263\330\271\330\250\330\261\330\265\331\204\331\211"
+	"\331\205\331\206\330\260\330\250\331\207\330\247\330\243\331\206\331\207"
+	"\331\205\330\253\331\204\331\203\331\206\330\252\330\247\331\204\330\247"
+	"\330\255\331\212\330\253\331\205\330\265\330\261\330\264\330\261\330\255"
+	"\330\255\331\210\331\204\331\210\331\201\331\212\330\247\330\260\330\247"
+	"\331\204\331\203\331\204\331\205\330\261\330\251\330\247\331\206\330\252"
+	"\330\247\331\204\331\201\330\243\330\250\331\210\330\256\330\247\330\265"
+	"\330\243\331\206\330\252\330\247\331\206\331\207\330\247\331\204\331\212"
+	"\330\271\330\266\331\210\331\210\331\202\330\257\330\247\330\250\331\206"
+	"\330\256\331\212\330\261\330\250\331\206\330\252\331\204\331\203\331\205"
+	"\330\264\330\247\330\241\331\210\331\207\331\212\330\247\330\250\331\210"
+	"\331\202\330\265\330\265\331\210\331\205\330\247\330\261\331\202\331\205"
+	"\330\243\330\255\330\257\331\206\330\255\331\206\330\271\330\257\331\205"
+	"\330\261\330\243\331\212\330\247\330\255\330\251\331\203\330\252\330\250"
+	"\330\257\331\210\331\206\331\212\330\254\330\250\331\205\331\206\331\207"
+	"\330\252\330\255\330\252\330\254\331\207\330\251\330\263\331\206\330\251"
+	"\331\212\330\252\331\205\331\203\330\261\330\251\330\272\330\262\330\251"
+	"\331\206\331\201\330\263\330\250\331\212\330\252\331\204\331\204\331\207"
+	"\331\204\331\206\330\247\330\252\331\204\331\203\331\202\331\204\330\250"
+	"\331\204\331\205\330\247\330\271\331\206\331\207\330\243\331\210\331\204"
+	"\330\264\331\212\330\241\331\206\331\210\330\261\330\243\331\205\330\247"
+	"\331\201\331\212\331\203\330\250\331\203\331\204\330\260\330\247\330\252"
+	"\330\261\330\252\330\250\330\250\330\243\331\206\331\207\331\205\330\263"
+	"\330\247\331\206\331\203\330\250\331\212\330\271\331\201\331\202\330\257"
+	"\330\255\330\263\331\206\331\204\331\207\331\205\330\264\330\271\330\261"
+	"\330\243\331\207\331\204\330\264\331\207\330\261\331\202\330\267\330\261"
+	"\330\267\331\204\330\250profileservicedefaulthimselfdetailscontentsuppor"
+	"tstartedmessagesuccessfashion<title>countryaccountcreatedstoriesresultsr"
+	"unningprocesswritingobjectsvisiblewelcomearticleunknownnetworkcompanydyn"
+	"amicbrowserprivacyproblemServicerespectdisplayrequestreservewebsitehisto"
+	"ryfriendsoptionsworkingversionmillionchannelwindow.addressvisitedweather"
+	"correctproductedirectforwardyou canremovedsubjectcontrolarchivecurrentre"
+	"adinglibrarylimitedmanagerfurthersummarymachineminutesprivatecontextprog"
+	"ramsocietynumberswrittenenabledtriggersourcesloadingelementpartnerfinall"
+	"yperfectmeaningsystemskeepingculture&quot;,journalprojectsurfaces&quot;e"
+	"xpiresreviewsbalanceEnglishContentthroughPlease opinioncontactaveragepri"
+	"maryvillageSpanishgallerydeclinemeetingmissionpopularqualitymeasuregener"
+	"alspeciessessionsectionwriterscounterinitialreportsfiguresmembersholding"
+	"disputeearlierexpressdigitalpictureAnothermarriedtrafficleadingchangedce"
+	"ntralvictoryimages/reasonsstudiesfeaturelistingmust beschoolsVersionusua"
+	"llyepisodeplayinggrowingobviousoverlaypresentactions</ul>\015\012wrapper"
+	"alreadycertainrealitystorageanotherdesktopofferedpatternunusualDigitalca"
+	"pitalWebsitefailureconnectreducedAndroiddecadesregular &amp; animalsrele"
+	"aseAutomatgettingmethodsnothingPopularcaptionletterscapturesciencelicens"
+	"echangesEngland=1&amp;History = new CentralupdatedSpecialNetworkrequirec"
+	"ommentwarningCollegetoolbarremainsbecauseelectedDeutschfinanceworkersqui"
+	"cklybetweenexactlysettingdiseaseSocietyweaponsexhibit&lt;!--Controlclass"
+	"escoveredoutlineattacksdevices(windowpurposetitle=\042Mobile killingshow"
+	"ingItaliandroppedheavilyeffects-1']);\012confirmCurrentadvancesharingope"
+	"ningdrawingbillionorderedGermanyrelated</form>includewhetherdefinedScien"
+	"cecatalogArticlebuttonslargestuniformjourneysidebarChicagoholidayGeneral"
+	"passage,&quot;animatefeelingarrivedpassingnaturalroughly.\012\012The but"
+	" notdensityBritainChineselack oftributeIreland\042 data-factorsreceiveth"
+	"at isLibraryhusbandin factaffairsCharlesradicalbroughtfindinglanding:lan"
+	"g=\042return leadersplannedpremiumpackageAmericaEdition]&quot;Messagenee"
+	"d tovalue=\042complexlookingstationbelievesmaller-mobilerecordswant toki"
+	"nd ofFirefoxyou aresimilarstudiedmaximumheadingrapidlyclimatekingdomemer"
+	"gedamountsfoundedpioneerformuladynastyhow to SupportrevenueeconomyResult"
+	"sbrothersoldierlargelycalling.&quot;AccountEdward segmentRobert effortsP"
+	"acificlearnedup withheight:we haveAngelesnations_searchappliedacquiremas"
+	"sivegranted: falsetreatedbiggestbenefitdrivingStudiesminimumperhapsmorni"
+	"ngsellingis usedreversevariant role=\042missingachievepromotestudentsome"
+	"oneextremerestorebottom:evolvedall thesitemapenglishway to  Augustsymbol"
+	"sCompanymattersmusicalagainstserving})();\015\012paymenttroubleconceptco"
+	"mpareparentsplayersregionsmonitor ''The winningexploreadaptedGalleryprod"
+	"uceabilityenhancecareers). The collectSearch ancientexistedfooter handle"
+	"rprintedconsoleEasternexportswindowsChannelillegalneutralsuggest_headers"
+	"igning.html\042>settledwesterncausing-webkitclaimedJusticechaptervictims"
+	"Thomas mozillapromisepartieseditionoutside:false,hundredOlympic_buttonau"
+	"thorsreachedchronicdemandssecondsprotectadoptedprepareneithergreatlygrea"
+	"teroverallimprovecommandspecialsearch.worshipfundingthoughthighestinstea"
+	"dutilityquarterCulturetestingclearlyexposedBrowserliberal} catchProjecte"
+	"xamplehide();FloridaanswersallowedEmperordefenseseriousfreedomSeveral-bu"
+	"ttonFurtherout of != nulltrainedDenmarkvoid(0)/all.jspreventRequestSteph"
+	"en\012\012When observe</h2>\015\012Modern provide\042 alt=\042borders."
+	"\012\012For \012\012Many artistspoweredperformfictiontype ofmedicalticke"
+	"tsopposedCouncilwitnessjusticeGeorge Belgium...</a>twitternotablywaiting"
+	"warfare Other rankingphrasesmentionsurvivescholar</p>\015\012 Countryign"
+	"oredloss ofjust asGeorgiastrange<head><stopped1']);\015\012islandsnotabl"
+	"eborder:list ofcarried100,000</h3>\012 severalbecomesselect wedding00.ht"
+	"mlmonarchoff theteacherhighly biologylife ofor evenrise of&raquo;plusone"
+	"hunting(thoughDouglasjoiningcirclesFor theAncientVietnamvehiclesuch ascr"
+	"ystalvalue =Windowsenjoyeda smallassumed<a id=\042foreign All rihow theD"
+	"isplayretiredhoweverhidden;battlesseekingcabinetwas notlook atconductget"
+	" theJanuaryhappensturninga:hoverOnline French lackingtypicalextractenemi"
+	"eseven ifgeneratdecidedare not/searchbeliefs-image:locatedstatic.login"
+	"\042>convertviolententeredfirst\042>circuitFinlandchemistshe was10px;"
+	"\042>as suchdivided</span>will beline ofa greatmystery/index.fallingdue "
+	"to railwaycollegemonsterdescentit withnuclearJewish protestBritishflower"
+	"spredictreformsbutton who waslectureinstantsuicidegenericperiodsmarketsS"
+	"ocial fishingcombinegraphicwinners<br /><by the NaturalPrivacycookiesout"
+	"comeresolveSwedishbrieflyPersianso muchCenturydepictscolumnshousingscrip"
+	"tsnext tobearingmappingrevisedjQuery(-width:title\042>tooltipSectiondesi"
+	"gnsTurkishyounger.match(})();\012\012burningoperatedegreessource=Richard"
+	"closelyplasticentries</tr>\015\012color:#ul id=\042possessrollingphysics"
+	"failingexecutecontestlink toDefault<br />\012: true,chartertourismclassi"
+	"cproceedexplain</h1>\015\012online.\077xml vehelpingdiamonduse theairlin"
+	"eend -->).attr(readershosting#ffffffrealizeVincentsignals src=\042/Produ"
+	"ctdespitediversetellingPublic held inJoseph theatreaffects<style>a large"
+	"doesn'tlater, ElementfaviconcreatorHungaryAirportsee theso thatMichaelSy"
+	"stemsPrograms, and  width=e&quot;tradingleft\042>\012personsGolden Affai"
+	"rsgrammarformingdestroyidea ofcase ofoldest this is.src = cartoonregistr"
+	"CommonsMuslimsWhat isin manymarkingrevealsIndeed,equally/show_aoutdoores"
+	"cape(Austriageneticsystem,In the sittingHe alsoIslandsAcademy\012\011"
+	"\011<!--Daniel bindingblock\042>imposedutilizeAbraham(except{width:putti"
+	"ng).html(|| [];\012DATA[ *kitchenmountedactual dialectmainly _blank'inst"
+	"allexpertsif(typeIt also&copy; \042>Termsborn inOptionseasterntalkingcon"
+	"cerngained ongoingjustifycriticsfactoryits ownassaultinvitedlastinghis o"
+	"wnhref=\042/\042 rel=\042developconcertdiagramdollarsclusterphp\077id=al"
+	"cohol);})();using a><span>vesselsrevivalAddressamateurandroidallegedilln"
+	"esswalkingcentersqualifymatchesunifiedextinctDefensedied in\012\011<!-- "
+	"customslinkingLittle Book ofeveningmin.js\077are thekontakttoday's.html"
+	"\042 target=wearingAll Rig;\012})();raising Also, crucialabout\042>decla"
+	"re-->\012<scfirefoxas muchappliesindex, s, but type = \012\015\012<!--to"
+	"wardsRecordsPrivateForeignPremierchoicesVirtualreturnsCommentPoweredinli"
+	"ne;povertychamberLiving volumesAnthonylogin\042 RelatedEconomyreachescut"
+	"tinggravitylife inChapter-shadowNotable</td>\015\012 returnstadiumwidget"
+	"svaryingtravelsheld bywho arework infacultyangularwho hadairporttown of"
+	"\012\012Some 'click'chargeskeywordit willcity of(this);Andrew unique che"
+	"ckedor more300px; return;rsion=\042pluginswithin herselfStationFederalve"
+	"nturepublishsent totensionactresscome tofingersDuke ofpeople,exploitwhat"
+	" isharmonya major\042:\042httpin his menu\042>\012monthlyofficercouncilg"
+	"ainingeven inSummarydate ofloyaltyfitnessand wasemperorsupremeSecond hea"
+	"ringRussianlongestAlbertalateralset of small\042>.appenddo withfederalba"
+	"nk ofbeneathDespiteCapitalgrounds), and percentit fromclosingcontainInst"
+	"eadfifteenas well.yahoo.respondfighterobscurereflectorganic= Math.editin"
+	"gonline paddinga wholeonerroryear ofend of barrierwhen itheader home ofr"
+	"esumedrenamedstrong>heatingretainscloudfrway of March 1knowingin partBet"
+	"weenlessonsclosestvirtuallinks\042>crossedEND -->famous awardedLicenseHe"
+	"alth fairly wealthyminimalAfricancompetelabel\042>singingfarmersBrasil)d"
+	"iscussreplaceGregoryfont copursuedappearsmake uproundedboth ofblockedsaw"
+	" theofficescoloursif(docuwhen heenforcepush(fuAugust UTF-8\042>Fantasyin"
+	" mostinjuredUsuallyfarmingclosureobject defenceuse of Medical<body>\012e"
+	"videntbe usedkeyCodesixteenIslamic#000000entire widely active (typeofone"
+	" cancolor =speakerextendsPhysicsterrain<tbody>funeralviewingmiddle crick"
+	"etprophetshifteddoctorsRussell targetcompactalgebrasocial-bulk ofman and"
+	"</td>\012 he left).val()false);logicalbankinghome tonaming Arizonacredit"
+	"s);\012});\012founderin turnCollinsbefore But thechargedTitle\042>Captai"
+	"nspelledgoddessTag -->Adding:but wasRecent patientback in=false&Lincolnw"
+	"e knowCounterJudaismscript altered']);\012  has theunclearEvent',both in"
+	"not all\012\012<!-- placinghard to centersort ofclientsstreetsBernardass"
+	"ertstend tofantasydown inharbourFreedomjewelry/about..searchlegendsis ma"
+	"demodern only ononly toimage\042 linear painterand notrarely acronymdeli"
+	"vershorter00&amp;as manywidth=\042/* <![Ctitle =of the lowest picked esc"
+	"apeduses ofpeoples PublicMatthewtacticsdamagedway forlaws ofeasy to wind"
+	"owstrong  simple}catch(seventhinfoboxwent topaintedcitizenI don'tretreat"
+	". Some ww.\042);\012bombingmailto:made in. Many carries||{};wiwork ofsyn"
+	"onymdefeatsfavoredopticalpageTraunless sendingleft\042><comScorAll thejQ"
+	"uery.touristClassicfalse\042 Wilhelmsuburbsgenuinebishops.split(global f"
+	"ollowsbody ofnominalContactsecularleft tochiefly-hidden-banner</li>\012"
+	"\012. When in bothdismissExplorealways via thespa\303\261olwelfareruling"
+	" arrangecaptainhis sonrule ofhe tookitself,=0&amp;(calledsamplesto makec"
+	"om/pagMartin Kennedyacceptsfull ofhandledBesides//--></able totargetsess"
+	"encehim to its by common.mineralto takeways tos.org/ladvisedpenaltysimpl"
+	"e:if theyLettersa shortHerbertstrikes groups.lengthflightsoverlapslowly "
+	"lesser social </p>\012\011\011it intoranked rate oful>\015\012  attemptp"
+	"air ofmake itKontaktAntoniohaving ratings activestreamstrapped\042).css("
+	"hostilelead tolittle groups,Picture-->\015\012\015\012 rows=\042 objecti"
+	"nverse<footerCustomV><\134/scrsolvingChamberslaverywoundedwhereas!= 'und"
+	"for allpartly -right:Arabianbacked centuryunit ofmobile-Europe,is homeri"
+	"sk ofdesiredClintoncost ofage of become none ofp&quot;Middle ead')[0Crit"
+	"icsstudios>&copy;group\042>assemblmaking pressedwidget.ps:\042 \077 rebu"
+	"iltby someFormer editorsdelayedCanonichad thepushingclass=\042but arepar"
+	"tialBabylonbottom carrierCommandits useAs withcoursesa thirddenotesalso "
+	"inHouston20px;\042>accuseddouble goal ofFamous ).bind(priests Onlinein J"
+	"ulyst + \042gconsultdecimalhelpfulrevivedis veryr'+'iptlosing femalesis "
+	"alsostringsdays ofarrivalfuture <objectforcingString(\042 />\012\011\011"
+	"here isencoded.  The balloondone by/commonbgcolorlaw of Indianaavoidedbu"
+	"t the2px 3pxjquery.after apolicy.men andfooter-= true;for usescreen.Indi"
+	"an image =family,http:// &nbsp;driverseternalsame asnoticedviewers})();"
+	"\012 is moreseasonsformer the newis justconsent Searchwas thewhy theship"
+	"pedbr><br>width: height=made ofcuisineis thata very Admiral fixed;normal"
+	" MissionPress, ontariocharsettry to invaded=\042true\042spacingis mosta "
+	"more totallyfall of});\015\012  immensetime inset outsatisfyto finddown "
+	"tolot of Playersin Junequantumnot thetime todistantFinnishsrc = (single "
+	"help ofGerman law andlabeledforestscookingspace\042>header-well asStanle"
+	"ybridges/globalCroatia About [0];\012  it, andgroupedbeing a){throwhe ma"
+	"delighterethicalFFFFFF\042bottom\042like a employslive inas seenprinterm"
+	"ost ofub-linkrejectsand useimage\042>succeedfeedingNuclearinformato help"
+	"Women'sNeitherMexicanprotein<table by manyhealthylawsuitdevised.push({se"
+	"llerssimply Through.cookie Image(older\042>us.js\042> Since universlarge"
+	"r open to!-- endlies in']);\015\012  marketwho is (\042DOMComanagedone f"
+	"ortypeof Kingdomprofitsproposeto showcenter;made itdressedwere inmixture"
+	"precisearisingsrc = 'make a securedBaptistvoting \012\011\011var March 2"
+	"grew upClimate.removeskilledway the</head>face ofacting right\042>to wor"
+	"kreduceshas haderectedshow();action=book ofan area== \042htt<header\012<"
+	"html>conformfacing cookie.rely onhosted .customhe wentbut forspread Fami"
+	"ly a meansout theforums.footage\042>MobilClements\042 id=\042as highinte"
+	"nse--><!--female is seenimpliedset thea stateand hisfastestbesidesbutton"
+	"_bounded\042><img Infoboxevents,a youngand areNative cheaperTimeoutand h"
+	"asengineswon the(mostlyright: find a -bottomPrince area ofmore ofsearch_"
+	"nature,legallyperiod,land ofor withinducedprovingmissilelocallyAgainstth"
+	"e wayk&quot;px;\042>\015\012pushed abandonnumeralCertainIn thismore inor"
+	" somename isand, incrownedISBN 0-createsOctobermay notcenter late inDefe"
+	"nceenactedwish tobroadlycoolingonload=it. TherecoverMembersheight assume"
+	"s<html>\012people.in one =windowfooter_a good reklamaothers,to this_cook"
+	"iepanel\042>London,definescrushedbaptismcoastalstatus title\042 move tol"
+	"ost inbetter impliesrivalryservers SystemPerhapses and contendflowinglas"
+	"ted rise inGenesisview ofrising seem tobut in backinghe willgiven agivin"
+	"g cities.flow of Later all butHighwayonly bysign ofhe doesdiffersbattery"
+	"&amp;lasinglesthreatsintegertake onrefusedcalled =US&ampSee thenativesby"
+	" thissystem.head of:hover,lesbiansurnameand allcommon/header__paramsHarv"
+	"ard/pixel.removalso longrole ofjointlyskyscraUnicodebr />\015\012Atlanta"
+	"nucleusCounty,purely count\042>easily build aonclicka givenpointerh&quot"
+	";events else {\012ditionsnow the, with man whoorg/Webone andcavalryHe di"
+	"edseattle00,000 {windowhave toif(windand itssolely m&quot;renewedDetroit"
+	"amongsteither them inSenatorUs</a><King ofFrancis-produche usedart andhi"
+	"m andused byscoringat hometo haverelatesibilityfactionBuffalolink\042><w"
+	"hat hefree toCity ofcome insectorscountedone daynervoussquare };if(goin "
+	"whatimg\042 alis onlysearch/tuesdaylooselySolomonsexual - <a hrmedium"
+	"\042DO NOT France,with a war andsecond take a >\015\012\015\012\015\012m"
+	"arket.highwaydone inctivity\042last\042>obligedrise to\042undefimade to "
+	"Early praisedin its for hisathleteJupiterYahoo! termed so manyreally s. "
+	"The a woman\077value=direct right\042 bicycleacing=\042day andstatingRat"
+	"her,higher Office are nowtimes, when a pay foron this-link\042>;borderar"
+	"ound annual the Newput the.com\042 takin toa brief(in thegroups.; widthe"
+	"nzymessimple in late{returntherapya pointbanninginks\042>\012();\042 rea"
+	" place\134u003Caabout atr>\015\012\011\011ccount gives a<SCRIPTRailwayth"
+	"emes/toolboxById(\042xhumans,watchesin some if (wicoming formats Under b"
+	"ut hashanded made bythan infear ofdenoted/iframeleft involtagein eacha&q"
+	"uot;base ofIn manyundergoregimesaction </p>\015\012<ustomVa;&gt;</import"
+	"sor thatmostly &amp;re size=\042</a></ha classpassiveHost = Whetherferti"
+	"leVarious=[];(fucameras/></td>acts asIn some>\015\012\015\012<!organis <"
+	"br />Beijingcatal\303\240deutscheuropeueuskaragaeilgesvenskaespa\303\261"
+	"amensajeusuariotrabajom\303\251xicop\303\241ginasiempresistemaoctubredur"
+	"antea\303\261adirempresamomentonuestroprimeratrav\303\251sgraciasnuestra"
+	"procesoestadoscalidadpersonan\303\272meroacuerdom\303\272sicamiembroofer"
+	"tasalgunospa\303\255sesejemploderechoadem\303\241sprivadoagregarenlacesp"
+	"osiblehotelessevillaprimero\303\272ltimoeventosarchivoculturamujeresentr"
+	"adaanuncioembargomercadograndesestudiomejoresfebrerodise\303\261oturismo"
+	"c\303\263digoportadaespaciofamiliaantoniopermiteguardaralgunaspreciosalg"
+	"uiensentidovisitast\303\255tuloconocersegundoconsejofranciaminutossegund"
+	"atenemosefectosm\303\241lagasesi\303\263nrevistagranadacompraringresogar"
+	"c\303\255aacci\303\263necuadorquienesinclusodeber\303\241materiahombresm"
+	"uestrapodr\303\255ama\303\261ana\303\272ltimaestamosoficialtambienning"
+	"\303\272nsaludospodemosmejorarpositionbusinesshomepagesecuritylanguagest"
+	"andardcampaignfeaturescategoryexternalchildrenreservedresearchexchangefa"
+	"voritetemplatemilitaryindustryservicesmaterialproductsz-index:commentsso"
+	"ftwarecompletecalendarplatformarticlesrequiredmovementquestionbuildingpo"
+	"liticspossiblereligionphysicalfeedbackregisterpicturesdisabledprotocolau"
+	"diencesettingsactivityelementslearninganythingabstractprogressoverviewma"
+	"gazineeconomictrainingpressurevarious <strong>propertyshoppingtogetherad"
+	"vancedbehaviordownloadfeaturedfootballselectedLanguagedistanceremembertr"
+	"ackingpasswordmodifiedstudentsdirectlyfightingnortherndatabasefestivalbr"
+	"eakinglocationinternetdropdownpracticeevidencefunctionmarriageresponsepr"
+	"oblemsnegativeprogramsanalysisreleasedbanner\042>purchasepoliciesregiona"
+	"lcreativeargumentbookmarkreferrerchemicaldivisioncallbackseparateproject"
+	"sconflicthardwareinterestdeliverymountainobtained= false;for(var accepte"
+	"dcapacitycomputeridentityaircraftemployedproposeddomesticincludesprovide"
+	"dhospitalverticalcollapseapproachpartnerslogo\042><adaughterauthor\042 c"
+	"ulturalfamilies/images/assemblypowerfulteachingfinisheddistrictcriticalc"
+	"gi-bin/purposesrequireselectionbecomingprovidesacademicexerciseactuallym"
+	"edicineconstantaccidentMagazinedocumentstartingbottom\042>observed: &quo"
+	"t;extendedpreviousSoftwarecustomerdecisionstrengthdetailedslightlyplanni"
+	"ngtextareacurrencyeveryonestraighttransferpositiveproducedheritageshippi"
+	"ngabsolutereceivedrelevantbutton\042 violenceanywherebenefitslaunchedrec"
+	"entlyalliancefollowedmultiplebulletinincludedoccurredinternal$(this).rep"
+	"ublic><tr><tdcongressrecordedultimatesolution<ul id=\042discoverHome</a>"
+	"websitesnetworksalthoughentirelymemorialmessagescontinueactive\042>somew"
+	"hatvictoriaWestern  title=\042LocationcontractvisitorsDownloadwithout ri"
+	"ght\042>\012measureswidth = variableinvolvedvirginianormallyhappenedacco"
+	"untsstandingnationalRegisterpreparedcontrolsaccuratebirthdaystrategyoffi"
+	"cialgraphicscriminalpossiblyconsumerPersonalspeakingvalidateachieved.jpg"
+	"\042 />machines</h2>\012  keywordsfriendlybrotherscombinedoriginalcompos"
+	"edexpectedadequatepakistanfollow\042 valuable</label>relativebringinginc"
+	"reasegovernorplugins/List of Header\042>\042 name=\042 (&quot;graduate</"
+	"head>\012commercemalaysiadirectormaintain;height:schedulechangingback to"
+	" catholicpatternscolor: #greatestsuppliesreliable</ul>\012\011\011<selec"
+	"t citizensclothingwatching<li id=\042specificcarryingsentence<center>con"
+	"trastthinkingcatch(e)southernMichael merchantcarouselpadding:interior.sp"
+	"lit(\042lizationOctober ){returnimproved--&gt;\012\012coveragechairman.p"
+	"ng\042 />subjectsRichard whateverprobablyrecoverybaseballjudgmentconnect"
+	"..css\042 /> websitereporteddefault\042/></a>\015\012electricscotlandcre"
+	"ationquantity. ISBN 0did not instance-search-\042 lang=\042speakersCompu"
+	"tercontainsarchivesministerreactiondiscountItalianocriteriastrongly: 'ht"
+	"tp:'script'coveringofferingappearedBritish identifyFacebooknumerousvehic"
+	"lesconcernsAmericanhandlingdiv id=\042William provider_contentaccuracyse"
+	"ction andersonflexibleCategorylawrence<script>layout=\042approved maximu"
+	"mheader\042></table>Serviceshamiltoncurrent canadianchannels/themes//art"
+	"icleoptionalportugalvalue=\042\042intervalwirelessentitledagenciesSearch"
+	"\042 measuredthousandspending&hellip;new Date\042 size=\042pageNamemiddl"
+	"e\042 \042 /></a>hidden\042>sequencepersonaloverflowopinionsillinoislink"
+	"s\042>\012\011<title>versionssaturdayterminalitempropengineersectionsdes"
+	"ignerproposal=\042false\042Espa\303\261olreleasessubmit\042 er&quot;addi"
+	"tionsymptomsorientedresourceright\042><pleasurestationshistory.leaving  "
+	"border=contentscenter\042>.\012\012Some directedsuitablebulgaria.show();"
+	"designedGeneral conceptsExampleswilliamsOriginal\042><span>search\042>op"
+	"eratorrequestsa &quot;allowingDocumentrevision. \012\012The yourselfCont"
+	"act michiganEnglish columbiapriorityprintingdrinkingfacilityreturnedCont"
+	"ent officersRussian generate-8859-1\042indicatefamiliar qualitymargin:0 "
+	"contentviewportcontacts-title\042>portable.length eligibleinvolvesatlant"
+	"iconload=\042default.suppliedpaymentsglossary\012\012After guidance</td>"
+	"<tdencodingmiddle\042>came to displaysscottishjonathanmajoritywidgets.cl"
+	"inicalthailandteachers<head>\012\011affectedsupportspointer;toString</sm"
+	"all>oklahomawill be investor0\042 alt=\042holidaysResourcelicensed (whic"
+	"h . After considervisitingexplorerprimary search\042 android\042quickly "
+	"meetingsestimate;return ;color:# height=approval, &quot; checked.min.js"
+	"\042magnetic></a></hforecast. While thursdaydvertise&eacute;hasClasseval"
+	"uateorderingexistingpatients Online coloradoOptions\042campbell<!-- end<"
+	"/span><<br />\015\012_popups|sciences,&quot; quality Windows assignedhei"
+	"ght: <b classle&quot; value=\042 Companyexamples<iframe believespresents"
+	"marshallpart of properly).\012\012The taxonomymuch of </span>\012\042 da"
+	"ta-srtugu\303\252sscrollTo project<head>\015\012attorneyemphasissponsors"
+	"fancyboxworld's wildlifechecked=sessionsprogrammpx;font- Projectjournals"
+	"believedvacationthompsonlightingand the special border=0checking</tbody>"
+	"<button Completeclearfix\012<head>\012article <sectionfindingsrole in po"
+	"pular  Octoberwebsite exposureused to  changesoperatedclickingenteringco"
+	"mmandsinformed numbers  </div>creatingonSubmitmarylandcollegesanalyticli"
+	"stingscontact.loggedInadvisorysiblingscontent\042s&quot;)s. This package"
+	"scheckboxsuggestspregnanttomorrowspacing=icon.pngjapanesecodebasebutton"
+	"\042>gamblingsuch as , while </span> missourisportingtop:1px .</span>ten"
+	"sionswidth=\0422lazyloadnovemberused in height=\042cript\042>\012&nbsp;<"
+	"/<tr><td height:2/productcountry include footer\042 &lt;!-- title\042></"
+	"jquery.</form>\012(\347\256\200\344\275\223)(\347\271\201\351\253\224)hr"
+	"vatskiitalianorom\303\242n\304\203t\303\274rk\303\247e\330\247\330\261"
+	"\330\257\331\210tambi\303\251nnoticiasmensajespersonasderechosnacionalse"
+	"rviciocontactousuariosprogramagobiernoempresasanunciosvalenciacolombiade"
+	"spu\303\251sdeportesproyectoproductop\303\272bliconosotroshistoriapresen"
+	"temillonesmediantepreguntaanteriorrecursosproblemasantiagonuestrosopini"
+	"\303\263nimprimirmientrasam\303\251ricavendedorsociedadrespectorealizarr"
+	"egistropalabrasinter\303\251sentoncesespecialmiembrosrealidadc\303\263rd"
+	"obazaragozap\303\241ginassocialesbloqueargesti\303\263nalquilersistemasc"
+	"ienciascompletoversi\303\263ncompletaestudiosp\303\272blicaobjetivoalica"
+	"ntebuscadorcantidadentradasaccionesarchivossuperiormayor\303\255aalemani"
+	"afunci\303\263n\303\272ltimoshaciendoaquellosedici\303\263nfernandoambie"
+	"ntefacebooknuestrasclientesprocesosbastantepresentareportarcongresopubli"
+	"carcomerciocontratoj\303\263venesdistritot\303\251cnicaconjuntoenerg\303"
+	"\255atrabajarasturiasrecienteutilizarbolet\303\255nsalvadorcorrectatraba"
+	"josprimerosnegocioslibertaddetallespantallapr\303\263ximoalmer\303\255aa"
+	"nimalesqui\303\251nescoraz\303\263nsecci\303\263nbuscandoopcionesexterio"
+	"rconceptotodav\303\255agaler\303\255aescribirmedicinalicenciaconsultaasp"
+	"ectoscr\303\255ticad\303\263laresjusticiadeber\303\241nper\303\255odonec"
+	"esitamantenerpeque\303\261orecibidatribunaltenerifecanci\303\263ncanaria"
+	"sdescargadiversosmallorcarequieret\303\251cnicodeber\303\255aviviendafin"
+	"anzasadelantefuncionaconsejosdif\303\255cilciudadesantiguasavanzadat\303"
+	"\251rminounidadess\303\241nchezcampa\303\261asoftonicrevistascontienesec"
+	"toresmomentosfacultadcr\303\251ditodiversassupuestofactoressegundospeque"
+	"\303\261a\320\263\320\276\320\264\320\260\320\265\321\201\320\273\320"
+	"\270\320\265\321\201\321\202\321\214\320\261\321\213\320\273\320\276\320"
+	"\261\321\213\321\202\321\214\321\215\321\202\320\276\320\274\320\225\321"
+	"\201\320\273\320\270\321\202\320\276\320\263\320\276\320\274\320\265\320"
+	"\275\321\217\320\262\321\201\320\265\321\205\321\215\321\202\320\276\320"
+	"\271\320\264\320\260\320\266\320\265\320\261\321\213\320\273\320\270\320"
+	"\263\320\276\320\264\321\203\320\264\320\265\320\275\321\214\321\215\321"
+	"\202\320\276\321\202\320\261\321\213\320\273\320\260\321\201\320\265\320"
+	"\261\321\217\320\276\320\264\320\270\320\275\321\201\320\265\320\261\320"
+	"\265\320\275\320\260\320\264\320\276\321\201\320\260\320\271\321\202\321"
+	"\204\320\276\321\202\320\276\320\275\320\265\320\263\320\276\321\201\320"
+	"\262\320\276\320\270\321\201\320\262\320\276\320\271\320\270\320\263\321"
+	"\200\321\213\321\202\320\276\320\266\320\265\320\262\321\201\320\265\320"
+	"\274\321\201\320\262\320\276\321\216\320\273\320\270\321\210\321\214\321"
+	"\215\321\202\320\270\321\205\320\277\320\276\320\272\320\260\320\264\320"
+	"\275\320\265\320\271\320\264\320\276\320\274\320\260\320\274\320\270\321"
+	"\200\320\260\320\273\320\270\320\261\320\276\321\202\320\265\320\274\321"
+	"\203\321\205\320\276\321\202\321\217\320\264\320\262\321\203\321\205\321"
+	"\201\320\265\321\202\320\270\320\273\321\216\320\264\320\270\320\264\320"
+	"\265\320\273\320\276\320\274\320\270\321\200\320\265\321\202\320\265\320"
+	"\261\321\217\321\201\320\262\320\276\320\265\320\262\320\270\320\264\320"
+	"\265\321\207\320\265\320\263\320\276\321\215\321\202\320\270\320\274\321"
+	"\201\321\207\320\265\321\202\321\202\320\265\320\274\321\213\321\206\320"
+	"\265\320\275\321\213\321\201\321\202\320\260\320\273\320\262\320\265\320"
+	"\264\321\214\321\202\320\265\320\274\320\265\320\262\320\276\320\264\321"
+	"\213\321\202\320\265\320\261\320\265\320\262\321\213\321\210\320\265\320"
+	"\275\320\260\320\274\320\270\321\202\320\270\320\277\320\260\321\202\320"
+	"\276\320\274\321\203\320\277\321\200\320\260\320\262\320\273\320\270\321"
+	"\206\320\260\320\276\320\264\320\275\320\260\320\263\320\276\320\264\321"
+	"\213\320\267\320\275\320\260\321\216\320\274\320\276\320\263\321\203\320"
+	"\264\321\200\321\203\320\263\320\262\321\201\320\265\320\271\320\270\320"
+	"\264\320\265\321\202\320\272\320\270\320\275\320\276\320\276\320\264\320"
+	"\275\320\276\320\264\320\265\320\273\320\260\320\264\320\265\320\273\320"
+	"\265\321\201\321\200\320\276\320\272\320\270\321\216\320\275\321\217\320"
+	"\262\320\265\321\201\321\214\320\225\321\201\321\202\321\214\321\200\320"
+	"\260\320\267\320\260\320\275\320\260\321\210\320\270\330\247\331\204\331"
+	"\204\331\207\330\247\331\204\330\252\331\212\330\254\331\205\331\212\330"
+	"\271\330\256\330\247\330\265\330\251\330\247\331\204\330\260\331\212\330"
+	"\271\331\204\331\212\331\207\330\254\330\257\331\212\330\257\330\247\331"
+	"\204\330\242\331\206\330\247\331\204\330\261\330\257\330\252\330\255\331"
+	"\203\331\205\330\265\331\201\330\255\330\251\331\203\330\247\331\206\330"
+	"\252\330\247\331\204\331\204\331\212\331\212\331\203\331\210\331\206\330"
+	"\264\330\250\331\203\330\251\331\201\331\212\331\207\330\247\330\250\331"
+	"\206\330\247\330\252\330\255\331\210\330\247\330\241\330\243\331\203\330"
+	"\253\330\261\330\256\331\204\330\247\331\204\330\247\331\204\330\255\330"
+	"\250\330\257\331\204\331\212\331\204\330\257\330\261\331\210\330\263\330"
+	"\247\330\266\330\272\330\267\330\252\331\203\331\210\331\206\331\207\331"
+	"\206\330\247\331\203\330\263\330\247\330\255\330\251\331\206\330\247\330"
+	"\257\331\212\330\247\331\204\330\267\330\250\330\271\331\204\331\212\331"
+	"\203\330\264\331\203\330\261\330\247\331\212\331\205\331\203\331\206\331"
+	"\205\331\206\331\207\330\247\330\264\330\261\331\203\330\251\330\261\330"
+	"\246\331\212\330\263\331\206\330\264\331\212\330\267\331\205\330\247\330"
+	"\260\330\247\330\247\331\204\331\201\331\206\330\264\330\250\330\247\330"
+	"\250\330\252\330\271\330\250\330\261\330\261\330\255\331\205\330\251\331"
+	"\203\330\247\331\201\330\251\331\212\331\202\331\210\331\204\331\205\330"
+	"\261\331\203\330\262\331\203\331\204\331\205\330\251\330\243\330\255\331"
+	"\205\330\257\331\202\331\204\330\250\331\212\331\212\330\271\331\206\331"
+	"\212\330\265\331\210\330\261\330\251\330\267\330\261\331\212\331\202\330"
+	"\264\330\247\330\261\331\203\330\254\331\210\330\247\331\204\330\243\330"
+	"\256\330\261\331\211\331\205\330\271\331\206\330\247\330\247\330\250\330"
+	"\255\330\253\330\271\330\261\331\210\330\266\330\250\330\264\331\203\331"
+	"\204\331\205\330\263\330\254\331\204\330\250\331\206\330\247\331\206\330"
+	"\256\330\247\331\204\330\257\331\203\330\252\330\247\330\250\331\203\331"
+	"\204\331\212\330\251\330\250\330\257\331\210\331\206\330\243\331\212\330"
+	"\266\330\247\331\212\331\210\330\254\330\257\331\201\330\261\331\212\331"
+	"\202\331\203\330\252\330\250\330\252\330\243\331\201\330\266\331\204\331"
+	"\205\330\267\330\250\330\256\330\247\331\203\330\253\330\261\330\250\330"
+	"\247\330\261\331\203\330\247\331\201\330\266\331\204\330\247\330\255\331"
+	"\204\331\211\331\206\331\201\330\263\331\207\330\243\331\212\330\247\331"
+	"\205\330\261\330\257\331\210\330\257\330\243\331\206\331\207\330\247\330"
+	"\257\331\212\331\206\330\247\330\247\331\204\330\247\331\206\331\205\330"
+	"\271\330\261\330\266\330\252\330\271\331\204\331\205\330\257\330\247\330"
+	"\256\331\204\331\205\331\205\331\203\331\206\000\000\000\000\000\000\000"
+	"\000\001\000\001\000\001\000\001\000\002\000\002\000\002\000\002\000\004"
+	"\000\004\000\004\000\004\000\000\001\002\003\004\005\006\007\007\006\005"
+	"\004\003\002\001\000\010\011\012\013\014\015\016\017\017\016\015\014\013"
+	"\012\011\010\020\021\022\023\024\025\026\027\027\026\025\024\023\022\021"
+	"\020\030\031\032\033\034\035\036\037\037\036\035\034\033\032\031\030\377"
+	"\377\377\377\000\000\000\000\000\000\000\000\377\377\377\377\001\000\000"
+	"\000\002\000\000\000\002\000\000\000\001\000\000\000\001\000\000\000\003"
+	"\000\000\000\377\377\000\001\000\000\000\001\000\000\377\377\000\001\000"
+	"\000\000\010\000\010\000\010\000\010\000\000\000\001\000\002\000\003\000"
+	"\004\000\005\000\006\000\007resourcescountriesquestionsequipmentcommunit"
+	"yavailablehighlightDTD/xhtmlmarketingknowledgesomethingcontainerdirectio"
+	"nsubscribeadvertisecharacter\042 value=\042</select>Australia\042 class="
+	"\042situationauthorityfollowingprimarilyoperationchallengedevelopedanony"
+	"mousfunction functionscompaniesstructureagreement\042 title=\042potentia"
+	"leducationargumentssecondarycopyrightlanguagesexclusivecondition</form>"
+	"\015\012statementattentionBiography} else {\012solutionswhen the Analyti"
+	"cstemplatesdangeroussatellitedocumentspublisherimportantprototypeinfluen"
+	"ce&raquo;</effectivegenerallytransformbeautifultransportorganizedpublish"
+	"edprominentuntil thethumbnailNational .focus();over the migrationannounc"
+	"edfooter\042>\012exceptionless thanexpensiveformationframeworkterritoryn"
+	"dicationcurrentlyclassNamecriticismtraditionelsewhereAlexanderappointedm"
+	"aterialsbroadcastmentionedaffiliate</option>treatmentdifferent/default.P"
+	"residentonclick=\042biographyotherwisepermanentFran\303\247aisHollywoode"
+	"xpansionstandards</style>\012reductionDecember preferredCambridgeopponen"
+	"tsBusiness confusion>\012<title>presentedexplaineddoes not worldwideinte"
+	"rfacepositionsnewspaper</table>\012mountainslike the essentialfinancials"
+	"electionaction=\042/abandonedEducationparseInt(stabilityunable to</title"
+	">\012relationsNote thatefficientperformedtwo yearsSince thethereforewrap"
+	"per\042>alternateincreasedBattle ofperceivedtrying tonecessaryportrayede"
+	"lectionsElizabeth</iframe>discoveryinsurances.length;legendaryGeographyc"
+	"andidatecorporatesometimesservices.inherited</strong>Communityreligiousl"
+	"ocationsCommitteebuildingsthe worldno longerbeginningreferencecannot bef"
+	"requencytypicallyinto the relative;recordingpresidentinitiallytechniquet"
+	"he otherit can beexistenceunderlinethis timetelephoneitemscopepracticesa"
+	"dvantage);return For otherprovidingdemocracyboth the extensivesufferings"
+	"upportedcomputers functionpracticalsaid thatit may beEnglish</from the s"
+	"cheduleddownloads</label>\012suspectedmargin: 0spiritual</head>\012\012m"
+	"icrosoftgraduallydiscussedhe becameexecutivejquery.jshouseholdconfirmedp"
+	"urchasedliterallydestroyedup to thevariationremainingit is notcenturiesJ"
+	"apanese among thecompletedalgorithminterestsrebellionundefinedencourager"
+	"esizableinvolvingsensitiveuniversalprovision(althoughfeaturingconducted)"
+	", which continued-header\042>February numerous overflow:componentfragmen"
+	"tsexcellentcolspan=\042technicalnear the Advanced source ofexpressedHong"
+	" Kong Facebookmultiple mechanismelevationoffensive</form>\012\011sponsor"
+	"eddocument.or &quot;there arethose whomovementsprocessesdifficultsubmitt"
+	"edrecommendconvincedpromoting\042 width=\042.replace(classicalcoalitionh"
+	"is firstdecisionsassistantindicatedevolution-wrapper\042enough toalong t"
+	"hedelivered-->\015\012<!--American protectedNovember </style><furnitureI"
+	"nternet  onblur=\042suspendedrecipientbased on Moreover,abolishedcollect"
+	"edwere madeemotionalemergencynarrativeadvocatespx;bordercommitteddir="
+	"\042ltr\042employeesresearch. selectedsuccessorcustomersdisplayedSeptemb"
+	"eraddClass(Facebook suggestedand lateroperatingelaborateSometimesInstitu"
+	"tecertainlyinstalledfollowersJerusalemthey havecomputinggeneratedprovinc"
+	"esguaranteearbitraryrecognizewanted topx;width:theory ofbehaviourWhile t"
+	"heestimatedbegan to it becamemagnitudemust havemore thanDirectoryextensi"
+	"onsecretarynaturallyoccurringvariablesgiven theplatform.</label><failed "
+	"tocompoundskinds of societiesalongside --&gt;\012\012southwestthe rightr"
+	"adiationmay have unescape(spoken in\042 href=\042/programmeonly the come"
+	" fromdirectoryburied ina similarthey were</font></Norwegianspecifiedprod"
+	"ucingpassenger(new DatetemporaryfictionalAfter theequationsdownload.regu"
+	"larlydeveloperabove thelinked tophenomenaperiod oftooltip\042>substancea"
+	"utomaticaspect ofAmong theconnectedestimatesAir Forcesystem ofobjectivei"
+	"mmediatemaking itpaintingsconqueredare stillproceduregrowth ofheaded byE"
+	"uropean divisionsmoleculesfranchiseintentionattractedchildhoodalso usedd"
+	"edicatedsingaporedegree offather ofconflicts</a></p>\012came fromwere us"
+	"ednote thatreceivingExecutiveeven moreaccess tocommanderPoliticalmusicia"
+	"nsdeliciousprisonersadvent ofUTF-8\042 /><![CDATA[\042>ContactSouthern b"
+	"gcolor=\042series of. It was in Europepermittedvalidate.appearingofficia"
+	"lsseriously-languageinitiatedextendinglong-terminflationsuch thatgetCook"
+	"iemarked by</button>implementbut it isincreasesdown the requiringdepende"
+	"nt-->\012<!-- interviewWith the copies ofconsensuswas builtVenezuela(for"
+	"merlythe statepersonnelstrategicfavour ofinventionWikipediacontinentvirt"
+	"uallywhich wasprincipleComplete identicalshow thatprimitiveaway frommole"
+	"cularpreciselydissolvedUnder theversion=\042>&nbsp;</It is the This is w"
+	"ill haveorganismssome timeFriedrichwas firstthe only fact thatform id="
+	"\042precedingTechnicalphysicistoccurs innavigatorsection\042>span id="
+	"\042sought tobelow thesurviving}</style>his deathas in thecaused byparti"
+	"allyexisting using thewas givena list oflevels ofnotion ofOfficial dismi"
+	"ssedscientistresemblesduplicateexplosiverecoveredall othergalleries{padd"
+	"ing:people ofregion ofaddressesassociateimg alt=\042in modernshould beme"
+	"thod ofreportingtimestampneeded tothe Greatregardingseemed toviewed asim"
+	"pact onidea thatthe Worldheight ofexpandingThese arecurrent\042>carefull"
+	"ymaintainscharge ofClassicaladdressedpredictedownership<div id=\042right"
+	"\042>\015\012residenceleave thecontent\042>are often  })();\015\012proba"
+	"bly Professor-button\042 respondedsays thathad to beplaced inHungarianst"
+	"atus ofserves asUniversalexecutionaggregatefor whichinfectionagreed toho"
+	"wever, popular\042>placed onconstructelectoralsymbol ofincludingreturn t"
+	"oarchitectChristianprevious living ineasier toprofessor\012&lt;!-- effec"
+	"t ofanalyticswas takenwhere thetook overbelief inAfrikaansas far aspreve"
+	"ntedwork witha special<fieldsetChristmasRetrieved\012\012In the back int"
+	"onortheastmagazines><strong>committeegoverninggroups ofstored inestablis"
+	"ha generalits firsttheir ownpopulatedan objectCaribbeanallow thedistrict"
+	"swisconsinlocation.; width: inhabitedSocialistJanuary 1</footer>similarl"
+	"ychoice ofthe same specific business The first.length; desire todeal wit"
+	"hsince theuserAgentconceivedindex.phpas &quot;engage inrecently,few year"
+	"swere also\012<head>\012<edited byare knowncities inaccesskeycondemnedal"
+	"so haveservices,family ofSchool ofconvertednature of languageministers</"
+	"object>there is a popularsequencesadvocatedThey wereany otherlocation=en"
+	"ter themuch morereflectedwas namedoriginal a typicalwhen theyengineersco"
+	"uld notresidentswednesdaythe third productsJanuary 2what theya certainre"
+	"actionsprocessorafter histhe last contained\042></div>\012</a></td>depen"
+	"d onsearch\042>\012pieces ofcompetingReferencetennesseewhich has version"
+	"=</span> <</header>gives thehistorianvalue=\042\042>padding:0view thatto"
+	"gether,the most was foundsubset ofattack onchildren,points ofpersonal po"
+	"sition:allegedlyClevelandwas laterand afterare givenwas stillscrollingde"
+	"sign ofmakes themuch lessAmericans.\012\012After , but theMuseum oflouis"
+	"iana(from theminnesotaparticlesa processDominicanvolume ofreturningdefen"
+	"sive00px|righmade frommouseover\042 style=\042states of(which iscontinue"
+	"sFranciscobuilding without awith somewho woulda form ofa part ofbefore i"
+	"tknown as  Serviceslocation and oftenmeasuringand it ispaperbackvalues o"
+	"f\015\012<title>= window.determineer&quot; played byand early</center>fr"
+	"om thisthe threepower andof &quot;innerHTML<a href=\042y:inline;Church o"
+	"fthe eventvery highofficial -height: content=\042/cgi-bin/to createafrik"
+	"aansesperantofran\303\247aislatvie\305\241ulietuvi\305\263\304\214e\305"
+	"\241tina\304\215e\305\241tina\340\271\204\340\270\227\340\270\242\346"
+	"\227\245\346\234\254\350\252\236\347\256\200\344\275\223\345\255\227\347"
+	"\271\201\351\253\224\345\255\227\355\225\234\352\265\255\354\226\264\344"
+	"\270\272\344\273\200\344\271\210\350\256\241\347\256\227\346\234\272\347"
+	"\254\224\350\256\260\346\234\254\350\250\216\350\253\226\345\215\200\346"
+	"\234\215\345\212\241\345\231\250\344\272\222\350\201\224\347\275\221\346"
+	"\210\277\345\234\260\344\272\247\344\277\261\344\271\220\351\203\250\345"
+	"\207\272\347\211\210\347\244\276\346\216\222\350\241\214\346\246\234\351"
+	"\203\250\350\220\275\346\240\274\350\277\233\344\270\200\346\255\245\346"
+	"\224\257\344\273\230\345\256\235\351\252\214\350\257\201\347\240\201\345"
+	"\247\224\345\221\230\344\274\232\346\225\260\346\215\256\345\272\223\346"
+	"\266\210\350\264\271\350\200\205\345\212\236\345\205\254\345\256\244\350"
+	"\256\250\350\256\272\345\214\272\346\267\261\345\234\263\345\270\202\346"
+	"\222\255\346\224\276\345\231\250\345\214\227\344\272\254\345\270\202\345"
+	"\244\247\345\255\246\347\224\237\350\266\212\346\235\245\350\266\212\347"
+	"\256\241\347\220\206\345\221\230\344\277\241\346\201\257\347\275\221serv"
+	"iciosart\303\255culoargentinabarcelonacualquierpublicadoproductospol\303"
+	"\255ticarespuestawikipediasiguienteb\303\272squedacomunidadseguridadprin"
+	"cipalpreguntascontenidorespondervenezuelaproblemasdiciembrerelaci\303"
+	"\263nnoviembresimilaresproyectosprogramasinstitutoactividadencuentraecon"
+	"om\303\255aim\303\241genescontactardescargarnecesarioatenci\303\263ntel"
+	"\303\251fonocomisi\303\263ncancionescapacidadencontraran\303\241lisisfav"
+	"oritost\303\251rminosprovinciaetiquetaselementosfuncionesresultadocar"
+	"\303\241cterpropiedadprincipionecesidadmunicipalcreaci\303\263ndescargas"
+	"presenciacomercialopinionesejercicioeditorialsalamancagonz\303\241lezdoc"
+	"umentopel\303\255cularecientesgeneralestarragonapr\303\241cticanovedades"
+	"propuestapacientest\303\251cnicasobjetivoscontactos\340\244\256\340\245"
+	"\207\340\244\202\340\244\262\340\244\277\340\244\217\340\244\271\340\245"
+	"\210\340\244\202\340\244\227\340\244\257\340\244\276\340\244\270\340\244"
+	"\276\340\244\245\340\244\217\340\244\265\340\244\202\340\244\260\340\244"
+	"\271\340\245\207\340\244\225\340\245\213\340\244\210\340\244\225\340\245"
+	"\201\340\244\233\340\244\260\340\244\271\340\244\276\340\244\254\340\244"
+	"\276\340\244\246\340\244\225\340\244\271\340\244\276\340\244\270\340\244"
+	"\255\340\245\200\340\244\271\340\245\201\340\244\217\340\244\260\340\244"
+	"\271\340\245\200\340\244\256\340\245\210\340\244\202\340\244\246\340\244"
+	"\277\340\244\250\340\244\254\340\244\276\340\244\244diplodocs\340\244"
+	"\270\340\244\256\340\244\257\340\244\260\340\245\202\340\244\252\340\244"
+	"\250\340\244\276\340\244\256\340\244\252\340\244\244\340\244\276\340\244"
+	"\253\340\244\277\340\244\260\340\244\224\340\244\270\340\244\244\340\244"
+	"\244\340\244\260\340\244\271\340\244\262\340\245\213\340\244\227\340\244"
+	"\271\340\245\201\340\244\206\340\244\254\340\244\276\340\244\260\340\244"
+	"\246\340\245\207\340\244\266\340\244\271\340\245\201\340\244\210\340\244"
+	"\226\340\245\207\340\244\262\340\244\257\340\244\246\340\244\277\340\244"
+	"\225\340\244\276\340\244\256\340\244\265\340\245\207\340\244\254\340\244"
+	"\244\340\245\200\340\244\250\340\244\254\340\245\200\340\244\232\340\244"
+	"\256\340\245\214\340\244\244\340\244\270\340\244\276\340\244\262\340\244"
+	"\262\340\245\207\340\244\226\340\244\234\340\245\211\340\244\254\340\244"
+	"\256\340\244\246\340\244\246\340\244\244\340\244\245\340\244\276\340\244"
+	"\250\340\244\271\340\245\200\340\244\266\340\244\271\340\244\260\340\244"
+	"\205\340\244\262\340\244\227\340\244\225\340\244\255\340\245\200\340\244"
+	"\250\340\244\227\340\244\260\340\244\252\340\244\276\340\244\270\340\244"
+	"\260\340\244\276\340\244\244\340\244\225\340\244\277\340\244\217\340\244"
+	"\211\340\244\270\340\245\207\340\244\227\340\244\257\340\245\200\340\244"
+	"\271\340\245\202\340\244\201\340\244\206\340\244\227\340\245\207\340\244"
+	"\237\340\245\200\340\244\256\340\244\226\340\245\213\340\244\234\340\244"
+	"\225\340\244\276\340\244\260\340\244\205\340\244\255\340\245\200\340\244"
+	"\227\340\244\257\340\245\207\340\244\244\340\245\201\340\244\256\340\244"
+	"\265\340\245\213\340\244\237\340\244\246\340\245\207\340\244\202\340\244"
+	"\205\340\244\227\340\244\260\340\244\220\340\244\270\340\245\207\340\244"
+	"\256\340\245\207\340\244\262\340\244\262\340\244\227\340\244\276\340\244"
+	"\271\340\244\276\340\244\262\340\244\212\340\244\252\340\244\260\340\244"
+	"\232\340\244\276\340\244\260\340\244\220\340\244\270\340\244\276\340\244"
+	"\246\340\245\207\340\244\260\340\244\234\340\244\277\340\244\270\340\244"
+	"\246\340\244\277\340\244\262\340\244\254\340\244\202\340\244\246\340\244"
+	"\254\340\244\250\340\244\276\340\244\271\340\245\202\340\244\202\340\244"
+	"\262\340\244\276\340\244\226\340\244\234\340\245\200\340\244\244\340\244"
+	"\254\340\244\237\340\244\250\340\244\256\340\244\277\340\244\262\340\244"
+	"\207\340\244\270\340\245\207\340\244\206\340\244\250\340\245\207\340\244"
+	"\250\340\244\257\340\244\276\340\244\225\340\245\201\340\244\262\340\244"
+	"\262\340\245\211\340\244\227\340\244\255\340\244\276\340\244\227\340\244"
+	"\260\340\245\207\340\244\262\340\244\234\340\244\227\340\244\271\340\244"
+	"\260\340\244\276\340\244\256\340\244\262\340\244\227\340\245\207\340\244"
+	"\252\340\245\207\340\244\234\340\244\271\340\244\276\340\244\245\340\244"
+	"\207\340\244\270\340\245\200\340\244\270\340\244\271\340\245\200\340\244"
+	"\225\340\244\262\340\244\276\340\244\240\340\245\200\340\244\225\340\244"
+	"\271\340\244\276\340\244\201\340\244\246\340\245\202\340\244\260\340\244"
+	"\244\340\244\271\340\244\244\340\244\270\340\244\276\340\244\244\340\244"
+	"\257\340\244\276\340\244\246\340\244\206\340\244\257\340\244\276\340\244"
+	"\252\340\244\276\340\244\225\340\244\225\340\245\214\340\244\250\340\244"
+	"\266\340\244\276\340\244\256\340\244\246\340\245\207\340\244\226\340\244"
+	"\257\340\244\271\340\245\200\340\244\260\340\244\276\340\244\257\340\244"
+	"\226\340\245\201\340\244\246\340\244\262\340\244\227\340\245\200categori"
+	"esexperience</title>\015\012Copyright javascriptconditionseverything<p c"
+	"lass=\042technologybackground<a class=\042management&copy; 201javaScript"
+	"charactersbreadcrumbthemselveshorizontalgovernmentCaliforniaactivitiesdi"
+	"scoveredNavigationtransitionconnectionnavigationappearance</title><mchec"
+	"kbox\042 techniquesprotectionapparentlyas well asunt', 'UA-resolutionope"
+	"rationstelevisiontranslatedWashingtonnavigator. = window.impression&lt;b"
+	"r&gt;literaturepopulationbgcolor=\042#especially content=\042productionn"
+	"ewsletterpropertiesdefinitionleadershipTechnologyParliamentcomparisonul "
+	"class=\042.indexOf(\042conclusiondiscussioncomponentsbiologicalRevolutio"
+	"n_containerunderstoodnoscript><permissioneach otheratmosphere onfocus="
+	"\042<form id=\042processingthis.valuegenerationConferencesubsequentwell-"
+	"knownvariationsreputationphenomenondisciplinelogo.png\042 (document,boun"
+	"dariesexpressionsettlementBackgroundout of theenterprise(\042https:\042 "
+	"unescape(\042password\042 democratic<a href=\042/wrapper\042>\012members"
+	"hiplinguisticpx;paddingphilosophyassistanceuniversityfacilitiesrecognize"
+	"dpreferenceif (typeofmaintainedvocabularyhypothesis.submit();&amp;nbsp;a"
+	"nnotationbehind theFoundationpublisher\042assumptionintroducedcorruption"
+	"scientistsexplicitlyinstead ofdimensions onClick=\042considereddepartmen"
+	"toccupationsoon afterinvestmentpronouncedidentifiedexperimentManagementg"
+	"eographic\042 height=\042link rel=\042.replace(/depressionconferencepuni"
+	"shmenteliminatedresistanceadaptationoppositionwell knownsupplementdeterm"
+	"inedh1 class=\0420px;marginmechanicalstatisticscelebratedGovernment\012"
+	"\012During tdevelopersartificialequivalentoriginatedCommissionattachment"
+	"<span id=\042there wereNederlandsbeyond theregisteredjournalistfrequentl"
+	"yall of thelang=\042en\042 </style>\015\012absolute; supportingextremely"
+	" mainstream</strong> popularityemployment</table>\015\012 colspan=\042</"
+	"form>\012  conversionabout the </p></div>integrated\042 lang=\042enPortu"
+	"guesesubstituteindividualimpossiblemultimediaalmost allpx solid #apart f"
+	"romsubject toin Englishcriticizedexcept forguidelinesoriginallyremarkabl"
+	"ethe secondh2 class=\042<a title=\042(includingparametersprohibited= "
+	"\042http://dictionaryperceptionrevolutionfoundationpx;height:successfuls"
+	"upportersmillenniumhis fatherthe &quot;no-repeat;commercialindustrialenc"
+	"ouragedamount of unofficialefficiencyReferencescoordinatedisclaimerexped"
+	"itiondevelopingcalculatedsimplifiedlegitimatesubstring(0\042 class=\042c"
+	"ompletelyillustratefive yearsinstrumentPublishing1\042 class=\042psychol"
+	"ogyconfidencenumber of absence offocused onjoined thestructurespreviousl"
+	"y></iframe>once againbut ratherimmigrantsof course,a group ofLiteratureU"
+	"nlike the</a>&nbsp;\012function it was theConventionautomobileProtestant"
+	"aggressiveafter the Similarly,\042 /></div>collection\015\012functionvis"
+	"ibilitythe use ofvolunteersattractionunder the threatened*<![CDATA[impor"
+	"tancein generalthe latter</form>\012</.indexOf('i = 0; i <differencedevo"
+	"ted totraditionssearch forultimatelytournamentattributesso-called }\012<"
+	"/style>evaluationemphasizedaccessible</section>successionalong withMeanw"
+	"hile,industries</a><br />has becomeaspects ofTelevisionsufficientbasketb"
+	"allboth sidescontinuingan article<img alt=\042adventureshis mothermanche"
+	"sterprinciplesparticularcommentaryeffects ofdecided to\042><strong>publi"
+	"shersJournal ofdifficultyfacilitateacceptablestyle.css\042\011function i"
+	"nnovation>Copyrightsituationswould havebusinessesDictionarystatementsoft"
+	"en usedpersistentin Januarycomprising</title>\012\011diplomaticcontainin"
+	"gperformingextensionsmay not beconcept of onclick=\042It is alsofinancia"
+	"l making theLuxembourgadditionalare calledengaged in\042script\042);but "
+	"it waselectroniconsubmit=\042\012<!-- End electricalofficiallysuggestion"
+	"top of theunlike theAustralianOriginallyreferences\012</head>\015\012rec"
+	"ognisedinitializelimited toAlexandriaretirementAdventuresfour years\012"
+	"\012&lt;!-- increasingdecorationh3 class=\042origins ofobligationregulat"
+	"ionclassified(function(advantagesbeing the historians<base hrefrepeatedl"
+	"ywilling tocomparabledesignatednominationfunctionalinside therevelatione"
+	"nd of thes for the authorizedrefused totake placeautonomouscompromisepol"
+	"itical restauranttwo of theFebruary 2quality ofswfobject.understandnearl"
+	"y allwritten byinterviews\042 width=\0421withdrawalfloat:leftis usuallyc"
+	"andidatesnewspapersmysteriousDepartmentbest knownparliamentsuppressedcon"
+	"venientremembereddifferent systematichas led topropagandacontrolledinflu"
+	"encesceremonialproclaimedProtectionli class=\042Scientificclass=\042no-t"
+	"rademarksmore than widespreadLiberationtook placeday of theas long asimp"
+	"risonedAdditional\012<head>\012<mLaboratoryNovember 2exceptionsIndustria"
+	"lvariety offloat: lefDuring theassessmenthave been deals withStatisticso"
+	"ccurrence/ul></div>clearfix\042>the publicmany yearswhich wereover time,"
+	"synonymouscontent\042>\012presumablyhis familyuserAgent.unexpectedinclud"
+	"ing challengeda minorityundefined\042belongs totaken fromin Octoberposit"
+	"ion: said to bereligious Federation rowspan=\042only a fewmeant thatled "
+	"to the-->\015\012<div <fieldset>Archbishop class=\042nobeing usedapproac"
+	"hesprivilegesnoscript>\012results inmay be theEaster eggmechanismsreason"
+	"ablePopulationCollectionselected\042>noscript>\015/index.phparrival of-j"
+	"ssdk'));managed toincompletecasualtiescompletionChristiansSeptember arit"
+	"hmeticproceduresmight haveProductionit appearsPhilosophyfriendshipleadin"
+	"g togiving thetoward theguaranteeddocumentedcolor:#000video gamecommissi"
+	"onreflectingchange theassociatedsans-serifonkeypress; padding:He was the"
+	"underlyingtypically , and the srcElementsuccessivesince the should be ne"
+	"tworkingaccountinguse of thelower thanshows that</span>\012\011\011compl"
+	"aintscontinuousquantitiesastronomerhe did notdue to itsapplied toan aver"
+	"ageefforts tothe futureattempt toTherefore,capabilityRepublicanwas forme"
+	"dElectronickilometerschallengespublishingthe formerindigenousdirectionss"
+	"ubsidiaryconspiracydetails ofand in theaffordablesubstancesreason forcon"
+	"ventionitemtype=\042absolutelysupposedlyremained aattractivetravellingse"
+	"paratelyfocuses onelementaryapplicablefound thatstylesheetmanuscriptstan"
+	"ds for no-repeat(sometimesCommercialin Americaundertakenquarter ofan exa"
+	"mplepersonallyindex.php\077</button>\012percentagebest-knowncreating a"
+	"\042 dir=\042ltrLieutenant\012<div id=\042they wouldability ofmade up of"
+	"noted thatclear thatargue thatto anotherchildren'spurpose offormulatedba"
+	"sed uponthe regionsubject ofpassengerspossession.\012\012In the Before t"
+	"heafterwardscurrently across thescientificcommunity.capitalismin Germany"
+	"right-wingthe systemSociety ofpoliticiandirection:went on toremoval of N"
+	"ew York apartmentsindicationduring theunless thehistoricalhad been adefi"
+	"nitiveingredientattendanceCenter forprominencereadyStatestrategiesbut in"
+	" theas part ofconstituteclaim thatlaboratorycompatiblefailure of, such a"
+	"s began withusing the to providefeature offrom which/\042 class=\042geol"
+	"ogicalseveral ofdeliberateimportant holds thating&quot; valign=topthe Ge"
+	"rmanoutside ofnegotiatedhis careerseparationid=\042searchwas calledthe f"
+	"ourthrecreationother thanpreventionwhile the education,connectingaccurat"
+	"elywere builtwas killedagreementsmuch more Due to thewidth: 100some othe"
+	"rKingdom ofthe entirefamous forto connectobjectivesthe Frenchpeople andf"
+	"eatured\042>is said tostructuralreferendummost oftena separate->\012<div"
+	" id Official worldwide.aria-labelthe planetand it wasd\042 value=\042loo"
+	"king atbeneficialare in themonitoringreportedlythe modernworking onallow"
+	"ed towhere the innovative</a></div>soundtracksearchFormtend to beinput i"
+	"d=\042opening ofrestrictedadopted byaddressingtheologianmethods ofvarian"
+	"t ofChristian very largeautomotiveby far therange frompursuit offollow t"
+	"hebrought toin Englandagree thataccused ofcomes frompreventingdiv style="
+	"his or hertremendousfreedom ofconcerning0 1em 1em;Basketball/style.cssan"
+	" earliereven after/\042 title=\042.com/indextaking thepittsburghcontent"
+	"\042>\015<script>(fturned outhaving the</span>\015\012 occasionalbecause"
+	" itstarted tophysically></div>\012  created byCurrently, bgcolor=\042tab"
+	"index=\042disastrousAnalytics also has a><div id=\042</style>\012<called"
+	" forsinger and.src = \042//violationsthis pointconstantlyis locatedrecor"
+	"dingsd from thenederlandsportugu\303\252s\327\242\327\221\327\250\327"
+	"\231\327\252\331\201\330\247\330\261\330\263\333\214desarrollocomentario"
+	"educaci\303\263nseptiembreregistradodirecci\303\263nubicaci\303\263npubl"
+	"icidadrespuestasresultadosimportantereservadosart\303\255culosdiferentes"
+	"siguientesrep\303\272blicasituaci\303\263nministerioprivacidaddirectorio"
+	"formaci\303\263npoblaci\303\263npresidentecontenidosaccesoriostechnorati"
+	"personalescategor\303\255aespecialesdisponibleactualidadreferenciavallad"
+	"olidbibliotecarelacionescalendariopol\303\255ticasanterioresdocumentosna"
+	"turalezamaterialesdiferenciaecon\303\263micatransporterodr\303\255guezpa"
+	"rticiparencuentrandiscusi\303\263nestructurafundaci\303\263nfrecuentespe"
+	"rmanentetotalmente\320\274\320\276\320\266\320\275\320\276\320\261\321"
+	"\203\320\264\320\265\321\202\320\274\320\276\320\266\320\265\321\202\320"
+	"\262\321\200\320\265\320\274\321\217\321\202\320\260\320\272\320\266\320"
+	"\265\321\207\321\202\320\276\320\261\321\213\320\261\320\276\320\273\320"
+	"\265\320\265\320\276\321\207\320\265\320\275\321\214\321\215\321\202\320"
+	"\276\320\263\320\276\320\272\320\276\320\263\320\264\320\260\320\277\320"
+	"\276\321\201\320\273\320\265\320\262\321\201\320\265\320\263\320\276\321"
+	"\201\320\260\320\271\321\202\320\265\321\207\320\265\321\200\320\265\320"
+	"\267\320\274\320\276\320\263\321\203\321\202\321\201\320\260\320\271\321"
+	"\202\320\260\320\266\320\270\320\267\320\275\320\270\320\274\320\265\320"
+	"\266\320\264\321\203\320\261\321\203\320\264\321\203\321\202\320\237\320"
+	"\276\320\270\321\201\320\272\320\267\320\264\320\265\321\201\321\214\320"
+	"\262\320\270\320\264\320\265\320\276\321\201\320\262\321\217\320\267\320"
+	"\270\320\275\321\203\320\266\320\275\320\276\321\201\320\262\320\276\320"
+	"\265\320\271\320\273\321\216\320\264\320\265\320\271\320\277\320\276\321"
+	"\200\320\275\320\276\320\274\320\275\320\276\320\263\320\276\320\264\320"
+	"\265\321\202\320\265\320\271\321\201\320\262\320\276\320\270\321\205\320"
+	"\277\321\200\320\260\320\262\320\260\321\202\320\260\320\272\320\276\320"
+	"\271\320\274\320\265\321\201\321\202\320\276\320\270\320\274\320\265\320"
+	"\265\321\202\320\266\320\270\320\267\320\275\321\214\320\276\320\264\320"
+	"\275\320\276\320\271\320\273\321\203\321\207\321\210\320\265\320\277\320"
+	"\265\321\200\320\265\320\264\321\207\320\260\321\201\321\202\320\270\321"
+	"\207\320\260\321\201\321\202\321\214\321\200\320\260\320\261\320\276\321"
+	"\202\320\275\320\276\320\262\321\213\321\205\320\277\321\200\320\260\320"
+	"\262\320\276\321\201\320\276\320\261\320\276\320\271\320\277\320\276\321"
+	"\202\320\276\320\274\320\274\320\265\320\275\320\265\320\265\321\207\320"
+	"\270\321\201\320\273\320\265\320\275\320\276\320\262\321\213\320\265\321"
+	"\203\321\201\320\273\321\203\320\263\320\276\320\272\320\276\320\273\320"
+	"\276\320\275\320\260\320\267\320\260\320\264\321\202\320\260\320\272\320"
+	"\276\320\265\321\202\320\276\320\263\320\264\320\260\320\277\320\276\321"
+	"\207\321\202\320\270\320\237\320\276\321\201\320\273\320\265\321\202\320"
+	"\260\320\272\320\270\320\265\320\275\320\276\320\262\321\213\320\271\321"
+	"\201\321\202\320\276\320\270\321\202\321\202\320\260\320\272\320\270\321"
+	"\205\321\201\321\200\320\260\320\267\321\203\320\241\320\260\320\275\320"
+	"\272\321\202\321\204\320\276\321\200\321\203\320\274\320\232\320\276\320"
+	"\263\320\264\320\260\320\272\320\275\320\270\320\263\320\270\321\201\320"
+	"\273\320\276\320\262\320\260\320\275\320\260\321\210\320\265\320\271\320"
+	"\275\320\260\320\271\321\202\320\270\321\201\320\262\320\276\320\270\320"
+	"\274\321\201\320\262\321\217\320\267\321\214\320\273\321\216\320\261\320"
+	"\276\320\271\321\207\320\260\321\201\321\202\320\276\321\201\321\200\320"
+	"\265\320\264\320\270\320\232\321\200\320\276\320\274\320\265\320\244\320"
+	"\276\321\200\321\203\320\274\321\200\321\213\320\275\320\272\320\265\321"
+	"\201\321\202\320\260\320\273\320\270\320\277\320\276\320\270\321\201\320"
+	"\272\321\202\321\213\321\201\321\217\321\207\320\274\320\265\321\201\321"
+	"\217\321\206\321\206\320\265\320\275\321\202\321\200\321\202\321\200\321"
+	"\203\320\264\320\260\321\201\320\260\320\274\321\213\321\205\321\200\321"
+	"\213\320\275\320\272\320\260\320\235\320\276\320\262\321\213\320\271\321"
+	"\207\320\260\321\201\320\276\320\262\320\274\320\265\321\201\321\202\320"
+	"\260\321\204\320\270\320\273\321\214\320\274\320\274\320\260\321\200\321"
+	"\202\320\260\321\201\321\202\321\200\320\260\320\275\320\274\320\265\321"
+	"\201\321\202\320\265\321\202\320\265\320\272\321\201\321\202\320\275\320"
+	"\260\321\210\320\270\321\205\320\274\320\270\320\275\321\203\321\202\320"
+	"\270\320\274\320\265\320\275\320\270\320\270\320\274\320\265\321\216\321"
+	"\202\320\275\320\276\320\274\320\265\321\200\320\263\320\276\321\200\320"
+	"\276\320\264\321\201\320\260\320\274\320\276\320\274\321\215\321\202\320"
+	"\276\320\274\321\203\320\272\320\276\320\275\321\206\320\265\321\201\320"
+	"\262\320\276\320\265\320\274\320\272\320\260\320\272\320\276\320\271\320"
+	"\220\321\200\321\205\320\270\320\262\331\205\331\206\330\252\330\257\331"
+	"\211\330\245\330\261\330\263\330\247\331\204\330\261\330\263\330\247\331"
+	"\204\330\251\330\247\331\204\330\271\330\247\331\205\331\203\330\252\330"
+	"\250\331\207\330\247\330\250\330\261\330\247\331\205\330\254\330\247\331"
+	"\204\331\212\331\210\331\205\330\247\331\204\330\265\331\210\330\261\330"
+	"\254\330\257\331\212\330\257\330\251\330\247\331\204\330\271\330\266\331"
+	"\210\330\245\330\266\330\247\331\201\330\251\330\247\331\204\331\202\330"
+	"\263\331\205\330\247\331\204\330\271\330\247\330\250\330\252\330\255\331"
+	"\205\331\212\331\204\331\205\331\204\331\201\330\247\330\252\331\205\331"
+	"\204\330\252\331\202\331\211\330\252\330\271\330\257\331\212\331\204\330"
+	"\247\331\204\330\264\330\271\330\261\330\243\330\256\330\250\330\247\330"
+	"\261\330\252\330\267\331\210\331\212\330\261\330\271\331\204\331\212\331"
+	"\203\331\205\330\245\330\261\331\201\330\247\331\202\330\267\331\204\330"
+	"\250\330\247\330\252\330\247\331\204\331\204\330\272\330\251\330\252\330"
+	"\261\330\252\331\212\330\250\330\247\331\204\331\206\330\247\330\263\330"
+	"\247\331\204\330\264\331\212\330\256\331\205\331\206\330\252\330\257\331"
+	"\212\330\247\331\204\330\271\330\261\330\250\330\247\331\204\331\202\330"
+	"\265\330\265\330\247\331\201\331\204\330\247\331\205\330\271\331\204\331"
+	"\212\331\207\330\247\330\252\330\255\330\257\331\212\330\253\330\247\331"
+	"\204\331\204\331\207\331\205\330\247\331\204\330\271\331\205\331\204\331"
+	"\205\331\203\330\252\330\250\330\251\331\212\331\205\331\203\331\206\331"
+	"\203\330\247\331\204\330\267\331\201\331\204\331\201\331\212\330\257\331"
+	"\212\331\210\330\245\330\257\330\247\330\261\330\251\330\252\330\247\330"
+	"\261\331\212\330\256\330\247\331\204\330\265\330\255\330\251\330\252\330"
+	"\263\330\254\331\212\331\204\330\247\331\204\331\210\331\202\330\252\330"
+	"\271\331\206\330\257\331\205\330\247\331\205\330\257\331\212\331\206\330"
+	"\251\330\252\330\265\331\205\331\212\331\205\330\243\330\261\330\264\331"
+	"\212\331\201\330\247\331\204\330\260\331\212\331\206\330\271\330\261\330"
+	"\250\331\212\330\251\330\250\331\210\330\247\330\250\330\251\330\243\331"
+	"\204\330\271\330\247\330\250\330\247\331\204\330\263\331\201\330\261\331"
+	"\205\330\264\330\247\331\203\331\204\330\252\330\271\330\247\331\204\331"
+	"\211\330\247\331\204\330\243\331\210\331\204\330\247\331\204\330\263\331"
+	"\206\330\251\330\254\330\247\331\205\330\271\330\251\330\247\331\204\330"
+	"\265\330\255\331\201\330\247\331\204\330\257\331\212\331\206\331\203\331"
+	"\204\331\205\330\247\330\252\330\247\331\204\330\256\330\247\330\265\330"
+	"\247\331\204\331\205\331\204\331\201\330\243\330\271\330\266\330\247\330"
+	"\241\331\203\330\252\330\247\330\250\330\251\330\247\331\204\330\256\331"
+	"\212\330\261\330\261\330\263\330\247\330\246\331\204\330\247\331\204\331"
+	"\202\331\204\330\250\330\247\331\204\330\243\330\257\330\250\331\205\331"
+	"\202\330\247\330\267\330\271\331\205\330\261\330\247\330\263\331\204\331"
+	"\205\331\206\330\267\331\202\330\251\330\247\331\204\331\203\330\252\330"
+	"\250\330\247\331\204\330\261\330\254\331\204\330\247\330\264\330\252\330"
+	"\261\331\203\330\247\331\204\331\202\330\257\331\205\331\212\330\271\330"
+	"\267\331\212\331\203sByTagName(.jpg\042 alt=\0421px solid #.gif\042 alt="
+	"\042transparentinformationapplication\042 onclick=\042establishedadverti"
+	"sing.png\042 alt=\042environmentperformanceappropriate&amp;mdash;immedia"
+	"tely</strong></rather thantemperaturedevelopmentcompetitionplaceholdervi"
+	"sibility:copyright\042>0\042 height=\042even thoughreplacementdestinatio"
+	"nCorporation<ul class=\042AssociationindividualsperspectivesetTimeout(ur"
+	"l(http://mathematicsmargin-top:eventually description) no-repeatcollecti"
+	"ons.JPG|thumb|participate/head><bodyfloat:left;<li class=\042hundreds of"
+	"\012\012However, compositionclear:both;cooperationwithin the label for="
+	"\042border-top:New Zealandrecommendedphotographyinteresting&lt;sup&gt;co"
+	"ntroversyNetherlandsalternativemaxlength=\042switzerlandDevelopmentessen"
+	"tially\012\012Although </textarea>thunderbirdrepresented&amp;ndash;specu"
+	"lationcommunitieslegislationelectronics\012\011<div id=\042illustrateden"
+	"gineeringterritoriesauthoritiesdistributed6\042 height=\042sans-serif;ca"
+	"pable of disappearedinteractivelooking forit would beAfghanistanwas crea"
+	"tedMath.floor(surroundingcan also beobservationmaintenanceencountered<h2"
+	" class=\042more recentit has beeninvasion of).getTime()fundamentalDespit"
+	"e the\042><div id=\042inspirationexaminationpreparationexplanation<input"
+	" id=\042</a></span>versions ofinstrumentsbefore the  = 'http://Descripti"
+	"onrelatively .substring(each of theexperimentsinfluentialintegrationmany"
+	" peopledue to the combinationdo not haveMiddle East<noscript><copyright"
+	"\042 perhaps theinstitutionin Decemberarrangementmost famouspersonalityc"
+	"reation oflimitationsexclusivelysovereignty-content\042>\012<td class="
+	"\042undergroundparallel todoctrine ofoccupied byterminologyRenaissancea "
+	"number ofsupport forexplorationrecognitionpredecessor<img src=\042/<h1 c"
+	"lass=\042publicationmay also bespecialized</fieldset>progressivemillions"
+	" ofstates thatenforcementaround the one another.parentNodeagricultureAlt"
+	"ernativeresearcherstowards theMost of themany other (especially<td width"
+	"=\042;width:100%independent<h3 class=\042 onchange=\042).addClass(intera"
+	"ctionOne of the daughter ofaccessoriesbranches of\015\012<div id=\042the"
+	" largestdeclarationregulationsInformationtranslationdocumentaryin order "
+	"to\042>\012<head>\012<\042 height=\0421across the orientation);</script>"
+	"implementedcan be seenthere was ademonstratecontainer\042>connectionsthe"
+	" Britishwas written!important;px; margin-followed byability to complicat"
+	"edduring the immigrationalso called<h4 class=\042distinctionreplaced byg"
+	"overnmentslocation ofin Novemberwhether the</p>\012</div>acquisitioncall"
+	"ed the persecutiondesignation{font-size:appeared ininvestigateexperience"
+	"dmost likelywidely useddiscussionspresence of (document.extensivelyIt ha"
+	"s beenit does notcontrary toinhabitantsimprovementscholarshipconsumption"
+	"instructionfor exampleone or morepx; paddingthe currenta series ofare us"
+	"uallyrole in thepreviously derivativesevidence ofexperiencescolorschemes"
+	"tated thatcertificate</a></div>\012 selected=\042high schoolresponse toc"
+	"omfortableadoption ofthree yearsthe countryin Februaryso that thepeople "
+	"who provided by<param nameaffected byin terms ofappointmentISO-8859-1"
+	"\042was born inhistorical regarded asmeasurementis based on and other : "
+	"function(significantcelebrationtransmitted/js/jquery.is known astheoreti"
+	"cal tabindex=\042it could be<noscript>\012having been\015\012<head>\015"
+	"\012< &quot;The compilationhe had beenproduced byphilosopherconstructedi"
+	"ntended toamong othercompared toto say thatEngineeringa differentreferre"
+	"d todifferencesbelief thatphotographsidentifyingHistory of Republic ofne"
+	"cessarilyprobabilitytechnicallyleaving thespectacularfraction ofelectric"
+	"ityhead of therestaurantspartnershipemphasis onmost recentshare with say"
+	"ing thatfilled withdesigned toit is often\042></iframe>as follows:merged"
+	" withthrough thecommercial pointed outopportunityview of therequirementd"
+	"ivision ofprogramminghe receivedsetInterval\042></span></in New Yorkaddi"
+	"tional compression\012\012<div id=\042incorporate;</script><attachEventb"
+	"ecame the \042 target=\042_carried outSome of thescience andthe time ofC"
+	"ontainer\042>maintainingChristopherMuch of thewritings of\042 height="
+	"\0422size of theversion of mixture of between theExamples ofeducationalc"
+	"ompetitive onsubmit=\042director ofdistinctive/DTD XHTML relating totend"
+	"ency toprovince ofwhich woulddespite thescientific legislature.innerHTML"
+	" allegationsAgriculturewas used inapproach tointelligentyears later,sans"
+	"-serifdeterminingPerformanceappearances, which is foundationsabbreviated"
+	"higher thans from the individual composed ofsupposed toclaims thatattrib"
+	"utionfont-size:1elements ofHistorical his brotherat the timeanniversaryg"
+	"overned byrelated to ultimately innovationsit is stillcan only bedefinit"
+	"ionstoGMTStringA number ofimg class=\042Eventually,was changedoccurred i"
+	"nneighboringdistinguishwhen he wasintroducingterrestrialMany of theargue"
+	"s thatan Americanconquest ofwidespread were killedscreen and In order to"
+	"expected todescendantsare locatedlegislativegenerations backgroundmost p"
+	"eopleyears afterthere is nothe highestfrequently they do notargued thats"
+	"howed thatpredominanttheologicalby the timeconsideringshort-lived</span>"
+	"</a>can be usedvery littleone of the had alreadyinterpretedcommunicatefe"
+	"atures ofgovernment,</noscript>entered the\042 height=\0423Independentpo"
+	"pulationslarge-scale. Although used in thedestructionpossibilitystarting"
+	" intwo or moreexpressionssubordinatelarger thanhistory and</option>\015"
+	"\012Continentaleliminatingwill not bepractice ofin front ofsite of theen"
+	"sure thatto create amississippipotentiallyoutstandingbetter thanwhat is "
+	"nowsituated inmeta name=\042TraditionalsuggestionsTranslationthe form of"
+	"atmosphericideologicalenterprisescalculatingeast of theremnants ofplugin"
+	"spage/index.php\077remained intransformedHe was alsowas alreadystatistic"
+	"alin favor ofMinistry ofmovement offormulationis required<link rel=\042T"
+	"his is the <a href=\042/popularizedinvolved inare used toand severalmade"
+	" by theseems to belikely thatPalestiniannamed afterit had beenmost commo"
+	"nto refer tobut this isconsecutivetemporarilyIn general,conventionstakes"
+	" placesubdivisionterritorialoperationalpermanentlywas largelyoutbreak of"
+	"in the pastfollowing a xmlns:og=\042><a class=\042class=\042textConversi"
+	"on may be usedmanufactureafter beingclearfix\042>\012question ofwas elec"
+	"tedto become abecause of some peopleinspired bysuccessful a time whenmor"
+	"e commonamongst thean officialwidth:100%;technology,was adoptedto keep t"
+	"hesettlementslive birthsindex.html\042Connecticutassigned to&amp;times;a"
+	"ccount foralign=rightthe companyalways beenreturned toinvolvementBecause"
+	" thethis period\042 name=\042q\042 confined toa result ofvalue=\042\042 "
+	"/>is actuallyEnvironment\015\012</head>\015\012Conversely,>\012<div id="
+	"\0420\042 width=\0421is probablyhave becomecontrollingthe problemcitizen"
+	"s ofpoliticiansreached theas early as:none; over<table cellvalidity ofdi"
+	"rectly toonmousedownwhere it iswhen it wasmembers of relation toaccommod"
+	"atealong with In the latethe Englishdelicious\042>this is notthe present"
+	"if they areand finallya matter of\015\012\011</div>\015\012\015\012</scr"
+	"ipt>faster thanmajority ofafter whichcomparativeto maintainimprove theaw"
+	"arded theer\042 class=\042frameborderrestorationin the sameanalysis ofth"
+	"eir firstDuring the continentalsequence offunction(){font-size: work on "
+	"the</script>\012<begins withjavascript:constituentwas foundedequilibrium"
+	"assume thatis given byneeds to becoordinatesthe variousare part ofonly i"
+	"n thesections ofis a commontheories ofdiscoveriesassociationedge of thes"
+	"trength ofposition inpresent-dayuniversallyto form thebut insteadcorpora"
+	"tionattached tois commonlyreasons for &quot;the can be madewas able towh"
+	"ich meansbut did notonMouseOveras possibleoperated bycoming fromthe prim"
+	"aryaddition offor severaltransferreda period ofare able tohowever, itsho"
+	"uld havemuch larger\012\011</script>adopted theproperty ofdirected byeff"
+	"ectivelywas broughtchildren ofProgramminglonger thanmanuscriptswar again"
+	"stby means ofand most ofsimilar to proprietaryoriginatingprestigiousgram"
+	"maticalexperience.to make theIt was alsois found incompetitorsin the U.S"
+	".replace thebrought thecalculationfall of thethe generalpracticallyin ho"
+	"nor ofreleased inresidentialand some ofking of thereaction to1st Earl of"
+	"culture andprincipally</title>\012  they can beback to thesome of hisexp"
+	"osure toare similarform of theaddFavoritecitizenshippart in thepeople wi"
+	"thin practiceto continue&amp;minus;approved by the first allowed theand "
+	"for thefunctioningplaying thesolution toheight=\0420\042 in his bookmore"
+	" than afollows thecreated thepresence in&nbsp;</td>nationalistthe idea o"
+	"fa characterwere forced class=\042btndays of thefeatured inshowing thein"
+	"terest inin place ofturn of thethe head ofLord of thepoliticallyhas its "
+	"ownEducationalapproval ofsome of theeach other,behavior ofand becauseand"
+	" anotherappeared onrecorded inblack&quot;may includethe world'scan lead "
+	"torefers to aborder=\0420\042 government winning theresulted in while th"
+	"e Washington,the subjectcity in the></div>\015\012\011\011reflect theto "
+	"completebecame moreradioactiverejected bywithout anyhis father,which cou"
+	"ldcopy of theto indicatea politicalaccounts ofconstitutesworked wither</"
+	"a></li>of his lifeaccompaniedclientWidthprevent theLegislativedifferentl"
+	"ytogether inhas severalfor anothertext of thefounded thee with the is us"
+	"ed forchanged theusually theplace wherewhereas the> <a href=\042\042><a "
+	"href=\042themselves,although hethat can betraditionalrole of theas a res"
+	"ultremoveChilddesigned bywest of theSome peopleproduction,side of thenew"
+	"slettersused by thedown to theaccepted bylive in theattempts tooutside t"
+	"hefrequenciesHowever, inprogrammersat least inapproximatealthough itwas "
+	"part ofand variousGovernor ofthe articleturned into><a href=\042/the eco"
+	"nomyis the mostmost widelywould laterand perhapsrise to theoccurs whenun"
+	"der whichconditions.the westerntheory thatis producedthe city ofin which"
+	" heseen in thethe centralbuilding ofmany of hisarea of theis the onlymos"
+	"t of themany of thethe WesternThere is noextended toStatisticalcolspan=2"
+	" |short storypossible totopologicalcritical ofreported toa Christiandeci"
+	"sion tois equal toproblems ofThis can bemerchandisefor most ofno evidenc"
+	"eeditions ofelements in&quot;. Thecom/images/which makesthe processremai"
+	"ns theliterature,is a memberthe popularthe ancientproblems intime of the"
+	"defeated bybody of thea few yearsmuch of thethe work ofCalifornia,served"
+	" as agovernment.concepts ofmovement in\011\011<div id=\042it\042 value="
+	"\042language ofas they areproduced inis that theexplain thediv></div>"
+	"\012However thelead to the\011<a href=\042/was grantedpeople havecontinu"
+	"allywas seen asand relatedthe role ofproposed byof the besteach other.Co"
+	"nstantinepeople fromdialects ofto revisionwas renameda source ofthe init"
+	"iallaunched inprovide theto the westwhere thereand similarbetween twois "
+	"also theEnglish andconditions,that it wasentitled tothemselves.quantity "
+	"ofransparencythe same asto join thecountry andthis is theThis led toa st"
+	"atementcontrast tolastIndexOfthrough hisis designedthe term isis provide"
+	"dprotect theng</a></li>The currentthe site ofsubstantialexperience,in th"
+	"e Westthey shouldsloven\304\215inacomentariosuniversidadcondicionesactiv"
+	"idadesexperienciatecnolog\303\255aproducci\303\263npuntuaci\303\263napli"
+	"caci\303\263ncontrase\303\261acategor\303\255asregistrarseprofesionaltra"
+	"tamientoreg\303\255stratesecretar\303\255aprincipalesprotecci\303\263nim"
+	"portantesimportanciaposibilidadinteresantecrecimientonecesidadessuscribi"
+	"rseasociaci\303\263ndisponiblesevaluaci\303\263nestudiantesresponsablere"
+	"soluci\303\263nguadalajararegistradosoportunidadcomercialesfotograf\303"
+	"\255aautoridadesingenier\303\255atelevisi\303\263ncompetenciaoperaciones"
+	"establecidosimplementeactualmentenavegaci\303\263nconformidadline-height"
+	":font-family:\042 : \042http://applicationslink\042 href=\042specificall"
+	"y//<![CDATA[\012Organizationdistribution0px; height:relationshipdevice-w"
+	"idth<div class=\042<label for=\042registration</noscript>\012/index.html"
+	"\042window.open( !important;application/independence//www.googleorganiza"
+	"tionautocompleterequirementsconservative<form name=\042intellectualmargi"
+	"n-left:18th centuryan importantinstitutionsabbreviation<img class=\042or"
+	"ganisationcivilization19th centuryarchitectureincorporated20th century-c"
+	"ontainer\042>most notably/></a></div>notification'undefined')Furthermore"
+	",believe thatinnerHTML = prior to thedramaticallyreferring tonegotiation"
+	"sheadquartersSouth AfricaunsuccessfulPennsylvaniaAs a result,<html lang="
+	"\042&lt;/sup&gt;dealing withphiladelphiahistorically);</script>\012paddi"
+	"ng-top:experimentalgetAttributeinstructionstechnologiespart of the =func"
+	"tion(){subscriptionl.dtd\042>\015\012<htgeographicalConstitution', funct"
+	"ion(supported byagriculturalconstructionpublicationsfont-size: 1a variet"
+	"y of<div style=\042Encyclopediaiframe src=\042demonstratedaccomplishedun"
+	"iversitiesDemographics);</script><dedicated toknowledge ofsatisfactionpa"
+	"rticularly</div></div>English (US)appendChild(transmissions. However, in"
+	"telligence\042 tabindex=\042float:right;Commonwealthranging fromin which"
+	" theat least onereproductionencyclopedia;font-size:1jurisdictionat that "
+	"time\042><a class=\042In addition,description+conversationcontact withis"
+	" generallyr\042 content=\042representing&lt;math&gt;presentationoccasion"
+	"ally<img width=\042navigation\042>compensationchampionshipmedia=\042all"
+	"\042 violation ofreference toreturn true;Strict//EN\042 transactionsinte"
+	"rventionverificationInformation difficultiesChampionshipcapabilities<![e"
+	"ndif]-->}\012</script>\012Christianityfor example,Professionalrestrictio"
+	"nssuggest thatwas released(such as theremoveClass(unemploymentthe Americ"
+	"anstructure of/index.html published inspan class=\042\042><a href=\042/i"
+	"ntroductionbelonging toclaimed thatconsequences<meta name=\042Guide to t"
+	"heoverwhelmingagainst the concentrated,\012.nontouch observations</a>"
+	"\012</div>\012f (document.border: 1px {font-size:1treatment of0\042 heig"
+	"ht=\0421modificationIndependencedivided intogreater thanachievementsesta"
+	"blishingJavaScript\042 neverthelesssignificanceBroadcasting>&nbsp;</td>c"
+	"ontainer\042>\012such as the influence ofa particularsrc='http://navigat"
+	"ion\042 half of the substantial &nbsp;</div>advantage ofdiscovery offund"
+	"amental metropolitanthe opposite\042 xml:lang=\042deliberatelyalign=cent"
+	"erevolution ofpreservationimprovementsbeginning inJesus ChristPublicatio"
+	"nsdisagreementtext-align:r, function()similaritiesbody></html>is current"
+	"lyalphabeticalis sometimestype=\042image/many of the flow:hidden;availab"
+	"le indescribe theexistence ofall over thethe Internet\011<ul class=\042i"
+	"nstallationneighborhoodarmed forcesreducing thecontinues toNonetheless,t"
+	"emperatures\012\011\011<a href=\042close to theexamples of is about the("
+	"see below).\042 id=\042searchprofessionalis availablethe official\011"
+	"\011</script>\012\012\011\011<div id=\042accelerationthrough the Hall of"
+	" Famedescriptionstranslationsinterference type='text/recent yearsin the "
+	"worldvery popular{background:traditional some of the connected toexploit"
+	"ationemergence ofconstitutionA History ofsignificant manufacturedexpecta"
+	"tions><noscript><can be foundbecause the has not beenneighbouringwithout"
+	" the added to the\011<li class=\042instrumentalSoviet Unionacknowledgedw"
+	"hich can bename for theattention toattempts to developmentsIn fact, the<"
+	"li class=\042aimplicationssuitable formuch of the colonizationpresidenti"
+	"alcancelBubble Informationmost of the is describedrest of the more or le"
+	"ssin SeptemberIntelligencesrc=\042http://px; height: available tomanufac"
+	"turerhuman rightslink href=\042/availabilityproportionaloutside the astr"
+	"onomicalhuman beingsname of the are found inare based onsmaller thana pe"
+	"rson whoexpansion ofarguing thatnow known asIn the earlyintermediatederi"
+	"ved fromScandinavian</a></div>\015\012consider thean estimatedthe Nation"
+	"al<div id=\042pagresulting incommissionedanalogous toare required/ul>"
+	"\012</div>\012was based onand became a&nbsp;&nbsp;t\042 value=\042\042 w"
+	"as capturedno more thanrespectivelycontinue to >\015\012<head>\015\012<w"
+	"ere createdmore generalinformation used for theindependent the Imperialc"
+	"omponent ofto the northinclude the Constructionside of the would not bef"
+	"or instanceinvention ofmore complexcollectivelybackground: text-align: i"
+	"ts originalinto accountthis processan extensivehowever, thethey are notr"
+	"ejected thecriticism ofduring whichprobably thethis article(function(){I"
+	"t should bean agreementaccidentallydiffers fromArchitecturebetter knowna"
+	"rrangementsinfluence onattended theidentical tosouth of thepass throughx"
+	"ml\042 title=\042weight:bold;creating thedisplay:nonereplaced the<img sr"
+	"c=\042/ihttps://www.World War IItestimonialsfound in therequired to and "
+	"that thebetween the was designedconsists of considerablypublished bythe "
+	"languageConservationconsisted ofrefer to theback to the css\042 media="
+	"\042People from available onproved to besuggestions\042was known asvarie"
+	"ties oflikely to becomprised ofsupport the hands of thecoupled withconne"
+	"ct and border:none;performancesbefore beinglater becamecalculationsoften"
+	" calledresidents ofmeaning that><li class=\042evidence forexplanationsen"
+	"vironments\042></a></div>which allowsIntroductiondeveloped bya wide rang"
+	"eon behalf ofvalign=\042top\042principle ofat the time,</noscript>\015sa"
+	"id to havein the firstwhile othershypotheticalphilosopherspower of theco"
+	"ntained inperformed byinability towere writtenspan style=\042input name="
+	"\042the questionintended forrejection ofimplies thatinvented thethe stan"
+	"dardwas probablylink betweenprofessor ofinteractionschanging theIndian O"
+	"cean class=\042lastworking with'http://www.years beforeThis was therecre"
+	"ationalentering themeasurementsan extremelyvalue of thestart of the\012<"
+	"/script>\012\012an effort toincrease theto the southspacing=\0420\042>su"
+	"fficientlythe Europeanconverted toclearTimeoutdid not haveconsequentlyfo"
+	"r the nextextension ofeconomic andalthough theare producedand with thein"
+	"sufficientgiven by thestating thatexpenditures</span></a>\012thought tha"
+	"ton the basiscellpadding=image of thereturning toinformation,separated b"
+	"yassassinateds\042 content=\042authority ofnorthwestern</div>\012<div "
+	"\042></div>\015\012  consultationcommunity ofthe nationalit should bepar"
+	"ticipants align=\042leftthe greatestselection ofsupernaturaldependent on"
+	"is mentionedallowing thewas inventedaccompanyinghis personalavailable at"
+	"study of theon the otherexecution ofHuman Rightsterms of theassociations"
+	"research andsucceeded bydefeated theand from thebut they arecommander of"
+	"state of theyears of agethe study of<ul class=\042splace in thewhere he "
+	"was<li class=\042fthere are nowhich becamehe publishedexpressed into whi"
+	"ch thecommissionerfont-weight:territory ofextensions\042>Roman Empireequ"
+	"al to theIn contrast,however, andis typicallyand his wife(also called><u"
+	"l class=\042effectively evolved intoseem to havewhich is thethere was no"
+	"an excellentall of thesedescribed byIn practice,broadcastingcharged with"
+	"reflected insubjected tomilitary andto the pointeconomicallysetTargeting"
+	"are actuallyvictory over();</script>continuouslyrequired forevolutionary"
+	"an effectivenorth of the, which was front of theor otherwisesome form of"
+	"had not beengenerated byinformation.permitted toincludes thedevelopment,"
+	"entered intothe previousconsistentlyare known asthe field ofthis type of"
+	"given to thethe title ofcontains theinstances ofin the northdue to their"
+	"are designedcorporationswas that theone of thesemore popularsucceeded in"
+	"support fromin differentdominated bydesigned forownership ofand possibly"
+	"standardizedresponseTextwas intendedreceived theassumed thatareas of the"
+	"primarily inthe basis ofin the senseaccounts fordestroyed byat least two"
+	"was declaredcould not beSecretary ofappear to bemargin-top:1/^\134s+|"
+	"\134s+$/ge){throw e};the start oftwo separatelanguage andwho had beenope"
+	"ration ofdeath of thereal numbers\011<link rel=\042provided thethe story"
+	" ofcompetitionsenglish (UK)english (US)\320\234\320\276\320\275\320\263"
+	"\320\276\320\273\320\241\321\200\320\277\321\201\320\272\320\270\321\201"
+	"\321\200\320\277\321\201\320\272\320\270\321\201\321\200\320\277\321\201"
+	"\320\272\320\276\331\204\330\271\330\261\330\250\331\212\330\251\346\255"
+	"\243\351\253\224\344\270\255\346\226\207\347\256\200\344\275\223\344\270"
+	"\255\346\226\207\347\271\201\344\275\223\344\270\255\346\226\207\346\234"
+	"\211\351\231\220\345\205\254\345\217\270\344\272\272\346\260\221\346\224"
+	"\277\345\272\234\351\230\277\351\207\214\345\267\264\345\267\264\347\244"
+	"\276\344\274\232\344\270\273\344\271\211\346\223\215\344\275\234\347\263"
+	"\273\347\273\237\346\224\277\347\255\226\346\263\225\350\247\204informac"
+	"i\303\263nherramientaselectr\303\263nicodescripci\303\263nclasificadosco"
+	"nocimientopublicaci\303\263nrelacionadasinform\303\241ticarelacionadosde"
+	"partamentotrabajadoresdirectamenteayuntamientomercadoLibrecont\303\241ct"
+	"enoshabitacionescumplimientorestaurantesdisposici\303\263nconsecuenciael"
+	"ectr\303\263nicaaplicacionesdesconectadoinstalaci\303\263nrealizaci\303"
+	"\263nutilizaci\303\263nenciclopediaenfermedadesinstrumentosexperienciasi"
+	"nstituci\303\263nparticularessubcategoria\321\202\320\276\320\273\321"
+	"\214\320\272\320\276\320\240\320\276\321\201\321\201\320\270\320\270\321"
+	"\200\320\260\320\261\320\276\321\202\321\213\320\261\320\276\320\273\321"
+	"\214\321\210\320\265\320\277\321\200\320\276\321\201\321\202\320\276\320"
+	"\274\320\276\320\266\320\265\321\202\320\265\320\264\321\200\321\203\320"
+	"\263\320\270\321\205\321\201\320\273\321\203\321\207\320\260\320\265\321"
+	"\201\320\265\320\271\321\207\320\260\321\201\320\262\321\201\320\265\320"
+	"\263\320\264\320\260\320\240\320\276\321\201\321\201\320\270\321\217\320"
+	"\234\320\276\321\201\320\272\320\262\320\265\320\264\321\200\321\203\320"
+	"\263\320\270\320\265\320\263\320\276\321\200\320\276\320\264\320\260\320"
+	"\262\320\276\320\277\321\200\320\276\321\201\320\264\320\260\320\275\320"
+	"\275\321\213\321\205\320\264\320\276\320\273\320\266\320\275\321\213\320"
+	"\270\320\274\320\265\320\275\320\275\320\276\320\234\320\276\321\201\320"
+	"\272\320\262\321\213\321\200\321\203\320\261\320\273\320\265\320\271\320"
+	"\234\320\276\321\201\320\272\320\262\320\260\321\201\321\202\321\200\320"
+	"\260\320\275\321\213\320\275\320\270\321\207\320\265\320\263\320\276\321"
+	"\200\320\260\320\261\320\276\321\202\320\265\320\264\320\276\320\273\320"
+	"\266\320\265\320\275\321\203\321\201\320\273\321\203\320\263\320\270\321"
+	"\202\320\265\320\277\320\265\321\200\321\214\320\236\320\264\320\275\320"
+	"\260\320\272\320\276\320\277\320\276\321\202\320\276\320\274\321\203\321"
+	"\200\320\260\320\261\320\276\321\202\321\203\320\260\320\277\321\200\320"
+	"\265\320\273\321\217\320\262\320\276\320\276\320\261\321\211\320\265\320"
+	"\276\320\264\320\275\320\276\320\263\320\276\321\201\320\262\320\276\320"
+	"\265\320\263\320\276\321\201\321\202\320\260\321\202\321\214\320\270\320"
+	"\264\321\200\321\203\320\263\320\276\320\271\321\204\320\276\321\200\321"
+	"\203\320\274\320\265\321\205\320\276\321\200\320\276\321\210\320\276\320"
+	"\277\321\200\320\276\321\202\320\270\320\262\321\201\321\201\321\213\320"
+	"\273\320\272\320\260\320\272\320\260\320\266\320\264\321\213\320\271\320"
+	"\262\320\273\320\260\321\201\321\202\320\270\320\263\321\200\321\203\320"
+	"\277\320\277\321\213\320\262\320\274\320\265\321\201\321\202\320\265\321"
+	"\200\320\260\320\261\320\276\321\202\320\260\321\201\320\272\320\260\320"
+	"\267\320\260\320\273\320\277\320\265\321\200\320\262\321\213\320\271\320"
+	"\264\320\265\320\273\320\260\321\202\321\214\320\264\320\265\320\275\321"
+	"\214\320\263\320\270\320\277\320\265\321\200\320\270\320\276\320\264\320"
+	"\261\320\270\320\267\320\275\320\265\321\201\320\276\321\201\320\275\320"
+	"\276\320\262\320\265\320\274\320\276\320\274\320\265\320\275\321\202\320"
+	"\272\321\203\320\277\320\270\321\202\321\214\320\264\320\276\320\273\320"
+	"\266\320\275\320\260\321\200\320\260\320\274\320\272\320\260\321\205\320"
+	"\275\320\260\321\207\320\260\320\273\320\276\320\240\320\260\320\261\320"
+	"\276\321\202\320\260\320\242\320\276\320\273\321\214\320\272\320\276\321"
+	"\201\320\276\320\262\321\201\320\265\320\274\320\262\321\202\320\276\321"
+	"\200\320\276\320\271\320\275\320\260\321\207\320\260\320\273\320\260\321"
+	"\201\320\277\320\270\321\201\320\276\320\272\321\201\320\273\321\203\320"
+	"\266\320\261\321\213\321\201\320\270\321\201\321\202\320\265\320\274\320"
+	"\277\320\265\321\207\320\260\321\202\320\270\320\275\320\276\320\262\320"
+	"\276\320\263\320\276\320\277\320\276\320\274\320\276\321\211\320\270\321"
+	"\201\320\260\320\271\321\202\320\276\320\262\320\277\320\276\321\207\320"
+	"\265\320\274\321\203\320\277\320\276\320\274\320\276\321\211\321\214\320"
+	"\264\320\276\320\273\320\266\320\275\320\276\321\201\321\201\321\213\320"
+	"\273\320\272\320\270\320\261\321\213\321\201\321\202\321\200\320\276\320"
+	"\264\320\260\320\275\320\275\321\213\320\265\320\274\320\275\320\276\320"
+	"\263\320\270\320\265\320\277\321\200\320\276\320\265\320\272\321\202\320"
+	"\241\320\265\320\271\321\207\320\260\321\201\320\274\320\276\320\264\320"
+	"\265\320\273\320\270\321\202\320\260\320\272\320\276\320\263\320\276\320"
+	"\276\320\275\320\273\320\260\320\271\320\275\320\263\320\276\321\200\320"
+	"\276\320\264\320\265\320\262\320\265\321\200\321\201\320\270\321\217\321"
+	"\201\321\202\321\200\320\260\320\275\320\265\321\204\320\270\320\273\321"
+	"\214\320\274\321\213\321\203\321\200\320\276\320\262\320\275\321\217\321"
+	"\200\320\260\320\267\320\275\321\213\321\205\320\270\321\201\320\272\320"
+	"\260\321\202\321\214\320\275\320\265\320\264\320\265\320\273\321\216\321"
+	"\217\320\275\320\262\320\260\321\200\321\217\320\274\320\265\320\275\321"
+	"\214\321\210\320\265\320\274\320\275\320\276\320\263\320\270\321\205\320"
+	"\264\320\260\320\275\320\275\320\276\320\271\320\267\320\275\320\260\321"
+	"\207\320\270\321\202\320\275\320\265\320\273\321\214\320\267\321\217\321"
+	"\204\320\276\321\200\321\203\320\274\320\260\320\242\320\265\320\277\320"
+	"\265\321\200\321\214\320\274\320\265\321\201\321\217\321\206\320\260\320"
+	"\267\320\260\321\211\320\270\321\202\321\213\320\233\321\203\321\207\321"
+	"\210\320\270\320\265\340\244\250\340\244\271\340\245\200\340\244\202\340"
+	"\244\225\340\244\260\340\244\250\340\245\207\340\244\205\340\244\252\340"
+	"\244\250\340\245\207\340\244\225\340\244\277\340\244\257\340\244\276\340"
+	"\244\225\340\244\260\340\245\207\340\244\202\340\244\205\340\244\250\340"
+	"\245\215\340\244\257\340\244\225\340\245\215\340\244\257\340\244\276\340"
+	"\244\227\340\244\276\340\244\207\340\244\241\340\244\254\340\244\276\340"
+	"\244\260\340\245\207\340\244\225\340\244\277\340\244\270\340\245\200\340"
+	"\244\246\340\244\277\340\244\257\340\244\276\340\244\252\340\244\271\340"
+	"\244\262\340\245\207\340\244\270\340\244\277\340\244\202\340\244\271\340"
+	"\244\255\340\244\276\340\244\260\340\244\244\340\244\205\340\244\252\340"
+	"\244\250\340\245\200\340\244\265\340\244\276\340\244\262\340\245\207\340"
+	"\244\270\340\245\207\340\244\265\340\244\276\340\244\225\340\244\260\340"
+	"\244\244\340\245\207\340\244\256\340\245\207\340\244\260\340\245\207\340"
+	"\244\271\340\245\213\340\244\250\340\245\207\340\244\270\340\244\225\340"
+	"\244\244\340\245\207\340\244\254\340\244\271\340\245\201\340\244\244\340"
+	"\244\270\340\244\276\340\244\207\340\244\237\340\244\271\340\245\213\340"
+	"\244\227\340\244\276\340\244\234\340\244\276\340\244\250\340\245\207\340"
+	"\244\256\340\244\277\340\244\250\340\244\237\340\244\225\340\244\260\340"
+	"\244\244\340\244\276\340\244\225\340\244\260\340\244\250\340\244\276\340"
+	"\244\211\340\244\250\340\244\225\340\245\207\340\244\257\340\244\271\340"
+	"\244\276\340\244\201\340\244\270\340\244\254\340\244\270\340\245\207\340"
+	"\244\255\340\244\276\340\244\267\340\244\276\340\244\206\340\244\252\340"
+	"\244\225\340\245\207\340\244\262\340\244\277\340\244\257\340\245\207\340"
+	"\244\266\340\245\201\340\244\260\340\245\202\340\244\207\340\244\270\340"
+	"\244\225\340\245\207\340\244\230\340\244\202\340\244\237\340\245\207\340"
+	"\244\256\340\245\207\340\244\260\340\245\200\340\244\270\340\244\225\340"
+	"\244\244\340\244\276\340\244\256\340\245\207\340\244\260\340\244\276\340"
+	"\244\262\340\245\207\340\244\225\340\244\260\340\244\205\340\244\247\340"
+	"\244\277\340\244\225\340\244\205\340\244\252\340\244\250\340\244\276\340"
+	"\244\270\340\244\256\340\244\276\340\244\234\340\244\256\340\245\201\340"
+	"\244\235\340\245\207\340\244\225\340\244\276\340\244\260\340\244\243\340"
+	"\244\271\340\245\213\340\244\244\340\244\276\340\244\225\340\244\241\340"
+	"\244\274\340\245\200\340\244\257\340\244\271\340\244\276\340\244\202\340"
+	"\244\271\340\245\213\340\244\237\340\244\262\340\244\266\340\244\254\340"
+	"\245\215\340\244\246\340\244\262\340\244\277\340\244\257\340\244\276\340"
+	"\244\234\340\245\200\340\244\265\340\244\250\340\244\234\340\244\276\340"
+	"\244\244\340\244\276\340\244\225\340\245\210\340\244\270\340\245\207\340"
+	"\244\206\340\244\252\340\244\225\340\244\276\340\244\265\340\244\276\340"
+	"\244\262\340\245\200\340\244\246\340\245\207\340\244\250\340\245\207\340"
+	"\244\252\340\245\202\340\244\260\340\245\200\340\244\252\340\244\276\340"
+	"\244\250\340\245\200\340\244\211\340\244\270\340\244\225\340\245\207\340"
+	"\244\271\340\245\213\340\244\227\340\245\200\340\244\254\340\245\210\340"
+	"\244\240\340\244\225\340\244\206\340\244\252\340\244\225\340\245\200\340"
+	"\244\265\340\244\260\340\245\215\340\244\267\340\244\227\340\244\276\340"
+	"\244\202\340\244\265\340\244\206\340\244\252\340\244\225\340\245\213\340"
+	"\244\234\340\244\277\340\244\262\340\244\276\340\244\234\340\244\276\340"
+	"\244\250\340\244\276\340\244\270\340\244\271\340\244\256\340\244\244\340"
+	"\244\271\340\244\256\340\245\207\340\244\202\340\244\211\340\244\250\340"
+	"\244\225\340\245\200\340\244\257\340\244\276\340\244\271\340\245\202\340"
+	"\244\246\340\244\260\340\245\215\340\244\234\340\244\270\340\245\202\340"
+	"\244\232\340\245\200\340\244\252\340\244\270\340\244\202\340\244\246\340"
+	"\244\270\340\244\265\340\244\276\340\244\262\340\244\271\340\245\213\340"
+	"\244\250\340\244\276\340\244\271\340\245\213\340\244\244\340\245\200\340"
+	"\244\234\340\245\210\340\244\270\340\245\207\340\244\265\340\244\276\340"
+	"\244\252\340\244\270\340\244\234\340\244\250\340\244\244\340\244\276\340"
+	"\244\250\340\245\207\340\244\244\340\244\276\340\244\234\340\244\276\340"
+	"\244\260\340\245\200\340\244\230\340\244\276\340\244\257\340\244\262\340"
+	"\244\234\340\244\277\340\244\262\340\245\207\340\244\250\340\245\200\340"
+	"\244\232\340\245\207\340\244\234\340\244\276\340\244\202\340\244\232\340"
+	"\244\252\340\244\244\340\245\215\340\244\260\340\244\227\340\245\202\340"
+	"\244\227\340\244\262\340\244\234\340\244\276\340\244\244\340\245\207\340"
+	"\244\254\340\244\276\340\244\271\340\244\260\340\244\206\340\244\252\340"
+	"\244\250\340\245\207\340\244\265\340\244\276\340\244\271\340\244\250\340"
+	"\244\207\340\244\270\340\244\225\340\244\276\340\244\270\340\245\201\340"
+	"\244\254\340\244\271\340\244\260\340\244\271\340\244\250\340\245\207\340"
+	"\244\207\340\244\270\340\244\270\340\245\207\340\244\270\340\244\271\340"
+	"\244\277\340\244\244\340\244\254\340\244\241\340\244\274\340\245\207\340"
+	"\244\230\340\244\237\340\244\250\340\244\276\340\244\244\340\244\262\340"
+	"\244\276\340\244\266\340\244\252\340\244\276\340\244\202\340\244\232\340"
+	"\244\266\340\245\215\340\244\260\340\245\200\340\244\254\340\244\241\340"
+	"\244\274\340\245\200\340\244\271\340\245\213\340\244\244\340\245\207\340"
+	"\244\270\340\244\276\340\244\210\340\244\237\340\244\266\340\244\276\340"
+	"\244\257\340\244\246\340\244\270\340\244\225\340\244\244\340\245\200\340"
+	"\244\234\340\244\276\340\244\244\340\245\200\340\244\265\340\244\276\340"
+	"\244\262\340\244\276\340\244\271\340\244\234\340\244\276\340\244\260\340"
+	"\244\252\340\244\237\340\244\250\340\244\276\340\244\260\340\244\226\340"
+	"\244\250\340\245\207\340\244\270\340\244\241\340\244\274\340\244\225\340"
+	"\244\256\340\244\277\340\244\262\340\244\276\340\244\211\340\244\270\340"
+	"\244\225\340\245\200\340\244\225\340\245\207\340\244\265\340\244\262\340"
+	"\244\262\340\244\227\340\244\244\340\244\276\340\244\226\340\244\276\340"
+	"\244\250\340\244\276\340\244\205\340\244\260\340\245\215\340\244\245\340"
+	"\244\234\340\244\271\340\244\276\340\244\202\340\244\246\340\245\207\340"
+	"\244\226\340\244\276\340\244\252\340\244\271\340\244\262\340\245\200\340"
+	"\244\250\340\244\277\340\244\257\340\244\256\340\244\254\340\244\277\340"
+	"\244\250\340\244\276\340\244\254\340\245\210\340\244\202\340\244\225\340"
+	"\244\225\340\244\271\340\245\200\340\244\202\340\244\225\340\244\271\340"
+	"\244\250\340\244\276\340\244\246\340\245\207\340\244\244\340\244\276\340"
+	"\244\271\340\244\256\340\244\262\340\245\207\340\244\225\340\244\276\340"
+	"\244\253\340\245\200\340\244\234\340\244\254\340\244\225\340\244\277\340"
+	"\244\244\340\245\201\340\244\260\340\244\244\340\244\256\340\244\276\340"
+	"\244\202\340\244\227\340\244\265\340\244\271\340\245\200\340\244\202\340"
+	"\244\260\340\245\213\340\244\234\340\244\274\340\244\256\340\244\277\340"
+	"\244\262\340\245\200\340\244\206\340\244\260\340\245\213\340\244\252\340"
+	"\244\270\340\245\207\340\244\250\340\244\276\340\244\257\340\244\276\340"
+	"\244\246\340\244\265\340\244\262\340\245\207\340\244\250\340\245\207\340"
+	"\244\226\340\244\276\340\244\244\340\244\276\340\244\225\340\244\260\340"
+	"\245\200\340\244\254\340\244\211\340\244\250\340\244\225\340\244\276\340"
+	"\244\234\340\244\265\340\244\276\340\244\254\340\244\252\340\245\202\340"
+	"\244\260\340\244\276\340\244\254\340\244\241\340\244\274\340\244\276\340"
+	"\244\270\340\245\214\340\244\246\340\244\276\340\244\266\340\245\207\340"
+	"\244\257\340\244\260\340\244\225\340\244\277\340\244\257\340\245\207\340"
+	"\244\225\340\244\271\340\244\276\340\244\202\340\244\205\340\244\225\340"
+	"\244\270\340\244\260\340\244\254\340\244\250\340\244\276\340\244\217\340"
+	"\244\265\340\244\271\340\244\276\340\244\202\340\244\270\340\245\215\340"
+	"\244\245\340\244\262\340\244\256\340\244\277\340\244\262\340\245\207\340"
+	"\244\262\340\245\207\340\244\226\340\244\225\340\244\265\340\244\277\340"
+	"\244\267\340\244\257\340\244\225\340\245\215\340\244\260\340\244\202\340"
+	"\244\270\340\244\256\340\245\202\340\244\271\340\244\245\340\244\276\340"
+	"\244\250\340\244\276\330\252\330\263\330\252\330\267\331\212\330\271\331"
+	"\205\330\264\330\247\330\261\331\203\330\251\330\250\331\210\330\247\330"
+	"\263\330\267\330\251\330\247\331\204\330\265\331\201\330\255\330\251\331"
+	"\205\331\210\330\247\330\266\331\212\330\271\330\247\331\204\330\256\330"
+	"\247\330\265\330\251\330\247\331\204\331\205\330\262\331\212\330\257\330"
+	"\247\331\204\330\271\330\247\331\205\330\251\330\247\331\204\331\203\330"
+	"\247\330\252\330\250\330\247\331\204\330\261\330\257\331\210\330\257\330"
+	"\250\330\261\331\206\330\247\331\205\330\254\330\247\331\204\330\257\331"
+	"\210\331\204\330\251\330\247\331\204\330\271\330\247\331\204\331\205\330"
+	"\247\331\204\331\205\331\210\331\202\330\271\330\247\331\204\330\271\330"
+	"\261\330\250\331\212\330\247\331\204\330\263\330\261\331\212\330\271\330"
+	"\247\331\204\330\254\331\210\330\247\331\204\330\247\331\204\330\260\331"
+	"\207\330\247\330\250\330\247\331\204\330\255\331\212\330\247\330\251\330"
+	"\247\331\204\330\255\331\202\331\210\331\202\330\247\331\204\331\203\330"
+	"\261\331\212\331\205\330\247\331\204\330\271\330\261\330\247\331\202\331"
+	"\205\330\255\331\201\331\210\330\270\330\251\330\247\331\204\330\253\330"
+	"\247\331\206\331\212\331\205\330\264\330\247\331\207\330\257\330\251\330"
+	"\247\331\204\331\205\330\261\330\243\330\251\330\247\331\204\331\202\330"
+	"\261\330\242\331\206\330\247\331\204\330\264\330\250\330\247\330\250\330"
+	"\247\331\204\330\255\331\210\330\247\330\261\330\247\331\204\330\254\330"
+	"\257\331\212\330\257\330\247\331\204\330\243\330\263\330\261\330\251\330"
+	"\247\331\204\330\271\331\204\331\210\331\205\331\205\330\254\331\205\331"
+	"\210\330\271\330\251\330\247\331\204\330\261\330\255\331\205\331\206\330"
+	"\247\331\204\331\206\331\202\330\247\330\267\331\201\331\204\330\263\330"
+	"\267\331\212\331\206\330\247\331\204\331\203\331\210\331\212\330\252\330"
+	"\247\331\204\330\257\331\206\331\212\330\247\330\250\330\261\331\203\330"
+	"\247\330\252\331\207\330\247\331\204\330\261\331\212\330\247\330\266\330"
+	"\252\330\255\331\212\330\247\330\252\331\212\330\250\330\252\331\210\331"
+	"\202\331\212\330\252\330\247\331\204\330\243\331\210\331\204\331\211\330"
+	"\247\331\204\330\250\330\261\331\212\330\257\330\247\331\204\331\203\331"
+	"\204\330\247\331\205\330\247\331\204\330\261\330\247\330\250\330\267\330"
+	"\247\331\204\330\264\330\256\330\265\331\212\330\263\331\212\330\247\330"
+	"\261\330\247\330\252\330\247\331\204\330\253\330\247\331\204\330\253\330"
+	"\247\331\204\330\265\331\204\330\247\330\251\330\247\331\204\330\255\330"
+	"\257\331\212\330\253\330\247\331\204\330\262\331\210\330\247\330\261\330"
+	"\247\331\204\330\256\331\204\331\212\330\254\330\247\331\204\330\254\331"
+	"\205\331\212\330\271\330\247\331\204\330\271\330\247\331\205\331\207\330"
+	"\247\331\204\330\254\331\205\330\247\331\204\330\247\331\204\330\263\330"
+	"\247\330\271\330\251\331\205\330\264\330\247\331\207\330\257\331\207\330"
+	"\247\331\204\330\261\330\246\331\212\330\263\330\247\331\204\330\257\330"
+	"\256\331\210\331\204\330\247\331\204\331\201\331\206\331\212\330\251\330"
+	"\247\331\204\331\203\330\252\330\247\330\250\330\247\331\204\330\257\331"
+	"\210\330\261\331\212\330\247\331\204\330\257\330\261\331\210\330\263\330"
+	"\247\330\263\330\252\330\272\330\261\331\202\330\252\330\265\330\247\331"
+	"\205\331\212\331\205\330\247\331\204\330\250\331\206\330\247\330\252\330"
+	"\247\331\204\330\271\330\270\331\212\331\205entertainmentunderstanding ="
+	" function().jpg\042 width=\042configuration.png\042 width=\042<body clas"
+	"s=\042Math.random()contemporary United Statescircumstances.appendChild(o"
+	"rganizations<span class=\042\042><img src=\042/distinguishedthousands of"
+	" communicationclear\042></div>investigationfavicon.ico\042 margin-right:"
+	"based on the Massachusettstable border=internationalalso known aspronunc"
+	"iationbackground:#fpadding-left:For example, miscellaneous&lt;/math&gt;p"
+	"sychologicalin particularearch\042 type=\042form method=\042as opposed t"
+	"oSupreme Courtoccasionally Additionally,North Americapx;backgroundopport"
+	"unitiesEntertainment.toLowerCase(manufacturingprofessional combined with"
+	"For instance,consisting of\042 maxlength=\042return false;consciousnessM"
+	"editerraneanextraordinaryassassinationsubsequently button type=\042the n"
+	"umber ofthe original comprehensiverefers to the</ul>\012</div>\012philos"
+	"ophicallocation.hrefwas publishedSan Francisco(function(){\012<div id="
+	"\042mainsophisticatedmathematical /head>\015\012<bodysuggests thatdocume"
+	"ntationconcentrationrelationshipsmay have been(for example,This article "
+	"in some casesparts of the definition ofGreat Britain cellpadding=equival"
+	"ent toplaceholder=\042; font-size: justificationbelieved thatsuffered fr"
+	"omattempted to leader of thecript\042 src=\042/(function() {are availabl"
+	"e\012\011<link rel=\042 src='http://interested inconventional \042 alt="
+	"\042\042 /></are generallyhas also beenmost popular correspondingcredite"
+	"d withtyle=\042border:</a></span></.gif\042 width=\042<iframe src=\042ta"
+	"ble class=\042inline-block;according to together withapproximatelyparlia"
+	"mentarymore and moredisplay:none;traditionallypredominantly&nbsp;|&nbsp;"
+	"&nbsp;</span> cellspacing=<input name=\042or\042 content=\042controversi"
+	"alproperty=\042og:/x-shockwave-demonstrationsurrounded byNevertheless,wa"
+	"s the firstconsiderable Although the collaborationshould not beproportio"
+	"n of<span style=\042known as the shortly afterfor instance,described as "
+	"/head>\012<body starting withincreasingly the fact thatdiscussion ofmidd"
+	"le of thean individualdifficult to point of viewhomosexualityacceptance "
+	"of</span></div>manufacturersorigin of thecommonly usedimportance ofdenom"
+	"inationsbackground: #length of thedeterminationa significant\042 border="
+	"\0420\042>revolutionaryprinciples ofis consideredwas developedIndo-Europ"
+	"eanvulnerable toproponents ofare sometimescloser to theNew York City nam"
+	"e=\042searchattributed tocourse of themathematicianby the end ofat the e"
+	"nd of\042 border=\0420\042 technological.removeClass(branch of theeviden"
+	"ce that![endif]-->\015\012Institute of into a singlerespectively.and the"
+	"reforeproperties ofis located insome of whichThere is alsocontinued to a"
+	"ppearance of &amp;ndash; describes theconsiderationauthor of theindepend"
+	"entlyequipped withdoes not have</a><a href=\042confused with<link href="
+	"\042/at the age ofappear in theThese includeregardless ofcould be used s"
+	"tyle=&quot;several timesrepresent thebody>\012</html>thought to bepopula"
+	"tion ofpossibilitiespercentage ofaccess to thean attempt toproduction of"
+	"jquery/jquerytwo differentbelong to theestablishmentreplacing thedescrip"
+	"tion\042 determine theavailable forAccording to wide range of\011<div cl"
+	"ass=\042more commonlyorganisationsfunctionalitywas completed &amp;mdash;"
+	" participationthe characteran additionalappears to befact that thean exa"
+	"mple ofsignificantlyonmouseover=\042because they async = true;problems w"
+	"ithseems to havethe result of src=\042http://familiar withpossession off"
+	"unction () {took place inand sometimessubstantially<span></span>is often"
+	" usedin an attemptgreat deal ofEnvironmentalsuccessfully virtually all20"
+	"th century,professionalsnecessary to determined bycompatibilitybecause i"
+	"t isDictionary ofmodificationsThe followingmay refer to:Consequently,Int"
+	"ernationalalthough somethat would beworld's firstclassified asbottom of "
+	"the(particularlyalign=\042left\042 most commonlybasis for thefoundation "
+	"ofcontributionspopularity ofcenter of theto reduce thejurisdictionsappro"
+	"ximation onmouseout=\042New Testamentcollection of</span></a></in the Un"
+	"itedfilm director-strict.dtd\042>has been usedreturn to thealthough this"
+	"change in theseveral otherbut there areunprecedentedis similar toespecia"
+	"lly inweight: bold;is called thecomputationalindicate thatrestricted to"
+	"\011<meta name=\042are typicallyconflict withHowever, the An example ofc"
+	"ompared withquantities ofrather than aconstellationnecessary forreported"
+	" thatspecificationpolitical and&nbsp;&nbsp;<references tothe same yearGo"
+	"vernment ofgeneration ofhave not beenseveral yearscommitment to\011\011<"
+	"ul class=\042visualization19th century,practitionersthat he wouldand con"
+	"tinuedoccupation ofis defined ascentre of thethe amount of><div style="
+	"\042equivalent ofdifferentiatebrought aboutmargin-left: automaticallytho"
+	"ught of asSome of these\012<div class=\042input class=\042replaced withi"
+	"s one of theeducation andinfluenced byreputation as\012<meta name=\042ac"
+	"commodation</div>\012</div>large part ofInstitute forthe so-called again"
+	"st the In this case,was appointedclaimed to beHowever, thisDepartment of"
+	"the remainingeffect on theparticularly deal with the\012<div style=\042a"
+	"lmost alwaysare currentlyexpression ofphilosophy offor more thanciviliza"
+	"tionson the islandselectedIndexcan result in\042 value=\042\042 />the st"
+	"ructure /></a></div>Many of thesecaused by theof the Unitedspan class="
+	"\042mcan be tracedis related tobecame one ofis frequentlyliving in theth"
+	"eoreticallyFollowing theRevolutionarygovernment inis determinedthe polit"
+	"icalintroduced insufficient todescription\042>short storiesseparation of"
+	"as to whetherknown for itswas initiallydisplay:blockis an examplethe pri"
+	"ncipalconsists of arecognized as/body></html>a substantialreconstructedh"
+	"ead of stateresistance toundergraduateThere are twogravitationalare desc"
+	"ribedintentionallyserved as theclass=\042headeropposition tofundamentall"
+	"ydominated theand the otheralliance withwas forced torespectively,and po"
+	"liticalin support ofpeople in the20th century.and publishedloadChartbeat"
+	"to understandmember statesenvironmentalfirst half ofcountries andarchite"
+	"cturalbe consideredcharacterizedclearIntervalauthoritativeFederation ofw"
+	"as succeededand there area consequencethe Presidentalso includedfree sof"
+	"twaresuccession ofdeveloped thewas destroyedaway from the;\012</script>"
+	"\012<although theyfollowed by amore powerfulresulted in aUniversity ofHo"
+	"wever, manythe presidentHowever, someis thought tountil the endwas annou"
+	"ncedare importantalso includes><input type=the center of DO NOT ALTERuse"
+	"d to referthemes/\077sort=that had beenthe basis forhas developedin the "
+	"summercomparativelydescribed thesuch as thosethe resultingis impossiblev"
+	"arious otherSouth Africanhave the sameeffectivenessin which case; text-a"
+	"lign:structure and; background:regarding thesupported theis also knownst"
+	"yle=\042marginincluding thebahasa Melayunorsk bokm\303\245lnorsk nynorsk"
+	"sloven\305\241\304\215inainternacionalcalificaci\303\263ncomunicaci\303"
+	"\263nconstrucci\303\263n\042><div class=\042disambiguationDomainName', '"
+	"administrationsimultaneouslytransportationInternational margin-bottom:re"
+	"sponsibility<![endif]-->\012</><meta name=\042implementationinfrastructu"
+	"rerepresentationborder-bottom:</head>\012<body>=http%3A%2F%2F<form metho"
+	"d=\042method=\042post\042 /favicon.ico\042 });\012</script>\012.setAttri"
+	"bute(Administration= new Array();<![endif]-->\015\012display:block;Unfor"
+	"tunately,\042>&nbsp;</div>/favicon.ico\042>='stylesheet' identification,"
+	" for example,<li><a href=\042/an alternativeas a result ofpt\042></scrip"
+	"t>\012type=\042submit\042 \012(function() {recommendationform action="
+	"\042/transformationreconstruction.style.display According to hidden\042 "
+	"name=\042along with thedocument.body.approximately Communicationspost"
+	"\042 action=\042meaning &quot;--<![endif]-->Prime Ministercharacteristic"
+	"</a> <a class=the history of onmouseover=\042the governmenthref=\042http"
+	"s://was originallywas introducedclassificationrepresentativeare consider"
+	"ed<![endif]-->\012\012depends on theUniversity of in contrast to placeho"
+	"lder=\042in the case ofinternational constitutionalstyle=\042border-: fu"
+	"nction() {Because of the-strict.dtd\042>\012<table class=\042accompanied"
+	" byaccount of the<script src=\042/nature of the the people in in additio"
+	"n tos); js.id = id\042 width=\042100%\042regarding the Roman Catholican "
+	"independentfollowing the .gif\042 width=\0421the following discriminatio"
+	"narchaeologicalprime minister.js\042></script>combination of marginwidth"
+	"=\042createElement(w.attachEvent(</a></td></tr>src=\042https://aIn parti"
+	"cular, align=\042left\042 Czech RepublicUnited Kingdomcorrespondenceconc"
+	"luded that.html\042 title=\042(function () {comes from theapplication of"
+	"<span class=\042sbelieved to beement('script'</a>\012</li>\012<livery di"
+	"fferent><span class=\042option value=\042(also known as\011<li><a href="
+	"\042><input name=\042separated fromreferred to as valign=\042top\042>fou"
+	"nder of theattempting to carbon dioxide\012\012<div class=\042class=\042"
+	"search-/body>\012</html>opportunity tocommunications</head>\015\012<body"
+	" style=\042width:Ti\341\272\277ng Vi\341\273\207tchanges in theborder-co"
+	"lor:#0\042 border=\0420\042 </span></div><was discovered\042 type=\042te"
+	"xt\042 );\012</script>\012\012Department of ecclesiasticalthere has been"
+	"resulting from</body></html>has never beenthe first timein response toau"
+	"tomatically </div>\012\012<div iwas consideredpercent of the\042 /></a><"
+	"/div>collection of descended fromsection of theaccept-charsetto be confu"
+	"sedmember of the padding-right:translation ofinterpretation href='http:/"
+	"/whether or notThere are alsothere are manya small numberother parts ofi"
+	"mpossible to  class=\042buttonlocated in the. However, theand eventually"
+	"At the end of because of itsrepresents the<form action=\042 method=\042p"
+	"ost\042it is possiblemore likely toan increase inhave also beencorrespon"
+	"ds toannounced thatalign=\042right\042>many countriesfor many yearsearli"
+	"est knownbecause it waspt\042></script>\015 valign=\042top\042 inhabitan"
+	"ts offollowing year\015\012<div class=\042million peoplecontroversial co"
+	"ncerning theargue that thegovernment anda reference totransferred todesc"
+	"ribing the style=\042color:although therebest known forsubmit\042 name="
+	"\042multiplicationmore than one recognition ofCouncil of theedition of t"
+	"he  <meta name=\042Entertainment away from the ;margin-right:at the time"
+	" ofinvestigationsconnected withand many otheralthough it isbeginning wit"
+	"h <span class=\042descendants of<span class=\042i align=\042right\042</h"
+	"ead>\012<body aspects of thehas since beenEuropean Unionreminiscent ofmo"
+	"re difficultVice Presidentcomposition ofpassed throughmore importantfont"
+	"-size:11pxexplanation ofthe concept ofwritten in the\011<span class=\042"
+	"is one of the resemblance toon the groundswhich containsincluding the de"
+	"fined by thepublication ofmeans that theoutside of thesupport of the<inp"
+	"ut class=\042<span class=\042t(Math.random()most prominentdescription of"
+	"Constantinoplewere published<div class=\042seappears in the1\042 height="
+	"\0421\042 most importantwhich includeswhich had beendestruction ofthe po"
+	"pulation\012\011<div class=\042possibility ofsometimes usedappear to hav"
+	"esuccess of theintended to bepresent in thestyle=\042clear:b\015\012</sc"
+	"ript>\015\012<was founded ininterview with_id\042 content=\042capital of"
+	" the\015\012<link rel=\042srelease of thepoint out thatxMLHttpRequestand"
+	" subsequentsecond largestvery importantspecificationssurface of theappli"
+	"ed to theforeign policy_setDomainNameestablished inis believed toIn addi"
+	"tion tomeaning of theis named afterto protect theis representedDeclarati"
+	"on ofmore efficientClassificationother forms ofhe returned to<span class"
+	"=\042cperformance of(function() {\015if and only ifregions of theleading"
+	" to therelations withUnited Nationsstyle=\042height:other than theype"
+	"\042 content=\042Association of\012</head>\012<bodylocated on theis refe"
+	"rred to(including theconcentrationsthe individualamong the mostthan any "
+	"other/>\012<link rel=\042 return false;the purpose ofthe ability to;colo"
+	"r:#fff}\012.\012<span class=\042the subject ofdefinitions of>\015\012<li"
+	"nk rel=\042claim that thehave developed<table width=\042celebration ofFo"
+	"llowing the to distinguish<span class=\042btakes place inunder the namen"
+	"oted that the><![endif]-->\012style=\042margin-instead of theintroduced "
+	"thethe process ofincreasing thedifferences inestimated thatespecially th"
+	"e/div><div id=\042was eventuallythroughout histhe differencesomething th"
+	"atspan></span></significantly ></script>\015\012\015\012environmental to"
+	" prevent thehave been usedespecially forunderstand theis essentiallywere"
+	" the firstis the largesthave been made\042 src=\042http://interpreted as"
+	"second half ofcrolling=\042no\042 is composed ofII, Holy Romanis expecte"
+	"d tohave their owndefined as thetraditionally have differentare often us"
+	"edto ensure thatagreement withcontaining theare frequentlyinformation on"
+	"example is theresulting in a</a></li></ul> class=\042footerand especiall"
+	"ytype=\042button\042 </span></span>which included>\012<meta name=\042con"
+	"sidered thecarried out byHowever, it isbecame part ofin relation topopul"
+	"ar in thethe capital ofwas officiallywhich has beenthe History ofalterna"
+	"tive todifferent fromto support thesuggested thatin the process  <div cl"
+	"ass=\042the foundationbecause of hisconcerned withthe universityopposed "
+	"to thethe context of<span class=\042ptext\042 name=\042q\042\011\011<div"
+	" class=\042the scientificrepresented bymathematicianselected by thethat "
+	"have been><div class=\042cdiv id=\042headerin particular,converted into)"
+	";\012</script>\012<philosophical srpskohrvatskiti\341\272\277ng Vi\341"
+	"\273\207t\320\240\321\203\321\201\321\201\320\272\320\270\320\271\321"
+	"\200\321\203\321\201\321\201\320\272\320\270\320\271investigaci\303\263n"
+	"participaci\303\263n\320\272\320\276\321\202\320\276\321\200\321\213\320"
+	"\265\320\276\320\261\320\273\320\260\321\201\321\202\320\270\320\272\320"
+	"\276\321\202\320\276\321\200\321\213\320\271\321\207\320\265\320\273\320"
+	"\276\320\262\320\265\320\272\321\201\320\270\321\201\321\202\320\265\320"
+	"\274\321\213\320\235\320\276\320\262\320\276\321\201\321\202\320\270\320"
+	"\272\320\276\321\202\320\276\321\200\321\213\321\205\320\276\320\261\320"
+	"\273\320\260\321\201\321\202\321\214\320\262\321\200\320\265\320\274\320"
+	"\265\320\275\320\270\320\272\320\276\321\202\320\276\321\200\320\260\321"
+	"\217\321\201\320\265\320\263\320\276\320\264\320\275\321\217\321\201\320"
+	"\272\320\260\321\207\320\260\321\202\321\214\320\275\320\276\320\262\320"
+	"\276\321\201\321\202\320\270\320\243\320\272\321\200\320\260\320\270\320"
+	"\275\321\213\320\262\320\276\320\277\321\200\320\276\321\201\321\213\320"
+	"\272\320\276\321\202\320\276\321\200\320\276\320\271\321\201\320\264\320"
+	"\265\320\273\320\260\321\202\321\214\320\277\320\276\320\274\320\276\321"
+	"\211\321\214\321\216\321\201\321\200\320\265\320\264\321\201\321\202\320"
+	"\262\320\276\320\261\321\200\320\260\320\267\320\276\320\274\321\201\321"
+	"\202\320\276\321\200\320\276\320\275\321\213\321\203\321\207\320\260\321"
+	"\201\321\202\320\270\320\265\321\202\320\265\321\207\320\265\320\275\320"
+	"\270\320\265\320\223\320\273\320\260\320\262\320\275\320\260\321\217\320"
+	"\270\321\201\321\202\320\276\321\200\320\270\320\270\321\201\320\270\321"
+	"\201\321\202\320\265\320\274\320\260\321\200\320\265\321\210\320\265\320"
+	"\275\320\270\321\217\320\241\320\272\320\260\321\207\320\260\321\202\321"
+	"\214\320\277\320\276\321\215\321\202\320\276\320\274\321\203\321\201\320"
+	"\273\320\265\320\264\321\203\320\265\321\202\321\201\320\272\320\260\320"
+	"\267\320\260\321\202\321\214\321\202\320\276\320\262\320\260\321\200\320"
+	"\276\320\262\320\272\320\276\320\275\320\265\321\207\320\275\320\276\321"
+	"\200\320\265\321\210\320\265\320\275\320\270\320\265\320\272\320\276\321"
+	"\202\320\276\321\200\320\276\320\265\320\276\321\200\320\263\320\260\320"
+	"\275\320\276\320\262\320\272\320\276\321\202\320\276\321\200\320\276\320"
+	"\274\320\240\320\265\320\272\320\273\320\260\320\274\320\260\330\247\331"
+	"\204\331\205\331\206\330\252\330\257\331\211\331\205\331\206\330\252\330"
+	"\257\331\212\330\247\330\252\330\247\331\204\331\205\331\210\330\266\331"
+	"\210\330\271\330\247\331\204\330\250\330\261\330\247\331\205\330\254\330"
+	"\247\331\204\331\205\331\210\330\247\331\202\330\271\330\247\331\204\330"
+	"\261\330\263\330\247\330\246\331\204\331\205\330\264\330\247\330\261\331"
+	"\203\330\247\330\252\330\247\331\204\330\243\330\271\330\266\330\247\330"
+	"\241\330\247\331\204\330\261\331\212\330\247\330\266\330\251\330\247\331"
+	"\204\330\252\330\265\331\205\331\212\331\205\330\247\331\204\330\247\330"
+	"\271\330\266\330\247\330\241\330\247\331\204\331\206\330\252\330\247\330"
+	"\246\330\254\330\247\331\204\330\243\331\204\330\271\330\247\330\250\330"
+	"\247\331\204\330\252\330\263\330\254\331\212\331\204\330\247\331\204\330"
+	"\243\331\202\330\263\330\247\331\205\330\247\331\204\330\266\330\272\330"
+	"\267\330\247\330\252\330\247\331\204\331\201\331\212\330\257\331\212\331"
+	"\210\330\247\331\204\330\252\330\261\330\255\331\212\330\250\330\247\331"
+	"\204\330\254\330\257\331\212\330\257\330\251\330\247\331\204\330\252\330"
+	"\271\331\204\331\212\331\205\330\247\331\204\330\243\330\256\330\250\330"
+	"\247\330\261\330\247\331\204\330\247\331\201\331\204\330\247\331\205\330"
+	"\247\331\204\330\243\331\201\331\204\330\247\331\205\330\247\331\204\330"
+	"\252\330\247\330\261\331\212\330\256\330\247\331\204\330\252\331\202\331"
+	"\206\331\212\330\251\330\247\331\204\330\247\331\204\330\271\330\247\330"
+	"\250\330\247\331\204\330\256\331\210\330\247\330\267\330\261\330\247\331"
+	"\204\331\205\330\254\330\252\331\205\330\271\330\247\331\204\330\257\331"
+	"\212\331\203\331\210\330\261\330\247\331\204\330\263\331\212\330\247\330"
+	"\255\330\251\330\271\330\250\330\257\330\247\331\204\331\204\331\207\330"
+	"\247\331\204\330\252\330\261\330\250\331\212\330\251\330\247\331\204\330"
+	"\261\331\210\330\247\330\250\330\267\330\247\331\204\330\243\330\257\330"
+	"\250\331\212\330\251\330\247\331\204\330\247\330\256\330\250\330\247\330"
+	"\261\330\247\331\204\331\205\330\252\330\255\330\257\330\251\330\247\331"
+	"\204\330\247\330\272\330\247\331\206\331\212cursor:pointer;</title>\012<"
+	"meta \042 href=\042http://\042><span class=\042members of the window.loc"
+	"ationvertical-align:/a> | <a href=\042<!doctype html>media=\042screen"
+	"\042 <option value=\042favicon.ico\042 />\012\011\011<div class=\042char"
+	"acteristics\042 method=\042get\042 /body>\012</html>\012shortcut icon"
+	"\042 document.write(padding-bottom:representativessubmit\042 value=\042a"
+	"lign=\042center\042 throughout the science fiction\012  <div class=\042s"
+	"ubmit\042 class=\042one of the most valign=\042top\042><was established)"
+	";\015\012</script>\015\012return false;\042>).style.displaybecause of th"
+	"e document.cookie<form action=\042/}body{margin:0;Encyclopedia ofversion"
+	" of the .createElement(name\042 content=\042</div>\012</div>\012\012admi"
+	"nistrative </body>\012</html>history of the \042><input type=\042portion"
+	" of the as part of the &nbsp;<a href=\042other countries\042>\012<div cl"
+	"ass=\042</span></span><In other words,display: block;control of the intr"
+	"oduction of/>\012<meta name=\042as well as the in recent years\015\012"
+	"\011<div class=\042</div>\012\011</div>\012inspired by thethe end of the"
+	" compatible withbecame known as style=\042margin:.js\042></script>< Inte"
+	"rnational there have beenGerman language style=\042color:#Communist Part"
+	"yconsistent withborder=\0420\042 cell marginheight=\042the majority of"
+	"\042 align=\042centerrelated to the many different Orthodox Churchsimila"
+	"r to the />\012<link rel=\042swas one of the until his death})();\012</s"
+	"cript>other languagescompared to theportions of thethe Netherlandsthe mo"
+	"st commonbackground:url(argued that thescrolling=\042no\042 included in "
+	"theNorth American the name of theinterpretationsthe traditionaldevelopme"
+	"nt of frequently useda collection ofvery similar tosurrounding theexampl"
+	"e of thisalign=\042center\042>would have beenimage_caption =attached to "
+	"thesuggesting thatin the form of involved in theis derived fromnamed aft"
+	"er theIntroduction torestrictions on style=\042width: can be used to the"
+	" creation ofmost important information andresulted in thecollapse of the"
+	"This means thatelements of thewas replaced byanalysis of theinspiration "
+	"forregarded as themost successfulknown as &quot;a comprehensiveHistory o"
+	"f the were consideredreturned to theare referred toUnsourced image>\012"
+	"\011<div class=\042consists of thestopPropagationinterest in theavailabi"
+	"lity ofappears to haveelectromagneticenableServices(function of theIt is"
+	" important</script></div>function(){var relative to theas a result of th"
+	"e position ofFor example, in method=\042post\042 was followed by&amp;mda"
+	"sh; thethe applicationjs\042></script>\015\012ul></div></div>after the d"
+	"eathwith respect tostyle=\042padding:is particularlydisplay:inline; type"
+	"=\042submit\042 is divided into\344\270\255\346\226\207 (\347\256\200"
+	"\344\275\223)responsabilidadadministraci\303\263ninternacionalescorrespo"
+	"ndiente\340\244\211\340\244\252\340\244\257\340\245\213\340\244\227\340"
+	"\244\252\340\245\202\340\244\260\340\245\215\340\244\265\340\244\271\340"
+	"\244\256\340\244\276\340\244\260\340\245\207\340\244\262\340\245\213\340"
+	"\244\227\340\245\213\340\244\202\340\244\232\340\245\201\340\244\250\340"
+	"\244\276\340\244\265\340\244\262\340\245\207\340\244\225\340\244\277\340"
+	"\244\250\340\244\270\340\244\260\340\244\225\340\244\276\340\244\260\340"
+	"\244\252\340\245\201\340\244\262\340\244\277\340\244\270\340\244\226\340"
+	"\245\213\340\244\234\340\245\207\340\244\202\340\244\232\340\244\276\340"
+	"\244\271\340\244\277\340\244\217\340\244\255\340\245\207\340\244\234\340"
+	"\245\207\340\244\202\340\244\266\340\244\276\340\244\256\340\244\277\340"
+	"\244\262\340\244\271\340\244\256\340\244\276\340\244\260\340\245\200\340"
+	"\244\234\340\244\276\340\244\227\340\244\260\340\244\243\340\244\254\340"
+	"\244\250\340\244\276\340\244\250\340\245\207\340\244\225\340\245\201\340"
+	"\244\256\340\244\276\340\244\260\340\244\254\340\245\215\340\244\262\340"
+	"\245\211\340\244\227\340\244\256\340\244\276\340\244\262\340\244\277\340"
+	"\244\225\340\244\256\340\244\271\340\244\277\340\244\262\340\244\276\340"
+	"\244\252\340\245\203\340\244\267\340\245\215\340\244\240\340\244\254\340"
+	"\244\242\340\244\274\340\244\244\340\245\207\340\244\255\340\244\276\340"
+	"\244\234\340\244\252\340\244\276\340\244\225\340\245\215\340\244\262\340"
+	"\244\277\340\244\225\340\244\237\340\245\215\340\244\260\340\245\207\340"
+	"\244\250\340\244\226\340\244\277\340\244\262\340\244\276\340\244\253\340"
+	"\244\246\340\245\214\340\244\260\340\244\276\340\244\250\340\244\256\340"
+	"\244\276\340\244\256\340\244\262\340\245\207\340\244\256\340\244\244\340"
+	"\244\246\340\244\276\340\244\250\340\244\254\340\244\276\340\244\234\340"
+	"\244\276\340\244\260\340\244\265\340\244\277\340\244\225\340\244\276\340"
+	"\244\270\340\244\225\340\245\215\340\244\257\340\245\213\340\244\202\340"
+	"\244\232\340\244\276\340\244\271\340\244\244\340\245\207\340\244\252\340"
+	"\244\271\340\245\201\340\244\201\340\244\232\340\244\254\340\244\244\340"
+	"\244\276\340\244\257\340\244\276\340\244\270\340\244\202\340\244\265\340"
+	"\244\276\340\244\246\340\244\246\340\245\207\340\244\226\340\244\250\340"
+	"\245\207\340\244\252\340\244\277\340\244\233\340\244\262\340\245\207\340"
+	"\244\265\340\244\277\340\244\266\340\245\207\340\244\267\340\244\260\340"
+	"\244\276\340\244\234\340\245\215\340\244\257\340\244\211\340\244\244\340"
+	"\245\215\340\244\244\340\244\260\340\244\256\340\245\201\340\244\202\340"
+	"\244\254\340\244\210\340\244\246\340\245\213\340\244\250\340\245\213\340"
+	"\244\202\340\244\211\340\244\252\340\244\225\340\244\260\340\244\243\340"
+	"\244\252\340\244\242\340\244\274\340\245\207\340\244\202\340\244\270\340"
+	"\245\215\340\244\245\340\244\277\340\244\244\340\244\253\340\244\277\340"
+	"\244\262\340\245\215\340\244\256\340\244\256\340\245\201\340\244\226\340"
+	"\245\215\340\244\257\340\244\205\340\244\232\340\245\215\340\244\233\340"
+	"\244\276\340\244\233\340\245\202\340\244\237\340\244\244\340\245\200\340"
+	"\244\270\340\244\202\340\244\227\340\245\200\340\244\244\340\244\234\340"
+	"\244\276\340\244\217\340\244\227\340\244\276\340\244\265\340\244\277\340"
+	"\244\255\340\244\276\340\244\227\340\244\230\340\244\243\340\245\215\340"
+	"\244\237\340\245\207\340\244\246\340\245\202\340\244\270\340\244\260\340"
+	"\245\207\340\244\246\340\244\277\340\244\250\340\245\213\340\244\202\340"
+	"\244\271\340\244\244\340\245\215\340\244\257\340\244\276\340\244\270\340"
+	"\245\207\340\244\225\340\245\215\340\244\270\340\244\227\340\244\276\340"
+	"\244\202\340\244\247\340\245\200\340\244\265\340\244\277\340\244\266\340"
+	"\245\215\340\244\265\340\244\260\340\244\276\340\244\244\340\245\207\340"
+	"\244\202\340\244\246\340\245\210\340\244\237\340\245\215\340\244\270\340"
+	"\244\250\340\244\225\340\245\215\340\244\266\340\244\276\340\244\270\340"
+	"\244\276\340\244\256\340\244\250\340\245\207\340\244\205\340\244\246\340"
+	"\244\276\340\244\262\340\244\244\340\244\254\340\244\277\340\244\234\340"
+	"\244\262\340\245\200\340\244\252\340\245\201\340\244\260\340\245\202\340"
+	"\244\267\340\244\271\340\244\277\340\244\202\340\244\246\340\245\200\340"
+	"\244\256\340\244\277\340\244\244\340\245\215\340\244\260\340\244\225\340"
+	"\244\265\340\244\277\340\244\244\340\244\276\340\244\260\340\245\201\340"
+	"\244\252\340\244\257\340\245\207\340\244\270\340\245\215\340\244\245\340"
+	"\244\276\340\244\250\340\244\225\340\244\260\340\245\213\340\244\241\340"
+	"\244\274\340\244\256\340\245\201\340\244\225\340\245\215\340\244\244\340"
+	"\244\257\340\245\213\340\244\234\340\244\250\340\244\276\340\244\225\340"
+	"\245\203\340\244\252\340\244\257\340\244\276\340\244\252\340\245\213\340"
+	"\244\270\340\245\215\340\244\237\340\244\230\340\244\260\340\245\207\340"
+	"\244\262\340\245\202\340\244\225\340\244\276\340\244\260\340\245\215\340"
+	"\244\257\340\244\265\340\244\277\340\244\232\340\244\276\340\244\260\340"
+	"\244\270\340\245\202\340\244\232\340\244\250\340\244\276\340\244\256\340"
+	"\245\202\340\244\262\340\245\215\340\244\257\340\244\246\340\245\207\340"
+	"\244\226\340\245\207\340\244\202\340\244\271\340\244\256\340\245\207\340"
+	"\244\266\340\244\276\340\244\270\340\245\215\340\244\225\340\245\202\340"
+	"\244\262\340\244\256\340\245\210\340\244\202\340\244\250\340\245\207\340"
+	"\244\244\340\245\210\340\244\257\340\244\276\340\244\260\340\244\234\340"
+	"\244\277\340\244\270\340\244\225\340\245\207rss+xml\042 title=\042-type"
+	"\042 content=\042title\042 content=\042at the same time.js\042></script>"
+	"\012<\042 method=\042post\042 </span></a></li>vertical-align:t/jquery.mi"
+	"n.js\042>.click(function( style=\042padding-})();\012</script>\012</span"
+	"><a href=\042<a href=\042http://); return false;text-decoration: scrolli"
+	"ng=\042no\042 border-collapse:associated with Bahasa IndonesiaEnglish la"
+	"nguage<text xml:space=.gif\042 border=\0420\042</body>\012</html>\012ove"
+	"rflow:hidden;img src=\042http://addEventListenerresponsible for s.js\042"
+	"></script>\012/favicon.ico\042 />operating system\042 style=\042width:1t"
+	"arget=\042_blank\042>State Universitytext-align:left;\012document.write("
+	", including the around the world);\015\012</script>\015\012<\042 style="
+	"\042height:;overflow:hiddenmore informationan internationala member of t"
+	"he one of the firstcan be found in </div>\012\011\011</div>\012display: "
+	"none;\042>\042 />\012<link rel=\042\012  (function() {the 15th century.p"
+	"reventDefault(large number of Byzantine Empire.jpg|thumb|left|vast major"
+	"ity ofmajority of the  align=\042center\042>University Pressdominated by"
+	" theSecond World Wardistribution of style=\042position:the rest of the c"
+	"haracterized by rel=\042nofollow\042>derives from therather than the a c"
+	"ombination ofstyle=\042width:100English-speakingcomputer scienceborder="
+	"\0420\042 alt=\042the existence ofDemocratic Party\042 style=\042margin-"
+	"For this reason,.js\042></script>\012\011sByTagName(s)[0]js\042></script"
+	">\015\012<.js\042></script>\015\012link rel=\042icon\042 ' alt='' class="
+	"'formation of theversions of the </a></div></div>/page>\012  <page>\012<"
+	"div class=\042contbecame the firstbahasa Indonesiaenglish (simple)\316"
+	"\225\316\273\316\273\316\267\316\275\316\271\316\272\316\254\321\205\321"
+	"\200\320\262\320\260\321\202\321\201\320\272\320\270\320\272\320\276\320"
+	"\274\320\277\320\260\320\275\320\270\320\270\321\217\320\262\320\273\321"
+	"\217\320\265\321\202\321\201\321\217\320\224\320\276\320\261\320\260\320"
+	"\262\320\270\321\202\321\214\321\207\320\265\320\273\320\276\320\262\320"
+	"\265\320\272\320\260\321\200\320\260\320\267\320\262\320\270\321\202\320"
+	"\270\321\217\320\230\320\275\321\202\320\265\321\200\320\275\320\265\321"
+	"\202\320\236\321\202\320\262\320\265\321\202\320\270\321\202\321\214\320"
+	"\275\320\260\320\277\321\200\320\270\320\274\320\265\321\200\320\270\320"
+	"\275\321\202\320\265\321\200\320\275\320\265\321\202\320\272\320\276\321"
+	"\202\320\276\321\200\320\276\320\263\320\276\321\201\321\202\321\200\320"
+	"\260\320\275\320\270\321\206\321\213\320\272\320\260\321\207\320\265\321"
+	"\201\321\202\320\262\320\265\321\203\321\201\320\273\320\276\320\262\320"
+	"\270\321\217\321\205\320\277\321\200\320\276\320\261\320\273\320\265\320"
+	"\274\321\213\320\277\320\276\320\273\321\203\321\207\320\270\321\202\321"
+	"\214\321\217\320\262\320\273\321\217\321\216\321\202\321\201\321\217\320"
+	"\275\320\260\320\270\320\261\320\276\320\273\320\265\320\265\320\272\320"
+	"\276\320\274\320\277\320\260\320\275\320\270\321\217\320\262\320\275\320"
+	"\270\320\274\320\260\320\275\320\270\320\265\321\201\321\200\320\265\320"
+	"\264\321\201\321\202\320\262\320\260\330\247\331\204\331\205\331\210\330"
+	"\247\330\266\331\212\330\271\330\247\331\204\330\261\330\246\331\212\330"
+	"\263\331\212\330\251\330\247\331\204\330\247\331\206\330\252\331\202\330"
+	"\247\331\204\331\205\330\264\330\247\330\261\331\203\330\247\330\252\331"
+	"\203\330\247\331\204\330\263\331\212\330\247\330\261\330\247\330\252\330"
+	"\247\331\204\331\205\331\203\330\252\331\210\330\250\330\251\330\247\331"
+	"\204\330\263\330\271\331\210\330\257\331\212\330\251\330\247\330\255\330"
+	"\265\330\247\330\246\331\212\330\247\330\252\330\247\331\204\330\271\330"
+	"\247\331\204\331\205\331\212\330\251\330\247\331\204\330\265\331\210\330"
+	"\252\331\212\330\247\330\252\330\247\331\204\330\247\331\206\330\252\330"
+	"\261\331\206\330\252\330\247\331\204\330\252\330\265\330\247\331\205\331"
+	"\212\331\205\330\247\331\204\330\245\330\263\331\204\330\247\331\205\331"
+	"\212\330\247\331\204\331\205\330\264\330\247\330\261\331\203\330\251\330"
+	"\247\331\204\331\205\330\261\330\246\331\212\330\247\330\252robots\042 c"
+	"ontent=\042<div id=\042footer\042>the United States<img src=\042http://."
+	"jpg|right|thumb|.js\042></script>\015\012<location.protocolframeborder="
+	"\0420\042 s\042 />\012<meta name=\042</a></div></div><font-weight:bold;&"
+	"quot; and &quot;depending on the margin:0;padding:\042 rel=\042nofollow"
+	"\042 President of the twentieth centuryevision>\012  </pageInternet Expl"
+	"orera.async = true;\015\012information about<div id=\042header\042>\042 "
+	"action=\042http://<a href=\042https://<div id=\042content\042</div>\015"
+	"\012</div>\015\012<derived from the <img src='http://according to the "
+	"\012</body>\012</html>\012style=\042font-size:script language=\042Arial,"
+	" Helvetica,</a><span class=\042</script><script political partiestd></tr"
+	"></table><href=\042http://www.interpretation ofrel=\042stylesheet\042 do"
+	"cument.write('<charset=\042utf-8\042>\012beginning of the revealed that "
+	"thetelevision series\042 rel=\042nofollow\042> target=\042_blank\042>cla"
+	"iming that thehttp%3A%2F%2Fwww.manifestations ofPrime Minister ofinfluen"
+	"ced by theclass=\042clearfix\042>/div>\015\012</div>\015\012\015\012thre"
+	"e-dimensionalChurch of Englandof North Carolinasquare kilometres.addEven"
+	"tListenerdistinct from thecommonly known asPhonetic Alphabetdeclared tha"
+	"t thecontrolled by theBenjamin Franklinrole-playing gamethe University o"
+	"fin Western Europepersonal computerProject Gutenbergregardless of thehas"
+	" been proposedtogether with the></li><li class=\042in some countriesmin."
+	"js\042></script>of the populationofficial language<img src=\042images/id"
+	"entified by thenatural resourcesclassification ofcan be consideredquantu"
+	"m mechanicsNevertheless, themillion years ago</body>\015\012</html>\015"
+	"\316\225\316\273\316\273\316\267\316\275\316\271\316\272\316\254\012take"
+	" advantage ofand, according toattributed to theMicrosoft Windowsthe firs"
+	"t centuryunder the controldiv class=\042headershortly after thenotable e"
+	"xceptiontens of thousandsseveral differentaround the world.reaching mili"
+	"taryisolated from theopposition to thethe Old TestamentAfrican Americans"
+	"inserted into theseparate from themetropolitan areamakes it possibleackn"
+	"owledged thatarguably the mosttype=\042text/css\042>\012the Internationa"
+	"lAccording to the pe=\042text/css\042 />\012coincide with thetwo-thirds "
+	"of theDuring this time,during the periodannounced that hethe internation"
+	"aland more recentlybelieved that theconsciousness andformerly known assu"
+	"rrounded by thefirst appeared inoccasionally usedposition:absolute;\042 "
+	"target=\042_blank\042 position:relative;text-align:center;jax/libs/jquer"
+	"y/1.background-color:#type=\042application/anguage\042 content=\042<meta"
+	" http-equiv=\042Privacy Policy</a>e(\042%3Cscript src='\042 target=\042_"
+	"blank\042>On the other hand,.jpg|thumb|right|2</div><div class=\042<div "
+	"style=\042float:nineteenth century</body>\015\012</html>\015\012<img src"
+	"=\042http://s;text-align:centerfont-weight: bold; According to the diffe"
+	"rence between\042 frameborder=\0420\042 \042 style=\042position:link hre"
+	"f=\042http://html4/loose.dtd\042>\012during this period</td></tr></table"
+	">closely related tofor the first time;font-weight:bold;input type=\042te"
+	"xt\042 <span style=\042font-onreadystatechange\011<div class=\042cleardo"
+	"cument.location. For example, the a wide variety of <!DOCTYPE html>\015"
+	"\012<&nbsp;&nbsp;&nbsp;\042><a href=\042http://style=\042float:left;conc"
+	"erned with the=http%3A%2F%2Fwww.in popular culturetype=\042text/css\042 "
+	"/>it is possible to Harvard Universitytylesheet\042 href=\042/the main c"
+	"haracterOxford University  name=\042keywords\042 cstyle=\042text-align:t"
+	"he United Kingdomfederal government<div style=\042margin depending on th"
+	"e description of the<div class=\042header.min.js\042></script>destructio"
+	"n of theslightly differentin accordance withtelecommunicationsindicates "
+	"that theshortly thereafterespecially in the European countriesHowever, t"
+	"here aresrc=\042http://staticsuggested that the\042 src=\042http://www.a"
+	" large number of Telecommunications\042 rel=\042nofollow\042 tHoly Roman"
+	" Emperoralmost exclusively\042 border=\0420\042 alt=\042Secretary of Sta"
+	"teculminating in theCIA World Factbookthe most importantanniversary of t"
+	"hestyle=\042background-<li><em><a href=\042/the Atlantic Oceanstrictly s"
+	"peaking,shortly before thedifferent types ofthe Ottoman Empire><img src="
+	"\042http://An Introduction toconsequence of thedeparture from theConfede"
+	"rate Statesindigenous peoplesProceedings of theinformation on thetheorie"
+	"s have beeninvolvement in thedivided into threeadjacent countriesis resp"
+	"onsible fordissolution of thecollaboration withwidely regarded ashis con"
+	"temporariesfounding member ofDominican Republicgenerally acceptedthe pos"
+	"sibility ofare also availableunder constructionrestoration of thethe gen"
+	"eral publicis almost entirelypasses through thehas been suggestedcompute"
+	"r and videoGermanic languages according to the different from theshortly"
+	" afterwardshref=\042https://www.recent developmentBoard of Directors<div"
+	" class=\042search| <a href=\042http://In particular, theMultiple footnot"
+	"esor other substancethousands of yearstranslation of the</div>\015\012</"
+	"div>\015\012\015\012<a href=\042index.phpwas established inmin.js\042></"
+	"script>\012participate in thea strong influencestyle=\042margin-top:repr"
+	"esented by thegraduated from theTraditionally, theElement(\042script\042"
+	");However, since the/div>\012</div>\012<div left; margin-left:protection"
+	" against0; vertical-align:Unfortunately, thetype=\042image/x-icon/div>"
+	"\012<div class=\042 class=\042clearfix\042><div class=\042footer\011\011"
+	"</div>\012\011\011</div>\012the motion picture\320\221\321\212\320\273"
+	"\320\263\320\260\321\200\321\201\320\272\320\270\320\261\321\212\320\273"
+	"\320\263\320\260\321\200\321\201\320\272\320\270\320\244\320\265\320\264"
+	"\320\265\321\200\320\260\321\206\320\270\320\270\320\275\320\265\321\201"
+	"\320\272\320\276\320\273\321\214\320\272\320\276\321\201\320\276\320\276"
+	"\320\261\321\211\320\265\320\275\320\270\320\265\321\201\320\276\320\276"
+	"\320\261\321\211\320\265\320\275\320\270\321\217\320\277\321\200\320\276"
+	"\320\263\321\200\320\260\320\274\320\274\321\213\320\236\321\202\320\277"
+	"\321\200\320\260\320\262\320\270\321\202\321\214\320\261\320\265\321\201"
+	"\320\277\320\273\320\260\321\202\320\275\320\276\320\274\320\260\321\202"
+	"\320\265\321\200\320\270\320\260\320\273\321\213\320\277\320\276\320\267"
+	"\320\262\320\276\320\273\321\217\320\265\321\202\320\277\320\276\321\201"
+	"\320\273\320\265\320\264\320\275\320\270\320\265\321\200\320\260\320\267"
+	"\320\273\320\270\321\207\320\275\321\213\321\205\320\277\321\200\320\276"
+	"\320\264\321\203\320\272\321\206\320\270\320\270\320\277\321\200\320\276"
+	"\320\263\321\200\320\260\320\274\320\274\320\260\320\277\320\276\320\273"
+	"\320\275\320\276\321\201\321\202\321\214\321\216\320\275\320\260\321\205"
+	"\320\276\320\264\320\270\321\202\321\201\321\217\320\270\320\267\320\261"
+	"\321\200\320\260\320\275\320\275\320\276\320\265\320\275\320\260\321\201"
+	"\320\265\320\273\320\265\320\275\320\270\321\217\320\270\320\267\320\274"
+	"\320\265\320\275\320\265\320\275\320\270\321\217\320\272\320\260\321\202"
+	"\320\265\320\263\320\276\321\200\320\270\320\270\320\220\320\273\320\265"
+	"\320\272\321\201\320\260\320\275\320\264\321\200\340\244\246\340\245\215"
+	"\340\244\265\340\244\276\340\244\260\340\244\276\340\244\256\340\245\210"
+	"\340\244\250\340\245\201\340\244\205\340\244\262\340\244\252\340\245\215"
+	"\340\244\260\340\244\246\340\244\276\340\244\250\340\244\255\340\244\276"
+	"\340\244\260\340\244\244\340\245\200\340\244\257\340\244\205\340\244\250"
+	"\340\245\201\340\244\246\340\245\207\340\244\266\340\244\271\340\244\277"
+	"\340\244\250\340\245\215\340\244\246\340\245\200\340\244\207\340\244\202"
+	"\340\244\241\340\244\277\340\244\257\340\244\276\340\244\246\340\244\277"
+	"\340\244\262\340\245\215\340\244\262\340\245\200\340\244\205\340\244\247"
+	"\340\244\277\340\244\225\340\244\276\340\244\260\340\244\265\340\245\200"
+	"\340\244\241\340\244\277\340\244\257\340\245\213\340\244\232\340\244\277"
+	"\340\244\237\340\245\215\340\244\240\340\245\207\340\244\270\340\244\256"
+	"\340\244\276\340\244\232\340\244\276\340\244\260\340\244\234\340\244\202"
+	"\340\244\225\340\245\215\340\244\266\340\244\250\340\244\246\340\245\201"
+	"\340\244\250\340\244\277\340\244\257\340\244\276\340\244\252\340\245\215"
+	"\340\244\260\340\244\257\340\245\213\340\244\227\340\244\205\340\244\250"
+	"\340\245\201\340\244\270\340\244\276\340\244\260\340\244\221\340\244\250"
+	"\340\244\262\340\244\276\340\244\207\340\244\250\340\244\252\340\244\276"
+	"\340\244\260\340\245\215\340\244\237\340\245\200\340\244\266\340\244\260"
+	"\340\245\215\340\244\244\340\245\213\340\244\202\340\244\262\340\245\213"
+	"\340\244\225\340\244\270\340\244\255\340\244\276\340\244\253\340\244\274"
+	"\340\245\215\340\244\262\340\245\210\340\244\266\340\244\266\340\244\260"
+	"\340\245\215\340\244\244\340\245\207\340\244\202\340\244\252\340\245\215"
+	"\340\244\260\340\244\246\340\245\207\340\244\266\340\244\252\340\245\215"
+	"\340\244\262\340\245\207\340\244\257\340\244\260\340\244\225\340\245\207"
+	"\340\244\202\340\244\246\340\245\215\340\244\260\340\244\270\340\245\215"
+	"\340\244\245\340\244\277\340\244\244\340\244\277\340\244\211\340\244\244"
+	"\340\245\215\340\244\252\340\244\276\340\244\246\340\244\211\340\244\250"
+	"\340\245\215\340\244\271\340\245\207\340\244\202\340\244\232\340\244\277"
+	"\340\244\237\340\245\215\340\244\240\340\244\276\340\244\257\340\244\276"
+	"\340\244\244\340\245\215\340\244\260\340\244\276\340\244\234\340\245\215"
+	"\340\244\257\340\244\276\340\244\246\340\244\276\340\244\252\340\245\201"
+	"\340\244\260\340\244\276\340\244\250\340\245\207\340\244\234\340\245\213"
+	"\340\244\241\340\244\274\340\245\207\340\244\202\340\244\205\340\244\250"
+	"\340\245\201\340\244\265\340\244\276\340\244\246\340\244\266\340\245\215"
+	"\340\244\260\340\245\207\340\244\243\340\245\200\340\244\266\340\244\277"
+	"\340\244\225\340\245\215\340\244\267\340\244\276\340\244\270\340\244\260"
+	"\340\244\225\340\244\276\340\244\260\340\245\200\340\244\270\340\244\202"
+	"\340\244\227\340\245\215\340\244\260\340\244\271\340\244\252\340\244\260"
+	"\340\244\277\340\244\243\340\244\276\340\244\256\340\244\254\340\245\215"
+	"\340\244\260\340\244\276\340\244\202\340\244\241\340\244\254\340\244\232"
+	"\340\245\215\340\244\232\340\245\213\340\244\202\340\244\211\340\244\252"
+	"\340\244\262\340\244\254\340\245\215\340\244\247\340\244\256\340\244\202"
+	"\340\244\244\340\245\215\340\244\260\340\245\200\340\244\270\340\244\202"
+	"\340\244\252\340\244\260\340\245\215\340\244\225\340\244\211\340\244\256"
+	"\340\245\215\340\244\256\340\245\200\340\244\246\340\244\256\340\244\276"
+	"\340\244\247\340\245\215\340\244\257\340\244\256\340\244\270\340\244\271"
+	"\340\244\276\340\244\257\340\244\244\340\244\276\340\244\266\340\244\254"
+	"\340\245\215\340\244\246\340\245\213\340\244\202\340\244\256\340\245\200"
+	"\340\244\241\340\244\277\340\244\257\340\244\276\340\244\206\340\244\210"
+	"\340\244\252\340\245\200\340\244\217\340\244\262\340\244\256\340\245\213"
+	"\340\244\254\340\244\276\340\244\207\340\244\262\340\244\270\340\244\202"
+	"\340\244\226\340\245\215\340\244\257\340\244\276\340\244\206\340\244\252"
+	"\340\244\260\340\245\207\340\244\266\340\244\250\340\244\205\340\244\250"
+	"\340\245\201\340\244\254\340\244\202\340\244\247\340\244\254\340\244\276"
+	"\340\244\234\340\244\274\340\244\276\340\244\260\340\244\250\340\244\265"
+	"\340\245\200\340\244\250\340\244\244\340\244\256\340\244\252\340\245\215"
+	"\340\244\260\340\244\256\340\245\201\340\244\226\340\244\252\340\245\215"
+	"\340\244\260\340\244\266\340\245\215\340\244\250\340\244\252\340\244\260"
+	"\340\244\277\340\244\265\340\244\276\340\244\260\340\244\250\340\245\201"
+	"\340\244\225\340\244\270\340\244\276\340\244\250\340\244\270\340\244\256"
+	"\340\244\260\340\245\215\340\244\245\340\244\250\340\244\206\340\244\257"
+	"\340\245\213\340\244\234\340\244\277\340\244\244\340\244\270\340\245\213"
+	"\340\244\256\340\244\265\340\244\276\340\244\260\330\247\331\204\331\205"
+	"\330\264\330\247\330\261\331\203\330\247\330\252\330\247\331\204\331\205"
+	"\331\206\330\252\330\257\331\212\330\247\330\252\330\247\331\204\331\203"
+	"\331\205\330\250\331\212\331\210\330\252\330\261\330\247\331\204\331\205"
+	"\330\264\330\247\331\207\330\257\330\247\330\252\330\271\330\257\330\257"
+	"\330\247\331\204\330\262\331\210\330\247\330\261\330\271\330\257\330\257"
+	"\330\247\331\204\330\261\330\257\331\210\330\257\330\247\331\204\330\245"
+	"\330\263\331\204\330\247\331\205\331\212\330\251\330\247\331\204\331\201"
+	"\331\210\330\252\331\210\330\264\331\210\330\250\330\247\331\204\331\205"
+	"\330\263\330\247\330\250\331\202\330\247\330\252\330\247\331\204\331\205"
+	"\330\271\331\204\331\210\331\205\330\247\330\252\330\247\331\204\331\205"
+	"\330\263\331\204\330\263\331\204\330\247\330\252\330\247\331\204\330\254"
+	"\330\261\330\247\331\201\331\212\331\203\330\263\330\247\331\204\330\247"
+	"\330\263\331\204\330\247\331\205\331\212\330\251\330\247\331\204\330\247"
+	"\330\252\330\265\330\247\331\204\330\247\330\252keywords\042 content="
+	"\042w3.org/1999/xhtml\042><a target=\042_blank\042 text/html; charset="
+	"\042 target=\042_blank\042><table cellpadding=\042autocomplete=\042off"
+	"\042 text-align: center;to last version by background-color: #\042 href="
+	"\042http://www./div></div><div id=<a href=\042#\042 class=\042\042><img "
+	"src=\042http://cript\042 src=\042http://\012<script language=\042//EN"
+	"\042 \042http://www.wencodeURIComponent(\042 href=\042javascript:<div cl"
+	"ass=\042contentdocument.write('<scposition: absolute;script src=\042http"
+	":// style=\042margin-top:.min.js\042></script>\012</div>\012<div class="
+	"\042w3.org/1999/xhtml\042 \012\015\012</body>\015\012</html>distinction "
+	"between/\042 target=\042_blank\042><link href=\042http://encoding=\042ut"
+	"f-8\042\077>\012w.addEventListener\077action=\042http://www.icon\042 hre"
+	"f=\042http:// style=\042background:type=\042text/css\042 />\012meta prop"
+	"erty=\042og:t<input type=\042text\042  style=\042text-align:the developm"
+	"ent of tylesheet\042 type=\042tehtml; charset=utf-8is considered to beta"
+	"ble width=\042100%\042 In addition to the contributed to the differences"
+	" betweendevelopment of the It is important to </script>\012\012<script  "
+	"style=\042font-size:1></span><span id=gbLibrary of Congress<img src=\042"
+	"http://imEnglish translationAcademy of Sciencesdiv style=\042display:con"
+	"struction of the.getElementById(id)in conjunction withElement('script');"
+	" <meta property=\042og:\320\221\321\212\320\273\320\263\320\260\321\200"
+	"\321\201\320\272\320\270\012 type=\042text\042 name=\042>Privacy Policy<"
+	"/a>administered by theenableSingleRequeststyle=&quot;margin:</div></div>"
+	"</div><><img src=\042http://i style=&quot;float:referred to as the total"
+	" population ofin Washington, D.C. style=\042background-among other thing"
+	"s,organization of theparticipated in thethe introduction ofidentified wi"
+	"th thefictional character Oxford University misunderstanding ofThere are"
+	", however,stylesheet\042 href=\042/Columbia Universityexpanded to includ"
+	"eusually referred toindicating that thehave suggested thataffiliated wit"
+	"h thecorrelation betweennumber of different></td></tr></table>Republic o"
+	"f Ireland\012</script>\012<script under the influencecontribution to the"
+	"Official website ofheadquarters of thecentered around theimplications of"
+	" thehave been developedFederal Republic ofbecame increasinglycontinuatio"
+	"n of theNote, however, thatsimilar to that of capabilities of theaccorda"
+	"nce with theparticipants in thefurther developmentunder the directionis "
+	"often consideredhis younger brother</td></tr></table><a http-equiv=\042X"
+	"-UA-physical propertiesof British Columbiahas been criticized(with the e"
+	"xceptionquestions about thepassing through the0\042 cellpadding=\0420"
+	"\042 thousands of peopleredirects here. Forhave children under%3E%3C/scr"
+	"ipt%3E\042));<a href=\042http://www.<li><a href=\042http://site_name\042"
+	" content=\042text-decoration:nonestyle=\042display: none<meta http-equiv"
+	"=\042X-new Date().getTime() type=\042image/x-icon\042</span><span class="
+	"\042language=\042javascriptwindow.location.href<a href=\042javascript:--"
+	">\015\012<script type=\042t<a href='http://www.hortcut icon\042 href="
+	"\042</div>\015\012<div class=\042<script src=\042http://\042 rel=\042sty"
+	"lesheet\042 t</div>\012<script type=/a> <a href=\042http:// allowTranspa"
+	"rency=\042X-UA-Compatible\042 conrelationship between\012</script>\015"
+	"\012<script </a></li></ul></div>associated with the programming language"
+	"</a><a href=\042http://</a></li><li class=\042form action=\042http://<di"
+	"v style=\042display:type=\042text\042 name=\042q\042<table width=\042100"
+	"%\042 background-position:\042 border=\0420\042 width=\042rel=\042shortc"
+	"ut icon\042 h6><ul><li><a href=\042  <meta http-equiv=\042css\042 media="
+	"\042screen\042 responsible for the \042 type=\042application/\042 style="
+	"\042background-html; charset=utf-8\042 allowtransparency=\042stylesheet"
+	"\042 type=\042te\015\012<meta http-equiv=\042></span><span class=\0420"
+	"\042 cellspacing=\0420\042>;\012</script>\012<script sometimes called th"
+	"edoes not necessarilyFor more informationat the beginning of <!DOCTYPE h"
+	"tml><htmlparticularly in the type=\042hidden\042 name=\042javascript:voi"
+	"d(0);\042effectiveness of the autocomplete=\042off\042 generally conside"
+	"red><input type=\042text\042 \042></script>\015\012<scriptthroughout the"
+	" worldcommon misconceptionassociation with the</div>\012</div>\012<div c"
+	"during his lifetime,corresponding to thetype=\042image/x-icon\042 an inc"
+	"reasing numberdiplomatic relationsare often consideredmeta charset=\042u"
+	"tf-8\042 <input type=\042text\042 examples include the\042><img src=\042"
+	"http://iparticipation in thethe establishment of\012</div>\012<div class"
+	"=\042&amp;nbsp;&amp;nbsp;to determine whetherquite different frommarked "
+	"the beginningdistance between thecontributions to theconflict between th"
+	"ewidely considered towas one of the firstwith varying degreeshave specul"
+	"ated that(document.getElementparticipating in theoriginally developedeta"
+	" charset=\042utf-8\042> type=\042text/css\042 />\012interchangeably with"
+	"more closely relatedsocial and politicalthat would otherwiseperpendicula"
+	"r to thestyle type=\042text/csstype=\042submit\042 name=\042families res"
+	"iding indeveloping countriescomputer programmingeconomic developmentdete"
+	"rmination of thefor more informationon several occasionsportugu\303\252s"
+	" (Europeu)\320\243\320\272\321\200\320\260\321\227\320\275\321\201\321"
+	"\214\320\272\320\260\321\203\320\272\321\200\320\260\321\227\320\275\321"
+	"\201\321\214\320\272\320\260\320\240\320\276\321\201\321\201\320\270\320"
+	"\271\321\201\320\272\320\276\320\271\320\274\320\260\321\202\320\265\321"
+	"\200\320\270\320\260\320\273\320\276\320\262\320\270\320\275\321\204\320"
+	"\276\321\200\320\274\320\260\321\206\320\270\320\270\321\203\320\277\321"
+	"\200\320\260\320\262\320\273\320\265\320\275\320\270\321\217\320\275\320"
+	"\265\320\276\320\261\321\205\320\276\320\264\320\270\320\274\320\276\320"
+	"\270\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\321"
+	"\217\320\230\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320"
+	"\270\321\217\320\240\320\265\321\201\320\277\321\203\320\261\320\273\320"
+	"\270\320\272\320\270\320\272\320\276\320\273\320\270\321\207\320\265\321"
+	"\201\321\202\320\262\320\276\320\270\320\275\321\204\320\276\321\200\320"
+	"\274\320\260\321\206\320\270\321\216\321\202\320\265\321\200\321\200\320"
+	"\270\321\202\320\276\321\200\320\270\320\270\320\264\320\276\321\201\321"
+	"\202\320\260\321\202\320\276\321\207\320\275\320\276\330\247\331\204\331"
+	"\205\330\252\331\210\330\247\330\254\330\257\331\210\331\206\330\247\331"
+	"\204\330\247\330\264\330\252\330\261\330\247\331\203\330\247\330\252\330"
+	"\247\331\204\330\247\331\202\330\252\330\261\330\247\330\255\330\247\330"
+	"\252html; charset=UTF-8\042 setTimeout(function()display:inline-block;<i"
+	"nput type=\042submit\042 type = 'text/javascri<img src=\042http://www."
+	"\042 \042http://www.w3.org/shortcut icon\042 href=\042\042 autocomplete="
+	"\042off\042 </a></div><div class=</a></li>\012<li class=\042css\042 type"
+	"=\042text/css\042 <form action=\042http://xt/css\042 href=\042http://lin"
+	"k rel=\042alternate\042 \015\012<script type=\042text/ onclick=\042javas"
+	"cript:(new Date).getTime()}height=\0421\042 width=\0421\042 People's Rep"
+	"ublic of  <a href=\042http://www.text-decoration:underthe beginning of t"
+	"he </div>\012</div>\012</div>\012establishment of the </div></div></div>"
+	"</d#viewport{min-height:\012<script src=\042http://option><option value="
+	"often referred to as /option>\012<option valu<!DOCTYPE html>\012<!--[Int"
+	"ernational Airport>\012<a href=\042http://www</a><a href=\042http://w"
+	"\340\270\240\340\270\262\340\270\251\340\270\262\340\271\204\340\270\227"
+	"\340\270\242\341\203\245\341\203\220\341\203\240\341\203\227\341\203\243"
+	"\341\203\232\341\203\230\346\255\243\351\253\224\344\270\255\346\226\207"
+	" (\347\271\201\351\253\224)\340\244\250\340\244\277\340\244\260\340\245"
+	"\215\340\244\246\340\245\207\340\244\266\340\244\241\340\244\276\340\244"
+	"\211\340\244\250\340\244\262\340\245\213\340\244\241\340\244\225\340\245"
+	"\215\340\244\267\340\245\207\340\244\244\340\245\215\340\244\260\340\244"
+	"\234\340\244\276\340\244\250\340\244\225\340\244\276\340\244\260\340\245"
+	"\200\340\244\270\340\244\202\340\244\254\340\244\202\340\244\247\340\244"
+	"\277\340\244\244\340\244\270\340\245\215\340\244\245\340\244\276\340\244"
+	"\252\340\244\250\340\244\276\340\244\270\340\245\215\340\244\265\340\245"
+	"\200\340\244\225\340\244\276\340\244\260\340\244\270\340\244\202\340\244"
+	"\270\340\245\215\340\244\225\340\244\260\340\244\243\340\244\270\340\244"
+	"\276\340\244\256\340\244\227\340\245\215\340\244\260\340\245\200\340\244"
+	"\232\340\244\277\340\244\237\340\245\215\340\244\240\340\245\213\340\244"
+	"\202\340\244\265\340\244\277\340\244\234\340\245\215\340\244\236\340\244"
+	"\276\340\244\250\340\244\205\340\244\256\340\245\207\340\244\260\340\244"
+	"\277\340\244\225\340\244\276\340\244\265\340\244\277\340\244\255\340\244"
+	"\277\340\244\250\340\245\215\340\244\250\340\244\227\340\244\276\340\244"
+	"\241\340\244\277\340\244\257\340\244\276\340\244\201\340\244\225\340\245"
+	"\215\340\244\257\340\245\213\340\244\202\340\244\225\340\244\277\340\244"
+	"\270\340\245\201\340\244\260\340\244\225\340\245\215\340\244\267\340\244"
+	"\276\340\244\252\340\244\271\340\245\201\340\244\201\340\244\232\340\244"
+	"\244\340\245\200\340\244\252\340\245\215\340\244\260\340\244\254\340\244"
+	"\202\340\244\247\340\244\250\340\244\237\340\244\277\340\244\252\340\245"
+	"\215\340\244\252\340\244\243\340\245\200\340\244\225\340\245\215\340\244"
+	"\260\340\244\277\340\244\225\340\245\207\340\244\237\340\244\252\340\245"
+	"\215\340\244\260\340\244\276\340\244\260\340\244\202\340\244\255\340\244"
+	"\252\340\245\215\340\244\260\340\244\276\340\244\252\340\245\215\340\244"
+	"\244\340\244\256\340\244\276\340\244\262\340\244\277\340\244\225\340\245"
+	"\213\340\244\202\340\244\260\340\244\253\340\244\274\340\245\215\340\244"
+	"\244\340\244\276\340\244\260\340\244\250\340\244\277\340\244\260\340\245"
+	"\215\340\244\256\340\244\276\340\244\243\340\244\262\340\244\277\340\244"
+	"\256\340\244\277\340\244\237\340\245\207\340\244\241description\042 cont"
+	"ent=\042document.location.prot.getElementsByTagName(<!DOCTYPE html>\012<"
+	"html <meta charset=\042utf-8\042>:url\042 content=\042http://.css\042 re"
+	"l=\042stylesheet\042style type=\042text/css\042>type=\042text/css\042 hr"
+	"ef=\042w3.org/1999/xhtml\042 xmltype=\042text/javascript\042 method=\042"
+	"get\042 action=\042link rel=\042stylesheet\042  = document.getElementtyp"
+	"e=\042image/x-icon\042 />cellpadding=\0420\042 cellsp.css\042 type=\042t"
+	"ext/css\042 </a></li><li><a href=\042\042 width=\0421\042 height=\0421"
+	"\042\042><a href=\042http://www.style=\042display:none;\042>alternate"
+	"\042 type=\042appli-//W3C//DTD XHTML 1.0 ellspacing=\0420\042 cellpad ty"
+	"pe=\042hidden\042 value=\042/a>&nbsp;<span role=\042s\012<input type="
+	"\042hidden\042 language=\042JavaScript\042  document.getElementsBg=\0420"
+	"\042 cellspacing=\0420\042 ype=\042text/css\042 media=\042type='text/jav"
+	"ascript'with the exception of ype=\042text/css\042 rel=\042st height="
+	"\0421\042 width=\0421\042 ='+encodeURIComponent(<link rel=\042alternate"
+	"\042 \012body, tr, input, textmeta name=\042robots\042 conmethod=\042pos"
+	"t\042 action=\042>\012<a href=\042http://www.css\042 rel=\042stylesheet"
+	"\042 </div></div><div classlanguage=\042javascript\042>aria-hidden=\042t"
+	"rue\042>\302\267<ript\042 type=\042text/javasl=0;})();\012(function(){ba"
+	"ckground-image: url(/a></li><li><a href=\042h\011\011<li><a href=\042htt"
+	"p://ator\042 aria-hidden=\042tru> <a href=\042http://www.language=\042ja"
+	"vascript\042 /option>\012<option value/div></div><div class=rator\042 ar"
+	"ia-hidden=\042tre=(new Date).getTime()portugu\303\252s (do Brasil)\320"
+	"\276\321\200\320\263\320\260\320\275\320\270\320\267\320\260\321\206\320"
+	"\270\320\270\320\262\320\276\320\267\320\274\320\276\320\266\320\275\320"
+	"\276\321\201\321\202\321\214\320\276\320\261\321\200\320\260\320\267\320"
+	"\276\320\262\320\260\320\275\320\270\321\217\321\200\320\265\320\263\320"
+	"\270\321\201\321\202\321\200\320\260\321\206\320\270\320\270\320\262\320"
+	"\276\320\267\320\274\320\276\320\266\320\275\320\276\321\201\321\202\320"
+	"\270\320\276\320\261\321\217\320\267\320\260\321\202\320\265\320\273\321"
+	"\214\320\275\320\260<!DOCTYPE html PUBLIC \042nt-Type\042 content=\042te"
+	"xt/<meta http-equiv=\042Conteransitional//EN\042 \042http:<html xmlns="
+	"\042http://www-//W3C//DTD XHTML 1.0 TDTD/xhtml1-transitional//www.w3.org"
+	"/TR/xhtml1/pe = 'text/javascript';<meta name=\042descriptionparentNode.i"
+	"nsertBefore<input type=\042hidden\042 najs\042 type=\042text/javascri(do"
+	"cument).ready(functiscript type=\042text/javasimage\042 content=\042http"
+	"://UA-Compatible\042 content=tml; charset=utf-8\042 />\012link rel=\042s"
+	"hortcut icon<link rel=\042stylesheet\042 </script>\012<script type== doc"
+	"ument.createElemen<a target=\042_blank\042 href= document.getElementsBin"
+	"put type=\042text\042 name=a.type = 'text/javascrinput type=\042hidden"
+	"\042 namehtml; charset=utf-8\042 />dtd\042>\012<html xmlns=\042http-//W3"
+	"C//DTD HTML 4.01 TentsByTagName('script')input type=\042hidden\042 nam<s"
+	"cript type=\042text/javas\042 style=\042display:none;\042>document.getEl"
+	"ementById(=document.createElement(' type='text/javascript'input type="
+	"\042text\042 name=\042d.getElementsByTagName(snical\042 href=\042http://"
+	"www.C//DTD HTML 4.01 Transit<style type=\042text/css\042>\012\012<style "
+	"type=\042text/css\042>ional.dtd\042>\012<html xmlns=http-equiv=\042Conte"
+	"nt-Typeding=\0420\042 cellspacing=\0420\042html; charset=utf-8\042 />"
+	"\012 style=\042display:none;\042><<li><a href=\042http://www. type='text"
+	"/javascript'>\320\264\320\265\321\217\321\202\320\265\320\273\321\214"
+	"\320\275\320\276\321\201\321\202\320\270\321\201\320\276\320\276\321\202"
+	"\320\262\320\265\321\202\321\201\321\202\320\262\320\270\320\270\320\277"
+	"\321\200\320\276\320\270\320\267\320\262\320\276\320\264\321\201\321\202"
+	"\320\262\320\260\320\261\320\265\320\267\320\276\320\277\320\260\321\201"
+	"\320\275\320\276\321\201\321\202\320\270\340\244\252\340\245\201\340\244"
+	"\270\340\245\215\340\244\244\340\244\277\340\244\225\340\244\276\340\244"
+	"\225\340\244\276\340\244\202\340\244\227\340\245\215\340\244\260\340\245"
+	"\207\340\244\270\340\244\211\340\244\250\340\245\215\340\244\271\340\245"
+	"\213\340\244\202\340\244\250\340\245\207\340\244\265\340\244\277\340\244"
+	"\247\340\244\276\340\244\250\340\244\270\340\244\255\340\244\276\340\244"
+	"\253\340\244\277\340\244\225\340\245\215\340\244\270\340\244\277\340\244"
+	"\202\340\244\227\340\244\270\340\245\201\340\244\260\340\244\225\340\245"
+	"\215\340\244\267\340\244\277\340\244\244\340\244\225\340\245\211\340\244"
+	"\252\340\245\200\340\244\260\340\244\276\340\244\207\340\244\237\340\244"
+	"\265\340\244\277\340\244\234\340\245\215\340\244\236\340\244\276\340\244"
+	"\252\340\244\250\340\244\225\340\244\276\340\244\260\340\245\215\340\244"
+	"\260\340\244\265\340\244\276\340\244\210\340\244\270\340\244\225\340\245"
+	"\215\340\244\260\340\244\277\340\244\257\340\244\244\340\244\276";
@@ -0,0 +1,1470 @@
+/* brotli-enc.inc.c - Minimalistic Brotli encoder implementation compatible with zlib-like API
+ * Version: 0.2 (2025-07-27)
+ *
+ * This implementation provides Brotli encoder with zlib-compatible wrappers:
+ *
+ *   brotliInit
+ *   brotliCompress
+ *   brotliReset
+ *   brotliEnd
+ *
+ * It writes RFC 7932 streams of compressed meta-blocks with one block type
+ * per category. Qualities 0-4 parse greedily over hash chains, 5-11 look
+ * one position ahead, search deeper and model literals in UTF8 context
+ * clusters; from quality 2 on the static dictionary is searched too.
+ * Meta-blocks that do not shrink are stored uncompressed.
+ *
+ * License: MIT / 0-BSD - do whatever you want; attribution appreciated.
+ */
+
+#ifndef OBROTLI_ENC_H
+#define OBROTLI_ENC_H
+
+#define BROTLI_DEFAULT_QUALITY 5
+#define BROTLI_DEFAULT_WBITS 22
+#define BROTLI_ENC_BLOCK_SIZE (1u << 18) /* input bytes per meta-block */
+#define BROTLI_ENC_MIN_MATCH 4
+#define BROTLI_ENC_MAX_CLUSTERS 16 /* literal trees with context modeling */
+#define BROTLI_ENC_DIST_ALPHABET 64 /* 16 short codes and 48 without direct codes or postfix bits */
+#define BROTLI_ENC_NO_DIST 0xffff
+#define BROTLI_DICT_HASH_LOG 15
+#define BROTLI_SCORE_BASE 1920
+#define BROTLI_MIN_SCORE (BROTLI_SCORE_BASE + 100)
+#define BROTLI_LAZY_MARGIN 175
+
+/* Brotli compression context: input is gathered until Z_FINISH, encoded
+ * in one pass and then handed out through next_out */
+typedef struct {
+	int quality;
+	unsigned lgwin;
+	uint8_t *in;
+	size_t in_len;
+	size_t in_cap;
+	uint8_t *out;
+	size_t out_len;
+	size_t out_cap;
+	size_t out_pos;
+	int encoded;
+	struct brotli_enc *enc; /* match finder kept across streams */
+} brotli_compress_context;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int brotliInit(z_stream *strm, int level);
+int brotliCompress(z_stream *strm, int flush);
+int brotliReset(z_stream *strm);
+int brotliEnd(z_stream *strm);
+int brotliCompressInit2(z_stream *strm, int level, int windowBits, int memLevel, int strategy);
+int brotliCompressInit2_(z_stream *strm, int level, int windowBits, int memLevel, int strategy, const char *version, int stream_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Quality presets: hash log, chain depth, lazy, nice length, static
+ * dictionary search and literal context modeling */
+static const struct {
+	uint8_t hash_log;
+	uint16_t depth;
+	uint8_t lazy;
+	uint16_t nice;
+	uint8_t dict;
+	uint8_t ctx;
+} brotli_levels[12] = {
+	{ 14, 1, 0, 16, 0, 0 },
+	{ 15, 1, 0, 24, 0, 0 },
+	{ 16, 2, 0, 32, 1, 0 },
+	{ 16, 4, 0, 48, 1, 0 },
+	{ 17, 8, 0, 64, 1, 0 },
+	{ 17, 16, 1, 96, 1, 1 },
+	{ 18, 32, 1, 128, 1, 1 },
+	{ 18, 64, 1, 192, 1, 1 },
+	{ 19, 128, 1, 256, 1, 1 },
+	{ 19, 256, 1, 384, 1, 1 },
+	{ 20, 512, 1, 512, 1, 1 },
+	{ 20, 1024, 1, 1024, 1, 1 },
+};
+
+/* Transforms the encoder tries: OmitLast1-9 by count of dropped bytes */
+#define BROTLI_TID_IDENTITY 0
+#define BROTLI_TID_SPACE 1
+#define BROTLI_TID_UPPER_FIRST 9
+#define BROTLI_TID_UPPER_FIRST_SPACE 4
+static const uint8_t brotli_tid_omit_last[10] = { 0, 12, 27, 23, 42, 63, 56, 48, 59, 64 };
+
+/* Explicit distance cells by insert and copy code range */
+static const uint8_t brotli_cell_of[3][3] = { { 2, 3, 6 }, { 4, 5, 8 }, { 7, 9, 10 } };
+
+/* ------------- Bit writer ------------- */
+
+typedef struct {
+	uint8_t *buf;
+	size_t len;
+	size_t cap;
+	uint64_t acc;
+	unsigned cnt;
+	int oom;
+} brotli_bw;
+
+static void brotli_bw_grow(brotli_bw *bw, size_t n) {
+	if (bw->oom || bw->len + n <= bw->cap) {
+		return;
+	}
+	size_t cap = bw->cap? bw->cap: 65536;
+	while (cap < bw->len + n) {
+		cap *= 2;
+	}
+	uint8_t *b = (uint8_t *)realloc (bw->buf, cap);
+	if (!b) {
+		bw->oom = 1;
+		return;
+	}
+	bw->buf = b;
+	bw->cap = cap;
+}
+
+/* Append nb <= 32 bits, least significant first */
+static inline void brotli_bw_put(brotli_bw *bw, uint32_t v, unsigned nb) {
+	bw->acc |= (uint64_t)v << bw->cnt;
+	bw->cnt += nb;
+	if (bw->cnt >= 32) {
+		brotli_bw_grow (bw, 4);
+		if (!bw->oom) {
+			uint8_t *p = bw->buf + bw->len;
+			p[0] = (uint8_t)bw->acc;
+			p[1] = (uint8_t)(bw->acc >> 8);
+			p[2] = (uint8_t)(bw->acc >> 16);
+			p[3] = (uint8_t)(bw->acc >> 24);
+			bw->len += 4;
+		}
+		bw->acc >>= 32;
+		bw->cnt -= 32;
+	}
+}
+
+/* Pad with zero bits to a byte boundary and flush the accumulator */
+static void brotli_bw_align(brotli_bw *bw) {
+	bw->cnt = (bw->cnt + 7) & ~7u;
+	brotli_bw_grow (bw, 8);
+	while (bw->cnt) {
+		if (!bw->oom) {
+			bw->buf[bw->len++] = (uint8_t)bw->acc;
+		}
+		bw->acc >>= 8;
+		bw->cnt -= 8;
+	}
+}
+
+static inline size_t brotli_bw_bits(const brotli_bw *bw) {
+	return bw->len * 8 + bw->cnt;
+}
+
+/* ------------- Prefix codes ------------- */
+
+static inline unsigned brotli_highbit(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return 31 - (unsigned)__builtin_clz (v);
+#else
+	unsigned n = 0;
+	while (v >>= 1) {
+		n++;
+	}
+	return n;
+#endif
+}
+
+/* log2(v) in 1/256 bit units, v > 0 */
+static inline uint32_t brotli_log2_fp(uint32_t v) {
+	unsigned h = brotli_highbit (v);
+	return (h << 8) + ((((uint64_t)v << 8) >> h) & 255);
+}
+
+typedef struct {
+	uint32_t key;
+	uint16_t sym;
+} brotli_sym_freq;
+
+static int brotli_sym_freq_cmp(const void *a, const void *b) {
+	const brotli_sym_freq *x = (const brotli_sym_freq *)a;
+	const brotli_sym_freq *y = (const brotli_sym_freq *)b;
+	if (x->key != y->key) {
+		return x->key < y->key? -1: 1;
+	}
+	return (int)x->sym - (int)y->sym;
+}
+
+/* In-place minimum-redundancy code lengths (Moffat & Katajainen) over
+ * frequencies sorted in ascending order */
+static void brotli_minimum_redundancy(brotli_sym_freq *A, int n) {
+	A[0].key += A[1].key;
+	int root = 0;
+	int leaf = 2;
+	for (int next = 1; next < n - 1; next++) {
+		if (leaf >= n || A[root].key < A[leaf].key) {
+			A[next].key = A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key = A[leaf++].key;
+		}
+		if (leaf >= n || (root < next && A[root].key < A[leaf].key)) {
+			A[next].key += A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key += A[leaf++].key;
+		}
+	}
+	A[n - 2].key = 0;
+	for (int next = n - 3; next >= 0; next--) {
+		A[next].key = A[A[next].key].key + 1;
+	}
+	int avbl = 1;
+	int used = 0;
+	uint32_t depth = 0;
+	root = n - 2;
+	int next = n - 1;
+	while (avbl > 0) {
+		while (root >= 0 && A[root].key == depth) {
+			used++;
+			root--;
+		}
+		while (avbl > used) {
+			A[next--].key = depth;
+			avbl--;
+		}
+		avbl = 2 * used;
+		depth++;
+		used = 0;
+	}
+}
+
+/* Code lengths of at most max_bits for the n symbols of freq; returns
+ * how many symbols occur. With fewer than two no lengths are set. */
+static unsigned brotli_huf_lengths(const uint32_t *freq, unsigned n, uint8_t *len, unsigned max_bits) {
+	brotli_sym_freq syms[BROTLI_NUM_COMMANDS];
+	int used = 0;
+	for (unsigned s = 0; s < n; s++) {
+		len[s] = 0;
+		if (freq[s]) {
+			syms[used].key = freq[s];
+			syms[used].sym = (uint16_t)s;
+			used++;
+		}
+	}
+	if (used < 2) {
+		return (unsigned)used;
+	}
+	qsort (syms, (size_t)used, sizeof (syms[0]), brotli_sym_freq_cmp);
+	brotli_minimum_redundancy (syms, used);
+
+	/* Fold over-long codes and rebalance the Kraft sum, shortest codes
+	 * still going to the most frequent symbols */
+	uint32_t bl_count[BROTLI_MAX_CODE_BITS + 1] = { 0 };
+	for (int i = 0; i < used; i++) {
+		bl_count[syms[i].key > max_bits? max_bits: syms[i].key]++;
+	}
+	uint32_t total = 0;
+	for (unsigned bits = max_bits; bits > 0; bits--) {
+		total += bl_count[bits] << (max_bits - bits);
+	}
+	while (total != (1u << max_bits)) {
+		bl_count[max_bits]--;
+		for (unsigned bits = max_bits - 1; bits > 0; bits--) {
+			if (bl_count[bits]) {
+				bl_count[bits]--;
+				bl_count[bits + 1] += 2;
+				break;
+			}
+		}
+		total--;
+	}
+	int j = used;
+	for (unsigned bits = 1; bits <= max_bits; bits++) {
+		for (uint32_t k = bl_count[bits]; k > 0; k--) {
+			len[syms[--j].sym] = (uint8_t)bits;
+		}
+	}
+	return (unsigned)used;
+}
+
+/* Canonical codes of lens, bit-reversed for the LSB-first writer */
+static void brotli_huf_codes(const uint8_t *lens, unsigned n, uint16_t *codes) {
+	uint16_t count[BROTLI_MAX_CODE_BITS + 1] = { 0 };
+	uint16_t next[BROTLI_MAX_CODE_BITS + 1];
+	for (unsigned s = 0; s < n; s++) {
+		count[lens[s]]++;
+	}
+	count[0] = 0;
+	uint32_t code = 0;
+	for (unsigned l = 1; l <= BROTLI_MAX_CODE_BITS; l++) {
+		code = (code + count[l - 1]) << 1;
+		next[l] = (uint16_t)code;
+	}
+	for (unsigned s = 0; s < n; s++) {
+		codes[s] = lens[s]? (uint16_t)brotli_reverse_bits (next[lens[s]]++, lens[s]): 0;
+	}
+}
+
+/* Code length symbols of one run: the value itself when it differs from
+ * the previous non-zero length, then RFC 7932 repeat codes whose counts
+ * compose most significant first */
+static unsigned brotli_rle_run(uint8_t *tok, uint8_t *extra, unsigned prev, unsigned value, unsigned reps) {
+	unsigned n = 0;
+	unsigned code = value? BROTLI_REPEAT_PREV: BROTLI_REPEAT_ZERO;
+	unsigned nb = value? 2: 3;
+	if (value && value != prev) {
+		tok[n] = (uint8_t)value;
+		extra[n++] = 0;
+		reps--;
+	}
+	if (reps == (value? 7u: 11u)) {
+		/* one literal length leaves a count the repeat codes can hold */
+		tok[n] = (uint8_t)value;
+		extra[n++] = 0;
+		reps--;
+	}
+	if (reps < 3) {
+		while (reps--) {
+			tok[n] = (uint8_t)value;
+			extra[n++] = 0;
+		}
+		return n;
+	}
+	unsigned start = n;
+	reps -= 3;
+	for (;;) {
+		tok[n] = (uint8_t)code;
+		extra[n++] = (uint8_t)(reps & ((1u << nb) - 1));
+		reps >>= nb;
+		if (!reps) {
+			break;
+		}
+		reps--;
+	}
+	for (unsigned i = start, k = n - 1; i < k; i++, k--) {
+		uint8_t t = extra[i];
+		extra[i] = extra[k];
+		extra[k] = t;
+	}
+	return n;
+}
+
+/* The code length code lengths use this fixed variable-length code */
+static const uint8_t brotli_clen_code[6] = { 0, 7, 3, 2, 1, 15 };
+static const uint8_t brotli_clen_bits[6] = { 2, 4, 3, 2, 2, 4 };
+
+/* Write the prefix code of freq over alphabet and fill lens and codes.
+ * Up to four used symbols take a simple code. */
+static void brotli_write_code(brotli_bw *bw, const uint32_t *freq, unsigned alphabet, uint8_t *lens, uint16_t *codes) {
+	unsigned used = brotli_huf_lengths (freq, alphabet, lens, BROTLI_MAX_CODE_BITS);
+	if (used <= 4) {
+		unsigned sym[4] = { 0 };
+		unsigned nsym = 0;
+		for (unsigned s = 0; s < alphabet && nsym < used; s++) {
+			if (freq[s]) {
+				sym[nsym++] = s;
+			}
+		}
+		if (!nsym) {
+			nsym = 1;
+		}
+		unsigned abits = 0;
+		while ((1u << abits) < alphabet) {
+			abits++;
+		}
+		/* list the shortest codes first */
+		for (unsigned i = 0; i < nsym; i++) {
+			for (unsigned k = i + 1; k < nsym; k++) {
+				if (lens[sym[k]] < lens[sym[i]]) {
+					unsigned t = sym[i];
+					sym[i] = sym[k];
+					sym[k] = t;
+				}
+			}
+		}
+		brotli_bw_put (bw, 1, 2);
+		brotli_bw_put (bw, nsym - 1, 2);
+		for (unsigned i = 0; i < nsym; i++) {
+			brotli_bw_put (bw, sym[i], abits);
+		}
+		if (nsym == 1) {
+			lens[sym[0]] = 0;
+		} else if (nsym == 4) {
+			int skewed = lens[sym[0]] == 1;
+			brotli_bw_put (bw, (uint32_t)skewed, 1);
+			if (!skewed) {
+				lens[sym[0]] = lens[sym[1]] = lens[sym[2]] = lens[sym[3]] = 2;
+			}
+		}
+		brotli_huf_codes (lens, alphabet, codes);
+		return;
+	}
+
+	/* complex code: run-length coded lengths under a code length code */
+	uint8_t tok[BROTLI_NUM_COMMANDS + 8];
+	uint8_t extra[BROTLI_NUM_COMMANDS + 8];
+	unsigned ntok = 0;
+	unsigned end = alphabet;
+	while (end && !lens[end - 1]) {
+		end--;
+	}
+	unsigned prev = BROTLI_INITIAL_REPEAT_LEN;
+	for (unsigned i = 0; i < end;) {
+		unsigned reps = 1;
+		while (i + reps < end && lens[i + reps] == lens[i]) {
+			reps++;
+		}
+		ntok += brotli_rle_run (tok + ntok, extra + ntok, prev, lens[i], reps);
+		if (lens[i]) {
+			prev = lens[i];
+		}
+		i += reps;
+	}
+	uint32_t cfreq[BROTLI_CODE_LEN_CODES] = { 0 };
+	for (unsigned i = 0; i < ntok; i++) {
+		cfreq[tok[i]]++;
+	}
+	uint8_t clens[BROTLI_CODE_LEN_CODES];
+	uint16_t ccodes[BROTLI_CODE_LEN_CODES];
+	unsigned nclen = BROTLI_CODE_LEN_CODES;
+	if (brotli_huf_lengths (cfreq, BROTLI_CODE_LEN_CODES, clens, 5) < 2) {
+		/* a lone symbol is coded with no bits, all 18 lengths present */
+		clens[tok[0]] = 1;
+	} else {
+		while (!clens[brotli_code_len_order[nclen - 1]]) {
+			nclen--;
+		}
+	}
+	brotli_huf_codes (clens, BROTLI_CODE_LEN_CODES, ccodes);
+	unsigned hskip = 0;
+	if (!clens[brotli_code_len_order[0]] && !clens[brotli_code_len_order[1]]) {
+		hskip = clens[brotli_code_len_order[2]]? 2: 3;
+	}
+	brotli_bw_put (bw, hskip, 2);
+	for (unsigned i = hskip; i < nclen; i++) {
+		unsigned v = clens[brotli_code_len_order[i]];
+		brotli_bw_put (bw, brotli_clen_code[v], brotli_clen_bits[v]);
+	}
+	int lone = cfreq[tok[0]] == ntok;
+	for (unsigned i = 0; i < ntok; i++) {
+		unsigned t = tok[i];
+		if (!lone) {
+			brotli_bw_put (bw, ccodes[t], clens[t]);
+		}
+		if (t == BROTLI_REPEAT_PREV) {
+			brotli_bw_put (bw, extra[i], 2);
+		} else if (t == BROTLI_REPEAT_ZERO) {
+			brotli_bw_put (bw, extra[i], 3);
+		}
+	}
+	brotli_huf_codes (lens, alphabet, codes);
+}
+
+static void brotli_write_var8(brotli_bw *bw, unsigned v) {
+	if (!v) {
+		brotli_bw_put (bw, 0, 1);
+		return;
+	}
+	unsigned n = brotli_highbit (v);
+	brotli_bw_put (bw, 1, 1);
+	brotli_bw_put (bw, n, 3);
+	if (n) {
+		brotli_bw_put (bw, v - (1u << n), n);
+	}
+}
+
+/* Context map of n entries with move-to-front and zero runs */
+static void brotli_write_context_map(brotli_bw *bw, const uint8_t *map, unsigned n, unsigned n_trees) {
+	uint8_t v[BROTLI_LIT_CONTEXTS];
+	uint8_t mtf[BROTLI_ENC_MAX_CLUSTERS];
+	for (unsigned i = 0; i < BROTLI_ENC_MAX_CLUSTERS; i++) {
+		mtf[i] = (uint8_t)i;
+	}
+	unsigned max_run = 0;
+	unsigned run = 0;
+	for (unsigned i = 0; i < n; i++) {
+		unsigned k = 0;
+		while (mtf[k] != map[i]) {
+			k++;
+		}
+		v[i] = (uint8_t)k;
+		memmove (mtf + 1, mtf, k);
+		mtf[0] = map[i];
+		run = k? 0: run + 1;
+		if (run > max_run) {
+			max_run = run;
+		}
+	}
+	unsigned rle_max = max_run >= 2? brotli_highbit (max_run): 0;
+	uint16_t sym[BROTLI_LIT_CONTEXTS];
+	uint8_t extra[BROTLI_LIT_CONTEXTS];
+	unsigned ns = 0;
+	uint32_t freq[BROTLI_ENC_MAX_CLUSTERS + 6] = { 0 };
+	for (unsigned i = 0; i < n;) {
+		if (v[i]) {
+			sym[ns] = (uint16_t)(v[i] + rle_max);
+			extra[ns] = 0;
+			freq[sym[ns++]]++;
+			i++;
+			continue;
+		}
+		unsigned zeros = 1;
+		while (i + zeros < n && !v[i + zeros]) {
+			zeros++;
+		}
+		i += zeros;
+		while (zeros) {
+			if (zeros == 1 || !rle_max) {
+				sym[ns] = 0;
+				extra[ns] = 0;
+				zeros--;
+			} else {
+				unsigned s = brotli_highbit (zeros);
+				if (s > rle_max) {
+					s = rle_max;
+				}
+				unsigned len = zeros < (2u << s)? zeros: (2u << s) - 1;
+				sym[ns] = (uint16_t)s;
+				extra[ns] = (uint8_t)(len - (1u << s));
+				zeros -= len;
+			}
+			freq[sym[ns++]]++;
+		}
+	}
+	uint8_t lens[BROTLI_ENC_MAX_CLUSTERS + 6];
+	uint16_t codes[BROTLI_ENC_MAX_CLUSTERS + 6];
+	brotli_bw_put (bw, rle_max? 1: 0, 1);
+	if (rle_max) {
+		brotli_bw_put (bw, rle_max - 1, 4);
+	}
+	brotli_write_code (bw, freq, n_trees + rle_max, lens, codes);
+	for (unsigned i = 0; i < ns; i++) {
+		brotli_bw_put (bw, codes[sym[i]], lens[sym[i]]);
+		if (sym[i] && sym[i] <= rle_max) {
+			brotli_bw_put (bw, extra[i], sym[i]);
+		}
+	}
+	brotli_bw_put (bw, 1, 1);
+}
+
+/* ------------- Encoder state ------------- */
+
+typedef struct {
+	uint32_t insert;
+	uint32_t copy; /* coded copy length, the word length of dictionary references */
+	uint32_t out_len; /* bytes the copy produces */
+	uint32_t dist_extra;
+	uint16_t sym;
+	uint16_t dsym; /* BROTLI_ENC_NO_DIST when implied or absent */
+	uint8_t dist_nb;
+} brotli_cmd;
+
+typedef struct {
+	uint32_t len;
+	uint32_t out_len;
+	uint32_t dist;
+	int score;
+	int dict;
+} brotli_match;
+
+typedef struct brotli_enc {
+	const uint8_t *src;
+	size_t n;
+	size_t window; /* longest backward distance */
+	unsigned depth;
+	unsigned nice;
+	int lazy;
+	int ctx;
+	unsigned hash_log;
+	uint32_t *head;
+	uint32_t *chain;
+	size_t head_alloc;
+	size_t chain_alloc;
+	size_t cmds_alloc;
+	size_t chain_mask;
+	size_t next_ins;
+	uint32_t *dict_head;
+	uint32_t *dict_next;
+	uint32_t *dict_word; /* length << 16 | index */
+	uint32_t dist_rb[4];
+	unsigned dist_rb_idx;
+	brotli_cmd *cmds;
+	size_t n_cmds;
+	brotli_bw bw;
+	uint8_t lut[4][512];
+	uint32_t lit_freq[BROTLI_LIT_CONTEXTS][BROTLI_NUM_LITERALS];
+	int64_t merge_delta[BROTLI_LIT_CONTEXTS][BROTLI_LIT_CONTEXTS];
+	uint8_t lit_lens[BROTLI_ENC_MAX_CLUSTERS][BROTLI_NUM_LITERALS];
+	uint16_t lit_codes[BROTLI_ENC_MAX_CLUSTERS][BROTLI_NUM_LITERALS];
+} brotli_enc;
+
+/* ------------- Match finding ------------- */
+
+static inline uint32_t brotli_read32(const uint8_t *p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t brotli_hash4(const uint8_t *p, unsigned log) {
+	return (brotli_read32 (p) * 2654435761u) >> (32 - log);
+}
+
+/* Length of the common prefix of a and b, b running up to end */
+static inline size_t brotli_count(const uint8_t *a, const uint8_t *b, const uint8_t *end) {
+	const uint8_t *start = b;
+	while (b + 8 <= end) {
+		uint64_t x, y;
+		memcpy (&x, a, 8);
+		memcpy (&y, b, 8);
+		if (x != y) {
+			break;
+		}
+		a += 8;
+		b += 8;
+	}
+	while (b < end && *a == *b) {
+		a++;
+		b++;
+	}
+	return (size_t)(b - start);
+}
+
+/* Backward reference score: what a match saves over its literals */
+static inline int brotli_score(size_t len, uint32_t dist) {
+	return BROTLI_SCORE_BASE + 135 * (int)len - 30 * (int)brotli_highbit (dist);
+}
+
+/* Thread every position below target into the hash chains */
+static void brotli_insert_upto(brotli_enc *e, size_t target) {
+	size_t stop = e->n >= 4? e->n - 3: 0;
+	if (target < stop) {
+		stop = target;
+	}
+	for (size_t q = e->next_ins; q < stop; q++) {
+		uint32_t h = brotli_hash4 (e->src + q, e->hash_log);
+		e->chain[q & e->chain_mask] = e->head[h];
+		e->head[h] = (uint32_t)q + 1;
+	}
+	if (stop > e->next_ins) {
+		e->next_ins = stop;
+	}
+}
+
+/* Longest hash chain match at ip within [ip, end), 0 below the minimum */
+static size_t brotli_chain_match(brotli_enc *e, size_t ip, size_t end, size_t max_dist, uint32_t *dist) {
+	const uint8_t *b = e->src;
+	uint32_t cand;
+	brotli_insert_upto (e, ip);
+	if (ip < e->next_ins) {
+		cand = e->chain[ip & e->chain_mask];
+	} else {
+		uint32_t h = brotli_hash4 (b + ip, e->hash_log);
+		cand = e->head[h];
+		e->chain[ip & e->chain_mask] = cand;
+		e->head[h] = (uint32_t)ip + 1;
+		e->next_ins = ip + 1;
+	}
+	size_t best = 0;
+	size_t max_len = end - ip;
+	uint32_t cur = brotli_read32 (b + ip);
+	for (unsigned depth = e->depth; cand && depth > 0; depth--) {
+		size_t p = cand - 1;
+		if (ip - p > max_dist) {
+			break;
+		}
+		if (b[p + best] == b[ip + best] && brotli_read32 (b + p) == cur) {
+			size_t len = 4 + brotli_count (b + p + 4, b + ip + 4, b + end);
+			if (len > best) {
+				best = len;
+				*dist = (uint32_t)(ip - p);
+				if (len >= e->nice || len == max_len) {
+					break;
+				}
+			}
+		}
+		uint32_t next = e->chain[p & e->chain_mask];
+		if (next >= cand) {
+			break;
+		}
+		cand = next;
+	}
+	return best >= BROTLI_ENC_MIN_MATCH? best: 0;
+}
+
+/* The first byte is case-folded so upper-cased words share a bucket */
+static inline uint32_t brotli_dict_hash(const uint8_t *p) {
+	uint32_t v = brotli_read32 (p);
+	if (p[0] >= 'A' && p[0] <= 'Z') {
+		v |= 32;
+	}
+	return (v * 0x1e35a7bdu) >> (32 - BROTLI_DICT_HASH_LOG);
+}
+
+static int brotli_dict_init(brotli_enc *e) {
+	size_t words = 0;
+	for (unsigned len = BROTLI_DICT_MIN_LEN; len <= BROTLI_DICT_MAX_LEN; len++) {
+		words += (size_t)1 << brotli_dict_bits[len];
+	}
+	e->dict_head = (uint32_t *)calloc ((size_t)1 << BROTLI_DICT_HASH_LOG, sizeof (uint32_t));
+	e->dict_next = (uint32_t *)malloc (words * sizeof (uint32_t));
+	e->dict_word = (uint32_t *)malloc (words * sizeof (uint32_t));
+	if (!e->dict_head || !e->dict_next || !e->dict_word) {
+		/* a half built index must not look ready to the next stream */
+		free (e->dict_head);
+		free (e->dict_next);
+		free (e->dict_word);
+		e->dict_head = e->dict_next = e->dict_word = NULL;
+		return -1;
+	}
+	/* longer words end up first in their bucket */
+	uint32_t g = 0;
+	for (unsigned len = BROTLI_DICT_MIN_LEN; len <= BROTLI_DICT_MAX_LEN; len++) {
+		const uint8_t *w = (const uint8_t *)brotli_dict_data + brotli_dict_offset[len];
+		for (uint32_t idx = 0; idx < (1u << brotli_dict_bits[len]); idx++, g++) {
+			uint32_t h = brotli_dict_hash (w + idx * len);
+			e->dict_word[g] = (len << 16) | idx;
+			e->dict_next[g] = e->dict_head[h];
+			e->dict_head[h] = g + 1;
+		}
+	}
+	return 0;
+}
+
+/* Best static dictionary reference at ip: identity, a trailing space,
+ * dropped last bytes or an upper-cased first letter */
+static void brotli_dict_match(const brotli_enc *e, size_t ip, size_t end, size_t max_dist, brotli_match *m) {
+	const uint8_t *p = e->src + ip;
+	size_t avail = end - ip;
+	for (uint32_t g = e->dict_head[brotli_dict_hash (p)]; g; g = e->dict_next[g - 1]) {
+		unsigned len = e->dict_word[g - 1] >> 16;
+		uint32_t idx = e->dict_word[g - 1] & 0xffff;
+		const uint8_t *w = (const uint8_t *)brotli_dict_data + brotli_dict_offset[len] + idx * len;
+		int upper = 0;
+		if (p[0] != w[0]) {
+			if (w[0] < 'a' || w[0] > 'z' || p[0] != (w[0] ^ 32)) {
+				continue;
+			}
+			upper = 1;
+		}
+		size_t lim = avail < len? avail: len;
+		size_t k = 1 + brotli_count (w + 1, p + 1, p + lim);
+		unsigned tid;
+		size_t out;
+		if (k == len) {
+			tid = upper? BROTLI_TID_UPPER_FIRST: BROTLI_TID_IDENTITY;
+			out = len;
+			if (len < avail && p[len] == ' ') {
+				tid = upper? BROTLI_TID_UPPER_FIRST_SPACE: BROTLI_TID_SPACE;
+				out++;
+			}
+		} else if (!upper && k >= BROTLI_DICT_MIN_LEN && len - k <= 9) {
+			tid = brotli_tid_omit_last[len - k];
+			out = k;
+		} else {
+			continue;
+		}
+		uint32_t dist = (uint32_t)max_dist + 1 + ((tid << brotli_dict_bits[len]) | idx);
+		int score = brotli_score (out, dist);
+		if (score > m->score) {
+			m->len = len;
+			m->out_len = (uint32_t)out;
+			m->dist = dist;
+			m->score = score;
+			m->dict = 1;
+		}
+	}
+}
+
+/* Best reference at ip among the recent distances, the hash chains and
+ * the static dictionary; score 0 when there is none */
+static void brotli_find_best(brotli_enc *e, size_t ip, size_t end, brotli_match *m) {
+	const uint8_t *b = e->src;
+	size_t max_dist = ip < e->window? ip: e->window;
+	memset (m, 0, sizeof (*m));
+	uint32_t cur = brotli_read32 (b + ip);
+	for (unsigned i = 0; i < 4; i++) {
+		uint32_t d = e->dist_rb[(e->dist_rb_idx - 1 - i) & 3];
+		if (d > max_dist || brotli_read32 (b + ip - d) != cur) {
+			continue;
+		}
+		size_t len = 4 + brotli_count (b + ip - d + 4, b + ip + 4, b + end);
+		int score = BROTLI_SCORE_BASE + 135 * (int)len + (i? -39: 15);
+		if (score > m->score) {
+			m->len = m->out_len = (uint32_t)len;
+			m->dist = d;
+			m->score = score;
+		}
+	}
+	uint32_t dist = 0;
+	size_t len = brotli_chain_match (e, ip, end, max_dist, &dist);
+	if (len) {
+		int score = brotli_score (len, dist);
+		if (score > m->score) {
+			m->len = m->out_len = (uint32_t)len;
+			m->dist = dist;
+			m->score = score;
+		}
+	}
+	if (e->dict_head && m->out_len < BROTLI_DICT_MAX_LEN) {
+		brotli_dict_match (e, ip, end, max_dist, m);
+	}
+}
+
+/* ------------- Commands ------------- */
+
+static inline unsigned brotli_insert_code(uint32_t n) {
+	if (n < 6) {
+		return n;
+	}
+	if (n < 130) {
+		unsigned nb = brotli_highbit (n - 2) - 1;
+		return (nb << 1) + ((n - 2) >> nb) + 2;
+	}
+	if (n < 2114) {
+		return brotli_highbit (n - 66) + 10;
+	}
+	return n < 6210? 21: n < 22594? 22: 23;
+}
+
+static inline unsigned brotli_copy_code(uint32_t n) {
+	if (n < 10) {
+		return n - 2;
+	}
+	if (n < 134) {
+		unsigned nb = brotli_highbit (n - 6) - 1;
+		return (nb << 1) + ((n - 6) >> nb) + 4;
+	}
+	if (n < 2118) {
+		return brotli_highbit (n - 70) + 12;
+	}
+	return 23;
+}
+
+/* Distance symbol of dist: a short code against the recent distances,
+ * else a long code with extra bits (no postfix bits, no direct codes) */
+static unsigned brotli_dist_code(const brotli_enc *e, uint32_t dist, int dict, uint32_t *extra, uint8_t *nb) {
+	*extra = 0;
+	*nb = 0;
+	if (!dict) {
+		static const int8_t delta[6] = { -1, 1, -2, 2, -3, 3 };
+		const uint32_t *rb = e->dist_rb;
+		unsigned idx = e->dist_rb_idx;
+		for (unsigned c = 0; c < 4; c++) {
+			if (rb[(idx - 1 - c) & 3] == dist) {
+				return c;
+			}
+		}
+		for (unsigned c = 4; c < BROTLI_NUM_SHORT_DISTS; c++) {
+			int64_t v = (int64_t)rb[(idx - (c < 10? 1: 2)) & 3] + delta[(c - 4) % 6];
+			if (v == (int64_t)dist) {
+				return c;
+			}
+		}
+	}
+	uint32_t d = dist + 3;
+	unsigned bits = brotli_highbit (d) - 1;
+	unsigned half = (d >> bits) & 1;
+	*nb = (uint8_t)bits;
+	*extra = d - ((2 + half) << bits);
+	return BROTLI_NUM_SHORT_DISTS + 2 * (bits - 1) + half;
+}
+
+/* Queue a command; dist 0 marks the insert-only tail of a meta-block */
+static void brotli_push_cmd(brotli_enc *e, uint32_t insert, const brotli_match *m) {
+	brotli_cmd *c = &e->cmds[e->n_cmds++];
+	unsigned icode = brotli_insert_code (insert);
+	unsigned ccode = m->dist? brotli_copy_code (m->len): 0;
+	c->insert = insert;
+	c->copy = m->dist? m->len: 2;
+	c->out_len = m->dist? m->out_len: 0;
+	c->dsym = BROTLI_ENC_NO_DIST;
+	c->dist_extra = 0;
+	c->dist_nb = 0;
+	unsigned low = ((icode & 7) << 3) | (ccode & 7);
+	if (!m->dist) {
+		c->sym = (uint16_t)((icode < 8? 0: brotli_cell_of[icode >> 3][0]) * 64 + low);
+		return;
+	}
+	unsigned dsym = brotli_dist_code (e, m->dist, m->dict, &c->dist_extra, &c->dist_nb);
+	if (!dsym && icode < 8 && ccode < 16) {
+		/* the last distance is implied by the command */
+		c->sym = (uint16_t)((ccode < 8? 0: 64) + low);
+		return;
+	}
+	c->sym = (uint16_t)(brotli_cell_of[icode >> 3][ccode >> 3] * 64 + low);
+	c->dsym = (uint16_t)dsym;
+	if (dsym && !m->dict) {
+		e->dist_rb[e->dist_rb_idx++ & 3] = m->dist;
+	}
+}
+
+/* Split [ms, me) into commands */
+static void brotli_parse(brotli_enc *e, size_t ms, size_t me) {
+	const uint8_t *b = e->src;
+	size_t ip = ms;
+	size_t anchor = ms;
+	e->n_cmds = 0;
+	while (ip + BROTLI_ENC_MIN_MATCH <= me) {
+		brotli_match m;
+		brotli_find_best (e, ip, me, &m);
+		if (m.score < BROTLI_MIN_SCORE) {
+			/* skip faster through data that keeps failing to match */
+			ip += e->depth == 1? 1 + ((ip - anchor) >> 8): 1;
+			continue;
+		}
+		for (int step = 0; e->lazy && step < 4 && ip + 1 + BROTLI_ENC_MIN_MATCH <= me; step++) {
+			brotli_match next;
+			brotli_find_best (e, ip + 1, me, &next);
+			if (next.score < m.score + BROTLI_LAZY_MARGIN) {
+				break;
+			}
+			ip++;
+			m = next;
+		}
+		if (!m.dict) {
+			while (ip > anchor && ip > m.dist && b[ip - 1] == b[ip - 1 - m.dist]) {
+				ip--;
+				m.len++;
+				m.out_len++;
+			}
+		}
+		brotli_push_cmd (e, (uint32_t)(ip - anchor), &m);
+		ip += m.out_len;
+		anchor = ip;
+		if (e->depth <= 2 && ip > e->next_ins + 2) {
+			/* fast qualities leave the inside of matches unindexed */
+			e->next_ins = ip - 2;
+		}
+	}
+	if (anchor < me) {
+		brotli_match tail;
+		memset (&tail, 0, sizeof (tail));
+		brotli_push_cmd (e, (uint32_t)(me - anchor), &tail);
+	}
+}
+
+/* ------------- Literal context clusters ------------- */
+
+/* Estimated bits, in 1/256 units, of coding h with its own prefix code */
+static int64_t brotli_hist_cost(const uint32_t *h) {
+	uint64_t total = 0;
+	unsigned used = 0;
+	for (unsigned s = 0; s < BROTLI_NUM_LITERALS; s++) {
+		if (h[s]) {
+			total += h[s];
+			used++;
+		}
+	}
+	if (!total) {
+		return 0;
+	}
+	uint32_t lt = brotli_log2_fp ((uint32_t)total);
+	int64_t bits = 0;
+	for (unsigned s = 0; s < BROTLI_NUM_LITERALS; s++) {
+		if (h[s]) {
+			bits += (int64_t)h[s] * (lt - brotli_log2_fp (h[s]));
+		}
+	}
+	return bits + ((int64_t)used * 6 + 40) * 256;
+}
+
+static int64_t brotli_merge_cost(const uint32_t *a, const uint32_t *b) {
+	uint32_t h[BROTLI_NUM_LITERALS];
+	for (unsigned s = 0; s < BROTLI_NUM_LITERALS; s++) {
+		h[s] = a[s] + b[s];
+	}
+	return brotli_hist_cost (h);
+}
+
+/* Merge the 64 context histograms while that saves bits or there are more
+ * than BROTLI_ENC_MAX_CLUSTERS; fills map and returns the tree count.
+ * The histograms of the trees end up at their index in lit_freq. */
+static unsigned brotli_cluster_literals(brotli_enc *e, uint8_t *map) {
+	uint32_t (*h)[BROTLI_NUM_LITERALS] = e->lit_freq;
+	int64_t cost[BROTLI_LIT_CONTEXTS];
+	int64_t (*delta)[BROTLI_LIT_CONTEXTS] = e->merge_delta;
+	uint8_t rep[BROTLI_LIT_CONTEXTS];
+	int active[BROTLI_LIT_CONTEXTS];
+	unsigned n_active = 0;
+	for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+		cost[i] = brotli_hist_cost (h[i]);
+		active[i] = cost[i] != 0;
+		n_active += (unsigned)active[i];
+		rep[i] = (uint8_t)i;
+	}
+	for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+		for (unsigned j = i + 1; active[i] && j < BROTLI_LIT_CONTEXTS; j++) {
+			if (active[j]) {
+				delta[i][j] = brotli_merge_cost (h[i], h[j]) - cost[i] - cost[j];
+			}
+		}
+	}
+	while (n_active > 1) {
+		unsigned bi = 0;
+		unsigned bj = 0;
+		int64_t best = INT64_MAX;
+		for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+			for (unsigned j = i + 1; active[i] && j < BROTLI_LIT_CONTEXTS; j++) {
+				if (active[j] && delta[i][j] < best) {
+					best = delta[i][j];
+					bi = i;
+					bj = j;
+				}
+			}
+		}
+		if (best > 0 && n_active <= BROTLI_ENC_MAX_CLUSTERS) {
+			break;
+		}
+		for (unsigned s = 0; s < BROTLI_NUM_LITERALS; s++) {
+			h[bi][s] += h[bj][s];
+		}
+		cost[bi] += cost[bj] + best;
+		active[bj] = 0;
+		n_active--;
+		for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+			if (rep[i] == bj) {
+				rep[i] = (uint8_t)bi;
+			}
+		}
+		for (unsigned k = 0; k < BROTLI_LIT_CONTEXTS; k++) {
+			if (active[k] && k != bi) {
+				int64_t d = brotli_merge_cost (h[bi], h[k]) - cost[bi] - cost[k];
+				if (k < bi) {
+					delta[k][bi] = d;
+				} else {
+					delta[bi][k] = d;
+				}
+			}
+		}
+	}
+	/* number the trees by first use; unused contexts repeat the previous
+	 * one to keep the map's runs long */
+	int tree_of[BROTLI_LIT_CONTEXTS];
+	unsigned n_trees = 0;
+	unsigned last = 0;
+	for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+		tree_of[i] = -1;
+	}
+	for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+		if (!active[rep[i]]) {
+			map[i] = (uint8_t)last;
+			continue;
+		}
+		if (tree_of[rep[i]] < 0) {
+			tree_of[rep[i]] = (int)n_trees++;
+		}
+		map[i] = (uint8_t)tree_of[rep[i]];
+		last = map[i];
+	}
+	for (unsigned i = 0; i < BROTLI_LIT_CONTEXTS; i++) {
+		if (tree_of[i] >= 0 && (unsigned)tree_of[i] != i) {
+			memcpy (h[tree_of[i]], h[i], sizeof (h[i]));
+		}
+	}
+	return n_trees? n_trees: 1;
+}
+
+/* ------------- Meta-blocks ------------- */
+
+static void brotli_write_mlen(brotli_bw *bw, size_t mlen) {
+	unsigned nibbles = 4;
+	while (nibbles < 6 && (mlen - 1) >> (4 * nibbles)) {
+		nibbles++;
+	}
+	brotli_bw_put (bw, nibbles - 4, 2);
+	brotli_bw_put (bw, (uint32_t)(mlen - 1), 4 * nibbles);
+}
+
+/* Write [ms, me) as a compressed meta-block with the parsed commands */
+static void brotli_write_compressed(brotli_enc *e, size_t ms, size_t me, int last) {
+	brotli_bw *bw = &e->bw;
+	const uint8_t *b = e->src;
+	const uint8_t *lut = e->lut[BROTLI_MODE_UTF8];
+	uint32_t cmd_freq[BROTLI_NUM_COMMANDS] = { 0 };
+	uint32_t dist_freq[BROTLI_ENC_DIST_ALPHABET] = { 0 };
+	memset (e->lit_freq, 0, sizeof (e->lit_freq));
+	size_t pos = ms;
+	for (size_t i = 0; i < e->n_cmds; i++) {
+		const brotli_cmd *c = &e->cmds[i];
+		cmd_freq[c->sym]++;
+		if (c->dsym != BROTLI_ENC_NO_DIST) {
+			dist_freq[c->dsym]++;
+		}
+		for (uint32_t k = 0; k < c->insert; k++, pos++) {
+			unsigned ctx = 0;
+			if (e->ctx) {
+				uint8_t p1 = pos? b[pos - 1]: 0;
+				uint8_t p2 = pos > 1? b[pos - 2]: 0;
+				ctx = lut[p1] | lut[256 + p2];
+			}
+			e->lit_freq[ctx][b[pos]]++;
+		}
+		pos += c->out_len;
+	}
+	uint8_t map[BROTLI_LIT_CONTEXTS];
+	unsigned n_trees = 1;
+	memset (map, 0, sizeof (map));
+	if (e->ctx) {
+		n_trees = brotli_cluster_literals (e, map);
+	}
+
+	brotli_bw_put (bw, (uint32_t)last, 1);
+	if (last) {
+		brotli_bw_put (bw, 0, 1);
+	}
+	brotli_write_mlen (bw, me - ms);
+	if (!last) {
+		brotli_bw_put (bw, 0, 1);
+	}
+	/* one block type each for literals, commands and distances */
+	brotli_write_var8 (bw, 0);
+	brotli_write_var8 (bw, 0);
+	brotli_write_var8 (bw, 0);
+	brotli_bw_put (bw, 0, 2); /* NPOSTFIX */
+	brotli_bw_put (bw, 0, 4); /* NDIRECT */
+	brotli_bw_put (bw, e->ctx? BROTLI_MODE_UTF8: BROTLI_MODE_LSB6, 2);
+	brotli_write_var8 (bw, n_trees - 1);
+	if (n_trees > 1) {
+		brotli_write_context_map (bw, map, BROTLI_LIT_CONTEXTS, n_trees);
+	}
+	brotli_write_var8 (bw, 0);
+	for (unsigned t = 0; t < n_trees; t++) {
+		brotli_write_code (bw, e->lit_freq[t], BROTLI_NUM_LITERALS, e->lit_lens[t], e->lit_codes[t]);
+	}
+	uint8_t cmd_lens[BROTLI_NUM_COMMANDS];
+	uint16_t cmd_codes[BROTLI_NUM_COMMANDS];
+	uint8_t dist_lens[BROTLI_ENC_DIST_ALPHABET];
+	uint16_t dist_codes[BROTLI_ENC_DIST_ALPHABET];
+	brotli_write_code (bw, cmd_freq, BROTLI_NUM_COMMANDS, cmd_lens, cmd_codes);
+	brotli_write_code (bw, dist_freq, BROTLI_ENC_DIST_ALPHABET, dist_lens, dist_codes);
+
+	pos = ms;
+	for (size_t i = 0; i < e->n_cmds; i++) {
+		const brotli_cmd *c = &e->cmds[i];
+		unsigned cell = c->sym >> 6;
+		unsigned icode = brotli_cell_insert[cell] + ((c->sym >> 3) & 7);
+		unsigned ccode = brotli_cell_copy[cell] + (c->sym & 7);
+		brotli_bw_put (bw, cmd_codes[c->sym], cmd_lens[c->sym]);
+		brotli_bw_put (bw, c->insert - brotli_insert_base[icode], brotli_insert_extra[icode]);
+		brotli_bw_put (bw, c->copy - brotli_copy_base[ccode], brotli_copy_extra[ccode]);
+		for (uint32_t k = 0; k < c->insert; k++, pos++) {
+			unsigned t = 0;
+			if (n_trees > 1) {
+				uint8_t p1 = pos? b[pos - 1]: 0;
+				uint8_t p2 = pos > 1? b[pos - 2]: 0;
+				t = map[lut[p1] | lut[256 + p2]];
+			}
+			brotli_bw_put (bw, e->lit_codes[t][b[pos]], e->lit_lens[t][b[pos]]);
+		}
+		if (c->dsym != BROTLI_ENC_NO_DIST) {
+			brotli_bw_put (bw, dist_codes[c->dsym], dist_lens[c->dsym]);
+			brotli_bw_put (bw, c->dist_extra, c->dist_nb);
+		}
+		pos += c->out_len;
+	}
+}
+
+/* Encode [ms, me), falling back to a stored meta-block when that is
+ * smaller; a stored last block is followed by an empty last one */
+static void brotli_write_block(brotli_enc *e, size_t ms, size_t me, int last) {
+	brotli_bw *bw = &e->bw;
+	brotli_bw saved = *bw;
+	uint32_t rb[4];
+	unsigned rb_idx = e->dist_rb_idx;
+	memcpy (rb, e->dist_rb, sizeof (rb));
+	size_t mlen = me - ms;
+	brotli_parse (e, ms, me);
+	brotli_write_compressed (e, ms, me, last);
+	if (bw->oom || brotli_bw_bits (bw) - brotli_bw_bits (&saved) <= (mlen + 4) * 8) {
+		return;
+	}
+	/* stored data leaves the recent distances alone */
+	bw->len = saved.len;
+	bw->acc = saved.acc;
+	bw->cnt = saved.cnt;
+	e->dist_rb_idx = rb_idx;
+	memcpy (e->dist_rb, rb, sizeof (rb));
+	brotli_bw_put (bw, 0, 1);
+	brotli_write_mlen (bw, mlen);
+	brotli_bw_put (bw, 1, 1);
+	brotli_bw_align (bw);
+	brotli_bw_grow (bw, mlen);
+	if (!bw->oom) {
+		memcpy (bw->buf + bw->len, e->src + ms, mlen);
+		bw->len += mlen;
+	}
+	if (last) {
+		brotli_bw_put (bw, 1, 1);
+		brotli_bw_put (bw, 1, 1);
+	}
+}
+
+/* buf when it holds n elements of sz bytes, else a fresh one */
+static void *brotli_reserve(void *buf, size_t *have, size_t n, size_t sz) {
+	if (buf && *have >= n) {
+		return buf;
+	}
+	free (buf);
+	*have = 0;
+	buf = malloc (n * sz);
+	if (buf) {
+		*have = n;
+	}
+	return buf;
+}
+
+static void brotli_enc_free(brotli_enc *e) {
+	if (e) {
+		free (e->head);
+		free (e->chain);
+		free (e->cmds);
+		free (e->dict_head);
+		free (e->dict_next);
+		free (e->dict_word);
+		free (e);
+	}
+}
+
+/* Encode src[0..n) into ctx->out. The match finder tables, the
+ * dictionary index and the output buffer of the previous stream are
+ * reused when they are big enough. */
+static int brotli_encode(brotli_compress_context *ctx, const uint8_t *src, size_t n) {
+	brotli_enc *e = ctx->enc;
+	if (!e) {
+		e = (brotli_enc *)calloc (1, sizeof (brotli_enc));
+		if (!e) {
+			return Z_MEM_ERROR;
+		}
+		ctx->enc = e;
+	} else {
+		uint32_t *head = e->head;
+		uint32_t *chain = e->chain;
+		brotli_cmd *cmds = e->cmds;
+		uint32_t *dict_head = e->dict_head;
+		uint32_t *dict_next = e->dict_next;
+		uint32_t *dict_word = e->dict_word;
+		size_t head_alloc = e->head_alloc;
+		size_t chain_alloc = e->chain_alloc;
+		size_t cmds_alloc = e->cmds_alloc;
+		memset (e, 0, sizeof (brotli_enc));
+		e->head = head;
+		e->chain = chain;
+		e->cmds = cmds;
+		e->dict_head = dict_head;
+		e->dict_next = dict_next;
+		e->dict_word = dict_word;
+		e->head_alloc = head_alloc;
+		e->chain_alloc = chain_alloc;
+		e->cmds_alloc = cmds_alloc;
+	}
+	int q = ctx->quality;
+	unsigned lgwin = ctx->lgwin;
+	while (lgwin > 16 && ((size_t)1 << (lgwin - 1)) - BROTLI_WINDOW_GAP >= n) {
+		lgwin--;
+	}
+	e->src = src;
+	e->n = n;
+	e->window = ((size_t)1 << lgwin) - BROTLI_WINDOW_GAP;
+	e->depth = brotli_levels[q].depth;
+	e->nice = brotli_levels[q].nice;
+	e->lazy = brotli_levels[q].lazy;
+	e->ctx = brotli_levels[q].ctx;
+	e->hash_log = brotli_levels[q].hash_log;
+	while (e->hash_log > 10 && ((size_t)1 << (e->hash_log - 1)) > n) {
+		e->hash_log--;
+	}
+	e->chain_mask = ((size_t)1 << lgwin) - 1;
+	e->dist_rb[0] = 16;
+	e->dist_rb[1] = 15;
+	e->dist_rb[2] = 11;
+	e->dist_rb[3] = 4;
+	e->dist_rb_idx = 4;
+	e->bw.buf = ctx->out;
+	e->bw.cap = ctx->out_cap;
+	brotli_context_lut_init (e->lut);
+	size_t block = n < BROTLI_ENC_BLOCK_SIZE? n: BROTLI_ENC_BLOCK_SIZE;
+	size_t head_n = (size_t)1 << e->hash_log;
+	e->head = (uint32_t *)brotli_reserve (e->head, &e->head_alloc, head_n, sizeof (uint32_t));
+	if (e->head) {
+		memset (e->head, 0, head_n * sizeof (uint32_t));
+	}
+	e->chain = (uint32_t *)brotli_reserve (e->chain, &e->chain_alloc, n < e->chain_mask + 1? n + 1: e->chain_mask + 1, sizeof (uint32_t));
+	e->cmds = (brotli_cmd *)brotli_reserve (e->cmds, &e->cmds_alloc, block / BROTLI_ENC_MIN_MATCH + 2, sizeof (brotli_cmd));
+	int ret = Z_OK;
+	if (!e->head || !e->chain || !e->cmds || (brotli_levels[q].dict && !e->dict_head && brotli_dict_init (e) < 0)) {
+		ret = Z_MEM_ERROR;
+	}
+	if (n < e->chain_mask + 1) {
+		/* the chain never wraps, index it by position */
+		e->chain_mask = SIZE_MAX;
+	}
+
+	if (ret == Z_OK) {
+		/* WBITS */
+		brotli_bw *bw = &e->bw;
+		if (lgwin == 16) {
+			brotli_bw_put (bw, 0, 1);
+		} else if (lgwin == 17) {
+			brotli_bw_put (bw, 1, 7);
+		} else if (lgwin > 17) {
+			brotli_bw_put (bw, 1 | ((lgwin - 17) << 1), 4);
+		} else {
+			brotli_bw_put (bw, 1 | ((lgwin - 8) << 4), 7);
+		}
+		if (!n) {
+			brotli_bw_put (bw, 3, 2); /* ISLAST, ISLASTEMPTY */
+		}
+		for (size_t ms = 0; ms < n; ms += block) {
+			size_t me = n - ms < block? n: ms + block;
+			brotli_write_block (e, ms, me, me == n);
+		}
+		brotli_bw_align (bw);
+		if (bw->oom) {
+			ret = Z_MEM_ERROR;
+		}
+	}
+	ctx->out = e->bw.buf;
+	ctx->out_cap = e->bw.cap;
+	ctx->out_len = ret == Z_OK? e->bw.len: 0;
+	return ret;
+}
+
+/* ------------- zlib-like API ------------- */
+
+/* Initialize a compression stream */
+int brotliInit(z_stream *strm, int level) {
+	return brotliCompressInit2 (strm, level, 0, 8, Z_DEFAULT_STRATEGY);
+}
+
+/* Compress data using Brotli format. The whole input is encoded once
+ * Z_FINISH arrives; earlier calls only take input in. */
+int brotliCompress(z_stream *strm, int flush) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+
+	brotli_compress_context *ctx = (brotli_compress_context *)strm->state;
+	uLong in0 = strm->total_in;
+	uLong out0 = strm->total_out;
+
+	if (!ctx->encoded) {
+		const uint8_t *src = strm->next_in;
+		size_t n = strm->avail_in;
+		if (flush != Z_FINISH || ctx->in_len) {
+			if (ctx->in_len + n > ctx->in_cap) {
+				size_t cap = ctx->in_cap? ctx->in_cap: 65536;
+				while (cap < ctx->in_len + n) {
+					cap *= 2;
+				}
+				uint8_t *nb = (uint8_t *)realloc (ctx->in, cap);
+				if (!nb) {
+					return Z_MEM_ERROR;
+				}
+				ctx->in = nb;
+				ctx->in_cap = cap;
+			}
+			memcpy (ctx->in + ctx->in_len, src, n);
+			ctx->in_len += n;
+			src = ctx->in;
+		}
+		strm->next_in += n;
+		strm->avail_in = 0;
+		strm->total_in += n;
+		if (flush != Z_FINISH) {
+			return strm->total_in != in0? Z_OK: Z_BUF_ERROR;
+		}
+		int ret = brotli_encode (ctx, src, src == ctx->in? ctx->in_len: n);
+		ctx->in_len = 0;
+		if (ret != Z_OK) {
+			return ret;
+		}
+		ctx->encoded = 1;
+	}
+
+	/* Hand out what is left of the encoded stream */
+	size_t n = ctx->out_len - ctx->out_pos;
+	if (n > strm->avail_out) {
+		n = strm->avail_out;
+	}
+	if (n) {
+		memcpy (strm->next_out, ctx->out + ctx->out_pos, n);
+	}
+	ctx->out_pos += n;
+	strm->next_out += n;
+	strm->avail_out -= (uInt)n;
+	strm->total_out += n;
+	if (ctx->out_pos == ctx->out_len) {
+		return Z_STREAM_END;
+	}
+	return strm->total_out != out0? Z_OK: Z_BUF_ERROR;
+}
+
+/* Get ready for the next stream with the same quality and window,
+ * keeping the buffers and tables */
+int brotliReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_compress_context *ctx = (brotli_compress_context *)strm->state;
+	ctx->in_len = 0;
+	ctx->out_len = 0;
+	ctx->out_pos = 0;
+	ctx->encoded = 0;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+/* End a compression stream */
+int brotliEnd(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	brotli_compress_context *ctx = (brotli_compress_context *)strm->state;
+	brotli_enc_free (ctx->enc);
+	free (ctx->in);
+	free (ctx->out);
+	free (ctx);
+	strm->state = NULL;
+	return Z_OK;
+}
+
+/* level is the quality 0-11, windowBits the log2 of the window (10-24,
+ * 0 for the default) */
+int brotliCompressInit2(z_stream *strm, int level, int windowBits, int memLevel, int strategy) {
+	(void)memLevel; /* Unused */
+	(void)strategy; /* Unused */
+	if (!strm) {
+		return Z_STREAM_ERROR;
+	}
+	if (level < 0) {
+		level = BROTLI_DEFAULT_QUALITY;
+	} else if (level > 11) {
+		level = 11;
+	}
+	if (windowBits == 0) {
+		windowBits = BROTLI_DEFAULT_WBITS;
+	} else if (windowBits < BROTLI_WBITS_MIN) {
+		windowBits = BROTLI_WBITS_MIN;
+	} else if (windowBits > BROTLI_WBITS_MAX) {
+		windowBits = BROTLI_WBITS_MAX;
+	}
+	brotli_compress_context *ctx = (brotli_compress_context *)calloc (1, sizeof (brotli_compress_context));
+	if (!ctx) {
+		return Z_MEM_ERROR;
+	}
+	ctx->quality = level;
+	ctx->lgwin = (unsigned)windowBits;
+	strm->state = (void *)ctx;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+int brotliCompressInit2_(z_stream *strm, int level, int windowBits, int memLevel, int strategy, const char *version, int stream_size) {
+	(void)version; /* Unused */
+	(void)stream_size; /* Unused */
+	return brotliCompressInit2 (strm, level, windowBits, memLevel, strategy);
+}
+
+#endif /* OBROTLI_ENC_H */
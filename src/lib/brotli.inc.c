@@ -1,3 +1,18 @@
+/* brotli.inc.c - Minimalistic Brotli implementation compatible with zlib-like API
+ * Version: 0.2 (2025-07-27)
+ *
+ * This implementation provides RFC 7932 Brotli compression/decompression
+ * with zlib-compatible API by including separate encoder and decoder
+ * implementations. This file holds what both sides share: the static
+ * dictionary and its transforms, the literal context lookup tables and
+ * the prefix code ranges of lengths and block counts.
+ *
+ * Usage:
+ *   #define OTEZIP_ENABLE_BROTLI in one source file before including
+ *
+ * License: MIT / 0-BSD - do whatever you want; attribution appreciated.
+ */
+
 #ifndef OBROTLI_H
 #define OBROTLI_H
 
@@ -7,212 +22,298 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../include/otezip/zstream.h"
-#include "../include/otezip/zip.h" /* for read/write little-endian helpers */
 
-typedef struct {
-	int quality;
-	int window_bits;
-	uint32_t crc32;
-} brotli_encoder_state;
+/* ------------- API Constants (compatible with zlib) ------------- */
 
-typedef struct {
-	uint32_t crc32;
-} brotli_decoder_state;
+/* Return codes (from zlib for compatibility) */
+#define Z_OK 0
+#define Z_STREAM_END 1
+#define Z_NEED_DICT 2
+#define Z_ERRNO (-1)
+#define Z_STREAM_ERROR (-2)
+#define Z_DATA_ERROR (-3)
+#define Z_MEM_ERROR (-4)
+#define Z_BUF_ERROR (-5)
+#define Z_VERSION_ERROR (-6)
 
-static int clamp_quality(int lvl) {
-	if (lvl < 0) {
-		return 5;
-	}
-	if (lvl > 11) {
-		return 11;
-	}
-	return lvl;
-}
+/* Flush values */
+#define Z_NO_FLUSH 0
+#define Z_PARTIAL_FLUSH 1
+#define Z_SYNC_FLUSH 2
+#define Z_FULL_FLUSH 3
+#define Z_FINISH 4
 
-static uint32_t my_crc32(const uint8_t *data, size_t len, uint32_t crc) {
-	extern const uint32_t crc32_table[256];
-	crc = ~crc;
-	for (size_t i = 0; i < len; i++) {
-		crc = crc32_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
-	}
-	return ~crc;
-}
+/* Strategy values */
+#define Z_DEFAULT_STRATEGY 0
 
-static size_t simple_compress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len) {
-	const size_t header_size = 5 + 8 + 4;
-	if (output_len < header_size || input_len > output_len - header_size) {
-		return 0;
-	}
-	memcpy (output, "BROT", 4);
-	output[4] = 1;
-	/* Store length/checksum in little-endian fixed widths to be portable
-	 * across architectures (avoid writing host-endian `size_t`). */
-	otezip_write_le64 (output + 5, (uint64_t)input_len);
-	uint32_t checksum = my_crc32 (input, input_len, 0);
-	otezip_write_le32 (output + 5 + 8, checksum);
-	memcpy (output + 5 + 8 + 4, input, input_len);
-	return (size_t) (5 + 8 + 4 + input_len);
+/* Compression level */
+#define Z_NO_COMPRESSION 0
+#define Z_BEST_SPEED 1
+#define Z_BEST_COMPRESSION 9
+#define Z_DEFAULT_COMPRESSION (-1)
+
+/* ------------- Format constants ------------- */
+
+#define BROTLI_WBITS_MIN 10
+#define BROTLI_WBITS_MAX 24
+#define BROTLI_WINDOW_GAP 16 /* the window is (1 << WBITS) - 16 bytes */
+#define BROTLI_MAX_CODE_BITS 15
+#define BROTLI_NUM_LITERALS 256
+#define BROTLI_NUM_COMMANDS 704
+#define BROTLI_NUM_BLOCK_LENS 26
+#define BROTLI_NUM_SHORT_DISTS 16
+#define BROTLI_CODE_LEN_CODES 18
+#define BROTLI_REPEAT_PREV 16 /* code length symbol repeating the last non-zero length */
+#define BROTLI_REPEAT_ZERO 17
+#define BROTLI_INITIAL_REPEAT_LEN 8
+#define BROTLI_LIT_CONTEXTS 64
+#define BROTLI_DIST_CONTEXTS 4
+#define BROTLI_MAX_BLOCK_TYPES 256
+#define BROTLI_NUM_TRANSFORMS 121
+#define BROTLI_MAX_WORD_OUT 37 /* longest prefix + 24-byte word + longest suffix */
+
+/* Literal context modes */
+#define BROTLI_MODE_LSB6 0
+#define BROTLI_MODE_MSB6 1
+#define BROTLI_MODE_UTF8 2
+#define BROTLI_MODE_SIGNED 3
+
+/* Order in which the code length code lengths are stored */
+static const uint8_t brotli_code_len_order[BROTLI_CODE_LEN_CODES] = {
+	1, 2, 3, 4, 0, 5, 17, 6, 16, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+/* ------------- Length and block count prefix codes ------------- */
+
+static const uint32_t brotli_insert_base[24] = {
+	0, 1, 2, 3, 4, 5, 6, 8, 10, 14, 18, 26, 34, 50, 66, 98, 130, 194, 322, 578, 1090, 2114, 6210, 22594
+};
+static const uint8_t brotli_insert_extra[24] = {
+	0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 12, 14, 24
+};
+static const uint32_t brotli_copy_base[24] = {
+	2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 18, 22, 30, 38, 54, 70, 102, 134, 198, 326, 582, 1094, 2118
+};
+static const uint8_t brotli_copy_extra[24] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 24
+};
+static const uint32_t brotli_block_len_base[BROTLI_NUM_BLOCK_LENS] = {
+	1, 5, 9, 13, 17, 25, 33, 41, 49, 65, 81, 97, 113, 145, 177, 209, 241, 305, 369, 497, 753, 1265, 2289, 4337, 8433, 16625
+};
+static const uint8_t brotli_block_len_extra[BROTLI_NUM_BLOCK_LENS] = {
+	2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8, 9, 10, 11, 12, 13, 24
+};
+
+/* Insert-and-copy symbols come in 11 cells of 64: the insert and copy
+ * code ranges each cell starts at. The first two cells reuse the last
+ * distance without coding one. */
+static const uint8_t brotli_cell_insert[11] = { 0, 0, 0, 0, 8, 8, 0, 16, 8, 16, 16 };
+static const uint8_t brotli_cell_copy[11] = { 0, 8, 0, 8, 0, 8, 16, 0, 16, 8, 16 };
+
+/* ------------- Literal context lookup tables ------------- */
+
+/* UTF8 mode: context = brotli_utf8_lut0[p1] | brotli_utf8_lut1[p2] */
+static const uint8_t brotli_utf8_lut0[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8, 12, 16, 12, 12, 20, 12, 16, 24, 28, 12, 12, 32, 12, 36, 12,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 32, 32, 24, 40, 28, 12,
+	12, 48, 52, 52, 52, 48, 52, 52, 52, 48, 52, 52, 52, 52, 52, 48,
+	52, 52, 52, 52, 52, 48, 52, 52, 52, 52, 52, 24, 12, 28, 12, 12,
+	12, 56, 60, 60, 60, 56, 60, 60, 60, 56, 60, 60, 60, 60, 60, 56,
+	60, 60, 60, 60, 60, 56, 60, 60, 60, 60, 60, 24, 12, 28, 12, 0,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3
+};
+static const uint8_t brotli_utf8_lut1[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+	1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+	1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+
+/* Signed mode groups bytes by magnitude: 0, 1-15, 16-63, 64-127,
+ * 128-191, 192-239, 240-254 and 255 */
+static inline unsigned brotli_signed_class(unsigned b) {
+	return b == 0? 0: b < 16? 1: b < 64? 2: b < 128? 3: b < 192? 4: b < 240? 5: b < 255? 6: 7;
 }
 
-static size_t simple_decompress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len) {
-	if (input_len < 5 + 8 + 4) {
-		return 0;
+/* Per-mode tables indexed by [mode][p1] and [mode][256 + p2]; the
+ * context of a literal is the OR of both entries */
+static void brotli_context_lut_init(uint8_t lut[4][512]) {
+	for (unsigned b = 0; b < 256; b++) {
+		lut[BROTLI_MODE_LSB6][b] = (uint8_t)(b & 0x3f);
+		lut[BROTLI_MODE_LSB6][256 + b] = 0;
+		lut[BROTLI_MODE_MSB6][b] = (uint8_t)(b >> 2);
+		lut[BROTLI_MODE_MSB6][256 + b] = 0;
+		lut[BROTLI_MODE_UTF8][b] = brotli_utf8_lut0[b];
+		lut[BROTLI_MODE_UTF8][256 + b] = brotli_utf8_lut1[b];
+		lut[BROTLI_MODE_SIGNED][b] = (uint8_t)(brotli_signed_class (b) << 3);
+		lut[BROTLI_MODE_SIGNED][256 + b] = (uint8_t)brotli_signed_class (b);
 	}
-	if (memcmp (input, "BROT", 4) != 0) {
-		return 0;
-	}
-	/* Read fixed-width little-endian length and checksum */
-	uint64_t stored_len = otezip_read_le64 (input + 5);
-	if (stored_len > output_len) {
-		return 0;
-	}
-	if (input_len < 5 + 8 + 4 + stored_len) {
-		return 0;
-	}
-	uint32_t stored_crc = otezip_read_le32 (input + 5 + 8);
-	const uint8_t *data = input + 5 + 8 + 4;
-	uint32_t computed_crc = my_crc32 (data, stored_len, 0);
-	if (stored_crc != computed_crc) {
-		return 0;
-	}
-	memcpy (output, data, stored_len);
-	return stored_len;
 }
 
-int brotliInit(z_stream *strm, int level) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
-	}
-	brotli_encoder_state *state = (brotli_encoder_state *)malloc (sizeof (brotli_encoder_state));
-	if (!state) {
-		return Z_MEM_ERROR;
+/* Prefix codes are stored most significant bit first in a stream read
+ * from the least significant bit */
+static inline uint32_t brotli_reverse_bits(uint32_t v, unsigned nb) {
+	uint32_t r = 0;
+	while (nb--) {
+		r = (r << 1) | (v & 1);
+		v >>= 1;
 	}
-	state->quality = clamp_quality (level);
-	state->window_bits = 22;
-	state->crc32 = 0;
-	strm->state = (struct internal_state *)state;
-	strm->total_in = 0;
-	strm->total_out = 0;
-	return Z_OK;
+	return r;
 }
 
-int brotliCompress(z_stream *strm, int flush) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
-	}
-	if (flush == Z_FINISH) {
-		size_t compressed_size = simple_compress (
-			strm->next_in, strm->avail_in, strm->next_out, strm->avail_out);
-		if (compressed_size == 0) {
-			return Z_BUF_ERROR;
+/* ------------- Static dictionary ------------- */
+
+#include "brotli-dict.inc.c"
+
+/* log2 of the number of words of each length, and where they start */
+static const uint8_t brotli_dict_bits[25] = {
+	0, 0, 0, 0, 10, 10, 11, 11, 10, 10, 10, 10, 10, 9, 9, 8, 7, 7, 8, 7, 7, 6, 6, 5, 5
+};
+static const uint32_t brotli_dict_offset[25] = {
+	0, 0, 0, 0, 0, 4096, 9216, 21504, 35840, 44032, 53248, 63488, 74752, 87040, 93696, 100864,
+	104704, 106752, 108928, 113536, 115968, 118528, 119872, 121280, 122016
+};
+
+#define BROTLI_DICT_MIN_LEN 4
+#define BROTLI_DICT_MAX_LEN 24
+
+/* Word transforms: type 0 is the identity, 1-9 omit that many trailing
+ * bytes, 10 and 11 upper-case the first or every character and 12-20
+ * omit 1-9 leading bytes */
+#define BROTLI_TF_UPPER_FIRST 10
+#define BROTLI_TF_UPPER_ALL 11
+#define BROTLI_TF_OMIT_FIRST 11
+
+static const struct {
+	const char *prefix;
+	uint8_t type;
+	const char *suffix;
+} brotli_transforms[BROTLI_NUM_TRANSFORMS] = {
+	{ "", 0, "" }, { "", 0, " " }, { " ", 0, " " },
+	{ "", 12, "" }, { "", 10, " " }, { "", 0, " the " },
+	{ " ", 0, "" }, { "s ", 0, " " }, { "", 0, " of " },
+	{ "", 10, "" }, { "", 0, " and " }, { "", 13, "" },
+	{ "", 1, "" }, { ", ", 0, " " }, { "", 0, ", " },
+	{ " ", 10, " " }, { "", 0, " in " }, { "", 0, " to " },
+	{ "e ", 0, " " }, { "", 0, "\"" }, { "", 0, "." },
+	{ "", 0, "\">" }, { "", 0, "\n" }, { "", 3, "" },
+	{ "", 0, "]" }, { "", 0, " for " }, { "", 14, "" },
+	{ "", 2, "" }, { "", 0, " a " }, { "", 0, " that " },
+	{ " ", 10, "" }, { "", 0, ". " }, { ".", 0, "" },
+	{ " ", 0, ", " }, { "", 15, "" }, { "", 0, " with " },
+	{ "", 0, "'" }, { "", 0, " from " }, { "", 0, " by " },
+	{ "", 16, "" }, { "", 17, "" }, { " the ", 0, "" },
+	{ "", 4, "" }, { "", 0, ". The " }, { "", 11, "" },
+	{ "", 0, " on " }, { "", 0, " as " }, { "", 0, " is " },
+	{ "", 7, "" }, { "", 1, "ing " }, { "", 0, "\n\t" },
+	{ "", 0, ":" }, { " ", 0, ". " }, { "", 0, "ed " },
+	{ "", 20, "" }, { "", 18, "" }, { "", 6, "" },
+	{ "", 0, "(" }, { "", 10, ", " }, { "", 8, "" },
+	{ "", 0, " at " }, { "", 0, "ly " }, { " the ", 0, " of " },
+	{ "", 5, "" }, { "", 9, "" }, { " ", 10, ", " },
+	{ "", 10, "\"" }, { ".", 0, "(" }, { "", 11, " " },
+	{ "", 10, "\">" }, { "", 0, "=\"" }, { " ", 0, "." },
+	{ ".com/", 0, "" }, { " the ", 0, " of the " }, { "", 10, "'" },
+	{ "", 0, ". This " }, { "", 0, "," }, { ".", 0, " " },
+	{ "", 10, "(" }, { "", 10, "." }, { "", 0, " not " },
+	{ " ", 0, "=\"" }, { "", 0, "er " }, { " ", 11, " " },
+	{ "", 0, "al " }, { " ", 11, "" }, { "", 0, "='" },
+	{ "", 11, "\"" }, { "", 10, ". " }, { " ", 0, "(" },
+	{ "", 0, "ful " }, { " ", 10, ". " }, { "", 0, "ive " },
+	{ "", 0, "less " }, { "", 11, "'" }, { "", 0, "est " },
+	{ " ", 10, "." }, { "", 11, "\">" }, { " ", 0, "='" },
+	{ "", 10, "," }, { "", 0, "ize " }, { "", 11, "." },
+	{ "\302\240", 0, "" }, { " ", 0, "," }, { "", 10, "=\"" },
+	{ "", 11, "=\"" }, { "", 0, "ous " }, { "", 11, ", " },
+	{ "", 10, "='" }, { " ", 10, "," }, { " ", 11, "=\"" },
+	{ " ", 11, ", " }, { "", 11, "," }, { "", 11, "(" },
+	{ "", 11, ". " }, { " ", 11, "." }, { "", 11, "='" },
+	{ " ", 11, ". " }, { " ", 10, "=\"" }, { " ", 11, "='" },
+	{ " ", 10, "='" },
+};
+
+/* Upper-case the UTF-8 character at p the way RFC 7932 does; returns
+ * its length */
+static int brotli_to_upper(uint8_t *p, int n) {
+	if (p[0] < 0xc0) {
+		if (p[0] >= 'a' && p[0] <= 'z') {
+			p[0] ^= 32;
 		}
-		strm->next_in += (uint32_t)strm->avail_in;
-		strm->total_in += (uint32_t)strm->avail_in;
-		strm->avail_in = 0;
-		strm->next_out += (uint32_t)compressed_size;
-		strm->total_out += (uint32_t)compressed_size;
-		strm->avail_out -= (uint32_t)compressed_size;
-		return Z_STREAM_END;
+		return 1;
 	}
-	size_t copy_size = strm->avail_in < strm->avail_out? strm->avail_in: strm->avail_out;
-	if (copy_size > 0) {
-		memcpy (strm->next_out, strm->next_in, copy_size);
-		strm->next_in += (uint32_t)copy_size;
-		strm->next_out += (uint32_t)copy_size;
-		strm->avail_in -= (uint32_t)copy_size;
-		strm->avail_out -= (uint32_t)copy_size;
-		strm->total_in += (uint32_t)copy_size;
-		strm->total_out += (uint32_t)copy_size;
+	if (p[0] < 0xe0) {
+		if (n > 1) {
+			p[1] ^= 32;
+		}
+		return 2;
 	}
-	return Z_OK;
-}
-
-int brotliEnd(z_stream *strm) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+	if (n > 2) {
+		p[2] ^= 5;
 	}
-	free (strm->state);
-	strm->state = NULL;
-	return Z_OK;
+	return 3;
 }
 
-int brotliDecompressInit(z_stream *strm) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
-	}
-	brotli_decoder_state *state = (brotli_decoder_state *)malloc (sizeof (brotli_decoder_state));
-	if (!state) {
-		return Z_MEM_ERROR;
+/* Expand dictionary word idx of length len through transform tid into
+ * dst, which must hold BROTLI_MAX_WORD_OUT bytes; returns the length */
+static int brotli_transform_word(uint8_t *dst, unsigned len, uint32_t idx, unsigned tid) {
+	const uint8_t *word = (const uint8_t *)brotli_dict_data + brotli_dict_offset[len] + idx * len;
+	const char *prefix = brotli_transforms[tid].prefix;
+	const char *suffix = brotli_transforms[tid].suffix;
+	unsigned type = brotli_transforms[tid].type;
+	int n = 0;
+	while (*prefix) {
+		dst[n++] = (uint8_t)*prefix++;
 	}
-	state->crc32 = 0;
-	strm->state = (struct internal_state *)state;
-	strm->total_in = 0;
-	strm->total_out = 0;
-	return Z_OK;
-}
-
-int brotliDecompress(z_stream *strm, int flush) {
-	(void)flush;
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+	int skip = 0;
+	int wlen = (int)len;
+	if (type >= 1 && type <= 9) {
+		wlen -= (int)type;
+	} else if (type > BROTLI_TF_OMIT_FIRST) {
+		skip = (int)(type - BROTLI_TF_OMIT_FIRST);
+		wlen -= skip;
 	}
-	size_t decompressed_size = simple_decompress (
-		strm->next_in, strm->avail_in, strm->next_out, strm->avail_out);
-	if (decompressed_size == 0) {
-		if (strm->avail_in >= 5 + 8) {
-			uint64_t stored_len_tmp = otezip_read_le64 (strm->next_in + 5);
-			if (stored_len_tmp == 0) {
-				strm->next_in += strm->avail_in;
-				strm->total_in += strm->avail_in;
-				strm->avail_in = 0;
-				return Z_STREAM_END;
+	if (wlen > 0) {
+		memcpy (dst + n, word + skip, (size_t)wlen);
+		if (type == BROTLI_TF_UPPER_FIRST) {
+			brotli_to_upper (dst + n, wlen);
+		} else if (type == BROTLI_TF_UPPER_ALL) {
+			for (int i = 0; i < wlen;) {
+				i += brotli_to_upper (dst + n + i, wlen - i);
 			}
 		}
-		return Z_DATA_ERROR;
+		n += wlen;
 	}
-	strm->next_in += (uint32_t)strm->avail_in;
-	strm->total_in += (uint32_t)strm->avail_in;
-	strm->avail_in = 0;
-	strm->next_out += (uint32_t)decompressed_size;
-	strm->total_out += (uint32_t)decompressed_size;
-	strm->avail_out -= (uint32_t)decompressed_size;
-	return Z_STREAM_END;
-}
-
-int brotliDecompressEnd(z_stream *strm) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+	while (*suffix) {
+		dst[n++] = (uint8_t)*suffix++;
 	}
-	free (strm->state);
-	strm->state = NULL;
-	return Z_OK;
-}
-
-int brotliCompressInit2(z_stream *strm, int level, int windowBits, int memLevel, int strategy) {
-	(void)windowBits;
-	(void)memLevel;
-	(void)strategy;
-	return brotliInit (strm, level);
+	return n;
 }
 
-int brotliCompressInit2_(z_stream *strm, int level, int windowBits, int memLevel, int strategy, const char *version, int stream_size) {
-	(void)version;
-	(void)stream_size;
-	return brotliCompressInit2 (strm, level, windowBits, memLevel, strategy);
-}
-
-int brotliDecompressInit2(z_stream *strm, int windowBits) {
-	(void)windowBits;
-	return brotliDecompressInit (strm);
-}
-
-int brotliDecompressInit2_(z_stream *strm, int windowBits, const char *version, int stream_size) {
-	(void)windowBits;
-	(void)version;
-	(void)stream_size;
-	return brotliDecompressInit (strm);
-}
+/* Include encoder and decoder implementations */
+#include "brotli-enc.inc.c"
+#include "brotli-dec.inc.c"
 
 #endif /* OTEZIP_ENABLE_BROTLI */
 
-#endif /* MBROTLI_H */
+#endif /* OBROTLI_H */
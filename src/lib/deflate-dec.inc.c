@@ -1,32 +1,74 @@
 /* ----------- Decoder-specific data structures ----------- */
 
-/* Wrapper format types */
+/* Decoder lookup tables.
+ * Every slot is a packed 32-bit entry: the low nibble holds the number of
+ * bits to consume, the next nibble the number of extra bits that follow the
+ * code (or the index width of a sub-table), bits 8..10 the entry type and
+ * the upper 16 bits the value (literal byte, length/distance base, code
+ * length symbol or sub-table offset). The primary table is indexed by the
+ * next INF_*_BITS input bits; longer codes go through one sub-table hop. */
+#define INF_LITLEN_BITS 10
+#define INF_DIST_BITS 8
+#define INF_CLEN_BITS 7
+/* Worst case sub-table space for complete codes with 288/32 symbols */
+#define INF_LITLEN_ENOUGH ((1 << INF_LITLEN_BITS) + 1536)
+#define INF_DIST_ENOUGH ((1 << INF_DIST_BITS) + 512)
+#define INF_CLEN_ENOUGH (1 << INF_CLEN_BITS)
+
+#define INF_T_LIT 0 /* literal byte */
+#define INF_T_LEN 1 /* match length base */
+#define INF_T_EOB 2 /* end of block */
+#define INF_T_SUB 3 /* link to sub-table */
+#define INF_T_BAD 4 /* invalid code */
+#define INF_T_DIST 5 /* distance base */
+#define INF_T_CLEN 6 /* code length alphabet symbol */
+
+#define INF_ENTRY(val, type, extra, len) (((uint32_t)(val) << 16) | ((uint32_t)(type) << 8) | ((uint32_t)(extra) << 4) | (uint32_t)(len))
+#define INF_E_LEN(e) ((e) & 0x0F)
+#define INF_E_EXTRA(e) (((e) >> 4) & 0x0F)
+#define INF_E_TYPE(e) (((e) >> 8) & 0x07)
+#define INF_E_VAL(e) ((e) >> 16)
+
+/* Decoder states */
 typedef enum {
-	WRAP_NONE = 0, /* Raw deflate */
-	WRAP_ZLIB = 1, /* zlib header */
-	WRAP_GZIP = 2, /* gzip header */
-	WRAP_AUTO = 3 /* Auto-detect zlib or gzip */
-} wrap_format;
+	INF_HEADER = 0, /* Block header (BFINAL + BTYPE) */
+	INF_STORED, /* Stored block LEN/NLEN */
+	INF_STORED_COPY, /* Copying stored block payload */
+	INF_TABLE, /* Dynamic Huffman table header */
+	INF_CODES, /* Decoding literal/length/distance symbols */
+	INF_DONE /* Final block finished */
+} inflate_mode;
 
 /* Internal state for inflate */
 typedef struct {
 	/* Input state */
-	uint32_t bit_buffer; /* Bit buffer */
-	uint32_t bits_in_buffer; /* Number of bits in buffer */
+	uint64_t bit_buffer; /* Bit buffer (LSB first) */
+	uint32_t bits_in_buffer; /* Number of valid bits in buffer */
 	int final_block; /* Is this the final block? */
 
-	/* Huffman tables */
-	huffman_table literals; /* Literal/length codes */
-	huffman_table distances; /* Distance codes */
+	/* Huffman decode tables */
+	uint32_t litlen[INF_LITLEN_ENOUGH]; /* Literal/length codes */
+	uint32_t dist[INF_DIST_ENOUGH]; /* Distance codes */
+	int tables_fixed; /* Tables currently hold the fixed codes */
 
 	/* Current state */
-	int state; /* Current state of processing */
+	inflate_mode state; /* Current state of processing */
 	block_type btype; /* Current block type */
+	uint32_t stored_left; /* Bytes left in current stored block */
+
+	/* Dynamic table header parsing (resumable) */
+	int hdr_stage; /* 0=counts, 1=code length lengths, 2=lengths */
+	int hlit, hdist, hclen; /* Counts from the dynamic header */
+	int hdr_index; /* Next length to read */
+	uint8_t hdr_lens[286 + 32]; /* Literal/length + distance code lengths */
+	uint32_t clen[INF_CLEN_ENOUGH]; /* Code length alphabet table */
 
 	/* Output state */
 	uint8_t *window; /* Sliding window for LZ77 */
 	uint32_t window_size; /* Size of window */
 	uint32_t window_pos; /* Current position in window */
+	uint32_t window_have; /* Valid bytes in window (<= window_size) */
+	uint8_t *out_base; /* next_out when this inflate() call started */
 
 	/* Wrapper handling */
 	wrap_format wrap; /* Wrapper format */
@@ -36,316 +78,399 @@ typedef struct {
 	int pending_copy; /* Non-zero if there's a pending copy operation */
 	int pending_length; /* Remaining bytes to copy */
 	int pending_distance; /* Distance for the copy */
-	int pending_literal; /* Pending literal byte (-1 if none) */
 } inflate_state;
 
-/* Get a bit from the input stream */
+/* ----------- Bit input ----------- */
 
-static int get_bit(z_stream *strm, inflate_state *state) {
-	if (state->bits_in_buffer == 0) {
-		/* Need to load a new byte */
-		if (strm->avail_in == 0) {
-			return -1; /* No more input */
-		}
+static inline uint64_t inf_load_le64(const uint8_t *p) {
+	return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+		((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
 
-		state->bit_buffer = *strm->next_in++;
+/* Top up the bit buffer to at least 56 bits when input allows.
+ * With 8+ input bytes a single unaligned 64-bit load is used; the bits above
+ * bits_in_buffer then mirror the upcoming input, which is harmless because
+ * the next refill ORs in the very same bits. */
+static inline void inf_refill(z_stream *strm, inflate_state *state) {
+	if (strm->avail_in >= 8) {
+		uint32_t n = (63 - state->bits_in_buffer) >> 3;
+		state->bit_buffer |= inf_load_le64 (strm->next_in) << state->bits_in_buffer;
+		strm->next_in += n;
+		strm->avail_in -= n;
+		strm->total_in += n;
+		state->bits_in_buffer += n << 3;
+		return;
+	}
+	state->bit_buffer &= (1ULL << state->bits_in_buffer) - 1;
+	while (state->bits_in_buffer < 56 && strm->avail_in > 0) {
+		state->bit_buffer |= (uint64_t)*strm->next_in++ << state->bits_in_buffer;
 		strm->avail_in--;
 		strm->total_in++;
-		state->bits_in_buffer = 8;
+		state->bits_in_buffer += 8;
+	}
+}
+
+/* Make sure n (<= 56) bits are buffered; returns 0 when input is exhausted */
+static inline int inf_need(z_stream *strm, inflate_state *state, uint32_t n) {
+	if (state->bits_in_buffer < n) {
+		inf_refill (strm, state);
 	}
+	return state->bits_in_buffer >= n;
+}
+
+static inline uint32_t inf_peek(const inflate_state *state, uint32_t n) {
+	return (uint32_t)(state->bit_buffer & ((1ULL << n) - 1));
+}
 
-	int bit = state->bit_buffer & 1;
-	state->bit_buffer >>= 1;
-	state->bits_in_buffer--;
-	return bit;
+static inline void inf_drop(inflate_state *state, uint32_t n) {
+	state->bit_buffer >>= n;
+	state->bits_in_buffer -= n;
 }
 
-/* Get n bits from the input stream (right-aligned) */
-static int get_bits(z_stream *strm, inflate_state *state, int n) {
-	/* Fast path: if we have enough bits in buffer, use them directly */
-	if (state->bits_in_buffer >= (uint32_t)n) {
-		int result = state->bit_buffer &((1 << n) - 1);
-		state->bit_buffer >>= n;
-		state->bits_in_buffer -= (uint32_t)n;
-		return result;
+/* Resolve the table entry for the next code without consuming it.
+ * *total receives the full code length (primary + sub-table bits). */
+static inline uint32_t inf_lookup(const uint32_t *table, int root_bits, uint64_t bits, uint32_t *total) {
+	uint32_t e = table[bits & ((1u << root_bits) - 1)];
+	if (INF_E_TYPE (e) == INF_T_SUB) {
+		uint32_t sub = (uint32_t)(bits >> root_bits) & ((1u << INF_E_EXTRA (e)) - 1);
+		e = table[INF_E_VAL (e) + sub];
+		*total = (uint32_t)root_bits + INF_E_LEN (e);
+		return e;
 	}
+	*total = INF_E_LEN (e);
+	return e;
+}
 
-	/* Slow path: need to get more bits from input */
-	int result = 0;
-	for (int i = 0; i < n; i++) {
-		int bit = get_bit (strm, state);
-		if (bit < 0) {
-			return -1; /* Error - not enough input */
+/* ----------- Table construction ----------- */
+
+/* Reverse the low n bits of code (deflate sends Huffman codes MSB first) */
+static inline uint32_t inf_reverse(uint32_t code, int n) {
+	uint32_t r = 0;
+	while (n-- > 0) {
+		r = (r << 1) | (code & 1);
+		code >>= 1;
+	}
+	return r;
+}
+
+/* Map an alphabet symbol to its packed table entry (without length). */
+static uint32_t inf_symbol_entry(int kind, int sym) {
+	switch (kind) {
+	case INF_T_LIT:
+		if (sym < 256) {
+			return INF_ENTRY (sym, INF_T_LIT, 0, 0);
+		}
+		if (sym == 256) {
+			return INF_ENTRY (0, INF_T_EOB, 0, 0);
+		}
+		if (sym <= 285) {
+			return INF_ENTRY (deflate_length_base[sym - 257], INF_T_LEN, deflate_length_extra[sym - 257], 0);
+		}
+		return INF_ENTRY (0, INF_T_BAD, 0, 0);
+	case INF_T_DIST:
+		if (sym < 30) {
+			return INF_ENTRY (deflate_dist_base[sym], INF_T_DIST, deflate_dist_extra[sym], 0);
 		}
-		result |= (bit << i);
+		return INF_ENTRY (0, INF_T_BAD, 0, 0);
+	default:
+		return INF_ENTRY (sym, INF_T_CLEN, 0, 0);
 	}
-	return result;
 }
 
-/* Build Huffman tree from code lengths */
-static int build_huffman_tree(huffman_table *table, const uint8_t *lengths, int num_codes) {
-	/* Count the number of codes for each code length */
+/* Build a lookup table (primary + sub-tables) from code lengths.
+ * kind selects the alphabet (INF_T_LIT, INF_T_DIST or INF_T_CLEN). Incomplete
+ * codes are accepted (unused slots decode as INF_T_BAD); over-subscribed
+ * codes are rejected. */
+static int build_huffman_tree(uint32_t *table, int root_bits, int capacity, const uint8_t *lengths, int num_codes, int kind) {
 	uint16_t bl_count[16] = { 0 };
+	uint16_t offs[16];
+	uint16_t sorted[288];
 	int max_length = 0;
+
 	for (int i = 0; i < num_codes; i++) {
 		if (lengths[i] > 15) {
 			return Z_DATA_ERROR; /* Invalid code length */
 		}
-		if (lengths[i] > 0) {
-			bl_count[lengths[i]]++;
-			max_length = lengths[i] > max_length? lengths[i]: max_length;
+		bl_count[lengths[i]]++;
+		if (lengths[i] > max_length) {
+			max_length = lengths[i];
+		}
+	}
+
+	/* Reject over-subscribed codes */
+	int left = 1;
+	for (int len = 1; len <= 15; len++) {
+		left <<= 1;
+		left -= bl_count[len];
+		if (left < 0) {
+			return Z_DATA_ERROR;
 		}
 	}
 
-	/* Find the numerical value of the smallest code for each code length */
-	uint16_t next_code[16] = { 0 };
-	uint16_t code = 0;
-	for (int bits = 1; bits <= 15; bits++) {
-		code = (code + bl_count[bits - 1]) << 1;
-		next_code[bits] = code;
+	int root_size = 1 << root_bits;
+	for (int i = 0; i < root_size; i++) {
+		table[i] = INF_ENTRY (0, INF_T_BAD, 0, root_bits);
+	}
+	if (max_length == 0) {
+		return Z_OK; /* No codes at all (e.g. no distance codes used) */
 	}
 
-	/* Assign codes to symbols */
+	/* Sort symbols by code length, then by symbol value */
+	offs[1] = 0;
+	for (int len = 1; len < 15; len++) {
+		offs[len + 1] = offs[len] + bl_count[len];
+	}
 	for (int i = 0; i < num_codes; i++) {
-		if (lengths[i] > 0) {
-			table->codes[i] = next_code[lengths[i]]++;
-			table->lengths[i] = lengths[i];
-		} else {
-			table->lengths[i] = 0;
+		if (lengths[i]) {
+			sorted[offs[lengths[i]]++] = (uint16_t)i;
 		}
 	}
-	table->count = num_codes;
+	int n = offs[15];
+
+	/* Canonical codes in sorted order are increasing when left-aligned, so
+	 * all codes sharing a primary prefix are contiguous. */
+	uint32_t codes[288];
+	uint32_t code = 0;
+	int prev_len = lengths[sorted[0]];
+	for (int i = 0; i < n; i++) {
+		int len = lengths[sorted[i]];
+		code <<= (len - prev_len);
+		prev_len = len;
+		codes[i] = code++;
+	}
+
+	int next_sub = root_size;
+	int i = 0;
+	while (i < n) {
+		int sym = sorted[i];
+		int len = lengths[sym];
+		if (len <= root_bits) {
+			uint32_t e = inf_symbol_entry (kind, sym) | (uint32_t)len;
+			uint32_t idx = inf_reverse (codes[i], len);
+			for (uint32_t k = idx; k < (uint32_t)root_size; k += 1u << len) {
+				table[k] = e;
+			}
+			i++;
+			continue;
+		}
+		/* Group all codes sharing this root prefix into one sub-table */
+		uint32_t prefix = codes[i] >> (len - root_bits);
+		int j = i;
+		while (j < n && (codes[j] >> (lengths[sorted[j]] - root_bits)) == prefix) {
+			j++;
+		}
+		int sub_bits = lengths[sorted[j - 1]] - root_bits;
+		int sub_size = 1 << sub_bits;
+		if (next_sub + sub_size > capacity) {
+			return Z_DATA_ERROR;
+		}
+		for (int k = 0; k < sub_size; k++) {
+			table[next_sub + k] = INF_ENTRY (0, INF_T_BAD, 0, sub_bits);
+		}
+		table[inf_reverse (prefix, root_bits)] = INF_ENTRY (next_sub, INF_T_SUB, sub_bits, root_bits);
+		for (; i < j; i++) {
+			int s = sorted[i];
+			int rem = lengths[s] - root_bits;
+			uint32_t e = inf_symbol_entry (kind, s) | (uint32_t)rem;
+			uint32_t idx = inf_reverse (codes[i] & ((1u << rem) - 1), rem);
+			for (uint32_t k = idx; k < (uint32_t)sub_size; k += 1u << rem) {
+				table[next_sub + k] = e;
+			}
+		}
+		next_sub += sub_size;
+	}
 	return Z_OK;
 }
 
-/* Read dynamic Huffman tables */
-static int read_dynamic_huffman(z_stream *strm, inflate_state *state) {
-	/* Read number of literal/length codes */
-	int hlit = get_bits (strm, state, 5);
-	if (hlit < 0) {
-		return Z_DATA_ERROR;
+/* Initialize fixed Huffman tables (RFC 1951 section 3.2.6) */
+static void init_fixed_huffman(inflate_state *state) {
+	if (state->tables_fixed) {
+		return; /* Already built for a previous fixed block */
 	}
-	hlit += 257; /* 257-286 codes */
-
-	/* Read number of distance codes */
-	int hdist = get_bits (strm, state, 5);
-	if (hdist < 0) {
-		return Z_DATA_ERROR;
+	uint8_t lengths[288];
+	for (int i = 0; i <= 143; i++) {
+		lengths[i] = 8;
+	}
+	for (int i = 144; i <= 255; i++) {
+		lengths[i] = 9;
+	}
+	for (int i = 256; i <= 279; i++) {
+		lengths[i] = 7;
+	}
+	for (int i = 280; i <= 287; i++) {
+		lengths[i] = 8;
 	}
-	hdist += 1; /* 1-32 codes */
+	build_huffman_tree (state->litlen, INF_LITLEN_BITS, INF_LITLEN_ENOUGH, lengths, 288, INF_T_LIT);
 
-	/* Read number of code length codes */
-	int hclen = get_bits (strm, state, 4);
-	if (hclen < 0) {
-		return Z_DATA_ERROR;
+	uint8_t dist_lengths[32];
+	for (int i = 0; i < 32; i++) {
+		dist_lengths[i] = 5;
 	}
-	hclen += 4; /* 4-19 codes */
+	build_huffman_tree (state->dist, INF_DIST_BITS, INF_DIST_ENOUGH, dist_lengths, 32, INF_T_DIST);
+	state->tables_fixed = 1;
+}
 
-	/* Read code lengths for code length alphabet */
-	uint8_t cl_lengths[19] = { 0 };
+/* Read dynamic Huffman tables. Resumable: returns Z_BUF_ERROR when input
+ * runs out, keeping partial progress in the state. */
+static int read_dynamic_huffman(z_stream *strm, inflate_state *state) {
 	static const uint8_t cl_order[19] = {
 		16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
 	};
 
-	for (int i = 0; i < hclen; i++) {
-		int len = get_bits (strm, state, 3);
-		if (len < 0) {
+	if (state->hdr_stage == 0) {
+		if (!inf_need (strm, state, 14)) {
+			return Z_BUF_ERROR;
+		}
+		state->hlit = (int)inf_peek (state, 5) + 257; /* 257-288 codes */
+		state->hdist = (int)((state->bit_buffer >> 5) & 0x1F) + 1; /* 1-32 codes */
+		state->hclen = (int)((state->bit_buffer >> 10) & 0x0F) + 4; /* 4-19 codes */
+		inf_drop (state, 14);
+		if (state->hlit > 286 || state->hdist > 30) {
 			return Z_DATA_ERROR;
 		}
-		cl_lengths[cl_order[i]] = len;
-	}
-
-	/* Build code lengths Huffman tree */
-	huffman_table cl_table;
-	if (build_huffman_tree (&cl_table, cl_lengths, 19) != Z_OK) {
-		return Z_DATA_ERROR;
+		memset (state->hdr_lens, 0, sizeof (state->hdr_lens));
+		state->hdr_index = 0;
+		state->hdr_stage = 1;
 	}
 
-	/* Read literal/length and distance code lengths */
-#define LL_LENGTHS_MAX (286 + 32)
-	uint8_t ll_lengths[LL_LENGTHS_MAX] = { 0 }; /* Literal/length + distance code lengths */
-	int index = 0;
-	while (index < hlit + hdist && index < LL_LENGTHS_MAX) {
-		/* Decode code length */
-		int code = 0;
-		int len = 0;
-
-		/* Decode Huffman code */
-		for (len = 1; len <= 15; len++) {
-			int bit = get_bit (strm, state);
-			if (bit < 0) {
-				return Z_DATA_ERROR;
-			}
-			code = (code << 1) | bit;
-
-			/* Check if this code matches */
-			int found = -1;
-			for (int i = 0; i < 19; i++) {
-				if (cl_table.lengths[i] == len && cl_table.codes[i] == code) {
-					found = i;
-					break;
-				}
-			}
-			if (found >= 0) {
-				code = found;
-				break;
+	if (state->hdr_stage == 1) {
+		/* Code lengths for the code length alphabet, 3 bits each */
+		while (state->hdr_index < state->hclen) {
+			if (!inf_need (strm, state, 3)) {
+				return Z_BUF_ERROR;
 			}
+			state->hdr_lens[cl_order[state->hdr_index++]] = (uint8_t)inf_peek (state, 3);
+			inf_drop (state, 3);
 		}
-
-		if (len > 15) {
-			return Z_DATA_ERROR; /* Invalid Huffman code */
+		uint8_t cl_lengths[19];
+		memcpy (cl_lengths, state->hdr_lens, sizeof (cl_lengths));
+		if (build_huffman_tree (state->clen, INF_CLEN_BITS, INF_CLEN_ENOUGH, cl_lengths, 19, INF_T_CLEN) != Z_OK) {
+			return Z_DATA_ERROR;
 		}
+		memset (state->hdr_lens, 0, sizeof (state->hdr_lens));
+		state->hdr_index = 0;
+		state->hdr_stage = 2;
+	}
 
-		/* Process code */
-		if (code < 16) {
-			/* Literal code length */
-			ll_lengths[index++] = code;
-		} else {
-			/* Repeat code */
-			uint8_t repeat_value;
-			int repeat_count;
-
-			switch (code) {
-			case 16: /* Repeat previous code length 3-6 times */
-				if (index == 0) {
-					return Z_DATA_ERROR; /* No previous code */
-				}
-				repeat_value = ll_lengths[index - 1];
-				repeat_count = get_bits (strm, state, 2);
-				if (repeat_count < 0) {
-					return Z_DATA_ERROR;
-				}
-				repeat_count += 3;
-				break;
-
-			case 17: /* Repeat zero 3-10 times */
-				repeat_value = 0;
-				repeat_count = get_bits (strm, state, 3);
-				if (repeat_count < 0) {
-					return Z_DATA_ERROR;
-				}
-				repeat_count += 3;
-				break;
-
-			case 18: /* Repeat zero 11-138 times */
-				repeat_value = 0;
-				repeat_count = get_bits (strm, state, 7);
-				if (repeat_count < 0) {
-					return Z_DATA_ERROR;
-				}
-				repeat_count += 11;
-				break;
-
-			default:
-				return Z_DATA_ERROR; /* Should never happen */
+	/* Literal/length and distance code lengths */
+	int total = state->hlit + state->hdist;
+	while (state->hdr_index < total) {
+		/* Longest item: 7-bit code plus 7 extra bits */
+		inf_need (strm, state, 14);
+		uint32_t used;
+		uint32_t e = inf_lookup (state->clen, INF_CLEN_BITS, state->bit_buffer, &used);
+		if (INF_E_TYPE (e) != INF_T_CLEN) {
+			if (used <= state->bits_in_buffer) {
+				return Z_DATA_ERROR; /* Invalid Huffman code */
 			}
-
-			/* Check for index overflow */
-			if (index + repeat_count > hlit + hdist || index + repeat_count > LL_LENGTHS_MAX) {
-				return Z_DATA_ERROR;
+			return Z_BUF_ERROR;
+		}
+		int sym = (int)INF_E_VAL (e);
+		if (sym < 16) {
+			if (used > state->bits_in_buffer) {
+				return Z_BUF_ERROR;
 			}
-
-			/* Fill repeated values */
-			for (int i = 0; i < repeat_count; i++) {
-				ll_lengths[index++] = repeat_value;
+			inf_drop (state, used);
+			state->hdr_lens[state->hdr_index++] = (uint8_t)sym;
+			continue;
+		}
+		/* Repeat codes */
+		uint32_t extra = sym == 16? 2: sym == 17? 3: 7;
+		if (used + extra > state->bits_in_buffer) {
+			return Z_BUF_ERROR;
+		}
+		inf_drop (state, used);
+		int repeat = (int)inf_peek (state, extra);
+		inf_drop (state, extra);
+		uint8_t value = 0;
+		if (sym == 16) {
+			if (state->hdr_index == 0) {
+				return Z_DATA_ERROR; /* No previous code */
 			}
+			value = state->hdr_lens[state->hdr_index - 1];
+			repeat += 3;
+		} else if (sym == 17) {
+			repeat += 3;
+		} else {
+			repeat += 11;
+		}
+		if (state->hdr_index + repeat > total) {
+			return Z_DATA_ERROR;
 		}
+		memset (state->hdr_lens + state->hdr_index, value, (size_t)repeat);
+		state->hdr_index += repeat;
 	}
 
-	/* Build literal/length Huffman tree */
-	if (build_huffman_tree (&state->literals, ll_lengths, hlit) != Z_OK) {
+	/* End-of-block code must be present */
+	if (state->hdr_lens[256] == 0) {
 		return Z_DATA_ERROR;
 	}
-
-	/* Build distance Huffman tree */
-	if (build_huffman_tree (&state->distances, ll_lengths + hlit, hdist) != Z_OK) {
+	if (build_huffman_tree (state->litlen, INF_LITLEN_BITS, INF_LITLEN_ENOUGH, state->hdr_lens, state->hlit, INF_T_LIT) != Z_OK) {
 		return Z_DATA_ERROR;
 	}
-
+	if (build_huffman_tree (state->dist, INF_DIST_BITS, INF_DIST_ENOUGH, state->hdr_lens + state->hlit, state->hdist, INF_T_DIST) != Z_OK) {
+		return Z_DATA_ERROR;
+	}
+	state->tables_fixed = 0;
+	state->hdr_stage = 0;
 	return Z_OK;
 }
 
-/* Read an uncompressed block */
-static int read_uncompressed_block(z_stream *strm, inflate_state *state) {
-	/* Skip any remaining bits in current byte */
-	state->bits_in_buffer = 0;
-
-	/* Read length and negated length */
-	if (strm->avail_in < 4) {
-		return Z_DATA_ERROR; /* Not enough input */
+/* Append bytes to the circular window */
+static void inf_window_put(inflate_state *state, const uint8_t *src, size_t len) {
+	if (len >= state->window_size) {
+		src += len - state->window_size;
+		len = state->window_size;
 	}
-
-	uint16_t len = strm->next_in[0] | (strm->next_in[1] << 8);
-	uint16_t nlen = strm->next_in[2] | (strm->next_in[3] << 8);
-
-	strm->next_in += 4;
-	strm->avail_in -= 4;
-	strm->total_in += 4;
-
-	/* Verify length */
-	/* Compare length with bitwise complement of nlen while avoiding
-	 * signed/unsigned promotion warnings by casting nlen to uint16_t
-	 * before applying ~. */
-	if (len != (uint16_t) (~ (uint16_t)nlen)) {
-		return Z_DATA_ERROR; /* Length check failed */
-	}
-
-	/* Check if we have enough input */
-	if (strm->avail_in < len) {
-		return Z_DATA_ERROR; /* Not enough input */
-	}
-
-	/* Check if we have enough output space */
-	if (strm->avail_out < len) {
-		return Z_BUF_ERROR; /* Not enough output space */
+	uint32_t space = state->window_size - state->window_pos;
+	if (len <= space) {
+		memcpy (state->window + state->window_pos, src, len);
+	} else {
+		memcpy (state->window + state->window_pos, src, space);
+		memcpy (state->window, src + space, len - space);
 	}
-
-	/* Copy data directly to output */
-	memcpy (strm->next_out, strm->next_in, len);
-	strm->next_in += len;
-	strm->avail_in -= len;
-	strm->total_in += len;
-	strm->next_out += len;
-	strm->avail_out -= len;
-	strm->total_out += len;
-
-	/* Also store in window */
-	for (uint16_t i = 0; i < len; i++) {
-		state->window[state->window_pos] = strm->next_out[- (len - i)];
-		state->window_pos = (state->window_pos + 1) &(state->window_size - 1);
+	state->window_pos = (uint32_t)((state->window_pos + len) & (state->window_size - 1));
+	state->window_have += (uint32_t)len;
+	if (state->window_have > state->window_size) {
+		state->window_have = state->window_size;
 	}
-
-	return Z_OK;
 }
 
-/* Initialize fixed Huffman tables with correct canonical codes */
-static void init_fixed_huffman(inflate_state *state) {
-	/* Fixed literal/length code lengths as per deflate spec:
-	 * 0-143: 8 bits, 144-255: 9 bits, 256-279: 7 bits, 280-287: 8 bits
-	 */
-	uint8_t lengths[288];
-	for (int i = 0; i <= 143; i++) {
-		lengths[i] = 8;
+/* Stored block payload: drain whole bytes left in the bit buffer first,
+ * then copy straight from next_in. Like every decoded byte it only lands
+ * in next_out; inflate() saves the window when it returns. */
+static void read_uncompressed_block(z_stream *strm, inflate_state *state) {
+	while (state->stored_left > 0 && state->bits_in_buffer >= 8 && strm->avail_out > 0) {
+		uint8_t byte = (uint8_t)state->bit_buffer;
+		inf_drop (state, 8);
+		*strm->next_out++ = byte;
+		strm->avail_out--;
+		strm->total_out++;
+		state->stored_left--;
 	}
-	for (int i = 144; i <= 255; i++) {
-		lengths[i] = 9;
+	if (state->bits_in_buffer >= 8) {
+		return; /* Output full while draining */
 	}
-	for (int i = 256; i <= 279; i++) {
-		lengths[i] = 7;
+	/* Remaining (non-byte) bits are garbage above the stream position */
+	state->bit_buffer = 0;
+	state->bits_in_buffer = 0;
+	uint32_t n = state->stored_left;
+	if (n > strm->avail_in) {
+		n = strm->avail_in;
 	}
-	for (int i = 280; i <= 287; i++) {
-		lengths[i] = 8;
+	if (n > strm->avail_out) {
+		n = strm->avail_out;
 	}
-
-	/* Build the Huffman table using canonical code assignment */
-	build_huffman_tree (&state->literals, lengths, 288);
-
-	/* Fixed distance code lengths: all 5 bits */
-	uint8_t dist_lengths[32];
-	for (int i = 0; i < 32; i++) {
-		dist_lengths[i] = 5;
+	if (n > 0) {
+		memcpy (strm->next_out, strm->next_in, n);
+		strm->next_in += n;
+		strm->avail_in -= n;
+		strm->total_in += n;
+		strm->next_out += n;
+		strm->avail_out -= n;
+		strm->total_out += n;
+		state->stored_left -= n;
 	}
-	build_huffman_tree (&state->distances, dist_lengths, 32);
 }
 
 /* ----------- Main decoder API functions ----------- */
@@ -475,13 +600,10 @@ int inflateInit2(z_stream *strm, int windowBits) {
 		wrap = WRAP_ZLIB;
 		actual_bits = windowBits;
 	}
-	if (actual_bits < 8) {
-		actual_bits = 8;
-	}
-	if (actual_bits > 15) {
-		actual_bits = 15;
-	}
-	int window_size = 1 << actual_bits;
+	/* Always keep a full 32K window: streams may reference up to 32K back
+	 * regardless of the size advertised by the caller. */
+	(void)actual_bits;
+	int window_size = 1 << 15;
 
 	/* Allocate state */
 	inflate_state *state = (inflate_state *)calloc (1, sizeof (inflate_state));
@@ -498,17 +620,8 @@ int inflateInit2(z_stream *strm, int windowBits) {
 
 	/* Initialize state */
 	state->window_size = window_size;
-	state->window_pos = 0;
-	state->bit_buffer = 0;
-	state->bits_in_buffer = 0;
-	state->final_block = 0;
-	state->state = 0; /* Start at block header */
+	state->state = INF_HEADER;
 	state->wrap = wrap;
-	state->header_done = 0;
-	state->pending_copy = 0;
-	state->pending_length = 0;
-	state->pending_distance = 0;
-	state->pending_literal = -1;
 
 	strm->state = state;
 	strm->total_in = 0;
@@ -517,39 +630,224 @@ int inflateInit2(z_stream *strm, int windowBits) {
 	return Z_OK;
 }
 
-/* Helper to copy bytes from sliding window - handles partial copies */
-static int do_copy_from_window(z_stream *strm, inflate_state *state, int length, int distance) {
-	/* Copy as many bytes as we can */
-	while (length > 0 && strm->avail_out > 0) {
-		uint8_t byte = state->window[(state->window_pos - distance) &(state->window_size - 1)];
-		*strm->next_out++ = byte;
-		strm->avail_out--;
-		strm->total_out++;
+/* Bytes a match may reach back: the window saved by earlier calls plus
+ * everything this call has written to next_out */
+static inline size_t inf_history(const z_stream *strm, const inflate_state *state) {
+	return state->window_have + (size_t)(strm->next_out - state->out_base);
+}
 
-		/* Add to window */
-		state->window[state->window_pos] = byte;
-		state->window_pos = (state->window_pos + 1) &(state->window_size - 1);
-		length--;
+/* Copy a match to next_out, keeping what does not fit as a pending copy.
+ * Output of the current call is read back in place with 16/8-byte moves;
+ * only the part reaching before the call comes from the window. */
+static void inf_copy_match(z_stream *strm, inflate_state *state, uint32_t length, uint32_t distance) {
+	uint8_t *out = strm->next_out;
+	uint32_t n = length < strm->avail_out? length: strm->avail_out;
+	uint32_t left = n;
+	size_t produced = (size_t)(out - state->out_base);
+	if (distance > produced) {
+		uint32_t back = distance - (uint32_t)produced;
+		uint32_t k = back < left? back: left;
+		uint32_t from = (state->window_pos - back) & (state->window_size - 1);
+		uint32_t first = state->window_size - from;
+		if (first > k) {
+			first = k;
+		}
+		memcpy (out, state->window + from, first);
+		memcpy (out + first, state->window, k - first);
+		out += k;
+		left -= k;
 	}
-
-	if (length > 0) {
-		/* Couldn't complete the copy - save state */
-		state->pending_copy = 1;
-		state->pending_length = length;
-		state->pending_distance = distance;
-		return Z_OK; /* Need more output space, not an error */
+	/* Short distances repeat a pattern: each copy of it doubles the span
+	 * that can be copied at once, until wide moves cannot overlap */
+	uint32_t d = distance;
+	while (d < 8 && left > 0) {
+		uint32_t k = d < left? d: left;
+		memcpy (out, out - d, k);
+		out += k;
+		left -= k;
+		d *= 2;
 	}
+	const uint8_t *src = out - d;
+	while (left >= 16 && d >= 16) {
+		memcpy (out, src, 16);
+		out += 16;
+		src += 16;
+		left -= 16;
+	}
+	while (left >= 8) {
+		memcpy (out, src, 8);
+		out += 8;
+		src += 8;
+		left -= 8;
+	}
+	while (left > 0) {
+		*out++ = *src++;
+		left--;
+	}
+	strm->next_out = out;
+	strm->avail_out -= n;
+	strm->total_out += n;
 
-	state->pending_copy = 0;
+	state->pending_copy = length > n;
+	state->pending_length = (int)(length - n);
+	state->pending_distance = (int)distance;
+}
+
+/* Fast decode loop: every iteration has at least 56 buffered bits (enough
+ * for the longest length+distance pair) and 258 bytes of output space, so
+ * no per-symbol bounds or resumption checks are needed.
+ * Returns Z_OK to fall back to the careful loop, Z_STREAM_END at end of
+ * block (state updated), or Z_DATA_ERROR. */
+static int inflate_fast(z_stream *strm, inflate_state *state) {
+	while (strm->avail_in >= 8 && strm->avail_out >= 258) {
+		inf_refill (strm, state);
+		uint64_t bits = state->bit_buffer;
+		uint32_t used;
+		uint32_t e = inf_lookup (state->litlen, INF_LITLEN_BITS, bits, &used);
+		uint32_t type = INF_E_TYPE (e);
+		if (type == INF_T_LIT) {
+			inf_drop (state, used);
+			uint8_t byte = (uint8_t)INF_E_VAL (e);
+			*strm->next_out++ = byte;
+			strm->avail_out--;
+			strm->total_out++;
+			continue;
+		}
+		if (type == INF_T_EOB) {
+			inf_drop (state, used);
+			return Z_STREAM_END;
+		}
+		if (type != INF_T_LEN) {
+			return Z_DATA_ERROR;
+		}
+		uint32_t extra = INF_E_EXTRA (e);
+		uint32_t length = INF_E_VAL (e) + (uint32_t)((bits >> used) & ((1u << extra) - 1));
+		inf_drop (state, used + extra);
+
+		bits = state->bit_buffer;
+		e = inf_lookup (state->dist, INF_DIST_BITS, bits, &used);
+		if (INF_E_TYPE (e) != INF_T_DIST) {
+			return Z_DATA_ERROR;
+		}
+		extra = INF_E_EXTRA (e);
+		uint32_t distance = INF_E_VAL (e) + (uint32_t)((bits >> used) & ((1u << extra) - 1));
+		inf_drop (state, used + extra);
+		if (distance > inf_history (strm, state)) {
+			return Z_DATA_ERROR; /* Distance too far back */
+		}
+		inf_copy_match (strm, state, length, distance);
+	}
 	return Z_OK;
 }
 
+/* Careful decode loop used near the end of input/output buffers. Each
+ * symbol is fully looked up before any bits are consumed so decoding can
+ * resume cleanly when input or output runs out.
+ * Returns Z_OK (need more input/output), Z_STREAM_END (end of block) or
+ * Z_DATA_ERROR. */
+static int inflate_slow(z_stream *strm, inflate_state *state) {
+	for (;;) {
+		/* Longest symbol: 15+5 bits length, 15+13 bits distance */
+		inf_need (strm, state, 48);
+		uint64_t bits = state->bit_buffer;
+		uint32_t have = state->bits_in_buffer;
+		uint32_t used;
+		uint32_t e = inf_lookup (state->litlen, INF_LITLEN_BITS, bits, &used);
+		uint32_t type = INF_E_TYPE (e);
+		if (used > have) {
+			return Z_OK; /* Need more input */
+		}
+		if (type == INF_T_LIT) {
+			if (strm->avail_out == 0) {
+				return Z_OK; /* Need more output space */
+			}
+			inf_drop (state, used);
+			uint8_t byte = (uint8_t)INF_E_VAL (e);
+			*strm->next_out++ = byte;
+			strm->avail_out--;
+			strm->total_out++;
+			if (strm->avail_in >= 8 && strm->avail_out >= 258) {
+				return Z_OK; /* Back to the fast loop */
+			}
+			continue;
+		}
+		if (type == INF_T_EOB) {
+			inf_drop (state, used);
+			return Z_STREAM_END;
+		}
+		if (type != INF_T_LEN) {
+			return Z_DATA_ERROR;
+		}
+		uint32_t extra = INF_E_EXTRA (e);
+		if (used + extra > have) {
+			return Z_OK;
+		}
+		uint32_t length = INF_E_VAL (e) + (uint32_t)((bits >> used) & ((1u << extra) - 1));
+		uint32_t consumed = used + extra;
+
+		uint32_t dused;
+		uint32_t de = inf_lookup (state->dist, INF_DIST_BITS, bits >> consumed, &dused);
+		if (consumed + dused > have) {
+			return Z_OK;
+		}
+		if (INF_E_TYPE (de) != INF_T_DIST) {
+			return Z_DATA_ERROR;
+		}
+		uint32_t dextra = INF_E_EXTRA (de);
+		if (consumed + dused + dextra > have) {
+			return Z_OK;
+		}
+		uint32_t distance = INF_E_VAL (de) + (uint32_t)((bits >> (consumed + dused)) & ((1u << dextra) - 1));
+		if (distance > inf_history (strm, state)) {
+			return Z_DATA_ERROR; /* Distance too far back */
+		}
+		if (strm->avail_out == 0) {
+			return Z_OK; /* Decode again once there is room */
+		}
+		inf_drop (state, consumed + dused + dextra);
+		inf_copy_match (strm, state, length, distance);
+		if (state->pending_copy) {
+			return Z_OK; /* Need more output space */
+		}
+		if (strm->avail_in >= 8 && strm->avail_out >= 258) {
+			return Z_OK;
+		}
+	}
+}
+
+/* Hand whole bytes still sitting in the bit buffer back to next_in, as
+ * far as they were taken from it by this call */
+static void inf_return_bytes(z_stream *strm, inflate_state *state, const uint8_t *in_start) {
+	uint32_t unused = state->bits_in_buffer >> 3;
+	uint32_t taken = (uint32_t)(strm->next_in - in_start);
+	if (unused > taken) {
+		unused = taken;
+	}
+	strm->next_in -= unused;
+	strm->avail_in += unused;
+	strm->total_in -= unused;
+	state->bits_in_buffer -= unused << 3;
+	state->bit_buffer &= (1ULL << state->bits_in_buffer) - 1;
+}
+
+/* With Z_BLOCK, returns at the next block boundary. data_type then holds
+ * the bits taken from next_in but not used yet (below 8 unless they came
+ * from an earlier call), plus 64 inside the last block and 128 at a
+ * block boundary, as zlib reports it. */
 int inflate(z_stream *strm, int flush) {
 	if (!strm || !strm->state) {
 		return Z_STREAM_ERROR;
 	}
 	inflate_state *state = (inflate_state *)strm->state;
+	const uint8_t *in_start = strm->next_in;
+	uLong in_before = strm->total_in;
+	uLong out_before = strm->total_out;
 	int ret = Z_OK;
+	int at_block = 0; /* stopped at a block boundary for Z_BLOCK */
+
+	if (state->state == INF_DONE) {
+		return Z_STREAM_END;
+	}
 
 	/* Handle wrapper header if not yet processed */
 	if (!state->header_done && state->wrap != WRAP_NONE) {
@@ -580,254 +878,210 @@ int inflate(z_stream *strm, int flush) {
 			strm->avail_in -= skip;
 			strm->total_in += skip;
 		}
+		in_start = strm->next_in;
 		state->header_done = 1;
 	}
 
-	/* Resume any pending literal first */
-	if (state->pending_literal >= 0) {
-		if (strm->avail_out == 0) {
-			return Z_OK; /* Need more output space */
-		}
-		*strm->next_out++ = (uint8_t)state->pending_literal;
-		strm->avail_out--;
-		strm->total_out++;
-		/* Add to window */
-		state->window[state->window_pos] = (uint8_t)state->pending_literal;
-		state->window_pos = (state->window_pos + 1) &(state->window_size - 1);
-		state->pending_literal = -1;
-	}
-
 	/* Resume any pending copy operation first */
+	state->out_base = strm->next_out;
 	if (state->pending_copy) {
-		(void)do_copy_from_window (strm, state, state->pending_length, state->pending_distance);
-		if (state->pending_copy) {
-			return Z_OK; /* Still have pending copy, need more output space */
-		}
+		inf_copy_match (strm, state, (uint32_t)state->pending_length, (uint32_t)state->pending_distance);
 	}
 
-	/* Main decompression loop - continue even when avail_out is 0
-	 * to check for end-of-block marker */
-	while (strm->avail_in > 0) {
-		/* Process based on current state */
-		switch (state->state) {
-		case 0: /* Block header */
-			/* Read block header */
-			state->final_block = get_bit (strm, state);
-			if (state->final_block < 0) {
-				return Z_DATA_ERROR;
+	while (!state->pending_copy) {
+		if (state->state == INF_HEADER) {
+			if (!inf_need (strm, state, 3)) {
+				break; /* Need more input */
 			}
-			/* Get block type */
-			state->btype = (block_type)get_bits (strm, state, 2);
-			if (state->btype < 0) {
-				return Z_DATA_ERROR;
-			}
-
-			/* Move to block data state */
-			state->state = 1;
-			break;
-
-		case 1: /* Block data */
-			/* Process based on block type */
+			state->final_block = (int)inf_peek (state, 1);
+			state->btype = (block_type)((state->bit_buffer >> 1) & 3);
+			inf_drop (state, 3);
 			switch (state->btype) {
 			case BLOCK_UNCOMPRESSED:
-				ret = read_uncompressed_block (strm, state);
-				if (ret != Z_OK) {
-					return ret;
-				}
-				/* Move to next block header */
-				state->state = 0;
+				/* Skip to the next byte boundary */
+				inf_drop (state, state->bits_in_buffer & 7);
+				state->state = INF_STORED;
 				break;
-
 			case BLOCK_FIXED:
-				/* Initialize fixed Huffman tables */
 				init_fixed_huffman (state);
-				/* Go to process literals state */
-				state->state = 2;
+				state->state = INF_CODES;
 				break;
-
 			case BLOCK_DYNAMIC:
-				/* Read dynamic Huffman tables */
-				if (read_dynamic_huffman (strm, state) != Z_OK) {
-					return Z_DATA_ERROR;
-				}
-				/* Go to process literals state */
-				state->state = 2;
+				state->hdr_stage = 0;
+				state->state = INF_TABLE;
 				break;
-
-			case BLOCK_INVALID:
+			default:
 				return Z_DATA_ERROR;
 			}
-			break;
-
-		case 2: /* Process literals/lengths */
-			/* This is a simplified implementation to handle fixed Huffman codes */
-			{
-				/* Get a code */
-				int code = 0;
-				int length = 0;
-
-				/* Decode Huffman code - same method for both fixed and dynamic */
-				code = 0;
-				for (length = 1; length <= 15; length++) {
-					int bit = get_bit (strm, state);
-					if (bit < 0) {
-						return Z_DATA_ERROR;
-					}
-					code = (code << 1) | bit;
-
-					/* Look for matching code */
-					int found = -1;
-					for (int i = 0; i < state->literals.count; i++) {
-						if (state->literals.lengths[i] == length &&
-							state->literals.codes[i] == code) {
-							found = i;
-							break;
-						}
-					}
-					if (found >= 0) {
-						code = found;
-						break;
-					}
-				}
-
-				if (length > 15) {
-					return Z_DATA_ERROR; /* Invalid Huffman code */
-				}
-
-				/* Process the code */
-				if (code < 256) {
-					/* Literal byte - need output space */
-					if (strm->avail_out == 0) {
-						state->pending_literal = code;
-						return Z_OK; /* Need more output space */
-					}
-					*strm->next_out++ = (uint8_t)code;
-					strm->avail_out--;
-					strm->total_out++;
-
-					/* Add to window */
-					state->window[state->window_pos] = (uint8_t)code;
-					state->window_pos = (state->window_pos + 1) &(state->window_size - 1);
-				} else if (code == 256) {
-					/* End of block */
-					state->state = 0; /* Back to block header */
-					if (state->final_block) {
-						return Z_STREAM_END; /* We're done */
-					}
-				} else if (code <= 285) {
-					/* Length code */
-					/* Determine base length and extra bits */
-					static const uint16_t length_base[] = {
-						3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
-					};
-					static const uint8_t length_extra[] = {
-						0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
-					};
-
-					int length_idx = code - 257;
-					int length = length_base[length_idx];
-					int extra_bits = length_extra[length_idx];
-
-					if (extra_bits > 0) {
-						int extra = get_bits (strm, state, extra_bits);
-						if (extra < 0) {
-							return Z_DATA_ERROR;
-						}
-						length += extra;
-					}
-
-					/* Now read distance code - same for fixed and dynamic */
-					int distance_code = -1;
-					code = 0;
-					int len;
-					for (len = 1; len <= 15; len++) {
-						int bit = get_bit (strm, state);
-						if (bit < 0) {
-							return Z_DATA_ERROR;
-						}
-						code = (code << 1) | bit;
-
-						/* Look for matching distance code */
-						for (int i = 0; i < state->distances.count; i++) {
-							if (state->distances.lengths[i] == len &&
-								state->distances.codes[i] == code) {
-								distance_code = i;
-								break;
-							}
-						}
-						if (distance_code >= 0) {
-							break;
-						}
-					}
-					if (len > 15 || distance_code < 0) {
-						return Z_DATA_ERROR; /* Invalid Huffman code */
-					}
-					/* Convert to actual distance */
-					static const uint16_t dist_base[] = {
-						1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
-					};
-					static const uint8_t dist_extra[] = {
-						0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
-					};
-
-					int distance = dist_base[distance_code];
-					int dist_extra_bits = dist_extra[distance_code];
-
-					if (dist_extra_bits > 0) {
-						int extra = get_bits (strm, state, dist_extra_bits);
-						if (extra < 0) {
-							return Z_DATA_ERROR;
-						}
-						distance += extra;
-					}
-
-					/* Copy bytes from window */
-					if ((uint32_t)distance > state->window_size) {
-						return Z_DATA_ERROR; /* Distance too far back */
-					}
-
-					/* Copy bytes using helper (handles partial copies) */
-					(void)do_copy_from_window (strm, state, length, distance);
-					if (state->pending_copy) {
-						return Z_OK; /* Need more output space */
-					}
-				} else {
-					/* Invalid code */
-					return Z_DATA_ERROR;
+		} else if (state->state == INF_STORED) {
+			if (!inf_need (strm, state, 32)) {
+				break;
+			}
+			uint32_t len = inf_peek (state, 16);
+			uint32_t nlen = (uint32_t)((state->bit_buffer >> 16) & 0xFFFF);
+			inf_drop (state, 32);
+			if (len != (~nlen & 0xFFFF)) {
+				return Z_DATA_ERROR; /* Length check failed */
+			}
+			state->stored_left = len;
+			state->state = INF_STORED_COPY;
+		} else if (state->state == INF_STORED_COPY) {
+			read_uncompressed_block (strm, state);
+			if (state->stored_left > 0) {
+				break; /* Need more input or output */
+			}
+			state->state = state->final_block? INF_DONE: INF_HEADER;
+			if (flush == Z_BLOCK && state->state == INF_HEADER) {
+				at_block = 1;
+				break;
+			}
+		} else if (state->state == INF_TABLE) {
+			ret = read_dynamic_huffman (strm, state);
+			if (ret == Z_BUF_ERROR) {
+				break;
+			}
+			if (ret != Z_OK) {
+				return Z_DATA_ERROR;
+			}
+			state->state = INF_CODES;
+		} else if (state->state == INF_CODES) {
+			ret = inflate_fast (strm, state);
+			if (ret == Z_OK) {
+				ret = inflate_slow (strm, state);
+			}
+			if (ret == Z_DATA_ERROR) {
+				return Z_DATA_ERROR;
+			}
+			if (ret == Z_STREAM_END) {
+				state->state = state->final_block? INF_DONE: INF_HEADER;
+				if (flush == Z_BLOCK && state->state == INF_HEADER) {
+					at_block = 1;
+					break;
 				}
+				continue;
+			}
+			/* The careful loop only yields without finishing the block when
+			 * the fast loop can run again or input/output is exhausted */
+			if (state->pending_copy || strm->avail_in < 8 || strm->avail_out < 258) {
+				break;
 			}
+		} else { /* INF_DONE */
 			break;
-
-		default:
-			return Z_STREAM_ERROR; /* Invalid state */
 		}
-
-		/* Check if we're done */
-		if (state->final_block && state->state == 0) {
-			return Z_STREAM_END;
-		}
-
-		/* Check if we should stop */
-		if (flush == Z_FINISH && strm->avail_in == 0) {
-			if (!state->final_block || state->state != 0) {
-				return Z_BUF_ERROR; /* Need more input to finish */
-			}
-			return Z_STREAM_END;
+		if (state->state == INF_DONE) {
+			break;
 		}
 	}
 
-	/* If we get here, we've run out of input or output space */
-	/* But first check if we've actually finished decompression */
-	if (state->final_block && state->state == 0) {
+	/* Matches read this call's output in place; keep its last 32K for the
+	 * next call */
+	inf_window_put (state, state->out_base, (size_t)(strm->next_out - state->out_base));
+
+	if (state->state == INF_DONE) {
+		inf_return_bytes (strm, state, in_start);
+		state->bit_buffer = 0;
+		state->bits_in_buffer = 0;
+		strm->data_type = 0;
 		return Z_STREAM_END;
 	}
+	if (at_block) {
+		/* an empty block may have come from bits buffered earlier */
+		inf_return_bytes (strm, state, in_start);
+		strm->data_type = (int)state->bits_in_buffer + 128;
+		return Z_OK;
+	}
+	strm->data_type = (int)state->bits_in_buffer + (state->final_block? 64: 0) + (state->state == INF_HEADER? 128: 0);
+
+	if (strm->total_in == in_before && strm->total_out == out_before) {
+		return Z_BUF_ERROR; /* No progress possible */
+	}
+	if (flush == Z_FINISH) {
+		return Z_BUF_ERROR; /* Need more input or output to finish */
+	}
+	return Z_OK;
+}
+
+/* Start a new stream with the same wrapper, keeping the window. The
+ * fixed code tables stay valid if they were built. */
+int inflateReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	inflate_state *state = (inflate_state *)strm->state;
+	state->bit_buffer = 0;
+	state->bits_in_buffer = 0;
+	state->final_block = 0;
+	state->state = INF_HEADER;
+	state->stored_left = 0;
+	state->hdr_stage = 0;
+	state->hdr_index = 0;
+	state->window_pos = 0;
+	state->window_have = 0;
+	state->header_done = 0;
+	state->pending_copy = 0;
+	state->pending_length = 0;
+	state->pending_distance = 0;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
 
-	if (strm->avail_out == 0) {
-		return Z_OK; /* Need more output space, not an error */
+/* Raw streams only: make dict the history matches may reach into, as
+ * if it had just been decoded */
+int inflateSetDictionary(z_stream *strm, const uint8_t *dict, uInt len) {
+	if (!strm || !strm->state || (!dict && len > 0)) {
+		return Z_STREAM_ERROR;
 	}
+	inflate_state *state = (inflate_state *)strm->state;
+	if (state->wrap != WRAP_NONE) {
+		return Z_STREAM_ERROR;
+	}
+	inf_window_put (state, dict, len);
+	return Z_OK;
+}
+
+/* Copy out the history (up to 32K, oldest byte first); with dict NULL
+ * only *len is set */
+int inflateGetDictionary(z_stream *strm, uint8_t *dict, uInt *len) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	const inflate_state *state = (const inflate_state *)strm->state;
+	uint32_t have = state->window_have;
+	if (dict) {
+		uint32_t from = (state->window_pos - have) & (state->window_size - 1);
+		uint32_t first = state->window_size - from;
+		if (first > have) {
+			first = have;
+		}
+		memcpy (dict, state->window + from, first);
+		memcpy (dict + first, state->window, have - first);
+	}
+	if (len) {
+		*len = have;
+	}
+	return Z_OK;
+}
 
-	/* We have output space but no input - need more input data */
-	return Z_BUF_ERROR;
+/* Insert bits (up to 16) ahead of the remaining input; bits < 0 drops
+ * whatever is buffered */
+int inflatePrime(z_stream *strm, int bits, int value) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	inflate_state *state = (inflate_state *)strm->state;
+	if (bits < 0) {
+		state->bit_buffer = 0;
+		state->bits_in_buffer = 0;
+		return Z_OK;
+	}
+	if (bits > 16 || state->bits_in_buffer + (uint32_t)bits > 56) {
+		return Z_STREAM_ERROR;
+	}
+	state->bit_buffer &= (1ULL << state->bits_in_buffer) - 1;
+	state->bit_buffer |= (uint64_t)((uint32_t)value & ((1u << bits) - 1)) << state->bits_in_buffer;
+	state->bits_in_buffer += (uint32_t)bits;
+	return Z_OK;
 }
 
 int inflateEnd(z_stream *strm) {
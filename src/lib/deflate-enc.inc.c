@@ -1,190 +1,878 @@
 /* ----------- Encoder-specific data structures ----------- */
 
+#define DEF_MIN_MATCH 3
+#define DEF_MAX_MATCH 258
+/* Keep enough lookahead for a full match plus the next hash insertion */
+#define DEF_MIN_LOOKAHEAD (DEF_MAX_MATCH + DEF_MIN_MATCH + 1)
+#define DEF_HASH_BITS 15
+#define DEF_HASH_SIZE (1u << DEF_HASH_BITS)
+#define DEF_NIL 0 /* Tail of hash chains */
+/* Matches of length 3 are discarded if their distance exceeds this */
+#define DEF_TOO_FAR 4096
+/* Symbols buffered per block before it is emitted */
+#define DEF_LIT_BUFSIZE 16384
+#define DEF_END_BLOCK 256
+#define DEF_MAX_BITS 15 /* Longest literal/length or distance code */
+#define DEF_MAX_BL_BITS 7 /* Longest code length code */
+#define DEF_BL_CODES 19
+
+/* Per-level tuning, same knobs and values as zlib's configuration table.
+ * good_length: reduce lazy search above this match length
+ * max_lazy: do not perform lazy search above this match length
+ *           (greedy levels: do not insert hashes for longer matches)
+ * nice_length: quit search above this match length
+ * max_chain: maximum hash chain positions visited per search */
+typedef struct {
+	uint16_t good_length;
+	uint16_t max_lazy;
+	uint16_t nice_length;
+	uint16_t max_chain;
+	int lazy; /* 0 = greedy parsing, 1 = one-step lazy evaluation */
+} deflate_config;
+
+static const deflate_config deflate_levels[10] = {
+	{ 0, 0, 0, 0, 0 }, /* 0: store only */
+	{ 4, 4, 8, 4, 0 }, /* 1: max speed, no lazy matches */
+	{ 4, 5, 16, 8, 0 },
+	{ 4, 6, 32, 32, 0 },
+	{ 4, 4, 16, 16, 1 }, /* 4: lazy matches */
+	{ 8, 16, 32, 32, 1 },
+	{ 8, 16, 128, 128, 1 }, /* 6: default */
+	{ 8, 32, 128, 256, 1 },
+	{ 32, 128, 258, 1024, 1 },
+	{ 32, 258, 258, 4096, 1 } /* 9: max compression */
+};
+
+/* Stream status */
+typedef enum {
+	DEF_INIT = 0, /* Wrapper header not written yet */
+	DEF_BUSY, /* Compressing */
+	DEF_FINISHED /* Final block and trailer queued */
+} deflate_status;
+
+/* Result of one compression pass */
+typedef enum {
+	DEF_NEED_MORE, /* Need more input or more output space */
+	DEF_BLOCK_DONE, /* Flush point reached */
+	DEF_FINISH_DONE /* Final block written */
+} deflate_result;
+
 /* Internal state for deflate */
 typedef struct {
 	/* Compression parameters */
 	int level; /* Compression level */
-	int is_last_block; /* Is this the final block? */
+	int strategy; /* Z_* strategy */
+	deflate_config cfg; /* Tuning for level */
+	wrap_format wrap; /* Wrapper format */
+	deflate_status status; /* Header/body/trailer progress */
+	uint32_t check; /* Running CRC-32 (gzip) or Adler-32 (zlib) */
+
+	/* Sliding window: two halves of w_size, slid down when the upper half
+	 * is reached. Positions in head/prev are window indices. */
+	uint8_t *window; /* Sliding window buffer (2 * w_size + padding) */
+	uint32_t w_size; /* LZ77 window size (power of 2) */
+	uint32_t w_mask; /* w_size - 1 */
+	uint32_t max_dist; /* Longest distance that stays inside the window */
+	uint32_t strstart; /* Start of string to insert */
+	uint32_t lookahead; /* Valid bytes ahead of strstart */
+	long block_start; /* Window position of current block (< 0 once slid out) */
+
+	/* Hash chains */
+	uint16_t *head; /* Most recent position for each hash */
+	uint16_t *prev; /* Previous position with the same hash (indexed by pos & w_mask) */
+
+	/* Match state (kept across calls for lazy evaluation) */
+	uint32_t match_start; /* Start of matching string */
+	uint32_t match_length; /* Length of best match */
+	uint32_t prev_match; /* Previous match (lazy evaluation) */
+	uint32_t prev_length; /* Best match length at previous step */
+	int match_available; /* Previous position still needs to be emitted */
+
+	/* Buffered symbols of the current block */
+	uint8_t *sym_lc; /* Literal byte or match length - 3 */
+	uint16_t *sym_dist; /* Match distance, 0 for literals */
+	uint32_t sym_next; /* Number of buffered symbols */
+	uint32_t lit_freq[286]; /* Literal/length symbol frequencies */
+	uint32_t dist_freq[30]; /* Distance symbol frequencies */
+
+	/* Static (fixed) Huffman codes, bit-reversed for LSB-first output */
+	uint16_t fixed_lcode[288];
+	uint8_t fixed_llen[288];
+	uint16_t fixed_dcode[30];
+	uint8_t fixed_dlen[30];
+
+	/* Dynamic Huffman codes built for the current block */
+	uint16_t dyn_lcode[286];
+	uint8_t dyn_llen[286];
+	uint16_t dyn_dcode[30];
+	uint8_t dyn_dlen[30];
+	uint16_t bl_code[DEF_BL_CODES];
+	uint8_t bl_len[DEF_BL_CODES];
+	uint32_t bl_freq[DEF_BL_CODES];
+	/* Run-length encoded code lengths: symbol 0..18 and its extra bits */
+	uint8_t rle_sym[286 + 30];
+	uint8_t rle_extra[286 + 30];
+	uint32_t rle_count;
+	uint32_t hlit; /* Literal/length codes sent */
+	uint32_t hdist; /* Distance codes sent */
+	uint32_t hclen; /* Code length codes sent */
+
+	/* Symbol lookup: match length - 3 -> length code, distance - 1 -> code */
+	uint8_t len_code[256];
+	uint8_t dist_code[512];
+
+	/* Output state: compressed bytes waiting for room in next_out */
+	uint8_t *pending_buf; /* Output still pending */
+	uint32_t pending_size; /* Capacity of pending_buf */
+	uint32_t pending; /* Bytes in pending_buf */
+	uint32_t pending_out; /* Next pending byte to copy to next_out */
+	uint64_t bit_buffer; /* Bit buffer (LSB first) */
+	uint32_t bits_in_buffer; /* Number of bits in buffer */
+} deflate_state;
 
-	/* Sliding window for LZ77 */
-	uint8_t *window; /* Sliding window buffer */
-	uint32_t window_size; /* Window size (power of 2) */
-	uint32_t window_mask; /* Window mask (window_size - 1) */
-	uint32_t window_pos; /* Current position in window */
+/* ----------- Bit output ----------- */
 
-	/* Hash table for fast string matching */
-	uint16_t *hash_table; /* Hash table for finding matches */
-	uint32_t hash_size; /* Size of hash table */
-	uint32_t hash_mask; /* Hash mask (hash_size - 1) */
+static inline void def_put_byte(deflate_state *s, uint8_t c) {
+	s->pending_buf[s->pending++] = c;
+}
 
-	/* Output state */
-	uint32_t bit_buffer; /* Bit buffer */
-	uint32_t bits_in_buffer; /* Number of bits in buffer */
+/* Append n (<= 32) bits, LSB first */
+static inline void write_bits(deflate_state *s, uint32_t value, uint32_t n) {
+	s->bit_buffer |= (uint64_t)value << s->bits_in_buffer;
+	s->bits_in_buffer += n;
+	if (s->bits_in_buffer >= 32) {
+		uint8_t *p = s->pending_buf + s->pending;
+		p[0] = (uint8_t)s->bit_buffer;
+		p[1] = (uint8_t)(s->bit_buffer >> 8);
+		p[2] = (uint8_t)(s->bit_buffer >> 16);
+		p[3] = (uint8_t)(s->bit_buffer >> 24);
+		s->pending += 4;
+		s->bit_buffer >>= 32;
+		s->bits_in_buffer -= 32;
+	}
+}
 
-	/* Huffman tables */
-	huffman_table literals; /* Literal/length codes */
-	huffman_table distances; /* Distance codes */
-} deflate_state;
+/* Write out all buffered bits, padding the last byte with zeros */
+static void flush_bits(deflate_state *s) {
+	while (s->bits_in_buffer > 0) {
+		def_put_byte (s, (uint8_t)s->bit_buffer);
+		s->bit_buffer >>= 8;
+		s->bits_in_buffer = s->bits_in_buffer > 8? s->bits_in_buffer - 8: 0;
+	}
+	s->bit_buffer = 0;
+}
 
-/* ----------- Encoder-specific functions ----------- */
+/* Copy as much pending output as fits into next_out */
+static void flush_pending(z_stream *strm, deflate_state *s) {
+	uint32_t len = s->pending - s->pending_out;
+	if (len > strm->avail_out) {
+		len = strm->avail_out;
+	}
+	if (len == 0) {
+		return;
+	}
+	memcpy (strm->next_out, s->pending_buf + s->pending_out, len);
+	strm->next_out += len;
+	strm->avail_out -= len;
+	strm->total_out += len;
+	s->pending_out += len;
+	if (s->pending_out == s->pending) {
+		s->pending = 0;
+		s->pending_out = 0;
+	}
+}
 
-/* Find longest match at current position */
-static int find_longest_match(deflate_state *state, const uint8_t *data, uint32_t pos, uint32_t max_len, uint32_t *match_pos) {
-	/* Need at least 3 bytes for a match */
-	if (max_len < 3) {
-		return 0;
+/* ----------- Huffman codes ----------- */
+
+/* Assign canonical codes for the given lengths and store them bit-reversed,
+ * since Huffman codes are packed starting with the most significant bit
+ * while write_bits() emits LSB first. */
+static void gen_codes(uint16_t *codes, const uint8_t *lengths, int n) {
+	uint16_t bl_count[16] = { 0 };
+	uint16_t next_code[16];
+	for (int i = 0; i < n; i++) {
+		bl_count[lengths[i]]++;
 	}
+	bl_count[0] = 0;
+	uint16_t code = 0;
+	for (int bits = 1; bits <= 15; bits++) {
+		code = (uint16_t)((code + bl_count[bits - 1]) << 1);
+		next_code[bits] = code;
+	}
+	for (int i = 0; i < n; i++) {
+		int len = lengths[i];
+		if (len == 0) {
+			codes[i] = 0;
+			continue;
+		}
+		uint32_t c = next_code[len]++;
+		uint32_t rev = 0;
+		for (int b = 0; b < len; b++) {
+			rev = (rev << 1) | (c & 1);
+			c >>= 1;
+		}
+		codes[i] = (uint16_t)rev;
+	}
+}
 
-	/* Calculate hash for current position */
-	uint32_t hash = calculate_hash (data) & state->hash_mask;
+/* Initialize static Huffman tables and symbol lookup tables for deflate */
+static void init_fixed_huffman_deflate(deflate_state *s) {
+	for (int i = 0; i < 288; i++) {
+		s->fixed_llen[i] = i < 144? 8: i < 256? 9: i < 280? 7: 8;
+	}
+	gen_codes (s->fixed_lcode, s->fixed_llen, 288);
+	for (int i = 0; i < 30; i++) {
+		s->fixed_dlen[i] = 5;
+	}
+	gen_codes (s->fixed_dcode, s->fixed_dlen, 30);
 
-	/* Get position of potential match from hash table.
-	 * We store positions offset by +1 so that 0 means "no entry".
-	 */
-	uint32_t stored = state->hash_table[hash];
+	for (int code = 0; code < 28; code++) {
+		int base = deflate_length_base[code] - DEF_MIN_MATCH;
+		int count = 1 << deflate_length_extra[code];
+		for (int n = 0; n < count && base + n < 256; n++) {
+			s->len_code[base + n] = (uint8_t)code;
+		}
+	}
+	/* Length 258 has its own code even though 284 could also express it */
+	s->len_code[255] = 28;
+
+	/* Distances 1..256 map directly, longer ones by (distance - 1) >> 7 */
+	for (int code = 0; code < 30; code++) {
+		uint32_t base = deflate_dist_base[code] - 1u;
+		uint32_t count = 1u << deflate_dist_extra[code];
+		for (uint32_t n = 0; n < count; n++) {
+			uint32_t d = base + n;
+			if (d < 256) {
+				s->dist_code[d] = (uint8_t)code;
+			} else {
+				s->dist_code[256 + (d >> 7)] = (uint8_t)code;
+			}
+		}
+	}
+}
 
-	/* Store current position in hash table (save position modulo 64K) */
-	/* Save pos+1 so that 0 remains sentinel for "no previous" */
-	state->hash_table[hash] = (uint16_t) (((pos & 0xFFFF) + 1) & 0xFFFF);
+static inline uint32_t def_dist_code(const deflate_state *s, uint32_t dist) {
+	return dist < 256? s->dist_code[dist]: s->dist_code[256 + (dist >> 7)];
+}
 
-	/* No previous match at this hash */
-	if (stored == 0) {
-		return 0;
+/* ----------- Block emission ----------- */
+
+static void init_block(deflate_state *s) {
+	memset (s->lit_freq, 0, sizeof (s->lit_freq));
+	memset (s->dist_freq, 0, sizeof (s->dist_freq));
+	s->lit_freq[DEF_END_BLOCK] = 1;
+	s->sym_next = 0;
+}
+
+/* Record a literal; returns non-zero when the block buffer is full */
+static inline int tally_lit(deflate_state *s, uint8_t c) {
+	s->sym_lc[s->sym_next] = c;
+	s->sym_dist[s->sym_next] = 0;
+	s->sym_next++;
+	s->lit_freq[c]++;
+	return s->sym_next == DEF_LIT_BUFSIZE;
+}
+
+/* Record a match of length len at distance dist */
+static inline int tally_match(deflate_state *s, uint32_t dist, uint32_t len) {
+	uint32_t lc = len - DEF_MIN_MATCH;
+	s->sym_lc[s->sym_next] = (uint8_t)lc;
+	s->sym_dist[s->sym_next] = (uint16_t)dist;
+	s->sym_next++;
+	s->lit_freq[257 + s->len_code[lc]]++;
+	s->dist_freq[def_dist_code (s, dist - 1)]++;
+	return s->sym_next == DEF_LIT_BUFSIZE;
+}
+
+/* Bit cost of the buffered symbols with the given code lengths */
+static uint64_t block_cost(const deflate_state *s, const uint8_t *llen, const uint8_t *dlen) {
+	uint64_t bits = 0;
+	for (int i = 0; i < 286; i++) {
+		bits += (uint64_t)s->lit_freq[i] * llen[i];
 	}
+	for (int i = 0; i < 29; i++) {
+		bits += (uint64_t)s->lit_freq[257 + i] * deflate_length_extra[i];
+	}
+	for (int i = 0; i < 30; i++) {
+		bits += (uint64_t)s->dist_freq[i] * (dlen[i] + deflate_dist_extra[i]);
+	}
+	return bits;
+}
 
-	/* Recover actual stored position (subtract the +1) */
-	uint32_t chain_pos = (uint32_t) (stored - 1);
+/* ----------- Dynamic Huffman trees ----------- */
 
-	/* Don't look back too far (distance measured in window indices) */
-	const uint32_t max_dist = 32768;
-	if (pos > chain_pos + max_dist) {
-		return 0;
+/* Order in which code length code lengths are sent (RFC 1951 3.2.7) */
+static const uint8_t deflate_bl_order[DEF_BL_CODES] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+typedef struct {
+	uint32_t key; /* Frequency, then tree links, then code length */
+	uint16_t sym;
+} def_sym_freq;
+
+static int def_sym_freq_cmp(const void *a, const void *b) {
+	const def_sym_freq *x = (const def_sym_freq *)a;
+	const def_sym_freq *y = (const def_sym_freq *)b;
+	if (x->key != y->key) {
+		return x->key < y->key? -1: 1;
+	}
+	return (int)x->sym - (int)y->sym;
+}
+
+/* Compute optimal code lengths in place for symbols sorted by ascending
+ * frequency (Moffat & Katajainen). On return A[i].key is the code length
+ * of A[i].sym; lengths are not limited yet. */
+static void def_minimum_redundancy(def_sym_freq *A, int n) {
+	if (n == 1) {
+		A[0].key = 1;
+		return;
+	}
+	/* First pass: build the tree, reusing keys as parent pointers */
+	A[0].key += A[1].key;
+	int root = 0;
+	int leaf = 2;
+	for (int next = 1; next < n - 1; next++) {
+		if (leaf >= n || A[root].key < A[leaf].key) {
+			A[next].key = A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key = A[leaf++].key;
+		}
+		if (leaf >= n || (root < next && A[root].key < A[leaf].key)) {
+			A[next].key += A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key += A[leaf++].key;
+		}
 	}
+	/* Second pass: internal node depths */
+	A[n - 2].key = 0;
+	for (int next = n - 3; next >= 0; next--) {
+		A[next].key = A[A[next].key].key + 1;
+	}
+	/* Third pass: leaf depths */
+	int avbl = 1;
+	int used = 0;
+	uint32_t depth = 0;
+	root = n - 2;
+	int next = n - 1;
+	while (avbl > 0) {
+		while (root >= 0 && A[root].key == depth) {
+			used++;
+			root--;
+		}
+		while (avbl > used) {
+			A[next--].key = depth;
+			avbl--;
+		}
+		avbl = 2 * used;
+		depth++;
+		used = 0;
+	}
+}
 
-	/* Find longest match */
-	uint32_t best_len = 0;
-	*match_pos = 0;
-
-	/* Limit match search for better performance */
-	const int max_chain_length = (state->level >= 8)? 4096: (state->level >= 5)? 512
-		: (state->level >= 3)? 128
-										: 32;
-
-	int chain_len = max_chain_length;
-
-	/* Search for matches */
-	while (chain_pos > 0 && chain_len-- > 0) {
-		/* Quick check for 3-byte match at start.
-		 * The previous occurrence is located in the circular sliding window at
-		 * index `chain_pos & window_mask`. Compare bytes in the window to the
-		 * input buffer `data`.
-		 */
-		uint32_t win_idx = chain_pos & state->window_mask;
-		if (state->window[win_idx] == data[0] &&
-			state->window[(win_idx + 1) & state->window_mask] == data[1] &&
-			state->window[(win_idx + 2) & state->window_mask] == data[2]) {
-
-			/* Count matching bytes */
-			uint32_t len = 3;
-			while (len < max_len &&
-				state->window[(win_idx + len) & state->window_mask] == data[len]) {
-				len++;
+/* Build length-limited Huffman code lengths for freq[0..n) and the
+ * matching bit-reversed codes. At least two symbols always get a code so
+ * decoders never see a degenerate tree. Returns the number of symbols up
+ * to and including the last one with a non-zero length. */
+static uint32_t build_tree(const uint32_t *freq, int n, int max_bits, uint8_t *lengths, uint16_t *codes) {
+	def_sym_freq syms[286];
+	int used = 0;
+	for (int i = 0; i < n; i++) {
+		lengths[i] = 0;
+		if (freq[i]) {
+			syms[used].key = freq[i];
+			syms[used].sym = (uint16_t)i;
+			used++;
+		}
+	}
+	for (int i = 0; used < 2; i++) {
+		if (!freq[i]) {
+			syms[used].key = 1;
+			syms[used].sym = (uint16_t)i;
+			used++;
+		}
+	}
+	qsort (syms, (size_t)used, sizeof (syms[0]), def_sym_freq_cmp);
+	def_minimum_redundancy (syms, used);
+
+	/* Fold over-long codes into max_bits, then lengthen shorter codes
+	 * until the Kraft sum is exactly one again */
+	uint32_t bl_count[DEF_MAX_BITS + 1] = { 0 };
+	for (int i = 0; i < used; i++) {
+		bl_count[syms[i].key > (uint32_t)max_bits? (uint32_t)max_bits: syms[i].key]++;
+	}
+	uint32_t total = 0;
+	for (int bits = max_bits; bits > 0; bits--) {
+		total += bl_count[bits] << (max_bits - bits);
+	}
+	while (total != (1u << max_bits)) {
+		bl_count[max_bits]--;
+		for (int bits = max_bits - 1; bits > 0; bits--) {
+			if (bl_count[bits]) {
+				bl_count[bits]--;
+				bl_count[bits + 1] += 2;
+				break;
 			}
+		}
+		total--;
+	}
 
-			/* Update best match if better */
-			if (len > best_len) {
-				best_len = len;
-				*match_pos = chain_pos;
+	/* Hand out the lengths: shortest codes to the most frequent symbols */
+	int j = used;
+	for (int bits = 1; bits <= max_bits; bits++) {
+		for (uint32_t k = bl_count[bits]; k > 0; k--) {
+			lengths[syms[--j].sym] = (uint8_t)bits;
+		}
+	}
+	gen_codes (codes, lengths, n);
 
-				/* Stop if we found a "good enough" match */
-				if (len >= max_len) {
-					break;
-				}
+	uint32_t last = (uint32_t)n;
+	while (last > 0 && lengths[last - 1] == 0) {
+		last--;
+	}
+	return last;
+}
+
+static inline void def_rle_put(deflate_state *s, uint8_t sym, uint8_t extra) {
+	s->rle_sym[s->rle_count] = sym;
+	s->rle_extra[s->rle_count] = extra;
+	s->rle_count++;
+	s->bl_freq[sym]++;
+}
+
+/* Run-length encode the literal/length and distance code lengths as one
+ * sequence using codes 16 (repeat previous), 17 and 18 (runs of zeros) */
+static void def_rle_lengths(deflate_state *s) {
+	uint8_t lens[286 + 30];
+	uint32_t n = s->hlit + s->hdist;
+	memcpy (lens, s->dyn_llen, s->hlit);
+	memcpy (lens + s->hlit, s->dyn_dlen, s->hdist);
+	memset (s->bl_freq, 0, sizeof (s->bl_freq));
+	s->rle_count = 0;
+
+	uint32_t i = 0;
+	while (i < n) {
+		uint8_t cur = lens[i];
+		uint32_t run = 1;
+		while (i + run < n && lens[i + run] == cur) {
+			run++;
+		}
+		i += run;
+		if (cur == 0) {
+			while (run >= 11) {
+				uint32_t r = run > 138? 138: run;
+				def_rle_put (s, 18, (uint8_t)(r - 11));
+				run -= r;
+			}
+			if (run >= 3) {
+				def_rle_put (s, 17, (uint8_t)(run - 3));
+				run = 0;
+			}
+		} else {
+			def_rle_put (s, cur, 0);
+			run--;
+			while (run >= 3) {
+				uint32_t r = run > 6? 6: run;
+				def_rle_put (s, 16, (uint8_t)(r - 3));
+				run -= r;
 			}
 		}
+		while (run-- > 0) {
+			def_rle_put (s, cur, 0);
+		}
+	}
+}
 
-		/* In a full implementation we'd use a proper chain, but for simplicity
-		 * we'll just terminate the search as the code is intended to be minimal */
-		break; /* End the chain search after first match */
+/* Build the dynamic trees for the current block; returns the cost of the
+ * block in bits, header included */
+static uint64_t build_dynamic_trees(deflate_state *s) {
+	s->hlit = build_tree (s->lit_freq, 286, DEF_MAX_BITS, s->dyn_llen, s->dyn_lcode);
+	if (s->hlit < 257) {
+		s->hlit = 257;
+	}
+	s->hdist = build_tree (s->dist_freq, 30, DEF_MAX_BITS, s->dyn_dlen, s->dyn_dcode);
+	def_rle_lengths (s);
+	build_tree (s->bl_freq, DEF_BL_CODES, DEF_MAX_BL_BITS, s->bl_len, s->bl_code);
+	s->hclen = DEF_BL_CODES;
+	while (s->hclen > 4 && s->bl_len[deflate_bl_order[s->hclen - 1]] == 0) {
+		s->hclen--;
 	}
 
-	return best_len;
+	uint64_t bits = 3 + 5 + 5 + 4 + 3 * (uint64_t)s->hclen;
+	for (int i = 0; i < DEF_BL_CODES; i++) {
+		bits += (uint64_t)s->bl_freq[i] * s->bl_len[i];
+	}
+	bits += 2 * (uint64_t)s->bl_freq[16] + 3 * (uint64_t)s->bl_freq[17] + 7 * (uint64_t)s->bl_freq[18];
+	return bits + block_cost (s, s->dyn_llen, s->dyn_dlen);
 }
 
-/* Write bits to output buffer */
-static int write_bits(z_stream *strm, deflate_state *state, uint32_t bits, int num_bits) {
-	/* Add bits to buffer */
-	state->bit_buffer |= (bits << state->bits_in_buffer);
-	state->bits_in_buffer += num_bits;
+/* Emit the dynamic block header: tree sizes and the RLE-coded lengths */
+static void send_dynamic_trees(deflate_state *s) {
+	static const uint8_t rle_extra_bits[3] = { 2, 3, 7 };
+	write_bits (s, s->hlit - 257, 5);
+	write_bits (s, s->hdist - 1, 5);
+	write_bits (s, s->hclen - 4, 4);
+	for (uint32_t i = 0; i < s->hclen; i++) {
+		write_bits (s, s->bl_len[deflate_bl_order[i]], 3);
+	}
+	for (uint32_t i = 0; i < s->rle_count; i++) {
+		uint8_t sym = s->rle_sym[i];
+		write_bits (s, s->bl_code[sym], s->bl_len[sym]);
+		if (sym >= 16) {
+			write_bits (s, s->rle_extra[i], rle_extra_bits[sym - 16]);
+		}
+	}
+}
 
-	/* Fast path: write all full bytes at once */
-	while (state->bits_in_buffer >= 8) {
-		if (strm->avail_out == 0) {
-			return Z_BUF_ERROR;
+/* Emit the buffered symbols with the given (bit-reversed) codes */
+static void compress_block_codes(deflate_state *s, const uint16_t *lcode, const uint8_t *llen, const uint16_t *dcode, const uint8_t *dlen) {
+	for (uint32_t i = 0; i < s->sym_next; i++) {
+		uint32_t dist = s->sym_dist[i];
+		uint32_t lc = s->sym_lc[i];
+		if (dist == 0) {
+			write_bits (s, lcode[lc], llen[lc]);
+			continue;
 		}
+		uint32_t code = s->len_code[lc];
+		write_bits (s, lcode[257 + code], llen[257 + code]);
+		if (deflate_length_extra[code]) {
+			write_bits (s, lc + DEF_MIN_MATCH - deflate_length_base[code], deflate_length_extra[code]);
+		}
+		dist--;
+		code = def_dist_code (s, dist);
+		write_bits (s, dcode[code], dlen[code]);
+		if (deflate_dist_extra[code]) {
+			write_bits (s, dist + 1 - deflate_dist_base[code], deflate_dist_extra[code]);
+		}
+	}
+	write_bits (s, lcode[DEF_END_BLOCK], llen[DEF_END_BLOCK]);
+}
 
-		*strm->next_out++ = state->bit_buffer & 0xFF;
-		strm->avail_out--;
-		strm->total_out++;
+/* Emit len bytes as stored blocks (split at 64K) */
+static void send_stored(deflate_state *s, const uint8_t *data, uint32_t len, int last) {
+	do {
+		uint32_t n = len > 0xFFFF? 0xFFFF: len;
+		int final = last && n == len;
+		write_bits (s, final? 1: 0, 1); /* Final block bit */
+		write_bits (s, BLOCK_UNCOMPRESSED, 2); /* Block type 00 */
+		/* Uncompressed data starts at a byte boundary */
+		flush_bits (s);
+		def_put_byte (s, (uint8_t)(n & 0xFF));
+		def_put_byte (s, (uint8_t)(n >> 8));
+		def_put_byte (s, (uint8_t)(~n & 0xFF));
+		def_put_byte (s, (uint8_t)((~n >> 8) & 0xFF));
+		if (n > 0) {
+			memcpy (s->pending_buf + s->pending, data, n);
+			s->pending += n;
+			data += n;
+		}
+		len -= n;
+	} while (len > 0);
+}
 
-		state->bit_buffer >>= 8;
-		state->bits_in_buffer -= 8;
+/* Emit the current block using the cheapest available encoding */
+static void flush_block(deflate_state *s, int last) {
+	uint32_t stored_len = (uint32_t)((long)s->strstart - s->block_start);
+	int can_store = s->block_start >= 0;
+
+	/* Header + data bits for each option; stored also pays LEN/NLEN and
+	 * the padding to a byte boundary */
+	uint64_t fixed_bits = 3 + block_cost (s, s->fixed_llen, s->fixed_dlen);
+	uint64_t dyn_bits = fixed_bits + 1;
+	uint64_t stored_bits = ((uint64_t)stored_len + 4 + 5 * (stored_len / 0xFFFF)) * 8 + 3 + 7;
+	if (s->level > 0 && s->strategy != Z_FIXED) {
+		dyn_bits = build_dynamic_trees (s);
 	}
 
-	return Z_OK;
+	if (can_store && (s->level == 0 || (stored_bits <= fixed_bits && stored_bits <= dyn_bits))) {
+		send_stored (s, s->window + s->block_start, stored_len, last);
+	} else if (dyn_bits < fixed_bits) {
+		write_bits (s, last? 1: 0, 1); /* Final block bit */
+		write_bits (s, BLOCK_DYNAMIC, 2); /* Block type 10 */
+		send_dynamic_trees (s);
+		compress_block_codes (s, s->dyn_lcode, s->dyn_llen, s->dyn_dcode, s->dyn_dlen);
+	} else {
+		write_bits (s, last? 1: 0, 1); /* Final block bit */
+		write_bits (s, BLOCK_FIXED, 2); /* Block type 01 */
+		compress_block_codes (s, s->fixed_lcode, s->fixed_llen, s->fixed_dcode, s->fixed_dlen);
+	}
+	init_block (s);
+	s->block_start = (long)s->strstart;
+}
+
+/* ----------- LZ77 matching ----------- */
+
+/* Read input into the window, updating the wrapper checksum */
+static uint32_t read_buf(z_stream *strm, deflate_state *s, uint8_t *buf, uint32_t size) {
+	uint32_t len = strm->avail_in < size? strm->avail_in: size;
+	if (len == 0) {
+		return 0;
+	}
+	memcpy (buf, strm->next_in, len);
+	if (s->wrap == WRAP_GZIP) {
+		s->check = otezip_crc32 (s->check, buf, len);
+	} else if (s->wrap == WRAP_ZLIB) {
+		s->check = deflate_adler32 (s->check, buf, len);
+	}
+	strm->next_in += len;
+	strm->avail_in -= len;
+	strm->total_in += len;
+	return len;
 }
 
-/* Flush remaining bits in buffer */
-static int flush_bits(z_stream *strm, deflate_state *state) {
-	/* Flush any remaining bits */
-	if (state->bits_in_buffer > 0) {
-		if (strm->avail_out == 0) {
-			return Z_BUF_ERROR;
+/* Slide the upper window half down once strstart gets close to the end */
+static void slide_window(deflate_state *s) {
+	uint32_t w = s->w_size;
+	memcpy (s->window, s->window + w, w);
+	s->match_start -= w;
+	s->strstart -= w;
+	s->block_start -= (long)w;
+	for (uint32_t i = 0; i < DEF_HASH_SIZE; i++) {
+		uint32_t m = s->head[i];
+		s->head[i] = (uint16_t)(m >= w? m - w: DEF_NIL);
+	}
+	for (uint32_t i = 0; i < w; i++) {
+		uint32_t m = s->prev[i];
+		s->prev[i] = (uint16_t)(m >= w? m - w: DEF_NIL);
+	}
+}
+
+/* Top up the lookahead from the input stream */
+static void fill_window(z_stream *strm, deflate_state *s) {
+	do {
+		if (s->strstart >= s->w_size + s->max_dist) {
+			slide_window (s);
 		}
+		if (strm->avail_in == 0) {
+			return;
+		}
+		uint32_t more = 2 * s->w_size - s->lookahead - s->strstart;
+		s->lookahead += read_buf (strm, s, s->window + s->strstart + s->lookahead, more);
+	} while (s->lookahead < DEF_MIN_LOOKAHEAD && strm->avail_in != 0);
+}
 
-		*strm->next_out++ = state->bit_buffer & 0xFF;
-		strm->avail_out--;
-		strm->total_out++;
+/* Insert the string at pos into the hash chains; returns the previous head */
+static inline uint32_t insert_string(deflate_state *s, uint32_t pos) {
+	uint32_t h = calculate_hash (s->window + pos, DEF_HASH_BITS);
+	uint32_t head = s->head[h];
+	s->prev[pos & s->w_mask] = (uint16_t)head;
+	s->head[h] = (uint16_t)pos;
+	return head;
+}
 
-		state->bit_buffer = 0;
-		state->bits_in_buffer = 0;
+/* Find longest match at current position.
+ * Walks the hash chain starting at cur_match, visiting at most max_chain
+ * candidates (a quarter when the previous match was already good), and
+ * stops early once a match of nice_length is found. Only matches longer
+ * than prev_length are considered. */
+static uint32_t find_longest_match(deflate_state *s, uint32_t cur_match) {
+	uint32_t chain = s->cfg.max_chain;
+	const uint8_t *scan = s->window + s->strstart;
+	uint32_t best_len = s->prev_length;
+	uint32_t nice = s->cfg.nice_length;
+	uint32_t max_len = s->lookahead < DEF_MAX_MATCH? s->lookahead: DEF_MAX_MATCH;
+	uint32_t limit = s->strstart > s->max_dist? s->strstart - s->max_dist: DEF_NIL;
+
+	if (best_len >= s->cfg.good_length) {
+		chain >>= 2;
 	}
+	if (nice > max_len) {
+		nice = max_len;
+	}
+	if (best_len >= max_len) {
+		return best_len;
+	}
+	do {
+		const uint8_t *match = s->window + cur_match;
+		/* Quick reject: the byte that would extend the best match must
+		 * agree, as must the first two bytes */
+		if (match[best_len] != scan[best_len] || match[best_len - 1] != scan[best_len - 1] ||
+			match[0] != scan[0] || match[1] != scan[1]) {
+			continue;
+		}
+		uint32_t len = 2;
+		while (len < max_len && match[len] == scan[len]) {
+			len++;
+		}
+		if (len > best_len) {
+			s->match_start = cur_match;
+			best_len = len;
+			if (len >= nice) {
+				break;
+			}
+		}
+	} while ((cur_match = s->prev[cur_match & s->w_mask]) > limit && --chain != 0);
+	return best_len;
+}
 
-	return Z_OK;
+/* Emit the current block and try to push it out; returns 0 when the
+ * caller must stop because next_out is full */
+static int def_block_flushed(z_stream *strm, deflate_state *s, int last) {
+	flush_block (s, last);
+	flush_pending (strm, s);
+	return strm->avail_out != 0;
 }
 
-/* Initialize static Huffman tables for deflate */
-static void init_fixed_huffman_deflate(deflate_state *state) {
-	/* Same tables as used in inflate */
-	for (int i = 0; i < 144; i++) {
-		state->literals.codes[i] = 0x30 + i; /* 8 bits, 00110000 + i */
-		state->literals.lengths[i] = 8;
+/* Finish the stream or a flush point once the input is exhausted */
+static deflate_result def_finish_pass(deflate_state *s, int flush) {
+	if (flush == Z_FINISH) {
+		flush_block (s, 1);
+		return DEF_FINISH_DONE;
 	}
-	for (int i = 144; i < 256; i++) {
-		state->literals.codes[i] = 0x190 + (i - 144); /* 9 bits, 110010000 + (i - 144) */
-		state->literals.lengths[i] = 9;
+	if (s->sym_next > 0 || (long)s->strstart != s->block_start) {
+		flush_block (s, 0);
 	}
-	for (int i = 256; i < 280; i++) {
-		state->literals.codes[i] = 0 + (i - 256); /* 7 bits, 0000000 + (i - 256) */
-		state->literals.lengths[i] = 7;
+	return DEF_BLOCK_DONE;
+}
+
+/* Level 0: copy the input into stored blocks, at most max_dist bytes each
+ * so the block never slides out of the window */
+static deflate_result deflate_stored(z_stream *strm, deflate_state *s, int flush) {
+	for (;;) {
+		if (s->lookahead == 0) {
+			fill_window (strm, s);
+			if (s->lookahead == 0) {
+				break;
+			}
+		}
+		s->strstart += s->lookahead;
+		s->lookahead = 0;
+		if ((long)s->strstart - s->block_start >= (long)s->max_dist && !def_block_flushed (strm, s, 0)) {
+			return DEF_NEED_MORE;
+		}
 	}
-	for (int i = 280; i < 288; i++) {
-		state->literals.codes[i] = 0xC0 + (i - 280); /* 8 bits, 11000000 + (i - 280) */
-		state->literals.lengths[i] = 8;
+	if (flush == Z_NO_FLUSH) {
+		return DEF_NEED_MORE;
 	}
-	state->literals.count = 288;
+	return def_finish_pass (s, flush);
+}
 
-	/* Distance codes */
-	for (int i = 0; i < 32; i++) {
-		state->distances.codes[i] = i; /* 5 bits */
-		state->distances.lengths[i] = 5;
+/* Greedy parsing (levels 1-3): take the longest match at each position
+ * and only insert hashes for the bytes of short matches. */
+static deflate_result deflate_fast(z_stream *strm, deflate_state *s, int flush) {
+	for (;;) {
+		if (s->lookahead < DEF_MIN_LOOKAHEAD) {
+			fill_window (strm, s);
+			if (s->lookahead < DEF_MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
+				return DEF_NEED_MORE;
+			}
+			if (s->lookahead == 0) {
+				break;
+			}
+		}
+		uint32_t hash_head = DEF_NIL;
+		if (s->lookahead >= DEF_MIN_MATCH) {
+			hash_head = insert_string (s, s->strstart);
+		}
+		s->match_length = DEF_MIN_MATCH - 1;
+		if (hash_head != DEF_NIL && s->strstart - hash_head <= s->max_dist && s->strategy != Z_HUFFMAN_ONLY) {
+			s->match_length = find_longest_match (s, hash_head);
+		}
+		int bflush;
+		if (s->match_length >= DEF_MIN_MATCH) {
+			bflush = tally_match (s, s->strstart - s->match_start, s->match_length);
+			s->lookahead -= s->match_length;
+			if (s->match_length <= s->cfg.max_lazy && s->lookahead >= DEF_MIN_MATCH) {
+				/* Insert the covered strings too */
+				s->match_length--;
+				do {
+					s->strstart++;
+					insert_string (s, s->strstart);
+				} while (--s->match_length != 0);
+				s->strstart++;
+			} else {
+				s->strstart += s->match_length;
+				s->match_length = 0;
+			}
+		} else {
+			bflush = tally_lit (s, s->window[s->strstart]);
+			s->lookahead--;
+			s->strstart++;
+		}
+		if (bflush && !def_block_flushed (strm, s, 0)) {
+			return DEF_NEED_MORE;
+		}
 	}
-	state->distances.count = 32;
+	return def_finish_pass (s, flush);
 }
 
-/* Write a Huffman code to output */
-static int write_huffman_code(z_stream *strm, deflate_state *state, uint16_t code, uint8_t code_length) {
-	return write_bits (strm, state, code, code_length);
+/* Lazy parsing (levels 4-9): before committing to a match, check whether
+ * the next position starts a longer one and emit a literal instead. */
+static deflate_result deflate_slow(z_stream *strm, deflate_state *s, int flush) {
+	for (;;) {
+		if (s->lookahead < DEF_MIN_LOOKAHEAD) {
+			fill_window (strm, s);
+			if (s->lookahead < DEF_MIN_LOOKAHEAD && flush == Z_NO_FLUSH) {
+				return DEF_NEED_MORE;
+			}
+			if (s->lookahead == 0) {
+				break;
+			}
+		}
+		uint32_t hash_head = DEF_NIL;
+		if (s->lookahead >= DEF_MIN_MATCH) {
+			hash_head = insert_string (s, s->strstart);
+		}
+
+		/* Find the longest match, discarding those <= prev_length */
+		s->prev_length = s->match_length;
+		s->prev_match = s->match_start;
+		s->match_length = DEF_MIN_MATCH - 1;
+		if (hash_head != DEF_NIL && s->prev_length < s->cfg.max_lazy &&
+			s->strstart - hash_head <= s->max_dist && s->strategy != Z_HUFFMAN_ONLY) {
+			s->match_length = find_longest_match (s, hash_head);
+			/* A distant length-3 match costs more than three literals */
+			if (s->match_length <= 5 && (s->strategy == Z_FILTERED ||
+				(s->match_length == DEF_MIN_MATCH && s->strstart - s->match_start > DEF_TOO_FAR))) {
+				s->match_length = DEF_MIN_MATCH - 1;
+			}
+		}
+
+		if (s->prev_length >= DEF_MIN_MATCH && s->match_length <= s->prev_length) {
+			/* The previous match is at least as good: emit it */
+			uint32_t max_insert = s->strstart + s->lookahead - DEF_MIN_MATCH;
+			int bflush = tally_match (s, s->strstart - 1 - s->prev_match, s->prev_length);
+			s->lookahead -= s->prev_length - 1;
+			s->prev_length -= 2;
+			do {
+				if (++s->strstart <= max_insert) {
+					insert_string (s, s->strstart);
+				}
+			} while (--s->prev_length != 0);
+			s->match_available = 0;
+			s->match_length = DEF_MIN_MATCH - 1;
+			s->strstart++;
+			if (bflush && !def_block_flushed (strm, s, 0)) {
+				return DEF_NEED_MORE;
+			}
+		} else if (s->match_available) {
+			/* No better match here: emit the previous byte as a literal.
+			 * The block closes before strstart moves on, since the byte
+			 * there is still waiting to be tallied. */
+			int bflush = tally_lit (s, s->window[s->strstart - 1]);
+			if (bflush) {
+				flush_block (s, 0);
+				flush_pending (strm, s);
+			}
+			s->strstart++;
+			s->lookahead--;
+			if (strm->avail_out == 0) {
+				return DEF_NEED_MORE;
+			}
+		} else {
+			/* Wait one step to see whether the next match is longer */
+			s->match_available = 1;
+			s->strstart++;
+			s->lookahead--;
+		}
+	}
+	if (s->match_available) {
+		tally_lit (s, s->window[s->strstart - 1]);
+		s->match_available = 0;
+	}
+	return def_finish_pass (s, flush);
 }
 
 /* ----------- Main encoder API functions ----------- */
@@ -200,328 +888,216 @@ int deflateInit2(z_stream *strm, int level, int method, int windowBits, int memL
 	if (!strm) {
 		return Z_STREAM_ERROR;
 	}
-	(void)method;
 	(void)memLevel;
-	(void)strategy;
 
-	/* Validate parameters - handle negative windowBits for raw deflate */
-	int abs_windowBits = windowBits < 0? -windowBits: windowBits;
-	if (abs_windowBits < 8 || abs_windowBits > 15) {
+	/* windowBits < 0: raw deflate, 8..15: zlib wrapper, 24..31: gzip wrapper */
+	wrap_format wrap = WRAP_ZLIB;
+	if (windowBits < 0) {
+		wrap = WRAP_NONE;
+		windowBits = -windowBits;
+	} else if (windowBits > 15) {
+		wrap = WRAP_GZIP;
+		windowBits -= 16;
+	}
+	if (windowBits < 8 || windowBits > 15 || method != Z_DEFLATED) {
 		return Z_STREAM_ERROR;
 	}
+	if (windowBits == 8) {
+		windowBits = 9; /* A 256-byte window cannot hold a full lookahead */
+	}
 
 	/* Normalize compression level */
 	if (level == Z_DEFAULT_COMPRESSION) {
 		level = 6;
 	}
-
-	/* Allocate state */
-	deflate_state *state = (deflate_state *)calloc (1, sizeof (deflate_state));
-	if (!state) {
-		return Z_MEM_ERROR;
+	if (level < 0 || level > 9) {
+		return Z_STREAM_ERROR;
 	}
 
-	/* Calculate window size (2^windowBits) */
-	state->window_size = 1 << abs_windowBits;
-	state->window_mask = state->window_size - 1;
-
-	/* Allocate sliding window */
-	state->window = (uint8_t *)malloc (state->window_size);
-	if (!state->window) {
-		free (state);
+	/* Allocate state */
+	deflate_state *s = (deflate_state *)calloc (1, sizeof (deflate_state));
+	if (!s) {
 		return Z_MEM_ERROR;
 	}
-
-	/* Allocate hash table - size depends on window size */
-	state->hash_size = 1 << (abs_windowBits - 3); /* Smaller than window for memory efficiency */
-	state->hash_mask = state->hash_size - 1;
-	state->hash_table = (uint16_t *)calloc (state->hash_size, sizeof (uint16_t));
-	if (!state->hash_table) {
-		free (state->window);
-		free (state);
+	s->level = level;
+	s->strategy = strategy;
+	s->cfg = deflate_levels[level];
+	s->wrap = wrap;
+	s->w_size = 1u << windowBits;
+	s->w_mask = s->w_size - 1;
+	s->max_dist = s->w_size - DEF_MIN_LOOKAHEAD;
+
+	/* The window is padded so match checks may read past the lookahead.
+	 * Pending output must hold one full block (under 4 bytes per symbol
+	 * with fixed codes, or the whole window when stored) plus the
+	 * wrapper and flush marker bytes. */
+	s->window = (uint8_t *)calloc (2 * s->w_size + DEF_MAX_MATCH, 1);
+	s->head = (uint16_t *)calloc (DEF_HASH_SIZE, sizeof (uint16_t));
+	s->prev = (uint16_t *)calloc (s->w_size, sizeof (uint16_t));
+	s->sym_lc = (uint8_t *)malloc (DEF_LIT_BUFSIZE);
+	s->sym_dist = (uint16_t *)malloc (DEF_LIT_BUFSIZE * sizeof (uint16_t));
+	s->pending_size = (4 * DEF_LIT_BUFSIZE > 2 * s->w_size? 4 * DEF_LIT_BUFSIZE: 2 * s->w_size) + 64;
+	s->pending_buf = (uint8_t *)malloc (s->pending_size);
+	strm->state = s;
+	if (!s->window || !s->head || !s->prev || !s->sym_lc || !s->sym_dist || !s->pending_buf) {
+		deflateEnd (strm);
 		return Z_MEM_ERROR;
 	}
 
 	/* Initialize state */
-	state->level = level;
-	state->is_last_block = 0;
-	state->window_pos = 0;
-	state->bit_buffer = 0;
-	state->bits_in_buffer = 0;
-
-	/* Initialize Huffman tables */
-	init_fixed_huffman_deflate (state);
+	s->status = DEF_INIT;
+	s->check = wrap == WRAP_ZLIB? 1: 0;
+	s->match_length = s->prev_length = DEF_MIN_MATCH - 1;
+	init_fixed_huffman_deflate (s);
+	init_block (s);
 
-	strm->state = state;
 	strm->total_in = 0;
 	strm->total_out = 0;
 
 	return Z_OK;
 }
 
-int deflate(z_stream *strm, int flush) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
-	}
-	deflate_state *state = (deflate_state *)strm->state;
-
-	/* Check if this is the final block */
-	if (flush == Z_FINISH) {
-		state->is_last_block = 1;
-	}
-
-	/* If no compression wanted or very small level, just store uncompressed */
-	if (state->level == Z_NO_COMPRESSION) {
-		if (strm->avail_in > 0) {
-			/* Calculate block size - length fields + data */
-			uint32_t block_size = 4 + strm->avail_in;
-
-			/* Check if we have enough output space */
-			if (strm->avail_out < block_size) {
-				return Z_BUF_ERROR;
-			}
-
-			/* Write block header using bit buffer - final bit + type 00 (uncompressed) */
-			int ret = write_bits (strm, state, state->is_last_block? 1: 0, 1); /* Final block bit */
-			if (ret != Z_OK) {
-				return ret;
-			}
-
-			ret = write_bits (strm, state, 0, 2); /* Block type 00 */
-			if (ret != Z_OK) {
-				return ret;
-			}
-
-			/* Flush remaining bits to achieve byte alignment for uncompressed data */
-			flush_bits (strm, state);
-
-			/* Write length and inverted length */
-			uint16_t len = strm->avail_in > 0xFFFF? 0xFFFF: strm->avail_in;
-			*strm->next_out++ = len & 0xFF;
-			*strm->next_out++ = (len >> 8) & 0xFF;
-			*strm->next_out++ = (~len) & 0xFF;
-			*strm->next_out++ = ((~len) >> 8) & 0xFF;
-			strm->avail_out -= 4;
-			strm->total_out += 4;
-
-			/* Write data */
-			memcpy (strm->next_out, strm->next_in, len);
-			strm->next_in += len;
-			strm->avail_in -= len;
-			strm->total_in += len;
-			strm->next_out += len;
-			strm->avail_out -= len;
-			strm->total_out += len;
+/* Queue the zlib or gzip header */
+static void write_wrapper_header(deflate_state *s) {
+	if (s->wrap == WRAP_ZLIB) {
+		/* CMF: deflate with window size; FLG: level hint + check bits */
+		uint32_t window_log = 0;
+		while ((1u << (window_log + 1)) <= s->w_size) {
+			window_log++;
 		}
-		return flush == Z_FINISH? Z_STREAM_END: Z_OK;
+		uint32_t header = (8 + ((window_log - 8) << 4)) << 8;
+		uint32_t level_flags = s->level < 2? 0: s->level < 6? 1: s->level == 6? 2: 3;
+		header |= level_flags << 6;
+		header += 31 - (header % 31);
+		def_put_byte (s, (uint8_t)(header >> 8));
+		def_put_byte (s, (uint8_t)header);
+	} else if (s->wrap == WRAP_GZIP) {
+		static const uint8_t gz_header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3 };
+		memcpy (s->pending_buf + s->pending, gz_header, sizeof (gz_header));
+		/* XFL: 2 = best compression, 4 = fastest */
+		s->pending_buf[s->pending + 8] = s->level == 9? 2: s->level == 1? 4: 0;
+		s->pending += sizeof (gz_header);
 	}
+}
 
-	/* Use fixed Huffman codes for simplicity */
-	if (strm->avail_in > 0) {
-		/* Write block header - type 01 (fixed Huffman) */
-		int ret = write_bits (strm, state, state->is_last_block? 1: 0, 1); /* Final block bit */
-		if (ret != Z_OK) {
-			return ret;
+/* Queue the zlib or gzip trailer */
+static void write_wrapper_trailer(z_stream *strm, deflate_state *s) {
+	if (s->wrap == WRAP_ZLIB) {
+		def_put_byte (s, (uint8_t)(s->check >> 24));
+		def_put_byte (s, (uint8_t)(s->check >> 16));
+		def_put_byte (s, (uint8_t)(s->check >> 8));
+		def_put_byte (s, (uint8_t)s->check);
+	} else if (s->wrap == WRAP_GZIP) {
+		uint32_t isize = (uint32_t)strm->total_in;
+		for (int i = 0; i < 4; i++) {
+			def_put_byte (s, (uint8_t)(s->check >> (8 * i)));
 		}
-
-		ret = write_bits (strm, state, 1, 2); /* Block type 01 */
-		if (ret != Z_OK) {
-			return ret;
+		for (int i = 0; i < 4; i++) {
+			def_put_byte (s, (uint8_t)(isize >> (8 * i)));
 		}
+	}
+}
 
-		/* Process all input data */
-		while (strm->avail_in > 0) {
-			/* Ensure we have output space for a worst-case symbol */
-			if (strm->avail_out < 4) { /* Conservative estimate */
-				return Z_BUF_ERROR;
-			}
-
-			/* Look for a match */
-			uint32_t match_pos = 0;
-			uint32_t max_look_ahead = strm->avail_in > 258? 258: strm->avail_in;
-			uint32_t match_len = 0;
-
-			/* Skip match search for level < 3 or not enough data */
-			if (state->level >= 3 && max_look_ahead >= 3) {
-				match_len = find_longest_match (state, strm->next_in, state->window_pos, max_look_ahead, &match_pos);
-			}
-
-			if (match_len >= 3) {
-				/* Encode length/distance pair */
-
-				/* Determine length code */
-				uint16_t length_code;
-				uint8_t extra_bits;
-
-				/* Calculate length code and extra bits more efficiently */
-				if (match_len <= 10) {
-					length_code = 257 + (match_len - 3);
-					extra_bits = 0;
-				} else if (match_len <= 34) {
-					/* Use binary search for mid-range */
-					if (match_len <= 18) {
-						length_code = 265 + ((match_len - 11) >> 1);
-						extra_bits = 1;
-					} else {
-						length_code = 269 + ((match_len - 19) >> 2);
-						extra_bits = 2;
-					}
-				} else if (match_len <= 130) {
-					if (match_len <= 66) {
-						length_code = 273 + ((match_len - 35) >> 3);
-						extra_bits = 3;
-					} else {
-						length_code = 277 + ((match_len - 67) >> 4);
-						extra_bits = 4;
-					}
-				} else {
-					length_code = 281 + ((match_len - 131) >> 5);
-					extra_bits = 5;
-				}
-
-				/* Write length code */
-				write_huffman_code (strm, state, state->literals.codes[length_code], state->literals.lengths[length_code]);
-
-				/* Write extra bits for length if needed */
-				if (extra_bits > 0) {
-					/* Calculate extra bits value - it's just the remainder when dividing by 2^extra_bits */
-					int extra_value = (match_len - (extra_bits == 1? 11: extra_bits == 2? 19
-										: extra_bits == 3? 35
-										: extra_bits == 4? 67
-													: 131)) &
-						((1 << extra_bits) - 1);
-					write_bits (strm, state, extra_value, extra_bits);
-				}
-
-				/* Calculate distance */
-				uint32_t distance = state->window_pos - match_pos;
-
-				/* Determine distance code */
-				uint16_t distance_code;
-				uint8_t dist_extra_bits;
-
-				/* Calculate distance code and extra bits - simplify with binary search */
-				if (distance <= 4) {
-					distance_code = distance - 1;
-					dist_extra_bits = 0;
-				} else if (distance <= 256) {
-					/* Use binary search for common case */
-					if (distance <= 32) {
-						if (distance <= 16) {
-							if (distance <= 8) {
-								distance_code = 4 + ((distance - 5) >> 1);
-								dist_extra_bits = 1;
-							} else {
-								distance_code = 6 + ((distance - 9) >> 2);
-								dist_extra_bits = 2;
-							}
-						} else {
-							distance_code = 8 + ((distance - 17) >> 3);
-							dist_extra_bits = 3;
-						}
-					} else if (distance <= 128) {
-						if (distance <= 64) {
-							distance_code = 10 + ((distance - 33) >> 4);
-							dist_extra_bits = 4;
-						} else {
-							distance_code = 12 + ((distance - 65) >> 5);
-							dist_extra_bits = 5;
-						}
-					} else {
-						distance_code = 14 + ((distance - 129) >> 6);
-						dist_extra_bits = 6;
-					}
-				} else {
-					/* Calculate for larger distances */
-					if (distance <= 4096) {
-						if (distance <= 1024) {
-							if (distance <= 512) {
-								distance_code = 16 + ((distance - 257) >> 7);
-								dist_extra_bits = 7;
-							} else {
-								distance_code = 18 + ((distance - 513) >> 8);
-								dist_extra_bits = 8;
-							}
-						} else if (distance <= 2048) {
-							distance_code = 20 + ((distance - 1025) >> 9);
-							dist_extra_bits = 9;
-						} else {
-							distance_code = 22 + ((distance - 2049) >> 10);
-							dist_extra_bits = 10;
-						}
-					} else {
-						if (distance <= 16384) {
-							if (distance <= 8192) {
-								distance_code = 24 + ((distance - 4097) >> 11);
-								dist_extra_bits = 11;
-							} else {
-								distance_code = 26 + ((distance - 8193) >> 12);
-								dist_extra_bits = 12;
-							}
-						} else {
-							distance_code = 28 + ((distance - 16385) >> 13);
-							dist_extra_bits = 13;
-						}
-					}
-				}
-
-				/* Write distance code */
-				write_huffman_code (strm, state, state->distances.codes[distance_code], state->distances.lengths[distance_code]);
-
-				/* Write extra bits for distance if needed */
-				if (dist_extra_bits > 0) {
-					/* Calculate base distance value based on distance code */
-					const uint16_t dist_base_values[] = { 1, 5, 9, 17, 33, 65, 129, 257, 513, 1025, 2049, 4097, 8193, 16385 };
-					uint16_t base_dist = dist_base_values[dist_extra_bits];
-
-					/* Get remainder by masking with appropriate bit mask */
-					int extra_value = (distance - base_dist) &((1 << dist_extra_bits) - 1);
-					write_bits (strm, state, extra_value, dist_extra_bits);
-				}
-
-				/* Update input position and window */
-				for (uint32_t i = 0; i < match_len; i++) {
-					/* Add to sliding window */
-					state->window[state->window_pos] = *strm->next_in;
-					state->window_pos = (state->window_pos + 1) & state->window_mask;
-
-					/* Update input position */
-					strm->next_in++;
-					strm->avail_in--;
-					strm->total_in++;
-
-					/* If we've used all input, we're done */
-					if (strm->avail_in == 0) {
-						break;
-					}
-				}
-			} else {
-				/* No match, output literal */
-				uint8_t literal = *strm->next_in;
+int deflate(z_stream *strm, int flush) {
+	if (!strm || !strm->state || flush < Z_NO_FLUSH || flush > Z_FINISH) {
+		return Z_STREAM_ERROR;
+	}
+	deflate_state *s = (deflate_state *)strm->state;
+	if (!strm->next_out || (!strm->next_in && strm->avail_in != 0)) {
+		return Z_STREAM_ERROR;
+	}
 
-				/* Write literal code */
-				write_huffman_code (strm, state, state->literals.codes[literal], state->literals.lengths[literal]);
+	if (s->status == DEF_INIT) {
+		write_wrapper_header (s);
+		s->status = DEF_BUSY;
+	}
 
-				/* Update input position and window */
-				state->window[state->window_pos] = literal;
-				state->window_pos = (state->window_pos + 1) & state->window_mask;
+	/* Drain output left over from a previous call first */
+	flush_pending (strm, s);
+	if (s->pending != 0) {
+		return Z_OK;
+	}
+	if (s->status == DEF_FINISHED) {
+		return strm->avail_in == 0? Z_STREAM_END: Z_STREAM_ERROR;
+	}
+	if (strm->avail_out == 0) {
+		return Z_BUF_ERROR;
+	}
 
-				strm->next_in++;
-				strm->avail_in--;
-				strm->total_in++;
-			}
-		}
+	deflate_result r;
+	if (s->level == 0) {
+		r = deflate_stored (strm, s, flush);
+	} else if (s->cfg.lazy) {
+		r = deflate_slow (strm, s, flush);
+	} else {
+		r = deflate_fast (strm, s, flush);
+	}
+	if (r == DEF_FINISH_DONE) {
+		flush_bits (s);
+		write_wrapper_trailer (strm, s);
+		s->status = DEF_FINISHED;
+	} else if (r == DEF_BLOCK_DONE) {
+		/* Sync flush: an empty stored block aligns the output to a byte
+		 * boundary so everything so far can be decoded */
+		send_stored (s, NULL, 0, 0);
+	}
+	flush_pending (strm, s);
+	if (s->status == DEF_FINISHED && s->pending == 0) {
+		return Z_STREAM_END;
+	}
+	return Z_OK;
+}
 
-		/* If this is the end of stream, write end of block marker */
-		if (flush == Z_FINISH) {
-			/* Write end of block symbol (256) */
-			write_huffman_code (strm, state, state->literals.codes[256], state->literals.lengths[256]);
-			/* Flush remaining bits */
-			flush_bits (strm, state);
-		}
+/* Start a new stream with the same parameters, keeping the buffers. Only
+ * the hash heads need clearing: prev, the window and the symbol buffers
+ * are always written before they are read. */
+int deflateReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
 	}
+	deflate_state *s = (deflate_state *)strm->state;
+	memset (s->head, 0, DEF_HASH_SIZE * sizeof (uint16_t));
+	s->status = DEF_INIT;
+	s->check = s->wrap == WRAP_ZLIB? 1: 0;
+	s->strstart = 0;
+	s->lookahead = 0;
+	s->block_start = 0;
+	s->match_start = 0;
+	s->match_length = s->prev_length = DEF_MIN_MATCH - 1;
+	s->prev_match = 0;
+	s->match_available = 0;
+	s->pending = 0;
+	s->pending_out = 0;
+	s->bit_buffer = 0;
+	s->bits_in_buffer = 0;
+	init_block (s);
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
 
-	return flush == Z_FINISH? Z_STREAM_END: Z_OK;
+/* Prime a fresh raw stream with history: matches may reach back into
+ * the last w_size bytes of dict, which are not themselves emitted. Lets
+ * independently compressed pieces of one stream keep their ratio. */
+int deflateSetDictionary(z_stream *strm, const uint8_t *dict, uInt len) {
+	if (!strm || !strm->state || (!dict && len != 0)) {
+		return Z_STREAM_ERROR;
+	}
+	deflate_state *s = (deflate_state *)strm->state;
+	if (s->wrap != WRAP_NONE || s->status != DEF_INIT || s->strstart != 0 || s->lookahead != 0) {
+		return Z_STREAM_ERROR;
+	}
+	if (len > s->w_size) {
+		dict += len - s->w_size;
+		len = s->w_size;
+	}
+	memcpy (s->window, dict, len);
+	for (uint32_t i = 0; i + DEF_MIN_MATCH <= len; i++) {
+		insert_string (s, i);
+	}
+	s->strstart = len;
+	s->block_start = (long)len;
+	return Z_OK;
 }
 
 int deflateEnd(z_stream *strm) {
@@ -529,13 +1105,17 @@ int deflateEnd(z_stream *strm) {
 		return Z_STREAM_ERROR;
 	}
 
-	deflate_state *state = (deflate_state *)strm->state;
+	deflate_state *s = (deflate_state *)strm->state;
 
 	/* Free all allocated memory */
-	free (state->window);
-	free (state->hash_table);
-	free (state);
-
+	free (s->window);
+	free (s->head);
+	free (s->prev);
+	free (s->sym_lc);
+	free (s->sym_dist);
+	free (s->pending_buf);
+	free (s);
 	strm->state = NULL;
+
 	return Z_OK;
 }
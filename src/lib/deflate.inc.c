@@ -5,15 +5,20 @@
  *
  *   inflateInit2
  *   inflate
+ *   inflateSetDictionary, inflateGetDictionary, inflatePrime
  *   inflateEnd
  *   deflateInit2
  *   deflate
+ *   deflateSetDictionary
  *   deflateEnd
  *
  * It supports:
- * - Raw inflate/deflate (RFC 1951) with no wrappers
- * - Bare minimum functionality to support ZIP file reading/writing
- * - No checksums, dictionaries, or other advanced features
+ * - Raw deflate (RFC 1951) plus zlib and gzip wrappers
+ * - Hash-chain LZ77 matching with zlib-style compression levels
+ * - Stored, fixed or dynamic Huffman blocks, whichever is smallest
+ * - Raw preset dictionaries only
+ * - Z_BLOCK with inflatePrime/inflateSetDictionary, to resume decoding
+ *   from a saved block boundary
  *
  * Usage:
  *   #define MDEFLATE_IMPLEMENTATION in one source file before including
@@ -49,6 +54,7 @@
 #define Z_SYNC_FLUSH 2
 #define Z_FULL_FLUSH 3
 #define Z_FINISH 4
+#define Z_BLOCK 5
 
 /* Strategy values */
 #define Z_FILTERED 1
@@ -89,11 +95,17 @@ extern "C" {
 int inflateInit2(z_stream *strm, int windowBits);
 int inflateInit2_(z_stream *strm, int windowBits, const char *version, int stream_size);
 int inflate(z_stream *strm, int flush);
+int inflateReset(z_stream *strm);
+int inflateSetDictionary(z_stream *strm, const uint8_t *dict, uInt len);
+int inflateGetDictionary(z_stream *strm, uint8_t *dict, uInt *len);
+int inflatePrime(z_stream *strm, int bits, int value);
 int inflateEnd(z_stream *strm);
 
 int deflateInit2(z_stream *strm, int level, int method, int windowBits, int memLevel, int strategy);
 int deflateInit2_(z_stream *strm, int level, int method, int windowBits, int memLevel, int strategy, const char *version, int stream_size);
 int deflate(z_stream *strm, int flush);
+int deflateReset(z_stream *strm);
+int deflateSetDictionary(z_stream *strm, const uint8_t *dict, uInt len);
 int deflateEnd(z_stream *strm);
 
 #ifdef __cplusplus
@@ -103,12 +115,8 @@ int deflateEnd(z_stream *strm);
 /* ------------- Implementation ------------- */
 #ifdef MDEFLATE_IMPLEMENTATION
 
-/* Huffman code table */
-typedef struct {
-	uint16_t codes[288]; /* Huffman codes */
-	uint8_t lengths[288]; /* Code lengths */
-	uint16_t count; /* Number of codes */
-} huffman_table;
+/* CRC-32 for the gzip wrapper (shared with the archive code) */
+#include "crc32.inc.c"
 
 /* Block type */
 typedef enum {
@@ -118,11 +126,53 @@ typedef enum {
 	BLOCK_INVALID = 3
 } block_type;
 
+/* Wrapper format types */
+typedef enum {
+	WRAP_NONE = 0, /* Raw deflate */
+	WRAP_ZLIB = 1, /* zlib header */
+	WRAP_GZIP = 2, /* gzip header */
+	WRAP_AUTO = 3 /* Auto-detect zlib or gzip */
+} wrap_format;
+
+/* Length (symbols 257..285) and distance (0..29) bases and extra bits,
+ * RFC 1951 section 3.2.5. Shared by the encoder and the decoder. */
+static const uint16_t deflate_length_base[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t deflate_length_extra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t deflate_dist_base[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t deflate_dist_extra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
 /* ----------- Utility Functions ----------- */
 
-/* Calculate hash for LZ77 */
-static uint32_t calculate_hash(const uint8_t *data) {
-	return ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | data[2];
+/* Calculate hash for LZ77 (multiplicative hash of the next 3 bytes) */
+static inline uint32_t calculate_hash(const uint8_t *data, int bits) {
+	uint32_t v = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16);
+	return (v * 0x9E3779B1u) >> (32 - bits);
+}
+
+/* Adler-32 checksum used by the zlib wrapper */
+static uint32_t deflate_adler32(uint32_t adler, const uint8_t *buf, size_t len) {
+	uint32_t a = adler & 0xFFFF;
+	uint32_t b = adler >> 16;
+	while (len > 0) {
+		/* 5552 is the largest n keeping b below 2^32 before the modulo */
+		size_t n = len < 5552? len: 5552;
+		len -= n;
+		while (n-- > 0) {
+			a += *buf++;
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	return (b << 16) | a;
 }
 
 /* Include the encoder and decoder files */
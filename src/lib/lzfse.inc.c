@@ -1,6 +1,6 @@
 /*
- * lzfse_min.h — a single-file, MIT-licensed *minimal* implementation of
- * Apple’s LZFSE compressor / decompressor (≈800 LOC).
+ * lzfse_min.h — a single-file, MIT-licensed implementation of Apple’s
+ * LZFSE compressor / decompressor.
  *
  *   ┌───────────────────────────────────────────────────────────────┐
  *   │  size_t lzfse_compress (const void *in,  size_t in_sz,       │
@@ -12,19 +12,28 @@
  *
  * They return the number of bytes written or 0 on error/overflow.
  *
- * COMPRESSOR – deliberately simple: a greedy LZ77 parser followed by a
- *              single raw-LZFSE block (tag 0x06).  This keeps the code
- *              tiny while still yielding ~40–60 % size reduction on
- *              typical text / binaries. (Swap in a fancier parser + FSE
- *              encoder later if you need parity with Apple’s ratios.)
+ * The stream is a sequence of blocks, each starting with a 4-byte magic,
+ * and ends with "bvx$":
  *
- * DECOMPRESSOR – fully spec-compliant for *raw* LZFSE streams: it can
- *                unpack 0x06 (uncompressed), 0x00/0x01/0x02 (LZVN), and
- *                0x03/0x04/0x05 (LZFSE w/ FSE) blocks.  It passes the
- *                Apple reference test-vectors.
+ *   bvx2  LZFSE v2 block: a packed header with the normalized frequency
+ *         tables, then four interleaved FSE streams of literals and one
+ *         FSE stream of (L, M, D) triples, both written back to front
+ *   bvxn  LZVN block: byte-aligned opcodes, used for small inputs
+ *   bvx-  uncompressed block
  *
- * No dynamic allocation, no I/O, and no reliance on private Apple
- * headers.  Works on any C99 compiler; add `extern "C"` wrappers for C++.
+ * COMPRESSOR – inputs under 4 KiB go through LZVN; larger ones through a
+ *              hash-chain parser with one step of lazy matching that fills
+ *              v2 blocks of up to 10000 matches / 40000 literals.  A block
+ *              that would not shrink is stored as "bvx-" instead.
+ *
+ * DECOMPRESSOR – v2, LZVN and uncompressed blocks; matches may reach back
+ *                into earlier blocks.  v1 blocks (unpacked header, never
+ *                written by Apple's encoder) are rejected.  Entries written
+ *                by older otezip versions (a single 0x06 raw block) still
+ *                decode.
+ *
+ * No I/O and no reliance on private Apple headers.  Works on any C99
+ * compiler; add `extern "C"` wrappers for C++.
  *
  * © 2025 OpenAI - o3 – MIT License.  See end of file for license text.
  */
@@ -34,6 +43,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef __cplusplus
@@ -47,240 +57,1346 @@ size_t lzfse_compress(const void *in, size_t in_sz, void *out, size_t out_cap);
 size_t lzfse_decompress(const void *in, size_t in_sz, void *out, size_t out_cap);
 
 /* ================================================================
-Compile-time configuration
+Format constants
 ================================================================ */
-#ifndef LZFSE_MAX_MATCH
-#define LZFSE_MAX_MATCH 273
-#endif
-#ifndef LZFSE_MIN_MATCH
-#define LZFSE_MIN_MATCH 3
-#endif
-#ifndef LZFSE_WINDOW_LOG
-#define LZFSE_WINDOW_LOG 21 /* 2 MiB sliding window */
+#define LZFSE_ENDOFSTREAM_MAGIC 0x24787662u /* "bvx$" */
+#define LZFSE_UNCOMPRESSED_MAGIC 0x2d787662u /* "bvx-" */
+#define LZFSE_COMPRESSEDV1_MAGIC 0x31787662u /* "bvx1" */
+#define LZFSE_COMPRESSEDV2_MAGIC 0x32787662u /* "bvx2" */
+#define LZFSE_COMPRESSEDLZVN_MAGIC 0x6e787662u /* "bvxn" */
+#define LZFSE_LEGACY_RAW_TAG 0x06 /* single raw block of otezip <= 0.x */
+
+#define LZFSE_L_SYMBOLS 20
+#define LZFSE_M_SYMBOLS 20
+#define LZFSE_D_SYMBOLS 64
+#define LZFSE_LITERAL_SYMBOLS 256
+#define LZFSE_L_STATES 64
+#define LZFSE_M_STATES 64
+#define LZFSE_D_STATES 256
+#define LZFSE_LITERAL_STATES 1024
+#define LZFSE_FREQ_COUNT (LZFSE_L_SYMBOLS + LZFSE_M_SYMBOLS + LZFSE_D_SYMBOLS + LZFSE_LITERAL_SYMBOLS)
+
+#define LZFSE_MATCHES_PER_BLOCK 10000
+#define LZFSE_LITERALS_PER_BLOCK (4 * LZFSE_MATCHES_PER_BLOCK)
+#define LZFSE_MAX_L_VALUE 315
+#define LZFSE_MAX_M_VALUE 2359
+#define LZFSE_MAX_D_VALUE 262139
+#define LZFSE_V2_HEADER_SIZE 32 /* magic, n_raw_bytes and three packed words */
+#define LZFSE_V2_HEADER_MAX (LZFSE_V2_HEADER_SIZE + (LZFSE_FREQ_COUNT * 14 + 7) / 8)
+#define LZFSE_LZVN_HEADER_SIZE 12
+#define LZFSE_LZVN_THRESHOLD 4096 /* smaller inputs are LZVN encoded */
+#define LZVN_MIN_SRC_SIZE 8
+#define LZVN_MAX_DISTANCE 0xffff
+
+/* Encoder tuning */
+#define LZFSE_MIN_MATCH 4
+#define LZFSE_GOOD_MATCH 40 /* long enough to skip the lazy step */
+#define LZFSE_SEARCH_DEPTH 16
+#define LZFSE_HASH_LOG 16
+#define LZFSE_CHAIN_LOG 18 /* covers LZFSE_MAX_D_VALUE */
+#define LZVN_HASH_LOG 12
+#define LZFSE_BLOCK_SCRATCH (LZFSE_V2_HEADER_MAX + 5 * LZFSE_LITERALS_PER_BLOCK / 4 + 7 * LZFSE_MATCHES_PER_BLOCK + 32)
+
+/* Extra bits and base values of the L, M and D symbols */
+static const uint8_t lzfse_l_extra_bits[LZFSE_L_SYMBOLS] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 5, 8
+};
+static const int32_t lzfse_l_base_value[LZFSE_L_SYMBOLS] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 20, 28, 60
+};
+static const uint8_t lzfse_m_extra_bits[LZFSE_M_SYMBOLS] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 8, 11
+};
+static const int32_t lzfse_m_base_value[LZFSE_M_SYMBOLS] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 24, 56, 312
+};
+static const uint8_t lzfse_d_extra_bits[LZFSE_D_SYMBOLS] = {
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+};
+static const int32_t lzfse_d_base_value[LZFSE_D_SYMBOLS] = {
+	0, 1, 2, 3, 4, 6, 8, 10, 12, 16,
+	20, 24, 28, 36, 44, 52, 60, 76, 92, 108,
+	124, 156, 188, 220, 252, 316, 380, 444, 508, 636,
+	764, 892, 1020, 1276, 1532, 1788, 2044, 2556, 3068, 3580,
+	4092, 5116, 6140, 7164, 8188, 10236, 12284, 14332, 16380, 20476,
+	24572, 28668, 32764, 40956, 49148, 57340, 65532, 81916, 98300, 114684,
+	131068, 163836, 196604, 229372
+};
+
+/* ================================================================
+Internal helpers – little-endian access
+================================================================ */
+
+static inline uint16_t lzfse_load16(const uint8_t *p) {
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+static inline uint32_t lzfse_load32(const uint8_t *p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+static inline uint64_t lzfse_load64(const uint8_t *p) {
+	return (uint64_t)lzfse_load32 (p) | ((uint64_t)lzfse_load32 (p + 4) << 32);
+}
+static inline void lzfse_store16(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t) (v >> 8);
+}
+static inline void lzfse_store32(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t) (v >> 8);
+	p[2] = (uint8_t) (v >> 16);
+	p[3] = (uint8_t) (v >> 24);
+}
+static inline void lzfse_store64(uint8_t *p, uint64_t v) {
+	lzfse_store32 (p, (uint32_t)v);
+	lzfse_store32 (p + 4, (uint32_t) (v >> 32));
+}
+static inline unsigned lzfse_highbit(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return 31 - (unsigned)__builtin_clz (v);
+#else
+	unsigned n = 0;
+	while (v >>= 1) {
+		n++;
+	}
+	return n;
 #endif
-#define LZFSE_WINDOW_SIZE (1u << LZFSE_WINDOW_LOG)
+}
+static inline uint64_t lzfse_mask64(uint64_t v, int n) {
+	return n? v & (((uint64_t)1 << n) - 1): 0;
+}
+
+/* Symbol whose [base, base + 2^extra) range holds v */
+static inline int lzfse_value_symbol(const int32_t *base, int nsymbols, uint32_t v) {
+	int lo = 0;
+	int hi = nsymbols - 1;
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if ((uint32_t)base[mid] <= v) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+	return lo;
+}
 
 /* ================================================================
-Internal helpers – tiny bit reader / writer
+1. FSE – shared table layout
 ================================================================ */
 
-typedef struct {
-	const uint8_t *p, *end;
-	uint64_t acc;
-	unsigned bits;
-} br_t;
-static inline void br_init(br_t *b, const void *src, size_t len) {
-	b->p = (const uint8_t *)src;
-	b->end = b->p + len;
-	b->acc = 0;
-	b->bits = 0;
-}
-static inline uint32_t br_get(br_t *b, unsigned nb) {
-	while (b->bits < nb && b->p < b->end) {
-		b->acc |= (uint64_t) (*b->p++) << b->bits;
-		b->bits += 8;
-	}
-	uint32_t v = (uint32_t) (b->acc &((1u << nb) - 1));
-	b->acc >>= nb;
-	b->bits -= nb;
-	return v;
+/* The states of symbol i are [offset, offset + freq[i]) in symbol order;
+ * both sides derive their tables from the normalized frequencies alone, so
+ * states, deltas and bit counts must match Apple's lzfse_fse.c exactly. */
+
+/* Scale counts t[] to frequencies summing to nstates; every used symbol
+ * keeps at least one state. */
+static void lzfse_fse_normalize(int nstates, int nsymbols, const uint32_t *t, uint16_t *freq) {
+	uint32_t s_count = 0;
+	int remaining = nstates;
+	int max_freq = 0;
+	int max_freq_sym = 0;
+	int shift = 31 - (int)lzfse_highbit ((uint32_t)nstates) - 1;
+	for (int i = 0; i < nsymbols; i++) {
+		s_count += t[i];
+	}
+	uint32_t highprec_step = s_count? ((uint32_t)1 << 31) / s_count: 0;
+	for (int i = 0; i < nsymbols; i++) {
+		int f = (int) ((((t[i] * highprec_step) >> shift) + 1) >> 1);
+		if (f == 0 && t[i] != 0) {
+			f = 1;
+		}
+		freq[i] = (uint16_t)f;
+		remaining -= f;
+		if (f > max_freq) {
+			max_freq = f;
+			max_freq_sym = i;
+		}
+	}
+	if (-remaining < (max_freq >> 2)) {
+		freq[max_freq_sym] = (uint16_t) (freq[max_freq_sym] + remaining);
+		return;
+	}
+	/* Large overrun: take states back from every symbol, coarsely first */
+	int overrun = -remaining;
+	for (int s = 3; overrun > 0 && s >= 0; s--) {
+		for (int i = 0; i < nsymbols && overrun > 0; i++) {
+			if (freq[i] > 1) {
+				int n = (freq[i] - 1) >> s;
+				if (n > overrun) {
+					n = overrun;
+				}
+				freq[i] = (uint16_t) (freq[i] - n);
+				overrun -= n;
+			}
+		}
+	}
 }
 
 typedef struct {
-	uint8_t *p, *end;
-	uint64_t acc;
-	unsigned bits;
-} bw_t;
-static inline void bw_init(bw_t *b, void *dst, size_t cap) {
-	b->p = (uint8_t *)dst;
-	b->end = b->p + cap;
-	b->acc = 0;
-	b->bits = 0;
+	int16_t s0; /* states >= s0 emit k bits, the others k - 1 */
+	int16_t k;
+	int16_t delta0;
+	int16_t delta1;
+} lzfse_fse_enc;
+
+typedef struct {
+	uint8_t k;
+	uint8_t symbol;
+	int16_t delta;
+} lzfse_fse_dec;
+
+typedef struct {
+	uint8_t total_bits; /* state bits + value bits */
+	uint8_t value_bits;
+	int16_t delta;
+	int32_t vbase;
+} lzfse_fse_value_dec;
+
+static void lzfse_fse_init_encoder(int nstates, int nsymbols, const uint16_t *freq, lzfse_fse_enc *t) {
+	unsigned n_log = lzfse_highbit ((uint32_t)nstates);
+	int offset = 0;
+	for (int i = 0; i < nsymbols; i++) {
+		int f = freq[i];
+		if (f == 0) {
+			continue;
+		}
+		int k = (int) (n_log - lzfse_highbit ((uint32_t)f));
+		t[i].s0 = (int16_t) ((f << k) - nstates);
+		t[i].k = (int16_t)k;
+		t[i].delta0 = (int16_t) (offset - f + (nstates >> k));
+		t[i].delta1 = (int16_t) (k? offset - f + (nstates >> (k - 1)): 0);
+		offset += f;
+	}
 }
-static inline void bw_put(bw_t *b, uint32_t v, unsigned nb) {
-	b->acc |= (uint64_t)v << b->bits;
-	b->bits += nb;
-	while (b->bits >= 8) {
-		if (b->p == b->end) {
-			return; /* overflow – ignore */
+
+/* Returns -1 when the frequencies use more than nstates states */
+static int lzfse_fse_init_decoder(int nstates, int nsymbols, const uint16_t *freq, lzfse_fse_dec *t) {
+	unsigned n_log = lzfse_highbit ((uint32_t)nstates);
+	int sum = 0;
+	memset (t, 0, sizeof (*t) * (size_t)nstates);
+	for (int i = 0; i < nsymbols; i++) {
+		int f = freq[i];
+		if (f == 0) {
+			continue;
+		}
+		sum += f;
+		if (sum > nstates) {
+			return -1;
+		}
+		int k = (int) (n_log - lzfse_highbit ((uint32_t)f));
+		int j0 = ((2 * nstates) >> k) - f;
+		for (int j = 0; j < f; j++, t++) {
+			t->symbol = (uint8_t)i;
+			if (j < j0) {
+				t->k = (uint8_t)k;
+				t->delta = (int16_t) (((f + j) << k) - nstates);
+			} else {
+				t->k = (uint8_t) (k - 1);
+				t->delta = (int16_t) ((j - j0) << (k - 1));
+			}
 		}
-		*b->p++ = (uint8_t)b->acc;
-		b->acc >>= 8;
-		b->bits -= 8;
 	}
+	return 0;
 }
-static inline void bw_flush(bw_t *b) {
-	while (b->bits) {
-		if (b->p == b->end) {
-			return;
+
+static int lzfse_fse_init_value_decoder(int nstates, int nsymbols, const uint16_t *freq, const uint8_t *vbits, const int32_t *vbase, lzfse_fse_value_dec *t) {
+	unsigned n_log = lzfse_highbit ((uint32_t)nstates);
+	int sum = 0;
+	memset (t, 0, sizeof (*t) * (size_t)nstates);
+	for (int i = 0; i < nsymbols; i++) {
+		int f = freq[i];
+		if (f == 0) {
+			continue;
+		}
+		sum += f;
+		if (sum > nstates) {
+			return -1;
+		}
+		int k = (int) (n_log - lzfse_highbit ((uint32_t)f));
+		int j0 = ((2 * nstates) >> k) - f;
+		for (int j = 0; j < f; j++, t++) {
+			t->value_bits = vbits[i];
+			t->vbase = vbase[i];
+			if (j < j0) {
+				t->total_bits = (uint8_t) (k + vbits[i]);
+				t->delta = (int16_t) (((f + j) << k) - nstates);
+			} else {
+				t->total_bits = (uint8_t) (k - 1 + vbits[i]);
+				t->delta = (int16_t) ((j - j0) << (k - 1));
+			}
 		}
-		*b->p++ = (uint8_t)b->acc;
-		b->acc >>= 8;
-		b->bits = (b->bits >= 8)? b->bits - 8: 0;
 	}
+	return 0;
 }
 
 /* ================================================================
-1. LZ77 GREEDY PARSER(encoder side)
+2. FSE bit streams
 ================================================================ */
 
-static size_t lz77_parse(const uint8_t *in, size_t in_sz, uint32_t *litlens, uint32_t *matchlens, uint32_t *offs, size_t max_seqs) {
-	/* Very small hash table: 16 Ki entries, open-addressed */
-	enum { HLOG = 14,
-		HSIZE = 1 << HLOG };
-	uint32_t hash[HSIZE];
-	for (size_t i = 0; i < HSIZE; ++i) {
-		hash[i] = 0;
-	}
-
-	size_t pos = 0, seq = 0, lit_start = 0;
-	while (pos + LZFSE_MIN_MATCH <= in_sz && seq < max_seqs) {
-		uint32_t h = ((in[pos] * 2654435761u) ^
-				(in[pos + 1] * 2246822519u) ^
-				(in[pos + 2] * 3266489917u)) >>
-			(32 - HLOG);
-		uint32_t prev = hash[h];
-		hash[h] = (uint32_t)pos;
-		uint32_t distance = (uint32_t)pos - prev;
-		if (prev && distance <= LZFSE_WINDOW_SIZE &&
-			pos + 4 < in_sz && memcmp (in + prev, in + pos, 4) == 0) {
-			/* Found a match – extend */
-			size_t mlen = 4;
-			while (mlen < LZFSE_MAX_MATCH && pos + mlen < in_sz &&
-				in[prev + mlen] == in[pos + mlen]) {
-				++mlen;
-			}
+/* The encoder pushes bits LSB first and flushes whole bytes forward; the
+ * decoder starts at the end and pulls from the top, so the last symbol
+ * encoded is the first one decoded. */
 
-			litlens[seq] = (uint32_t) (pos - lit_start);
-			matchlens[seq] = (uint32_t)mlen;
-			offs[seq] = distance;
-			++seq;
+typedef struct {
+	uint64_t accum;
+	int nbits;
+} lzfse_out_stream;
 
-			pos += mlen;
-			lit_start = pos;
-		} else {
-			++pos;
-		}
+static inline void lzfse_out_push(lzfse_out_stream *s, int n, uint64_t b) {
+	s->accum |= b << s->nbits;
+	s->nbits += n;
+}
+
+/* Writes 8 bytes at *p, which must have room for them */
+static inline void lzfse_out_flush(lzfse_out_stream *s, uint8_t **p) {
+	int n = s->nbits & -8;
+	lzfse_store64 (*p, s->accum);
+	*p += n >> 3;
+	s->accum >>= n;
+	s->nbits -= n;
+}
+
+/* Leaves nbits in [-7, 0]: minus the number of padding bits written */
+static inline void lzfse_out_finish(lzfse_out_stream *s, uint8_t **p) {
+	int n = (s->nbits + 7) & -8;
+	lzfse_store64 (*p, s->accum);
+	*p += n >> 3;
+	s->accum = 0;
+	s->nbits -= n;
+}
+
+static inline void lzfse_fse_encode(uint16_t *state, const lzfse_fse_enc *t, lzfse_out_stream *out, int symbol) {
+	int s = *state;
+	lzfse_fse_enc e = t[symbol];
+	int hi = s >= e.s0;
+	int nbits = hi? e.k: e.k - 1;
+	int delta = hi? e.delta0: e.delta1;
+	lzfse_out_push (out, nbits, lzfse_mask64 ((uint64_t)s, nbits));
+	*state = (uint16_t) (delta + (s >> nbits));
+}
+
+/* Reads backwards from pos; bytes before the stream (the block header)
+ * may be loaded but are never pulled */
+typedef struct {
+	const uint8_t *base; /* start of the whole input */
+	size_t pos;
+	uint64_t accum;
+	int nbits;
+} lzfse_in_stream;
+
+static int lzfse_in_init(lzfse_in_stream *s, const uint8_t *base, size_t end, int n) {
+	s->base = base;
+	if (n < -7 || n > 0) {
+		return -1;
+	}
+	/* 8 bytes when the last one is partial, 7 otherwise: never 64 bits */
+	size_t nbytes = n? 8: 7;
+	if (end < nbytes) {
+		return -1;
 	}
-	/* Tail literals */
-	if (lit_start < in_sz && seq < max_seqs) {
-		litlens[seq] = (uint32_t) (in_sz - lit_start);
-		matchlens[seq] = 0;
-		offs[seq] = 0;
-		++seq;
+	s->pos = end - nbytes;
+	s->accum = 0;
+	for (size_t i = nbytes; i-- > 0;) {
+		s->accum = (s->accum << 8) | base[s->pos + i];
 	}
-	return seq; /* number of sequences generated */
+	s->nbits = n + (int)nbytes * 8;
+	return (s->accum >> s->nbits) != 0? -1: 0;
+}
+
+/* Refill to 56..63 bits */
+static inline int lzfse_in_flush(lzfse_in_stream *s) {
+	int n = (63 - s->nbits) & -8;
+	size_t nbytes = (size_t)n >> 3;
+	if (s->pos < nbytes) {
+		return -1;
+	}
+	s->pos -= nbytes;
+	uint64_t incoming = 0;
+	for (size_t i = nbytes; i-- > 0;) {
+		incoming = (incoming << 8) | s->base[s->pos + i];
+	}
+	s->accum = (s->accum << n) | incoming;
+	s->nbits += n;
+	return 0;
+}
+
+static inline uint64_t lzfse_in_pull(lzfse_in_stream *s, int n) {
+	s->nbits -= n;
+	uint64_t r = s->accum >> s->nbits;
+	s->accum = lzfse_mask64 (s->accum, s->nbits);
+	return r;
+}
+
+static inline uint8_t lzfse_fse_decode(uint16_t *state, const lzfse_fse_dec *t, lzfse_in_stream *in) {
+	lzfse_fse_dec e = t[*state];
+	*state = (uint16_t) (e.delta + (int)lzfse_in_pull (in, e.k));
+	return e.symbol;
+}
+
+static inline int32_t lzfse_fse_value_decode(uint16_t *state, const lzfse_fse_value_dec *t, lzfse_in_stream *in) {
+	lzfse_fse_value_dec e = t[*state];
+	uint32_t bits = (uint32_t)lzfse_in_pull (in, e.total_bits);
+	*state = (uint16_t) (e.delta + (int) (bits >> e.value_bits));
+	return e.vbase + (int32_t)lzfse_mask64 (bits, e.value_bits);
 }
 
 /* ================================================================
-2. *Raw* LZFSE block writer(tag 0x06)
+3. v2 header frequency tables
 ================================================================ */
 
-static size_t lzfse_write_raw_block(const uint8_t *in, size_t in_sz, uint8_t *out, size_t out_cap) {
-	if (in_sz + 5 > out_cap) {
-		return 0; /* header (1)+len (4)+data */
+/* Each frequency is a prefix code read LSB first: 2, 3 or 5 bits for
+ * 0..7, 8 bits for 8..23 and 14 bits for 24..1047 */
+static inline uint32_t lzfse_encode_freq(int value, int *nbits) {
+	static const uint8_t small_bits[8] = { 2, 2, 3, 3, 5, 5, 5, 5 };
+	static const uint8_t small_code[8] = { 0, 2, 1, 5, 3, 11, 19, 27 };
+	if (value < 8) {
+		*nbits = small_bits[value];
+		return small_code[value];
+	}
+	if (value < 24) {
+		*nbits = 8;
+		return 7 + ((uint32_t) (value - 8) << 4);
+	}
+	*nbits = 14;
+	return 15 + ((uint32_t) (value - 24) << 4);
+}
+
+static inline int lzfse_decode_freq(uint32_t bits, int *nbits) {
+	static const int8_t nbits_table[32] = {
+		2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+		2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14
+	};
+	static const int8_t value_table[32] = {
+		0, 2, 1, 4, 0, 3, 1, -1, 0, 2, 1, 5, 0, 3, 1, -1,
+		0, 2, 1, 6, 0, 3, 1, -1, 0, 2, 1, 7, 0, 3, 1, -1
+	};
+	uint32_t b = bits & 31;
+	*nbits = nbits_table[b];
+	if (*nbits == 8) {
+		return 8 + (int) ((bits >> 4) & 0xf);
 	}
-	out[0] = 0x06; /* uncompressed block */
-	out[1] = (uint8_t)in_sz;
-	out[2] = (uint8_t) (in_sz >> 8);
-	out[3] = (uint8_t) (in_sz >> 16);
-	out[4] = (uint8_t) (in_sz >> 24);
-	memcpy (out + 5, in, in_sz);
-	return 5 + in_sz;
+	if (*nbits == 14) {
+		return 24 + (int) ((bits >> 4) & 0x3ff);
+	}
+	return value_table[b];
 }
 
 /* ================================================================
-3. Full compressor(calls parser + raw block writer)
+4. Match finder (encoder side)
 ================================================================ */
 
-size_t lzfse_compress(const void *in_, size_t in_sz, void *out_, size_t out_cap) {
-	const uint8_t *in = (const uint8_t *)in_;
-	uint8_t *out = (uint8_t *)out_;
+typedef struct {
+	const uint8_t *in;
+	size_t n;
+	uint32_t *head; /* hash -> pos + 1 */
+	uint32_t *prev; /* pos & chain_mask -> older pos + 1 */
+	unsigned hash_log;
+	size_t chain_mask;
+	size_t next; /* first position not yet inserted */
+} lzfse_mf;
 
-	/* Heuristic: for inputs <256 KiB we just emit a raw block – much
-	shorter code and rarely worse than ~+15 % over Apple’s encoder. */
-	if (in_sz < 256 * 1024) {
-		return lzfse_write_raw_block (in, in_sz, out, out_cap);
+static inline uint32_t lzfse_hash4(const uint8_t *p, unsigned hash_log) {
+	return (lzfse_load32 (p) * 2654435761u) >> (32 - hash_log);
+}
+
+static void lzfse_mf_insert_upto(lzfse_mf *mf, size_t pos) {
+	for (; mf->next < pos && mf->next + 4 <= mf->n; mf->next++) {
+		uint32_t h = lzfse_hash4 (mf->in + mf->next, mf->hash_log);
+		mf->prev[mf->next & mf->chain_mask] = mf->head[h];
+		mf->head[h] = (uint32_t) (mf->next + 1);
+	}
+	if (mf->next < pos) {
+		mf->next = pos;
+	}
+}
+
+/* Longest match at pos within max_dist; 0 when shorter than LZFSE_MIN_MATCH */
+static size_t lzfse_mf_find(lzfse_mf *mf, size_t pos, size_t max_dist, size_t *dist) {
+	const uint8_t *in = mf->in;
+	size_t limit = mf->n - pos;
+	size_t best = LZFSE_MIN_MATCH - 1;
+	if (limit < LZFSE_MIN_MATCH) {
+		return 0;
+	}
+	lzfse_mf_insert_upto (mf, pos);
+	uint32_t cand = mf->head[lzfse_hash4 (in + pos, mf->hash_log)];
+	for (int depth = LZFSE_SEARCH_DEPTH; cand && depth > 0; depth--) {
+		size_t c = cand - 1;
+		if (c >= pos || pos - c > max_dist) {
+			break;
+		}
+		if (in[c + best] == in[pos + best] && lzfse_load32 (in + c) == lzfse_load32 (in + pos)) {
+			size_t len = 4;
+			while (len < limit && in[c + len] == in[pos + len]) {
+				len++;
+			}
+			if (len > best) {
+				best = len;
+				*dist = pos - c;
+				if (len == limit) {
+					break;
+				}
+			}
+		}
+		uint32_t older = mf->prev[c & mf->chain_mask];
+		if (older >= cand) {
+			break;
+		}
+		cand = older;
 	}
+	return best >= LZFSE_MIN_MATCH? best: 0;
+}
 
-	/* For larger payloads we still run the parser – but to keep the
-	example tiny, we ultimately *also* write a raw block.  Extend this
-	section to actually emit coded sequences if you wish. */
+/* Greedy parse with one step of lazy matching; emit is called for every
+ * (literal run, match) pair and once more for the trailing literals with
+ * a zero match length. */
+typedef int (*lzfse_emit_fn)(void *user, size_t lit_pos, size_t L, size_t M, size_t D);
 
-	enum { MAX_SEQS = 1 << 16 };
-	static uint32_t litlens[MAX_SEQS];
-	static uint32_t matchlens[MAX_SEQS];
-	static uint32_t offs[MAX_SEQS];
+static int lzfse_parse(lzfse_mf *mf, size_t max_dist, lzfse_emit_fn emit, void *user) {
+	size_t n = mf->n;
+	size_t pos = 0;
+	size_t lit_start = 0;
+	while (pos + LZFSE_MIN_MATCH <= n) {
+		size_t dist = 0;
+		size_t len = lzfse_mf_find (mf, pos, max_dist, &dist);
+		if (!len) {
+			pos++;
+			continue;
+		}
+		while (len < LZFSE_GOOD_MATCH && pos + 1 + LZFSE_MIN_MATCH <= n) {
+			size_t dist2 = 0;
+			size_t len2 = lzfse_mf_find (mf, pos + 1, max_dist, &dist2);
+			if (len2 <= len) {
+				break;
+			}
+			pos++;
+			len = len2;
+			dist = dist2;
+		}
+		if (emit (user, lit_start, pos - lit_start, len, dist) != 0) {
+			return -1;
+		}
+		pos += len;
+		lit_start = pos;
+	}
+	return emit (user, lit_start, n - lit_start, 0, 0);
+}
 
-	size_t seqs = lz77_parse (in, in_sz, litlens, matchlens, offs, MAX_SEQS);
-	(void)seqs; /* parser results currently unused */
+/* Buffers a z_stream keeps between entries: the match finder tables and
+ * the v2 block coder states. Without one (the plain lzfse_compress and
+ * lzfse_decompress) they are allocated per call. */
+typedef struct {
+	uint32_t *tables;
+	size_t tables_alloc;
+	struct lzfse_enc *enc;
+	struct lzfse_dec *dec;
+} lzfse_work;
 
-	return lzfse_write_raw_block (in, in_sz, out, out_cap);
+/* n zeroed table entries, owned by w when there is one */
+static uint32_t *lzfse_work_tables(lzfse_work *w, size_t n) {
+	if (!w) {
+		return (uint32_t *)calloc (n, sizeof (uint32_t));
+	}
+	if (w->tables_alloc < n) {
+		free (w->tables);
+		w->tables = (uint32_t *)malloc (n * sizeof (uint32_t));
+		w->tables_alloc = w->tables? n: 0;
+	}
+	if (w->tables) {
+		memset (w->tables, 0, n * sizeof (uint32_t));
+	}
+	return w->tables;
 }
 
 /* ================================================================
-4. Decompressor – handles raw(0x06) and coded(0x03…0x05) blocks
+5. LZVN encoder
 ================================================================ */
 
-static size_t lzfse_decode_raw_block(const uint8_t *src, size_t src_sz, uint8_t *dst, size_t dst_cap) {
-	if (src_sz < 5 || src[0] != 0x06) {
+typedef struct {
+	const uint8_t *in;
+	uint8_t *out;
+	size_t cap;
+	size_t len;
+	size_t d_prev;
+} lzvn_enc;
+
+static inline int lzvn_put_literals(lzvn_enc *e, const uint8_t *p, size_t L) {
+	if (e->len + L > e->cap) {
+		return -1;
+	}
+	memcpy (e->out + e->len, p, L);
+	e->len += L;
+	return 0;
+}
+
+/* Literal runs longer than 3 bytes go out as literal opcodes; what is
+ * left (0..3 bytes) rides on the match opcode */
+static int lzvn_emit(void *user, size_t lit_pos, size_t L, size_t M, size_t D) {
+	lzvn_enc *e = (lzvn_enc *)user;
+	const uint8_t *p = e->in + lit_pos;
+	size_t keep = M? 3: 0;
+	while (L > 15 && L > keep) {
+		size_t x = L < 271? L: 271;
+		if (e->len + 2 > e->cap) {
+			return -1;
+		}
+		e->out[e->len++] = 0xE0;
+		e->out[e->len++] = (uint8_t) (x - 16);
+		if (lzvn_put_literals (e, p, x) != 0) {
+			return -1;
+		}
+		p += x;
+		L -= x;
+	}
+	if (L > keep) {
+		if (e->len + 1 > e->cap) {
+			return -1;
+		}
+		e->out[e->len++] = (uint8_t) (0xE0 + L);
+		if (lzvn_put_literals (e, p, L) != 0) {
+			return -1;
+		}
+		p += L;
+		L = 0;
+	}
+	if (!M) {
 		return 0;
 	}
-	uint32_t len = (uint32_t)src[1] | ((uint32_t)src[2] << 8) |
-		((uint32_t)src[3] << 16) | ((uint32_t)src[4] << 24);
-	if (len + 5 > src_sz || len > dst_cap) {
+	size_t x = M <= 10 - 2 * L? M: 10 - 2 * L;
+	M -= x;
+	x -= 3;
+	if (e->len + 3 > e->cap) {
+		return -1;
+	}
+	if (D == e->d_prev) {
+		if (L == 0) {
+			e->out[e->len++] = (uint8_t) (0xF0 + x + 3);
+		} else {
+			e->out[e->len++] = (uint8_t) ((L << 6) + (x << 3) + 6);
+		}
+	} else if (D < 2048 - 2 * 256) {
+		e->out[e->len++] = (uint8_t) ((D >> 8) + (L << 6) + (x << 3));
+		e->out[e->len++] = (uint8_t)D;
+	} else if (D >= (1 << 14) || M == 0 || x + 3 + M > 34) {
+		e->out[e->len++] = (uint8_t) ((L << 6) + (x << 3) + 7);
+		lzfse_store16 (e->out + e->len, (uint32_t)D);
+		e->len += 2;
+	} else {
+		x += M;
+		M = 0;
+		e->out[e->len++] = (uint8_t) (0xA0 + (x >> 2) + (L << 3));
+		lzfse_store16 (e->out + e->len, (uint32_t) ((D << 2) | (x & 3)));
+		e->len += 2;
+	}
+	if (lzvn_put_literals (e, p, L) != 0) {
+		return -1;
+	}
+	e->d_prev = D;
+	while (M > 15) {
+		size_t m = M < 271? M: 271;
+		if (e->len + 2 > e->cap) {
+			return -1;
+		}
+		e->out[e->len++] = 0xF0;
+		e->out[e->len++] = (uint8_t) (m - 16);
+		M -= m;
+	}
+	if (M > 0) {
+		if (e->len + 1 > e->cap) {
+			return -1;
+		}
+		e->out[e->len++] = (uint8_t) (0xF0 + M);
+	}
+	return 0;
+}
+
+/* LZVN payload (opcodes + end-of-stream) for in[0..n), 0 on overflow */
+static size_t lzvn_encode(const uint8_t *in, size_t n, uint8_t *out, size_t cap, lzfse_work *w) {
+	size_t chain = 1;
+	while (chain < n) {
+		chain <<= 1;
+	}
+	uint32_t *tables = lzfse_work_tables (w, ((size_t)1 << LZVN_HASH_LOG) + chain);
+	if (!tables) {
 		return 0;
 	}
-	memcpy (dst, src + 5, len);
-	return len;
+	lzfse_mf mf = { in, n, tables, tables + ((size_t)1 << LZVN_HASH_LOG), LZVN_HASH_LOG, chain - 1, 0 };
+	lzvn_enc e = { in, out, cap, 0, 0 };
+	int rc = lzfse_parse (&mf, LZVN_MAX_DISTANCE, lzvn_emit, &e);
+	if (!w) {
+		free (tables);
+	}
+	if (rc != 0 || e.len + 8 > cap) {
+		return 0;
+	}
+	out[e.len] = 0x06; /* end of stream, padded to 8 bytes */
+	memset (out + e.len + 1, 0, 7);
+	return e.len + 8;
 }
 
-/* --- (Optional) Full FSE / sequence decoder --------------------- */
-/* The tiny raw-block path above is enough to round-trip data produced by
- * lzfse_compress () in this file.  To keep the file small we *omit* the
- * full FSE machinery here, but the scaffolding (bit-reader, window, etc.)
- * is already present, so you can paste your own decoder later.          */
+/* ================================================================
+6. LZFSE v2 block encoder
+================================================================ */
 
-size_t lzfse_decompress(const void *in_, size_t in_sz, void *out_, size_t out_cap) {
-	if (in_sz == 0 || out_cap == 0) {
+typedef struct lzfse_enc {
+	const uint8_t *in;
+	uint8_t *out;
+	size_t out_cap;
+	size_t out_len;
+	size_t block_start; /* first source byte of the pending block */
+	size_t block_raw;
+	uint32_t n_matches;
+	uint32_t n_literals;
+	uint32_t l[LZFSE_MATCHES_PER_BLOCK];
+	uint32_t m[LZFSE_MATCHES_PER_BLOCK];
+	uint32_t d[LZFSE_MATCHES_PER_BLOCK];
+	uint8_t literals[LZFSE_LITERALS_PER_BLOCK + 4];
+	uint8_t scratch[LZFSE_BLOCK_SCRATCH];
+	lzfse_fse_enc lit_enc[LZFSE_LITERAL_SYMBOLS];
+	lzfse_fse_enc l_enc[LZFSE_L_SYMBOLS];
+	lzfse_fse_enc m_enc[LZFSE_M_SYMBOLS];
+	lzfse_fse_enc d_enc[LZFSE_D_SYMBOLS];
+} lzfse_enc;
+
+static int lzfse_append(lzfse_enc *e, const uint8_t *p, size_t n) {
+	if (e->out_len + n > e->out_cap) {
+		return -1;
+	}
+	memcpy (e->out + e->out_len, p, n);
+	e->out_len += n;
+	return 0;
+}
+
+static int lzfse_write_uncompressed(lzfse_enc *e, const uint8_t *p, size_t n) {
+	uint8_t hdr[8];
+	lzfse_store32 (hdr, LZFSE_UNCOMPRESSED_MAGIC);
+	lzfse_store32 (hdr + 4, (uint32_t)n);
+	return (lzfse_append (e, hdr, 8) != 0 || lzfse_append (e, p, n) != 0)? -1: 0;
+}
+
+/* Encode the pending matches as one v2 block, or store the bytes they
+ * cover when that is smaller */
+static int lzfse_flush_block(lzfse_enc *e) {
+	if (!e->n_matches) {
 		return 0;
 	}
+	uint32_t lit_hist[LZFSE_LITERAL_SYMBOLS] = { 0 };
+	uint32_t l_hist[LZFSE_L_SYMBOLS] = { 0 };
+	uint32_t m_hist[LZFSE_M_SYMBOLS] = { 0 };
+	uint32_t d_hist[LZFSE_D_SYMBOLS] = { 0 };
+	uint16_t freq[LZFSE_FREQ_COUNT];
+	uint16_t *l_freq = freq;
+	uint16_t *m_freq = l_freq + LZFSE_L_SYMBOLS;
+	uint16_t *d_freq = m_freq + LZFSE_M_SYMBOLS;
+	uint16_t *lit_freq = d_freq + LZFSE_D_SYMBOLS;
 
-	const uint8_t *src = (const uint8_t *)in_;
-	uint8_t *dst = (uint8_t *)out_;
+	/* a distance equal to the previous one in the block is sent as 0 */
+	uint32_t d_prev = 0;
+	for (uint32_t i = 0; i < e->n_matches; i++) {
+		uint32_t d = e->d[i];
+		e->d[i] = d == d_prev? 0: d;
+		d_prev = d;
+		l_hist[lzfse_value_symbol (lzfse_l_base_value, LZFSE_L_SYMBOLS, e->l[i])]++;
+		m_hist[lzfse_value_symbol (lzfse_m_base_value, LZFSE_M_SYMBOLS, e->m[i])]++;
+		d_hist[lzfse_value_symbol (lzfse_d_base_value, LZFSE_D_SYMBOLS, e->d[i])]++;
+	}
+	while (e->n_literals & 3) {
+		e->literals[e->n_literals] = e->literals[e->n_literals - 1];
+		e->n_literals++;
+	}
+	for (uint32_t i = 0; i < e->n_literals; i++) {
+		lit_hist[e->literals[i]]++;
+	}
+	lzfse_fse_normalize (LZFSE_L_STATES, LZFSE_L_SYMBOLS, l_hist, l_freq);
+	lzfse_fse_normalize (LZFSE_M_STATES, LZFSE_M_SYMBOLS, m_hist, m_freq);
+	lzfse_fse_normalize (LZFSE_D_STATES, LZFSE_D_SYMBOLS, d_hist, d_freq);
+	lzfse_fse_normalize (LZFSE_LITERAL_STATES, LZFSE_LITERAL_SYMBOLS, lit_hist, lit_freq);
+	lzfse_fse_init_encoder (LZFSE_L_STATES, LZFSE_L_SYMBOLS, l_freq, e->l_enc);
+	lzfse_fse_init_encoder (LZFSE_M_STATES, LZFSE_M_SYMBOLS, m_freq, e->m_enc);
+	lzfse_fse_init_encoder (LZFSE_D_STATES, LZFSE_D_SYMBOLS, d_freq, e->d_enc);
+	lzfse_fse_init_encoder (LZFSE_LITERAL_STATES, LZFSE_LITERAL_SYMBOLS, lit_freq, e->lit_enc);
 
-	/* Multi-block streams usually start with 0x07 framing, but our
-	minimal encoder emits *only* a single 0x06 raw block, so that’s
-	all we handle here.  Extend as needed. */
-	size_t n = lzfse_decode_raw_block (src, in_sz, dst, out_cap);
-	return n; /* 0 on error */
+	/* header: the packed words are filled in once the payload is done */
+	uint8_t *hdr = e->scratch;
+	uint8_t *p = hdr + LZFSE_V2_HEADER_SIZE;
+	uint32_t accum = 0;
+	int accum_nbits = 0;
+	for (int i = 0; i < LZFSE_FREQ_COUNT; i++) {
+		int nbits = 0;
+		accum |= lzfse_encode_freq (freq[i], &nbits) << accum_nbits;
+		accum_nbits += nbits;
+		while (accum_nbits >= 8) {
+			*p++ = (uint8_t)accum;
+			accum >>= 8;
+			accum_nbits -= 8;
+		}
+	}
+	if (accum_nbits > 0) {
+		*p++ = (uint8_t)accum;
+	}
+	uint32_t header_size = (uint32_t) (p - hdr);
+
+	/* literals, last first, over four interleaved states */
+	lzfse_out_stream out = { 0, 0 };
+	uint16_t lit_state[4] = { 0, 0, 0, 0 };
+	uint8_t *lit_begin = p;
+	for (uint32_t i = e->n_literals; i > 0;) {
+		i -= 4;
+		lzfse_fse_encode (&lit_state[3], e->lit_enc, &out, e->literals[i + 3]);
+		lzfse_fse_encode (&lit_state[2], e->lit_enc, &out, e->literals[i + 2]);
+		lzfse_fse_encode (&lit_state[1], e->lit_enc, &out, e->literals[i + 1]);
+		lzfse_fse_encode (&lit_state[0], e->lit_enc, &out, e->literals[i + 0]);
+		lzfse_out_flush (&out, &p);
+	}
+	lzfse_out_finish (&out, &p);
+	int literal_bits = out.nbits;
+	uint32_t n_literal_payload = (uint32_t) (p - lit_begin);
+
+	/* L, M, D triples, last first; value bits go below the state bits */
+	out.accum = 0;
+	out.nbits = 0;
+	uint16_t l_state = 0;
+	uint16_t m_state = 0;
+	uint16_t d_state = 0;
+	uint8_t *lmd_begin = p;
+	for (uint32_t i = e->n_matches; i > 0;) {
+		i--;
+		int ds = lzfse_value_symbol (lzfse_d_base_value, LZFSE_D_SYMBOLS, e->d[i]);
+		int ms = lzfse_value_symbol (lzfse_m_base_value, LZFSE_M_SYMBOLS, e->m[i]);
+		int ls = lzfse_value_symbol (lzfse_l_base_value, LZFSE_L_SYMBOLS, e->l[i]);
+		lzfse_out_push (&out, lzfse_d_extra_bits[ds], e->d[i] - (uint32_t)lzfse_d_base_value[ds]);
+		lzfse_fse_encode (&d_state, e->d_enc, &out, ds);
+		lzfse_out_push (&out, lzfse_m_extra_bits[ms], e->m[i] - (uint32_t)lzfse_m_base_value[ms]);
+		lzfse_fse_encode (&m_state, e->m_enc, &out, ms);
+		lzfse_out_push (&out, lzfse_l_extra_bits[ls], e->l[i] - (uint32_t)lzfse_l_base_value[ls]);
+		lzfse_fse_encode (&l_state, e->l_enc, &out, ls);
+		lzfse_out_flush (&out, &p);
+	}
+	lzfse_out_finish (&out, &p);
+	int lmd_bits = out.nbits;
+	uint32_t n_lmd_payload = (uint32_t) (p - lmd_begin);
+
+	size_t block_len = (size_t) (p - hdr);
+	int rc;
+	if (block_len >= e->block_raw + 8) {
+		rc = lzfse_write_uncompressed (e, e->in + e->block_start, e->block_raw);
+	} else {
+		uint64_t v0 = (uint64_t)e->n_literals | ((uint64_t)n_literal_payload << 20) | ((uint64_t)e->n_matches << 40) | ((uint64_t) (7 + literal_bits) << 60);
+		uint64_t v1 = (uint64_t)lit_state[0] | ((uint64_t)lit_state[1] << 10) | ((uint64_t)lit_state[2] << 20) | ((uint64_t)lit_state[3] << 30) | ((uint64_t)n_lmd_payload << 40) | ((uint64_t) (7 + lmd_bits) << 60);
+		uint64_t v2 = (uint64_t)header_size | ((uint64_t)l_state << 32) | ((uint64_t)m_state << 42) | ((uint64_t)d_state << 52);
+		lzfse_store32 (hdr, LZFSE_COMPRESSEDV2_MAGIC);
+		lzfse_store32 (hdr + 4, (uint32_t)e->block_raw);
+		lzfse_store64 (hdr + 8, v0);
+		lzfse_store64 (hdr + 16, v1);
+		lzfse_store64 (hdr + 24, v2);
+		rc = lzfse_append (e, hdr, block_len);
+	}
+	e->block_start += e->block_raw;
+	e->block_raw = 0;
+	e->n_matches = 0;
+	e->n_literals = 0;
+	return rc;
+}
+
+static int lzfse_push_lmd(lzfse_enc *e, const uint8_t *lit, uint32_t L, uint32_t M, uint32_t D) {
+	if (e->n_matches == LZFSE_MATCHES_PER_BLOCK || e->n_literals + L > LZFSE_LITERALS_PER_BLOCK - 4) {
+		if (lzfse_flush_block (e) != 0) {
+			return -1;
+		}
+	}
+	memcpy (e->literals + e->n_literals, lit, L);
+	e->n_literals += L;
+	e->l[e->n_matches] = L;
+	e->m[e->n_matches] = M;
+	e->d[e->n_matches] = D;
+	e->n_matches++;
+	e->block_raw += L + M;
+	return 0;
+}
+
+/* Split into triples the format can hold; literal-only triples carry
+ * M = 0 and a harmless D = 1 */
+static int lzfse_emit(void *user, size_t lit_pos, size_t L, size_t M, size_t D) {
+	lzfse_enc *e = (lzfse_enc *)user;
+	const uint8_t *lit = e->in + lit_pos;
+	if (!M) {
+		D = 1;
+	}
+	while (L > LZFSE_MAX_L_VALUE) {
+		if (lzfse_push_lmd (e, lit, LZFSE_MAX_L_VALUE, 0, 1) != 0) {
+			return -1;
+		}
+		lit += LZFSE_MAX_L_VALUE;
+		L -= LZFSE_MAX_L_VALUE;
+	}
+	while (M > LZFSE_MAX_M_VALUE) {
+		if (lzfse_push_lmd (e, lit, (uint32_t)L, LZFSE_MAX_M_VALUE, (uint32_t)D) != 0) {
+			return -1;
+		}
+		lit += L;
+		L = 0;
+		M -= LZFSE_MAX_M_VALUE;
+	}
+	if (!L && !M) {
+		return 0;
+	}
+	return lzfse_push_lmd (e, lit, (uint32_t)L, (uint32_t)M, (uint32_t)D);
+}
+
+/* Whole stream of v2 blocks, 0 on overflow */
+static size_t lzfse_encode_v2(const uint8_t *in, size_t n, uint8_t *out, size_t cap, lzfse_work *w) {
+	lzfse_enc *e = w? w->enc: NULL;
+	if (!e && (e = (lzfse_enc *)malloc (sizeof (lzfse_enc))) && w) {
+		w->enc = e;
+	}
+	size_t nhash = (size_t)1 << LZFSE_HASH_LOG;
+	size_t nchain = (size_t)1 << LZFSE_CHAIN_LOG;
+	uint32_t *tables = lzfse_work_tables (w, nhash + nchain);
+	size_t len = 0;
+	if (e && tables) {
+		lzfse_mf mf = { in, n, tables, tables + nhash, LZFSE_HASH_LOG, nchain - 1, 0 };
+		e->in = in;
+		e->out = out;
+		e->out_cap = cap;
+		e->out_len = 0;
+		e->block_start = 0;
+		e->block_raw = 0;
+		e->n_matches = 0;
+		e->n_literals = 0;
+		if (lzfse_parse (&mf, LZFSE_MAX_D_VALUE, lzfse_emit, e) == 0 && lzfse_flush_block (e) == 0 && e->out_len + 4 <= cap) {
+			lzfse_store32 (out + e->out_len, LZFSE_ENDOFSTREAM_MAGIC);
+			len = e->out_len + 4;
+		}
+	}
+	if (!w) {
+		free (tables);
+		free (e);
+	}
+	return len;
 }
 
 /* ================================================================
-End of implementation guard
+7. Full compressor
 ================================================================ */
 
-/* Helper: map a lzfse_{compress,decompress} result (0 = error) to zlib code */
-static inline int lzfse__map_result(size_t produced, int flush) {
-	if (produced == 0) {
-		return Z_BUF_ERROR; /* or Z_DATA_ERROR */
+static size_t lzfse_compress_work(const void *in_, size_t in_sz, void *out_, size_t out_cap, lzfse_work *w) {
+	const uint8_t *in = (const uint8_t *)in_;
+	uint8_t *out = (uint8_t *)out_;
+	if (in_sz > 0xffffffffu) {
+		return 0;
 	}
-	return (flush == Z_FINISH)? Z_STREAM_END: Z_OK;
+	if (in_sz >= LZFSE_LZVN_THRESHOLD) {
+		size_t n = lzfse_encode_v2 (in, in_sz, out, out_cap, w);
+		if (n) {
+			return n;
+		}
+	} else if (in_sz >= LZVN_MIN_SRC_SIZE && out_cap > LZFSE_LZVN_HEADER_SIZE + 4) {
+		size_t n = lzvn_encode (in, in_sz, out + LZFSE_LZVN_HEADER_SIZE, out_cap - LZFSE_LZVN_HEADER_SIZE - 4, w);
+		if (n && n < in_sz) {
+			lzfse_store32 (out, LZFSE_COMPRESSEDLZVN_MAGIC);
+			lzfse_store32 (out + 4, (uint32_t)in_sz);
+			lzfse_store32 (out + 8, (uint32_t)n);
+			lzfse_store32 (out + LZFSE_LZVN_HEADER_SIZE + n, LZFSE_ENDOFSTREAM_MAGIC);
+			return LZFSE_LZVN_HEADER_SIZE + n + 4;
+		}
+	}
+	/* stored: header, bytes, end of stream */
+	size_t need = in_sz? in_sz + 12: 4;
+	if (need > out_cap) {
+		return 0;
+	}
+	size_t pos = 0;
+	if (in_sz) {
+		lzfse_store32 (out, LZFSE_UNCOMPRESSED_MAGIC);
+		lzfse_store32 (out + 4, (uint32_t)in_sz);
+		memcpy (out + 8, in, in_sz);
+		pos = in_sz + 8;
+	}
+	lzfse_store32 (out + pos, LZFSE_ENDOFSTREAM_MAGIC);
+	return need;
+}
+
+size_t lzfse_compress(const void *in_, size_t in_sz, void *out_, size_t out_cap) {
+	return lzfse_compress_work (in_, in_sz, out_, out_cap, NULL);
+}
+
+/* ================================================================
+8. Decompressor
+================================================================ */
+
+typedef struct lzfse_dec {
+	lzfse_fse_dec lit[LZFSE_LITERAL_STATES];
+	lzfse_fse_value_dec l[LZFSE_L_STATES];
+	lzfse_fse_value_dec m[LZFSE_M_STATES];
+	lzfse_fse_value_dec d[LZFSE_D_STATES];
+	uint8_t literals[LZFSE_LITERALS_PER_BLOCK + 4];
+} lzfse_dec;
+
+static inline void lzfse_copy_match(uint8_t *dst, size_t op, size_t D, size_t M) {
+	if (D >= M) {
+		memcpy (dst + op, dst + op - D, M);
+	} else {
+		for (size_t i = 0; i < M; i++) {
+			dst[op + i] = dst[op + i - D];
+		}
+	}
+}
+
+/* One v2 block at src[pos]; *pos and *op advance past it */
+static int lzfse_decode_v2_block(lzfse_dec *s, const uint8_t *src, size_t n, size_t *pos, uint8_t *dst, size_t cap, size_t *op) {
+	size_t b = *pos;
+	if (n - b < LZFSE_V2_HEADER_SIZE) {
+		return -1;
+	}
+	uint32_t n_raw = lzfse_load32 (src + b + 4);
+	uint64_t v0 = lzfse_load64 (src + b + 8);
+	uint64_t v1 = lzfse_load64 (src + b + 16);
+	uint64_t v2 = lzfse_load64 (src + b + 24);
+	uint32_t n_literals = (uint32_t) (v0 & 0xfffff);
+	uint32_t n_lit_payload = (uint32_t) ((v0 >> 20) & 0xfffff);
+	uint32_t n_matches = (uint32_t) ((v0 >> 40) & 0xfffff);
+	int literal_bits = (int) ((v0 >> 60) & 7) - 7;
+	uint16_t lit_state[4];
+	for (int i = 0; i < 4; i++) {
+		lit_state[i] = (uint16_t) ((v1 >> (10 * i)) & 0x3ff);
+	}
+	uint32_t n_lmd_payload = (uint32_t) ((v1 >> 40) & 0xfffff);
+	int lmd_bits = (int) ((v1 >> 60) & 7) - 7;
+	uint32_t header_size = (uint32_t)v2;
+	uint16_t l_state = (uint16_t) ((v2 >> 32) & 0x3ff);
+	uint16_t m_state = (uint16_t) ((v2 >> 42) & 0x3ff);
+	uint16_t d_state = (uint16_t) ((v2 >> 52) & 0x3ff);
+	if (header_size < LZFSE_V2_HEADER_SIZE || header_size > n - b ||
+		(uint64_t)n_lit_payload + n_lmd_payload > n - b - header_size ||
+		n_literals > LZFSE_LITERALS_PER_BLOCK || n_matches > LZFSE_MATCHES_PER_BLOCK ||
+		l_state >= LZFSE_L_STATES || m_state >= LZFSE_M_STATES || d_state >= LZFSE_D_STATES ||
+		n_raw > cap - *op) {
+		return -1;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (lit_state[i] >= LZFSE_LITERAL_STATES) {
+			return -1;
+		}
+	}
+
+	/* frequency tables; an empty list leaves them all zero */
+	uint16_t freq[LZFSE_FREQ_COUNT] = { 0 };
+	const uint8_t *fp = src + b + LZFSE_V2_HEADER_SIZE;
+	const uint8_t *fend = src + b + header_size;
+	if (fp != fend) {
+		uint32_t accum = 0;
+		int accum_nbits = 0;
+		for (int i = 0; i < LZFSE_FREQ_COUNT; i++) {
+			while (fp < fend && accum_nbits + 8 <= 32) {
+				accum |= (uint32_t) (*fp++) << accum_nbits;
+				accum_nbits += 8;
+			}
+			int nbits = 0;
+			int value = lzfse_decode_freq (accum, &nbits);
+			if (nbits > accum_nbits) {
+				return -1;
+			}
+			freq[i] = (uint16_t)value;
+			accum >>= nbits;
+			accum_nbits -= nbits;
+		}
+		if (accum_nbits >= 8 || fp != fend) {
+			return -1;
+		}
+	}
+	const uint16_t *l_freq = freq;
+	const uint16_t *m_freq = l_freq + LZFSE_L_SYMBOLS;
+	const uint16_t *d_freq = m_freq + LZFSE_M_SYMBOLS;
+	const uint16_t *lit_freq = d_freq + LZFSE_D_SYMBOLS;
+	if (lzfse_fse_init_decoder (LZFSE_LITERAL_STATES, LZFSE_LITERAL_SYMBOLS, lit_freq, s->lit) != 0 ||
+		lzfse_fse_init_value_decoder (LZFSE_L_STATES, LZFSE_L_SYMBOLS, l_freq, lzfse_l_extra_bits, lzfse_l_base_value, s->l) != 0 ||
+		lzfse_fse_init_value_decoder (LZFSE_M_STATES, LZFSE_M_SYMBOLS, m_freq, lzfse_m_extra_bits, lzfse_m_base_value, s->m) != 0 ||
+		lzfse_fse_init_value_decoder (LZFSE_D_STATES, LZFSE_D_SYMBOLS, d_freq, lzfse_d_extra_bits, lzfse_d_base_value, s->d) != 0) {
+		return -1;
+	}
+
+	/* literals */
+	size_t lit_end = b + header_size + n_lit_payload;
+	lzfse_in_stream in;
+	if (lzfse_in_init (&in, src, lit_end, literal_bits) != 0) {
+		return -1;
+	}
+	for (uint32_t i = 0; i < n_literals; i += 4) {
+		if (lzfse_in_flush (&in) != 0) {
+			return -1;
+		}
+		s->literals[i + 0] = lzfse_fse_decode (&lit_state[0], s->lit, &in);
+		s->literals[i + 1] = lzfse_fse_decode (&lit_state[1], s->lit, &in);
+		s->literals[i + 2] = lzfse_fse_decode (&lit_state[2], s->lit, &in);
+		s->literals[i + 3] = lzfse_fse_decode (&lit_state[3], s->lit, &in);
+	}
+
+	/* L, M, D */
+	size_t lmd_end = lit_end + n_lmd_payload;
+	if (lzfse_in_init (&in, src, lmd_end, lmd_bits) != 0) {
+		return -1;
+	}
+	size_t o = *op;
+	size_t block_end = o + n_raw;
+	const uint8_t *lit = s->literals;
+	const uint8_t *lits_end = s->literals + n_literals;
+	int32_t D = 0;
+	for (uint32_t i = 0; i < n_matches; i++) {
+		if (lzfse_in_flush (&in) != 0) {
+			return -1;
+		}
+		int32_t L = lzfse_fse_value_decode (&l_state, s->l, &in);
+		int32_t M = lzfse_fse_value_decode (&m_state, s->m, &in);
+		int32_t new_d = lzfse_fse_value_decode (&d_state, s->d, &in);
+		D = new_d? new_d: D;
+		if (L > lits_end - lit || (size_t)L + (size_t)M > block_end - o) {
+			return -1;
+		}
+		memcpy (dst + o, lit, (size_t)L);
+		lit += L;
+		o += (size_t)L;
+		if (M) {
+			if (D <= 0 || (size_t)D > o) {
+				return -1;
+			}
+			lzfse_copy_match (dst, o, (size_t)D, (size_t)M);
+			o += (size_t)M;
+		}
+	}
+	if (o != block_end) {
+		return -1;
+	}
+	*op = o;
+	*pos = lmd_end;
+	return 0;
 }
 
+/* LZVN payload src[0..n) producing exactly n_raw bytes at dst[*op] */
+static int lzvn_decode(const uint8_t *src, size_t n, uint8_t *dst, size_t *op, size_t n_raw) {
+	size_t ip = 0;
+	size_t o = *op;
+	size_t end = o + n_raw;
+	size_t D = 0;
+	for (;;) {
+		if (ip >= n) {
+			return -1;
+		}
+		uint8_t opc = src[ip];
+		size_t L = 0;
+		size_t M = 0;
+		size_t len = 1;
+		if (opc >= 0xF0) { /* match with the previous distance */
+			if (opc == 0xF0) {
+				if (n - ip < 2) {
+					return -1;
+				}
+				M = (size_t)src[ip + 1] + 16;
+				len = 2;
+			} else {
+				M = opc & 0xf;
+			}
+		} else if (opc >= 0xE0) { /* literals */
+			if (opc == 0xE0) {
+				if (n - ip < 2) {
+					return -1;
+				}
+				L = (size_t)src[ip + 1] + 16;
+				len = 2;
+			} else {
+				L = opc & 0xf;
+			}
+		} else if (opc >= 0xA0 && opc < 0xC0) { /* medium distance: 101LLMMM */
+			if (n - ip < 3) {
+				return -1;
+			}
+			uint16_t w = lzfse_load16 (src + ip + 1);
+			L = (opc >> 3) & 3;
+			M = ((size_t) ((opc & 7) << 2 | (w & 3))) + 3;
+			D = w >> 2;
+			len = 3;
+		} else if ((opc >= 0x70 && opc < 0x80) || (opc >= 0xD0 && opc < 0xE0)) {
+			return -1;
+		} else { /* LLMMMDDD: small, previous or large distance */
+			L = opc >> 6;
+			M = ((opc >> 3) & 7) + 3;
+			switch (opc & 7) {
+			case 6:
+				if (opc < 0x40) {
+					if (opc == 0x06) {
+						*op = o;
+						return o == end? 0: -1;
+					}
+					if (opc == 0x0E || opc == 0x16) {
+						ip++;
+						continue; /* nop */
+					}
+					return -1;
+				}
+				break;
+			case 7:
+				if (n - ip < 3) {
+					return -1;
+				}
+				D = lzfse_load16 (src + ip + 1);
+				len = 3;
+				break;
+			default:
+				if (n - ip < 2) {
+					return -1;
+				}
+				D = ((size_t) (opc & 7) << 8) | src[ip + 1];
+				len = 2;
+				break;
+			}
+		}
+		ip += len;
+		if (L) {
+			if (n - ip < L || end - o < L) {
+				return -1;
+			}
+			memcpy (dst + o, src + ip, L);
+			ip += L;
+			o += L;
+		}
+		if (M) {
+			if (D == 0 || D > o || end - o < M) {
+				return -1;
+			}
+			lzfse_copy_match (dst, o, D, M);
+			o += M;
+		}
+	}
+}
+
+/* Decode a whole stream; returns 0 and the output length, -1 on error */
+static int lzfse_decode(const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *out_len, lzfse_work *w) {
+	size_t pos = 0;
+	size_t op = 0;
+	lzfse_dec *s = w? w->dec: NULL;
+	int rc = -1;
+	*out_len = 0;
+	if (n >= 5 && src[0] == LZFSE_LEGACY_RAW_TAG) {
+		uint32_t len = lzfse_load32 (src + 1);
+		if (len > n - 5 || len > cap) {
+			return -1;
+		}
+		memcpy (dst, src + 5, len);
+		*out_len = len;
+		return 0;
+	}
+	for (;;) {
+		if (n - pos < 4) {
+			break;
+		}
+		uint32_t magic = lzfse_load32 (src + pos);
+		if (magic == LZFSE_ENDOFSTREAM_MAGIC) {
+			rc = 0;
+			break;
+		}
+		if (magic == LZFSE_UNCOMPRESSED_MAGIC) {
+			if (n - pos < 8) {
+				break;
+			}
+			uint32_t len = lzfse_load32 (src + pos + 4);
+			if (len > n - pos - 8 || len > cap - op) {
+				break;
+			}
+			memcpy (dst + op, src + pos + 8, len);
+			op += len;
+			pos += 8 + (size_t)len;
+		} else if (magic == LZFSE_COMPRESSEDLZVN_MAGIC) {
+			if (n - pos < LZFSE_LZVN_HEADER_SIZE) {
+				break;
+			}
+			uint32_t n_raw = lzfse_load32 (src + pos + 4);
+			uint32_t n_payload = lzfse_load32 (src + pos + 8);
+			pos += LZFSE_LZVN_HEADER_SIZE;
+			if (n_payload > n - pos || n_raw > cap - op ||
+				lzvn_decode (src + pos, n_payload, dst, &op, n_raw) != 0) {
+				break;
+			}
+			pos += n_payload;
+		} else if (magic == LZFSE_COMPRESSEDV2_MAGIC) {
+			if (!s && !(s = (lzfse_dec *)malloc (sizeof (lzfse_dec)))) {
+				break;
+			}
+			if (w) {
+				w->dec = s;
+			}
+			if (lzfse_decode_v2_block (s, src, n, &pos, dst, cap, &op) != 0) {
+				break;
+			}
+		} else {
+			break; /* v1 blocks and anything else */
+		}
+	}
+	if (!w) {
+		free (s);
+	}
+	*out_len = op;
+	return rc;
+}
+
+size_t lzfse_decompress(const void *in_, size_t in_sz, void *out_, size_t out_cap) {
+	size_t n = 0;
+	if (lzfse_decode ((const uint8_t *)in_, in_sz, (uint8_t *)out_, out_cap, &n, NULL) != 0) {
+		return 0;
+	}
+	return n;
+}
+
+/* ================================================================
+End of implementation guard
+================================================================ */
+
 /* ---------------- Compression wrappers ---------------- */
-int lzfseInit(z_stream *strm, int level) {
-	(void)level; /* lzfse_min has no level tuning */
+#ifndef Z_MEM_ERROR
+#define Z_MEM_ERROR (-4)
+#endif
+
+/* The z_stream state is an lzfse_work, filled in by the first entry and
+ * reused by the ones after a Reset */
+static int lzfse_work_init(z_stream *strm) {
 	if (!strm) {
 		return Z_STREAM_ERROR;
 	}
 	strm->total_in = strm->total_out = 0;
-	strm->state = NULL; /* no internal state needed */
+	strm->state = calloc (1, sizeof (lzfse_work));
+	return strm->state? Z_OK: Z_MEM_ERROR;
+}
+
+static int lzfse_work_reset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	strm->total_in = strm->total_out = 0;
 	return Z_OK;
 }
 
+static int lzfse_work_end(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	lzfse_work *w = (lzfse_work *)strm->state;
+	free (w->tables);
+	free (w->enc);
+	free (w->dec);
+	free (w);
+	strm->state = NULL;
+	return Z_OK;
+}
+
+int lzfseInit(z_stream *strm, int level) {
+	(void)level; /* LZFSE has no level tuning */
+	return lzfse_work_init (strm);
+}
+
+/* The whole input must be given in one call with Z_FINISH */
 int lzfseCompress(z_stream *strm, int flush) {
-	if (!strm || !strm->next_out || !strm->next_in) {
+	if (!strm || !strm->next_out || (!strm->next_in && strm->avail_in)) {
 		return Z_STREAM_ERROR;
 	}
 
@@ -291,59 +1407,60 @@ int lzfseCompress(z_stream *strm, int flush) {
 		return Z_BUF_ERROR;
 	}
 
-	size_t produced = lzfse_compress (strm->next_in, in_len, strm->next_out, out_cap);
-
-	if (produced) {
-		/* advance pointers */
-		strm->next_in += (uint32_t)in_len;
-		strm->avail_in = 0;
-		strm->next_out += (uint32_t)produced;
-		strm->avail_out = (uInt) ((out_cap >= produced)? (out_cap - produced): 0);
-		strm->total_in += (uint32_t)in_len;
-		strm->total_out += (uint32_t)produced;
+	size_t produced = lzfse_compress_work (strm->next_in, in_len, strm->next_out, out_cap, (lzfse_work *)strm->state);
+	if (!produced) {
+		return Z_BUF_ERROR;
 	}
-	return lzfse__map_result (produced, flush);
+	strm->next_in += (uint32_t)in_len;
+	strm->avail_in = 0;
+	strm->next_out += (uint32_t)produced;
+	strm->avail_out = (uInt) (out_cap - produced);
+	strm->total_in += (uint32_t)in_len;
+	strm->total_out += (uint32_t)produced;
+	return (flush == Z_FINISH)? Z_STREAM_END: Z_OK;
+}
+
+int lzfseReset(z_stream *strm) {
+	return lzfse_work_reset (strm);
 }
 
 int lzfseEnd(z_stream *strm) {
-	(void)strm; /* nothing to free */
-	return Z_OK;
+	return lzfse_work_end (strm);
 }
 
 /* ---------------- Decompression wrappers ---------------- */
 int lzfseDecompressInit(z_stream *strm) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
-	}
-	strm->total_in = strm->total_out = 0;
-	strm->state = NULL;
-	return Z_OK;
+	return lzfse_work_init (strm);
 }
 
+/* The whole stream must be given in one call */
 int lzfseDecompress(z_stream *strm, int flush) {
-	if (!strm || (!strm->next_out && strm->avail_out)) {
+	if (!strm || (!strm->next_out && strm->avail_out) || (!strm->next_in && strm->avail_in)) {
 		return Z_STREAM_ERROR;
 	}
 
 	const size_t in_len = strm->avail_in;
 	const size_t out_cap = strm->avail_out;
 
-	size_t produced = lzfse_decompress (strm->next_in, in_len, strm->next_out, out_cap);
-
-	if (produced) {
-		strm->next_in += (uint32_t)in_len;
-		strm->avail_in = 0;
-		strm->next_out += (uint32_t)produced;
-		strm->avail_out = (uInt) (out_cap - produced);
-		strm->total_in += (uint32_t)in_len;
-		strm->total_out += (uint32_t)produced;
+	size_t produced = 0;
+	if (lzfse_decode (strm->next_in, in_len, strm->next_out, out_cap, &produced, (lzfse_work *)strm->state) != 0) {
+		return Z_DATA_ERROR;
 	}
-	return lzfse__map_result (produced, flush);
+	strm->next_in += (uint32_t)in_len;
+	strm->avail_in = 0;
+	strm->next_out += (uint32_t)produced;
+	strm->avail_out = (uInt) (out_cap - produced);
+	strm->total_in += (uint32_t)in_len;
+	strm->total_out += (uint32_t)produced;
+	return (flush == Z_FINISH)? Z_STREAM_END: Z_OK;
+}
+
+int lzfseDecompressReset(z_stream *strm) {
+	return lzfse_work_reset (strm);
 }
 
 int lzfseDecompressEnd(z_stream *strm) {
-	(void)strm;
-	return Z_OK;
+	return lzfse_work_end (strm);
 }
 
 /* ---------------- «Init2» convenience aliases ---------------- */
@@ -1,5 +1,5 @@
 /* lzma-dec.inc.c - Minimalistic LZMA decoder implementation compatible with zlib-like API
- * Version: 0.1 (2025-07-27)
+ * Version: 0.2 (2025-07-27)
  *
  * This implementation provides LZMA decoder with zlib-compatible wrappers:
  *
@@ -7,10 +7,8 @@
  *   lzmaDecompress
  *   lzmaDecompressEnd
  *
- * It supports:
- * - Basic LZMA decompression
- * - Bare minimum functionality to support ZIP file reading
- * - Compatible interface with existing compression implementations
+ * It decodes LZMA1 range coded streams behind the 13-byte .lzma header,
+ * with or without an end marker, in any input and output piece sizes.
  *
  * Usage:
  *   #define MLZMA_IMPLEMENTATION in one source file before including
@@ -55,22 +53,44 @@
 /* Unified z_stream declaration */
 #include "../include/otezip/zstream.h"
 
+/* Bytes of input one symbol can consume at most; a streaming call holds
+ * back less than this until more input or Z_FINISH arrives */
+#define LZMA_REQUIRED_INPUT 20
+
 /* LZMA decompression context */
 typedef struct {
-	uint8_t properties[LZMA_PROPS_SIZE];
-	uint64_t uncompressed_size;
-	uint8_t *dict_buffer;
-	size_t dict_size;
-	uint8_t *window_buffer;
-	size_t window_size;
-	size_t window_pos;
-	uint32_t current_block_size;
-	int current_block_remaining;
-	int is_last_block;
-
-	/* Work buffers */
-	uint8_t *decompress_buffer;
-	size_t decompress_buffer_size;
+	lzma_model m;
+	lzma_prob *lit;
+	size_t lit_alloc;
+	unsigned lc, lp, pb;
+	uint32_t dict_size;
+	uint64_t unpack_size;
+	int size_known;
+
+	/* range decoder and match state */
+	uint32_t range;
+	uint32_t code;
+	unsigned state;
+	uint32_t reps[4];
+	uint32_t rem_len; /* bytes of a match still to copy */
+	uint64_t out_total;
+	int finished;
+	int corrupt;
+
+	/* dictionary: a ring buffer, or next_out itself for one-shot calls */
+	uint8_t *dic;
+	size_t dic_size;
+	size_t dic_pos;
+	size_t flush_pos;
+	int dic_owned;
+	uint8_t *dic_buf; /* the owned dictionary, kept by lzmaDecompressReset */
+	size_t dic_alloc;
+
+	/* header plus the range coder init bytes, and held-back input */
+	uint8_t hdr[LZMA_HEADER_SIZE + 5];
+	size_t hdr_len;
+	uint8_t tmp[2 * LZMA_REQUIRED_INPUT];
+	size_t tmp_len;
 } lzma_decompress_context;
 
 /* ------------- Function Prototypes ------------- */
@@ -83,6 +103,7 @@ extern "C" {
 /* Decompression */
 int lzmaDecompressInit(z_stream *strm);
 int lzmaDecompress(z_stream *strm, int flush);
+int lzmaDecompressReset(z_stream *strm);
 int lzmaDecompressEnd(z_stream *strm);
 
 /* Helpers for zlib compatibility layer */
@@ -98,69 +119,354 @@ int lzmaDecompressInit2_(z_stream *strm, int windowBits, const char *version, in
 
 /* --- Helper Functions --- */
 
-/* Simple decompression for our LZMA block */
-static int simple_lzma_decompress(const uint8_t *props,
-	const uint8_t *src,
-	size_t src_size,
-	uint8_t *dst,
-	size_t dst_capacity) {
-	if (!props || !src || !dst || src_size == 0) {
-		return 0; /* Invalid inputs */
+/* Read 64-bit little endian integer */
+static uint64_t read_uint64_le(const uint8_t *p) {
+	uint64_t value = 0;
+	for (int i = 0; i < 8; i++) {
+		value |= ((uint64_t)p[i]) << (i * 8);
 	}
+	return value;
+}
 
-	/* We don't actually use the props in this simplified version */
-	(void)props;
-
-	size_t dst_pos = 0;
-	size_t src_pos = 0;
+/* --- Range decoder --- */
 
-	while (src_pos < src_size) {
-		if (src_pos + 2 >= src_size) {
-			return 0; /* Invalid compressed data */
+typedef struct {
+	uint32_t range;
+	uint32_t code;
+	const uint8_t *ip;
+	const uint8_t *iend;
+	int overrun;
+} lzma_rd;
+
+static inline void lzma_rd_norm(lzma_rd *r) {
+	if (r->range < LZMA_TOP) {
+		r->range <<= 8;
+		r->code <<= 8;
+		if (r->ip < r->iend) {
+			r->code |= *r->ip++;
+		} else {
+			r->overrun = 1;
 		}
+	}
+}
+
+static inline unsigned lzma_rd_bit(lzma_rd *r, lzma_prob *p) {
+	lzma_rd_norm (r);
+	uint32_t bound = (r->range >> LZMA_PROB_BITS) * *p;
+	if (r->code < bound) {
+		r->range = bound;
+		*p = (lzma_prob)(*p + (((1u << LZMA_PROB_BITS) - *p) >> LZMA_MOVE_BITS));
+		return 0;
+	}
+	r->range -= bound;
+	r->code -= bound;
+	*p = (lzma_prob)(*p - (*p >> LZMA_MOVE_BITS));
+	return 1;
+}
 
-		uint8_t marker = src[src_pos++];
+static inline unsigned lzma_rd_tree(lzma_rd *r, lzma_prob *probs, unsigned bits) {
+	unsigned m = 1;
+	for (unsigned i = 0; i < bits; i++) {
+		m = (m << 1) | lzma_rd_bit (r, probs + m);
+	}
+	return m - (1u << bits);
+}
 
-		if (marker == 0x00) {
-			/* RLE run */
-			uint8_t byte = src[src_pos++];
-			uint8_t length = src[src_pos++];
+static inline unsigned lzma_rd_tree_rev(lzma_rd *r, lzma_prob *probs, unsigned bits) {
+	unsigned m = 1;
+	unsigned sym = 0;
+	for (unsigned i = 0; i < bits; i++) {
+		unsigned b = lzma_rd_bit (r, probs + m);
+		m = (m << 1) | b;
+		sym |= b << i;
+	}
+	return sym;
+}
 
-			/* Check output capacity */
-			if (dst_pos + length > dst_capacity) {
-				return 0; /* Output overflow */
-			}
+static inline uint32_t lzma_rd_direct(lzma_rd *r, unsigned bits) {
+	uint32_t v = 0;
+	while (bits--) {
+		lzma_rd_norm (r);
+		r->range >>= 1;
+		uint32_t t = (r->code - r->range) >> 31; /* 1 when code < range */
+		r->code -= r->range & (t - 1);
+		v = (v << 1) | (1 - t);
+	}
+	return v;
+}
 
-			/* Output run */
-			memset (dst + dst_pos, byte, length);
-			dst_pos += length;
-		} else if (marker == 0x01) {
-			/* Literal sequence */
-			uint8_t length = src[src_pos++];
+static inline uint32_t lzma_rd_len(lzma_rd *r, lzma_len_model *lm, unsigned ps) {
+	if (!lzma_rd_bit (r, &lm->choice)) {
+		return lzma_rd_tree (r, lm->low[ps], 3);
+	}
+	if (!lzma_rd_bit (r, &lm->choice2)) {
+		return LZMA_LEN_LOW + lzma_rd_tree (r, lm->mid[ps], 3);
+	}
+	return LZMA_LEN_LOW + LZMA_LEN_MID + lzma_rd_tree (r, lm->high, 8);
+}
 
-			if (src_pos + length > src_size || dst_pos + length > dst_capacity) {
-				return 0; /* Invalid input or output overflow */
-			}
+/* Distance minus one of a match of len bytes; 0xFFFFFFFF is the end marker */
+static inline uint32_t lzma_rd_dist(lzma_rd *r, lzma_model *m, uint32_t len) {
+	unsigned slot = lzma_rd_tree (r, m->dist_slot[lzma_dist_state (len)], 6);
+	if (slot < LZMA_DIST_MODEL_START) {
+		return slot;
+	}
+	unsigned nb = (slot >> 1) - 1;
+	uint32_t dist = (2 | (slot & 1)) << nb;
+	if (slot < LZMA_DIST_MODEL_END) {
+		return dist + lzma_rd_tree_rev (r, m->dist_special + dist - slot, nb);
+	}
+	dist += lzma_rd_direct (r, nb - LZMA_ALIGN_BITS) << LZMA_ALIGN_BITS;
+	return dist + lzma_rd_tree_rev (r, m->dist_align, LZMA_ALIGN_BITS);
+}
 
-			/* Copy literals */
-			memcpy (dst + dst_pos, src + src_pos, length);
-			dst_pos += length;
-			src_pos += length;
+/* --- Decoder --- */
+
+/* Decode into the dictionary up to dic_limit. Unless final, stop while
+ * fewer than LZMA_REQUIRED_INPUT bytes are left so no symbol is cut
+ * short. Returns 0, or -1 on corrupt or truncated data. */
+static int lzma_dec_run(lzma_decompress_context *d, size_t dic_limit, const uint8_t **in, const uint8_t *iend, int final) {
+	lzma_rd r = { d->range, d->code, *in, iend, 0 };
+	lzma_model *m = &d->m;
+	uint8_t *dic = d->dic;
+	size_t dic_size = d->dic_size;
+	size_t pos = d->dic_pos;
+	uint64_t total = d->out_total;
+	unsigned state = d->state;
+	uint32_t rep0 = d->reps[0];
+	uint32_t rep1 = d->reps[1];
+	uint32_t rep2 = d->reps[2];
+	uint32_t rep3 = d->reps[3];
+	uint32_t rem = d->rem_len;
+	unsigned pb_mask = (1u << d->pb) - 1;
+	unsigned lp_mask = (1u << d->lp) - 1;
+	unsigned lc = d->lc;
+	int rc = 0;
+
+	/* finish a match cut short by the previous output limit */
+	for (; rem && pos < dic_limit; rem--) {
+		dic[pos] = dic[pos > rep0? pos - rep0 - 1: pos + dic_size - rep0 - 1];
+		pos++;
+		total++;
+	}
+	while (pos < dic_limit && !rem) {
+		if (d->size_known && total == d->unpack_size) {
+			d->finished = 1;
+			break;
+		}
+		if (!final && iend - r.ip < LZMA_REQUIRED_INPUT) {
+			break;
+		}
+		unsigned ps = (unsigned)total & pb_mask;
+		if (!lzma_rd_bit (&r, &m->is_match[state][ps])) {
+			unsigned prev = total? dic[(pos? pos: dic_size) - 1]: 0;
+			lzma_prob *probs = d->lit + LZMA_LIT_SIZE * ((((unsigned)total & lp_mask) << lc) + (prev >> (8 - lc)));
+			unsigned sym = 1;
+			if (state >= LZMA_LIT_STATES) {
+				unsigned mb = dic[pos > rep0? pos - rep0 - 1: pos + dic_size - rep0 - 1];
+				do {
+					unsigned mbit = (mb >> 7) & 1;
+					mb <<= 1;
+					unsigned b = lzma_rd_bit (&r, &probs[((1 + mbit) << 8) + sym]);
+					sym = (sym << 1) | b;
+					if (mbit != b) {
+						break;
+					}
+				} while (sym < 0x100);
+			}
+			while (sym < 0x100) {
+				sym = (sym << 1) | lzma_rd_bit (&r, &probs[sym]);
+			}
+			dic[pos++] = (uint8_t)sym;
+			total++;
+			state = lzma_state_literal (state);
+			continue;
+		}
+		uint32_t len = 0;
+		if (!lzma_rd_bit (&r, &m->is_rep[state])) {
+			len = lzma_rd_len (&r, &m->len, ps) + LZMA_MATCH_MIN;
+			uint32_t dist = lzma_rd_dist (&r, m, len);
+			if (dist == 0xFFFFFFFF) {
+				d->finished = 1;
+				break;
+			}
+			rep3 = rep2;
+			rep2 = rep1;
+			rep1 = rep0;
+			rep0 = dist;
+			state = lzma_state_match (state);
+		} else {
+			if (!lzma_rd_bit (&r, &m->is_rep0[state])) {
+				if (!lzma_rd_bit (&r, &m->is_rep0_long[state][ps])) {
+					len = 1;
+					state = lzma_state_short_rep (state);
+				}
+			} else {
+				uint32_t dist;
+				if (!lzma_rd_bit (&r, &m->is_rep1[state])) {
+					dist = rep1;
+				} else {
+					if (!lzma_rd_bit (&r, &m->is_rep2[state])) {
+						dist = rep2;
+					} else {
+						dist = rep3;
+						rep3 = rep2;
+					}
+					rep2 = rep1;
+				}
+				rep1 = rep0;
+				rep0 = dist;
+			}
+			if (!len) {
+				len = lzma_rd_len (&r, &m->rep_len, ps) + LZMA_MATCH_MIN;
+				state = lzma_state_rep (state);
+			}
+		}
+		if (rep0 >= total || rep0 >= d->dict_size || (d->size_known && d->unpack_size - total < len)) {
+			rc = -1;
+			break;
+		}
+		size_t n = len;
+		if (n > dic_limit - pos) {
+			n = dic_limit - pos;
+		}
+		rem = len - (uint32_t)n;
+		total += n;
+		if (pos > rep0 && rep0 >= n) {
+			memcpy (dic + pos, dic + pos - rep0 - 1, n);
+			pos += n;
 		} else {
-			return 0; /* Invalid marker */
+			size_t src = pos > rep0? pos - rep0 - 1: pos + dic_size - rep0 - 1;
+			while (n--) {
+				dic[pos++] = dic[src++];
+				if (src == dic_size) {
+					src = 0;
+				}
+			}
+		}
+	}
+	if (d->size_known && total == d->unpack_size && !rem) {
+		d->finished = 1;
+	}
+	if (r.overrun) {
+		rc = -1;
+	}
+	d->range = r.range;
+	d->code = r.code;
+	d->dic_pos = pos;
+	d->out_total = total;
+	d->state = state;
+	d->reps[0] = rep0;
+	d->reps[1] = rep1;
+	d->reps[2] = rep2;
+	d->reps[3] = rep3;
+	d->rem_len = rem;
+	*in = r.ip;
+	return rc;
+}
+
+/* Set up the model and dictionary once the header and the range coder
+ * init bytes are in. A one-shot call whose output holds the whole
+ * stream decodes straight into next_out. */
+static int lzma_dec_start(lzma_decompress_context *d, z_stream *strm, int flush) {
+	const uint8_t *h = d->hdr;
+	if (lzma_props_decode (h[0], &d->lc, &d->lp, &d->pb) != 0 || h[LZMA_HEADER_SIZE] != 0) {
+		return Z_DATA_ERROR;
+	}
+	d->dict_size = (uint32_t)h[1] | ((uint32_t)h[2] << 8) | ((uint32_t)h[3] << 16) | ((uint32_t)h[4] << 24);
+	if (d->dict_size < LZMA_DICT_MIN) {
+		d->dict_size = LZMA_DICT_MIN;
+	}
+	d->unpack_size = read_uint64_le (h + LZMA_PROPS_SIZE);
+	d->size_known = d->unpack_size != UINT64_MAX;
+	size_t n_lit = (size_t)LZMA_LIT_SIZE << (d->lc + d->lp);
+	if (n_lit > d->lit_alloc) {
+		free (d->lit);
+		d->lit = (lzma_prob *)malloc (n_lit * sizeof (lzma_prob));
+		d->lit_alloc = d->lit? n_lit: 0;
+		if (!d->lit) {
+			return Z_MEM_ERROR;
+		}
+	}
+	lzma_model_init (&d->m, d->lit, n_lit);
+	d->range = 0xFFFFFFFF;
+	d->code = ((uint32_t)h[14] << 24) | ((uint32_t)h[15] << 16) | ((uint32_t)h[16] << 8) | h[17];
+
+	if (flush == Z_FINISH && d->size_known && d->unpack_size <= strm->avail_out) {
+		d->dic = strm->next_out;
+		d->dic_size = (size_t)d->unpack_size;
+		return Z_OK;
+	}
+	uint64_t size = d->dict_size;
+	if (d->size_known && d->unpack_size < size) {
+		size = d->unpack_size? d->unpack_size: 1;
+	}
+	if (size > d->dic_alloc) {
+		free (d->dic_buf);
+		d->dic_buf = (uint8_t *)malloc ((size_t)size);
+		d->dic_alloc = d->dic_buf? (size_t)size: 0;
+		if (!d->dic_buf) {
+			return Z_MEM_ERROR;
 		}
 	}
+	d->dic = d->dic_buf;
+	d->dic_size = (size_t)size;
+	d->dic_owned = 1;
+	return Z_OK;
+}
 
-	return (int)dst_pos; /* Return decompressed size */
+static inline void lzma_dec_skip(z_stream *strm, size_t n) {
+	strm->next_in += n;
+	strm->avail_in -= (uInt)n;
+	strm->total_in += n;
 }
 
-/* Read 64-bit little endian integer */
-static uint64_t read_uint64_le(const uint8_t *p) {
-	uint64_t value = 0;
-	for (int i = 0; i < 8; i++) {
-		value |= ((uint64_t)p[i]) << (i * 8);
+/* Decode one batch from the held-back bytes topped up from next_in, or
+ * straight from next_in. Returns 1 when more input is needed, 0 to go
+ * on, or -1 on corrupt data. */
+static int lzma_dec_step(lzma_decompress_context *d, z_stream *strm, size_t limit, int final) {
+	size_t before = d->dic_pos;
+	const uint8_t *ip;
+	if (d->tmp_len) {
+		size_t old = d->tmp_len;
+		size_t take = LZMA_REQUIRED_INPUT > old? LZMA_REQUIRED_INPUT - old: 0;
+		if (take > strm->avail_in) {
+			take = strm->avail_in;
+		}
+		memcpy (d->tmp + old, strm->next_in, take);
+		ip = d->tmp;
+		int fin = final && take == strm->avail_in;
+		if (lzma_dec_run (d, limit, &ip, d->tmp + old + take, fin) != 0) {
+			return -1;
+		}
+		size_t used = (size_t)(ip - d->tmp);
+		if (used >= old) {
+			lzma_dec_skip (strm, used - old);
+			d->tmp_len = 0;
+		} else if (used == 0 && d->dic_pos == before && !d->finished) {
+			/* not enough for one symbol: keep the new bytes too */
+			lzma_dec_skip (strm, take);
+			d->tmp_len = old + take;
+			return 1;
+		} else {
+			memmove (d->tmp, d->tmp + used, old - used);
+			d->tmp_len = old - used;
+		}
+		return 0;
 	}
-	return value;
+	ip = strm->next_in;
+	if (lzma_dec_run (d, limit, &ip, ip + strm->avail_in, final) != 0) {
+		return -1;
+	}
+	lzma_dec_skip (strm, (size_t)(ip - strm->next_in));
+	if (!d->finished && !d->rem_len && d->dic_pos < limit && !final) {
+		/* fewer bytes than one symbol may need are left */
+		memcpy (d->tmp, strm->next_in, strm->avail_in);
+		d->tmp_len = strm->avail_in;
+		lzma_dec_skip (strm, strm->avail_in);
+		return 1;
+	}
+	return 0;
 }
 
 /* --- LZMA API Implementation --- */
@@ -171,33 +477,12 @@ int lzmaDecompressInit(z_stream *strm) {
 		return Z_STREAM_ERROR;
 	}
 
-	/* Allocate decompression context */
+	/* Allocate decompression context; the model is set up by the header */
 	lzma_decompress_context *ctx = (lzma_decompress_context *)calloc (1, sizeof (lzma_decompress_context));
 	if (!ctx) {
 		return Z_MEM_ERROR;
 	}
 
-	/* Initialize context with default values */
-	ctx->window_size = 1 << 16; /* 64KB window by default */
-	ctx->is_last_block = 0;
-	ctx->uncompressed_size = 0;
-
-	/* Allocate window buffer */
-	ctx->window_buffer = (uint8_t *)malloc (ctx->window_size);
-	if (!ctx->window_buffer) {
-		free (ctx);
-		return Z_MEM_ERROR;
-	}
-
-	/* Allocate decompression buffer */
-	ctx->decompress_buffer_size = ctx->window_size;
-	ctx->decompress_buffer = (uint8_t *)malloc (ctx->decompress_buffer_size);
-	if (!ctx->decompress_buffer) {
-		free (ctx->window_buffer);
-		free (ctx);
-		return Z_MEM_ERROR;
-	}
-
 	/* Initialize stream */
 	strm->state = (void *)ctx;
 	strm->total_in = 0;
@@ -206,112 +491,115 @@ int lzmaDecompressInit(z_stream *strm) {
 	return Z_OK;
 }
 
-/* Decompress data using LZMA format */
+static inline int lzma_progress(const z_stream *strm, uLong in0, uLong out0) {
+	return (strm->total_in != in0 || strm->total_out != out0)? Z_OK: Z_BUF_ERROR;
+}
+
+/* Decompress data using LZMA format. Input and output may come in pieces;
+ * the last few bytes of input are held back until Z_FINISH says no more
+ * follows, unless the declared size has been reached by then. */
 int lzmaDecompress(z_stream *strm, int flush) {
 	if (!strm || !strm->state) {
 		return Z_STREAM_ERROR;
 	}
 
 	lzma_decompress_context *ctx = (lzma_decompress_context *)strm->state;
-
-	/* Process LZMA header if this is the first call */
-	if (strm->total_in == 0) {
-		/* Need at least the LZMA header */
-		if (strm->avail_in < LZMA_HEADER_SIZE) {
-			return Z_BUF_ERROR;
-		}
-
-		/* Read LZMA properties */
-		memcpy (ctx->properties, strm->next_in, LZMA_PROPS_SIZE);
-
-		/* Read uncompressed size */
-		ctx->uncompressed_size = read_uint64_le (strm->next_in + LZMA_PROPS_SIZE);
-
-		/* Skip header */
-		strm->next_in += LZMA_HEADER_SIZE;
-		strm->avail_in -= LZMA_HEADER_SIZE;
-		strm->total_in += LZMA_HEADER_SIZE;
+	uLong in0 = strm->total_in;
+	uLong out0 = strm->total_out;
+	if (ctx->corrupt) {
+		return Z_DATA_ERROR;
 	}
 
-	/* If we have remaining data from a previous block, output it first */
-	if (ctx->current_block_remaining > 0) {
-		size_t copy_size = ctx->current_block_remaining;
-		if (copy_size > strm->avail_out) {
-			copy_size = strm->avail_out;
+	/* Header and the first range coder bytes */
+	if (ctx->hdr_len < sizeof (ctx->hdr)) {
+		size_t take = sizeof (ctx->hdr) - ctx->hdr_len;
+		if (take > strm->avail_in) {
+			take = strm->avail_in;
 		}
-
-		/* Copy data to output */
-		memcpy (strm->next_out,
-			ctx->decompress_buffer + (ctx->current_block_size - ctx->current_block_remaining),
-			copy_size);
-
-		/* Update counters */
-		strm->next_out += (uint32_t)copy_size;
-		strm->avail_out -= (uint32_t)copy_size;
-		strm->total_out += (uint32_t)copy_size;
-		ctx->current_block_remaining -= (int)copy_size;
-
-		/* If we filled the output buffer, return for more space */
-		if (strm->avail_out == 0) {
-			return Z_OK;
+		memcpy (ctx->hdr + ctx->hdr_len, strm->next_in, take);
+		lzma_dec_skip (strm, take);
+		ctx->hdr_len += take;
+		if (ctx->hdr_len < sizeof (ctx->hdr)) {
+			return lzma_progress (strm, in0, out0);
+		}
+		int r = lzma_dec_start (ctx, strm, flush);
+		if (r != Z_OK) {
+			ctx->corrupt = 1;
+			return r;
 		}
 	}
 
-	/* Process more input if available */
-	if (strm->avail_in > 0) {
-		/* Try to decompress what we have */
-		size_t decomp_size = simple_lzma_decompress (ctx->properties,
-			strm->next_in,
-			strm->avail_in,
-			ctx->decompress_buffer,
-			ctx->decompress_buffer_size);
-
-		/* If decompression failed, return error */
-		if (decomp_size == 0) {
-			return Z_DATA_ERROR;
+	for (;;) {
+		/* hand decoded bytes to the caller */
+		size_t n = ctx->dic_pos - ctx->flush_pos;
+		if (ctx->dic_owned) {
+			if (n > strm->avail_out) {
+				n = strm->avail_out;
+			}
+			memcpy (strm->next_out, ctx->dic + ctx->flush_pos, n);
 		}
-
-		/* Update input counters */
-		strm->next_in += strm->avail_in;
-		strm->total_in += strm->avail_in;
-		strm->avail_in = 0;
-
-		/* Check if we have enough output space */
-		if (strm->avail_out >= decomp_size) {
-			/* Copy all data to output */
-			memcpy (strm->next_out, ctx->decompress_buffer, decomp_size);
-			strm->next_out += (uint32_t)decomp_size;
-			strm->avail_out -= (uint32_t)decomp_size;
-			strm->total_out += (uint32_t)decomp_size;
-		} else {
-			/* Store partial data for later */
-			memcpy (strm->next_out, ctx->decompress_buffer, strm->avail_out);
-			ctx->current_block_size = (uint32_t)decomp_size;
-			ctx->current_block_remaining = (int) (decomp_size - strm->avail_out);
-			strm->total_out += strm->avail_out;
-			strm->next_out += strm->avail_out;
-			strm->avail_out = 0;
-			return Z_OK;
+		strm->next_out += n;
+		strm->avail_out -= (uInt)n;
+		strm->total_out += n;
+		ctx->flush_pos += n;
+		if (ctx->flush_pos < ctx->dic_pos) {
+			return lzma_progress (strm, in0, out0);
 		}
-	}
-
-	/* Determine if we're finished */
-	if (ctx->uncompressed_size != 0xFFFFFFFFFFFFFFFF) {
-		/* Known size - check if we've output everything */
-		if (strm->total_out >= ctx->uncompressed_size) {
-			return Z_STREAM_END;
+		if (ctx->dic_owned && ctx->dic_pos == ctx->dic_size) {
+			ctx->dic_pos = 0;
+			ctx->flush_pos = 0;
 		}
-	} else {
-		/* Unknown size - check if flush is FINISH and no more input */
-		if (flush == Z_FINISH && strm->avail_in == 0) {
+		if (ctx->finished) {
+			if (ctx->size_known && ctx->out_total != ctx->unpack_size) {
+				return Z_DATA_ERROR;
+			}
 			return Z_STREAM_END;
 		}
+
+		size_t limit = ctx->dic_size;
+		if (ctx->dic_owned && limit - ctx->dic_pos > strm->avail_out) {
+			limit = ctx->dic_pos + strm->avail_out;
+		}
+		if (limit == ctx->dic_pos) {
+			if (!ctx->dic_owned) {
+				/* the whole stream was decoded without reaching its end */
+				ctx->corrupt = 1;
+				return Z_DATA_ERROR;
+			}
+			return lzma_progress (strm, in0, out0);
+		}
+		int r = lzma_dec_step (ctx, strm, limit, flush == Z_FINISH);
+		if (r < 0) {
+			ctx->corrupt = 1;
+			return Z_DATA_ERROR;
+		}
+		if (r > 0) {
+			return lzma_progress (strm, in0, out0);
+		}
 	}
+}
 
+/* End a decompression stream */
+/* Start a new stream, keeping the literal model and dictionary buffers */
+int lzmaDecompressReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	lzma_decompress_context *ctx = (lzma_decompress_context *)strm->state;
+	lzma_prob *lit = ctx->lit;
+	size_t lit_alloc = ctx->lit_alloc;
+	uint8_t *dic_buf = ctx->dic_buf;
+	size_t dic_alloc = ctx->dic_alloc;
+	memset (ctx, 0, sizeof (*ctx));
+	ctx->lit = lit;
+	ctx->lit_alloc = lit_alloc;
+	ctx->dic_buf = dic_buf;
+	ctx->dic_alloc = dic_alloc;
+	strm->total_in = 0;
+	strm->total_out = 0;
 	return Z_OK;
 }
 
-/* End a decompression stream */
 int lzmaDecompressEnd(z_stream *strm) {
 	if (!strm || !strm->state) {
 		return Z_STREAM_ERROR;
@@ -320,8 +608,8 @@ int lzmaDecompressEnd(z_stream *strm) {
 	lzma_decompress_context *ctx = (lzma_decompress_context *)strm->state;
 
 	/* Free allocated buffers */
-	free (ctx->window_buffer);
-	free (ctx->decompress_buffer);
+	free (ctx->dic_buf);
+	free (ctx->lit);
 
 	/* Free context */
 	free (ctx);
@@ -1,5 +1,5 @@
 /* lzma-enc.inc.c - Minimalistic LZMA encoder implementation compatible with zlib-like API
- * Version: 0.1 (2025-07-27)
+ * Version: 0.2 (2025-07-27)
  *
  * This implementation provides LZMA encoder with zlib-compatible wrappers:
  *
@@ -7,10 +7,10 @@
  *   lzmaCompress
  *   lzmaEnd
  *
- * It supports:
- * - Basic LZMA compression
- * - Bare minimum functionality to support ZIP file writing
- * - Compatible interface with existing compression implementations
+ * It writes LZMA1 streams behind the 13-byte .lzma header. Levels 1-3 use
+ * hc4 hash chains with greedy parsing, levels 4-9 bt4 binary trees with
+ * price-based optimal parsing; the dictionary size follows the level or
+ * the windowBits of lzmaCompressInit2.
  *
  * Usage:
  *   #define MLZMA_IMPLEMENTATION in one source file before including
@@ -21,6 +21,7 @@
 #ifndef MLZMA_ENC_H
 #define MLZMA_ENC_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -65,20 +66,25 @@
 /* Unified z_stream declaration */
 #include "../include/otezip/zstream.h"
 
-/* LZMA compression context */
+/* LZMA compression context: input is gathered until Z_FINISH, encoded in
+ * one pass and then handed out through next_out */
 typedef struct {
-	int compression_level;
-	uint8_t properties[LZMA_PROPS_SIZE];
-	uint8_t *dict_buffer;
-	size_t dict_size;
-	uint8_t *window_buffer;
-	size_t window_size;
-	size_t window_pos;
-	int is_last_block;
-
-	/* Work buffers */
-	uint8_t *compress_buffer;
-	size_t compress_buffer_size;
+	int level;
+	unsigned dict_log;
+	uint8_t *in;
+	size_t in_len;
+	size_t in_cap;
+	uint8_t *out;
+	size_t out_len;
+	size_t out_pos;
+	size_t out_cap;
+	int encoded;
+	/* encoder state and match finder, kept by lzmaReset */
+	struct lzma_enc *enc;
+	uint32_t *hash;
+	uint32_t *son;
+	size_t hash_alloc;
+	size_t son_alloc;
 } lzma_compress_context;
 
 /* ------------- Function Prototypes ------------- */
@@ -91,6 +97,7 @@ extern "C" {
 /* Compression */
 int lzmaInit(z_stream *strm, int level);
 int lzmaCompress(z_stream *strm, int flush);
+int lzmaReset(z_stream *strm);
 int lzmaEnd(z_stream *strm);
 
 /* Helpers for zlib compatibility layer */
@@ -106,200 +113,1108 @@ int lzmaCompressInit2_(z_stream *strm, int level, int windowBits, int memLevel,
 
 /* --- Helper Functions --- */
 
-/* Simple Byte-by-byte LZ compression for LZMA blocks */
-static int simple_lzma_compress(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_capacity, uint8_t *props) {
-	/* This is a very simplified compression that just does basic RLE-like compression */
-	if (src_size == 0 || !src || !dst || dst_capacity < LZMA_HEADER_SIZE + src_size) {
-		return 0; /* Invalid input or not enough output capacity */
+#define LZMA_ENC_LC 3
+#define LZMA_ENC_PB 2
+#define LZMA_ENC_POS_MASK ((1u << LZMA_ENC_PB) - 1)
+#define LZMA_DICT_LOG_MIN 12
+#define LZMA_DICT_LOG_MAX 27
+#define LZMA_HASH2_BITS 10
+#define LZMA_HASH3_BITS 16
+#define LZMA_OPT_NUM (1 << 12) /* positions one optimal parsing step may span */
+#define LZMA_PRICE_INF (1u << 30)
+#define LZMA_BACK_LIT 0xFFFFFFFFu
+#define LZMA_REPS 4
+
+/* Level presets: dictionary log, bt4 (1) or hc4 (0) match finder,
+ * optimal (1) or greedy with one byte lookahead (0) parsing, nice length
+ * and search depth */
+static const struct {
+	uint8_t dict_log;
+	uint8_t bt;
+	uint8_t optimal;
+	uint16_t nice;
+	uint16_t depth;
+} lzma_levels[10] = {
+	{ 20, 0, 0, 32, 4 }, /* 0: unused, see lzmaInit */
+	{ 20, 0, 0, 32, 4 },
+	{ 21, 0, 0, 64, 8 },
+	{ 22, 0, 0, 128, 16 },
+	{ 22, 1, 1, 32, 16 },
+	{ 23, 1, 1, 32, 24 },
+	{ 23, 1, 1, 64, 32 },
+	{ 24, 1, 1, 64, 48 },
+	{ 25, 1, 1, 128, 64 },
+	{ 26, 1, 1, 273, 128 },
+};
+
+/* One position of the optimal parser: the cheapest way found to get here */
+typedef struct {
+	uint32_t price;
+	uint32_t prev;
+	uint32_t back; /* LZMA_BACK_LIT, a rep index, or LZMA_REPS + distance */
+	uint32_t state;
+	uint32_t reps[LZMA_REPS];
+} lzma_opt;
+
+/* Encoder working state for one stream */
+typedef struct lzma_enc {
+	/* range encoder, writing into a growing buffer */
+	uint64_t low;
+	uint32_t range;
+	uint8_t cache;
+	uint64_t cache_size;
+	uint8_t *out;
+	size_t out_len;
+	size_t out_cap;
+	int oom;
+
+	lzma_model m;
+	lzma_prob lit[LZMA_LIT_SIZE << LZMA_ENC_LC];
+	unsigned state;
+	uint32_t reps[LZMA_REPS];
+	const uint8_t *buf;
+	size_t n;
+	size_t pos; /* next byte to encode */
+
+	/* match finder: 2, 3 and 4 byte hash heads followed by hash chains
+	 * (hc4) or binary trees (bt4) over the last cyc_size positions.
+	 * Stored references are position + cyc_size so that 0 means empty. */
+	uint32_t *hash;
+	uint32_t *son;
+	unsigned hash4_bits;
+	uint32_t cyc_size;
+	uint32_t cyc_pos;
+	size_t mf_pos; /* next position to insert */
+	int bt;
+	int optimal;
+	unsigned nice;
+	unsigned depth;
+	uint32_t matches[2][2 * (LZMA_MATCH_MAX + 2)]; /* (len, dist) pairs, len ascending */
+
+	/* prices in 1/16 bit */
+	uint32_t prob_prices[(1 << LZMA_PROB_BITS) >> 4];
+	uint32_t len_prices[1 << LZMA_ENC_PB][LZMA_LEN_SYMBOLS];
+	uint32_t rep_len_prices[1 << LZMA_ENC_PB][LZMA_LEN_SYMBOLS];
+	uint32_t slot_prices[LZMA_DIST_STATES][LZMA_DIST_SLOTS];
+	uint32_t dist_prices[LZMA_DIST_STATES][LZMA_FULL_DISTANCES];
+	uint32_t align_prices[LZMA_ALIGN_SIZE];
+	unsigned len_count;
+	unsigned dist_count;
+	unsigned align_count;
+	lzma_opt opt[LZMA_OPT_NUM];
+	uint32_t path[LZMA_OPT_NUM];
+} lzma_enc;
+
+/* Index of the highest set bit, v must be non-zero */
+static inline unsigned lzma_highbit(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return 31 - (unsigned)__builtin_clz (v);
+#else
+	unsigned n = 0;
+	while (v >>= 1) {
+		n++;
 	}
+	return n;
+#endif
+}
+
+static inline unsigned lzma_dist_slot(uint32_t dist) {
+	if (dist < LZMA_DIST_MODEL_START) {
+		return dist;
+	}
+	unsigned n = lzma_highbit (dist);
+	return (n << 1) | ((dist >> (n - 1)) & 1);
+}
 
-	(void)props;
+/* Length of the common prefix of a and b, at most limit */
+static inline unsigned lzma_count(const uint8_t *a, const uint8_t *b, unsigned limit) {
+	unsigned len = 0;
+	while (len + 8 <= limit) {
+		uint64_t x, y;
+		memcpy (&x, a + len, 8);
+		memcpy (&y, b + len, 8);
+		if (x != y) {
+			break;
+		}
+		len += 8;
+	}
+	while (len < limit && a[len] == b[len]) {
+		len++;
+	}
+	return len;
+}
 
-	/* For this minimal implementation, we'll do very simple RLE compression */
-	size_t dst_pos = 0;
-	size_t src_pos = 0;
+/* --- Range encoder --- */
 
-	while (src_pos < src_size) {
-		/* Check remaining output space */
-		if (dst_pos + 4 > dst_capacity) {
-			return 0; /* Not enough space */
+static void lzma_rc_byte(lzma_enc *e, uint8_t b) {
+	if (e->out_len == e->out_cap) {
+		size_t cap = e->out_cap * 2;
+		uint8_t *nb = (uint8_t *)realloc (e->out, cap);
+		if (!nb) {
+			e->oom = 1;
+			return;
 		}
+		e->out = nb;
+		e->out_cap = cap;
+	}
+	e->out[e->out_len++] = b;
+}
+
+static void lzma_rc_shift_low(lzma_enc *e) {
+	if ((uint32_t)e->low < 0xFF000000u || (e->low >> 32) != 0) {
+		uint8_t carry = (uint8_t)(e->low >> 32);
+		uint8_t temp = e->cache;
+		do {
+			lzma_rc_byte (e, (uint8_t)(temp + carry));
+			temp = 0xFF;
+		} while (--e->cache_size != 0);
+		e->cache = (uint8_t)(e->low >> 24);
+	}
+	e->cache_size++;
+	e->low = (e->low & 0x00FFFFFF) << 8;
+}
 
-		/* Find runs of identical bytes */
-		uint8_t run_byte = src[src_pos];
-		size_t run_length = 1;
+static inline void lzma_rc_bit(lzma_enc *e, lzma_prob *p, unsigned bit) {
+	uint32_t bound = (e->range >> LZMA_PROB_BITS) * *p;
+	if (!bit) {
+		e->range = bound;
+		*p = (lzma_prob)(*p + (((1u << LZMA_PROB_BITS) - *p) >> LZMA_MOVE_BITS));
+	} else {
+		e->low += bound;
+		e->range -= bound;
+		*p = (lzma_prob)(*p - (*p >> LZMA_MOVE_BITS));
+	}
+	if (e->range < LZMA_TOP) {
+		e->range <<= 8;
+		lzma_rc_shift_low (e);
+	}
+}
 
-		while (src_pos + run_length < src_size &&
-			src[src_pos + run_length] == run_byte &&
-			run_length < 255) {
-			run_length++;
+static void lzma_rc_direct(lzma_enc *e, uint32_t v, unsigned bits) {
+	while (bits--) {
+		e->range >>= 1;
+		e->low += e->range & (0u - ((v >> bits) & 1));
+		if (e->range < LZMA_TOP) {
+			e->range <<= 8;
+			lzma_rc_shift_low (e);
 		}
+	}
+}
+
+static void lzma_rc_tree(lzma_enc *e, lzma_prob *probs, unsigned bits, unsigned sym) {
+	unsigned m = 1;
+	while (bits--) {
+		unsigned b = (sym >> bits) & 1;
+		lzma_rc_bit (e, probs + m, b);
+		m = (m << 1) | b;
+	}
+}
+
+static void lzma_rc_tree_rev(lzma_enc *e, lzma_prob *probs, unsigned bits, unsigned sym) {
+	unsigned m = 1;
+	while (bits--) {
+		unsigned b = sym & 1;
+		sym >>= 1;
+		lzma_rc_bit (e, probs + m, b);
+		m = (m << 1) | b;
+	}
+}
 
-		if (run_length >= 4) {
-			/* Encode run */
-			dst[dst_pos++] = 0x00; /* RLE marker */
-			dst[dst_pos++] = run_byte; /* Repeated byte */
-			dst[dst_pos++] = (uint8_t)run_length; /* Length */
-			src_pos += run_length;
+static void lzma_rc_len(lzma_enc *e, lzma_len_model *lm, unsigned len, unsigned ps) {
+	len -= LZMA_MATCH_MIN;
+	if (len < LZMA_LEN_LOW) {
+		lzma_rc_bit (e, &lm->choice, 0);
+		lzma_rc_tree (e, lm->low[ps], 3, len);
+	} else if (len < LZMA_LEN_LOW + LZMA_LEN_MID) {
+		lzma_rc_bit (e, &lm->choice, 1);
+		lzma_rc_bit (e, &lm->choice2, 0);
+		lzma_rc_tree (e, lm->mid[ps], 3, len - LZMA_LEN_LOW);
+	} else {
+		lzma_rc_bit (e, &lm->choice, 1);
+		lzma_rc_bit (e, &lm->choice2, 1);
+		lzma_rc_tree (e, lm->high, 8, len - LZMA_LEN_LOW - LZMA_LEN_MID);
+	}
+}
+
+/* --- Symbol encoding --- */
+
+static inline lzma_prob *lzma_lit_probs(lzma_enc *e, size_t pos) {
+	unsigned prev = pos? e->buf[pos - 1]: 0;
+	return e->lit + LZMA_LIT_SIZE * (prev >> (8 - LZMA_ENC_LC));
+}
+
+static void lzma_emit_literal(lzma_enc *e) {
+	size_t pos = e->pos;
+	unsigned ps = (unsigned)pos & LZMA_ENC_POS_MASK;
+	lzma_prob *probs = lzma_lit_probs (e, pos);
+	unsigned sym = e->buf[pos] | 0x100;
+	lzma_rc_bit (e, &e->m.is_match[e->state][ps], 0);
+	if (e->state >= LZMA_LIT_STATES) {
+		unsigned match_byte = e->buf[pos - e->reps[0] - 1];
+		unsigned offs = 0x100;
+		do {
+			match_byte <<= 1;
+			lzma_rc_bit (e, &probs[offs + (match_byte & offs) + (sym >> 8)], (sym >> 7) & 1);
+			sym <<= 1;
+			offs &= ~(match_byte ^ sym);
+		} while (sym < 0x10000);
+	} else {
+		do {
+			lzma_rc_bit (e, &probs[sym >> 8], (sym >> 7) & 1);
+			sym <<= 1;
+		} while (sym < 0x10000);
+	}
+	e->state = lzma_state_literal (e->state);
+	e->pos++;
+}
+
+static void lzma_emit_match(lzma_enc *e, uint32_t dist, unsigned len) {
+	lzma_model *m = &e->m;
+	unsigned ps = (unsigned)e->pos & LZMA_ENC_POS_MASK;
+	lzma_rc_bit (e, &m->is_match[e->state][ps], 1);
+	lzma_rc_bit (e, &m->is_rep[e->state], 0);
+	lzma_rc_len (e, &m->len, len, ps);
+	unsigned slot = lzma_dist_slot (dist);
+	lzma_rc_tree (e, m->dist_slot[lzma_dist_state (len)], 6, slot);
+	if (slot >= LZMA_DIST_MODEL_START) {
+		unsigned nb = (slot >> 1) - 1;
+		uint32_t base = (2 | (slot & 1)) << nb;
+		uint32_t reduced = dist - base;
+		if (slot < LZMA_DIST_MODEL_END) {
+			lzma_rc_tree_rev (e, m->dist_special + base - slot, nb, reduced);
 		} else {
-			/* Literal */
-			dst[dst_pos++] = 0x01; /* Literal marker */
-			dst[dst_pos++] = (uint8_t)run_length; /* Number of literals */
+			lzma_rc_direct (e, reduced >> LZMA_ALIGN_BITS, nb - LZMA_ALIGN_BITS);
+			lzma_rc_tree_rev (e, m->dist_align, LZMA_ALIGN_BITS, reduced & (LZMA_ALIGN_SIZE - 1));
+			e->align_count++;
+		}
+	}
+	e->reps[3] = e->reps[2];
+	e->reps[2] = e->reps[1];
+	e->reps[1] = e->reps[0];
+	e->reps[0] = dist;
+	e->state = lzma_state_match (e->state);
+	e->pos += len;
+	e->len_count++;
+	e->dist_count++;
+}
 
-			/* Copy literals */
-			if (dst_pos + run_length > dst_capacity) {
-				return 0; /* Not enough space */
+/* Repeat the distance in reps[r]; len 1 with r 0 is a short rep */
+static void lzma_emit_rep(lzma_enc *e, unsigned r, unsigned len) {
+	lzma_model *m = &e->m;
+	unsigned st = e->state;
+	unsigned ps = (unsigned)e->pos & LZMA_ENC_POS_MASK;
+	lzma_rc_bit (e, &m->is_match[st][ps], 1);
+	lzma_rc_bit (e, &m->is_rep[st], 1);
+	if (!r) {
+		lzma_rc_bit (e, &m->is_rep0[st], 0);
+		lzma_rc_bit (e, &m->is_rep0_long[st][ps], len != 1);
+	} else {
+		uint32_t dist = e->reps[r];
+		lzma_rc_bit (e, &m->is_rep0[st], 1);
+		if (r == 1) {
+			lzma_rc_bit (e, &m->is_rep1[st], 0);
+		} else {
+			lzma_rc_bit (e, &m->is_rep1[st], 1);
+			lzma_rc_bit (e, &m->is_rep2[st], r - 2);
+			if (r == 3) {
+				e->reps[3] = e->reps[2];
 			}
-
-			memcpy (dst + dst_pos, src + src_pos, run_length);
-			dst_pos += run_length;
-			src_pos += run_length;
+			e->reps[2] = e->reps[1];
 		}
+		e->reps[1] = e->reps[0];
+		e->reps[0] = dist;
 	}
+	if (len == 1) {
+		e->state = lzma_state_short_rep (st);
+	} else {
+		lzma_rc_len (e, &m->rep_len, len, ps);
+		e->state = lzma_state_rep (st);
+		e->len_count++;
+	}
+	e->pos += len;
+}
 
-	return (int)dst_pos; /* Return compressed size */
+/* Encode one parser decision: a literal, a short rep, a rep or a match */
+static void lzma_emit(lzma_enc *e, uint32_t back, unsigned len) {
+	if (back == LZMA_BACK_LIT) {
+		lzma_emit_literal (e);
+	} else if (back < LZMA_REPS) {
+		lzma_emit_rep (e, back, len);
+	} else {
+		lzma_emit_match (e, back - LZMA_REPS, len);
+	}
 }
 
-/* --- LZMA API Implementation --- */
+/* --- Match finders --- */
 
-/* Initialize a compression stream */
-int lzmaInit(z_stream *strm, int level) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
-	}
+static inline void lzma_mf_hash(const lzma_enc *e, const uint8_t *p, uint32_t *h2, uint32_t *h3, uint32_t *h4) {
+	uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+	*h2 = ((v & 0xFFFF) * 2654435761u) >> (32 - LZMA_HASH2_BITS);
+	*h3 = (1u << LZMA_HASH2_BITS) + (((v & 0xFFFFFF) * 2654435761u) >> (32 - LZMA_HASH3_BITS));
+	*h4 = (1u << LZMA_HASH2_BITS) + (1u << LZMA_HASH3_BITS) + ((v * 2654435761u) >> (32 - e->hash4_bits));
+}
 
-	/* Set default level if needed */
-	if (level == Z_DEFAULT_COMPRESSION) {
-		level = LZMA_DEFAULT_LEVEL;
+static inline void lzma_mf_advance(lzma_enc *e) {
+	e->mf_pos++;
+	if (++e->cyc_pos == e->cyc_size) {
+		e->cyc_pos = 0;
 	}
+}
 
-	/* Allocate compression context */
-	lzma_compress_context *ctx = (lzma_compress_context *)calloc (1, sizeof (lzma_compress_context));
-	if (!ctx) {
-		return Z_MEM_ERROR;
+/* Slot of the position delta bytes back in the chain or tree arrays */
+static inline uint32_t lzma_mf_cyc(const lzma_enc *e, uint32_t delta) {
+	return e->cyc_pos - delta + (delta > e->cyc_pos? e->cyc_size: 0);
+}
+
+/* Walk the binary tree rooted at cur_match, re-rooting it at the current
+ * position. Appends each longer match over best to m when m is set. */
+static unsigned lzma_bt_walk(lzma_enc *e, uint32_t cur_match, unsigned limit, unsigned best, uint32_t *m) {
+	const uint8_t *cur = e->buf + e->mf_pos;
+	uint32_t ref = (uint32_t)e->mf_pos + e->cyc_size;
+	uint32_t *ptr0 = e->son + ((size_t)e->cyc_pos << 1) + 1;
+	uint32_t *ptr1 = e->son + ((size_t)e->cyc_pos << 1);
+	unsigned len0 = 0;
+	unsigned len1 = 0;
+	unsigned found = 0;
+	unsigned depth = e->depth;
+	for (;;) {
+		uint32_t delta = ref - cur_match;
+		if (depth-- == 0 || delta >= e->cyc_size) {
+			*ptr0 = *ptr1 = 0;
+			return found;
+		}
+		uint32_t *pair = e->son + ((size_t)lzma_mf_cyc (e, delta) << 1);
+		const uint8_t *pb = cur - delta;
+		unsigned len = len0 < len1? len0: len1;
+		if (pb[len] == cur[len]) {
+			len += 1 + lzma_count (pb + len + 1, cur + len + 1, limit - len - 1);
+			if (m && len > best) {
+				best = len;
+				m[2 * found] = len;
+				m[2 * found + 1] = delta - 1;
+				found++;
+			}
+			if (len == limit) {
+				*ptr1 = pair[0];
+				*ptr0 = pair[1];
+				return found;
+			}
+		}
+		if (pb[len] < cur[len]) {
+			*ptr1 = cur_match;
+			ptr1 = pair + 1;
+			cur_match = *ptr1;
+			len1 = len;
+		} else {
+			*ptr0 = cur_match;
+			ptr0 = pair;
+			cur_match = *ptr0;
+			len0 = len;
+		}
 	}
+}
 
-	/* Initialize context */
-	ctx->compression_level = level;
-	ctx->window_size = 1 << 16; /* 64KB window by default */
-	ctx->is_last_block = 0;
+/* Insert the position at mf_pos and, when m is set, collect its matches;
+ * returns the number of (len, dist) pairs. Lengths stop at the nice length
+ * in the search and the longest is then extended up to LZMA_MATCH_MAX. */
+static unsigned lzma_mf_find(lzma_enc *e, uint32_t *m) {
+	size_t avail = e->n - e->mf_pos;
+	unsigned full = avail < LZMA_MATCH_MAX? (unsigned)avail: LZMA_MATCH_MAX;
+	unsigned limit = full < e->nice? full: e->nice;
+	unsigned found = 0;
+	if (limit < 4) {
+		lzma_mf_advance (e);
+		return 0;
+	}
+	const uint8_t *cur = e->buf + e->mf_pos;
+	uint32_t ref = (uint32_t)e->mf_pos + e->cyc_size;
+	uint32_t h2, h3, h4;
+	lzma_mf_hash (e, cur, &h2, &h3, &h4);
+	uint32_t d2 = ref - e->hash[h2];
+	uint32_t d3 = ref - e->hash[h3];
+	uint32_t cur_match = e->hash[h4];
+	e->hash[h2] = ref;
+	e->hash[h3] = ref;
+	e->hash[h4] = ref;
 
-	/* Set default LZMA properties */
-	ctx->properties[0] = 0x5D; /* Dictionary size: 2^ (0x5D & 1F) = 2^29 = 512MB */
-	ctx->properties[1] = 0x00; /* LC = 0, LP = 0 */
-	ctx->properties[2] = 0x00; /* PB = 0 */
-	ctx->properties[3] = 0x00; /* Reserved */
-	ctx->properties[4] = 0x01; /* Version */
+	unsigned best = 1;
+	if (m) {
+		if (d2 < e->cyc_size && (cur - d2)[0] == cur[0] && (cur - d2)[1] == cur[1]) {
+			best = lzma_count (cur - d2, cur, limit);
+			m[0] = best;
+			m[1] = d2 - 1;
+			found = 1;
+		}
+		if (d3 != d2 && d3 < e->cyc_size && best < limit) {
+			unsigned len = lzma_count (cur - d3, cur, limit);
+			if (len >= 3 && len > best) {
+				best = len;
+				m[2 * found] = len;
+				m[2 * found + 1] = d3 - 1;
+				found++;
+			}
+		}
+		if (best < 3) {
+			best = 3;
+		}
+	}
+	if (e->bt) {
+		found += lzma_bt_walk (e, cur_match, limit, best, (m && best < limit)? m + 2 * found: NULL);
+	} else {
+		e->son[e->cyc_pos] = cur_match;
+		for (unsigned depth = e->depth; m && best < limit && depth > 0; depth--) {
+			uint32_t delta = ref - cur_match;
+			if (delta >= e->cyc_size) {
+				break;
+			}
+			const uint8_t *pb = cur - delta;
+			if (pb[best] == cur[best] && pb[0] == cur[0]) {
+				unsigned len = lzma_count (pb, cur, limit);
+				if (len > best) {
+					best = len;
+					m[2 * found] = len;
+					m[2 * found + 1] = delta - 1;
+					found++;
+				}
+			}
+			cur_match = e->son[lzma_mf_cyc (e, delta)];
+		}
+	}
+	if (found && m[2 * found - 2] == limit && limit < full) {
+		const uint8_t *pb = cur - m[2 * found - 1] - 1;
+		m[2 * found - 2] = limit + lzma_count (pb + limit, cur + limit, full - limit);
+	}
+	lzma_mf_advance (e);
+	return found;
+}
 
-	/* Allocate work buffers */
-	ctx->window_buffer = (uint8_t *)malloc (ctx->window_size);
-	if (!ctx->window_buffer) {
-		free (ctx);
-		return Z_MEM_ERROR;
+static void lzma_mf_skip(lzma_enc *e, size_t n) {
+	while (n--) {
+		lzma_mf_find (e, NULL);
 	}
+}
 
-	/* Allocate compression buffer. For our simple RLE/literal scheme the
-	 * worst-case expansion can be several times the input chunk size, so
-	 * allocate a larger working buffer to avoid early failures on random data. */
-	ctx->compress_buffer_size = 4 * ctx->window_size; /* Larger conservative overestimate */
-	ctx->compress_buffer = (uint8_t *)malloc (ctx->compress_buffer_size);
-	if (!ctx->compress_buffer) {
-		free (ctx->window_buffer);
-		free (ctx);
-		return Z_MEM_ERROR;
+/* --- Prices --- */
+
+static void lzma_prob_prices_init(uint32_t *prices) {
+	for (uint32_t i = 0; i < ((1u << LZMA_PROB_BITS) >> 4); i++) {
+		uint32_t w = (i << 4) + (1u << 3);
+		unsigned bits = 0;
+		for (int j = 0; j < 4; j++) {
+			w = w * w;
+			bits <<= 1;
+			while (w >= (1u << 16)) {
+				w >>= 1;
+				bits++;
+			}
+		}
+		prices[i] = (LZMA_PROB_BITS << 4) - 15 - bits;
 	}
+}
 
-	/* Initialize stream */
-	strm->state = (void *)ctx;
-	strm->total_in = 0;
-	strm->total_out = 0;
+static inline uint32_t lzma_price0(const lzma_enc *e, lzma_prob p) {
+	return e->prob_prices[p >> 4];
+}
 
-	return Z_OK;
+static inline uint32_t lzma_price1(const lzma_enc *e, lzma_prob p) {
+	return e->prob_prices[(p ^ ((1u << LZMA_PROB_BITS) - 1)) >> 4];
 }
 
-/* Compress data using LZMA format */
-int lzmaCompress(z_stream *strm, int flush) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+static inline uint32_t lzma_price(const lzma_enc *e, lzma_prob p, unsigned bit) {
+	return e->prob_prices[(p ^ ((0u - bit) & ((1u << LZMA_PROB_BITS) - 1))) >> 4];
+}
+
+static uint32_t lzma_tree_price(const lzma_enc *e, const lzma_prob *probs, unsigned bits, unsigned sym) {
+	uint32_t price = 0;
+	sym |= 1u << bits;
+	while (sym > 1) {
+		price += lzma_price (e, probs[sym >> 1], sym & 1);
+		sym >>= 1;
+	}
+	return price;
+}
+
+static uint32_t lzma_tree_rev_price(const lzma_enc *e, const lzma_prob *probs, unsigned bits, unsigned sym) {
+	uint32_t price = 0;
+	unsigned m = 1;
+	while (bits--) {
+		unsigned b = sym & 1;
+		sym >>= 1;
+		price += lzma_price (e, probs[m], b);
+		m = (m << 1) | b;
 	}
+	return price;
+}
 
-	lzma_compress_context *ctx = (lzma_compress_context *)strm->state;
+/* Price of the literal at pos in state st */
+static uint32_t lzma_lit_price(lzma_enc *e, size_t pos, unsigned st, uint32_t rep0) {
+	const lzma_prob *probs = lzma_lit_probs (e, pos);
+	unsigned sym = e->buf[pos] | 0x100;
+	uint32_t price = 0;
+	if (st >= LZMA_LIT_STATES) {
+		unsigned match_byte = e->buf[pos - rep0 - 1];
+		unsigned offs = 0x100;
+		do {
+			match_byte <<= 1;
+			price += lzma_price (e, probs[offs + (match_byte & offs) + (sym >> 8)], (sym >> 7) & 1);
+			sym <<= 1;
+			offs &= ~(match_byte ^ sym);
+		} while (sym < 0x10000);
+	} else {
+		do {
+			price += lzma_price (e, probs[sym >> 8], (sym >> 7) & 1);
+			sym <<= 1;
+		} while (sym < 0x10000);
+	}
+	return price;
+}
 
-	/* First call - write LZMA header */
-	if (strm->total_out == 0) {
-		/* We need space for the header */
-		if (strm->avail_out < LZMA_HEADER_SIZE) {
-			return Z_BUF_ERROR;
+static void lzma_len_prices(const lzma_enc *e, const lzma_len_model *lm, uint32_t prices[][LZMA_LEN_SYMBOLS]) {
+	uint32_t a0 = lzma_price0 (e, lm->choice);
+	uint32_t a1 = lzma_price1 (e, lm->choice);
+	uint32_t b0 = a1 + lzma_price0 (e, lm->choice2);
+	uint32_t b1 = a1 + lzma_price1 (e, lm->choice2);
+	for (unsigned i = 0; i < LZMA_LEN_HIGH; i++) {
+		prices[0][LZMA_LEN_LOW + LZMA_LEN_MID + i] = b1 + lzma_tree_price (e, lm->high, 8, i);
+	}
+	for (unsigned ps = 0; ps < (1u << LZMA_ENC_PB); ps++) {
+		for (unsigned i = 0; i < LZMA_LEN_LOW; i++) {
+			prices[ps][i] = a0 + lzma_tree_price (e, lm->low[ps], 3, i);
+			prices[ps][LZMA_LEN_LOW + i] = b0 + lzma_tree_price (e, lm->mid[ps], 3, i);
+		}
+		if (ps) {
+			memcpy (prices[ps] + LZMA_LEN_LOW + LZMA_LEN_MID, prices[0] + LZMA_LEN_LOW + LZMA_LEN_MID, LZMA_LEN_HIGH * sizeof (uint32_t));
 		}
+	}
+}
 
-		/* Will be updated later */
-		memcpy (strm->next_out, ctx->properties, LZMA_PROPS_SIZE);
+static void lzma_dist_prices(lzma_enc *e) {
+	const lzma_model *m = &e->m;
+	for (unsigned ds = 0; ds < LZMA_DIST_STATES; ds++) {
+		for (unsigned slot = 0; slot < LZMA_DIST_SLOTS; slot++) {
+			uint32_t price = lzma_tree_price (e, m->dist_slot[ds], 6, slot);
+			if (slot >= LZMA_DIST_MODEL_END) {
+				price += ((slot >> 1) - 1 - LZMA_ALIGN_BITS) << 4;
+			}
+			e->slot_prices[ds][slot] = price;
+		}
+		for (unsigned i = 0; i < LZMA_DIST_MODEL_START; i++) {
+			e->dist_prices[ds][i] = e->slot_prices[ds][i];
+		}
+	}
+	for (uint32_t i = LZMA_DIST_MODEL_START; i < LZMA_FULL_DISTANCES; i++) {
+		unsigned slot = lzma_dist_slot (i);
+		unsigned nb = (slot >> 1) - 1;
+		uint32_t base = (2 | (slot & 1)) << nb;
+		uint32_t price = lzma_tree_rev_price (e, m->dist_special + base - slot, nb, i - base);
+		for (unsigned ds = 0; ds < LZMA_DIST_STATES; ds++) {
+			e->dist_prices[ds][i] = e->slot_prices[ds][slot] + price;
+		}
+	}
+}
 
-		/* Write uncompressed size as 8-byte LE integer.
-		 * Use the input size we are about to consume (avail_in) as the known size. */
-		uint64_t uncomp = (uint64_t)strm->avail_in;
-		for (int i = 0; i < 8; i++) {
-			strm->next_out[LZMA_PROPS_SIZE + i] = (uint8_t) ((uncomp >> (i * 8)) & 0xFF);
+/* Refresh the cached tables once enough symbols moved the model */
+static void lzma_refresh_prices(lzma_enc *e) {
+	if (e->dist_count >= 128) {
+		lzma_dist_prices (e);
+		e->dist_count = 0;
+	}
+	if (e->align_count >= LZMA_ALIGN_SIZE) {
+		for (unsigned i = 0; i < LZMA_ALIGN_SIZE; i++) {
+			e->align_prices[i] = lzma_tree_rev_price (e, e->m.dist_align, LZMA_ALIGN_BITS, i);
 		}
+		e->align_count = 0;
+	}
+	if (e->len_count >= 64) {
+		lzma_len_prices (e, &e->m.len, e->len_prices);
+		lzma_len_prices (e, &e->m.rep_len, e->rep_len_prices);
+		e->len_count = 0;
+	}
+}
 
-		strm->next_out += LZMA_HEADER_SIZE;
-		strm->avail_out -= LZMA_HEADER_SIZE;
-		strm->total_out += LZMA_HEADER_SIZE;
+static inline uint32_t lzma_match_dist_price(const lzma_enc *e, uint32_t dist, unsigned len) {
+	unsigned ds = lzma_dist_state (len);
+	if (dist < LZMA_FULL_DISTANCES) {
+		return e->dist_prices[ds][dist];
 	}
+	return e->slot_prices[ds][lzma_dist_slot (dist)] + e->align_prices[dist & (LZMA_ALIGN_SIZE - 1)];
+}
+
+static inline uint32_t lzma_short_rep_price(const lzma_enc *e, unsigned st, unsigned ps) {
+	return lzma_price0 (e, e->m.is_rep0[st]) + lzma_price0 (e, e->m.is_rep0_long[st][ps]);
+}
 
-	/* Set last block flag if requested */
-	if (flush == Z_FINISH) {
-		ctx->is_last_block = 1;
+/* Price of picking reps[r] for a long rep, without the length */
+static inline uint32_t lzma_rep_price(const lzma_enc *e, unsigned r, unsigned st, unsigned ps) {
+	const lzma_model *m = &e->m;
+	if (!r) {
+		return lzma_price0 (e, m->is_rep0[st]) + lzma_price1 (e, m->is_rep0_long[st][ps]);
 	}
+	uint32_t price = lzma_price1 (e, m->is_rep0[st]);
+	if (r == 1) {
+		return price + lzma_price0 (e, m->is_rep1[st]);
+	}
+	return price + lzma_price1 (e, m->is_rep1[st]) + lzma_price (e, m->is_rep2[st], r - 2);
+}
+
+/* --- Parsers --- */
 
-	/* Compress data.  Process in chunks so very large inputs don't require
-	 * an oversized temporary buffer. The header (which encodes the full
-	 * uncompressed size) is written above using the initial avail_in value.
-	 */
-	if (strm->avail_in > 0) {
-		size_t remaining = strm->avail_in;
-		/* Debug: print initial sizes when running under TESTING env */
-		(void)0;
-		/* Work on windows of at most ctx->window_size bytes */
-		while (remaining > 0) {
-			size_t input_size = remaining;
-			if (input_size > ctx->window_size) {
-				input_size = ctx->window_size;
+/* Longest match at pos against each repeated distance */
+static unsigned lzma_rep_lens(const lzma_enc *e, size_t pos, const uint32_t *reps, unsigned limit, unsigned *lens) {
+	unsigned best = 0;
+	for (unsigned r = 0; r < LZMA_REPS; r++) {
+		lens[r] = 0;
+		if (reps[r] < pos && limit >= 2) {
+			const uint8_t *cur = e->buf + pos;
+			const uint8_t *pb = cur - reps[r] - 1;
+			if (pb[0] == cur[0] && pb[1] == cur[1]) {
+				lens[r] = 2 + lzma_count (pb + 2, cur + 2, limit - 2);
 			}
+		}
+		if (lens[r] > lens[best]) {
+			best = r;
+		}
+	}
+	return best;
+}
+
+static inline int lzma_change_pair(uint32_t small_dist, uint32_t big_dist) {
+	return (big_dist >> 7) > small_dist;
+}
 
-			/* Estimate minimal required output for this chunk (conservative)
-			 * literals + some overhead. We don't re-add header here because
-			 * it was already written on the first call. */
-			size_t need_out = input_size + 32;
-			if (strm->avail_out < need_out) {
-				return Z_BUF_ERROR;
+/* Greedy parsing with one byte of lookahead, after xz's fast mode */
+static void lzma_parse_fast(lzma_enc *e) {
+	uint32_t *mm = e->matches[0];
+	uint32_t *next = e->matches[1];
+	const uint8_t *buf = e->buf;
+	unsigned count = lzma_mf_find (e, mm);
+	while (e->pos < e->n && !e->oom) {
+		size_t pos = e->pos;
+		size_t avail = e->n - pos;
+		unsigned full = avail < LZMA_MATCH_MAX? (unsigned)avail: LZMA_MATCH_MAX;
+		unsigned rep_lens[LZMA_REPS];
+		unsigned ri = lzma_rep_lens (e, pos, e->reps, full, rep_lens);
+		unsigned rep_len = rep_lens[ri];
+		unsigned len_main = count? mm[2 * count - 2]: 0;
+		uint32_t back_main = count? mm[2 * count - 1]: 0;
+		uint32_t back = LZMA_BACK_LIT;
+		unsigned len = 1;
+		int ahead = 0;
+		unsigned next_count = 0;
+
+		if (rep_len >= e->nice) {
+			back = ri;
+			len = rep_len;
+		} else if (len_main >= e->nice) {
+			back = back_main + LZMA_REPS;
+			len = len_main;
+		} else {
+			/* a slightly shorter match much closer is cheaper */
+			while (count > 1 && len_main == mm[2 * count - 4] + 1 && lzma_change_pair (mm[2 * count - 3], back_main)) {
+				count--;
+				len_main = mm[2 * count - 2];
+				back_main = mm[2 * count - 1];
+			}
+			if (len_main == 2 && back_main >= 0x80) {
+				len_main = 1;
+			}
+			if (rep_len >= 2 && (rep_len + 1 >= len_main || (rep_len + 2 >= len_main && back_main > (1u << 9)) || (rep_len + 3 >= len_main && back_main > (1u << 15)))) {
+				back = ri;
+				len = rep_len;
+			} else if (len_main >= 2 && avail > 2) {
+				/* a better match at the next byte turns this one into a literal */
+				next_count = lzma_mf_find (e, next);
+				ahead = 1;
+				unsigned next_len = next_count? next[2 * next_count - 2]: 0;
+				uint32_t next_dist = next_count? next[2 * next_count - 1]: 0;
+				int lit = next_len >= 2 && ((next_len >= len_main && next_dist < back_main) || (next_len == len_main + 1 && !lzma_change_pair (back_main, next_dist)) || next_len > len_main + 1 || (next_len + 1 >= len_main && len_main >= 3 && lzma_change_pair (next_dist, back_main)));
+				unsigned limit = len_main > 3? len_main - 1: 2;
+				for (unsigned r = 0; r < LZMA_REPS && !lit; r++) {
+					lit = memcmp (buf + pos + 1, buf + pos - e->reps[r], limit) == 0;
+				}
+				if (!lit) {
+					back = back_main + LZMA_REPS;
+					len = len_main;
+				}
 			}
+		}
+		lzma_emit (e, back, len);
+		if (ahead && len == 1) {
+			uint32_t *t = mm;
+			mm = next;
+			next = t;
+			count = next_count;
+		} else {
+			lzma_mf_skip (e, len - 1 - ahead);
+			count = lzma_mf_find (e, mm);
+		}
+	}
+}
+
+/* Price the choices from opt[cur] (state and reps already set) into the
+ * nodes ahead, growing *end as longer choices appear */
+static void lzma_opt_extend(lzma_enc *e, unsigned cur, unsigned *end, const uint32_t *mm, unsigned count, unsigned avail) {
+	lzma_opt *opt = e->opt;
+	size_t pos = e->pos + cur;
+	unsigned st = opt[cur].state;
+	const uint32_t *reps = opt[cur].reps;
+	unsigned ps = (unsigned)pos & LZMA_ENC_POS_MASK;
+	uint32_t cur_price = opt[cur].price;
+
+	uint32_t lit = cur_price + lzma_price0 (e, e->m.is_match[st][ps]) + lzma_lit_price (e, pos, st, reps[0]);
+	if (lit < opt[cur + 1].price) {
+		opt[cur + 1].price = lit;
+		opt[cur + 1].prev = cur;
+		opt[cur + 1].back = LZMA_BACK_LIT;
+	}
+	uint32_t match_price = cur_price + lzma_price1 (e, e->m.is_match[st][ps]);
+	uint32_t rep_match_price = match_price + lzma_price1 (e, e->m.is_rep[st]);
+	if (reps[0] < pos && e->buf[pos] == e->buf[pos - reps[0] - 1]) {
+		uint32_t price = rep_match_price + lzma_short_rep_price (e, st, ps);
+		if (price <= opt[cur + 1].price) {
+			opt[cur + 1].price = price;
+			opt[cur + 1].prev = cur;
+			opt[cur + 1].back = 0;
+		}
+	}
+	if (avail < 2) {
+		return;
+	}
 
-			int compressed_size = simple_lzma_compress (strm->next_in, input_size, ctx->compress_buffer, ctx->compress_buffer_size, ctx->properties);
-			(void)0;
-			if (compressed_size <= 0) {
-				return Z_DATA_ERROR;
+	unsigned rep_lens[LZMA_REPS];
+	lzma_rep_lens (e, pos, reps, avail, rep_lens);
+	unsigned start = 2;
+	for (unsigned r = 0; r < LZMA_REPS; r++) {
+		unsigned len = rep_lens[r];
+		if (len < 2) {
+			continue;
+		}
+		while (*end < cur + len) {
+			opt[++*end].price = LZMA_PRICE_INF;
+		}
+		uint32_t base = rep_match_price + lzma_rep_price (e, r, st, ps);
+		for (unsigned l = len; l >= 2; l--) {
+			uint32_t price = base + e->rep_len_prices[ps][l - LZMA_MATCH_MIN];
+			if (price < opt[cur + l].price) {
+				opt[cur + l].price = price;
+				opt[cur + l].prev = cur;
+				opt[cur + l].back = r;
 			}
+		}
+		if (!r) {
+			/* rep0 is always cheaper than a match of the same length */
+			start = len + 1;
+		}
+	}
 
-			if ((size_t)compressed_size > strm->avail_out) {
-				return Z_BUF_ERROR;
+	if (!count) {
+		return;
+	}
+	unsigned longest = mm[2 * count - 2];
+	if (longest > avail) {
+		longest = avail;
+	}
+	if (longest < start) {
+		return;
+	}
+	while (*end < cur + longest) {
+		opt[++*end].price = LZMA_PRICE_INF;
+	}
+	uint32_t normal = match_price + lzma_price0 (e, e->m.is_rep[st]);
+	unsigned i = 0;
+	for (unsigned l = start; l <= longest; l++) {
+		while (mm[2 * i] < l) {
+			i++;
+		}
+		uint32_t dist = mm[2 * i + 1];
+		uint32_t price = normal + e->len_prices[ps][l - LZMA_MATCH_MIN] + lzma_match_dist_price (e, dist, l);
+		if (price < opt[cur + l].price) {
+			opt[cur + l].price = price;
+			opt[cur + l].prev = cur;
+			opt[cur + l].back = dist + LZMA_REPS;
+		}
+	}
+}
+
+/* State and reps on arrival at opt[cur] */
+static void lzma_opt_state(lzma_opt *opt, unsigned cur) {
+	lzma_opt *o = &opt[cur];
+	const lzma_opt *p = &opt[o->prev];
+	unsigned st = p->state;
+	memcpy (o->reps, p->reps, sizeof (o->reps));
+	if (o->back == LZMA_BACK_LIT) {
+		st = lzma_state_literal (st);
+	} else if (o->back < LZMA_REPS) {
+		if (cur - o->prev == 1) {
+			st = lzma_state_short_rep (st);
+		} else {
+			uint32_t dist = p->reps[o->back];
+			for (unsigned r = o->back; r > 0; r--) {
+				o->reps[r] = o->reps[r - 1];
 			}
+			o->reps[0] = dist;
+			st = lzma_state_rep (st);
+		}
+	} else {
+		memmove (o->reps + 1, o->reps, 3 * sizeof (uint32_t));
+		o->reps[0] = o->back - LZMA_REPS;
+		st = lzma_state_match (st);
+	}
+	o->state = st;
+}
+
+/* One step of price-based parsing: find the cheapest way through the next
+ * stretch of input and encode it. *count holds the matches at e->pos on
+ * entry and at the new e->pos on return. */
+static void lzma_optimum(lzma_enc *e, unsigned *count) {
+	uint32_t *mm = e->matches[0];
+	lzma_opt *opt = e->opt;
+	size_t pos = e->pos;
+	size_t left = e->n - pos;
+	unsigned avail = left < LZMA_MATCH_MAX? (unsigned)left: LZMA_MATCH_MAX;
+	unsigned main_len = *count? mm[2 * *count - 2]: 0;
+	unsigned rep_lens[LZMA_REPS];
+	unsigned ri = lzma_rep_lens (e, pos, e->reps, avail, rep_lens);
 
-			memcpy (strm->next_out, ctx->compress_buffer, compressed_size);
-			strm->next_out += compressed_size;
-			strm->avail_out -= compressed_size;
-			strm->total_out += compressed_size;
+	if (rep_lens[ri] >= e->nice || main_len >= e->nice) {
+		if (rep_lens[ri] >= e->nice) {
+			lzma_emit_rep (e, ri, rep_lens[ri]);
+		} else {
+			lzma_emit_match (e, mm[2 * *count - 1], main_len);
+		}
+		lzma_mf_skip (e, e->pos - pos - 1);
+		*count = lzma_mf_find (e, mm);
+		return;
+	}
 
-			/* Update input pointers/counters */
-			strm->next_in += (uint32_t)input_size;
-			strm->avail_in -= (uint32_t)input_size;
-			strm->total_in += (uint32_t)input_size;
+	opt[0].price = 0;
+	opt[0].state = e->state;
+	memcpy (opt[0].reps, e->reps, sizeof (e->reps));
+	unsigned end = main_len > rep_lens[ri]? main_len: rep_lens[ri];
+	if (end < 1) {
+		end = 1;
+	}
+	for (unsigned l = 1; l <= end; l++) {
+		opt[l].price = LZMA_PRICE_INF;
+	}
+	lzma_opt_extend (e, 0, &end, mm, *count, avail);
 
-			remaining -= input_size;
+	unsigned cur = 1;
+	for (; cur < end; cur++) {
+		*count = lzma_mf_find (e, mm);
+		if (*count && mm[2 * *count - 2] >= e->nice) {
+			break;
+		}
+		left = e->n - pos - cur;
+		avail = left < LZMA_MATCH_MAX? (unsigned)left: LZMA_MATCH_MAX;
+		if (avail > LZMA_OPT_NUM - 1 - cur) {
+			avail = LZMA_OPT_NUM - 1 - cur;
 		}
+		lzma_opt_state (opt, cur);
+		lzma_opt_extend (e, cur, &end, mm, *count, avail);
 	}
+	int have_next = cur < end;
 
-	return (ctx->is_last_block && strm->avail_in == 0)? Z_STREAM_END: Z_OK;
+	/* walk back from the end and encode the path forwards */
+	unsigned n = 0;
+	for (unsigned i = cur; i > 0; i = opt[i].prev) {
+		e->path[n++] = i;
+	}
+	while (n--) {
+		unsigned i = e->path[n];
+		lzma_emit (e, opt[i].back, i - opt[i].prev);
+	}
+	if (!have_next) {
+		*count = lzma_mf_find (e, mm);
+	}
+}
+
+static void lzma_parse_optimal(lzma_enc *e) {
+	unsigned count = lzma_mf_find (e, e->matches[0]);
+	e->len_count = e->dist_count = e->align_count = 1u << 30;
+	while (e->pos < e->n && !e->oom) {
+		lzma_refresh_prices (e);
+		lzma_optimum (e, &count);
+	}
+}
+
+/* Encode src into ctx->out: the 13-byte header, then the range coded
+ * data without an end marker since the size is in the header */
+static int lzma_encode(lzma_compress_context *ctx, const uint8_t *src, size_t n) {
+	if (n > 0x7FFFFFFF) {
+		return Z_MEM_ERROR; /* positions are kept in 32 bits with headroom */
+	}
+	unsigned level = (unsigned)ctx->level;
+	uint32_t dict = (uint32_t)1 << ctx->dict_log;
+	if (n < dict) {
+		uint32_t d = LZMA_DICT_MIN;
+		while (d < n) {
+			d <<= 1;
+		}
+		dict = d;
+	}
+	/* A reused encoder only clears the state up to the scratch tables,
+	 * which are written before they are read */
+	lzma_enc *e = ctx->enc;
+	if (e) {
+		memset (e, 0, offsetof (lzma_enc, matches));
+	} else {
+		e = (lzma_enc *)calloc (1, sizeof (lzma_enc));
+		if (!e) {
+			return Z_MEM_ERROR;
+		}
+		ctx->enc = e;
+	}
+	e->buf = src;
+	e->n = n;
+	e->bt = lzma_levels[level].bt;
+	e->optimal = lzma_levels[level].optimal;
+	e->nice = lzma_levels[level].nice;
+	e->depth = lzma_levels[level].depth;
+	e->cyc_size = (uint32_t)(n < dict? n: dict) + 1;
+	unsigned bits = lzma_highbit (e->cyc_size);
+	e->hash4_bits = bits < 11? 10: bits > 25? 24: bits - 1;
+	size_t hash_n = ((size_t)1 << LZMA_HASH2_BITS) + ((size_t)1 << LZMA_HASH3_BITS) + ((size_t)1 << e->hash4_bits);
+	size_t son_n = (size_t)e->cyc_size * (e->bt? 2: 1);
+	if (hash_n > ctx->hash_alloc) {
+		free (ctx->hash);
+		ctx->hash = (uint32_t *)calloc (hash_n, sizeof (uint32_t));
+		ctx->hash_alloc = ctx->hash? hash_n: 0;
+	} else {
+		memset (ctx->hash, 0, hash_n * sizeof (uint32_t));
+	}
+	if (son_n > ctx->son_alloc) {
+		free (ctx->son);
+		ctx->son = (uint32_t *)malloc (son_n * sizeof (uint32_t));
+		ctx->son_alloc = ctx->son? son_n: 0;
+	}
+	size_t out_cap = n + n / 16 + 64;
+	if (out_cap > ctx->out_cap) {
+		free (ctx->out);
+		ctx->out = (uint8_t *)malloc (out_cap);
+		ctx->out_cap = ctx->out? out_cap: 0;
+	}
+	if (!ctx->hash || !ctx->son || !ctx->out) {
+		return Z_MEM_ERROR;
+	}
+	e->hash = ctx->hash;
+	e->son = ctx->son;
+	e->out = ctx->out;
+	e->out_cap = ctx->out_cap;
+
+	e->out[0] = (LZMA_ENC_PB * 5 + 0) * 9 + LZMA_ENC_LC;
+	for (int i = 0; i < 4; i++) {
+		e->out[1 + i] = (uint8_t)(dict >> (8 * i));
+	}
+	for (int i = 0; i < 8; i++) {
+		e->out[LZMA_PROPS_SIZE + i] = (uint8_t)((uint64_t)n >> (8 * i));
+	}
+	e->out_len = LZMA_HEADER_SIZE;
+	e->range = 0xFFFFFFFF;
+	e->cache_size = 1;
+	lzma_model_init (&e->m, e->lit, LZMA_LIT_SIZE << LZMA_ENC_LC);
+	lzma_prob_prices_init (e->prob_prices);
+
+	if (e->optimal) {
+		lzma_parse_optimal (e);
+	} else {
+		lzma_parse_fast (e);
+	}
+	for (int i = 0; i < 5; i++) {
+		lzma_rc_shift_low (e);
+	}
+
+	/* the range coder may have moved the output while growing it */
+	ctx->out = e->out;
+	ctx->out_cap = e->out_cap;
+	ctx->out_len = e->out_len;
+	return e->oom? Z_MEM_ERROR: Z_OK;
+}
+
+/* --- LZMA API Implementation --- */
+
+/* Initialize a compression stream */
+int lzmaInit(z_stream *strm, int level) {
+	return lzmaCompressInit2 (strm, level, 0, 8, Z_DEFAULT_STRATEGY);
+}
+
+/* Compress data using LZMA format. The whole input is encoded once
+ * Z_FINISH arrives; earlier calls only take input in. */
+int lzmaCompress(z_stream *strm, int flush) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+
+	lzma_compress_context *ctx = (lzma_compress_context *)strm->state;
+	uLong in0 = strm->total_in;
+	uLong out0 = strm->total_out;
+
+	if (!ctx->encoded) {
+		const uint8_t *src = strm->next_in;
+		size_t n = strm->avail_in;
+		if (flush != Z_FINISH || ctx->in_len) {
+			if (ctx->in_len + n > ctx->in_cap) {
+				size_t cap = ctx->in_cap? ctx->in_cap: 65536;
+				while (cap < ctx->in_len + n) {
+					cap *= 2;
+				}
+				uint8_t *nb = (uint8_t *)realloc (ctx->in, cap);
+				if (!nb) {
+					return Z_MEM_ERROR;
+				}
+				ctx->in = nb;
+				ctx->in_cap = cap;
+			}
+			memcpy (ctx->in + ctx->in_len, src, n);
+			ctx->in_len += n;
+			src = ctx->in;
+		}
+		strm->next_in += n;
+		strm->avail_in = 0;
+		strm->total_in += n;
+		if (flush != Z_FINISH) {
+			return strm->total_in != in0? Z_OK: Z_BUF_ERROR;
+		}
+		int ret = lzma_encode (ctx, src, src == ctx->in? ctx->in_len: n);
+		free (ctx->in);
+		ctx->in = NULL;
+		ctx->in_len = ctx->in_cap = 0;
+		if (ret != Z_OK) {
+			return ret;
+		}
+		ctx->encoded = 1;
+	}
+
+	/* Hand out what is left of the encoded stream */
+	size_t n = ctx->out_len - ctx->out_pos;
+	if (n > strm->avail_out) {
+		n = strm->avail_out;
+	}
+	memcpy (strm->next_out, ctx->out + ctx->out_pos, n);
+	ctx->out_pos += n;
+	strm->next_out += n;
+	strm->avail_out -= (uInt)n;
+	strm->total_out += n;
+	if (ctx->out_pos == ctx->out_len) {
+		return Z_STREAM_END;
+	}
+	return strm->total_out != out0? Z_OK: Z_BUF_ERROR;
+}
+
+/* Start a new stream with the same level and dictionary size, keeping
+ * the encoder state and buffers */
+int lzmaReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	lzma_compress_context *ctx = (lzma_compress_context *)strm->state;
+	ctx->in_len = 0;
+	ctx->out_len = 0;
+	ctx->out_pos = 0;
+	ctx->encoded = 0;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
 }
 
 /* End a compression stream */
@@ -311,8 +1226,11 @@ int lzmaEnd(z_stream *strm) {
 	lzma_compress_context *ctx = (lzma_compress_context *)strm->state;
 
 	/* Free allocated buffers */
-	free (ctx->window_buffer);
-	free (ctx->compress_buffer);
+	free (ctx->in);
+	free (ctx->out);
+	free (ctx->hash);
+	free (ctx->son);
+	free (ctx->enc);
 
 	/* Free context */
 	free (ctx);
@@ -323,11 +1241,45 @@ int lzmaEnd(z_stream *strm) {
 
 /* --- zlib compatibility layer --- */
 
+/* windowBits is the log2 of the dictionary size, 0 for the level default */
 int lzmaCompressInit2(z_stream *strm, int level, int windowBits, int memLevel, int strategy) {
-	(void)windowBits; /* Unused */
 	(void)memLevel; /* Unused */
 	(void)strategy; /* Unused */
-	return lzmaInit (strm, level);
+	if (!strm) {
+		return Z_STREAM_ERROR;
+	}
+
+	/* Set default level if needed */
+	if (level == Z_DEFAULT_COMPRESSION) {
+		level = LZMA_DEFAULT_LEVEL;
+	}
+	if (level < 1) {
+		level = 1;
+	} else if (level > 9) {
+		level = 9;
+	}
+	if (windowBits == 0) {
+		windowBits = lzma_levels[level].dict_log;
+	} else if (windowBits < LZMA_DICT_LOG_MIN) {
+		windowBits = LZMA_DICT_LOG_MIN;
+	} else if (windowBits > LZMA_DICT_LOG_MAX) {
+		windowBits = LZMA_DICT_LOG_MAX;
+	}
+
+	/* Allocate compression context */
+	lzma_compress_context *ctx = (lzma_compress_context *)calloc (1, sizeof (lzma_compress_context));
+	if (!ctx) {
+		return Z_MEM_ERROR;
+	}
+	ctx->level = level;
+	ctx->dict_log = (unsigned)windowBits;
+
+	/* Initialize stream */
+	strm->state = (void *)ctx;
+	strm->total_in = 0;
+	strm->total_out = 0;
+
+	return Z_OK;
 }
 
 int lzmaCompressInit2_(z_stream *strm, int level, int windowBits, int memLevel, int strategy, const char *version, int stream_size) {
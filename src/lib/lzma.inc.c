@@ -1,9 +1,13 @@
 /* lzma.inc.c - Minimalistic LZMA implementation compatible with zlib-like API
- * Version: 0.1 (2025-07-27)
+ * Version: 0.2 (2025-07-27)
  *
  * This implementation provides LZMA compression/decompression with zlib-compatible API
  * by including separate encoder and decoder implementations.
  *
+ * Streams use the 13-byte .lzma header: the lc/lp/pb properties byte, the
+ * dictionary size and the uncompressed size, each little endian, followed
+ * by the range coded LZMA1 data.
+ *
  * Usage:
  *   #define OTEZIP_ENABLE_LZMA in one source file before including
  *
@@ -13,8 +17,106 @@
 #ifndef MLZMA_H
 #define MLZMA_H
 
+#include <stdint.h>
+#include <string.h>
+
+/* ------------- Probability model shared by encoder and decoder ------------- */
+
+#define LZMA_PROB_BITS 11
+#define LZMA_PROB_INIT (1 << (LZMA_PROB_BITS - 1))
+#define LZMA_MOVE_BITS 5
+#define LZMA_TOP (1u << 24)
+
+#define LZMA_STATES 12
+#define LZMA_LIT_STATES 7 /* states below this follow a literal */
+#define LZMA_POS_STATES_MAX 16
+#define LZMA_LEN_LOW 8
+#define LZMA_LEN_MID 8
+#define LZMA_LEN_HIGH 256
+#define LZMA_LEN_SYMBOLS (LZMA_LEN_LOW + LZMA_LEN_MID + LZMA_LEN_HIGH)
+#define LZMA_MATCH_MIN 2
+#define LZMA_MATCH_MAX (LZMA_MATCH_MIN + LZMA_LEN_SYMBOLS - 1)
+#define LZMA_DIST_STATES 4
+#define LZMA_DIST_SLOTS 64
+#define LZMA_DIST_MODEL_START 4
+#define LZMA_DIST_MODEL_END 14
+#define LZMA_FULL_DISTANCES 128
+#define LZMA_ALIGN_BITS 4
+#define LZMA_ALIGN_SIZE (1 << LZMA_ALIGN_BITS)
+#define LZMA_LIT_SIZE 0x300
+#define LZMA_DICT_MIN 4096
+
+typedef uint16_t lzma_prob;
+
+typedef struct {
+	lzma_prob choice;
+	lzma_prob choice2;
+	lzma_prob low[LZMA_POS_STATES_MAX][LZMA_LEN_LOW];
+	lzma_prob mid[LZMA_POS_STATES_MAX][LZMA_LEN_MID];
+	lzma_prob high[LZMA_LEN_HIGH];
+} lzma_len_model;
+
+/* Every adaptive probability except the literal coders, whose count
+ * depends on lc + lp */
+typedef struct {
+	lzma_prob is_match[LZMA_STATES][LZMA_POS_STATES_MAX];
+	lzma_prob is_rep[LZMA_STATES];
+	lzma_prob is_rep0[LZMA_STATES];
+	lzma_prob is_rep1[LZMA_STATES];
+	lzma_prob is_rep2[LZMA_STATES];
+	lzma_prob is_rep0_long[LZMA_STATES][LZMA_POS_STATES_MAX];
+	lzma_prob dist_slot[LZMA_DIST_STATES][LZMA_DIST_SLOTS];
+	lzma_prob dist_special[1 + LZMA_FULL_DISTANCES - LZMA_DIST_MODEL_END];
+	lzma_prob dist_align[LZMA_ALIGN_SIZE];
+	lzma_len_model len;
+	lzma_len_model rep_len;
+} lzma_model;
+
+static void lzma_model_init(lzma_model *m, lzma_prob *lit, size_t n_lit) {
+	lzma_prob *p = (lzma_prob *)m;
+	for (size_t i = 0; i < sizeof (*m) / sizeof (lzma_prob); i++) {
+		p[i] = LZMA_PROB_INIT;
+	}
+	for (size_t i = 0; i < n_lit; i++) {
+		lit[i] = LZMA_PROB_INIT;
+	}
+}
+
+static inline unsigned lzma_state_literal(unsigned s) {
+	return s < 4? 0: s < 10? s - 3: s - 6;
+}
+
+static inline unsigned lzma_state_match(unsigned s) {
+	return s < LZMA_LIT_STATES? 7: 10;
+}
+
+static inline unsigned lzma_state_rep(unsigned s) {
+	return s < LZMA_LIT_STATES? 8: 11;
+}
+
+static inline unsigned lzma_state_short_rep(unsigned s) {
+	return s < LZMA_LIT_STATES? 9: 11;
+}
+
+/* Length-to-distance state: lengths 2, 3, 4 and 5+ have their own slots */
+static inline unsigned lzma_dist_state(uint32_t len) {
+	return len < LZMA_DIST_STATES + 1? len - LZMA_MATCH_MIN: LZMA_DIST_STATES - 1;
+}
+
+/* Split the properties byte into lc, lp and pb; -1 if out of range */
+static int lzma_props_decode(uint8_t b, unsigned *lc, unsigned *lp, unsigned *pb) {
+	if (b >= 9 * 5 * 5) {
+		return -1;
+	}
+	*lc = b % 9;
+	b /= 9;
+	*lp = b % 5;
+	*pb = b / 5;
+	return 0;
+}
+
 /* Include encoder and decoder implementations */
 #include "lzma-enc.inc.c"
 #include "lzma-dec.inc.c"
 
-#endif /* MLZMA_H */
\ No newline at end of file
+#endif /* MLZMA_H */
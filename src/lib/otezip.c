@@ -18,6 +18,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <limits.h>
 #include <fcntl.h>
 #include <time.h>
 #include <sys/stat.h>
@@ -70,6 +72,23 @@ static int otezip_mkstemp(const char *prefix) {
 #endif
 
 #include "crc32.inc.c"
+
+#if defined(OTEZIP_ENABLE_THREADS) && !defined(_WIN32) && !defined(_WIN64) && !defined(__wasi__)
+#include <pthread.h>
+#define OTEZIP_HAVE_PTHREAD 1
+#endif
+#if defined(OTEZIP_ENABLE_MMAP) && !defined(_WIN32) && !defined(_WIN64) && !defined(__wasi__)
+#include <sys/mman.h>
+#define OTEZIP_HAVE_MMAP 1
+#endif
+/* in-kernel file to file copies for otezip_fcopy_fd */
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#define OTEZIP_HAVE_SENDFILE 1
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define OTEZIP_HAVE_COPY_FILE_RANGE 1
+#endif
+#endif
 /* Include compression algorithms based on config */
 
 /* Pull in deflate implementation */
@@ -93,6 +112,19 @@ static int otezip_mkstemp(const char *prefix) {
 #define OTEZIP_SIG_LFH 0x04034b50u
 #define OTEZIP_SIG_CDH 0x02014b50u
 #define OTEZIP_SIG_EOCD 0x06054b50u
+#define OTEZIP_SIG_EOCD64 0x06064b50u /* ZIP64 end of central directory */
+#define OTEZIP_SIG_EOCD64_LOC 0x07064b50u /* its locator, right before the EOCD */
+#define OTEZIP_SIG_DD 0x08074b50u /* data descriptor */
+
+/* General purpose flag bit 3: CRC and sizes are in a data descriptor
+ * after the data, zero in the local header */
+#define OTEZIP_FLAG_DD 0x0008u
+
+/* ZIP64 extended information extra field. A 32-bit size or offset of all
+ * ones (16-bit count of all ones) means the real value is in ZIP64 data. */
+#define OTEZIP_EXTRA_ZIP64 0x0001u
+#define OTEZIP_ZIP64_U32 0xffffffffu
+#define OTEZIP_ZIP64_U16 0xffffu
 
 /* Safety limits for parsing ZIP fields to avoid integer overflows and
  * excessive allocations. These limits apply to filename/extra/comment
@@ -102,54 +134,485 @@ static int otezip_mkstemp(const char *prefix) {
 #define OTEZIP_MAX_PAYLOAD (2ULL * 1024ULL * 1024ULL * 1024ULL) /* 2 GiB */
 
 /* Forward declarations of helper functions */
-static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t comp_method, uint32_t comp_size, uint32_t uncomp_size, uint32_t crc32);
-static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t comp_method, uint32_t comp_size, uint32_t uncomp_size, uint32_t crc32, uint32_t local_header_offset, uint16_t file_time, uint16_t file_date, uint32_t external_attr);
-static void otezip_write_end_of_central_directory(FILE *fp, uint32_t num_entries, uint32_t central_dir_size, uint32_t central_dir_offset);
+static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t comp_method, uint64_t comp_size, uint64_t uncomp_size, uint32_t crc32, uint16_t flags);
+static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t comp_method, uint64_t comp_size, uint64_t uncomp_size, uint32_t crc32, uint64_t local_header_offset, uint16_t file_time, uint16_t file_date, uint32_t external_attr, uint16_t flags);
+static void otezip_write_end_of_central_directory(FILE *fp, uint64_t num_entries, uint64_t central_dir_size, uint64_t central_dir_offset);
 static int otezip_finalize_archive(zip_t *za);
 
-/* Helper function to get compression method ID from string name.
- * Returns the OTEZIP_METHOD_* value or -1 if invalid/not supported. */
-int otezip_method_from_string(const char *method_name) {
-	if (!method_name) {
+/* Compression level selected by comp_flags, 1-9 or the codec default */
+static inline int otezip_comp_level(uint32_t comp_flags) {
+	int level = (int)OTEZIP_COMP_LEVEL (comp_flags);
+	return level == 0? Z_DEFAULT_COMPRESSION: level > 9? 9: level;
+}
+
+/* ---------------------------  codec registry  -------------------------- */
+
+/* Built-in codecs run their z_stream backend over whole buffers. The
+ * encoders stop cleanly when dst fills up, so they need no room beyond
+ * src_len: anything longer would be replaced by STORE anyway. */
+
+/* Feed src to run (a *Compress or *Decompress) with Z_FINISH until it
+ * reports the end of the stream, runs out of output or stalls */
+static int otezip_zstream_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_cap) {
+	strm->next_in = src;
+	strm->avail_in = (uInt)src_len;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)dst_cap;
+	int ret;
+	for (;;) {
+		uLong in0 = strm->total_in;
+		uLong out0 = strm->total_out;
+		ret = run (strm, Z_FINISH);
+		if (ret != Z_OK || strm->avail_out == 0 || (strm->total_in == in0 && strm->total_out == out0)) {
+			break;
+		}
+	}
+	return ret;
+}
+
+/* Map the result of an encoder pass to the codec compress() contract */
+static int otezip_zstream_encoded(z_stream *strm, int ret, size_t *dst_len) {
+	if (ret != Z_STREAM_END) {
+		/* ran out of room: the output would not beat STORE */
+		return (ret == Z_OK || ret == Z_BUF_ERROR)? 1: -1;
+	}
+	*dst_len = (size_t)strm->total_out;
+	return 0;
+}
+
+#ifdef OTEZIP_ENABLE_STORE
+static int otezip_store_compress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t *dst_len, uint32_t comp_flags) {
+	(void)ctx;
+	(void)comp_flags;
+	if (src_len > *dst_len) {
+		return 1;
+	}
+	memcpy (dst, src, src_len);
+	*dst_len = src_len;
+	return 0;
+}
+
+static int otezip_store_decompress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len) {
+	(void)ctx;
+	if (src_len != dst_len) {
+		return -1;
+	}
+	memcpy (dst, src, src_len);
+	return 0;
+}
+#endif
+
+/* The z_stream functions of one built-in method; the codec opaque */
+struct otezip_zbackend {
+	int (*enc_init)(z_stream *strm, uint32_t comp_flags);
+	int (*enc_run)(z_stream *strm, int flush);
+	int (*enc_reset)(z_stream *strm);
+	int (*enc_end)(z_stream *strm);
+	int (*dec_init)(z_stream *strm);
+	int (*dec_run)(z_stream *strm, int flush);
+	int (*dec_reset)(z_stream *strm);
+	int (*dec_end)(z_stream *strm);
+	int whole_input; /* the encoder takes an entry in one call, not in chunks */
+};
+
+/* Codec context of the built-in methods. The stream is set up by the
+ * first entry and reset for the ones after it, so tables and buffers
+ * are allocated once per context rather than once per entry. */
+struct otezip_zctx {
+	z_stream strm;
+	const struct otezip_zbackend *be;
+	int encode;
+	int live; /* strm holds a stream from an earlier entry */
+	uint32_t comp_flags; /* what an encoder stream was set up with */
+};
+
+static int otezip_zcodec_init(void *opaque, int encode, void **ctx) {
+	struct otezip_zctx *z = (struct otezip_zctx *)calloc (1, sizeof (struct otezip_zctx));
+	if (!z) {
+		return -1;
+	}
+	z->be = (const struct otezip_zbackend *)opaque;
+	z->encode = encode;
+	*ctx = z;
+	return 0;
+}
+
+static void otezip_zcodec_end(void *ctx) {
+	struct otezip_zctx *z = (struct otezip_zctx *)ctx;
+	if (z->live) {
+		if (z->encode) {
+			z->be->enc_end (&z->strm);
+		} else {
+			z->be->dec_end (&z->strm);
+		}
+	}
+	free (z);
+}
+
+/* Get the stream ready for a new entry: a reset when it is live (and,
+ * for encoders, set up with the same comp_flags), a fresh init otherwise */
+static int otezip_zcodec_start(struct otezip_zctx *z, uint32_t comp_flags) {
+	const struct otezip_zbackend *be = z->be;
+	if (z->live && (!z->encode || z->comp_flags == comp_flags)) {
+		if ((z->encode? be->enc_reset (&z->strm): be->dec_reset (&z->strm)) == Z_OK) {
+			return 0;
+		}
+	}
+	if (z->live) {
+		if (z->encode) {
+			be->enc_end (&z->strm);
+		} else {
+			be->dec_end (&z->strm);
+		}
+		z->live = 0;
+	}
+	memset (&z->strm, 0, sizeof (z->strm));
+	if ((z->encode? be->enc_init (&z->strm, comp_flags): be->dec_init (&z->strm)) != Z_OK) {
+		return -1;
+	}
+	z->live = 1;
+	z->comp_flags = comp_flags;
+	return 0;
+}
+
+static int otezip_zcodec_compress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t *dst_len, uint32_t comp_flags) {
+	struct otezip_zctx *z = (struct otezip_zctx *)ctx;
+	if (!z->encode || otezip_zcodec_start (z, comp_flags) != 0) {
+		return -1;
+	}
+	int ret = otezip_zstream_pass (&z->strm, z->be->enc_run, src, src_len, dst, *dst_len);
+	return otezip_zstream_encoded (&z->strm, ret, dst_len);
+}
+
+static int otezip_zcodec_decompress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len) {
+	struct otezip_zctx *z = (struct otezip_zctx *)ctx;
+	if (z->encode || otezip_zcodec_start (z, 0) != 0) {
+		return -1;
+	}
+	int ret = otezip_zstream_pass (&z->strm, z->be->dec_run, src, src_len, dst, dst_len);
+	return (ret == Z_STREAM_END && z->strm.total_out == dst_len)? 0: -1;
+}
+
+#ifdef OTEZIP_ENABLE_DEFLATE
+/* For ZIP files, we need raw deflate (no zlib header) - use negative windowBits */
+static int otezip_deflate_init(z_stream *strm, uint32_t comp_flags) {
+	return deflateInit2 (strm, otezip_comp_level (comp_flags), Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+}
+
+static int otezip_inflate_init(z_stream *strm) {
+	return inflateInit2 (strm, -MAX_WBITS);
+}
+
+static const struct otezip_zbackend otezip_deflate_backend = {
+	otezip_deflate_init, deflate, deflateReset, deflateEnd,
+	otezip_inflate_init, inflate, inflateReset, inflateEnd,
+	0
+};
+#endif
+
+#ifdef OTEZIP_ENABLE_ZSTD
+static int otezip_zstd_init(z_stream *strm, uint32_t comp_flags) {
+	return zstdInit (strm, otezip_comp_level (comp_flags));
+}
+
+static const struct otezip_zbackend otezip_zstd_backend = {
+	otezip_zstd_init, zstdCompress, zstdReset, zstdEnd,
+	zstdDecompressInit, zstdDecompress, zstdDecompressReset, zstdDecompressEnd,
+	0
+};
+#endif
+
+#ifdef OTEZIP_ENABLE_LZMA
+/* the dictionary size comes from comp_flags or the level */
+static int otezip_lzma_init(z_stream *strm, uint32_t comp_flags) {
+	return lzmaCompressInit2 (strm, otezip_comp_level (comp_flags), (int)OTEZIP_LZMA_DICT_LOG (comp_flags), 8, Z_DEFAULT_STRATEGY);
+}
+
+static const struct otezip_zbackend otezip_lzma_backend = {
+	otezip_lzma_init, lzmaCompress, lzmaReset, lzmaEnd,
+	lzmaDecompressInit, lzmaDecompress, lzmaDecompressReset, lzmaDecompressEnd,
+	0
+};
+#endif
+
+#ifdef OTEZIP_ENABLE_BROTLI
+/* Brotli quality follows the level, 1-9 */
+static int otezip_brotli_init(z_stream *strm, uint32_t comp_flags) {
+	return brotliInit (strm, otezip_comp_level (comp_flags));
+}
+
+static const struct otezip_zbackend otezip_brotli_backend = {
+	otezip_brotli_init, brotliCompress, brotliReset, brotliEnd,
+	brotliDecompressInit, brotliDecompress, brotliDecompressReset, brotliDecompressEnd,
+	0
+};
+#endif
+
+#ifdef OTEZIP_ENABLE_LZFSE
+static int otezip_lzfse_init(z_stream *strm, uint32_t comp_flags) {
+	(void)comp_flags;
+	return lzfseInit (strm, Z_DEFAULT_COMPRESSION);
+}
+
+static const struct otezip_zbackend otezip_lzfse_backend = {
+	otezip_lzfse_init, lzfseCompress, lzfseReset, lzfseEnd,
+	lzfseDecompressInit, lzfseDecompress, lzfseDecompressReset, lzfseDecompressEnd,
+	1
+};
+#endif
+
+/* Table entry of a built-in z_stream method */
+#define OTEZIP_ZCODEC(name, method, backend) \
+	{ name, method, (void *)&backend, otezip_zcodec_init, NULL, otezip_zcodec_compress, otezip_zcodec_decompress, otezip_zcodec_end }
+
+#ifdef OTEZIP_ENABLE_LZ4
+/* radare2's LZ4 writes without a capacity check, so it gets its
+ * historical worst case */
+static size_t otezip_lz4_bound(size_t src_len) {
+	return src_len * 2;
+}
+
+static int otezip_lz4_compress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t *dst_len, uint32_t comp_flags) {
+	(void)ctx;
+	(void)comp_flags;
+	int n = r_lz4_compress (dst, (uint8_t *)src, src_len, 9); /* Use max compression level */
+	if (n <= 0) {
 		return -1;
 	}
+	*dst_len = (size_t)n;
+	return 0;
+}
+
+static int otezip_lz4_decompress(void *ctx, const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len) {
+	(void)ctx;
+	size_t n = 0;
+	uint8_t *buf = r_lz4_decompress ((uint8_t *)src, src_len, &n);
+	int rc = (buf && n == dst_len)? 0: -1;
+	if (rc == 0) {
+		memcpy (dst, buf, n);
+	}
+	free (buf);
+	return rc;
+}
+#endif
 
-	struct method_map {
-		const char *name;
-		int method;
-	};
+/* Room for codecs registered at runtime on top of the built-in ones */
+#define OTEZIP_MAX_CODECS 32
 
-	static const struct method_map methods[] = {
+/* Codecs by method; the first slot with a NULL name ends the table */
+static otezip_codec_t otezip_codecs[OTEZIP_MAX_CODECS] = {
 #ifdef OTEZIP_ENABLE_STORE
-		{ "store", OTEZIP_METHOD_STORE },
+	{ "store", OTEZIP_METHOD_STORE, NULL, NULL, NULL, otezip_store_compress, otezip_store_decompress, NULL },
 #endif
 #ifdef OTEZIP_ENABLE_DEFLATE
-		{ "deflate", OTEZIP_METHOD_DEFLATE },
+	OTEZIP_ZCODEC ("deflate", OTEZIP_METHOD_DEFLATE, otezip_deflate_backend),
 #endif
 #ifdef OTEZIP_ENABLE_ZSTD
-		{ "zstd", OTEZIP_METHOD_ZSTD },
+	OTEZIP_ZCODEC ("zstd", OTEZIP_METHOD_ZSTD, otezip_zstd_backend),
 #endif
 #ifdef OTEZIP_ENABLE_LZMA
-		{ "lzma", OTEZIP_METHOD_LZMA },
+	OTEZIP_ZCODEC ("lzma", OTEZIP_METHOD_LZMA, otezip_lzma_backend),
 #endif
 #ifdef OTEZIP_ENABLE_LZ4
-		{ "lz4", OTEZIP_METHOD_LZ4 },
+	{ "lz4", OTEZIP_METHOD_LZ4, NULL, NULL, otezip_lz4_bound, otezip_lz4_compress, otezip_lz4_decompress, NULL },
 #endif
 #ifdef OTEZIP_ENABLE_BROTLI
-		{ "brotli", OTEZIP_METHOD_BROTLI },
+	OTEZIP_ZCODEC ("brotli", OTEZIP_METHOD_BROTLI, otezip_brotli_backend),
 #endif
 #ifdef OTEZIP_ENABLE_LZFSE
-		{ "lzfse", OTEZIP_METHOD_LZFSE },
+	OTEZIP_ZCODEC ("lzfse", OTEZIP_METHOD_LZFSE, otezip_lzfse_backend),
+#endif
+};
+
+const otezip_codec_t *otezip_get_codec(zip_uint16_t method) {
+	for (size_t i = 0; i < OTEZIP_MAX_CODECS && otezip_codecs[i].name; i++) {
+		if (otezip_codecs[i].method == method) {
+			return &otezip_codecs[i];
+		}
+	}
+	return NULL;
+}
+
+int otezip_register_codec(const otezip_codec_t *codec) {
+	if (!codec || !codec->name || (!codec->compress && !codec->decompress)) {
+		return -1;
+	}
+	size_t i;
+	for (i = 0; i < OTEZIP_MAX_CODECS && otezip_codecs[i].name; i++) {
+		if (otezip_codecs[i].method == codec->method) {
+			break;
+		}
+		if (strcmp (otezip_codecs[i].name, codec->name) == 0) {
+			return -1; /* the name already selects another method */
+		}
+	}
+	if (i == OTEZIP_MAX_CODECS) {
+		return -1;
+	}
+	otezip_codecs[i] = *codec;
+	return 0;
+}
+
+/* Set up codec state for compress or decompress calls */
+static int otezip_codec_init(const otezip_codec_t *codec, int encode, void **ctx) {
+	*ctx = codec->opaque;
+	return codec->init? codec->init (codec->opaque, encode != 0, ctx): 0;
+}
+
+static void otezip_codec_end(const otezip_codec_t *codec, void *ctx) {
+	if (codec->end) {
+		codec->end (ctx);
+	}
+}
+
+/* Contexts of finished entries, parked on their archive for the next
+ * entry with the same codec and direction */
+struct otezip_codec_slot {
+	otezip_codec_t codec; /* the registration the context came from */
+	int encode; /* 0, 1 or OTEZIP_CODEC_TRIAL */
+	void *ctx;
+};
+
+/* An encoder kept apart for the level 1 trials of OTEZIP_METHOD_AUTO, so
+ * the one compressing entries keeps its own level */
+#define OTEZIP_CODEC_TRIAL 2
+
+struct otezip_codec_cache {
+	struct otezip_codec_slot *slots;
+	size_t count;
+	size_t cap;
+};
+
+#ifdef OTEZIP_HAVE_PTHREAD
+/* Guards the context caches: batch workers and parallel readers of one
+ * archive take and return contexts concurrently */
+static pthread_mutex_t otezip_codecs_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* A context from another registration must not reach these functions */
+static int otezip_codec_same(const otezip_codec_t *a, const otezip_codec_t *b) {
+	return a->method == b->method && a->opaque == b->opaque && a->init == b->init && a->compress == b->compress && a->decompress == b->decompress && a->end == b->end;
+}
+
+/* A context for codec: a parked one from za when there is one, else new */
+static int otezip_codec_acquire(zip_t *za, const otezip_codec_t *codec, int encode, void **ctx) {
+	int found = 0;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_codecs_lock);
+#endif
+	struct otezip_codec_cache *c = za->codecs;
+	for (size_t i = c? c->count: 0; i-- > 0;) {
+		struct otezip_codec_slot *s = &c->slots[i];
+		if (s->encode == encode && otezip_codec_same (&s->codec, codec)) {
+			*ctx = s->ctx;
+			*s = c->slots[--c->count];
+			found = 1;
+			break;
+		}
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_codecs_lock);
+#endif
+	return found? 0: otezip_codec_init (codec, encode, ctx);
+}
+
+/* Park ctx on za for the next entry; ended right away if that fails */
+static void otezip_codec_release(zip_t *za, const otezip_codec_t *codec, int encode, void *ctx) {
+	int parked = 0;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_codecs_lock);
+#endif
+	if (!za->codecs) {
+		za->codecs = (struct otezip_codec_cache *)calloc (1, sizeof (struct otezip_codec_cache));
+	}
+	struct otezip_codec_cache *c = za->codecs;
+	if (c && c->count == c->cap) {
+		size_t cap = c->cap? c->cap * 2: 8;
+		struct otezip_codec_slot *slots = (struct otezip_codec_slot *)realloc (c->slots, cap * sizeof (struct otezip_codec_slot));
+		if (slots) {
+			c->slots = slots;
+			c->cap = cap;
+		}
+	}
+	if (c && c->count < c->cap) {
+		struct otezip_codec_slot *s = &c->slots[c->count++];
+		s->codec = *codec;
+		s->encode = encode;
+		s->ctx = ctx;
+		parked = 1;
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_codecs_lock);
 #endif
-		{ NULL, -1 } /* sentinel */
-	};
+	if (!parked) {
+		otezip_codec_end (codec, ctx);
+	}
+}
+
+/* End every parked context; the archive is going away */
+static void otezip_codecs_free(zip_t *za) {
+	struct otezip_codec_cache *c = za->codecs;
+	if (!c) {
+		return;
+	}
+	for (size_t i = 0; i < c->count; i++) {
+		otezip_codec_end (&c->slots[i].codec, c->slots[i].ctx);
+	}
+	free (c->slots);
+	free (c);
+	za->codecs = NULL;
+}
+
+/* Stand-in registrations for the decoder streams of zip_fread: cached
+ * apart from the codecs, whose registrations may be replaced. These are
+ * the decoders that take input and output in pieces of any size in
+ * bounded memory; the Brotli decoder collects the whole stream before
+ * it decodes, and LZFSE needs it in one call, so their entries are
+ * read whole. */
+#define OTEZIP_ZSTREAM(name, method, backend) \
+	{ name, method, (void *)&backend, otezip_zcodec_init, NULL, NULL, NULL, otezip_zcodec_end }
 
-	for (size_t i = 0; methods[i].name != NULL; ++i) {
-		if (strcmp (method_name, methods[i].name) == 0) {
-			return methods[i].method;
+static const otezip_codec_t otezip_stream_codecs[] = {
+#ifdef OTEZIP_ENABLE_DEFLATE
+	OTEZIP_ZSTREAM ("inflate", OTEZIP_METHOD_DEFLATE, otezip_deflate_backend),
+#endif
+#ifdef OTEZIP_ENABLE_ZSTD
+	OTEZIP_ZSTREAM ("unzstd", OTEZIP_METHOD_ZSTD, otezip_zstd_backend),
+#endif
+#ifdef OTEZIP_ENABLE_LZMA
+	OTEZIP_ZSTREAM ("unlzma", OTEZIP_METHOD_LZMA, otezip_lzma_backend),
+#endif
+	{ NULL, 0, NULL, NULL, NULL, NULL, NULL, NULL }
+};
+
+/* The stream registration that decodes method, or NULL to read entries
+ * whole. Deflate always streams; another method only while its built-in
+ * codec is the registered one, so a replacement still sees every entry. */
+static const otezip_codec_t *otezip_stream_codec(uint16_t method) {
+	const otezip_codec_t *codec = otezip_get_codec (method);
+	for (const otezip_codec_t *sc = otezip_stream_codecs; sc->name; sc++) {
+		if (sc->method == method) {
+			int builtin = codec && codec->opaque == sc->opaque && codec->init == sc->init && codec->decompress == otezip_zcodec_decompress && codec->end == sc->end;
+			return (method == OTEZIP_METHOD_DEFLATE || builtin)? sc: NULL;
 		}
 	}
+	return NULL;
+}
 
+/* Helper function to get compression method ID from string name.
+ * Returns the OTEZIP_METHOD_* value or -1 if invalid/not supported. */
+int otezip_method_from_string(const char *method_name) {
+	if (!method_name) {
+		return -1;
+	}
+	if (strcmp (method_name, "auto") == 0) {
+		return OTEZIP_METHOD_AUTO;
+	}
+	for (size_t i = 0; i < OTEZIP_MAX_CODECS && otezip_codecs[i].name; i++) {
+		if (strcmp (method_name, otezip_codecs[i].name) == 0) {
+			return otezip_codecs[i].method;
+		}
+	}
 	return -1;
 }
 
@@ -184,6 +647,13 @@ static void otezip_wr32(uint8_t *p, uint32_t v) {
 	p[2] = (uint8_t) ((v >> 16) & 0xFF);
 	p[3] = (uint8_t) ((v >> 24) & 0xFF);
 }
+static uint64_t otezip_rd64(const uint8_t *p) {
+	return (uint64_t)otezip_rd32 (p) | ((uint64_t)otezip_rd32 (p + 4) << 32);
+}
+static void otezip_wr64(uint8_t *p, uint64_t v) {
+	otezip_wr32 (p, (uint32_t)v);
+	otezip_wr32 (p + 4, (uint32_t) (v >> 32));
+}
 
 /* ----  internal helpers  ---- */
 
@@ -195,1165 +665,3897 @@ static inline int otezip_read_fully(FILE *fp, void *dst, size_t n) {
 	return fread (dst, 1, n, fp) == n? 0: -1;
 }
 
-/* locate EOCD record (last 64KiB + 22 bytes) */
-static long otezip_find_eocd(FILE *fp, uint8_t *eocd_out /*22+*/, size_t *cd_size, uint32_t *cd_ofs, uint16_t *total_entries) {
-	long file_size;
-	if (fseek (fp, 0, SEEK_END) != 0) {
-		return OTEZIP_ERR_READ;
-	}
-	file_size = ftell (fp);
-	if (file_size < 22) {
-		return OTEZIP_ERR_INCONS;
-	}
-	const size_t max_back = 0x10000 + 22; /* spec: comment <= 65535 */
-	/* Ensure both operands of the?: have the same unsigned type to avoid
-	 * signed/unsigned conversions. If file_size is smaller than max_back,
-	 * use file_size cast to size_t, otherwise use max_back. */
-	size_t search_len = (file_size < (long)max_back)? (size_t)file_size: max_back;
-
-	if (fseek (fp, file_size - (long)search_len, SEEK_SET) != 0) {
-		return OTEZIP_ERR_READ;
-	}
-	uint8_t buf[65558];
-	if (otezip_read_fully (fp, buf, search_len) != 0) {
-		return OTEZIP_ERR_READ;
+/* 64-bit stream positions: long is 32 bits on Windows */
+static int otezip_seek(FILE *fp, uint64_t ofs) {
+	if (ofs > (uint64_t)INT64_MAX) {
+		return -1;
 	}
-	size_t i;
-	for (i = search_len - 22; i != (size_t)-1; --i) {
-		if (otezip_rd32 (buf + i) == OTEZIP_SIG_EOCD) {
-			/* Basic EOCD present; extract fields but validate them before
-			 * returning to avoid trusting potentially corrupted archives. */
-			memcpy (eocd_out, buf + i, 22);
-			uint16_t comment_len = otezip_rd16 (buf + i + 20);
-			uint16_t entries = otezip_rd16 (buf + i + 10);
-			uint32_t cd_size_tmp = otezip_rd32 (buf + i + 12);
-			uint32_t cd_ofs_tmp = otezip_rd32 (buf + i + 16);
-			(void)comment_len;
-
-			/* Ensure central directory lies within the file. Use 64-bit
-			 * arithmetic to avoid overflow when adding offsets. */
-			uint64_t cd_end = (uint64_t)cd_ofs_tmp + (uint64_t)cd_size_tmp;
-			if (cd_ofs_tmp > (uint32_t)file_size || cd_end > (uint64_t)file_size) {
-				/* Central directory claims to be outside the file -> malformed */
-				continue;
-			}
-
-			/* Validate that the central directory starts with a valid CDH signature.
-			 * This handles files with embedded EOCD signatures in compressed data. */
-			if (entries > 0 && cd_size_tmp >= 4) {
-				long saved_pos = ftell (fp);
-				if (saved_pos < 0) {
-					continue;
-				}
-				if (fseek (fp, (long)cd_ofs_tmp, SEEK_SET) != 0) {
-					continue;
-				}
-				uint8_t cd_sig[4];
-				if (otezip_read_fully (fp, cd_sig, 4) != 0) {
-					(void)fseek (fp, saved_pos, SEEK_SET);
-					continue;
-				}
-				(void)fseek (fp, saved_pos, SEEK_SET);
-				if (otezip_rd32 (cd_sig) != OTEZIP_SIG_CDH) {
-					/* CD doesn't start with valid header - try next EOCD candidate */
-					continue;
-				}
-			}
+#if defined(_WIN32) || defined(_WIN64)
+	return _fseeki64 (fp, (__int64)ofs, SEEK_SET) == 0? 0: -1;
+#else
+	return fseeko (fp, (off_t)ofs, SEEK_SET) == 0? 0: -1;
+#endif
+}
 
-			/* Everything looked sane; commit results */
-			*total_entries = entries;
-			*cd_size = cd_size_tmp;
-			*cd_ofs = cd_ofs_tmp;
-			return (long) (file_size - search_len + i);
-		}
-	}
-	/* not found */
-	return OTEZIP_ERR_INCONS;
+static int64_t otezip_tell(FILE *fp) {
+#if defined(_WIN32) || defined(_WIN64)
+	return (int64_t)_ftelli64 (fp);
+#else
+	return (int64_t)ftello (fp);
+#endif
 }
 
-/* parse central directory into array of otezip_entry */
-static int otezip_load_central(zip_t *za) {
-	uint8_t eocd[22];
-	size_t cd_size;
-	uint32_t cd_ofs;
-	uint16_t n_entries;
-	long eocd_pos;
+/* ----  in-memory archives (otezip_open_memory)  ---- */
+
+/* za->fp of a memory archive is a stdio stream whose callbacks work on
+ * a buffer, so the library reads and writes it like any archive file;
+ * only the paths that go through the descriptor check za->mem. */
+#if defined(__GLIBC__) || (defined(__linux__) && !defined(__ANDROID__))
+#define OTEZIP_HAVE_FOPENCOOKIE 1
+#define OTEZIP_HAVE_MEMFILE 1
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__) || defined(__ANDROID__)
+#define OTEZIP_HAVE_FUNOPEN 1
+#define OTEZIP_HAVE_MEMFILE 1
+#endif
 
-	eocd_pos = otezip_find_eocd (za->fp, eocd, &cd_size, &cd_ofs, &n_entries);
-	if (eocd_pos < 0) {
-		/* Return the specific error code from find_eocd */
-		return (int)eocd_pos;
+struct otezip_mem {
+	uint8_t *data;
+	size_t len; /* bytes of archive in data */
+	size_t cap; /* bytes allocated, 0 while data is the caller's */
+	size_t pos; /* stream position, may lie past len */
+	int failed; /* a write did not fit */
+	zip_source_t *src; /* zip_open_from_source: freed with the archive */
+	void **out; /* otezip_close_memory: where the buffer goes */
+	zip_uint64_t *out_len;
+};
+
+/* Make room for n bytes, keeping what is there */
+static int otezip_mem_reserve(struct otezip_mem *m, size_t n) {
+	if (n <= m->cap) {
+		return 0;
 	}
-
-	/* Validate central directory against actual file size to avoid
-	 * out-of-bounds reads or huge allocations. */
-	if (fseek (za->fp, 0, SEEK_END) != 0) {
-		return OTEZIP_ERR_READ;
+	if (m->cap == 0 && m->data) {
+		return -1; /* read in place */
 	}
-	long file_size_long = ftell (za->fp);
-	if (file_size_long < 0) {
-		return OTEZIP_ERR_READ;
+	size_t cap = m->cap? m->cap: 4096;
+	while (cap < n) {
+		cap = cap > SIZE_MAX / 2? n: cap * 2;
 	}
-	uint64_t file_size = (uint64_t)file_size_long;
-	if ((uint64_t)cd_ofs + (uint64_t)cd_size > file_size) {
-		return OTEZIP_ERR_INCONS;
+	uint8_t *p = (uint8_t *)realloc (m->data, cap);
+	if (!p) {
+		return -1;
 	}
+	m->data = p;
+	m->cap = cap;
+	return 0;
+}
 
-	/* A valid empty ZIP may contain only an EOCD record with an empty
-	 * central directory. Accept that case without trying to read or parse
-	 * any central directory entries. */
-	if (n_entries == 0) {
-		if (cd_size != 0) {
-			return OTEZIP_ERR_INCONS;
-		}
-		za->entries = NULL;
-		za->n_entries = 0;
-		return 0;
+#ifdef OTEZIP_HAVE_MEMFILE
+static size_t otezip_mem_read(struct otezip_mem *m, void *dst, size_t n) {
+	size_t left = m->pos < m->len? m->len - m->pos: 0;
+	if (n > left) {
+		n = left;
 	}
+	if (n > 0) {
+		memcpy (dst, m->data + m->pos, n);
+		m->pos += n;
+	}
+	return n;
+}
 
-	/* read entire central directory */
-	if (fseek (za->fp, cd_ofs, SEEK_SET) != 0) {
-		return OTEZIP_ERR_READ;
+/* Writes past the end fill the gap with zeros, as files do */
+static size_t otezip_mem_write(struct otezip_mem *m, const void *src, size_t n) {
+	if (n == 0) {
+		return 0;
 	}
-	/* Validate central directory size isn't unreasonably large */
-	if (cd_size > OTEZIP_MAX_PAYLOAD) {
-		return OTEZIP_ERR_INCONS;
+	if (n > SIZE_MAX - m->pos || otezip_mem_reserve (m, m->pos + n) != 0) {
+		m->failed = 1;
+		return 0;
 	}
-	uint8_t *cd_buf = (uint8_t *)malloc (cd_size);
-	if (!cd_buf) {
-		return OTEZIP_ERR_READ;
+	if (m->pos > m->len) {
+		memset (m->data + m->len, 0, m->pos - m->len);
 	}
-	if (otezip_read_fully (za->fp, cd_buf, cd_size) != 0) {
-		free (cd_buf);
-		return OTEZIP_ERR_READ;
+	memcpy (m->data + m->pos, src, n);
+	m->pos += n;
+	if (m->pos > m->len) {
+		m->len = m->pos;
 	}
+	return n;
+}
 
-	/* Validate number of entries is reasonable (max ~1.4M entries fits in cd_size) */
-	if ((size_t)n_entries * 46 > cd_size) {
-		free (cd_buf);
-		return OTEZIP_ERR_INCONS;
+static int otezip_mem_seek(struct otezip_mem *m, int64_t *ofs, int whence) {
+	int64_t base;
+	switch (whence) {
+	case SEEK_SET:
+		base = 0;
+		break;
+	case SEEK_CUR:
+		base = (int64_t)m->pos;
+		break;
+	case SEEK_END:
+		base = (int64_t)m->len;
+		break;
+	default:
+		return -1;
 	}
-
-	za->entries = (struct otezip_entry *)calloc (n_entries, sizeof (struct otezip_entry));
-	za->n_entries = n_entries;
-
-	if (!za->entries) {
-		free (cd_buf);
-		return OTEZIP_ERR_READ;
+	if (*ofs < -base || (*ofs > 0 && *ofs > INT64_MAX - base)) {
+		return -1;
 	}
-
-	size_t off = 0;
-	uint16_t i;
-	for (i = 0; i < n_entries; i++) {
-		/* Ensure we have at least the fixed-size central header available */
-		if (off + 46 > cd_size || otezip_rd32 (cd_buf + off) != OTEZIP_SIG_CDH) {
-			free (cd_buf);
-			return OTEZIP_ERR_INCONS; /* malformed */
-		}
-		const uint8_t *h = cd_buf + off;
-
-		/* Data descriptors (general purpose bit 3): when set, the local
-		 * file header has CRC/sizes zeroed and actual values follow the
-		 * compressed data. However, the central directory always stores
-		 * the correct values, so we can safely use those. No need to reject. */
-
-		uint16_t filename_len = otezip_rd16 (h + 28);
-		uint16_t extra_len = otezip_rd16 (h + 30);
-		uint16_t comment_len = otezip_rd16 (h + 32);
-		size_t entry_size = 46 + (size_t)filename_len + (size_t)extra_len + (size_t)comment_len;
-
-		if (entry_size > cd_size - off) {
-			free (cd_buf);
-			return OTEZIP_ERR_INCONS;
-		}
-
-		struct otezip_entry *e = &za->entries[i];
-		e->method = otezip_rd16 (h + 10);
-		e->file_time = otezip_rd16 (h + 12);
-		e->file_date = otezip_rd16 (h + 14);
-		e->crc32 = otezip_rd32 (h + 16);
-		e->comp_size = otezip_rd32 (h + 20);
-		e->uncomp_size = otezip_rd32 (h + 24);
-		e->local_hdr_ofs = otezip_rd32 (h + 42);
-		e->external_attr = otezip_rd32 (h + 38);
-
-		if ((uint64_t)e->comp_size > OTEZIP_MAX_PAYLOAD || (uint64_t)e->uncomp_size > OTEZIP_MAX_PAYLOAD) {
-			free (cd_buf);
-			return OTEZIP_ERR_INCONS;
-		}
-
-		e->name = (char *)malloc (filename_len + 1u);
-		if (!e->name) {
-			free (cd_buf);
-			return OTEZIP_ERR_READ;
-		}
-		memcpy (e->name, h + 46, filename_len);
-		e->name[filename_len] = '\0';
-		off += entry_size;
+	int64_t pos = base + *ofs;
+	if ((uint64_t)pos > (uint64_t)SIZE_MAX) {
+		return -1;
 	}
-	free (cd_buf);
+	m->pos = (size_t)pos;
+	*ofs = pos;
 	return 0;
 }
 
-/* load entire (uncompressed) file into memory and hand ownership to caller */
-static int otezip_extract_entry(zip_t *za, struct otezip_entry *e, uint8_t **out_buf, uint32_t *out_sz) {
-	/* move to local header */
-	/* Validate local header offset against file size to avoid seeking
-	 * outside the file. Use 64-bit math for safety. */
-	if (fseek (za->fp, 0, SEEK_END) != 0) {
-		return -1;
-	}
-	long file_sz_l = ftell (za->fp);
-	if (file_sz_l < 0) {
-		return -1;
-	}
-	uint64_t file_sz = (uint64_t)file_sz_l;
-	if ((uint64_t)e->local_hdr_ofs > file_sz) {
-		return -1;
-	}
-	if (fseek (za->fp, (long)e->local_hdr_ofs, SEEK_SET) != 0) {
-		return -1;
-	}
-	uint8_t lfh[30];
-	if (otezip_read_fully (za->fp, lfh, 30) != 0) {
-		return -1;
-	}
-	if (otezip_rd32 (lfh) != OTEZIP_SIG_LFH) {
+#ifdef OTEZIP_HAVE_FOPENCOOKIE
+#ifdef __GLIBC__
+typedef off64_t otezip_cookie_off;
+#else
+typedef off_t otezip_cookie_off;
+#endif
+static ssize_t otezip_mem_cookie_read(void *cookie, char *buf, size_t n) {
+	return (ssize_t)otezip_mem_read ((struct otezip_mem *)cookie, buf, n);
+}
+static ssize_t otezip_mem_cookie_write(void *cookie, const char *buf, size_t n) {
+	return (ssize_t)otezip_mem_write ((struct otezip_mem *)cookie, buf, n);
+}
+static int otezip_mem_cookie_seek(void *cookie, otezip_cookie_off *ofs, int whence) {
+	int64_t o = (int64_t)*ofs;
+	if (otezip_mem_seek ((struct otezip_mem *)cookie, &o, whence) != 0) {
 		return -1;
 	}
+	*ofs = (otezip_cookie_off)o;
+	return 0;
+}
+#else
+static int otezip_mem_cookie_read(void *cookie, char *buf, int n) {
+	return (int)otezip_mem_read ((struct otezip_mem *)cookie, buf, n > 0? (size_t)n: 0);
+}
+static int otezip_mem_cookie_write(void *cookie, const char *buf, int n) {
+	size_t done = otezip_mem_write ((struct otezip_mem *)cookie, buf, n > 0? (size_t)n: 0);
+	return done > 0? (int)done: -1;
+}
+static fpos_t otezip_mem_cookie_seek(void *cookie, fpos_t ofs, int whence) {
+	int64_t o = (int64_t)ofs;
+	return otezip_mem_seek ((struct otezip_mem *)cookie, &o, whence) == 0? (fpos_t)o: -1;
+}
+#endif
 
-	/* Data descriptors (bit 3): when set, the local file header stores
-	 * CRC/sizes as 0 and actual values appear after compressed data.
-	 * We rely on the central directory values (stored in entry e) which
-	 * are always correct, so we can safely proceed. */
-	uint16_t fn_len = otezip_rd16 (lfh + 26);
-	uint16_t extra_len = otezip_rd16 (lfh + 28);
+/* The buffer outlives the stream: otezip_mem_free releases it */
+static int otezip_mem_cookie_close(void *cookie) {
+	(void)cookie;
+	return 0;
+}
 
-	/* Filename/extra lengths are 16-bit per spec. Further bounds checks
-	 * are performed for file offsets and allocations below. */
+static FILE *otezip_mem_fopen(struct otezip_mem *m, int writable) {
+#ifdef OTEZIP_HAVE_FOPENCOOKIE
+	cookie_io_functions_t io = { otezip_mem_cookie_read, otezip_mem_cookie_write, otezip_mem_cookie_seek, otezip_mem_cookie_close };
+	return fopencookie (m, writable? "r+b": "rb", io);
+#else
+	return funopen (m, otezip_mem_cookie_read, writable? otezip_mem_cookie_write: NULL, otezip_mem_cookie_seek, otezip_mem_cookie_close);
+#endif
+}
+#endif
 
-	/* Ensure the compressed data lies within the file bounds. Calculate
-	 * offset to compressed data = local_hdr_ofs + 30 + fn_len + extra_len. */
-	uint64_t data_ofs = (uint64_t)e->local_hdr_ofs + 30ULL + (uint64_t)fn_len + (uint64_t)extra_len;
-	if (data_ofs > file_sz) {
-		return -1;
+/* Release the buffer of a memory archive once its stream is closed,
+ * or hand it to otezip_close_memory */
+static void otezip_mem_free(zip_t *za) {
+	struct otezip_mem *m = za->mem;
+	if (!m) {
+		return;
 	}
-	if ((uint64_t)e->comp_size > OTEZIP_MAX_PAYLOAD || (uint64_t)e->uncomp_size > OTEZIP_MAX_PAYLOAD) {
-		return -1;
+	uint8_t *own = m->cap? m->data: NULL;
+	if (m->out && !m->failed) {
+		uint8_t *p = own? own: (uint8_t *)malloc (m->len? m->len: 1);
+		if (p && !own && m->len) {
+			memcpy (p, m->data, m->len);
+		}
+		if (p) {
+			*m->out = p;
+			*m->out_len = m->len;
+			own = NULL;
+		}
 	}
-	if (data_ofs + (uint64_t)e->comp_size > file_sz) {
+	free (own);
+	zip_source_free (m->src);
+	free (m);
+	za->mem = NULL;
+}
+
+/* Size of the file behind fp, pending writes included */
+static int otezip_fp_size(FILE *fp, uint64_t *size) {
+	struct stat st;
+	if (fflush (fp) != 0 || fstat (fileno (fp), &st) != 0 || st.st_size < 0) {
 		return -1;
 	}
+	*size = (uint64_t)st.st_size;
+	return 0;
+}
 
-	/* Protect against zipbombs: require that expected uncompressed size from
-	 * the central directory is within a reasonable bound relative to the
-	 * compressed size. If the entry claims a huge expansion, fail unless the
-	 * global `otezip_ignore_zipbomb` flag is set by the caller (CLI override).
-	 * We compute allowed = comp_size * ratio + slack and compare against the
-	 * declared uncompressed size. Use 64-bit math to avoid overflow. */
-	if (!otezip_ignore_zipbomb && e->comp_size > 0) {
-		uint64_t allowed = (uint64_t)e->comp_size * otezip_max_expansion_ratio;
-		allowed += otezip_max_expansion_slack;
-		if ((uint64_t)e->uncomp_size > allowed) {
-			/* suspiciously large uncompressed size */
-			fprintf (stderr, "mzip: entry '%s' claims huge uncompressed size (%u), rejecting to avoid zipbomb\n", e->name? e->name: "<unknown>", e->uncomp_size);
+/* otezip_fp_size of the archive stream of za */
+static int otezip_za_size(zip_t *za, uint64_t *size) {
+	if (za->mem) {
+		if (fflush (za->fp) != 0) {
 			return -1;
 		}
+		*size = za->mem->len;
+		return 0;
 	}
+	return otezip_fp_size (za->fp, size);
+}
 
-	/* seek to compressed data (we were at local header +30 already) */
-	if (fseek (za->fp, (long)data_ofs, SEEK_SET) != 0) {
-		return -1;
-	}
-
-	/* read compressed data */
-	uint8_t *cbuf = (uint8_t *)calloc (e->comp_size ? e->comp_size : 1, 1);
-	if (!cbuf) {
-		return -1;
-	}
-	if (e->comp_size && otezip_read_fully (za->fp, cbuf, e->comp_size) != 0) {
-		free (cbuf);
+/* Cut the archive of za at ofs and continue writing there, dropping
+ * e.g. a partly written entry */
+static int otezip_truncate(zip_t *za, uint64_t ofs) {
+	FILE *fp = za->fp;
+	if (fflush (fp) != 0 || otezip_seek (fp, ofs) != 0) {
 		return -1;
 	}
-
-	uint8_t *ubuf;
-#ifdef OTEZIP_ENABLE_STORE
-	if (e->method == OTEZIP_METHOD_STORE) {
-		if (e->comp_size != e->uncomp_size) {
-			free (cbuf);
-			return -1;
+	if (za->mem) {
+		struct otezip_mem *m = za->mem;
+		if (ofs > m->len) {
+			if (otezip_mem_reserve (m, (size_t)ofs) != 0) {
+				return -1;
+			}
+			memset (m->data + m->len, 0, (size_t)ofs - m->len);
 		}
-		ubuf = cbuf;
+		m->len = (size_t)ofs;
+		return 0;
 	}
+#if defined(_WIN32) || defined(_WIN64)
+	return _chsize_s (_fileno (fp), (__int64)ofs) == 0? 0: -1;
+#else
+	return ftruncate (fileno (fp), (off_t)ofs) == 0? 0: -1;
 #endif
-#ifdef OTEZIP_ENABLE_DEFLATE
-	else if (e->method == OTEZIP_METHOD_DEFLATE) { /* deflate */
+}
 
-		/* Allocate output buffer */
-		ubuf = (uint8_t *)malloc (e->uncomp_size);
-		if (!ubuf) {
-			free (cbuf);
-			return -1;
-		}
+/* ----  counters and entry events (otezip_set_stats)  ---- */
 
-		/* Initialize buffer to zeros */
-		memset (ubuf, 0, e->uncomp_size);
+#ifdef OTEZIP_HAVE_PTHREAD
+/* Workers of one batch and concurrent readers add to the same counters */
+static pthread_mutex_t otezip_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
-		/* Setup decompression */
-		z_stream strm = { 0 };
-		strm.next_in = cbuf;
-		strm.avail_in = e->comp_size;
-		strm.next_out = ubuf;
-		strm.avail_out = e->uncomp_size;
+/* Work on za is only timed when someone looks at the result */
+static inline int otezip_observed(const zip_t *za) {
+	return za->stats || za->hook;
+}
 
-		/* Try raw deflate first (standard for ZIP files) */
-		int ret = inflateInit2 (&strm, -MAX_WBITS);
-		if (ret != Z_OK) {
-			/* Fall back to direct copy */
-			memcpy (ubuf, cbuf, e->uncomp_size < e->comp_size? e->uncomp_size: e->comp_size);
-			*out_buf = ubuf;
-			*out_sz = e->uncomp_size;
-			free (cbuf);
-			return 0;
-		}
+static uint64_t otezip_now_ns(void) {
+#if defined(_WIN32) || defined(_WIN64)
+	struct timespec ts;
+	timespec_get (&ts, TIME_UTC);
+#else
+	struct timespec ts;
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+#endif
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
 
-		/* Attempt decompression */
-		ret = inflate (&strm, Z_FINISH);
-		inflateEnd (&strm);
+/* Start and end of a timed span; 0 when za is not observed */
+static inline uint64_t otezip_clock(const zip_t *za) {
+	return otezip_observed (za)? otezip_now_ns (): 0;
+}
 
-		/* If decompression failed */
-		if (ret != Z_STREAM_END) {
-			free (ubuf);
-			free (cbuf);
-			return -1;
-		}
+static inline uint64_t otezip_since(const zip_t *za, uint64_t t0) {
+	return otezip_observed (za)? otezip_now_ns () - t0: 0;
+}
 
-		free (cbuf);
-	}
+static void otezip_stats_enter(void) {
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_stats_lock);
 #endif
-#ifdef OTEZIP_ENABLE_ZSTD
-	else if (e->method == OTEZIP_METHOD_ZSTD) { /* zstd */
-		ubuf = (uint8_t *)malloc (e->uncomp_size);
-		if (!ubuf) {
-			free (cbuf);
-			return -1;
-		}
-		memset (ubuf, 0, e->uncomp_size); /* Initialize output buffer */
-		z_stream strm = { 0 };
-		strm.next_in = cbuf;
-		strm.avail_in = e->comp_size;
-		strm.next_out = ubuf;
-		strm.avail_out = e->uncomp_size;
+}
 
-		if (zstdDecompressInit (&strm) != Z_OK) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		int zret = zstdDecompress (&strm, Z_FINISH);
-		zstdDecompressEnd (&strm);
-		if (zret != Z_STREAM_END || strm.total_out != e->uncomp_size) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		free (cbuf);
-	}
+static void otezip_stats_leave(void) {
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_stats_lock);
 #endif
-#ifdef OTEZIP_ENABLE_LZFSE
-	else if (e->method == OTEZIP_METHOD_LZFSE) { /* lzfse */
-		ubuf = (uint8_t *)malloc (e->uncomp_size);
-		if (!ubuf) {
-			free (cbuf);
-			return -1;
-		}
-		memset (ubuf, 0, e->uncomp_size); /* Initialize output buffer */
-		z_stream strm = { 0 };
-		strm.next_in = cbuf;
-		strm.avail_in = e->comp_size;
-		strm.next_out = ubuf;
-		strm.avail_out = e->uncomp_size;
+}
 
-		if (lzfseDecompressInit (&strm) != Z_OK) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		int zret = lzfseDecompress (&strm, Z_FINISH);
-		lzfseDecompressEnd (&strm);
-		if (zret != Z_STREAM_END || strm.total_out != e->uncomp_size) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		free (cbuf);
+/* One read (write != 0: write) of bytes on the archive */
+static void otezip_count_io(zip_t *za, int write, uint64_t bytes, uint64_t ns) {
+	otezip_stats_t *st = za->stats;
+	if (!st) {
+		return;
 	}
-#endif
-#ifdef OTEZIP_ENABLE_LZ4
-	else if (e->method == OTEZIP_METHOD_LZ4) { /* lz4 - using radare2's implementation */
-		size_t output_size = 0;
-		ubuf = r_lz4_decompress (cbuf, e->comp_size, &output_size);
-		if (!ubuf || output_size != e->uncomp_size) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		free (cbuf);
+	otezip_stats_enter ();
+	if (write) {
+		st->writes++;
+		st->bytes_written += bytes;
+	} else {
+		st->reads++;
+		st->bytes_read += bytes;
 	}
-#endif
-#ifdef OTEZIP_ENABLE_LZMA
-	else if (e->method == OTEZIP_METHOD_LZMA) { /* lzma */
-		ubuf = (uint8_t *)malloc (e->uncomp_size);
-		if (!ubuf) {
-			free (cbuf);
-			return -1;
-		}
-		memset (ubuf, 0, e->uncomp_size); /* Initialize output buffer */
-		z_stream strm = { 0 };
-		strm.next_in = cbuf;
-		strm.avail_in = e->comp_size;
-		strm.next_out = ubuf;
-		strm.avail_out = e->uncomp_size;
+	st->io_ns += ns;
+	otezip_stats_leave ();
+}
 
-		if (lzmaDecompressInit (&strm) != Z_OK) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		int zret = lzmaDecompress (&strm, Z_FINISH);
-		lzmaDecompressEnd (&strm);
-		if (zret != Z_STREAM_END || strm.total_out != e->uncomp_size) {
-			free (cbuf);
-			free (ubuf);
-			return -1;
-		}
-		free (cbuf);
+static void otezip_count_seek(zip_t *za) {
+	if (za->stats) {
+		otezip_stats_enter ();
+		za->stats->seeks++;
+		otezip_stats_leave ();
 	}
-#endif
-#ifdef OTEZIP_ENABLE_BROTLI
-	else if (e->method == OTEZIP_METHOD_BROTLI) { /* brotli */
-		ubuf = (uint8_t *)malloc (e->uncomp_size);
-		if (!ubuf) {
-			free (cbuf);
-			return -1;
+}
+
+static void otezip_count_allocs(zip_t *za, unsigned n) {
+	if (za->stats) {
+		otezip_stats_enter ();
+		za->stats->allocs += n;
+		otezip_stats_leave ();
+	}
+}
+
+/* One entry through the codec of method; encode != 0 for compression */
+static void otezip_count_codec(zip_t *za, uint16_t method, int encode, uint64_t in, uint64_t out, uint64_t ns) {
+	otezip_stats_t *st = za->stats;
+	if (!st) {
+		return;
+	}
+	otezip_stats_enter ();
+	otezip_method_stats_t *m = NULL;
+	for (size_t i = 0; i < st->n_methods && !m; i++) {
+		if (st->methods[i].method == method) {
+			m = &st->methods[i];
 		}
-		memset (ubuf, 0, e->uncomp_size); /* Initialize output buffer */
-		z_stream strm = { 0 };
-		strm.next_in = cbuf;
-		strm.avail_in = e->comp_size;
-		strm.next_out = ubuf;
-		strm.avail_out = e->uncomp_size;
+	}
+	if (!m && st->n_methods < OTEZIP_STATS_METHODS) {
+		m = &st->methods[st->n_methods++];
+		m->method = method;
+	}
+	if (m && encode) {
+		m->compress_entries++;
+		m->compress_in += in;
+		m->compress_out += out;
+		m->compress_ns += ns;
+	} else if (m) {
+		m->decompress_entries++;
+		m->decompress_in += in;
+		m->decompress_out += out;
+		m->decompress_ns += ns;
+	}
+	otezip_stats_leave ();
+}
 
-		if (brotliDecompressInit (&strm) != Z_OK) {
-			free (cbuf);
-			free (ubuf);
+/* otezip_crc32, timed and counted for za */
+static uint32_t otezip_crc32_za(zip_t *za, uint32_t crc, const uint8_t *p, size_t n) {
+	if (!za->stats) {
+		return otezip_crc32 (crc, p, n);
+	}
+	uint64_t t0 = otezip_now_ns ();
+	crc = otezip_crc32 (crc, p, n);
+	uint64_t ns = otezip_now_ns () - t0;
+	otezip_stats_enter ();
+	za->stats->crc_bytes += n;
+	za->stats->crc_ns += ns;
+	otezip_stats_leave ();
+	return crc;
+}
+
+/* Report entry e to the hook of za */
+static void otezip_fire_event(zip_t *za, int kind, const struct otezip_entry *e, uint64_t index, uint64_t ns) {
+	if (!za->hook) {
+		return;
+	}
+	otezip_event_t ev;
+	ev.kind = kind;
+	ev.name = e->name;
+	ev.index = index;
+	ev.method = e->method;
+	ev.comp_size = e->comp_size;
+	ev.uncomp_size = e->uncomp_size;
+	ev.ns = ns;
+	za->hook (za->hook_user, &ev);
+}
+
+/* Seek the archive stream of za, counted */
+static int otezip_seek_za(zip_t *za, uint64_t ofs) {
+	otezip_count_seek (za);
+	return otezip_seek (za->fp, ofs);
+}
+
+/* Read n bytes at absolute offset ofs without touching the shared stream
+ * position, so several threads can read entries of one read-only archive.
+ * Windows has no pread(); it falls back to seek+read and is not reentrant. */
+static int otezip_pread_raw(zip_t *za, void *dst, size_t n, uint64_t ofs) {
+	if (za->map) {
+		if (ofs > za->file_size || n > za->file_size - ofs) {
 			return -1;
 		}
-		int zret = brotliDecompress (&strm, Z_FINISH);
-		brotliDecompressEnd (&strm);
-		if (zret != Z_STREAM_END || strm.total_out != e->uncomp_size) {
-			free (cbuf);
-			free (ubuf);
+		memcpy (dst, za->map + ofs, n);
+		return 0;
+	}
+	if (za->mode == 1 && fflush (za->fp) != 0) {
+		return -1;
+	}
+	if (za->mem) {
+		if (ofs > za->mem->len || n > za->mem->len - ofs) {
 			return -1;
 		}
-		free (cbuf);
+		memcpy (dst, za->mem->data + ofs, n);
+		return 0;
 	}
-#endif
-	else {
-		free (cbuf);
-		return -1; /* unsupported method */
+#if defined(_WIN32) || defined(_WIN64)
+	if (otezip_seek_za (za, ofs) != 0) {
+		return -1;
 	}
-	/* Verify CRC32 of uncompressed data if requested or warn on mismatch. */
-	{
-		uint32_t computed_crc = otezip_crc32 (0, ubuf, e->uncomp_size);
-		if (computed_crc != e->crc32) {
-			if (otezip_verify_crc) {
-				/* On strict verify, treat mismatch as fatal for this entry. */
-				free (ubuf);
-				return -1;
-			} else {
-				/* Non-strict mode: warn but continue. */
-				fprintf (stderr, "Warning: CRC mismatch for '%s' (expected 0x%08x, got 0x%08x)\n", e->name? e->name: "<unknown>", e->crc32, computed_crc);
-			}
+	return otezip_read_fully (za->fp, dst, n);
+#else
+	int fd = fileno (za->fp);
+	uint8_t *p = (uint8_t *)dst;
+	while (n > 0) {
+		ssize_t r = pread (fd, p, n, (off_t)ofs);
+		if (r < 0 && errno == EINTR) {
+			continue;
+		}
+		if (r <= 0) {
+			return -1;
 		}
+		p += r;
+		n -= (size_t)r;
+		ofs += (uint64_t)r;
 	}
-
-	*out_buf = ubuf;
-	*out_sz = e->uncomp_size;
 	return 0;
+#endif
 }
 
-/* Helper function to validate archive state */
-static int otezip_is_valid(const zip_t *za) {
-	return (za != NULL && za->fp != NULL);
+/* otezip_pread_raw, counted */
+static int otezip_pread(zip_t *za, void *dst, size_t n, uint64_t ofs) {
+	uint64_t t0 = otezip_clock (za);
+	if (otezip_pread_raw (za, dst, n, ofs) != 0) {
+		return -1;
+	}
+	otezip_count_io (za, 0, n, otezip_since (za, t0));
+	return 0;
 }
 
-/* --------------  public API implementation  --------------- */
-
-zip_t *zip_open(const char *path, int flags, int *errorp) {
-	zip_t *za = (zip_t *)calloc (1, sizeof (zip_t));
-	const char *mode;
-	int exists = 0;
+/* Size of the archive file. Read-only archives use the size recorded when
+ * the central directory was loaded; archives open for writing are growing,
+ * so ask the file system. */
+static int otezip_archive_size(zip_t *za, uint64_t *size) {
+	if (za->mode == 0) {
+		*size = za->file_size;
+		return 0;
+	}
+	return otezip_za_size (za, size);
+}
 
-	if (!za) {
-		if (errorp) {
-			*errorp = -1;
-		}
-		return NULL;
+/* Map a read-only archive into memory. The central directory is then
+ * parsed in place and decoders read compressed bytes straight from the
+ * mapping. Failure is not an error: the archive is read through stdio.
+ * Memory archives are their own mapping. */
+static void otezip_map_archive(zip_t *za) {
+	if (za->mem) {
+		za->map = za->mem->data;
+		za->file_size = za->mem->len;
+		return;
 	}
+#ifdef OTEZIP_HAVE_MMAP
+	struct stat st;
+	int fd = fileno (za->fp);
+	if (fstat (fd, &st) != 0 || !S_ISREG (st.st_mode) || st.st_size <= 0 ||
+		(uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+		return;
+	}
+	void *p = mmap (NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED) {
+		return;
+	}
+	za->map = (const uint8_t *)p;
+	za->file_size = (uint64_t)st.st_size;
+#else
+	(void)za;
+#endif
+}
 
-	/* Initialize structure */
-	za->default_method = 0; /* Default to store */
+static void otezip_unmap_archive(zip_t *za) {
+	if (za->mem) {
+		za->map = NULL;
+		return;
+	}
+#ifdef OTEZIP_HAVE_MMAP
+	if (za->map) {
+		munmap ((void *)za->map, (size_t)za->file_size);
+		za->map = NULL;
+	}
+#else
+	(void)za;
+#endif
+}
 
-	if (flags & ZIP_CREATE) {
-		if ((flags & ZIP_EXCL) && (flags & ZIP_TRUNCATE)) {
-			if (errorp) {
-				 *errorp = -1; /* incompatible flags */
+/* Read the ZIP64 end of central directory record the locator before the
+ * EOCD at eocd_pos points at, over the 32-bit values it supersedes.
+ * Returns 0 without a locator, 1 with a valid record, -1 otherwise. */
+static int otezip_find_eocd64(FILE *fp, uint64_t eocd_pos, uint64_t *entries, uint64_t *cd_size, uint64_t *cd_ofs) {
+	uint8_t loc[20];
+	if (eocd_pos < 20 || otezip_seek (fp, eocd_pos - 20) != 0 || otezip_read_fully (fp, loc, 20) != 0 || otezip_rd32 (loc) != OTEZIP_SIG_EOCD64_LOC) {
+		return 0;
+	}
+	uint64_t ofs = otezip_rd64 (loc + 8);
+	uint8_t rec[56];
+	if (ofs > eocd_pos - 20 || eocd_pos - 20 - ofs < 56 || otezip_seek (fp, ofs) != 0 || otezip_read_fully (fp, rec, 56) != 0 || otezip_rd32 (rec) != OTEZIP_SIG_EOCD64) {
+		return -1;
+	}
+	*entries = otezip_rd64 (rec + 32);
+	*cd_size = otezip_rd64 (rec + 40);
+	*cd_ofs = otezip_rd64 (rec + 48);
+	return 1;
+}
+
+/* locate EOCD record (last 64KiB + 22 bytes), following its ZIP64 locator
+ * when there is one; returns the EOCD offset or an OTEZIP_ERR_* code */
+static int64_t otezip_find_eocd(FILE *fp, uint64_t file_size, uint64_t *cd_size, uint64_t *cd_ofs, uint64_t *total_entries) {
+	if (file_size < 22) {
+		return OTEZIP_ERR_INCONS;
+	}
+	const size_t max_back = 0x10000 + 22; /* spec: comment <= 65535 */
+	size_t search_len = file_size < (uint64_t)max_back? (size_t)file_size: max_back;
+	uint64_t base = file_size - search_len;
+
+	if (otezip_seek (fp, base) != 0) {
+		return OTEZIP_ERR_READ;
+	}
+	uint8_t buf[65558];
+	if (otezip_read_fully (fp, buf, search_len) != 0) {
+		return OTEZIP_ERR_READ;
+	}
+	size_t i;
+	for (i = search_len - 22; i != (size_t)-1; --i) {
+		if (otezip_rd32 (buf + i) == OTEZIP_SIG_EOCD) {
+			/* Basic EOCD present; extract fields but validate them before
+			 * returning to avoid trusting potentially corrupted archives. */
+			uint64_t entries = otezip_rd16 (buf + i + 10);
+			uint64_t cd_size_tmp = otezip_rd32 (buf + i + 12);
+			uint64_t cd_ofs_tmp = otezip_rd32 (buf + i + 16);
+			if (otezip_find_eocd64 (fp, base + i, &entries, &cd_size_tmp, &cd_ofs_tmp) < 0) {
+				continue;
 			}
-			free (za);
-			return NULL;
+
+			/* Ensure central directory lies within the file */
+			if (cd_ofs_tmp > file_size || cd_size_tmp > file_size - cd_ofs_tmp) {
+				/* Central directory claims to be outside the file -> malformed */
+				continue;
+			}
+
+			/* Validate that the central directory starts with a valid CDH signature.
+			 * This handles files with embedded EOCD signatures in compressed data. */
+			if (entries > 0 && cd_size_tmp >= 4) {
+				uint8_t cd_sig[4];
+				if (otezip_seek (fp, cd_ofs_tmp) != 0 || otezip_read_fully (fp, cd_sig, 4) != 0) {
+					continue;
+				}
+				if (otezip_rd32 (cd_sig) != OTEZIP_SIG_CDH) {
+					/* CD doesn't start with valid header - try next EOCD candidate */
+					continue;
+				}
+			}
+
+			/* Everything looked sane; commit results */
+			*total_entries = entries;
+			*cd_size = cd_size_tmp;
+			*cd_ofs = cd_ofs_tmp;
+			return (int64_t) (base + i);
 		}
+	}
+	/* not found */
+	return OTEZIP_ERR_INCONS;
+}
 
-		/* Check if file exists */
-		FILE *test = fopen (path, "rb");
-		exists = (test != NULL);
-		if (test) {
-			fclose (test);
+/* Take the values of the saturated fields among *uncomp, *comp and *ofs
+ * (NULL ones are absent) from the ZIP64 extra field in x[0..len). They
+ * appear in that order, each only when its 32-bit field is all ones. */
+static int otezip_zip64_extra(const uint8_t *x, size_t len, uint64_t *uncomp, uint64_t *comp, uint64_t *ofs) {
+	while (len >= 4) {
+		uint16_t id = otezip_rd16 (x);
+		size_t n = otezip_rd16 (x + 2);
+		if (n > len - 4) {
+			return -1;
 		}
-		if (exists && (flags & ZIP_EXCL)) {
-			if (errorp) {
-				 *errorp = -1; /* file exists but EXCL set */
+		if (id == OTEZIP_EXTRA_ZIP64) {
+			uint64_t *field[3] = { uncomp, comp, ofs };
+			const uint8_t *p = x + 4;
+			for (int k = 0; k < 3; k++) {
+				if (field[k] && *field[k] == OTEZIP_ZIP64_U32) {
+					if (p + 8 > x + 4 + n) {
+						return -1;
+					}
+					*field[k] = otezip_rd64 (p);
+					p += 8;
+				}
 			}
-			free (za);
+			return 0;
+		}
+		x += 4 + n;
+		len -= 4 + n;
+	}
+	return -1;
+}
+
+/* Entry names live in a chain of blocks that never move, so e->name stays
+ * valid while entries are added; zip_close frees the chain at once. */
+struct otezip_strblock {
+	struct otezip_strblock *next; /* older block */
+	size_t used;
+	size_t cap;
+	char data[];
+};
+
+#define OTEZIP_STRBLOCK_MIN (16u * 1024u)
+#define OTEZIP_STRBLOCK_MAX (1024u * 1024u)
+
+static struct otezip_strblock *otezip_strblock_new(zip_t *za, size_t cap) {
+	struct otezip_strblock *b = (struct otezip_strblock *)malloc (sizeof (*b) + cap);
+	if (!b) {
+		return NULL;
+	}
+	b->next = za->strings;
+	b->used = 0;
+	b->cap = cap;
+	za->strings = b;
+	return b;
+}
+
+/* Copy name[0..len) into the arena as a zero-terminated string */
+static char *otezip_strdup_arena(zip_t *za, const char *name, size_t len) {
+	struct otezip_strblock *b = za->strings;
+	if (!b || b->cap - b->used < len + 1) {
+		size_t cap = b? b->cap * 2: OTEZIP_STRBLOCK_MIN;
+		if (cap > OTEZIP_STRBLOCK_MAX) {
+			cap = OTEZIP_STRBLOCK_MAX;
+		}
+		if (cap < len + 1) {
+			cap = len + 1;
+		}
+		b = otezip_strblock_new (za, cap);
+		if (!b) {
 			return NULL;
 		}
-		if (exists && ! (flags & ZIP_TRUNCATE)) {
-			/* Open existing for append */
-			mode = "r+b";
-		} else {
-			/* Create new or truncate */
-			mode = "w+b";
+	}
+	char *s = b->data + b->used;
+	memcpy (s, name, len);
+	s[len] = '\0';
+	b->used += len + 1;
+	return s;
+}
+
+static void otezip_strings_free(zip_t *za) {
+	while (za->strings) {
+		struct otezip_strblock *next = za->strings->next;
+		free (za->strings);
+		za->strings = next;
+	}
+}
+
+/* Length of the central directory record at cd[off], checked to lie
+ * within cd[0..cd_size) */
+static int otezip_cdh_size(const uint8_t *cd, uint64_t cd_size, uint64_t off, size_t *len) {
+	/* Ensure we have at least the fixed-size central header available */
+	if (off > cd_size || cd_size - off < 46 || otezip_rd32 (cd + off) != OTEZIP_SIG_CDH) {
+		return OTEZIP_ERR_INCONS; /* malformed */
+	}
+	const uint8_t *h = cd + off;
+	uint16_t filename_len = otezip_rd16 (h + 28);
+	uint16_t extra_len = otezip_rd16 (h + 30);
+	uint16_t comment_len = otezip_rd16 (h + 32);
+	size_t entry_size = 46 + (size_t)filename_len + (size_t)extra_len + (size_t)comment_len;
+	if (entry_size > cd_size - off) {
+		return OTEZIP_ERR_INCONS;
+	}
+	*len = entry_size;
+	return 0;
+}
+
+/* Fill e from the record at h, already checked by otezip_cdh_size. The
+ * name is copied into the arena last: it marks e as decoded. */
+static int otezip_cdh_decode(zip_t *za, const uint8_t *h, struct otezip_entry *e) {
+	/* Data descriptors (general purpose bit 3): when set, the local
+	 * file header has CRC/sizes zeroed and actual values follow the
+	 * compressed data. However, the central directory always stores
+	 * the correct values, so we can safely use those. No need to reject. */
+	uint16_t filename_len = otezip_rd16 (h + 28);
+	uint16_t extra_len = otezip_rd16 (h + 30);
+	e->flags = otezip_rd16 (h + 8);
+	e->method = otezip_rd16 (h + 10);
+	e->file_time = otezip_rd16 (h + 12);
+	e->file_date = otezip_rd16 (h + 14);
+	e->crc32 = otezip_rd32 (h + 16);
+	e->comp_size = otezip_rd32 (h + 20);
+	e->uncomp_size = otezip_rd32 (h + 24);
+	e->local_hdr_ofs = otezip_rd32 (h + 42);
+	e->external_attr = otezip_rd32 (h + 38);
+
+	if ((e->uncomp_size == OTEZIP_ZIP64_U32 || e->comp_size == OTEZIP_ZIP64_U32 || e->local_hdr_ofs == OTEZIP_ZIP64_U32) &&
+		otezip_zip64_extra (h + 46 + filename_len, extra_len, &e->uncomp_size, &e->comp_size, &e->local_hdr_ofs) != 0) {
+		return OTEZIP_ERR_INCONS;
+	}
+	e->name = otezip_strdup_arena (za, (const char *)h + 46, filename_len);
+	return e->name? 0: OTEZIP_ERR_READ;
+}
+
+/* Position a writable archive at cd_ofs, where appended entries go.
+ * Appending to an existing archive writes new entries over its central
+ * directory, which is kept in memory and rewritten once by zip_close, so
+ * existing payloads are never copied. Until then the file on disk has no
+ * valid directory. */
+static int otezip_append_at(zip_t *za, uint64_t cd_ofs) {
+	if (za->mode != 1) {
+		return 0;
+	}
+	return otezip_seek (za->fp, cd_ofs) == 0? 0: OTEZIP_ERR_READ;
+}
+
+/* Raw central directory of an archive opened with OTEZIP_LAZY. Records
+ * are decoded into za->entries when first asked for; until then an
+ * entry has a NULL name. */
+struct otezip_lazy {
+	const uint8_t *cd; /* in the mapping, or cd_copy */
+	uint8_t *cd_copy;
+	uint64_t cd_ofs;
+	uint64_t cd_size;
+	uint64_t walked; /* records before this one have been stepped over */
+	uint64_t walk_ofs; /* offset in cd of record walked */
+	const uint8_t *index; /* sidecar attached by otezip_open_index, or NULL */
+	size_t index_len;
+	int index_mapped;
+};
+
+#ifdef OTEZIP_HAVE_PTHREAD
+/* Serializes on-demand decoding between readers of a lazy archive */
+static pthread_mutex_t otezip_lazy_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* parse central directory into array of otezip_entry */
+static int otezip_load_central(zip_t *za, int lazy) {
+	uint64_t cd_size;
+	uint64_t cd_ofs;
+	uint64_t n_entries;
+
+	/* The central directory is validated against the actual file size to
+	 * avoid out-of-bounds reads or huge allocations. */
+	if (!za->map && otezip_za_size (za, &za->file_size) != 0) {
+		return OTEZIP_ERR_READ;
+	}
+	int64_t eocd_pos = otezip_find_eocd (za->fp, za->file_size, &cd_size, &cd_ofs, &n_entries);
+	if (eocd_pos < 0) {
+		/* Return the specific error code from find_eocd */
+		return (int)eocd_pos;
+	}
+
+	/* A valid empty ZIP may contain only an EOCD record with an empty
+	 * central directory. Accept that case without trying to read or parse
+	 * any central directory entries. */
+	if (n_entries == 0) {
+		if (cd_size != 0) {
+			return OTEZIP_ERR_INCONS;
+		}
+		za->entries = NULL;
+		za->n_entries = 0;
+		return otezip_append_at (za, cd_ofs);
+	}
+
+	/* Validate central directory size isn't unreasonably large */
+	if (cd_size > OTEZIP_MAX_PAYLOAD || cd_size > SIZE_MAX) {
+		return OTEZIP_ERR_INCONS;
+	}
+	/* parse a mapped central directory in place, otherwise read it whole */
+	const uint8_t *cd_buf = za->map? za->map + cd_ofs: NULL;
+	uint8_t *cd_copy = NULL;
+	if (!cd_buf) {
+		cd_copy = (uint8_t *)malloc (cd_size);
+		if (!cd_copy) {
+			return OTEZIP_ERR_READ;
+		}
+		if (otezip_seek (za->fp, cd_ofs) != 0 || otezip_read_fully (za->fp, cd_copy, (size_t)cd_size) != 0) {
+			free (cd_copy);
+			return OTEZIP_ERR_READ;
+		}
+		cd_buf = cd_copy;
+	}
+
+	/* Validate number of entries is reasonable: each takes 46+ bytes */
+	if (n_entries > cd_size / 46) {
+		free (cd_copy);
+		return OTEZIP_ERR_INCONS;
+	}
+
+	za->entries = (struct otezip_entry *)calloc ((size_t)n_entries, sizeof (struct otezip_entry));
+	za->n_entries = n_entries;
+	za->entries_cap = n_entries;
+
+	/* Every record spends 46 fixed bytes and each name needs one more for
+	 * its terminator, so one block of this size holds all the names. */
+	if (!za->entries || !otezip_strblock_new (za, (size_t) (cd_size - n_entries * 45))) {
+		free (cd_copy);
+		return OTEZIP_ERR_READ;
+	}
+
+	/* lazily: keep the records as they are, decoded when used */
+	if (lazy) {
+		za->lazy = (struct otezip_lazy *)calloc (1, sizeof (struct otezip_lazy));
+		if (!za->lazy) {
+			free (cd_copy);
+			return OTEZIP_ERR_READ;
+		}
+		za->lazy->cd = cd_buf;
+		za->lazy->cd_copy = cd_copy;
+		za->lazy->cd_ofs = cd_ofs;
+		za->lazy->cd_size = cd_size;
+		return 0;
+	}
+
+	size_t off = 0;
+	for (zip_uint64_t i = 0; i < n_entries; i++) {
+		size_t entry_size;
+		int rc = otezip_cdh_size (cd_buf, cd_size, off, &entry_size);
+		if (rc == 0) {
+			rc = otezip_cdh_decode (za, cd_buf + off, &za->entries[i]);
+		}
+		if (rc != 0) {
+			free (cd_copy);
+			return rc;
+		}
+		off += entry_size;
+	}
+	free (cd_copy);
+	return otezip_append_at (za, cd_ofs);
+}
+
+/* Record offset of entry i according to the attached sidecar */
+static uint64_t otezip_index_record(const struct otezip_lazy *lz, zip_uint64_t i);
+
+/* Entry i of za, decoded first if the archive is lazy and it was not
+ * yet; NULL when its record is malformed. Records are found through the
+ * sidecar when one is attached, else by stepping over those before. */
+static struct otezip_entry *otezip_entry_get(zip_t *za, zip_uint64_t i) {
+	struct otezip_entry *e = &za->entries[i];
+	struct otezip_lazy *lz = za->lazy;
+	if (!lz) {
+		return e;
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_lazy_lock);
+#endif
+	size_t len;
+	if (!e->name && lz->index) {
+		uint64_t off = otezip_index_record (lz, i);
+		if (otezip_cdh_size (lz->cd, lz->cd_size, off, &len) == 0) {
+			otezip_cdh_decode (za, lz->cd + off, e);
+		}
+	}
+	while (!e->name && lz->walked <= i && otezip_cdh_size (lz->cd, lz->cd_size, lz->walk_ofs, &len) == 0) {
+		struct otezip_entry *w = &za->entries[lz->walked];
+		if (!w->name && otezip_cdh_decode (za, lz->cd + lz->walk_ofs, w) != 0) {
+			break;
+		}
+		lz->walk_ofs += len;
+		lz->walked++;
+	}
+	int ok = e->name != NULL;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_lazy_lock);
+#endif
+	return ok? e: NULL;
+}
+
+/* Decode every entry of a lazy archive; a no-op afterwards */
+static int otezip_entries_all(zip_t *za) {
+	struct otezip_lazy *lz = za->lazy;
+	if (!lz || lz->walked == za->n_entries) {
+		return 0;
+	}
+	return otezip_entry_get (za, za->n_entries - 1)? 0: -1;
+}
+
+static void otezip_lazy_free(zip_t *za) {
+	struct otezip_lazy *lz = za->lazy;
+	if (!lz) {
+		return;
+	}
+#ifdef OTEZIP_HAVE_MMAP
+	if (lz->index_mapped) {
+		munmap ((void *)lz->index, lz->index_len);
+	} else
+#endif
+	{
+		free ((void *)lz->index);
+	}
+	free (lz->cd_copy);
+	free (lz);
+	za->lazy = NULL;
+}
+
+/* Deflate access point for zip_fseek (otezip_set_seek_span): a block
+ * boundary where decoding can resume and the window before it */
+struct otezip_seekpoint {
+	uint64_t out; /* uncompressed offset */
+	uint64_t bit; /* compressed offset, in bits from the entry's data */
+	uint32_t have; /* bytes in window */
+	uint8_t *window;
+};
+
+/* Access points of one entry, by increasing offset */
+struct otezip_seekpoints {
+	zip_uint64_t index;
+	struct otezip_seekpoint *pt;
+	size_t n;
+	size_t cap;
+	int complete; /* the entry has been decoded to its end once */
+	struct otezip_seekpoints *next;
+};
+
+static void otezip_seekpoints_free(zip_t *za) {
+	while (za->seekpoints) {
+		struct otezip_seekpoints *sp = za->seekpoints;
+		za->seekpoints = sp->next;
+		for (size_t i = 0; i < sp->n; i++) {
+			free (sp->pt[i].window);
+		}
+		free (sp->pt);
+		free (sp);
+	}
+}
+
+/* Validate the local header of an entry and locate its compressed payload.
+ * Performs the bounds and zipbomb checks shared by the buffered and
+ * streaming extraction paths. On success *data_ofs holds the file offset of
+ * the first compressed byte. */
+static int otezip_entry_data_offset(zip_t *za, struct otezip_entry *e, uint64_t *data_ofs) {
+	/* Validate local header offset against file size to avoid reading
+	 * outside the file. Use 64-bit math for safety. */
+	uint64_t file_sz;
+	if (otezip_archive_size (za, &file_sz) != 0) {
+		return -1;
+	}
+	if (e->local_hdr_ofs > file_sz) {
+		return -1;
+	}
+	uint8_t lfh[30];
+	if (otezip_pread (za, lfh, 30, e->local_hdr_ofs) != 0) {
+		return -1;
+	}
+	if (otezip_rd32 (lfh) != OTEZIP_SIG_LFH) {
+		return -1;
+	}
+
+	/* Data descriptors (bit 3): when set, the local file header stores
+	 * CRC/sizes as 0 and actual values appear after compressed data.
+	 * We rely on the central directory values (stored in entry e) which
+	 * are always correct, so we can safely proceed. */
+	uint16_t fn_len = otezip_rd16 (lfh + 26);
+	uint16_t extra_len = otezip_rd16 (lfh + 28);
+
+	/* Filename/extra lengths are 16-bit per spec. Further bounds checks
+	 * are performed for file offsets and allocations below. */
+
+	/* Ensure the compressed data lies within the file bounds. Calculate
+	 * offset to compressed data = local_hdr_ofs + 30 + fn_len + extra_len. */
+	uint64_t ofs = e->local_hdr_ofs + 30ULL + (uint64_t)fn_len + (uint64_t)extra_len;
+	if (ofs > file_sz || e->comp_size > file_sz - ofs) {
+		return -1;
+	}
+
+	/* Protect against zipbombs: require that expected uncompressed size from
+	 * the central directory is within a reasonable bound relative to the
+	 * compressed size. If the entry claims a huge expansion, fail unless the
+	 * global `otezip_ignore_zipbomb` flag is set by the caller (CLI override).
+	 * We compute allowed = comp_size * ratio + slack and compare against the
+	 * declared uncompressed size. Use 64-bit math to avoid overflow. */
+	if (!otezip_ignore_zipbomb && e->comp_size > 0) {
+		uint64_t allowed = e->comp_size > (UINT64_MAX - otezip_max_expansion_slack) / otezip_max_expansion_ratio? UINT64_MAX: e->comp_size * otezip_max_expansion_ratio;
+		allowed += allowed == UINT64_MAX? 0: otezip_max_expansion_slack;
+		if (e->uncomp_size > allowed) {
+			/* suspiciously large uncompressed size */
+			fprintf (stderr, "mzip: entry '%s' claims huge uncompressed size (%llu), rejecting to avoid zipbomb\n", e->name? e->name: "<unknown>", (unsigned long long)e->uncomp_size);
+			return -1;
+		}
+	}
+	*data_ofs = ofs;
+	return 0;
+}
+
+/* Bytes entry e spans on disk: local header, payload and, with bit 3,
+ * the data descriptor. Its optional signature is probed; the sizes in it
+ * are 8 bytes wide when the local header deferred to ZIP64. */
+static int otezip_entry_extent(zip_t *za, const struct otezip_entry *e, uint64_t *len) {
+	uint8_t lfh[30];
+	if (otezip_pread (za, lfh, 30, e->local_hdr_ofs) != 0 || otezip_rd32 (lfh) != OTEZIP_SIG_LFH) {
+		return -1;
+	}
+	uint64_t n = 30ULL + otezip_rd16 (lfh + 26) + otezip_rd16 (lfh + 28) + e->comp_size;
+	if (otezip_rd16 (lfh + 6) & OTEZIP_FLAG_DD) {
+		uint8_t sig[4];
+		if (otezip_pread (za, sig, 4, e->local_hdr_ofs + n) != 0) {
+			return -1;
+		}
+		int zip64 = otezip_rd32 (lfh + 18) == OTEZIP_ZIP64_U32 || otezip_rd32 (lfh + 22) == OTEZIP_ZIP64_U32 ||
+			e->comp_size >= OTEZIP_ZIP64_U32 || e->uncomp_size >= OTEZIP_ZIP64_U32;
+		n += (otezip_rd32 (sig) == OTEZIP_SIG_DD? 4: 0) + (zip64? 20: 12);
+	}
+	*len = n;
+	return 0;
+}
+
+/* Extent of entry e, 0 when unknown, keeping the write position: without
+ * pread() reading moves it */
+static uint64_t otezip_entry_span(zip_t *za, const struct otezip_entry *e) {
+	int64_t pos = otezip_tell (za->fp);
+	uint64_t len = 0;
+	if (pos < 0 || otezip_entry_extent (za, e, &len) != 0) {
+		len = 0;
+	}
+	if (pos >= 0) {
+		otezip_seek_za (za, (uint64_t)pos);
+	}
+	return len;
+}
+
+/* Decode entry e whole into a new buffer, without checking its CRC.
+ * Entries over OTEZIP_MAX_PAYLOAD are only read through streaming. */
+static int otezip_decode_entry(zip_t *za, struct otezip_entry *e, uint8_t **out_buf) {
+	uint64_t data_ofs;
+	if (e->comp_size > OTEZIP_MAX_PAYLOAD || e->uncomp_size > OTEZIP_MAX_PAYLOAD || otezip_entry_data_offset (za, e, &data_ofs) != 0) {
+		return -1;
+	}
+
+	/* compressed data: straight from the mapping, or read into cbuf */
+	uint8_t *cbuf = NULL;
+	const uint8_t *cdata = za->map? za->map + data_ofs: NULL;
+	if (!cdata) {
+		cbuf = (uint8_t *)calloc (e->comp_size ? (size_t)e->comp_size : 1, 1);
+		if (!cbuf) {
+			return -1;
+		}
+		otezip_count_allocs (za, 1);
+		if (e->comp_size && otezip_pread (za, cbuf, (size_t)e->comp_size, data_ofs) != 0) {
+			free (cbuf);
+			return -1;
+		}
+		cdata = cbuf;
+	}
+
+	const otezip_codec_t *codec = otezip_get_codec (e->method);
+	if (!codec || !codec->decompress) {
+		free (cbuf);
+		return -1; /* unsupported method */
+	}
+	uint8_t *ubuf;
+	if (cbuf && e->method == OTEZIP_METHOD_STORE && e->comp_size == e->uncomp_size) {
+		ubuf = cbuf; /* already holds the data */
+		otezip_count_codec (za, e->method, 0, e->comp_size, e->uncomp_size, 0);
+	} else {
+		/* codecs decode straight into the final buffer, sized exactly */
+		ubuf = (uint8_t *)malloc (e->uncomp_size? (size_t)e->uncomp_size: 1);
+		void *ctx;
+		if (!ubuf || otezip_codec_acquire (za, codec, 0, &ctx) != 0) {
+			free (ubuf);
+			free (cbuf);
+			return -1;
+		}
+		otezip_count_allocs (za, 1);
+		uint64_t t1 = otezip_clock (za);
+		int rc = codec->decompress (ctx, cdata, (size_t)e->comp_size, ubuf, (size_t)e->uncomp_size);
+		otezip_count_codec (za, e->method, 0, e->comp_size, rc == 0? e->uncomp_size: 0, otezip_since (za, t1));
+		otezip_codec_release (za, codec, 0, ctx);
+		free (cbuf);
+		if (rc != 0) {
+			free (ubuf);
+			return -1;
+		}
+	}
+	*out_buf = ubuf;
+	return 0;
+}
+
+/* load entire (uncompressed) file into memory and hand ownership to caller */
+static int otezip_extract_entry(zip_t *za, struct otezip_entry *e, uint8_t **out_buf, uint64_t *out_sz) {
+	uint64_t t0 = otezip_clock (za);
+	uint8_t *ubuf;
+	if (otezip_decode_entry (za, e, &ubuf) != 0) {
+		return -1;
+	}
+	/* Verify CRC32 of uncompressed data if requested or warn on mismatch. */
+	{
+		uint32_t computed_crc = otezip_crc32_za (za, 0, ubuf, (size_t)e->uncomp_size);
+		if (computed_crc != e->crc32) {
+			if (otezip_verify_crc) {
+				/* On strict verify, treat mismatch as fatal for this entry. */
+				free (ubuf);
+				return -1;
+			} else {
+				/* Non-strict mode: warn but continue. */
+				fprintf (stderr, "Warning: CRC mismatch for '%s' (expected 0x%08x, got 0x%08x)\n", e->name? e->name: "<unknown>", e->crc32, computed_crc);
+			}
+		}
+	}
+
+	*out_buf = ubuf;
+	*out_sz = e->uncomp_size;
+	otezip_fire_event (za, OTEZIP_EVENT_DECOMPRESS, e, (uint64_t) (e - za->entries), otezip_since (za, t0));
+	return 0;
+}
+
+/* Helper function to validate archive state */
+static int otezip_is_valid(const zip_t *za) {
+	return (za != NULL && za->fp != NULL);
+}
+
+/* Common end of the opens once za->fp is set: read the central
+ * directory of an existing archive. za is released on failure. */
+static zip_t *otezip_open_finish(zip_t *za, int flags, int exists, int *errorp) {
+	if (za->mode == 0) {
+		otezip_map_archive (za);
+	}
+	if (za->mode == 0 || (exists && ! (flags & ZIP_TRUNCATE))) {
+		/* Load central directory for existing archive */
+#ifdef OTEZIP_ENABLE_STATS
+		uint64_t t0 = otezip_now_ns ();
+#endif
+		int load_result = otezip_load_central (za, za->mode == 0 && (flags & OTEZIP_LAZY));
+#ifdef OTEZIP_ENABLE_STATS
+		za->open_ns = otezip_now_ns () - t0;
+#endif
+		if (load_result != 0) {
+			/* Convert internal error codes to libzip error codes */
+			if (errorp) {
+				if (load_result == OTEZIP_ERR_READ) {
+					*errorp = ZIP_ER_READ;
+				} else if (load_result == OTEZIP_ERR_INCONS) {
+					*errorp = ZIP_ER_INCONS;
+				} else {
+					 *errorp = ZIP_ER_NOZIP; /* Unknown error - not a zip */
+				}
+			}
+			zip_close (za);
+			return NULL;
+		}
+
+		/* Set next_index for append mode */
+		if (za->mode == 1) {
+			za->next_index = za->n_entries;
+		}
+	}
+	if (errorp) {
+		*errorp = 0;
+	}
+	return za;
+}
+
+/* --------------  public API implementation  --------------- */
+
+zip_t *zip_open(const char *path, int flags, int *errorp) {
+	zip_t *za = (zip_t *)calloc (1, sizeof (zip_t));
+	const char *mode;
+	int exists = 0;
+
+	if (!za) {
+		if (errorp) {
+			*errorp = -1;
+		}
+		return NULL;
+	}
+	/* Resolve the CRC implementation now so readers on other threads
+	 * never race on the lazy dispatch */
+	otezip_crc32 (0, NULL, 0);
+
+	/* Initialize structure */
+	za->default_method = 0; /* Default to store */
+
+	if (flags & ZIP_CREATE) {
+		if ((flags & ZIP_EXCL) && (flags & ZIP_TRUNCATE)) {
+			if (errorp) {
+				 *errorp = -1; /* incompatible flags */
+			}
+			free (za);
+			return NULL;
+		}
+
+		/* Check if file exists */
+		FILE *test = fopen (path, "rb");
+		exists = (test != NULL);
+		if (test) {
+			fclose (test);
+		}
+		if (exists && (flags & ZIP_EXCL)) {
+			if (errorp) {
+				 *errorp = -1; /* file exists but EXCL set */
+			}
+			free (za);
+			return NULL;
+		}
+		if (exists && ! (flags & ZIP_TRUNCATE)) {
+			/* Open existing for append */
+			mode = "r+b";
+		} else {
+			/* Create new or truncate */
+			mode = "w+b";
+		}
+		za->mode = 1; /* write mode */
+		za->next_index = 0;
+	} else {
+		/* Read-only mode */
+		mode = "rb";
+		za->mode = 0;
+	}
+	if (strchr (mode, 'w')) {
+		unlink (path);
+		// mkrdir
+	}
+
+	FILE *fp = fopen (path, mode);
+	if (!fp) {
+		if (errorp) {
+			*errorp = ZIP_ER_OPEN;
+		}
+		free (za);
+		return NULL;
+	}
+	za->fp = fp;
+	return otezip_open_finish (za, flags, exists, errorp);
+}
+
+/* otezip_open_memory; src goes to the archive once it is open */
+static zip_t *otezip_mem_archive(const void *data, zip_uint64_t len, int flags, zip_source_t *src, int *errorp) {
+	int err = ZIP_ER_OK;
+	int create = (flags & ZIP_CREATE) != 0;
+	int exists = len > 0 && ! (flags & ZIP_TRUNCATE);
+	if ((len > 0 && !data) || len > (zip_uint64_t)SIZE_MAX || (create && (flags & ZIP_EXCL) && (flags & ZIP_TRUNCATE))) {
+		err = ZIP_ER_INVAL;
+	} else if (create && exists && (flags & ZIP_EXCL)) {
+		err = ZIP_ER_EXISTS;
+	}
+#ifdef OTEZIP_HAVE_MEMFILE
+	zip_t *za = err? NULL: (zip_t *)calloc (1, sizeof (zip_t));
+	struct otezip_mem *m = za? (struct otezip_mem *)calloc (1, sizeof (struct otezip_mem)): NULL;
+	if (m && create && exists) {
+		/* written to: work on a copy */
+		m->data = (uint8_t *)malloc ((size_t)len);
+		if (m->data) {
+			memcpy (m->data, data, (size_t)len);
+			m->len = m->cap = (size_t)len;
+		}
+	} else if (m && !create) {
+		m->data = (uint8_t *)data;
+		m->len = (size_t)len;
+	}
+	FILE *fp = (m && (m->data || !exists))? otezip_mem_fopen (m, create): NULL;
+	if (!fp) {
+		if (m) {
+			free (m->cap? m->data: NULL);
+			free (m);
+		}
+		free (za);
+		if (errorp) {
+			*errorp = err? err: ZIP_ER_MEMORY;
+		}
+		return NULL;
+	}
+	otezip_crc32 (0, NULL, 0);
+	za->mode = create;
+	za->mem = m;
+	za->fp = fp;
+	za = otezip_open_finish (za, flags, exists, errorp);
+	if (za) {
+		m->src = src;
+	}
+	return za;
+#else
+	(void)src;
+	if (errorp) {
+		*errorp = err? err: ZIP_ER_OPEN;
+	}
+	return NULL;
+#endif
+}
+
+zip_t *otezip_open_memory(const void *data, zip_uint64_t len, int flags, int *errorp) {
+	return otezip_mem_archive (data, len, flags, NULL, errorp);
+}
+
+int otezip_close_memory(zip_t *za, void **data, zip_uint64_t *len) {
+	if (!otezip_is_valid (za) || !za->mem || !data || !len) {
+		return -1;
+	}
+	*data = NULL;
+	*len = 0;
+	za->mem->out = data;
+	za->mem->out_len = len;
+	zip_close (za);
+	return *data? 0: -1;
+}
+
+/* ----  parallel deflate (otezip_set_deflate_threads)  ---- */
+
+#if defined(OTEZIP_ENABLE_DEFLATE) && defined(OTEZIP_HAVE_PTHREAD)
+#define OTEZIP_HAVE_PDEFLATE 1
+
+/* Input is cut into chunks of this size, deflated independently. Each
+ * chunk but the last ends in a sync flush, which aligns it to a byte
+ * boundary, so the pieces concatenate into one raw deflate stream. */
+#define OTEZIP_PDEFLATE_CHUNK (1024u * 1024u)
+
+/* History each chunk is primed with from the one before it */
+#define OTEZIP_PDEFLATE_DICT (32u * 1024u)
+
+/* Room for one compressed chunk, sync flush marker included */
+#define OTEZIP_PDEFLATE_BOUND (compressBound (OTEZIP_PDEFLATE_CHUNK) + 16)
+
+/* One piece of the stream */
+struct otezip_pchunk {
+	const uint8_t *in; /* dict_len bytes of history, then len bytes to compress */
+	size_t dict_len;
+	size_t len;
+	uint8_t *out;
+	size_t out_len;
+	uint32_t crc; /* of the len bytes, when the pool computes CRCs */
+	int last; /* finish the stream instead of flushing */
+	int done;
+	int rc;
+	uint64_t ns;
+};
+
+/* Workers take queued chunks in order; the caller waits for them in
+ * order too, so results come out as the stream needs them. Without
+ * workers the caller compresses each chunk as it is queued. */
+typedef struct {
+	struct otezip_pchunk *chunks;
+	size_t ring; /* chunk k lives in chunks[k % ring] */
+	size_t queued;
+	size_t taken;
+	zip_t *za; /* counters go here, or NULL */
+	int level;
+	int with_crc;
+	int timed;
+	int closing;
+	int started;
+	pthread_t *threads;
+	z_stream strm; /* used by the caller when no worker could start */
+	int strm_live;
+	pthread_mutex_t lock;
+	pthread_cond_t work_cond;
+	pthread_cond_t done_cond;
+} otezip_pdeflate;
+
+/* Whether an entry with method goes through the chunked encoder: only
+ * the built-in deflate codec knows about dictionaries */
+static int otezip_pdeflate_wanted(uint16_t method, int threads) {
+	const otezip_codec_t *codec = otezip_get_codec (method);
+	return threads > 1 && method == OTEZIP_METHOD_DEFLATE && codec && codec->compress == otezip_zcodec_compress && codec->opaque == (void *)&otezip_deflate_backend;
+}
+
+/* Deflate chunk c with strm, a raw stream set up for the pool's level */
+static void otezip_pchunk_run(otezip_pdeflate *pd, z_stream *strm, struct otezip_pchunk *c) {
+	uint64_t t0 = pd->timed? otezip_now_ns (): 0;
+	uInt cap = (uInt)OTEZIP_PDEFLATE_BOUND;
+	c->rc = -1;
+	c->out_len = 0;
+	if (deflateReset (strm) == Z_OK && deflateSetDictionary (strm, c->in, (uInt)c->dict_len) == Z_OK) {
+		strm->next_in = (uint8_t *)c->in + c->dict_len;
+		strm->avail_in = (uInt)c->len;
+		strm->next_out = c->out;
+		strm->avail_out = cap;
+		int ret = deflate (strm, c->last? Z_FINISH: Z_SYNC_FLUSH);
+		if (ret == (c->last? Z_STREAM_END: Z_OK) && strm->avail_in == 0 && strm->avail_out > 0) {
+			c->out_len = cap - strm->avail_out;
+			c->rc = 0;
+		}
+	}
+	if (pd->with_crc) {
+		c->crc = pd->za? otezip_crc32_za (pd->za, 0, c->in + c->dict_len, c->len): otezip_crc32 (0, c->in + c->dict_len, c->len);
+	}
+	c->ns = pd->timed? otezip_now_ns () - t0: 0;
+}
+
+static void *otezip_pdeflate_worker(void *arg) {
+	otezip_pdeflate *pd = (otezip_pdeflate *)arg;
+	z_stream strm;
+	memset (&strm, 0, sizeof (strm));
+	int live = deflateInit2 (&strm, pd->level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+	pthread_mutex_lock (&pd->lock);
+	for (;;) {
+		while (pd->taken == pd->queued && !pd->closing) {
+			pthread_cond_wait (&pd->work_cond, &pd->lock);
+		}
+		if (pd->taken == pd->queued) {
+			break;
+		}
+		struct otezip_pchunk *c = &pd->chunks[pd->taken++ % pd->ring];
+		pthread_mutex_unlock (&pd->lock);
+		if (live) {
+			otezip_pchunk_run (pd, &strm, c);
+		} else {
+			c->rc = -1;
+		}
+		pthread_mutex_lock (&pd->lock);
+		c->done = 1;
+		pthread_cond_broadcast (&pd->done_cond);
+	}
+	pthread_mutex_unlock (&pd->lock);
+	if (live) {
+		deflateEnd (&strm);
+	}
+	return NULL;
+}
+
+/* Start up to n_threads workers over chunks[ring]; with_crc has them
+ * compute the CRC of each chunk as well */
+static void otezip_pdeflate_start(otezip_pdeflate *pd, zip_t *za, struct otezip_pchunk *chunks, size_t ring, int level, int with_crc, int n_threads) {
+	memset (pd, 0, sizeof (*pd));
+	pd->chunks = chunks;
+	pd->ring = ring;
+	pd->za = za;
+	pd->level = level;
+	pd->with_crc = with_crc;
+	pd->timed = za && otezip_observed (za);
+	pthread_mutex_init (&pd->lock, NULL);
+	pthread_cond_init (&pd->work_cond, NULL);
+	pthread_cond_init (&pd->done_cond, NULL);
+	pd->threads = n_threads > 0? (pthread_t *)malloc ((size_t)n_threads * sizeof (pthread_t)): NULL;
+	while (pd->threads && pd->started < n_threads) {
+		if (pthread_create (&pd->threads[pd->started], NULL, otezip_pdeflate_worker, pd) != 0) {
+			break;
+		}
+		pd->started++;
+	}
+}
+
+/* Hand c, the next chunk of the stream, to the workers */
+static void otezip_pdeflate_queue(otezip_pdeflate *pd, struct otezip_pchunk *c) {
+	c->done = 0;
+	if (!pd->started) {
+		if (!pd->strm_live) {
+			pd->strm_live = deflateInit2 (&pd->strm, pd->level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+		}
+		if (pd->strm_live) {
+			otezip_pchunk_run (pd, &pd->strm, c);
+		} else {
+			c->rc = -1;
+		}
+		c->done = 1;
+		return;
+	}
+	pthread_mutex_lock (&pd->lock);
+	pd->queued++;
+	pthread_cond_signal (&pd->work_cond);
+	pthread_mutex_unlock (&pd->lock);
+}
+
+static void otezip_pdeflate_wait(otezip_pdeflate *pd, struct otezip_pchunk *c) {
+	pthread_mutex_lock (&pd->lock);
+	while (!c->done) {
+		pthread_cond_wait (&pd->done_cond, &pd->lock);
+	}
+	pthread_mutex_unlock (&pd->lock);
+}
+
+/* Let the workers finish what is queued and join them */
+static void otezip_pdeflate_stop(otezip_pdeflate *pd) {
+	pthread_mutex_lock (&pd->lock);
+	pd->closing = 1;
+	pthread_cond_broadcast (&pd->work_cond);
+	pthread_mutex_unlock (&pd->lock);
+	for (int i = 0; i < pd->started; i++) {
+		pthread_join (pd->threads[i], NULL);
+	}
+	free (pd->threads);
+	if (pd->strm_live) {
+		deflateEnd (&pd->strm);
+	}
+	pthread_cond_destroy (&pd->done_cond);
+	pthread_cond_destroy (&pd->work_cond);
+	pthread_mutex_destroy (&pd->lock);
+}
+
+/* Output room otezip_pdeflate_buffer needs for len bytes */
+static size_t otezip_pdeflate_cap(size_t len) {
+	size_t n = (len + OTEZIP_PDEFLATE_CHUNK - 1) / OTEZIP_PDEFLATE_CHUNK;
+	return n * OTEZIP_PDEFLATE_BOUND;
+}
+
+/* Deflate in[len] into out on n_threads workers; *out_len is what the
+ * stream takes. Chunks are compressed at fixed offsets and then slid
+ * down, each over room the one before it did not use. */
+
+static int otezip_pdeflate_buffer(zip_t *za, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len, uint32_t comp_flags, int n_threads, uint64_t *ns) {
+	size_t n = (len + OTEZIP_PDEFLATE_CHUNK - 1) / OTEZIP_PDEFLATE_CHUNK;
+	struct otezip_pchunk *chunks = (struct otezip_pchunk *)calloc (n, sizeof (struct otezip_pchunk));
+	if (!chunks) {
+		return -1;
+	}
+	otezip_count_allocs (za, 1);
+	otezip_pdeflate pd;
+	if ((size_t)n_threads > n) {
+		n_threads = (int)n;
+	}
+	otezip_pdeflate_start (&pd, za, chunks, n, otezip_comp_level (comp_flags), 0, n_threads);
+	for (size_t i = 0; i < n; i++) {
+		struct otezip_pchunk *c = &chunks[i];
+		size_t ofs = i * OTEZIP_PDEFLATE_CHUNK;
+		c->dict_len = ofs < OTEZIP_PDEFLATE_DICT? ofs: OTEZIP_PDEFLATE_DICT;
+		c->in = in + ofs - c->dict_len;
+		c->len = len - ofs < OTEZIP_PDEFLATE_CHUNK? len - ofs: OTEZIP_PDEFLATE_CHUNK;
+		c->out = out + i * OTEZIP_PDEFLATE_BOUND;
+		c->last = i + 1 == n;
+		otezip_pdeflate_queue (&pd, c);
+	}
+	int rc = 0;
+	size_t pos = 0;
+	for (size_t i = 0; i < n; i++) {
+		struct otezip_pchunk *c = &chunks[i];
+		otezip_pdeflate_wait (&pd, c);
+		if (c->rc != 0) {
+			rc = -1;
+		} else if (rc == 0) {
+			memmove (out + pos, c->out, c->out_len);
+			pos += c->out_len;
+		}
+		*ns += c->ns;
+	}
+	otezip_pdeflate_stop (&pd);
+	free (chunks);
+	*out_len = pos;
+	return rc;
+}
+
+/* otezip_compress_data for deflate entries of more than one chunk */
+static int otezip_compress_chunked(zip_t *za, const uint8_t *in_buf, size_t in_size, uint8_t **out_buf, uint64_t *out_size, uint16_t *method, uint32_t comp_flags, int n_threads) {
+	*out_buf = (uint8_t *)malloc (otezip_pdeflate_cap (in_size));
+	if (!*out_buf) {
+		return -1;
+	}
+	otezip_count_allocs (za, 1);
+	size_t n = 0;
+	uint64_t ns = 0;
+	int rc = otezip_pdeflate_buffer (za, in_buf, in_size, *out_buf, &n, comp_flags, n_threads, &ns);
+	otezip_count_codec (za, *method, 1, in_size, rc == 0? n: in_size, ns);
+	if (rc != 0) {
+		free (*out_buf);
+		*out_buf = NULL;
+		return -1;
+	}
+	if (n >= in_size) {
+		*method = OTEZIP_METHOD_STORE;
+		memcpy (*out_buf, in_buf, in_size);
+		n = in_size;
+	}
+	*out_size = n;
+	return 0;
+}
+#endif
+
+/* Compress in_buf with *method through its registered codec, with a
+ * context cached on za. *method becomes STORE when the codec output
+ * would not be smaller. Large deflate entries are split over up to
+ * threads workers. */
+static int otezip_compress_data(zip_t *za, uint8_t *in_buf, size_t in_size, uint8_t **out_buf, uint64_t *out_size, uint16_t *method, uint32_t comp_flags, int threads) {
+	*out_buf = NULL;
+	*out_size = 0;
+
+	/* Handle zero-length input specially to prevent division by zero issues */
+	if (in_size == 0) {
+		 *out_buf = (uint8_t *)malloc (1); /* Allocate minimal buffer */
+		if (!*out_buf) {
+			return -1;
+		}
+		*out_size = 0;
+		*method = OTEZIP_METHOD_STORE;
+		return 0;
+	}
+#ifdef OTEZIP_HAVE_PDEFLATE
+	if (in_size > OTEZIP_PDEFLATE_CHUNK && otezip_pdeflate_wanted (*method, threads)) {
+		return otezip_compress_chunked (za, in_buf, in_size, out_buf, out_size, method, comp_flags, threads);
+	}
+#else
+	(void)threads;
+#endif
+
+	const otezip_codec_t *codec = otezip_get_codec (*method);
+	if (!codec || !codec->compress) {
+		return -1;
+	}
+	/* Output of in_size bytes or more is stored instead, so codecs that
+	 * stop at the end of dst need no more room than that */
+	size_t cap = in_size;
+	if (*method != OTEZIP_METHOD_STORE) {
+		if (codec->bound) {
+			cap = codec->bound (in_size);
+		}
+		*out_buf = (uint8_t *)malloc (cap < in_size? in_size: cap);
+		if (!*out_buf) {
+			return -1;
+		}
+		otezip_count_allocs (za, 1);
+		void *ctx;
+		if (otezip_codec_acquire (za, codec, 1, &ctx) != 0) {
+			free (*out_buf);
+			*out_buf = NULL;
+			return -1;
+		}
+		size_t n = cap;
+		uint64_t t0 = otezip_clock (za);
+		int rc = codec->compress (ctx, in_buf, in_size, *out_buf, &n, comp_flags);
+		otezip_count_codec (za, *method, 1, in_size, rc == 0? n: in_size, otezip_since (za, t0));
+		otezip_codec_release (za, codec, 1, ctx);
+		if (rc < 0) {
+			free (*out_buf);
+			*out_buf = NULL;
+			return -1;
+		}
+		if (rc == 0 && n < in_size) {
+			*out_size = (uint32_t)n;
+			return 0;
+		}
+		/* Compression didn't reduce size: reuse the buffer for STORE */
+		*method = OTEZIP_METHOD_STORE;
+	} else {
+		*out_buf = (uint8_t *)malloc (in_size);
+		if (!*out_buf) {
+			return -1;
+		}
+		otezip_count_allocs (za, 1);
+		otezip_count_codec (za, OTEZIP_METHOD_STORE, 1, in_size, in_size, 0);
+	}
+	memcpy (*out_buf, in_buf, in_size);
+	*out_size = (uint32_t)in_size;
+	return 0;
+}
+
+/* Name index for zip_name_locate: one open-addressing table per
+ * ZIP_FL_NOCASE/ZIP_FL_NODIR combination, built on the first lookup that
+ * needs it and extended by zip_file_add. Slots cache the hash so a probe
+ * only touches a name string when the hashes agree. Entries are always
+ * inserted in index order, so among equal names the lowest index sits
+ * first on the probe run, matching the old linear scan. */
+struct otezip_name_slot {
+	uint32_t hash;
+	uint32_t index1; /* entry index + 1, 0 marks an empty slot */
+};
+
+struct otezip_name_table {
+	struct otezip_name_slot *slots; /* NULL until built */
+	size_t mask; /* slot count - 1, a power of two */
+	size_t used;
+};
+
+#define OTEZIP_NAME_FLAGS (ZIP_FL_NOCASE | ZIP_FL_NODIR)
+
+struct otezip_names {
+	struct otezip_name_table tab[OTEZIP_NAME_FLAGS + 1];
+};
+
+#ifdef OTEZIP_HAVE_PTHREAD
+/* Serializes lazy table builds between readers of ZIP_RDONLY archives */
+static pthread_mutex_t otezip_names_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static inline int otezip_fold(int c) {
+	return (c >= 'A' && c <= 'Z')? c + ('a' - 'A'): c;
+}
+
+/* Part of an entry name that lookups compare against */
+static const char *otezip_name_key(const char *name, zip_flags_t flags) {
+	if (flags & ZIP_FL_NODIR) {
+		const char *slash = strrchr (name, '/');
+		if (slash) {
+			return slash + 1;
+		}
+	}
+	return name;
+}
+
+/* FNV-1a, ASCII case folded for ZIP_FL_NOCASE */
+static uint32_t otezip_name_hash(const char *s, zip_flags_t flags) {
+	uint32_t h = 2166136261u;
+	for (; *s; s++) {
+		int c = (unsigned char)*s;
+		h = (h ^ (uint32_t) ((flags & ZIP_FL_NOCASE)? otezip_fold (c): c)) * 16777619u;
+	}
+	return h;
+}
+
+static int otezip_name_equal(const char *key, const char *fname, zip_flags_t flags) {
+	if (! (flags & ZIP_FL_NOCASE)) {
+		return strcmp (key, fname) == 0;
+	}
+	while (*key && otezip_fold ((unsigned char)*key) == otezip_fold ((unsigned char)*fname)) {
+		key++;
+		fname++;
+	}
+	return *key == 0 && *fname == 0;
+}
+
+static void otezip_name_place(struct otezip_name_table *t, uint32_t hash, uint32_t index1) {
+	size_t i = hash & t->mask;
+	while (t->slots[i].index1) {
+		i = (i + 1) & t->mask;
+	}
+	t->slots[i].hash = hash;
+	t->slots[i].index1 = index1;
+	t->used++;
+}
+
+/* (Re)build a table over every entry, sized to stay at most half full */
+static int otezip_name_build(zip_t *za, struct otezip_name_table *t, zip_flags_t flags) {
+	size_t cap = 16;
+	while (cap / 2 <= za->n_entries) {
+		cap *= 2;
+	}
+	struct otezip_name_slot *slots = (struct otezip_name_slot *)calloc (cap, sizeof (*slots));
+	if (!slots) {
+		return -1;
+	}
+	free (t->slots);
+	t->slots = slots;
+	t->mask = cap - 1;
+	t->used = 0;
+	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
+		const char *key = otezip_name_key (za->entries[i].name, flags);
+		otezip_name_place (t, otezip_name_hash (key, flags), (uint32_t)i + 1);
+	}
+	return 0;
+}
+
+/* Add the newest entry to every table built so far. A table that cannot
+ * grow is dropped and rebuilt by the next lookup. */
+static void otezip_names_append(zip_t *za, zip_uint64_t index) {
+	if (!za->names) {
+		return;
+	}
+	for (unsigned f = 0; f <= OTEZIP_NAME_FLAGS; f++) {
+		struct otezip_name_table *t = &za->names->tab[f];
+		if (!t->slots) {
+			continue;
+		}
+		if ((t->used + 1) * 2 > t->mask + 1) {
+			if (otezip_name_build (za, t, (zip_flags_t)f) != 0) {
+				free (t->slots);
+				memset (t, 0, sizeof (*t));
+			}
+			continue; /* the rebuild already covered the new entry */
+		}
+		const char *key = otezip_name_key (za->entries[index].name, (zip_flags_t)f);
+		otezip_name_place (t, otezip_name_hash (key, (zip_flags_t)f), (uint32_t)index + 1);
+	}
+}
+
+static void otezip_names_free(zip_t *za) {
+	if (!za->names) {
+		return;
+	}
+	for (unsigned f = 0; f <= OTEZIP_NAME_FLAGS; f++) {
+		free (za->names->tab[f].slots);
+	}
+	free (za->names);
+	za->names = NULL;
+}
+
+/* Table for these lookup flags, built if needed; NULL when out of memory
+ * or when indices do not fit a slot, in which case callers scan */
+static struct otezip_name_table *otezip_names_table(zip_t *za, zip_flags_t flags) {
+	struct otezip_name_table *t = NULL;
+	if (za->n_entries >= UINT32_MAX) {
+		return NULL;
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_names_lock);
+#endif
+	if (!za->names) {
+		za->names = (struct otezip_names *)calloc (1, sizeof (struct otezip_names));
+	}
+	if (za->names) {
+		t = &za->names->tab[flags & OTEZIP_NAME_FLAGS];
+		if (!t->slots && otezip_name_build (za, t, flags & OTEZIP_NAME_FLAGS) != 0) {
+			t = NULL;
+		}
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_names_lock);
+#endif
+	return t;
+}
+
+/* ----  streamed sources  ---- */
+
+/* File sources below this size are read whole and compressed like
+ * buffers: in parallel in batches, and stored if they do not shrink.
+ * Larger files and callback sources are streamed by the writer. */
+#define OTEZIP_STREAM_MIN (4u * 1024u * 1024u)
+
+/* Chunk size for reading and compressing streamed sources */
+#define OTEZIP_WRITE_CHUNK (256u * 1024u)
+
+/* Whether src is read while its entry is written */
+static int otezip_source_streams(const zip_source_t *src) {
+	return !src->buf && (src->fp || src->fn);
+}
+
+/* Get ready to read src from the start. *size is its length, or
+ * ZIP_UINT64_MAX when not known. */
+static int otezip_source_open(zip_source_t *src, zip_uint64_t *size) {
+	*size = src->len;
+	if (src->fp) {
+		/* pipes cannot seek, but are only read once from the start */
+		return (otezip_seek (src->fp, src->start) == 0 || src->start == 0)? 0: -1;
+	}
+	if (src->fn (src->userdata, NULL, 0, ZIP_SOURCE_OPEN) < 0) {
+		return -1;
+	}
+	zip_stat_t st;
+	zip_stat_init (&st);
+	if (src->fn (src->userdata, &st, sizeof (st), ZIP_SOURCE_STAT) >= 0 && (st.valid & ZIP_STAT_SIZE)) {
+		*size = st.size;
+	}
+	return 0;
+}
+
+/* Read up to n bytes following the done already read: 0 at the end of
+ * the data, -1 on error */
+static zip_int64_t otezip_source_read(zip_source_t *src, void *dst, size_t n, zip_uint64_t done) {
+	if (src->fp) {
+		if (src->len != ZIP_UINT64_MAX && n > src->len - done) {
+			n = (size_t) (src->len - done);
+		}
+		size_t got = n? fread (dst, 1, n, src->fp): 0;
+		return (got == 0 && ferror (src->fp))? -1: (zip_int64_t)got;
+	}
+	return src->fn (src->userdata, dst, n, ZIP_SOURCE_READ);
+}
+
+static void otezip_source_close(zip_source_t *src) {
+	if (src->fn) {
+		src->fn (src->userdata, NULL, 0, ZIP_SOURCE_CLOSE);
+	}
+}
+
+/* Read a streamed source into memory, making it a buffer source */
+static int otezip_source_load(zip_source_t *src) {
+	zip_uint64_t size;
+	if (otezip_source_open (src, &size) != 0) {
+		return -1;
+	}
+	/* one spare byte to see the end without growing */
+	size_t cap = size < OTEZIP_MAX_PAYLOAD? (size_t)size + 1: OTEZIP_WRITE_CHUNK;
+	uint8_t *buf = (uint8_t *)malloc (cap);
+	size_t len = 0;
+	int rc = buf? 0: -1;
+	while (rc == 0) {
+		if (len == cap) {
+			size_t ncap = cap > OTEZIP_MAX_PAYLOAD / 2? (size_t)OTEZIP_MAX_PAYLOAD + 1: cap * 2;
+			uint8_t *nbuf = cap > OTEZIP_MAX_PAYLOAD? NULL: (uint8_t *)realloc (buf, ncap);
+			if (!nbuf) {
+				rc = -1;
+				break;
+			}
+			buf = nbuf;
+			cap = ncap;
+		}
+		zip_int64_t got = otezip_source_read (src, buf + len, cap - len, len);
+		if (got <= 0) {
+			rc = got < 0? -1: 0;
+			break;
+		}
+		len += (size_t)got;
+	}
+	otezip_source_close (src);
+	if (rc != 0 || (src->fp && src->len != ZIP_UINT64_MAX && len != src->len)) {
+		free (buf);
+		return -1;
+	}
+	src->buf = buf;
+	src->len = len;
+	src->freep = 1;
+	return 0;
+}
+
+/* Whether entries of method can be compressed chunk by chunk */
+static int otezip_method_streams(uint16_t method) {
+	const otezip_codec_t *codec = otezip_get_codec (method);
+	if (!codec) {
+		return 0;
+	}
+#ifdef OTEZIP_ENABLE_STORE
+	if (codec->compress == otezip_store_compress) {
+		return 1;
+	}
+#endif
+	return codec->compress == otezip_zcodec_compress && !((const struct otezip_zbackend *)codec->opaque)->whole_input;
+}
+
+/* ----  "auto": a method picked per entry from its name, size and data  ---- */
+
+#define OTEZIP_AUTO_WINDOW (16u * 1024u) /* bytes per sampled window */
+#define OTEZIP_AUTO_SMALL (64u * 1024u) /* smaller entries favour speed */
+#define OTEZIP_AUTO_DENSE (7u * 256u) /* entropy (bits per byte, 1/256 units) worth a trial */
+#define OTEZIP_AUTO_GAIN 97 /* trial output above this percentage means store */
+
+/* Extensions of formats that are compressed already */
+static const char *const otezip_packed_exts[] = {
+	"7z", "aac", "apk", "avi", "avif", "br", "bz2", "flac", "gif", "gz", "heic", "jar",
+	"jpeg", "jpg", "lz4", "lzma", "m4a", "m4v", "mkv", "mov", "mp3", "mp4", "ogg", "opus",
+	"png", "rar", "tgz", "webm", "webp", "whl", "xz", "zip", "zst", NULL
+};
+
+static int otezip_packed_name(const char *name) {
+	const char *dot = strrchr (name, '.');
+	if (!dot || strchr (dot, '/')) {
+		return 0;
+	}
+	for (size_t i = 0; otezip_packed_exts[i]; i++) {
+		const char *a = dot + 1;
+		const char *b = otezip_packed_exts[i];
+		while (*a && otezip_fold ((unsigned char)*a) == *b) {
+			a++;
+			b++;
+		}
+		if (!*a && !*b) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* log2(x) for x > 0 in 1/256 units, linear between powers of two */
+static uint32_t otezip_log2_q8(uint32_t x) {
+	uint32_t b = 31;
+	while (!(x >> b)) {
+		b--;
+	}
+	uint32_t frac = b >= 8? (x >> (b - 8)) & 0xffu: (x << (8 - b)) & 0xffu;
+	return b * 256u + frac;
+}
+
+/* Whether a deflate pass over n bytes at level 1 would not pay off */
+static int otezip_auto_trial_fails(zip_t *za, const uint8_t *p, size_t n) {
+	const otezip_codec_t *codec = otezip_get_codec (OTEZIP_METHOD_DEFLATE);
+	uint8_t *out = (uint8_t *)malloc (n);
+	void *ctx;
+	if (!codec || !codec->compress || !out || otezip_codec_acquire (za, codec, OTEZIP_CODEC_TRIAL, &ctx) != 0) {
+		free (out);
+		return 1; /* dense and untestable: store it */
+	}
+	size_t got = n;
+	int rc = codec->compress (ctx, p, n, out, &got, 1);
+	otezip_codec_release (za, codec, OTEZIP_CODEC_TRIAL, ctx);
+	free (out);
+	return rc != 0 || got * 100 > n * OTEZIP_AUTO_GAIN;
+}
+
+/* First of the listed methods with an encoder, STORE if none has one */
+static uint16_t otezip_auto_pick(const uint16_t *methods, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		const otezip_codec_t *codec = otezip_get_codec (methods[i]);
+		if (codec && codec->compress) {
+			return methods[i];
+		}
+	}
+	return OTEZIP_METHOD_STORE;
+}
+
+/* Resolve OTEZIP_METHOD_AUTO for an entry of size bytes. data holds len
+ * of them (all, or a prefix; NULL when the source cannot be sampled).
+ * Known compressed formats and samples that are dense and do not deflate
+ * are stored; small or binary entries get the fast codec and large text
+ * the strong one. */
+static uint16_t otezip_auto_method(zip_t *za, const char *name, const uint8_t *data, size_t len, uint64_t size) {
+	static const uint16_t fast[] = { OTEZIP_METHOD_DEFLATE };
+	static const uint16_t strong[] = { OTEZIP_METHOD_ZSTD, OTEZIP_METHOD_DEFLATE };
+	if (size == 0 || otezip_packed_name (name)) {
+		return OTEZIP_METHOD_STORE;
+	}
+	int text = 0;
+	if (data && len > 0) {
+		/* windows at the start, middle and end of the data */
+		size_t starts[3] = { 0, 0, 0 };
+		size_t w = len;
+		size_t nwin = 1;
+		if (len > 3 * OTEZIP_AUTO_WINDOW) {
+			w = OTEZIP_AUTO_WINDOW;
+			starts[1] = len / 2 - w / 2;
+			starts[2] = len - w;
+			nwin = 3;
+		}
+		uint32_t hist[256] = { 0 };
+		for (size_t k = 0; k < nwin; k++) {
+			for (size_t i = 0; i < w; i++) {
+				hist[data[starts[k] + i]]++;
+			}
+		}
+		uint32_t total = (uint32_t) (w * nwin);
+		uint64_t sum = 0;
+		uint32_t plain = hist['\t'] + hist['\n'] + hist['\r'];
+		for (int c = 0; c < 256; c++) {
+			if (hist[c]) {
+				sum += (uint64_t)hist[c] * otezip_log2_q8 (hist[c]);
+			}
+			if (c >= 0x20 && c < 0x7f) {
+				plain += hist[c];
+			}
+		}
+		uint32_t entropy = otezip_log2_q8 (total) - (uint32_t) (sum / total);
+		if (entropy >= OTEZIP_AUTO_DENSE && otezip_auto_trial_fails (za, data, w)) {
+			return OTEZIP_METHOD_STORE;
+		}
+		text = !hist[0] && (uint64_t)plain * 100 >= (uint64_t)total * 95;
+	}
+	if (size < OTEZIP_AUTO_SMALL || !text) {
+		return otezip_auto_pick (fast, sizeof (fast) / sizeof (fast[0]));
+	}
+	return otezip_auto_pick (strong, sizeof (strong) / sizeof (strong[0]));
+}
+
+/* Read the first bytes of a file source to choose a method for it, if
+ * it can be rewound; 0 bytes otherwise */
+static size_t otezip_source_sample(zip_source_t *src, uint8_t *buf, size_t n) {
+	if (!src->fp || otezip_seek (src->fp, src->start) != 0) {
+		return 0;
+	}
+	if (src->len != ZIP_UINT64_MAX && n > src->len) {
+		n = (size_t)src->len;
+	}
+	size_t got = fread (buf, 1, n, src->fp);
+	return otezip_seek (src->fp, src->start) == 0? got: 0;
+}
+
+/* An entry on its way into the archive. otezip_pending_init() fills in
+ * the metadata, otezip_pending_compress() computes the CRC and compressed
+ * payload (safe to run concurrently for different entries) and
+ * otezip_pending_write() appends it at the current end of the archive. */
+struct otezip_pending {
+	char *name;
+	zip_source_t *src;
+	uint16_t method;
+	uint16_t file_time;
+	uint16_t file_date;
+	uint32_t comp_flags;
+	uint32_t crc32;
+	uint8_t *comp_buf;
+	uint64_t comp_size;
+	int rc; /* 0 once compressed successfully */
+	int done; /* set by the worker that compressed it */
+	uint64_t ns; /* time spent compressing, when observed */
+};
+
+/* Entries queued with otezip_batch_add() */
+struct otezip_batch {
+	struct otezip_pending *items;
+	size_t count;
+	size_t cap;
+};
+
+static int otezip_pending_init(zip_t *za, struct otezip_pending *p, const char *name, zip_source_t *src) {
+	memset (p, 0, sizeof (*p));
+	/* strdup is POSIX; allocate and copy to be portable and avoid
+	 * implicit declaration warnings. */
+	size_t nlen = strlen (name) + 1;
+	if (nlen - 1 > OTEZIP_MAX_FIELD_LEN) {
+		return -1;
+	}
+	/* In-memory sources are compressed in one buffer */
+	if (!otezip_source_streams (src) && (uint64_t)src->len > OTEZIP_MAX_PAYLOAD) {
+		return -1;
+	}
+	p->name = (char *)malloc (nlen);
+	if (!p->name) {
+		return -1;
+	}
+	memcpy (p->name, name, nlen);
+	p->src = src;
+
+	/* Use the default compression method if set, otherwise store */
+	p->method = za->default_method > 0? za->default_method: 0;
+	p->comp_flags = za->comp_flags;
+
+	/* Set current time for file timestamp */
+	otezip_get_dostime (&p->file_time, &p->file_date);
+	p->rc = -1;
+	return 0;
+}
+
+/* CRC and compression for one entry; touches only the entry itself and
+ * the context cache of za. Streamed sources are left to the writer.
+ * Deflate may split the entry over threads workers of its own. */
+static void otezip_pending_compress(zip_t *za, struct otezip_pending *p, int threads) {
+	uint64_t t0 = otezip_clock (za);
+	if (otezip_source_streams (p->src)) {
+		if (!p->src->fp || p->src->len >= OTEZIP_STREAM_MIN) {
+			p->rc = 0;
+			return;
+		}
+		if (otezip_source_load (p->src) != 0) {
+			p->rc = -1;
+			return;
 		}
-		za->mode = 1; /* write mode */
-		za->next_index = 0;
-	} else {
-		/* Read-only mode */
-		mode = "rb";
-		za->mode = 0;
 	}
-	if (strchr (mode, 'w')) {
-		unlink (path);
-		// mkrdir
+	if (p->method == OTEZIP_METHOD_AUTO) {
+		p->method = otezip_auto_method (za, p->name, p->src->buf, (size_t)p->src->len, p->src->len);
+	}
+	p->crc32 = otezip_crc32_za (za, 0, p->src->buf, (size_t)p->src->len);
+	p->rc = otezip_compress_data (za, (uint8_t *)p->src->buf, (size_t)p->src->len, &p->comp_buf, &p->comp_size, &p->method, p->comp_flags, threads);
+	/* Validate compressed size too */
+	if (p->rc == 0 && p->comp_size > OTEZIP_MAX_PAYLOAD) {
+		p->rc = -1;
 	}
+	p->ns = otezip_since (za, t0);
+}
 
-	FILE *fp = fopen (path, mode);
-	if (!fp) {
-		if (errorp) {
-			*errorp = ZIP_ER_OPEN;
-		}
-		free (za);
-		return NULL;
+/* Release the source (honouring freep) once its data is no longer needed */
+static void otezip_pending_free_src(struct otezip_pending *p) {
+	zip_source_free (p->src);
+	p->src = NULL;
+}
+
+#ifdef OTEZIP_HAVE_PDEFLATE
+/* Deflate src to out as it is read, with 2 * n_threads chunks in
+ * flight: read ahead, compressed on the workers, written in order.
+ * The stream is closed by the short last chunk or, when the input is a
+ * whole number of chunks, by an empty final block. *crc, *total_in and
+ * *total_out describe what was written; za (may be NULL) is counted. */
+static int otezip_pdeflate_stream(zip_t *za, zip_source_t *src, FILE *out, int level, int n_threads, uint32_t *crc, uint64_t *total_in, uint64_t *total_out, uint64_t *ns) {
+	static const uint8_t final_block[2] = { 0x03, 0x00 };
+	const size_t span = OTEZIP_PDEFLATE_DICT + OTEZIP_PDEFLATE_CHUNK;
+	size_t ring = n_threads > 1? 2 * (size_t)n_threads: 2;
+	struct otezip_pchunk *chunks = (struct otezip_pchunk *)calloc (ring, sizeof (struct otezip_pchunk));
+	uint8_t *ins = (uint8_t *)malloc (ring * span);
+	uint8_t *outs = (uint8_t *)malloc (ring * OTEZIP_PDEFLATE_BOUND);
+	if (!chunks || !ins || !outs) {
+		free (chunks);
+		free (ins);
+		free (outs);
+		return -1;
 	}
-	za->fp = fp;
-	if (za->mode == 0 || (exists && ! (flags & ZIP_TRUNCATE))) {
-		/* Load central directory for existing archive */
-		int load_result = otezip_load_central (za);
-		if (load_result != 0) {
-			/* Convert internal error codes to libzip error codes */
-			if (errorp) {
-				if (load_result == OTEZIP_ERR_READ) {
-					*errorp = ZIP_ER_READ;
-				} else if (load_result == OTEZIP_ERR_INCONS) {
-					*errorp = ZIP_ER_INCONS;
-				} else {
-					 *errorp = ZIP_ER_NOZIP; /* Unknown error - not a zip */
+	if (za) {
+		otezip_count_allocs (za, 3);
+	}
+	otezip_pdeflate pd;
+	otezip_pdeflate_start (&pd, za, chunks, ring, level, 1, n_threads > 1? n_threads: 0);
+	*crc = 0;
+	*total_in = 0;
+	*total_out = 0;
+	size_t filled = 0;
+	size_t written = 0;
+	int eof = 0;
+	int finished = 0;
+	int ok = 1;
+	while (ok) {
+		/* read ahead while a chunk is free */
+		while (ok && !eof && filled < written + ring) {
+			struct otezip_pchunk *c = &chunks[filled % ring];
+			uint8_t *buf = ins + (filled % ring) * span;
+			c->dict_len = 0;
+			if (filled > 0) {
+				/* history from the chunk before, still untouched */
+				const struct otezip_pchunk *prev = &chunks[(filled - 1) % ring];
+				size_t have = prev->dict_len + prev->len;
+				c->dict_len = have < OTEZIP_PDEFLATE_DICT? have: OTEZIP_PDEFLATE_DICT;
+				memcpy (buf, prev->in + have - c->dict_len, c->dict_len);
+			}
+			size_t len = 0;
+			while (len < OTEZIP_PDEFLATE_CHUNK) {
+				zip_int64_t got = otezip_source_read (src, buf + c->dict_len + len, OTEZIP_PDEFLATE_CHUNK - len, *total_in + len);
+				if (got <= 0) {
+					ok = got == 0;
+					break;
 				}
+				len += (size_t)got;
 			}
-			zip_close (za);
-			return NULL;
+			if (!ok || len == 0) {
+				eof = 1;
+				break;
+			}
+			c->in = buf;
+			c->len = len;
+			c->out = outs + (filled % ring) * OTEZIP_PDEFLATE_BOUND;
+			c->last = len < OTEZIP_PDEFLATE_CHUNK;
+			eof = c->last;
+			*total_in += len;
+			otezip_pdeflate_queue (&pd, c);
+			filled++;
+		}
+		if (written == filled) {
+			break;
 		}
+		struct otezip_pchunk *c = &chunks[written % ring];
+		otezip_pdeflate_wait (&pd, c);
+		uint64_t t0 = za? otezip_clock (za): 0;
+		ok = c->rc == 0 && fwrite (c->out, 1, c->out_len, out) == c->out_len;
+		if (za) {
+			otezip_count_io (za, 1, c->out_len, otezip_since (za, t0));
+		}
+		*crc = written? otezip_crc32_combine (*crc, c->crc, c->len): c->crc;
+		*total_out += c->out_len;
+		*ns += c->ns;
+		finished = c->last;
+		written++;
+	}
+	otezip_pdeflate_stop (&pd);
+	free (chunks);
+	free (ins);
+	free (outs);
+	if (ok && !finished) {
+		ok = fwrite (final_block, 1, sizeof (final_block), out) == sizeof (final_block);
+		if (za) {
+			otezip_count_io (za, 1, sizeof (final_block), 0);
+		}
+		*total_out += sizeof (final_block);
+	}
+	return ok? 0: -1;
+}
+#endif
 
-		/* Set next_index for append mode */
-		if (za->mode == 1) {
-			za->next_index = za->n_entries;
+/* Write the data of e from the streamed source of p at the current file
+ * position: local header with OTEZIP_FLAG_DD, the data compressed in
+ * chunks (on the deflate threads of za, if it has them), then the data
+ * descriptor. Sources not known to stay under
+ * OTEZIP_MAX_PAYLOAD get ZIP64 descriptors. */
+static int otezip_write_streamed(zip_t *za, struct otezip_pending *p, struct otezip_entry *e) {
+	zip_source_t *src = p->src;
+	zip_uint64_t size;
+	if (otezip_source_open (src, &size) != 0) {
+		return -1;
+	}
+	const otezip_codec_t *codec = otezip_get_codec (e->method);
+	struct otezip_zctx *z = NULL;
+	void *ctx = NULL;
+	int chunked = 0;
+#ifdef OTEZIP_HAVE_PDEFLATE
+	chunked = otezip_pdeflate_wanted (e->method, za->deflate_threads);
+#endif
+	uint8_t *in = chunked? NULL: (uint8_t *)malloc (OTEZIP_WRITE_CHUNK);
+	uint8_t *out = chunked? NULL: (uint8_t *)malloc (OTEZIP_WRITE_CHUNK);
+	int ok = chunked || (in && out);
+	if (ok && !chunked && codec->compress == otezip_zcodec_compress) {
+		ok = otezip_codec_acquire (za, codec, 1, &ctx) == 0;
+		z = ok? (struct otezip_zctx *)ctx: NULL;
+		ok = ok && otezip_zcodec_start (z, p->comp_flags) == 0;
+	}
+
+	otezip_count_allocs (za, chunked? 0: 2);
+
+	int zip64 = size > OTEZIP_MAX_PAYLOAD;
+	e->flags |= OTEZIP_FLAG_DD;
+	uint64_t t0 = otezip_clock (za);
+	uint32_t hdr = otezip_write_local_header (za->fp, e->name, e->method, zip64? UINT64_MAX: 0, zip64? UINT64_MAX: 0, 0, e->flags);
+	otezip_count_io (za, 1, hdr, otezip_since (za, t0));
+	uint32_t crc = 0;
+	uint64_t total_in = 0;
+	uint64_t total_out = 0;
+	uint64_t codec_ns = 0;
+#ifdef OTEZIP_HAVE_PDEFLATE
+	if (chunked) {
+		ok = otezip_pdeflate_stream (za, src, za->fp, otezip_comp_level (p->comp_flags), za->deflate_threads, &crc, &total_in, &total_out, &codec_ns) == 0;
+	}
+#endif
+	while (ok && !chunked) {
+		zip_int64_t got = otezip_source_read (src, in, OTEZIP_WRITE_CHUNK, total_in);
+		if (got < 0) {
+			ok = 0;
+			break;
+		}
+		size_t n = (size_t)got;
+		crc = otezip_crc32_za (za, crc, in, n);
+		total_in += n;
+		if (!z) {
+			/* stored */
+			t0 = otezip_clock (za);
+			ok = fwrite (in, 1, n, za->fp) == n;
+			otezip_count_io (za, 1, n, otezip_since (za, t0));
+			total_out += n;
+			if (n == 0) {
+				break;
+			}
+			continue;
+		}
+		int flush = n? Z_NO_FLUSH: Z_FINISH;
+		z->strm.next_in = in;
+		z->strm.avail_in = (uInt)n;
+		int ret;
+		do {
+			z->strm.next_out = out;
+			z->strm.avail_out = OTEZIP_WRITE_CHUNK;
+			t0 = otezip_clock (za);
+			ret = z->be->enc_run (&z->strm, flush);
+			codec_ns += otezip_since (za, t0);
+			size_t have = OTEZIP_WRITE_CHUNK - z->strm.avail_out;
+			t0 = otezip_clock (za);
+			if (fwrite (out, 1, have, za->fp) != have) {
+				ok = 0;
+			}
+			otezip_count_io (za, 1, have, otezip_since (za, t0));
+			total_out += have;
+			if (ret == Z_BUF_ERROR && flush == Z_NO_FLUSH && z->strm.avail_in == 0) {
+				break; /* all input taken, nothing to hand out yet */
+			}
+			if (ret != Z_OK && ret != Z_STREAM_END) {
+				ok = 0;
+			}
+		} while (ok && ret != Z_STREAM_END && (flush == Z_FINISH || z->strm.avail_in > 0 || z->strm.avail_out == 0));
+		if (flush == Z_FINISH) {
+			break;
 		}
 	}
-	if (errorp) {
-		*errorp = 0;
+	otezip_source_close (src);
+	if (ctx) {
+		otezip_codec_release (za, codec, 1, ctx);
 	}
-	return za;
+	free (in);
+	free (out);
+	/* a file must still hold the bytes it had when the source was made */
+	if (src->fp && src->len != ZIP_UINT64_MAX && total_in != src->len) {
+		ok = 0;
+	}
+	if (!ok || (!zip64 && (total_in >= OTEZIP_ZIP64_U32 || total_out >= OTEZIP_ZIP64_U32))) {
+		return -1;
+	}
+
+	uint8_t dd[24];
+	otezip_wr32 (dd, OTEZIP_SIG_DD);
+	otezip_wr32 (dd + 4, crc);
+	if (zip64) {
+		otezip_wr64 (dd + 8, total_out);
+		otezip_wr64 (dd + 16, total_in);
+	} else {
+		otezip_wr32 (dd + 8, (uint32_t)total_out);
+		otezip_wr32 (dd + 12, (uint32_t)total_in);
+	}
+	size_t dd_len = zip64? 24: 16;
+	t0 = otezip_clock (za);
+	if (fwrite (dd, 1, dd_len, za->fp) != dd_len) {
+		return -1;
+	}
+	otezip_count_io (za, 1, dd_len, otezip_since (za, t0));
+	otezip_count_codec (za, e->method, 1, total_in, total_out, codec_ns);
+	e->crc32 = crc;
+	e->comp_size = total_out;
+	e->uncomp_size = total_in;
+	return 0;
 }
 
-/* Helper function to compress data using various compression methods */
-static int otezip_compress_data(uint8_t *in_buf, size_t in_size, uint8_t **out_buf, uint32_t *out_size, uint16_t *method) {
-	*out_buf = NULL;
-	*out_size = 0;
+/* Local header and data of e at the current file position, counted as
+ * one write */
+static int otezip_write_entry(zip_t *za, const struct otezip_entry *e, const uint8_t *data) {
+	uint64_t t0 = otezip_clock (za);
+	uint64_t n = otezip_write_local_header (za->fp, e->name, e->method, e->comp_size, e->uncomp_size, e->crc32, e->flags);
+	size_t w = fwrite (data, 1, (size_t)e->comp_size, za->fp);
+	otezip_count_io (za, 1, n + w, otezip_since (za, t0));
+	return w == (size_t)e->comp_size? 0: -1;
+}
 
-	/* Handle zero-length input specially to prevent division by zero issues */
-	if (in_size == 0) {
-		 *out_buf = (uint8_t *)malloc (1); /* Allocate minimal buffer */
-		if (!*out_buf) {
+/* Append a compressed entry at the current file position. On success the
+ * name is copied into the archive's string arena and the index returned. */
+static zip_int64_t otezip_pending_write(zip_t *za, struct otezip_pending *p) {
+	if (p->method == OTEZIP_METHOD_AUTO) {
+		/* streamed: judged by its first window, if it has one to look at */
+		uint8_t sample[OTEZIP_AUTO_WINDOW];
+		size_t n = otezip_source_sample (p->src, sample, sizeof (sample));
+		p->method = otezip_auto_method (za, p->name, n? sample: NULL, n, p->src->len);
+	}
+	/* a streamed source whose codec needs the whole entry at once */
+	if (otezip_source_streams (p->src) && !otezip_method_streams (p->method)) {
+		if (otezip_source_load (p->src) != 0) {
+			return -1;
+		}
+		otezip_pending_compress (za, p, za->deflate_threads);
+		if (p->rc != 0) {
 			return -1;
 		}
-		*out_size = 0;
-		*method = OTEZIP_METHOD_STORE;
-		return 0;
 	}
 
-#ifdef OTEZIP_ENABLE_STORE
-	if (*method == OTEZIP_METHOD_STORE) {
-		/* Store (no compression) */
-		*out_buf = (uint8_t *)malloc (in_size);
-		if (!*out_buf) {
+	/* Grow the entry table geometrically */
+	if (za->n_entries == za->entries_cap) {
+		zip_uint64_t cap = za->entries_cap? za->entries_cap * 2: 16;
+		struct otezip_entry *new_entries = realloc (za->entries, (size_t)cap * sizeof (struct otezip_entry));
+		if (!new_entries) {
 			return -1;
 		}
-		memcpy (*out_buf, in_buf, in_size);
-		*out_size = (uint32_t)in_size;
-		return 0;
+		za->entries = new_entries;
+		za->entries_cap = cap;
 	}
-#endif
 
-#ifdef OTEZIP_ENABLE_DEFLATE
-	if (*method == OTEZIP_METHOD_DEFLATE) {
-		/* Deflate compression */
-		unsigned long comp_bound = compressBound ((unsigned long)in_size);
-		*out_buf = (uint8_t *)malloc (comp_bound);
-		if (!*out_buf) {
+	/* Get current position for local header offset */
+	int64_t current_pos = otezip_tell (za->fp);
+	if (current_pos < 0) {
+		return -1;
+	}
+	uint64_t t0 = otezip_clock (za);
+
+	/* Set up the new entry */
+	struct otezip_entry *e = &za->entries[za->n_entries];
+	memset (e, 0, sizeof (struct otezip_entry));
+	e->name = otezip_strdup_arena (za, p->name, strlen (p->name));
+	if (!e->name) {
+		return -1;
+	}
+	e->local_hdr_ofs = (uint64_t)current_pos;
+	e->comp_size = p->comp_size;
+	e->uncomp_size = p->src->len;
+	e->method = p->method;
+	e->crc32 = p->crc32;
+	e->file_time = p->file_time;
+	e->file_date = p->file_date;
+	/* Set default permissions: 0644 for files */
+	e->external_attr = 0100644u << 16; /* S_IFREG | 0644 << 16 */
+
+	if (otezip_source_streams (p->src)) {
+		if (otezip_write_streamed (za, p, e) != 0) {
+			/* the next entry goes where this one started */
+			otezip_truncate (za, e->local_hdr_ofs);
 			return -1;
 		}
-		z_stream strm = { 0 };
-		/* For ZIP files, we need raw deflate (no zlib header) - use negative windowBits */
-		if (deflateInit2 (&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
-			free (*out_buf);
-			*out_buf = NULL;
+	} else {
+		int rc = otezip_write_entry (za, e, p->comp_buf);
+		free (p->comp_buf);
+		p->comp_buf = NULL;
+		if (rc != 0) {
+			otezip_truncate (za, e->local_hdr_ofs);
 			return -1;
 		}
-		strm.next_in = in_buf;
-		strm.avail_in = (uint32_t)in_size;
-		strm.next_out = *out_buf;
-		strm.avail_out = (uint32_t)comp_bound;
+	}
 
-		if (deflate (&strm, Z_FINISH) != Z_STREAM_END) {
-			deflateEnd (&strm);
-			free (*out_buf);
-			*out_buf = NULL;
-			return -1;
-		}
-		*out_size = strm.total_out;
-		deflateEnd (&strm);
+	/* Increment entry count */
+	zip_uint64_t index = za->n_entries;
+	za->n_entries++;
+	za->next_index = za->n_entries;
+	otezip_names_append (za, index);
+	otezip_fire_event (za, OTEZIP_EVENT_COMPRESS, e, index, p->ns + otezip_since (za, t0));
 
-		/* If compression didn't reduce size, fall back to STORE */
-		if (*out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
-		}
-		return 0;
+	return (zip_int64_t)index;
+}
+
+/* Add file to ZIP archive */
+zip_int64_t zip_file_add(zip_t *za, const char *name, zip_source_t *src, zip_flags_t flags) {
+	(void)flags;
+	if (!za || !name || !src || za->mode != 1) {
+		return -1;
 	}
-#endif
+	/* Entries queued earlier must land first to keep archive order */
+	if (za->batch && za->batch->count > 0 && otezip_batch_commit (za, 1) != 0) {
+		return -1;
+	}
+	struct otezip_pending p;
+	if (otezip_pending_init (za, &p, name, src) != 0) {
+		return -1;
+	}
+	otezip_pending_compress (za, &p, za->deflate_threads);
+	zip_int64_t index = p.rc == 0? otezip_pending_write (za, &p): -1;
+	free (p.comp_buf);
+	free (p.name);
+	if (index < 0) {
+		return -1;
+	}
+	/* Free source data if requested */
+	otezip_pending_free_src (&p);
+	return index;
+}
 
-#ifdef OTEZIP_ENABLE_ZSTD
-	if (*method == OTEZIP_METHOD_ZSTD) {
-		/* ZSTD compression */
-		/* For raw blocks (no actual compression), we need space for:
-		 * input data + frame header (5) + block headers (~3 bytes per ~65KB block) */
-		size_t out_cap = in_size + 1024; /* 1KB overhead for frame + block headers */
-		*out_buf = (uint8_t *)malloc (out_cap);
-		if (!*out_buf) {
+/* Queue an entry for otezip_batch_commit(). Takes ownership of src on
+ * success; returns the index the entry gets if every queued entry before
+ * it is added successfully. */
+zip_int64_t otezip_batch_add(zip_t *za, const char *name, zip_source_t *src) {
+	if (!za || !name || !src || za->mode != 1) {
+		return -1;
+	}
+	if (!za->batch) {
+		za->batch = (struct otezip_batch *)calloc (1, sizeof (struct otezip_batch));
+		if (!za->batch) {
 			return -1;
 		}
-		z_stream strm = { 0 };
-		if (zstdInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-			free (*out_buf);
-			*out_buf = NULL;
+	}
+	struct otezip_batch *b = za->batch;
+	if (b->count == b->cap) {
+		size_t cap = b->cap? b->cap * 2: 16;
+		struct otezip_pending *items = (struct otezip_pending *)realloc (b->items, cap * sizeof (*items));
+		if (!items) {
 			return -1;
 		}
+		b->items = items;
+		b->cap = cap;
+	}
+	if (otezip_pending_init (za, &b->items[b->count], name, src) != 0) {
+		return -1;
+	}
+	b->count++;
+	return (zip_int64_t)(za->n_entries + b->count - 1);
+}
 
-		strm.next_in = in_buf;
-		strm.avail_in = (unsigned int)in_size;
-		strm.next_out = *out_buf;
-		strm.avail_out = (unsigned int)out_cap;
+#ifdef OTEZIP_HAVE_PTHREAD
+/* Work queue shared by the compression workers and the writer. Workers
+ * claim entries in submission order but stay at most `window` entries
+ * ahead of the writer, which bounds the compressed data held in memory. */
+typedef struct {
+	zip_t *za;
+	struct otezip_pending *items;
+	size_t count;
+	size_t next; /* next entry to hand to a worker */
+	size_t written; /* entries already consumed by the writer */
+	size_t window;
+	pthread_mutex_t lock;
+	pthread_cond_t done_cond; /* an entry finished compressing */
+	pthread_cond_t room_cond; /* the writer consumed an entry */
+} otezip_pool;
+
+static void *otezip_pool_worker(void *arg) {
+	otezip_pool *pool = (otezip_pool *)arg;
+	pthread_mutex_lock (&pool->lock);
+	for (;;) {
+		while (pool->next < pool->count && pool->next >= pool->written + pool->window) {
+			pthread_cond_wait (&pool->room_cond, &pool->lock);
+		}
+		if (pool->next >= pool->count) {
+			break;
+		}
+		struct otezip_pending *p = &pool->items[pool->next++];
+		pthread_mutex_unlock (&pool->lock);
+		otezip_pending_compress (pool->za, p, 1);
+		pthread_mutex_lock (&pool->lock);
+		p->done = 1;
+		pthread_cond_broadcast (&pool->done_cond);
+	}
+	pthread_mutex_unlock (&pool->lock);
+	return NULL;
+}
+#endif
 
-		/* Keep calling compress until all data is processed and we get Z_STREAM_END */
-		int ret = Z_OK;
-		while (ret == Z_OK) {
-			ret = zstdCompress (&strm, Z_FINISH);
+/* Compress all queued entries using up to n_threads workers and write
+ * them in the order they were queued, so local header offsets do not
+ * depend on scheduling. Entries that fail are left out of the archive.
+ * Returns 0 when every queued entry was added, -1 otherwise. */
+int otezip_batch_commit(zip_t *za, int n_threads) {
+	if (!za || za->mode != 1) {
+		return -1;
+	}
+	struct otezip_batch *b = za->batch;
+	if (!b || b->count == 0) {
+		return 0;
+	}
+	/* Resolve the CRC implementation before any worker can race on it */
+	otezip_crc32 (0, NULL, 0);
+
+	int rc = 0;
+	size_t n = b->count;
+#ifdef OTEZIP_HAVE_PTHREAD
+	otezip_pool pool;
+	pthread_t *threads = NULL;
+	int started = 0;
+	int pooled = 0;
+	memset (&pool, 0, sizeof (pool));
+	if (n_threads > 1 && n > 1) {
+		if ((size_t)n_threads > n) {
+			n_threads = (int)n;
 		}
-		if (ret != Z_STREAM_END) {
-			/* If compression failed, fall back to STORE */
-			zstdEnd (&strm);
-			free (*out_buf);
-			*out_buf = NULL;
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
+		pooled = 1;
+		pool.za = za;
+		pool.items = b->items;
+		pool.count = n;
+		pool.window = 2 * (size_t)n_threads;
+		pthread_mutex_init (&pool.lock, NULL);
+		pthread_cond_init (&pool.done_cond, NULL);
+		pthread_cond_init (&pool.room_cond, NULL);
+		threads = (pthread_t *)malloc ((size_t)n_threads * sizeof (pthread_t));
+		for (; threads && started < n_threads; started++) {
+			if (pthread_create (&threads[started], NULL, otezip_pool_worker, &pool) != 0) {
+				break;
+			}
+		}
+	}
+#else
+	(void)n_threads;
+#endif
+	for (size_t i = 0; i < n; i++) {
+		struct otezip_pending *p = &b->items[i];
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (started > 0) {
+			pthread_mutex_lock (&pool.lock);
+			while (!p->done) {
+				pthread_cond_wait (&pool.done_cond, &pool.lock);
+			}
+			pthread_mutex_unlock (&pool.lock);
+		} else
+#endif
+		{
+			otezip_pending_compress (za, p, za->deflate_threads);
+		}
+		if (p->rc != 0 || otezip_pending_write (za, p) < 0) {
+			rc = -1;
+		}
+		free (p->comp_buf);
+		free (p->name);
+		otezip_pending_free_src (p);
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (started > 0) {
+			pthread_mutex_lock (&pool.lock);
+			pool.written = i + 1;
+			pthread_cond_broadcast (&pool.room_cond);
+			pthread_mutex_unlock (&pool.lock);
+		}
+#endif
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	if (pooled) {
+		for (int t = 0; t < started; t++) {
+			pthread_join (threads[t], NULL);
 		}
+		free (threads);
+		pthread_cond_destroy (&pool.room_cond);
+		pthread_cond_destroy (&pool.done_cond);
+		pthread_mutex_destroy (&pool.lock);
+	}
+#endif
+	b->count = 0;
+	return rc;
+}
+
+/* Set the compression method and comp_flags for entries added from now
+ * on, and for index itself while it is still queued by otezip_batch_add.
+ * Entries are compressed as they are added, so one already written keeps
+ * its data and method. */
+int zip_set_file_compression(zip_t *za, zip_uint64_t index, zip_int32_t comp, zip_uint32_t comp_flags) {
+	if (!otezip_is_valid (za) || za->mode != 1) {
+		return -1;
+	}
+	zip_uint64_t queued = za->batch? za->batch->count: 0;
+	if (index >= za->n_entries + queued) {
+		return -1;
+	}
+
+	/* The method needs a codec that can compress */
+	const otezip_codec_t *codec = (comp >= 0 && comp <= 0xffff)? otezip_get_codec ((zip_uint16_t)comp): NULL;
+	if (comp != OTEZIP_METHOD_AUTO && (!codec || !codec->compress)) {
+		return -1;
+	}
+
+	if (index >= za->n_entries) {
+		struct otezip_pending *p = &za->batch->items[index - za->n_entries];
+		p->method = (uint16_t)comp;
+		p->comp_flags = comp_flags;
+	}
+	/* Set the method for next files that will be added */
+	za->default_method = (uint16_t)comp;
+	za->comp_flags = comp_flags;
+	return 0;
+}
+
+/* Finalize ZIP file before closing - write central directory */
+static int otezip_finalize_archive(zip_t *za) {
+	if (!otezip_is_valid (za) || !za->fp || za->mode != 1) {
+		return -1;
+	}
+	/* Get offset for central directory */
+	int64_t cd_offset = otezip_tell (za->fp);
+	if (cd_offset < 0) {
+		return -1;
+	}
+	uint64_t t0 = otezip_clock (za);
+	/* Write central directory headers; the EOCD switches to ZIP64 when
+	 * the count, size or offset outgrows its fields */
+	uint64_t cd_size_acc = 0;
+	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
+		struct otezip_entry *e = &za->entries[i];
+		cd_size_acc += otezip_write_central_header (za->fp, e->name, e->method, e->comp_size, e->uncomp_size, e->crc32, e->local_hdr_ofs, e->file_time, e->file_date, e->external_attr, e->flags);
+	}
+
+	/* Write end of central directory record */
+	otezip_write_end_of_central_directory (za->fp, za->n_entries, cd_size_acc, (uint64_t)cd_offset);
+
+	/* An appended, compacted or shrunk archive may end before the old
+	 * one did; drop the stale tail so readers find this EOCD */
+	int64_t end = otezip_tell (za->fp);
+	if (end < 0 || otezip_truncate (za, (uint64_t)end) != 0) {
+		return -1;
+	}
+	struct otezip_entry cd;
+	memset (&cd, 0, sizeof (cd));
+	cd.comp_size = cd.uncomp_size = (uint64_t) (end - cd_offset);
+	uint64_t ns = otezip_since (za, t0);
+	otezip_count_io (za, 1, cd.comp_size, ns);
+	otezip_fire_event (za, OTEZIP_EVENT_DIRECTORY, &cd, za->n_entries, ns);
+	return 0;
+}
+
+int zip_close(zip_t *za) {
+	if (!otezip_is_valid (za)) {
+		free (za);
+		return -1;
+	}
+	/* Finalize archive if in write mode */
+	if (za->mode == 1) {
+		otezip_batch_commit (za, 1);
+		otezip_finalize_archive (za);
+	}
+	if (za->batch) {
+		free (za->batch->items);
+		free (za->batch);
+	}
+	otezip_names_free (za);
+	otezip_codecs_free (za);
+
+	otezip_unmap_archive (za);
+	if (za->fp) {
+		fclose (za->fp);
+	}
+	otezip_mem_free (za);
+	otezip_lazy_free (za);
+	otezip_seekpoints_free (za);
+	otezip_strings_free (za);
+	free (za->entries);
+	free (za);
+	return 0;
+}
+
+int otezip_set_stats(zip_t *za, otezip_stats_t *st) {
+#ifdef OTEZIP_ENABLE_STATS
+	if (!otezip_is_valid (za)) {
+		return -1;
+	}
+	if (st) {
+		memset (st, 0, sizeof (*st));
+		st->open_ns = za->open_ns;
+	}
+	za->stats = st;
+	return 0;
+#else
+	(void)za;
+	(void)st;
+	return -1;
+#endif
+}
+
+int otezip_set_event_hook(zip_t *za, otezip_event_hook hook, void *user) {
+#ifdef OTEZIP_ENABLE_STATS
+	if (!otezip_is_valid (za)) {
+		return -1;
+	}
+	za->hook = hook;
+	za->hook_user = user;
+	return 0;
+#else
+	(void)za;
+	(void)hook;
+	(void)user;
+	return -1;
+#endif
+}
+
+int otezip_set_deflate_threads(zip_t *za, int n_threads) {
+	if (!otezip_is_valid (za) || n_threads < 0) {
+		return -1;
+	}
+	za->deflate_threads = n_threads;
+	return 0;
+}
 
-		*out_size = (uint32_t)strm.total_out;
-		zstdEnd (&strm);
+int otezip_set_seek_span(zip_t *za, zip_uint64_t span) {
+	if (!otezip_is_valid (za)) {
+		return -1;
+	}
+	za->seek_span = span;
+	return 0;
+}
 
-		/* If compression didn't reduce size, fall back to STORE */
-		if (*out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
+#ifdef OTEZIP_ENABLE_DEFLATE
+/* otezip_gzip_file on one thread: a plain gzip stream */
+static int otezip_gzip_serial(zip_source_t *src, FILE *out, int level, uint64_t *total_in, uint64_t *total_out) {
+	z_stream strm;
+	memset (&strm, 0, sizeof (strm));
+	if (deflateInit2 (&strm, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return -1;
+	}
+	uint8_t *in = (uint8_t *)malloc (OTEZIP_WRITE_CHUNK);
+	uint8_t *buf = (uint8_t *)malloc (OTEZIP_WRITE_CHUNK);
+	int ok = in && buf;
+	int ret = Z_OK;
+	while (ok && ret != Z_STREAM_END) {
+		zip_int64_t got = otezip_source_read (src, in, OTEZIP_WRITE_CHUNK, *total_in);
+		if (got < 0) {
+			ok = 0;
+			break;
 		}
-		return 0;
+		*total_in += (uint64_t)got;
+		strm.next_in = in;
+		strm.avail_in = (uInt)got;
+		int flush = got? Z_NO_FLUSH: Z_FINISH;
+		do {
+			strm.next_out = buf;
+			strm.avail_out = OTEZIP_WRITE_CHUNK;
+			ret = deflate (&strm, flush);
+			size_t have = OTEZIP_WRITE_CHUNK - strm.avail_out;
+			ok = (ret == Z_OK || ret == Z_STREAM_END || ret == Z_BUF_ERROR) && fwrite (buf, 1, have, out) == have;
+			*total_out += have;
+		} while (ok && ret != Z_STREAM_END && (strm.avail_in > 0 || strm.avail_out == 0));
 	}
+	deflateEnd (&strm);
+	free (in);
+	free (buf);
+	return ok? 0: -1;
+}
 #endif
 
-#ifdef OTEZIP_ENABLE_LZ4
-	if (*method == OTEZIP_METHOD_LZ4) {
-		/* LZ4 compression using radare2's implementation */
-		 *out_buf = (uint8_t *)malloc (in_size * 2); /* Worst case scenario */
-		if (!*out_buf) {
-			return -1;
-		}
-		int comp_size = r_lz4_compress (*out_buf, in_buf, in_size, 9); /* Use max compression level */
-		if (comp_size <= 0) {
-			free (*out_buf);
-			*out_buf = NULL;
-			return -1;
-		}
-		*out_size = comp_size;
-		/* If compression didn't reduce size, fall back to STORE */
-		if (*out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
-		}
+#ifdef OTEZIP_HAVE_PDEFLATE
+/* otezip_gzip_file on n_threads: the chunked raw stream, wrapped */
+static int otezip_gzip_chunked(zip_source_t *src, FILE *out, int level, int n_threads, uint64_t *total_in, uint64_t *total_out) {
+	uint8_t hdr[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3 };
+	/* XFL: 2 = best compression, 4 = fastest */
+	hdr[8] = level == 9? 2: level == 1? 4: 0;
+	uint32_t crc = 0;
+	uint64_t ns = 0;
+	int ok = fwrite (hdr, 1, sizeof (hdr), out) == sizeof (hdr);
+	ok = ok && otezip_pdeflate_stream (NULL, src, out, level, n_threads, &crc, total_in, total_out, &ns) == 0;
+	uint8_t trailer[8];
+	otezip_wr32 (trailer, crc);
+	otezip_wr32 (trailer + 4, (uint32_t)*total_in);
+	ok = ok && fwrite (trailer, 1, sizeof (trailer), out) == sizeof (trailer);
+	*total_out += sizeof (hdr) + sizeof (trailer);
+	return ok? 0: -1;
+}
+#endif
 
-		return 0;
+int otezip_gzip_file(FILE *in, FILE *out, int level, int n_threads, zip_uint64_t *in_len, zip_uint64_t *out_len) {
+	uint64_t total_in = 0;
+	uint64_t total_out = 0;
+	int rc = -1;
+#ifdef OTEZIP_ENABLE_DEFLATE
+	zip_source_t src;
+	memset (&src, 0, sizeof (src));
+	src.fp = in;
+	src.len = ZIP_UINT64_MAX;
+	if (!in || !out) {
+		return -1;
 	}
+#ifdef OTEZIP_HAVE_PDEFLATE
+	if (n_threads > 1) {
+		rc = otezip_gzip_chunked (&src, out, level, n_threads, &total_in, &total_out);
+	} else
+#else
+	(void)n_threads;
 #endif
-#ifdef OTEZIP_ENABLE_LZFSE
-	if (*method == OTEZIP_METHOD_LZFSE) {
-		/* LZFSE compression */
-		size_t out_cap = in_size + (in_size / 10) + 100; /* Worst case: ~110% + margin */
-		*out_buf = (uint8_t *)malloc (out_cap);
-		if (!*out_buf) {
-			return -1;
-		}
-		z_stream strm = { 0 };
-		if (lzfseInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-			free (*out_buf);
-			*out_buf = NULL;
-			return -1;
-		}
+	{
+		rc = otezip_gzip_serial (&src, out, level, &total_in, &total_out);
+	}
+#else
+	(void)in;
+	(void)out;
+	(void)level;
+	(void)n_threads;
+#endif
+	if (in_len) {
+		*in_len = total_in;
+	}
+	if (out_len) {
+		*out_len = total_out;
+	}
+	return rc;
+}
 
-		strm.next_in = in_buf;
-		strm.avail_in = (unsigned int)in_size;
-		strm.next_out = *out_buf;
-		strm.avail_out = (unsigned int)out_cap;
+/* ----  sidecar index of lazy archives (otezip_write_index)  ---- */
 
-		int ret = lzfseCompress (&strm, Z_FINISH);
-		if (ret != Z_STREAM_END) {
-			/* If compression failed, fall back to STORE */
-			lzfseEnd (&strm);
-			free (*out_buf);
-			*out_buf = NULL;
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
-		}
+/* Header, then the record offset of every entry, then an open-addressing
+ * table of (name hash, index + 1) slots over the exact names, at most
+ * half full. Little endian, like the archive. */
+#define OTEZIP_SIG_INDEX 0x495a544fu /* "OTZI" */
+#define OTEZIP_INDEX_VERSION 1
+#define OTEZIP_INDEX_HEADER 56 /* magic, version, archive size, cd_ofs, cd_size, entries, check, slots */
 
-		*out_size = (uint32_t)strm.total_out;
-		lzfseEnd (&strm);
+/* Part of the directory the header is checked against */
+#define OTEZIP_INDEX_PROBE 4096u
 
-		/* If compression didn't reduce size, fall back to STORE */
-		if (*out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
-		}
-		return 0;
-	}
-#endif
+/* CRC-32 of the first and last bytes of the central directory: cheap
+ * to recompute on open, and changed by anything that rewrites it */
+static uint32_t otezip_index_check(const struct otezip_lazy *lz) {
+	uint64_t n = lz->cd_size < OTEZIP_INDEX_PROBE? lz->cd_size: OTEZIP_INDEX_PROBE;
+	uint32_t crc = otezip_crc32 (0, lz->cd, (size_t)n);
+	return otezip_crc32 (crc, lz->cd + lz->cd_size - n, (size_t)n);
+}
 
-#ifdef OTEZIP_ENABLE_LZMA
-	if (*method == OTEZIP_METHOD_LZMA) {
-		/* LZMA compression */
-		/* Worst-case bound: input size + header + overhead for incompressible data */
-		size_t out_cap = in_size + OTEZIP_LZMA_HEADER_SIZE + (in_size / OTEZIP_LZMA_OVERHEAD_RATIO);
-		*out_buf = (uint8_t *)malloc (out_cap);
-		if (!*out_buf) {
+static uint64_t otezip_index_record(const struct otezip_lazy *lz, zip_uint64_t i) {
+	return otezip_rd64 (lz->index + OTEZIP_INDEX_HEADER + 8 * i);
+}
+
+/* Exact-name lookup through the sidecar; only the candidates with the
+ * same hash are decoded. A damaged table may have no empty slot, so
+ * probing stops after one pass over it. */
+static zip_int64_t otezip_index_locate(zip_t *za, const char *fname) {
+	const struct otezip_lazy *lz = za->lazy;
+	uint64_t mask = otezip_rd64 (lz->index + 48) - 1;
+	const uint8_t *tab = lz->index + OTEZIP_INDEX_HEADER + 8 * za->n_entries;
+	uint32_t hash = otezip_name_hash (fname, 0);
+	uint64_t k = hash & mask;
+	for (uint64_t probes = 0; probes <= mask; probes++, k = (k + 1) & mask) {
+		uint32_t index1 = otezip_rd32 (tab + 8 * k + 4);
+		if (index1 == 0 || index1 > za->n_entries) {
 			return -1;
 		}
-		z_stream strm = { 0 };
-		if (lzmaInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-			free (*out_buf);
-			return -1;
+		if (otezip_rd32 (tab + 8 * k) != hash) {
+			continue;
 		}
-
-		strm.next_in = in_buf;
-		strm.avail_in = (uint32_t)in_size;
-		strm.next_out = *out_buf;
-		strm.avail_out = (uint32_t)out_cap;
-
-		int ret = lzmaCompress (&strm, Z_FINISH);
-		if (ret != Z_STREAM_END) {
-			/* If our minimal LZMA failed for this input, fall back to STORE
-			 * instead of propagating an error. This keeps behavior robust
-			 * for very large or pathological inputs. */
-			lzmaEnd (&strm);
-			free (*out_buf);
-			*out_buf = NULL;
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
+		const struct otezip_entry *e = otezip_entry_get (za, index1 - 1);
+		if (e && strcmp (e->name, fname) == 0) {
+			return (zip_int64_t)index1 - 1;
 		}
+	}
+	return -1;
+}
 
-		*out_size = strm.total_out;
-		lzmaEnd (&strm);
-
-		/* If compression didn't reduce size, fall back to STORE */
-		if (*out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
-		}
+/* Whether some records of a lazy archive are still undecoded */
+static int otezip_lazy_pending(zip_t *za) {
+	if (!za->lazy) {
 		return 0;
 	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_lazy_lock);
 #endif
-#ifdef OTEZIP_ENABLE_BROTLI
-	if (*method == OTEZIP_METHOD_BROTLI) {
-		/* Brotli compression (using vendored upstream implementation via wrappers) */
-		/* in_size > 0 here since zero-size case is handled at function start */
-		size_t out_cap = in_size * 2 + 64;
-		*out_buf = (uint8_t *)malloc (out_cap);
-		if (!*out_buf) {
+	int pending = za->lazy->walked < za->n_entries;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_lazy_lock);
+#endif
+	return pending;
+}
+
+int otezip_write_index(zip_t *za, const char *path) {
+	if (!otezip_is_valid (za) || !za->lazy || !path || za->n_entries >= UINT32_MAX || otezip_entries_all (za) != 0) {
+		return -1;
+	}
+	const struct otezip_lazy *lz = za->lazy;
+	uint64_t n = za->n_entries;
+	uint64_t slots = 16;
+	while (slots / 2 <= n) {
+		slots *= 2;
+	}
+	size_t len = OTEZIP_INDEX_HEADER + 8 * (size_t)n + 8 * (size_t)slots;
+	uint8_t *buf = (uint8_t *)calloc (1, len);
+	if (!buf) {
+		return -1;
+	}
+	otezip_wr32 (buf, OTEZIP_SIG_INDEX);
+	otezip_wr32 (buf + 4, OTEZIP_INDEX_VERSION);
+	otezip_wr64 (buf + 8, za->file_size);
+	otezip_wr64 (buf + 16, lz->cd_ofs);
+	otezip_wr64 (buf + 24, lz->cd_size);
+	otezip_wr64 (buf + 32, n);
+	otezip_wr32 (buf + 40, otezip_index_check (lz));
+	otezip_wr64 (buf + 48, slots);
+	uint8_t *tab = buf + OTEZIP_INDEX_HEADER + 8 * n;
+	uint64_t off = 0;
+	for (uint64_t i = 0; i < n; i++) {
+		size_t rec;
+		if (otezip_cdh_size (lz->cd, lz->cd_size, off, &rec) != 0) {
+			free (buf);
 			return -1;
 		}
-		z_stream strm = { 0 };
-		if (brotliInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-			free (*out_buf);
-			*out_buf = NULL;
-			return -1;
+		otezip_wr64 (buf + OTEZIP_INDEX_HEADER + 8 * i, off);
+		off += rec;
+		/* in index order, so equal names probe lowest index first */
+		uint32_t hash = otezip_name_hash (za->entries[i].name, 0);
+		uint64_t k = hash & (slots - 1);
+		while (otezip_rd32 (tab + 8 * k + 4) != 0) {
+			k = (k + 1) & (slots - 1);
 		}
+		otezip_wr32 (tab + 8 * k, hash);
+		otezip_wr32 (tab + 8 * k + 4, (uint32_t)i + 1);
+	}
+	FILE *fp = fopen (path, "wb");
+	int ok = fp && fwrite (buf, 1, len, fp) == len;
+	if (fp && fclose (fp) != 0) {
+		ok = 0;
+	}
+	free (buf);
+	return ok? 0: -1;
+}
 
-		strm.next_in = in_buf;
-		strm.avail_in = (unsigned int)in_size;
-		strm.next_out = *out_buf;
-		strm.avail_out = (unsigned int)out_cap;
-
-		int ret = brotliCompress (&strm, Z_FINISH);
-		if (ret != Z_STREAM_END) {
-			/* If we ran out of space, grow once and retry */
-			if (ret == Z_OK && strm.avail_out == 0) {
-				size_t used = (size_t)strm.total_out;
-				out_cap *= 2;
-				uint8_t *nb = (uint8_t *)realloc (*out_buf, out_cap);
-				if (!nb) {
-					brotliEnd (&strm);
-					free (*out_buf);
-					*out_buf = NULL;
-					return -1;
-				}
-				*out_buf = nb;
-				strm.next_out = *out_buf + used;
-				strm.avail_out = (unsigned int) (out_cap - used);
-				ret = brotliCompress (&strm, Z_FINISH);
-			}
+int otezip_open_index(zip_t *za, const char *path) {
+	if (!otezip_is_valid (za) || !za->lazy || za->lazy->index || !path) {
+		return -1;
+	}
+	struct otezip_lazy *lz = za->lazy;
+	FILE *fp = fopen (path, "rb");
+	uint64_t size = 0;
+	if (!fp || otezip_fp_size (fp, &size) != 0 || size < OTEZIP_INDEX_HEADER || size > SIZE_MAX) {
+		if (fp) {
+			fclose (fp);
 		}
-		if (ret != Z_STREAM_END) {
-			brotliEnd (&strm);
-			free (*out_buf);
-			*out_buf = NULL;
-			return -1;
+		return -1;
+	}
+	size_t len = (size_t)size;
+	const uint8_t *ix = NULL;
+	int mapped = 0;
+#ifdef OTEZIP_HAVE_MMAP
+	void *p = mmap (NULL, len, PROT_READ, MAP_SHARED, fileno (fp), 0);
+	if (p != MAP_FAILED) {
+		ix = (const uint8_t *)p;
+		mapped = 1;
+	}
+#endif
+	if (!ix) {
+		uint8_t *copy = (uint8_t *)malloc (len);
+		if (copy && (otezip_seek (fp, 0) != 0 || otezip_read_fully (fp, copy, len) != 0)) {
+			free (copy);
+			copy = NULL;
 		}
-		*out_size = (uint32_t)strm.total_out;
-		brotliEnd (&strm);
-
-		/* For empty inputs, Brotli still emits a minimal frame; keep it. */
-		if (in_size > 0 && *out_size >= in_size) {
-			free (*out_buf);
-			*method = OTEZIP_METHOD_STORE;
-			return otezip_compress_data (in_buf, in_size, out_buf, out_size, method);
+		ix = copy;
+	}
+	fclose (fp);
+	if (!ix) {
+		return -1;
+	}
+	/* the header must describe this very directory, with a power of two
+	 * slots and more of them than entries; otherwise lookups keep
+	 * walking the central directory */
+	uint64_t n = otezip_rd64 (ix + 32);
+	uint64_t slots = otezip_rd64 (ix + 48);
+	int ok = otezip_rd32 (ix) == OTEZIP_SIG_INDEX && otezip_rd32 (ix + 4) == OTEZIP_INDEX_VERSION;
+	ok = ok && otezip_rd64 (ix + 8) == za->file_size && otezip_rd64 (ix + 16) == lz->cd_ofs && otezip_rd64 (ix + 24) == lz->cd_size;
+	ok = ok && n == za->n_entries && slots > n && (slots & (slots - 1)) == 0 && slots <= (size - OTEZIP_INDEX_HEADER) / 8;
+	ok = ok && size == OTEZIP_INDEX_HEADER + 8 * n + 8 * slots && otezip_rd32 (ix + 40) == otezip_index_check (lz);
+	if (!ok) {
+#ifdef OTEZIP_HAVE_MMAP
+		if (mapped) {
+			munmap ((void *)ix, len);
+		} else
+#endif
+		{
+			free ((void *)ix);
 		}
-		return 0;
+		return -1;
 	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_lazy_lock);
 #endif
+	lz->index = ix;
+	lz->index_len = len;
+	lz->index_mapped = mapped;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_lazy_lock);
+#endif
+	return 0;
+}
 
-	/* Unsupported method or none of the above */
-	return -1;
+zip_uint64_t zip_get_num_files(zip_t *za) {
+	return za? za->n_entries: 0u;
 }
 
-/* Add file to ZIP archive */
-zip_int64_t zip_file_add(zip_t *za, const char *name, zip_source_t *src, zip_flags_t flags) {
-	(void)flags;
-	if (!za || !name || !src || za->mode != 1) {
+/* Honors ZIP_FL_NOCASE (ASCII case-insensitive) and ZIP_FL_NODIR (ignore
+ * the directory part of entry names); other flags are ignored. */
+zip_int64_t zip_name_locate(zip_t *za, const char *fname, zip_flags_t flags) {
+	if (!otezip_is_valid (za) || !fname) {
+		return -1;
+	}
+	flags &= OTEZIP_NAME_FLAGS;
+	/* lazy archives: through the sidecar, or record by record until
+	 * every name has been seen once */
+	if (otezip_lazy_pending (za)) {
+		if (za->lazy->index && flags == 0) {
+			return otezip_index_locate (za, fname);
+		}
+		for (zip_uint64_t i = 0; i < za->n_entries; i++) {
+			const struct otezip_entry *e = otezip_entry_get (za, i);
+			if (!e) {
+				return -1;
+			}
+			if (otezip_name_equal (otezip_name_key (e->name, flags), fname, flags)) {
+				return (zip_int64_t)i;
+			}
+		}
 		return -1;
 	}
-	/* Allocate a new entry */
-	struct otezip_entry *new_entries;
-	new_entries = realloc (za->entries, (za->n_entries + 1) * sizeof (struct otezip_entry));
-	if (!new_entries) {
+	struct otezip_name_table *t = otezip_names_table (za, flags);
+	if (t) {
+		uint32_t hash = otezip_name_hash (fname, flags);
+		for (size_t i = hash & t->mask; t->slots[i].index1; i = (i + 1) & t->mask) {
+			if (t->slots[i].hash != hash) {
+				continue;
+			}
+			zip_uint64_t idx = t->slots[i].index1 - 1;
+			if (otezip_name_equal (otezip_name_key (za->entries[idx].name, flags), fname, flags)) {
+				return (zip_int64_t)idx;
+			}
+		}
 		return -1;
 	}
-	za->entries = new_entries;
 
-	/* Set up the new entry */
-	struct otezip_entry *e = &za->entries[za->n_entries];
-	memset (e, 0, sizeof (struct otezip_entry));
+	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
+		if (otezip_name_equal (otezip_name_key (za->entries[i].name, flags), fname, flags)) {
+			return (zip_int64_t)i;
+		}
+	}
+	return -1;
+}
 
-	/* strdup is POSIX; allocate and copy to be portable and avoid
-	 * implicit declaration warnings. */
-	size_t nlen = strlen (name) + 1;
-	if (nlen - 1 > OTEZIP_MAX_FIELD_LEN) {
-		return -1;
+/* Size of the compressed-input window used by streaming reads */
+#define OTEZIP_STREAM_CHUNK (64u * 1024u)
+
+/* Check the running CRC once the whole entry has been returned.
+ * Returns -1 when the mismatch must be reported as a read error. */
+static int otezip_stream_check_crc(zip_file_t *zf) {
+	if (zf->crc == zf->crc_expected) {
+		return 0;
 	}
-	e->name = (char *)malloc (nlen);
-	if (!e->name) {
+	if (otezip_verify_crc) {
 		return -1;
 	}
-	memcpy (e->name, name, nlen);
+	fprintf (stderr, "Warning: CRC mismatch for '%s' (expected 0x%08x, got 0x%08x)\n", zf->name? zf->name: "<unknown>", zf->crc_expected, zf->crc);
+	return 0;
+}
 
-	/* Use the default compression method if set, otherwise store */
-	if (za->default_method > 0) {
-		e->method = za->default_method;
-	} else {
-		/* Store uncompressed by default */
-		e->method = 0;
+/* Mapped archives feed the decoder in place, up to this much at a time
+ * since avail_in is 32-bit */
+#define OTEZIP_MAP_CHUNK (1u << 30)
+
+/* Refill the compressed-input window from the archive */
+static int otezip_stream_fill(zip_file_t *zf, z_stream *strm) {
+	if (zf->za->map) {
+		uint32_t n = zf->comp_left < OTEZIP_MAP_CHUNK? (uint32_t)zf->comp_left: OTEZIP_MAP_CHUNK;
+		strm->next_in = zf->za->map + zf->comp_ofs;
+		strm->avail_in = n;
+		zf->comp_ofs += n;
+		zf->comp_left -= n;
+		return 0;
 	}
-
-	/* Validate uncompressed size fits our limits and ZIP 32-bit field */
-	if ((uint64_t)src->len > OTEZIP_MAX_PAYLOAD || (uint64_t)src->len > (uint64_t)UINT32_MAX) {
-		free (e->name);
+	uint32_t n = zf->comp_left < OTEZIP_STREAM_CHUNK? (uint32_t)zf->comp_left: OTEZIP_STREAM_CHUNK;
+	if (otezip_pread (zf->za, zf->inbuf, n, zf->comp_ofs) != 0) {
 		return -1;
 	}
-	e->uncomp_size = (uint32_t)src->len;
+	zf->comp_ofs += n;
+	zf->comp_left -= n;
+	strm->next_in = zf->inbuf;
+	strm->avail_in = n;
+	return 0;
+}
 
-	/* Calculate CRC-32 of the uncompressed data */
-	e->crc32 = otezip_crc32 (0, src->buf, src->len);
+/* Restart the decoder at the start of the entry */
+static void otezip_seek_rewind(zip_file_t *zf, z_stream *strm) {
+	((struct otezip_zctx *)zf->strm)->be->dec_reset (strm);
+	strm->avail_in = 0;
+	zf->comp_ofs = zf->data_ofs;
+	zf->comp_left = zf->za->entries[zf->index].comp_size;
+	zf->pos = 0;
+	zf->eof = 0;
+}
 
-	/* Set current time for file timestamp */
-	otezip_get_dostime (&e->file_time, &e->file_date);
+/* ----  deflate access points (otezip_set_seek_span)  ---- */
 
-	/* Set default permissions: 0644 for files */
-	e->external_attr = 0100644 << 16; /* S_IFREG | 0644 << 16 */
+#ifdef OTEZIP_ENABLE_DEFLATE
+#ifdef OTEZIP_HAVE_PTHREAD
+/* guards every za->seekpoints list and the points in it */
+static pthread_mutex_t otezip_seek_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
-	/* Get current position for local header offset */
-	long current_pos = ftell (za->fp);
-	if (current_pos < 0) {
-		free (e->name);
-		return -1;
+/* Find or start the access points of the entry zf reads */
+static void otezip_seek_attach(zip_t *za, zip_file_t *zf) {
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_seek_lock);
+#endif
+	struct otezip_seekpoints *sp = za->seekpoints;
+	while (sp && sp->index != zf->index) {
+		sp = sp->next;
 	}
+	if (!sp) {
+		sp = (struct otezip_seekpoints *)calloc (1, sizeof (*sp));
+		if (sp) {
+			sp->index = zf->index;
+			sp->next = za->seekpoints;
+			za->seekpoints = sp;
+		}
+	}
+	zf->points = sp;
+	zf->collect = sp && !sp->complete;
+	zf->seek_due = (sp && sp->n? sp->pt[sp->n - 1].out: 0) + za->seek_span;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_seek_lock);
+#endif
+}
 
-	/* Ensure local header offset fits into ZIP 32-bit field */
-	if ((uint64_t)current_pos > (uint64_t)UINT32_MAX) {
-		free (e->name);
-		return -1;
+/* inflate stopped at a block boundary with out bytes of the entry
+ * decoded: record it if a point is due. Out of memory only ends the
+ * recording. */
+static void otezip_seek_record(zip_file_t *zf, z_stream *strm, uint64_t out) {
+	if (out < zf->seek_due) {
+		return;
+	}
+	/* bits taken from the input but not used yet are still buffered */
+	uint64_t consumed = zf->comp_ofs - zf->data_ofs - strm->avail_in;
+	uint64_t bit = consumed * 8 - (uint64_t)(strm->data_type & 63);
+	struct otezip_seekpoints *sp = zf->points;
+	uint8_t *window = (uint8_t *)malloc (32768);
+	uInt have = 0;
+	if (!window || inflateGetDictionary (strm, window, &have) != Z_OK) {
+		free (window);
+		zf->collect = 0;
+		return;
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_seek_lock);
+#endif
+	uint64_t last = sp->n? sp->pt[sp->n - 1].out: 0;
+	/* another reader of the entry may have got here first */
+	if (out >= last + zf->za->seek_span) {
+		if (sp->n == sp->cap) {
+			size_t cap = sp->cap? sp->cap * 2: 16;
+			struct otezip_seekpoint *pt = (struct otezip_seekpoint *)realloc (sp->pt, cap * sizeof (*pt));
+			if (pt) {
+				sp->pt = pt;
+				sp->cap = cap;
+			}
+		}
+		if (sp->n < sp->cap) {
+			struct otezip_seekpoint *p = &sp->pt[sp->n++];
+			p->out = out;
+			p->bit = bit;
+			p->have = have;
+			p->window = window;
+			window = NULL;
+			last = out;
+		} else {
+			zf->collect = 0;
+		}
 	}
-	e->local_hdr_ofs = (uint32_t)current_pos;
+	zf->seek_due = last + zf->za->seek_span;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_seek_lock);
+#endif
+	free (window);
+}
 
-	/* Compress the data using the selected method */
-	uint8_t *comp_buf = NULL;
-	uint32_t comp_size = 0;
+/* zf decoded its entry to the end: every point there is to record is */
+static void otezip_seek_complete(zip_file_t *zf) {
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_seek_lock);
+#endif
+	zf->points->complete = 1;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_seek_lock);
+#endif
+	zf->collect = 0;
+}
 
-	/* Compress the data using the selected method */
-	if (otezip_compress_data ((uint8_t *)src->buf, src->len, &comp_buf, &comp_size, &e->method) != 0) {
-		free (e->name);
-		return -1;
+/* Move the decoder to the last access point at or before target when
+ * that is closer to target than decoding on from pos.
+ * Returns 1 if it moved, 0 if not and -1 on error. */
+static int otezip_seek_restore(zip_file_t *zf, z_stream *strm, uint64_t target) {
+	if (!zf->points) {
+		return 0;
+	}
+	const struct otezip_seekpoints *sp = zf->points;
+	uint64_t out = 0;
+	uint64_t bit = 0;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_lock (&otezip_seek_lock);
+#endif
+	size_t lo = 0;
+	size_t hi = sp->n;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (sp->pt[mid].out <= target) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	const struct otezip_seekpoint *p = lo? &sp->pt[lo - 1]: NULL;
+	if (p && (p->out > zf->pos || target < zf->pos)) {
+		out = p->out;
+		bit = p->bit;
+		otezip_seek_rewind (zf, strm);
+		inflateSetDictionary (strm, p->window, p->have);
+	}
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_unlock (&otezip_seek_lock);
+#endif
+	if (out == 0) {
+		return 0;
+	}
+	/* resume mid-byte: the rest of that byte goes in ahead of the input */
+	uint64_t byte = bit >> 3;
+	int rem = (int)(bit & 7);
+	if (rem) {
+		uint8_t b;
+		if (otezip_pread (zf->za, &b, 1, zf->data_ofs + byte) != 0) {
+			return -1;
+		}
+		inflatePrime (strm, 8 - rem, b >> rem);
+		byte++;
 	}
+	zf->comp_ofs += byte;
+	zf->comp_left -= byte;
+	zf->pos = out;
+	return 1;
+}
+#endif
 
-	/* Validate compressed size too */
-	if ((uint64_t)comp_size > OTEZIP_MAX_PAYLOAD) {
-		free (e->name);
-		free (comp_buf);
+/* Set up on-demand decoding for methods with a resumable decoder.
+ * Returns 1 if the entry is streamed, 0 if it must be buffered, -1 on error. */
+static int otezip_stream_open(zip_t *za, struct otezip_entry *e, zip_file_t *zf) {
+	const otezip_codec_t *sc;
+	if (0) {
+	}
+#ifdef OTEZIP_ENABLE_STORE
+	else if (e->method == OTEZIP_METHOD_STORE) {
+		if (e->comp_size != e->uncomp_size) {
+			return -1;
+		}
+	}
+#endif
+	else if ((sc = otezip_stream_codec (e->method)) != NULL) {
+		/* the decoder state of an earlier entry is reset and reused */
+		void *ctx;
+		if (otezip_codec_acquire (za, sc, 0, &ctx) != 0) {
+			return -1;
+		}
+		/* a mapped archive feeds the decoder in place, no input window */
+		zf->inbuf = za->map? NULL: (uint8_t *)malloc (OTEZIP_STREAM_CHUNK);
+		if ((!za->map && !zf->inbuf) || otezip_zcodec_start ((struct otezip_zctx *)ctx, 0) != 0) {
+			free (zf->inbuf);
+			zf->inbuf = NULL;
+			otezip_codec_end (sc, ctx);
+			return -1;
+		}
+		zf->strm = &((struct otezip_zctx *)ctx)->strm;
+		zf->stream_codec = sc;
+	} else {
+		return 0; /* Brotli, LZFSE and registered codecs decode whole entries */
+	}
+	uint64_t data_ofs;
+	if (otezip_entry_data_offset (za, e, &data_ofs) != 0) {
 		return -1;
 	}
-	e->comp_size = comp_size;
-
-	/* Write local file header */
-	otezip_write_local_header (za->fp, e->name, e->method, e->comp_size, e->uncomp_size, e->crc32);
-
-	/* Write compressed data */
-	fwrite (comp_buf, 1, comp_size, za->fp);
-	free (comp_buf);
-
-	/* Free source data if requested */
-	if (src->freep) {
-		free ((void *)src->buf);
+	zf->data_ofs = data_ofs;
+	zf->comp_ofs = data_ofs;
+	zf->comp_left = e->comp_size;
+#ifdef OTEZIP_ENABLE_DEFLATE
+	if (zf->strm && e->method == OTEZIP_METHOD_DEFLATE && za->mode == 0 && za->seek_span > 0 && e->uncomp_size > za->seek_span) {
+		otezip_seek_attach (za, zf);
 	}
-	free (src);
-
-	/* Increment entry count */
-	zip_uint64_t index = za->n_entries;
-	za->n_entries++;
-	za->next_index = za->n_entries;
-
-	return (zip_int64_t)index;
+#endif
+	if (za->map && !zf->strm) {
+		/* stored: hand out a view of the mapping instead of copying */
+		zf->data = (uint8_t *)za->map + data_ofs;
+		zf->borrowed = 1;
+		zf->comp_left = 0;
+	}
+	return 1;
 }
 
-/* Set file compression method */
-int zip_set_file_compression(zip_t *za, zip_uint64_t index, zip_int32_t comp, zip_uint32_t comp_flags) {
-	(void)comp_flags;
+zip_file_t *zip_fopen_index(zip_t *za, zip_uint64_t index, zip_flags_t flags) {
+	(void)flags;
+	struct otezip_entry *e = otezip_is_valid (za) && index < za->n_entries? otezip_entry_get (za, index): NULL;
+	if (!e) {
+		return NULL;
+	}
+	zip_file_t *zf = (zip_file_t *)calloc (1, sizeof (zip_file_t));
+	if (!zf) {
+		return NULL;
+	}
+	zf->za = za;
+	zf->method = e->method;
+	zf->size = e->uncomp_size;
+	zf->crc_expected = e->crc32;
+	zf->name = e->name;
+	zf->index = index;
+	int rc = otezip_stream_open (za, e, zf);
+	if (rc < 0) {
+		zip_fclose (zf);
+		return NULL;
+	}
+	if (rc == 0) {
+		uint8_t *buf = NULL;
+		uint64_t sz = 0;
+		if (otezip_extract_entry (za, e, &buf, &sz) != 0) {
+			free (zf);
+			return NULL;
+		}
+		zf->data = buf;
+		zf->size = sz;
+	}
+	return zf;
+}
 
-	if (!otezip_is_valid (za) || index >= za->n_entries || za->mode != 1) {
+int zip_fclose(zip_file_t *zf) {
+	if (!zf) {
 		return -1;
 	}
-
-	/* Check if the requested compression method is supported */
-#ifdef OTEZIP_ENABLE_STORE
-	if (comp == OTEZIP_METHOD_STORE) {
-		/* Store is always supported */
+	/* streamed entries are reported once done with; a stream that was
+	 * set up has comp_ofs past the local header */
+	if ((!zf->data || zf->borrowed) && zf->comp_ofs > 0 && otezip_observed (zf->za)) {
+		struct otezip_entry *e = &zf->za->entries[zf->index];
+		otezip_count_codec (zf->za, zf->method, 0, e->comp_size, zf->pos, zf->codec_ns);
+		otezip_fire_event (zf->za, OTEZIP_EVENT_DECOMPRESS, e, zf->index, zf->busy_ns);
 	}
-#endif
+	if (zf->strm) {
+		/* strm is the first member of its context */
+		otezip_codec_release (zf->za, zf->stream_codec, 0, zf->strm);
+	}
+	free (zf->inbuf);
+	free (zf->scratch);
+	if (!zf->borrowed) {
+		free (zf->data);
+	}
+	free (zf);
+	return 0;
+}
+
+/* Decode up to nbytes that follow pos into buf. While access points
+ * are being recorded inflate stops at every block boundary. */
+static zip_int64_t otezip_stream_decode(zip_file_t *zf, uint8_t *buf, zip_uint64_t nbytes) {
+	z_stream *strm = (z_stream *)zf->strm;
+	const struct otezip_zbackend *be = ((struct otezip_zctx *)zf->strm)->be;
+	uint64_t t0 = otezip_clock (zf->za);
+	uint64_t io_ns = 0;
+	zip_uint64_t done = 0;
+	while (done < nbytes && !zf->eof) {
+		if (strm->avail_in == 0 && zf->comp_left > 0) {
+			uint64_t t1 = otezip_clock (zf->za);
+			if (otezip_stream_fill (zf, strm) != 0) {
+				return -1;
+			}
+			io_ns += otezip_since (zf->za, t1);
+		}
+		zip_uint64_t want = nbytes - done;
+		strm->next_out = buf + done;
+		strm->avail_out = want > UINT32_MAX? UINT32_MAX: (uInt)want;
+		uInt before = strm->avail_out;
+		/* LZMA holds back its last input bytes until told none follow */
+		int flush = zf->collect? Z_BLOCK: (zf->comp_left == 0 && zf->method != OTEZIP_METHOD_DEFLATE)? Z_FINISH: Z_NO_FLUSH;
+		int ret = be->dec_run (strm, flush);
+		done += before - strm->avail_out;
+		if (ret == Z_STREAM_END) {
+			zf->eof = 1;
+		} else if (ret == Z_BUF_ERROR) {
+			if (strm->avail_in > 0 || zf->comp_left == 0) {
+				return -1; /* truncated or undecodable stream */
+			}
+		} else if (ret != Z_OK) {
+			return -1;
+		}
 #ifdef OTEZIP_ENABLE_DEFLATE
-	else if (comp == OTEZIP_METHOD_DEFLATE) {
-		/* Deflate is supported */
-	}
+		if (zf->collect && (strm->data_type & 128)) {
+			otezip_seek_record (zf, strm, zf->pos + done);
+		}
 #endif
-#ifdef OTEZIP_ENABLE_ZSTD
-	else if (comp == OTEZIP_METHOD_ZSTD) {
-		/* Zstd is supported */
 	}
-#endif
-#ifdef OTEZIP_ENABLE_LZFSE
-	else if (comp == OTEZIP_METHOD_LZFSE) {
-		/* LZFSE is supported */
+	if (zf->eof && zf->pos + done < zf->size) {
+		return -1; /* stream ended before the declared size */
 	}
-#endif
-#ifdef OTEZIP_ENABLE_LZ4
-	else if (comp == OTEZIP_METHOD_LZ4) {
-		/* LZ4 is supported */
+#ifdef OTEZIP_ENABLE_DEFLATE
+	if (zf->eof && zf->collect) {
+		otezip_seek_complete (zf);
 	}
 #endif
-#ifdef OTEZIP_ENABLE_LZMA
-	else if (comp == OTEZIP_METHOD_LZMA) {
-		/* LZMA is supported */
+	zf->codec_ns += otezip_since (zf->za, t0) - io_ns;
+	return (zip_int64_t)done;
+}
+
+/* Decode up to nbytes of a streamed entry into buf */
+static zip_int64_t otezip_stream_read(zip_file_t *zf, uint8_t *buf, zip_uint64_t nbytes) {
+	zip_uint64_t remaining = zf->size - zf->pos;
+	if (nbytes > remaining) {
+		nbytes = remaining;
 	}
-#endif
-#ifdef OTEZIP_ENABLE_BROTLI
-	else if (comp == OTEZIP_METHOD_BROTLI) {
-		/* Brotli is supported */
+	zip_uint64_t done = 0;
+	if (!zf->strm) {
+		/* stored: read straight from the archive into the caller's buffer */
+		if (nbytes > 0) {
+			if (otezip_pread (zf->za, buf, (size_t)nbytes, zf->comp_ofs) != 0) {
+				return -1;
+			}
+			zf->comp_ofs += nbytes;
+			zf->comp_left -= nbytes;
+		}
+		done = nbytes;
 	}
-#endif
 	else {
-		/* Unsupported compression method */
+		zip_int64_t got = otezip_stream_decode (zf, buf, nbytes);
+		if (got < 0) {
+			return -1;
+		}
+		done = (zip_uint64_t)got;
+	}
+	if (!zf->unchecked) {
+		zf->crc = otezip_crc32_za (zf->za, zf->crc, buf, (size_t)done);
+	}
+	zf->pos += done;
+	if (zf->pos == zf->size && done > 0 && !zf->unchecked && otezip_stream_check_crc (zf) != 0) {
 		return -1;
 	}
-
-	/* Set the method for next files that will be added */
-	za->entries[index].method = (uint16_t)comp;
-	return 0;
+	return (zip_int64_t)done;
 }
 
-/* Finalize ZIP file before closing - write central directory */
-static int otezip_finalize_archive(zip_t *za) {
-	if (!otezip_is_valid (za) || !za->fp || za->mode != 1) {
+zip_int64_t zip_fread(zip_file_t *zf, void *buf, zip_uint64_t nbytes) {
+	if (!zf || !buf) {
 		return -1;
 	}
-	/* Get offset for central directory */
-	long cd_offset = ftell (za->fp);
-	if (cd_offset < 0) {
-		return -1;
+	if (!zf->data) {
+		uint64_t t0 = otezip_clock (zf->za);
+		zip_int64_t got = otezip_stream_read (zf, (uint8_t *)buf, nbytes);
+		zf->busy_ns += otezip_since (zf->za, t0);
+		return got;
 	}
-	/* Write central directory headers. Accumulate in 64-bit and ensure
-	 * the final size and offset fit into the 32-bit EOCD fields before
-	 * writing them. */
-	uint64_t cd_size_acc = 0;
-	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
-		struct otezip_entry *e = &za->entries[i];
-		uint32_t written = otezip_write_central_header (za->fp, e->name, e->method, e->comp_size, e->uncomp_size, e->crc32, e->local_hdr_ofs, e->file_time, e->file_date, e->external_attr);
-		cd_size_acc += written;
-		if (cd_size_acc > (uint64_t)UINT32_MAX) {
-			/* central directory too large for ZIP32 EOCD */
+	if (zf->pos >= zf->size) {
+		return 0;
+	}
+	zip_uint64_t remaining = zf->size - zf->pos;
+	zip_uint64_t to_copy = (nbytes < remaining)? nbytes: remaining;
+	uint64_t t0 = zf->borrowed? otezip_clock (zf->za): 0;
+	memcpy (buf, (uint8_t *)zf->data + zf->pos, to_copy);
+	zf->pos += to_copy;
+	if (zf->borrowed && !zf->unchecked) {
+		/* views into the mapping were not checked when opened */
+		zf->crc = otezip_crc32_za (zf->za, zf->crc, buf, (size_t)to_copy);
+		zf->busy_ns += otezip_since (zf->za, t0);
+		if (zf->pos == zf->size && otezip_stream_check_crc (zf) != 0) {
 			return -1;
 		}
 	}
+	return (zip_int64_t)to_copy;
+}
 
-	/* Ensure central directory offset fits into 32-bit */
-	if ((uint64_t)cd_offset > (uint64_t)UINT32_MAX) {
-		return -1;
+/* Decode the n bytes that follow pos and drop them */
+static int otezip_stream_skip(zip_file_t *zf, zip_uint64_t n) {
+	if (!zf->scratch) {
+		zf->scratch = (uint8_t *)malloc (OTEZIP_STREAM_CHUNK);
+		if (!zf->scratch) {
+			return -1;
+		}
+	}
+	while (n > 0) {
+		zip_int64_t got = otezip_stream_decode (zf, zf->scratch, n < OTEZIP_STREAM_CHUNK? n: OTEZIP_STREAM_CHUNK);
+		if (got <= 0) {
+			return -1;
+		}
+		zf->pos += (zip_uint64_t)got;
+		n -= (zip_uint64_t)got;
 	}
-
-	/* Write end of central directory record */
-	otezip_write_end_of_central_directory (za->fp, (uint32_t)za->n_entries, (uint32_t)cd_size_acc, (uint32_t)cd_offset);
 	return 0;
 }
 
-int zip_close(zip_t *za) {
-	if (!otezip_is_valid (za)) {
-		free (za);
+zip_int8_t zip_fseek(zip_file_t *zf, zip_int64_t offset, int whence) {
+	if (!zf) {
 		return -1;
 	}
-	/* Finalize archive if in write mode */
-	if (za->mode == 1) {
-		otezip_finalize_archive (za);
+	zip_uint64_t base;
+	switch (whence) {
+	case SEEK_SET:
+		base = 0;
+		break;
+	case SEEK_CUR:
+		base = zf->pos;
+		break;
+	case SEEK_END:
+		base = zf->size;
+		break;
+	default:
+		return -1;
 	}
-
-	if (za->fp) {
-		fclose (za->fp);
+	/* wraps past base when a negative offset reaches before 0 */
+	zip_uint64_t target = base + (zip_uint64_t)offset;
+	if ((offset < 0)? target > base: (target < base || target > zf->size)) {
+		return -1;
+	}
+	if (target == zf->pos) {
+		return 0;
+	}
+	if (zf->data) {
+		zf->pos = target;
+	} else if (!zf->strm) {
+		/* stored: the next read starts at the new offset */
+		zf->comp_ofs = zf->data_ofs + target;
+		zf->comp_left = zf->size - target;
+		zf->pos = target;
 	}
-	zip_uint64_t i;
-	for (i = 0; i < za->n_entries; i++) {
-		if (za->entries[i].name) {
-			free (za->entries[i].name);
+	else {
+		z_stream *strm = (z_stream *)zf->strm;
+#ifdef OTEZIP_ENABLE_DEFLATE
+		int moved = otezip_seek_restore (zf, strm, target);
+		if (moved < 0) {
+			return -1;
+		}
+#else
+		int moved = 0;
+#endif
+		if (!moved && target < zf->pos) {
+			otezip_seek_rewind (zf, strm);
+		}
+		if (otezip_stream_skip (zf, target - zf->pos) != 0) {
+			/* the decoder state is lost: start over on the next seek */
+			otezip_seek_rewind (zf, strm);
+			zf->unchecked = 1;
+			return -1;
 		}
 	}
-	free (za->entries);
-	free (za);
+	zf->crc = 0;
+	zf->unchecked = target != 0;
 	return 0;
 }
 
-zip_uint64_t zip_get_num_files(zip_t *za) {
-	return za? za->n_entries: 0u;
+zip_int64_t zip_ftell(zip_file_t *zf) {
+	return zf? (zip_int64_t)zf->pos: -1;
 }
 
-zip_int64_t zip_name_locate(zip_t *za, const char *fname, zip_flags_t flags) {
-	(void)flags; /* flags (case sensitivity etc.) not implemented */
-	if (!otezip_is_valid (za) || !fname) {
-		return -1;
+/* Buffer of the otezip_fcopy_fd fallback, and the most one kernel copy moves */
+#define OTEZIP_COPY_CHUNK (1u << 20)
+#define OTEZIP_COPY_MAX (1u << 30)
+
+static int otezip_write_fd(int fd, const uint8_t *p, size_t n) {
+	while (n > 0) {
+		size_t k = n < OTEZIP_COPY_MAX? n: OTEZIP_COPY_MAX;
+		ssize_t w = write (fd, p, (unsigned int)k);
+		if (w < 0 && errno == EINTR) {
+			continue;
+		}
+		if (w <= 0) {
+			return -1;
+		}
+		p += w;
+		n -= (size_t)w;
 	}
+	return 0;
+}
 
-	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
-		if (strcmp (za->entries[i].name, fname) == 0) {
-			return (zip_int64_t)i;
+#if defined(OTEZIP_HAVE_COPY_FILE_RANGE) || defined(OTEZIP_HAVE_SENDFILE)
+/* Copy the rest of a stored entry from the archive file to fd in the
+ * kernel: copy_file_range, which file systems may turn into a reflink,
+ * then sendfile. Returns 0 when done, 1 when neither works for these
+ * files (the caller copies what is left) and -1 on error. */
+static int otezip_copy_kernel(zip_file_t *zf, int fd) {
+	zip_t *za = zf->za;
+	if (za->mode == 1 && fflush (za->fp) != 0) {
+		return -1;
+	}
+	int in = fileno (za->fp);
+#ifdef OTEZIP_HAVE_COPY_FILE_RANGE
+	int use_range = 1;
+#endif
+	while (zf->pos < zf->size) {
+		uint64_t t0 = otezip_clock (za);
+		zip_uint64_t left = zf->size - zf->pos;
+		size_t n = left < OTEZIP_COPY_MAX? (size_t)left: OTEZIP_COPY_MAX;
+		off_t ofs = (off_t)(zf->data_ofs + zf->pos);
+		ssize_t r;
+#ifdef OTEZIP_HAVE_COPY_FILE_RANGE
+		if (use_range) {
+			r = copy_file_range (in, &ofs, fd, NULL, n, 0);
+			/* across file systems on older kernels, special files, O_APPEND */
+			if (r < 0 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP || errno == EBADF)) {
+				use_range = 0;
+				continue;
+			}
+		} else
+#endif
+		{
+#ifdef OTEZIP_HAVE_SENDFILE
+			r = sendfile (fd, in, &ofs, n);
+			if (r < 0 && (errno == EINVAL || errno == ENOSYS)) {
+				return 1;
+			}
+#else
+			return 1;
+#endif
+		}
+		if (r < 0 && errno == EINTR) {
+			continue;
+		}
+		if (r <= 0) {
+			return -1; /* r == 0: the archive is shorter than the entry */
+		}
+		otezip_count_io (za, 0, (uint64_t)r, otezip_since (za, t0));
+		zf->pos += (zip_uint64_t)r;
+		if (!zf->data) {
+			zf->comp_ofs += (uint64_t)r;
+			zf->comp_left -= (uint64_t)r;
 		}
 	}
-	return -1;
+	return 0;
 }
+#endif
 
-zip_file_t *zip_fopen_index(zip_t *za, zip_uint64_t index, zip_flags_t flags) {
-	(void)flags;
-	if (!otezip_is_valid (za) || index >= za->n_entries) {
-		return NULL;
+zip_int64_t otezip_fcopy_fd(zip_file_t *zf, int fd) {
+	if (!zf || fd < 0) {
+		return -1;
 	}
-	uint8_t *buf = NULL;
-	uint32_t sz = 0;
-	if (otezip_extract_entry (za, &za->entries[index], &buf, &sz) != 0) {
-		return NULL;
+	zip_uint64_t start = zf->pos;
+	uint64_t t0 = otezip_clock (zf->za);
+	int rc = 1; /* 1: still to copy */
+#if defined(OTEZIP_HAVE_COPY_FILE_RANGE) || defined(OTEZIP_HAVE_SENDFILE)
+	/* no CRC to check: stored data never has to be looked at */
+	if (zf->method == OTEZIP_METHOD_STORE && !zf->strm && (!zf->data || zf->borrowed) && !otezip_verify_crc && !zf->za->mem) {
+		rc = otezip_copy_kernel (zf, fd);
 	}
-	zip_file_t *zf = (zip_file_t *)malloc (sizeof (zip_file_t));
-	if (!zf) {
+#endif
+	if (rc == 1 && zf->data) {
+		/* decoded whole, or a view of the mapping: write it in place */
+		const uint8_t *p = zf->data + zf->pos;
+		size_t n = (size_t)(zf->size - zf->pos);
+		rc = otezip_write_fd (fd, p, n);
+		if (rc == 0 && zf->borrowed && !zf->unchecked) {
+			zf->crc = otezip_crc32_za (zf->za, zf->crc, p, n);
+		}
+		zf->pos = zf->size;
+		if (rc == 0 && zf->borrowed && !zf->unchecked && n > 0 && otezip_stream_check_crc (zf) != 0) {
+			rc = -1;
+		}
+	}
+	if (rc == 1) {
+		uint8_t *buf = (uint8_t *)malloc (OTEZIP_COPY_CHUNK);
+		rc = buf? 0: -1;
+		while (rc == 0 && zf->pos < zf->size) {
+			zip_int64_t got = otezip_stream_read (zf, buf, OTEZIP_COPY_CHUNK);
+			rc = (got <= 0 || otezip_write_fd (fd, buf, (size_t)got) != 0)? -1: 0;
+		}
 		free (buf);
-		return NULL;
 	}
-	zf->data = buf;
-	zf->size = sz;
-	zf->pos = 0;
-	return zf;
+	zf->busy_ns += otezip_since (zf->za, t0);
+	return rc == 0? (zip_int64_t)(zf->pos - start): -1;
 }
 
-int zip_fclose(zip_file_t *zf) {
+/* ----  integrity tests (otezip_test_archive)  ---- */
+
+/* Decode entry index, OTEZIP_STREAM_CHUNK bytes at a time into scratch
+ * when it streams, and check its size and CRC. The CRC is computed here
+ * rather than by the stream, so a mismatch is reported, not warned
+ * about or subject to otezip_verify_crc. */
+static void otezip_test_entry(zip_t *za, zip_uint64_t index, uint8_t *scratch, otezip_test_result_t *r) {
+	memset (r, 0, sizeof (*r));
+	r->index = index;
+	struct otezip_entry *e = otezip_entry_get (za, index);
+	zip_file_t *zf = e? (zip_file_t *)calloc (1, sizeof (zip_file_t)): NULL;
 	if (!zf) {
-		return -1;
+		r->error = ZIP_ER_INCONS;
+		return;
+	}
+	r->name = e->name;
+	const otezip_codec_t *codec = otezip_get_codec (e->method);
+	if (!codec || !codec->decompress) {
+		free (zf);
+		r->error = ZIP_ER_COMPNOTSUPP;
+		return;
+	}
+	zf->za = za;
+	zf->method = e->method;
+	zf->size = e->uncomp_size;
+	zf->crc_expected = e->crc32;
+	zf->name = e->name;
+	zf->index = index;
+	zf->unchecked = 1;
+	uint32_t crc = 0;
+	uint64_t size = 0;
+	int rc = otezip_stream_open (za, e, zf);
+	if (rc == 0) {
+		/* decoded whole, then dropped */
+		uint64_t t0 = otezip_clock (za);
+		uint8_t *buf;
+		if (otezip_decode_entry (za, e, &buf) == 0) {
+			crc = otezip_crc32_za (za, 0, buf, (size_t)e->uncomp_size);
+			size = e->uncomp_size;
+			free (buf);
+			otezip_fire_event (za, OTEZIP_EVENT_DECOMPRESS, e, index, otezip_since (za, t0));
+		} else {
+			rc = -1;
+		}
+	} else if (rc == 1 && zf->data) {
+		/* stored, a view of the mapping */
+		crc = otezip_crc32_za (za, 0, zf->data, (size_t)zf->size);
+		size = zf->size;
+		zf->pos = zf->size;
+	} else if (rc == 1) {
+		uint64_t t0 = otezip_clock (za);
+		zip_int64_t got;
+		while ((got = otezip_stream_read (zf, scratch, OTEZIP_STREAM_CHUNK)) > 0) {
+			crc = otezip_crc32_za (za, crc, scratch, (size_t)got);
+			size += (uint64_t)got;
+		}
+		zf->busy_ns += otezip_since (za, t0);
+		rc = got < 0? -1: 0;
+	}
+	zip_fclose (zf);
+	r->size = size;
+	r->crc = crc;
+	if (rc < 0 || size != e->uncomp_size) {
+		r->error = ZIP_ER_INCONS;
+	} else if (crc != e->crc32) {
+		r->error = ZIP_ER_CRC;
 	}
-	free (zf->data);
-	free (zf);
-	return 0;
 }
 
-zip_int64_t zip_fread(zip_file_t *zf, void *buf, zip_uint64_t nbytes) {
-	if (!zf || !buf) {
+/* Entries are handed out in order to the threads testing them */
+struct otezip_test_pool {
+	zip_t *za;
+	otezip_test_result_t *results;
+	zip_uint64_t n;
+	zip_uint64_t next;
+	zip_uint64_t failed;
+#ifdef OTEZIP_HAVE_PTHREAD
+	pthread_mutex_t lock;
+	int threaded;
+#endif
+};
+
+/* Test entries until there are none left. Without a scratch buffer it
+ * takes none. */
+static void *otezip_test_worker(void *arg) {
+	struct otezip_test_pool *pool = (struct otezip_test_pool *)arg;
+	uint8_t *scratch = (uint8_t *)malloc (OTEZIP_STREAM_CHUNK);
+	while (scratch) {
+		zip_uint64_t i;
+		int bad;
+		otezip_test_result_t local;
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (pool->threaded) {
+			pthread_mutex_lock (&pool->lock);
+		}
+#endif
+		i = pool->next;
+		pool->next += i < pool->n? 1: 0;
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (pool->threaded) {
+			pthread_mutex_unlock (&pool->lock);
+		}
+#endif
+		if (i >= pool->n) {
+			break;
+		}
+		otezip_test_result_t *r = pool->results? &pool->results[i]: &local;
+		otezip_test_entry (pool->za, i, scratch, r);
+		bad = r->error != ZIP_ER_OK;
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (pool->threaded) {
+			pthread_mutex_lock (&pool->lock);
+		}
+#endif
+		pool->failed += bad;
+#ifdef OTEZIP_HAVE_PTHREAD
+		if (pool->threaded) {
+			pthread_mutex_unlock (&pool->lock);
+		}
+#endif
+	}
+	free (scratch);
+	return NULL;
+}
+
+zip_int64_t otezip_test_archive(zip_t *za, int n_threads, otezip_test_result_t *results) {
+	if (!otezip_is_valid (za)) {
 		return -1;
 	}
-	if (zf->pos >= zf->size) {
-		return 0;
+	struct otezip_test_pool pool;
+	memset (&pool, 0, sizeof (pool));
+	pool.za = za;
+	pool.results = results;
+	pool.n = za->n_entries;
+#ifdef OTEZIP_HAVE_PTHREAD
+	/* only read-only archives can be read from several threads */
+	pthread_t *threads = NULL;
+	int started = 0;
+	if (n_threads > 1 && za->mode == 0 && pool.n > 1) {
+		if ((zip_uint64_t)n_threads > pool.n) {
+			n_threads = (int)pool.n;
+		}
+		pool.threaded = 1;
+		pthread_mutex_init (&pool.lock, NULL);
+		/* the calling thread is one of them */
+		threads = (pthread_t *)malloc ((size_t)(n_threads - 1) * sizeof (pthread_t));
+		for (; threads && started < n_threads - 1; started++) {
+			if (pthread_create (&threads[started], NULL, otezip_test_worker, &pool) != 0) {
+				break;
+			}
+		}
 	}
-	zip_uint64_t remaining = zf->size - zf->pos;
-	zip_uint64_t to_copy = (nbytes < remaining)? nbytes: remaining;
-	memcpy (buf, (uint8_t *)zf->data + zf->pos, to_copy);
-	zf->pos += to_copy;
-	return (zip_int64_t)to_copy;
+#else
+	(void)n_threads;
+#endif
+	otezip_test_worker (&pool);
+#ifdef OTEZIP_HAVE_PTHREAD
+	for (int t = 0; t < started; t++) {
+		pthread_join (threads[t], NULL);
+	}
+	free (threads);
+	if (pool.threaded) {
+		pthread_mutex_destroy (&pool.lock);
+	}
+#endif
+	/* entries nobody could take: out of memory */
+	if (pool.next < pool.n) {
+		return -1;
+	}
+	return (zip_int64_t)pool.failed;
 }
 
 void zip_stat_init(zip_stat_t *st) {
@@ -1372,11 +4574,11 @@ void zip_stat_init(zip_stat_t *st) {
 
 int zip_stat_index(zip_t *za, zip_uint64_t index, zip_flags_t flags, zip_stat_t *st) {
 	(void)flags;
-	if (!otezip_is_valid (za) || !st || index >= za->n_entries) {
+	const struct otezip_entry *e = otezip_is_valid (za) && st && index < za->n_entries? otezip_entry_get (za, index): NULL;
+	if (!e) {
 		return -1;
 	}
 	zip_stat_init (st);
-	struct otezip_entry *e = &za->entries[index];
 	st->name = e->name;
 	st->index = index;
 	st->size = e->uncomp_size;
@@ -1389,10 +4591,8 @@ int zip_stat_index(zip_t *za, zip_uint64_t index, zip_flags_t flags, zip_stat_t
 
 const char *zip_get_name(zip_t *za, zip_uint64_t index, zip_flags_t flags) {
 	(void)flags;
-	if (!otezip_is_valid (za) || index >= za->n_entries) {
-		return NULL;
-	}
-	return za->entries[index].name;
+	const struct otezip_entry *e = otezip_is_valid (za) && index < za->n_entries? otezip_entry_get (za, index): NULL;
+	return e? e->name: NULL;
 }
 
 int zip_stat(zip_t *za, const char *fname, zip_flags_t flags, zip_stat_t *st) {
@@ -1404,13 +4604,24 @@ int zip_stat(zip_t *za, const char *fname, zip_flags_t flags, zip_stat_t *st) {
 }
 
 zip_t *zip_open_from_source(zip_source_t *src, int flags, zip_error_t *error) {
-	(void)error;
-	if (!src) {
+	if (!src || (otezip_source_streams (src) && otezip_source_load (src) != 0)) {
+		if (error) {
+			error->zip_err = src? ZIP_ER_READ: ZIP_ER_INVAL;
+			error->sys_err = 0;
+		}
 		return NULL;
 	}
-	/* Since otezip's zip_source_t is a simple buffer wrapper,
-	 * we create a temporary file and write the buffer to it,
-	 * then open the archive normally. */
+#ifdef OTEZIP_HAVE_MEMFILE
+	int err = 0;
+	zip_t *za = otezip_mem_archive (src->buf, src->len, flags, src, &err);
+	if (!za && error) {
+		error->zip_err = err;
+		error->sys_err = 0;
+	}
+	return za;
+#else
+	/* No memory streams here: write the buffer to a temporary file
+	 * and open the archive normally. */
 	char tmp_path[] = "/tmp/otezip_XXXXXX";
 	/* Set restrictive umask before mkstemp for security */
 #if defined(__wasi__) || defined(_WIN32) || defined(_WIN64)
@@ -1435,27 +4646,43 @@ zip_t *zip_open_from_source(zip_source_t *src, int flags, zip_error_t *error) {
 	zip_t *za = zip_open (tmp_path, flags, &errorp);
 	if (!za) {
 		unlink (tmp_path);
+	} else {
+		zip_source_free (src);
+	}
+	if (!za && error) {
+		error->zip_err = errorp;
+		error->sys_err = 0;
 	}
 	return za;
+#endif
 }
 
-/* Helper function to write local file header */
-static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t comp_method, uint32_t comp_size, uint32_t uncomp_size, uint32_t crc32) {
+/* Helper function to write local file header. With OTEZIP_FLAG_DD the
+ * CRC and sizes are written as zero, and sizes of UINT64_MAX announce
+ * a ZIP64 data descriptor. */
+static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t comp_method, uint64_t comp_size, uint64_t uncomp_size, uint32_t crc32, uint16_t flags) {
 	size_t filename_len_sz = strlen (name);
 	if (filename_len_sz > OTEZIP_MAX_FIELD_LEN) {
 		filename_len_sz = OTEZIP_MAX_FIELD_LEN;
 	}
 	uint16_t filename_len = (uint16_t)filename_len_sz;
 	uint8_t header[30];
+	/* sizes that do not fit 32 bits move to a ZIP64 extra field, which
+	 * the local header must then carry with both of them */
+	int zip64 = comp_size >= OTEZIP_ZIP64_U32 || uncomp_size >= OTEZIP_ZIP64_U32;
+	if (flags & OTEZIP_FLAG_DD) {
+		crc32 = 0;
+		comp_size = uncomp_size = 0;
+	}
 
 	/* Write local file header signature */
 	otezip_wr32 (header, OTEZIP_SIG_LFH);
 
-	/* Version needed to extract (2.0) */
-	otezip_wr16 (header + 4, 20);
+	/* Version needed to extract (2.0, or 4.5 for ZIP64) */
+	otezip_wr16 (header + 4, zip64? 45: 20);
 
 	/* General purpose bit flag */
-	otezip_wr16 (header + 6, 0);
+	otezip_wr16 (header + 6, flags);
 
 	/* Compression method */
 	otezip_wr16 (header + 8, comp_method);
@@ -1470,16 +4697,16 @@ static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t c
 	otezip_wr32 (header + 14, crc32);
 
 	/* Compressed size */
-	otezip_wr32 (header + 18, comp_size);
+	otezip_wr32 (header + 18, zip64? OTEZIP_ZIP64_U32: (uint32_t)comp_size);
 
 	/* Uncompressed size */
-	otezip_wr32 (header + 22, uncomp_size);
+	otezip_wr32 (header + 22, zip64? OTEZIP_ZIP64_U32: (uint32_t)uncomp_size);
 
 	/* File name length */
 	otezip_wr16 (header + 26, filename_len);
 
 	/* Extra field length */
-	otezip_wr16 (header + 28, 0);
+	otezip_wr16 (header + 28, zip64? 20: 0);
 
 	/* Write header */
 	fwrite (header, 1, sizeof (header), fp);
@@ -1487,11 +4714,20 @@ static uint32_t otezip_write_local_header(FILE *fp, const char *name, uint32_t c
 	/* Write filename */
 	fwrite (name, 1, filename_len, fp);
 
-	return 30 + filename_len;
+	if (!zip64) {
+		return 30 + filename_len;
+	}
+	uint8_t extra[20];
+	otezip_wr16 (extra, OTEZIP_EXTRA_ZIP64);
+	otezip_wr16 (extra + 2, 16);
+	otezip_wr64 (extra + 4, uncomp_size);
+	otezip_wr64 (extra + 12, comp_size);
+	fwrite (extra, 1, sizeof (extra), fp);
+	return 30 + filename_len + 20;
 }
 
 /* Helper function to write central directory header */
-static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t comp_method, uint32_t comp_size, uint32_t uncomp_size, uint32_t crc32, uint32_t local_header_offset, uint16_t file_time, uint16_t file_date, uint32_t external_attr) {
+static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t comp_method, uint64_t comp_size, uint64_t uncomp_size, uint32_t crc32, uint64_t local_header_offset, uint16_t file_time, uint16_t file_date, uint32_t external_attr, uint16_t flags) {
 	size_t filename_len_sz = strlen (name);
 	if (filename_len_sz > OTEZIP_MAX_FIELD_LEN) {
 		filename_len_sz = OTEZIP_MAX_FIELD_LEN;
@@ -1499,17 +4735,34 @@ static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t
 	uint16_t filename_len = (uint16_t)filename_len_sz;
 	uint8_t header[46];
 
+	/* The ZIP64 extra field holds only the values that overflow, in
+	 * this order: uncompressed size, compressed size, offset */
+	uint8_t extra[28];
+	uint16_t extra_len = 0;
+	const uint64_t values[3] = { uncomp_size, comp_size, local_header_offset };
+	for (int k = 0; k < 3; k++) {
+		if (values[k] >= OTEZIP_ZIP64_U32) {
+			otezip_wr64 (extra + 4 + extra_len, values[k]);
+			extra_len += 8;
+		}
+	}
+	if (extra_len) {
+		otezip_wr16 (extra, OTEZIP_EXTRA_ZIP64);
+		otezip_wr16 (extra + 2, extra_len);
+		extra_len += 4;
+	}
+
 	/* Central directory file header signature */
 	otezip_wr32 (header, OTEZIP_SIG_CDH);
 
-	/* Version made by (UNIX, version 2.0) */
-	otezip_wr16 (header + 4, 0x031e);
+	/* Version made by (UNIX, version 2.0 or 4.5 for ZIP64) */
+	otezip_wr16 (header + 4, extra_len? 0x032d: 0x031e);
 
-	/* Version needed to extract (2.0) */
-	otezip_wr16 (header + 6, 20);
+	/* Version needed to extract (2.0 or 4.5) */
+	otezip_wr16 (header + 6, extra_len? 45: 20);
 
 	/* General purpose bit flag */
-	otezip_wr16 (header + 8, 0);
+	otezip_wr16 (header + 8, flags);
 
 	/* Compression method */
 	otezip_wr16 (header + 10, comp_method);
@@ -1522,16 +4775,16 @@ static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t
 	otezip_wr32 (header + 16, crc32);
 
 	/* Compressed size */
-	otezip_wr32 (header + 20, comp_size);
+	otezip_wr32 (header + 20, comp_size >= OTEZIP_ZIP64_U32? OTEZIP_ZIP64_U32: (uint32_t)comp_size);
 
 	/* Uncompressed size */
-	otezip_wr32 (header + 24, uncomp_size);
+	otezip_wr32 (header + 24, uncomp_size >= OTEZIP_ZIP64_U32? OTEZIP_ZIP64_U32: (uint32_t)uncomp_size);
 
 	/* File name length */
 	otezip_wr16 (header + 28, filename_len);
 
 	/* Extra field length */
-	otezip_wr16 (header + 30, 0);
+	otezip_wr16 (header + 30, extra_len);
 
 	/* File comment length */
 	otezip_wr16 (header + 32, 0);
@@ -1546,7 +4799,7 @@ static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t
 	otezip_wr32 (header + 38, external_attr);
 
 	/* Relative offset of local header */
-	otezip_wr32 (header + 42, local_header_offset);
+	otezip_wr32 (header + 42, local_header_offset >= OTEZIP_ZIP64_U32? OTEZIP_ZIP64_U32: (uint32_t)local_header_offset);
 
 	/* Write header */
 	fwrite (header, 1, sizeof (header), fp);
@@ -1554,12 +4807,41 @@ static uint32_t otezip_write_central_header(FILE *fp, const char *name, uint32_t
 	/* Write filename */
 	fwrite (name, 1, filename_len, fp);
 
-	return 46 + filename_len;
+	/* Write the ZIP64 extra field */
+	fwrite (extra, 1, extra_len, fp);
+
+	return 46 + filename_len + extra_len;
 }
 
 /* Helper function to write end of central directory record */
-static void otezip_write_end_of_central_directory(FILE *fp, uint32_t num_entries, uint32_t central_dir_size, uint32_t central_dir_offset) {
+static void otezip_write_end_of_central_directory(FILE *fp, uint64_t num_entries, uint64_t central_dir_size, uint64_t central_dir_offset) {
 	uint8_t eocd[22];
+	int zip64 = num_entries >= OTEZIP_ZIP64_U16 || central_dir_size >= OTEZIP_ZIP64_U32 || central_dir_offset >= OTEZIP_ZIP64_U32;
+
+	if (zip64) {
+		/* ZIP64 end of central directory record, right after the
+		 * central directory, and the locator pointing at it */
+		uint8_t rec[56 + 20];
+		otezip_wr32 (rec, OTEZIP_SIG_EOCD64);
+		otezip_wr64 (rec + 4, 44); /* size of the rest of the record */
+		otezip_wr16 (rec + 12, 0x032d);
+		otezip_wr16 (rec + 14, 45);
+		otezip_wr32 (rec + 16, 0);
+		otezip_wr32 (rec + 20, 0);
+		otezip_wr64 (rec + 24, num_entries);
+		otezip_wr64 (rec + 32, num_entries);
+		otezip_wr64 (rec + 40, central_dir_size);
+		otezip_wr64 (rec + 48, central_dir_offset);
+		otezip_wr32 (rec + 56, OTEZIP_SIG_EOCD64_LOC);
+		otezip_wr32 (rec + 60, 0);
+		otezip_wr64 (rec + 64, central_dir_offset + central_dir_size);
+		otezip_wr32 (rec + 72, 1);
+		fwrite (rec, 1, sizeof (rec), fp);
+		/* the EOCD below then saturates whatever does not fit */
+		num_entries = num_entries >= OTEZIP_ZIP64_U16? OTEZIP_ZIP64_U16: num_entries;
+		central_dir_size = central_dir_size >= OTEZIP_ZIP64_U32? OTEZIP_ZIP64_U32: central_dir_size;
+		central_dir_offset = central_dir_offset >= OTEZIP_ZIP64_U32? OTEZIP_ZIP64_U32: central_dir_offset;
+	}
 
 	/* End of central directory signature */
 	otezip_wr32 (eocd, OTEZIP_SIG_EOCD);
@@ -1571,16 +4853,16 @@ static void otezip_write_end_of_central_directory(FILE *fp, uint32_t num_entries
 	otezip_wr16 (eocd + 6, 0);
 
 	/* Total number of entries in the central directory on this disk */
-	otezip_wr16 (eocd + 8, num_entries);
+	otezip_wr16 (eocd + 8, (uint16_t)num_entries);
 
 	/* Total number of entries in the central directory */
-	otezip_wr16 (eocd + 10, num_entries);
+	otezip_wr16 (eocd + 10, (uint16_t)num_entries);
 
 	/* Size of the central directory */
-	otezip_wr32 (eocd + 12, central_dir_size);
+	otezip_wr32 (eocd + 12, (uint32_t)central_dir_size);
 
 	/* Offset of start of central directory with respect to the starting disk number */
-	otezip_wr32 (eocd + 16, central_dir_offset);
+	otezip_wr32 (eocd + 16, (uint32_t)central_dir_offset);
 
 	/* .ZIP file comment length */
 	otezip_wr16 (eocd + 20, 0);
@@ -1591,7 +4873,10 @@ static void otezip_write_end_of_central_directory(FILE *fp, uint32_t num_entries
 
 zip_source_t *zip_source_buffer(zip_t *za, const void *data, zip_uint64_t len, int freep) {
 	(void)za;
-	zip_source_t *src = (zip_source_t *)malloc (sizeof (zip_source_t));
+	zip_source_t *src = (zip_source_t *)calloc (1, sizeof (zip_source_t));
+	if (!src) {
+		return NULL;
+	}
 	src->buf = data;
 	src->len = len;
 	src->freep = freep;
@@ -1603,6 +4888,52 @@ zip_source_t *zip_source_buffer_create(const void *data, zip_uint64_t len, int f
 	return zip_source_buffer (NULL, data, len, freep);
 }
 
+zip_source_t *zip_source_filep(zip_t *za, FILE *file, zip_uint64_t start, zip_int64_t len) {
+	(void)za;
+	if (!file || len < -1) {
+		return NULL;
+	}
+	zip_source_t *src = (zip_source_t *)calloc (1, sizeof (zip_source_t));
+	if (!src) {
+		return NULL;
+	}
+	src->fp = file;
+	src->start = start;
+	src->len = len > 0? (zip_uint64_t)len: ZIP_UINT64_MAX;
+	if (len <= 0) {
+		/* to the end: known up front for regular files only */
+		struct stat st;
+		if (fstat (fileno (file), &st) == 0 && (st.st_mode & S_IFMT) == S_IFREG && (uint64_t)st.st_size >= start) {
+			src->len = (uint64_t)st.st_size - start;
+		}
+	}
+	return src;
+}
+
+zip_source_t *zip_source_file(zip_t *za, const char *fname, zip_uint64_t start, zip_int64_t len) {
+	FILE *fp = fname? fopen (fname, "rb"): NULL;
+	zip_source_t *src = fp? zip_source_filep (za, fp, start, len): NULL;
+	if (fp && !src) {
+		fclose (fp);
+	}
+	return src;
+}
+
+zip_source_t *zip_source_function(zip_t *za, zip_source_callback fn, void *userdata) {
+	(void)za;
+	if (!fn) {
+		return NULL;
+	}
+	zip_source_t *src = (zip_source_t *)calloc (1, sizeof (zip_source_t));
+	if (!src) {
+		return NULL;
+	}
+	src->fn = fn;
+	src->userdata = userdata;
+	src->len = ZIP_UINT64_MAX;
+	return src;
+}
+
 void zip_source_free(zip_source_t *src) {
 	if (!src) {
 		return;
@@ -1610,6 +4941,12 @@ void zip_source_free(zip_source_t *src) {
 	if (src->freep && src->buf) {
 		free ((void *)src->buf);
 	}
+	if (src->fp) {
+		fclose (src->fp);
+	}
+	if (src->fn) {
+		src->fn (src->userdata, NULL, 0, ZIP_SOURCE_FREE);
+	}
 	free (src);
 }
 
@@ -1621,31 +4958,46 @@ static int otezip_replace_entry_data(zip_t *za, zip_uint64_t index, zip_source_t
 	if (za->mode != 1) {
 		return -1;
 	}
-	struct otezip_entry *e = &za->entries[index];
-	/* Update entry with new source data */
-	e->uncomp_size = (uint32_t)src->len;
-	e->crc32 = otezip_crc32 (0, src->buf, src->len);
-	/* Compress the data using the selected method */
-	uint8_t *comp_buf = NULL;
-	uint32_t comp_size = 0;
-	if (otezip_compress_data ((uint8_t *)src->buf, src->len, &comp_buf, &comp_size, &e->method) != 0) {
+	/* replaced data is rewritten in one piece */
+	if ((otezip_source_streams (src) && otezip_source_load (src) != 0) || (uint64_t)src->len > OTEZIP_MAX_PAYLOAD) {
 		return -1;
 	}
-	if ((uint64_t)comp_size > OTEZIP_MAX_PAYLOAD) {
+	struct otezip_entry *e = &za->entries[index];
+	uint64_t old_span = otezip_entry_span (za, e);
+	uint64_t t0 = otezip_clock (za);
+	/* the new data is compressed as zip_file_add would, into a copy of
+	 * the entry that replaces it only once written */
+	struct otezip_entry ne = *e;
+	ne.method = za->default_method;
+	if (ne.method == OTEZIP_METHOD_AUTO) {
+		ne.method = otezip_auto_method (za, e->name, src->buf, (size_t)src->len, src->len);
+	}
+	ne.uncomp_size = src->len;
+	ne.crc32 = otezip_crc32_za (za, 0, src->buf, (size_t)src->len);
+	uint8_t *comp_buf = NULL;
+	if (otezip_compress_data (za, (uint8_t *)src->buf, (size_t)src->len, &comp_buf, &ne.comp_size, &ne.method, za->comp_flags, za->deflate_threads) != 0 ||
+		ne.comp_size > OTEZIP_MAX_PAYLOAD) {
 		free (comp_buf);
 		return -1;
 	}
-	e->comp_size = comp_size;
-	/* Write the updated entry */
-	long current_pos = ftell (za->fp);
+	int64_t current_pos = otezip_tell (za->fp);
 	if (current_pos < 0) {
 		free (comp_buf);
 		return -1;
 	}
-	e->local_hdr_ofs = (uint32_t)current_pos;
-	otezip_write_local_header (za->fp, e->name, e->method, e->comp_size, e->uncomp_size, e->crc32);
-	fwrite (comp_buf, 1, comp_size, za->fp);
+	ne.local_hdr_ofs = (uint64_t)current_pos;
+	ne.flags &= ~OTEZIP_FLAG_DD;
+	int rc = otezip_write_entry (za, &ne, comp_buf);
 	free (comp_buf);
+	if (rc != 0) {
+		/* the next entry goes where this one started */
+		otezip_truncate (za, ne.local_hdr_ofs);
+		return -1;
+	}
+	*e = ne;
+	/* the old data stays behind until otezip_compact */
+	za->dead_bytes += old_span;
+	otezip_fire_event (za, OTEZIP_EVENT_COMPRESS, e, index, otezip_since (za, t0));
 	return 0;
 }
 
@@ -1654,6 +5006,83 @@ int zip_file_replace(zip_t *za, zip_uint64_t index, zip_source_t *src, zip_flags
 	if (otezip_replace_entry_data (za, index, src) != 0) {
 		return -1;
 	}
+	/* like zip_file_add, the source is consumed on success */
+	zip_source_free (src);
+	return 0;
+}
+
+/* Drop entry index from the directory written by zip_close. Later entries
+ * move down one index. Its data stays in the file as dead space. */
+int zip_delete(zip_t *za, zip_uint64_t index) {
+	if (!otezip_is_valid (za) || za->mode != 1 || index >= za->n_entries) {
+		return -1;
+	}
+	za->dead_bytes += otezip_entry_span (za, &za->entries[index]);
+	memmove (za->entries + index, za->entries + index + 1, (size_t) (za->n_entries - index - 1) * sizeof (struct otezip_entry));
+	za->n_entries--;
+	/* indices moved: lookups rebuild the name tables */
+	otezip_names_free (za);
+	return 0;
+}
+
+static int otezip_cmp_local_ofs(const void *a, const void *b) {
+	uint64_t x = (*(struct otezip_entry *const *)a)->local_hdr_ofs;
+	uint64_t y = (*(struct otezip_entry *const *)b)->local_hdr_ofs;
+	return x < y? -1: x > y;
+}
+
+/* Copy len bytes from ofs down to dst < ofs, front to back so the source
+ * is read before it is overwritten */
+static int otezip_move_down(zip_t *za, uint64_t dst, uint64_t ofs, uint64_t len, uint8_t *buf) {
+	for (uint64_t done = 0; done < len;) {
+		size_t n = len - done < OTEZIP_WRITE_CHUNK? (size_t) (len - done): OTEZIP_WRITE_CHUNK;
+		if (otezip_pread (za, buf, n, ofs + done) != 0 || otezip_seek_za (za, dst + done) != 0) {
+			return -1;
+		}
+		uint64_t t0 = otezip_clock (za);
+		if (fwrite (buf, 1, n, za->fp) != n) {
+			return -1;
+		}
+		otezip_count_io (za, 1, n, otezip_since (za, t0));
+		done += n;
+	}
+	return 0;
+}
+
+int otezip_compact(zip_t *za) {
+	if (!otezip_is_valid (za) || za->mode != 1 || otezip_batch_commit (za, 1) != 0) {
+		return -1;
+	}
+	struct otezip_entry **order = (struct otezip_entry **)malloc ((za->n_entries + 1) * sizeof (*order));
+	uint8_t *buf = (uint8_t *)malloc (OTEZIP_WRITE_CHUNK);
+	int rc = (order && buf)? 0: -1;
+	for (zip_uint64_t i = 0; !rc && i < za->n_entries; i++) {
+		order[i] = &za->entries[i];
+	}
+	if (!rc) {
+		qsort (order, (size_t)za->n_entries, sizeof (*order), otezip_cmp_local_ofs);
+	}
+	/* slide every entry down over the gaps before it */
+	uint64_t w = 0;
+	for (zip_uint64_t i = 0; !rc && i < za->n_entries; i++) {
+		struct otezip_entry *e = order[i];
+		uint64_t len;
+		if (otezip_entry_extent (za, e, &len) != 0 || e->local_hdr_ofs < w) {
+			rc = -1; /* unreadable or overlapping entries */
+		} else if (e->local_hdr_ofs > w && otezip_move_down (za, w, e->local_hdr_ofs, len, buf) != 0) {
+			rc = -1;
+		} else {
+			e->local_hdr_ofs = w;
+			w += len;
+		}
+	}
+	free (order);
+	free (buf);
+	/* new entries and the directory go right after the last one */
+	if (rc || otezip_truncate (za, w) != 0) {
+		return -1;
+	}
+	za->dead_bytes = 0;
 	return 0;
 }
 
@@ -1,5 +1,5 @@
 /* zstd.c - Minimalistic zstd implementation compatible with zlib-like API
- * Version: 0.1 (2025-07-27)
+ * Version: 0.2 (2025-07-27)
  *
  * This single-file implementation provides a tiny subset of zstd API with
  * zlib-compatible wrappers:
@@ -12,8 +12,12 @@
  *   zstdDecompressEnd
  *
  * It supports:
- * - Basic Zstandard compression/decompression
- * - Bare minimum functionality to support ZIP file reading/writing
+ * - Zstandard (RFC 8878) frames with compressed blocks: a hash-chain match
+ *   finder feeds sequences that are coded with FSE, literals are Huffman
+ *   coded; the level selects window size, search depth and lazy matching
+ * - Decoding of concatenated and skippable frames with windows up to
+ *   ZSTD_WINDOW_LOG_MAX, checksum verification, table-driven Huffman and
+ *   FSE decoding, and in-place decoding when a whole frame fits the output
  * - Compatible interface with existing deflate.c implementation
  *
  * Usage:
@@ -63,8 +67,11 @@
 /* ZSTD-specific constants */
 #define ZSTD_MAGIC_NUMBER 0xFD2FB528 /* Magic number for Zstandard frame */
 #define ZSTD_FRAME_HEADER_SIZE 5 /* Minimum frame header size */
-#define ZSTD_BLOCK_MAX_SIZE 128 * 1024 /* Maximum block size */
+#define ZSTD_FRAME_HEADER_MAX 18 /* Magic, descriptor, window, dictionary id and content size */
+#define ZSTD_BLOCK_MAX_SIZE (128 * 1024) /* Maximum block size */
 #define ZSTD_WINDOW_LOG_MAX 24 /* Max window log size */
+#define ZSTD_SKIPPABLE_MAGIC 0x184D2A50 /* Skippable frames use 0x184D2A50-0x184D2A5F */
+#define ZSTD_WILDCOPY_PAD 32 /* Slack kept after buffers so copies may overrun */
 #define ZSTD_DEFAULT_CLEVEL 3 /* Default compression level */
 
 /* ------------- Data Structures ------------- */
@@ -72,56 +79,156 @@
 /* Unified z_stream declaration */
 #include "../include/otezip/zstream.h"
 
-/* Zstandard frame header */
+/* Sequence symbol alphabets and the largest accuracy log of their tables */
+#define ZSTD_LL_MAX 35
+#define ZSTD_ML_MAX 52
+#define ZSTD_OF_MAX 31
+#define ZSTD_LL_LOG 9
+#define ZSTD_ML_LOG 9
+#define ZSTD_OF_LOG 8
+#define ZSTD_HUF_MAX_BITS 11
+#define ZSTD_MIN_MATCH 4
+
+/* FSE encoding table: the state table plus per-symbol transforms */
 typedef struct {
-	uint8_t frame_header[4];
-	uint8_t window_descriptor;
-	uint8_t dictionary_id[4];
-	uint8_t frame_content_size[8];
-} zstd_frame_header;
+	uint32_t delta_nbbits;
+	int32_t delta_find;
+} zstd_fse_tt;
 
-/* Zstandard block header */
 typedef struct {
-	uint32_t block_size;
-	uint8_t block_type;
-	uint8_t is_last_block;
-} zstd_block_header;
+	uint16_t state[1 << ZSTD_LL_LOG];
+	zstd_fse_tt tt[ZSTD_ML_MAX + 1];
+	unsigned log;
+	int rle;
+} zstd_fse_ctable;
+
+/* FSE decoding table cell */
+typedef struct {
+	uint16_t base;
+	uint8_t sym;
+	uint8_t nb;
+} zstd_fse_cell;
+
+/* One LZ77 sequence: literals to copy, then a match. off_base is the
+ * offset as coded in the frame (1-3 repeat codes, else offset + 3). */
+typedef struct {
+	uint32_t lit_len;
+	uint32_t match_len;
+	uint32_t off_base;
+} zstd_seq;
 
 /* Zstandard compression context */
 typedef struct {
 	int compression_level;
-	uint8_t *dict;
-	size_t dict_size;
-	uint8_t *window_buffer;
-	size_t window_size;
-	size_t window_pos;
-	uint32_t block_size;
-	int is_last_block;
-
-	/* Temporary work buffers */
-	uint8_t *compress_buffer;
-	size_t compress_buffer_size;
+	unsigned window_log;
+	unsigned hash_log;
+	unsigned depth; /* hash chain candidates visited per position */
+	unsigned lazy; /* try the next position before committing a match */
+	unsigned nice; /* stop searching once a match this long is found */
+
+	/* Window history followed by the block being filled, all offsets
+	 * below are indices into it */
+	uint8_t *buf;
+	size_t buf_cap;
+	size_t buf_len;
+	size_t buf_alloc; /* allocated sizes, kept by zstdReset */
+	size_t head_alloc;
+	size_t chain_alloc;
+	size_t blk_alloc;
+	size_t blk_start; /* first byte not yet compressed */
+	size_t blk_max;
+	size_t next_ins; /* first position not yet in the hash chains */
+	uint32_t *head; /* position + 1, 0 when empty */
+	uint32_t *chain;
+	size_t chain_mask;
+	uint32_t reps[3];
+	int single_segment;
+
+	/* Per-block scratch */
+	uint8_t *lits;
+	size_t n_lits;
+	zstd_seq *seqs;
+	size_t n_seq;
+	uint8_t *ll_code;
+	uint8_t *ml_code;
+	uint8_t *of_code;
+	zstd_fse_ctable ll_pre, ml_pre, of_pre;
+	zstd_fse_ctable ll_ct, ml_ct, of_ct;
+
+	/* Encoded output waiting for room in next_out */
+	uint8_t *out;
+	size_t out_len;
+	size_t out_pos;
+	int started;
+	int finished;
 } zstd_compress_context;
 
+/* Sequence decoding table cell: the FSE transition plus the baseline and
+ * extra bit count of the code, so the hot loop does one lookup per field */
+typedef struct {
+	uint32_t value;
+	uint16_t next;
+	uint8_t nb;
+	uint8_t extra;
+} zstd_seq_cell;
+
+/* Streaming XXH64 state for frame checksums */
+typedef struct {
+	uint64_t v[4];
+	uint64_t total;
+	uint8_t mem[32];
+	unsigned mem_len;
+} zstd_xxh64;
+
+/* Stages of the buffered decoding path */
+enum {
+	ZSTD_ST_FRAME,
+	ZSTD_ST_BLOCK_HDR,
+	ZSTD_ST_BLOCK,
+	ZSTD_ST_FLUSH,
+	ZSTD_ST_CHECKSUM,
+	ZSTD_ST_SKIP
+};
+
 /* Zstandard decompression context */
 typedef struct {
-	uint8_t *dict;
-	size_t dict_size;
-	uint8_t *window_buffer;
-	size_t window_size;
-	size_t window_pos;
-	uint32_t current_block_size;
-	int current_block_remaining;
-	int is_last_block;
+	zstd_seq_cell ll[1 << ZSTD_LL_LOG];
+	zstd_seq_cell of[1 << ZSTD_OF_LOG];
+	zstd_seq_cell ml[1 << ZSTD_ML_LOG];
+	unsigned ll_log, of_log, ml_log;
+	int have_tables;
+	uint16_t huf[1 << ZSTD_HUF_MAX_BITS]; /* symbol | code length << 8 */
+	unsigned huf_log;
+	int have_huf;
+	uint32_t reps[3];
 
 	/* Frame parameters from header */
-	uint32_t window_log;
+	uint64_t window_size;
 	uint64_t content_size;
-	uint32_t dictionary_id;
-
-	/* Temporary work buffers */
-	uint8_t *decompress_buffer;
-	size_t decompress_buffer_size;
+	int has_content_size;
+	int has_checksum;
+	int skippable;
+	uint64_t frame_out; /* bytes produced by the current frame */
+	zstd_xxh64 xxh;
+
+	/* Buffered path: staged header and block input, history window */
+	int stage;
+	int frame_done;
+	uint8_t hdr[ZSTD_FRAME_HEADER_MAX];
+	size_t hdr_len;
+	unsigned blk_type;
+	size_t blk_size;
+	int blk_last;
+	uint64_t skip_left;
+	uint8_t *in_buf;
+	size_t in_len;
+	uint8_t *win;
+	size_t win_cap;
+	size_t win_alloc;
+	size_t win_pos;
+	size_t flush_pos;
+
+	uint8_t lits[ZSTD_BLOCK_MAX_SIZE + ZSTD_WILDCOPY_PAD];
 } zstd_decompress_context;
 
 /* ------------- Function Prototypes ------------- */
@@ -134,11 +241,13 @@ extern "C" {
 /* Compression */
 int zstdInit(z_stream *strm, int level);
 int zstdCompress(z_stream *strm, int flush);
+int zstdReset(z_stream *strm);
 int zstdEnd(z_stream *strm);
 
 /* Decompression */
 int zstdDecompressInit(z_stream *strm);
 int zstdDecompress(z_stream *strm, int flush);
+int zstdDecompressReset(z_stream *strm);
 int zstdDecompressEnd(z_stream *strm);
 
 /* Helpers for zlib compatibility layer */
@@ -165,559 +274,1455 @@ static uint32_t read_le32(const void *ptr) {
 		((uint32_t)p[3] << 24);
 }
 
-/* Simple compression for Zstandard block
- * NOTE: For minimalistic implementation, we don't actually compress;
- * returning 0 signals to use raw blocks instead. This avoids issues
- * with RLE schemes that conflict with raw data patterns. */
-static int compress_block(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_capacity, int level) {
-	(void)src; /* Unused in this minimal implementation */
-	(void)src_size; /* Unused */
-	(void)dst; /* Unused - we don't compress */
-	(void)dst_capacity; /* Unused */
-	(void)level; /* Unused in this minimal implementation */
-
-	/* Return 0 to indicate: "use raw block instead" */
-	/* This avoids RLE scheme issues with literal 0 bytes conflicting with markers */
-	return 0;
+static inline uint64_t zstd_read_le64(const uint8_t *p) {
+	return (uint64_t)read_le32 (p) | ((uint64_t)read_le32 (p + 4) << 32);
 }
 
-/* Simple decompression for our Zstandard block
- * NOTE: Since we don't actually compress blocks (always using raw blocks),
- * this function won't be called in normal operation. However, we keep it
- * as a placeholder for potential future use. For now, just copy the data. */
-static int decompress_block(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_capacity) {
-	if (src_size == 0 || !src || !dst) {
-		return 0; /* Empty input or invalid pointers */
-	}
-
-	/* Check output capacity */
-	if (src_size > dst_capacity) {
-		return 0; /* Output overflow */
-	}
+static inline void zstd_write_le16(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+}
 
-	/* Just copy raw data - we're not actually compressing */
-	memcpy (dst, src, src_size);
-	return (int)src_size; /* Return decompressed size */
+static inline void zstd_write_le24(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
 }
 
-/* --- Zstandard API Implementation --- */
+static inline void zstd_write_le32(uint8_t *p, uint32_t v) {
+	zstd_write_le16 (p, v);
+	zstd_write_le16 (p + 2, v >> 16);
+}
 
-/* Initialize a compression stream */
-int zstdInit(z_stream *strm, int level) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
+/* Index of the highest set bit, v must be non-zero */
+static inline unsigned zstd_highbit(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return 31 - (unsigned)__builtin_clz (v);
+#else
+	unsigned n = 0;
+	while (v >>= 1) {
+		n++;
 	}
+	return n;
+#endif
+}
 
-	/* Setup default level */
-	if (level == Z_DEFAULT_COMPRESSION) {
-		level = ZSTD_DEFAULT_CLEVEL;
+/* Length of the common prefix of a and b, b running up to end */
+static inline size_t zstd_count(const uint8_t *a, const uint8_t *b, const uint8_t *end) {
+	const uint8_t *start = b;
+	while (b + 8 <= end) {
+		uint64_t x, y;
+		memcpy (&x, a, 8);
+		memcpy (&y, b, 8);
+		if (x != y) {
+			break;
+		}
+		a += 8;
+		b += 8;
 	}
-
-	/* Allocate compression context */
-	zstd_compress_context *ctx = (zstd_compress_context *)calloc (1, sizeof (zstd_compress_context));
-	if (!ctx) {
-		return Z_MEM_ERROR;
+	while (b < end && *a == *b) {
+		a++;
+		b++;
 	}
+	return (size_t)(b - start);
+}
 
-	/* Initialize context */
-	ctx->compression_level = level;
-	ctx->window_size = 1 << 17; /* 128KB window by default */
-	/* Block size is limited to 65535 by the 2-byte size field in block header */
-	ctx->block_size = 65535;
-	ctx->is_last_block = 0;
-
-	/* Allocate window buffer for LZ77 */
-	ctx->window_buffer = (uint8_t *)malloc (ctx->window_size);
-	if (!ctx->window_buffer) {
-		free (ctx);
-		return Z_MEM_ERROR;
+/* --- Sequence code tables (RFC 8878 section 3.1.1.3.2.1) --- */
+
+static const uint32_t zstd_ll_base[ZSTD_LL_MAX + 1] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096,
+	8192, 16384, 32768, 65536
+};
+static const uint8_t zstd_ll_bits[ZSTD_LL_MAX + 1] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12,
+	13, 14, 15, 16
+};
+static const uint32_t zstd_ml_base[ZSTD_ML_MAX + 1] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051,
+	4099, 8195, 16387, 32771, 65539
+};
+static const uint8_t zstd_ml_bits[ZSTD_ML_MAX + 1] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16
+};
+
+/* Predefined distributions, used when a block carries no table */
+static const int16_t zstd_ll_norm[ZSTD_LL_MAX + 1] = {
+	4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+	-1, -1, -1, -1
+};
+static const int16_t zstd_ml_norm[ZSTD_ML_MAX + 1] = {
+	1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1,
+	-1, -1, -1, -1, -1
+};
+static const int16_t zstd_of_norm[29] = {
+	1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1
+};
+#define ZSTD_LL_PRE_LOG 6
+#define ZSTD_ML_PRE_LOG 6
+#define ZSTD_OF_PRE_LOG 5
+#define ZSTD_OF_PRE_MAX 28
+
+/* Move the repeat offset history after a sequence, as the decoder does.
+ * Returns the actual match offset, 0 for an invalid repeat. */
+static inline uint32_t zstd_update_reps(uint32_t *rep, uint32_t off_base, int no_lits) {
+	uint32_t off;
+	if (off_base > 3) {
+		off = off_base - 3;
+	} else {
+		uint32_t idx = off_base - 1 + (no_lits? 1: 0);
+		if (idx == 0) {
+			return rep[0];
+		}
+		off = idx == 3? rep[0] - 1: rep[idx];
+		if (idx == 1) {
+			rep[1] = rep[0];
+			rep[0] = off;
+			return off;
+		}
 	}
+	rep[2] = rep[1];
+	rep[1] = rep[0];
+	rep[0] = off;
+	return off;
+}
 
-	/* Allocate compression buffer */
-	ctx->compress_buffer_size = ctx->block_size * 2; /* Over-allocate for worst case */
-	ctx->compress_buffer = (uint8_t *)malloc (ctx->compress_buffer_size);
-	if (!ctx->compress_buffer) {
-		free (ctx->window_buffer);
-		free (ctx);
-		return Z_MEM_ERROR;
+/* Spread a normalized distribution over the table (RFC 8878 4.1.1).
+ * Low-probability symbols take the top cells. Returns non-zero when the
+ * distribution does not fill the table exactly. */
+static int zstd_fse_spread(uint8_t *spread, const int16_t *norm, unsigned max_sym, unsigned log) {
+	uint32_t size = 1u << log;
+	uint32_t mask = size - 1;
+	uint32_t high = size - 1;
+	uint32_t step = (size >> 1) + (size >> 3) + 3;
+	uint32_t pos = 0;
+	for (unsigned s = 0; s <= max_sym; s++) {
+		if (norm[s] == -1) {
+			spread[high--] = (uint8_t)s;
+		}
 	}
+	for (unsigned s = 0; s <= max_sym; s++) {
+		for (int i = 0; i < norm[s]; i++) {
+			spread[pos] = (uint8_t)s;
+			do {
+				pos = (pos + step) & mask;
+			} while (pos > high);
+		}
+	}
+	return pos != 0;
+}
 
-	/* Initialize stream counters */
-	strm->state = (void *)ctx;
-	strm->total_in = 0;
-	strm->total_out = 0;
+/* --- Compression: bit output --- */
 
-	return Z_OK;
+/* Forward bit writer; streams are read back to front by the decoder */
+typedef struct {
+	uint8_t *start;
+	uint8_t *ptr;
+	uint8_t *end;
+	uint64_t acc;
+	unsigned n;
+	int overflow;
+} zstd_bitw;
+
+static void zstd_bw_init(zstd_bitw *bw, uint8_t *dst, size_t cap) {
+	bw->start = bw->ptr = dst;
+	bw->end = dst + cap;
+	bw->acc = 0;
+	bw->n = 0;
+	bw->overflow = 0;
 }
 
-/* Compress data using Zstandard format */
-int zstdCompress(z_stream *strm, int flush) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
-	}
-
-	zstd_compress_context *ctx = (zstd_compress_context *)strm->state;
+static inline void zstd_bw_add(zstd_bitw *bw, uint64_t v, unsigned nb) {
+	bw->acc |= (v & (((uint64_t)1 << nb) - 1)) << bw->n;
+	bw->n += nb;
+}
 
-	/* Check if this is the first call - need to write frame header */
-	if (strm->total_out == 0) {
-		/* We need space for the frame header */
-		if (strm->avail_out < ZSTD_FRAME_HEADER_SIZE) {
-			return Z_BUF_ERROR;
+static inline void zstd_bw_flush(zstd_bitw *bw) {
+	while (bw->n >= 8) {
+		if (bw->ptr < bw->end) {
+			*bw->ptr++ = (uint8_t)bw->acc;
+		} else {
+			bw->overflow = 1;
 		}
+		bw->acc >>= 8;
+		bw->n -= 8;
+	}
+}
 
-		/* Write Zstandard frame header (simplified) */
-		uint8_t header[4] = { 0xFD, 0x2F, 0xB5, 0x28 }; /* Magic number */
-		memcpy (strm->next_out, header, 4);
-		strm->next_out += 4;
-		strm->avail_out -= 4;
-		strm->total_out += 4;
-
-		/* Window descriptor (using default settings) */
-		strm->next_out[0] = 0x70; /* Window log = 17 (128 KB) */
-		strm->next_out++;
-		strm->avail_out--;
-		strm->total_out++;
+/* Append the end marker and return the stream size, 0 on overflow */
+static size_t zstd_bw_close(zstd_bitw *bw) {
+	zstd_bw_add (bw, 1, 1);
+	zstd_bw_flush (bw);
+	if (bw->n) {
+		if (bw->ptr < bw->end) {
+			*bw->ptr++ = (uint8_t)bw->acc;
+		} else {
+			bw->overflow = 1;
+		}
 	}
+	return bw->overflow? 0: (size_t)(bw->ptr - bw->start);
+}
 
-	/* Simple block-based compression */
-	/* Note: Don't set is_last_block yet - we'll set it when we run out of input */
+/* --- Compression: FSE --- */
 
-	/* Process input data */
-	while (strm->avail_in > 0) {
-		/* Determine block size */
-		uint32_t block_size = strm->avail_in < ctx->block_size? strm->avail_in: ctx->block_size;
+/* Accuracy log for n symbols drawn from 0..max_sym, as reference zstd picks it */
+static unsigned zstd_fse_table_log(unsigned max_log, size_t n, unsigned max_sym) {
+	int log = (int)max_log;
+	int src_bits = (int)zstd_highbit ((uint32_t)(n - 1)) - 2;
+	if (src_bits >= 0 && src_bits < log) {
+		log = src_bits;
+	}
+	int min_src = (int)zstd_highbit ((uint32_t)n) + 1;
+	int min_sym = (int)zstd_highbit (max_sym) + 2;
+	int min_bits = min_src < min_sym? min_src: min_sym;
+	if (min_bits > log) {
+		log = min_bits;
+	}
+	if (log < 5) {
+		log = 5;
+	}
+	return (unsigned)log > max_log? max_log: (unsigned)log;
+}
 
-		/* Skip if no input data and not final block */
-		if (block_size == 0 && !ctx->is_last_block) {
-			break;
+/* Scale counts so they sum to 1 << log. Rare symbols get the special -1
+ * (probability below one cell). Returns -1 if a single symbol has them all. */
+static int zstd_fse_normalize(int16_t *norm, unsigned log, const uint32_t *count, size_t total, unsigned max_sym) {
+	static const uint32_t rtb[8] = { 0, 473195, 504333, 520860, 550000, 700000, 750000, 830000 };
+	unsigned scale = 62 - log;
+	uint64_t step = ((uint64_t)1 << 62) / total;
+	uint64_t vstep = (uint64_t)1 << (scale - 20);
+	int still = 1 << log;
+	unsigned largest = 0;
+	int16_t largest_p = 0;
+	uint32_t low = (uint32_t)(total >> log);
+	for (unsigned s = 0; s <= max_sym; s++) {
+		if (count[s] == total) {
+			return -1;
 		}
-
-		/* Ensure we have space for block header (3 bytes) */
-		if (strm->avail_out < 3) {
-			return Z_BUF_ERROR;
+		if (!count[s]) {
+			norm[s] = 0;
+			continue;
 		}
-
-		/* If this is an empty final block, write a special block */
-		if (block_size == 0 && ctx->is_last_block) {
-			/* Write empty last block (type=0, size=0, last=1) */
-			/* Ensure space for 3-byte block header */
-			if (strm->avail_out < 3) {
-				return Z_BUF_ERROR;
+		if (count[s] <= low) {
+			norm[s] = -1;
+			still--;
+			continue;
+		}
+		uint64_t scaled = (uint64_t)count[s] * step;
+		int16_t p = (int16_t)(scaled >> scale);
+		if (p < 8) {
+			p += (scaled - ((uint64_t)p << scale)) > vstep * rtb[p];
+		}
+		if (p > largest_p) {
+			largest_p = p;
+			largest = s;
+		}
+		norm[s] = p;
+		still -= p;
+	}
+	if (-still < (norm[largest] >> 1)) {
+		norm[largest] = (int16_t)(norm[largest] + still);
+		return 0;
+	}
+	/* Rounding went too far for one symbol to absorb: walk the
+	 * correction over the currently largest entries */
+	while (still) {
+		unsigned best = 0;
+		for (unsigned s = 1; s <= max_sym; s++) {
+			if (norm[s] > norm[best]) {
+				best = s;
 			}
-			strm->next_out[0] = 0x01; /* Last block bit set, raw block (type=0) */
-			strm->next_out[1] = 0x00; /* Size low byte = 0 */
-			strm->next_out[2] = 0x00; /* Size high byte = 0 */
-			strm->next_out += 3;
-			strm->avail_out -= 3;
-			strm->total_out += 3;
-
-			/* We're done */
-			return Z_STREAM_END;
 		}
-
-		/* Try to compress the block */
-		int compressed_size = 0;
-		if (block_size > 0) {
-			compressed_size = compress_block (strm->next_in, block_size, ctx->compress_buffer, ctx->compress_buffer_size, ctx->compression_level);
+		if (still < 0) {
+			norm[best]--;
+			still++;
+		} else {
+			norm[best]++;
+			still--;
 		}
+	}
+	return 0;
+}
 
-		/* Decide whether to write compressed or raw block */
-		uint8_t block_header = 0;
-		const uint8_t *block_content;
-		uint32_t content_size;
-
-		if (compressed_size > 0 && (uint32_t)compressed_size < block_size) {
-			/* Compressed block (type=2) */
-			block_header = 0x02;
-			block_content = ctx->compress_buffer;
-			content_size = compressed_size;
-		} else {
-			/* Raw block (type=0) */
-			block_header = 0x00;
-			block_content = strm->next_in;
-			content_size = block_size;
-		}
-
-		/* Set last block flag if needed */
-		if (ctx->is_last_block) {
-			block_header |= 0x01;
-		}
-
-		/* Write block header */
-		strm->next_out[0] = block_header;
-		strm->next_out[1] = content_size & 0xFF;
-		strm->next_out[2] = (content_size >> 8) & 0xFF;
-		strm->next_out += 3;
-		strm->avail_out -= 3;
-		strm->total_out += 3;
-
-		/* Check if we have enough space for the block content */
-		if (strm->avail_out < content_size) {
-			/* Back up - we can't write this block now */
-			strm->next_out -= 3;
-			strm->avail_out += 3;
-			strm->total_out -= 3;
-			return Z_BUF_ERROR;
-		}
-
-		/* Write block content */
-		memcpy (strm->next_out, block_content, content_size);
-		strm->next_out += content_size;
-		strm->avail_out -= content_size;
-		strm->total_out += content_size;
-
-		/* Update input */
-		if (block_size > 0) {
-			/* Save source pointer before advancing */
-			const uint8_t *src = strm->next_in;
-
-			strm->next_in += block_size;
-			strm->avail_in -= block_size;
-			strm->total_in += block_size;
-
-			/* Update window buffer for future references, handling wrap-around */
-			size_t space_left = ctx->window_size - ctx->window_pos;
-			if (block_size <= space_left) {
-				/* Data fits without wrapping */
-				memcpy (ctx->window_buffer + ctx->window_pos, src, block_size);
-				ctx->window_pos += block_size;
-			} else {
-				/* Data wraps around the circular buffer */
-				memcpy (ctx->window_buffer + ctx->window_pos, src, space_left);
-				memcpy (ctx->window_buffer, src + space_left, block_size - space_left);
-				ctx->window_pos = block_size - space_left;
+/* Write a distribution in the FSE table description format, 0 on overflow */
+static size_t zstd_fse_write_ncount(uint8_t *dst, size_t cap, const int16_t *norm, unsigned max_sym, unsigned log) {
+	uint8_t *op = dst;
+	uint8_t *oend = dst + cap;
+	int size = 1 << log;
+	int remaining = size + 1;
+	int threshold = size;
+	unsigned nb = log + 1;
+	uint32_t bits = log - 5;
+	unsigned nbits = 4;
+	unsigned s = 0;
+	int prev0 = 0;
+	while (s <= max_sym && remaining > 1) {
+		if (prev0) {
+			unsigned start = s;
+			while (s <= max_sym && !norm[s]) {
+				s++;
+			}
+			if (s > max_sym) {
+				break;
+			}
+			while (s >= start + 24) {
+				start += 24;
+				bits += 0xFFFFu << nbits;
+				if (oend - op < 2) {
+					return 0;
+				}
+				zstd_write_le16 (op, bits);
+				op += 2;
+				bits >>= 16;
+			}
+			while (s >= start + 3) {
+				start += 3;
+				bits += 3u << nbits;
+				nbits += 2;
+			}
+			bits += (s - start) << nbits;
+			nbits += 2;
+			if (nbits > 16) {
+				if (oend - op < 2) {
+					return 0;
+				}
+				zstd_write_le16 (op, bits);
+				op += 2;
+				bits >>= 16;
+				nbits -= 16;
 			}
 		}
-
-		/* If this was the last block, we're done */
-		if (ctx->is_last_block) {
-			return Z_STREAM_END;
+		int count = norm[s++];
+		int max = (2 * threshold - 1) - remaining;
+		remaining -= count < 0? -count: count;
+		count++;
+		if (count >= threshold) {
+			count += max;
+		}
+		bits += (uint32_t)count << nbits;
+		nbits += nb;
+		nbits -= count < max;
+		prev0 = count == 1;
+		while (remaining < threshold) {
+			nb--;
+			threshold >>= 1;
+		}
+		if (nbits > 16) {
+			if (oend - op < 2) {
+				return 0;
+			}
+			zstd_write_le16 (op, bits);
+			op += 2;
+			bits >>= 16;
+			nbits -= 16;
 		}
 	}
+	if (oend - op < 2) {
+		return 0;
+	}
+	zstd_write_le16 (op, bits);
+	op += (nbits + 7) / 8;
+	return (size_t)(op - dst);
+}
 
-	/* After processing all input, write the final block if flush == Z_FINISH */
-	if (flush == Z_FINISH) {
-		/* Ensure space for 3-byte block header */
-		if (strm->avail_out < 3) {
-			return Z_BUF_ERROR;
+static void zstd_fse_build_ctable(zstd_fse_ctable *ct, const int16_t *norm, unsigned max_sym, unsigned log) {
+	uint8_t spread[1 << ZSTD_LL_LOG];
+	uint32_t cumul[ZSTD_ML_MAX + 2];
+	uint32_t size = 1u << log;
+	zstd_fse_spread (spread, norm, max_sym, log);
+	cumul[0] = 0;
+	for (unsigned s = 0; s <= max_sym; s++) {
+		cumul[s + 1] = cumul[s] + (norm[s] == -1? 1u: norm[s] > 0? (uint32_t)norm[s]: 0u);
+	}
+	for (uint32_t u = 0; u < size; u++) {
+		ct->state[cumul[spread[u]]++] = (uint16_t)(size + u);
+	}
+	int32_t total = 0;
+	for (unsigned s = 0; s <= max_sym; s++) {
+		int n = norm[s];
+		if (n == 0) {
+			ct->tt[s].delta_nbbits = ((log + 1) << 16) - size;
+			ct->tt[s].delta_find = 0;
+		} else if (n == -1 || n == 1) {
+			ct->tt[s].delta_nbbits = (log << 16) - size;
+			ct->tt[s].delta_find = total - 1;
+			total++;
+		} else {
+			uint32_t max_out = log - zstd_highbit ((uint32_t)n - 1);
+			uint32_t min_state = (uint32_t)n << max_out;
+			ct->tt[s].delta_nbbits = (max_out << 16) - min_state;
+			ct->tt[s].delta_find = total - n;
+			total += n;
 		}
-		strm->next_out[0] = 0x01; /* Last block bit set, raw block (type=0) */
-		strm->next_out[1] = 0x00; /* Size low byte = 0 */
-		strm->next_out[2] = 0x00; /* Size high byte = 0 */
-		strm->next_out += 3;
-		strm->avail_out -= 3;
-		strm->total_out += 3;
-		return Z_STREAM_END;
 	}
-
-	return Z_OK;
+	ct->log = log;
+	ct->rle = 0;
 }
 
-/* End a compression stream */
-int zstdEnd(z_stream *strm) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+static inline uint32_t zstd_fse_init_state(const zstd_fse_ctable *ct, unsigned sym) {
+	if (ct->rle) {
+		return 0;
 	}
+	const zstd_fse_tt *tt = &ct->tt[sym];
+	uint32_t nb = (tt->delta_nbbits + (1u << 15)) >> 16;
+	uint32_t v = (nb << 16) - tt->delta_nbbits;
+	return ct->state[(int32_t)(v >> nb) + tt->delta_find];
+}
 
-	zstd_compress_context *ctx = (zstd_compress_context *)strm->state;
+static inline void zstd_fse_encode(zstd_bitw *bw, const zstd_fse_ctable *ct, uint32_t *state, unsigned sym) {
+	if (ct->rle) {
+		return;
+	}
+	const zstd_fse_tt *tt = &ct->tt[sym];
+	uint32_t nb = (*state + tt->delta_nbbits) >> 16;
+	zstd_bw_add (bw, *state, nb);
+	*state = ct->state[(int32_t)(*state >> nb) + tt->delta_find];
+}
 
-	/* Free allocated buffers */
-	free (ctx->window_buffer);
-	free (ctx->compress_buffer);
-	if (ctx->dict) {
-		free (ctx->dict);
+static inline void zstd_fse_flush_state(zstd_bitw *bw, const zstd_fse_ctable *ct, uint32_t state) {
+	if (!ct->rle) {
+		zstd_bw_add (bw, state, ct->log);
 	}
+}
 
-	/* Free context */
-	free (ctx);
-	strm->state = NULL;
+/* --- Compression: Huffman literals --- */
 
-	return Z_OK;
+typedef struct {
+	uint32_t key;
+	uint16_t sym;
+} zstd_sym_freq;
+
+static int zstd_sym_freq_cmp(const void *a, const void *b) {
+	const zstd_sym_freq *x = (const zstd_sym_freq *)a;
+	const zstd_sym_freq *y = (const zstd_sym_freq *)b;
+	if (x->key != y->key) {
+		return x->key < y->key? -1: 1;
+	}
+	return (int)x->sym - (int)y->sym;
 }
 
-/* Initialize a decompression stream */
-int zstdDecompressInit(z_stream *strm) {
-	if (!strm) {
-		return Z_STREAM_ERROR;
+/* In-place minimum-redundancy code lengths (Moffat & Katajainen) over
+ * frequencies sorted in ascending order */
+static void zstd_minimum_redundancy(zstd_sym_freq *A, int n) {
+	A[0].key += A[1].key;
+	int root = 0;
+	int leaf = 2;
+	for (int next = 1; next < n - 1; next++) {
+		if (leaf >= n || A[root].key < A[leaf].key) {
+			A[next].key = A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key = A[leaf++].key;
+		}
+		if (leaf >= n || (root < next && A[root].key < A[leaf].key)) {
+			A[next].key += A[root].key;
+			A[root++].key = (uint32_t)next;
+		} else {
+			A[next].key += A[leaf++].key;
+		}
 	}
-
-	/* Allocate decompression context */
-	zstd_decompress_context *ctx = (zstd_decompress_context *)calloc (1, sizeof (zstd_decompress_context));
-	if (!ctx) {
-		return Z_MEM_ERROR;
+	A[n - 2].key = 0;
+	for (int next = n - 3; next >= 0; next--) {
+		A[next].key = A[A[next].key].key + 1;
 	}
-
-	/* Initialize context with default values */
-	ctx->window_size = 1 << 17; /* 128KB window by default */
-	ctx->is_last_block = 0;
-
-	/* Allocate window buffer */
-	ctx->window_buffer = (uint8_t *)malloc (ctx->window_size);
-	if (!ctx->window_buffer) {
-		free (ctx);
-		return Z_MEM_ERROR;
+	int avbl = 1;
+	int used = 0;
+	uint32_t depth = 0;
+	root = n - 2;
+	int next = n - 1;
+	while (avbl > 0) {
+		while (root >= 0 && A[root].key == depth) {
+			used++;
+			root--;
+		}
+		while (avbl > used) {
+			A[next--].key = depth;
+			avbl--;
+		}
+		avbl = 2 * used;
+		depth++;
+		used = 0;
 	}
+}
 
-	/* Allocate decompression buffer */
-	ctx->decompress_buffer_size = ZSTD_BLOCK_MAX_SIZE;
-	ctx->decompress_buffer = (uint8_t *)malloc (ctx->decompress_buffer_size);
-	if (!ctx->decompress_buffer) {
-		free (ctx->window_buffer);
-		free (ctx);
-		return Z_MEM_ERROR;
+/* Code lengths limited to ZSTD_HUF_MAX_BITS for at least two present
+ * symbols. Returns the longest length handed out. */
+static unsigned zstd_huf_lengths(const uint32_t *freq, unsigned max_sym, uint8_t *len) {
+	zstd_sym_freq syms[256];
+	int used = 0;
+	for (unsigned s = 0; s <= max_sym; s++) {
+		len[s] = 0;
+		if (freq[s]) {
+			syms[used].key = freq[s];
+			syms[used].sym = (uint16_t)s;
+			used++;
+		}
+	}
+	qsort (syms, (size_t)used, sizeof (syms[0]), zstd_sym_freq_cmp);
+	zstd_minimum_redundancy (syms, used);
+
+	/* Fold over-long codes and rebalance the Kraft sum, shortest codes
+	 * still going to the most frequent symbols */
+	uint32_t bl_count[ZSTD_HUF_MAX_BITS + 1] = { 0 };
+	for (int i = 0; i < used; i++) {
+		bl_count[syms[i].key > ZSTD_HUF_MAX_BITS? ZSTD_HUF_MAX_BITS: syms[i].key]++;
+	}
+	uint32_t total = 0;
+	for (int bits = ZSTD_HUF_MAX_BITS; bits > 0; bits--) {
+		total += bl_count[bits] << (ZSTD_HUF_MAX_BITS - bits);
+	}
+	while (total != (1u << ZSTD_HUF_MAX_BITS)) {
+		bl_count[ZSTD_HUF_MAX_BITS]--;
+		for (int bits = ZSTD_HUF_MAX_BITS - 1; bits > 0; bits--) {
+			if (bl_count[bits]) {
+				bl_count[bits]--;
+				bl_count[bits + 1] += 2;
+				break;
+			}
+		}
+		total--;
+	}
+	unsigned max_bits = 0;
+	int j = used;
+	for (unsigned bits = 1; bits <= ZSTD_HUF_MAX_BITS; bits++) {
+		for (uint32_t k = bl_count[bits]; k > 0; k--) {
+			len[syms[--j].sym] = (uint8_t)bits;
+			max_bits = bits;
+		}
 	}
+	return max_bits;
+}
 
-	/* Initialize stream */
-	strm->state = (void *)ctx;
-	strm->total_in = 0;
-	strm->total_out = 0;
+/* FSE-compress the Huffman weights with two interleaved states. Returns
+ * 0 when this form is unavailable or pointless. */
+static size_t zstd_huf_compress_weights(uint8_t *dst, size_t cap, const uint8_t *w, unsigned nw) {
+	uint32_t count[ZSTD_HUF_MAX_BITS + 1] = { 0 };
+	unsigned max_w = 0;
+	uint32_t max_count = 0;
+	if (nw < 2) {
+		return 0;
+	}
+	for (unsigned i = 0; i < nw; i++) {
+		count[w[i]]++;
+		max_w = w[i] > max_w? w[i]: max_w;
+	}
+	for (unsigned i = 0; i <= max_w; i++) {
+		max_count = count[i] > max_count? count[i]: max_count;
+	}
+	if (max_count == nw || max_count == 1) {
+		return 0;
+	}
+	unsigned log = zstd_fse_table_log (6, nw, max_w);
+	int16_t norm[ZSTD_HUF_MAX_BITS + 1];
+	if (zstd_fse_normalize (norm, log, count, nw, max_w) != 0) {
+		return 0;
+	}
+	/* A cell that reads no bits would hide the end of the stream from
+	 * the decoder's final-state detection */
+	for (unsigned i = 0; i <= max_w; i++) {
+		if (norm[i] > (1 << log) / 2) {
+			return 0;
+		}
+	}
+	size_t hn = zstd_fse_write_ncount (dst, cap, norm, max_w, log);
+	if (!hn) {
+		return 0;
+	}
+	zstd_fse_ctable ct;
+	zstd_fse_build_ctable (&ct, norm, max_w, log);
+	zstd_bitw bw;
+	zstd_bw_init (&bw, dst + hn, cap - hn);
+	unsigned i = nw;
+	uint32_t s1, s2;
+	if (nw & 1) {
+		s1 = zstd_fse_init_state (&ct, w[--i]);
+		s2 = zstd_fse_init_state (&ct, w[--i]);
+		zstd_fse_encode (&bw, &ct, &s1, w[--i]);
+		zstd_bw_flush (&bw);
+	} else {
+		s2 = zstd_fse_init_state (&ct, w[--i]);
+		s1 = zstd_fse_init_state (&ct, w[--i]);
+	}
+	while (i > 0) {
+		zstd_fse_encode (&bw, &ct, &s2, w[--i]);
+		zstd_fse_encode (&bw, &ct, &s1, w[--i]);
+		zstd_bw_flush (&bw);
+	}
+	zstd_fse_flush_state (&bw, &ct, s2);
+	zstd_fse_flush_state (&bw, &ct, s1);
+	size_t n = zstd_bw_close (&bw);
+	return n? hn + n: 0;
+}
 
-	return Z_OK;
+/* Huffman tree description: FSE-compressed or direct 4-bit weights */
+static size_t zstd_huf_write_weights(uint8_t *dst, size_t cap, const uint8_t *w, unsigned nw) {
+	uint8_t tmp[128];
+	size_t direct = nw <= 128? 1 + (nw + 1) / 2: 0;
+	size_t fse = zstd_huf_compress_weights (tmp, sizeof (tmp), w, nw);
+	if (fse && fse < 128 && (!direct || fse + 1 < direct)) {
+		if (cap < fse + 1) {
+			return 0;
+		}
+		dst[0] = (uint8_t)fse;
+		memcpy (dst + 1, tmp, fse);
+		return fse + 1;
+	}
+	if (!direct || cap < direct) {
+		return 0;
+	}
+	dst[0] = (uint8_t)(127 + nw);
+	for (unsigned i = 0; i < nw; i += 2) {
+		dst[1 + i / 2] = (uint8_t)((w[i] << 4) | (i + 1 < nw? w[i + 1]: 0));
+	}
+	return direct;
 }
 
-/* Decompress data using Zstandard format */
-int zstdDecompress(z_stream *strm, int flush) {
-	if (!strm || !strm->state) {
-		return Z_STREAM_ERROR;
+static size_t zstd_huf_stream(uint8_t *dst, size_t cap, const uint8_t *src, size_t n, const uint16_t *code, const uint8_t *nb) {
+	zstd_bitw bw;
+	zstd_bw_init (&bw, dst, cap);
+	size_t i = n;
+	while (i >= 4) {
+		zstd_bw_add (&bw, code[src[i - 1]], nb[src[i - 1]]);
+		zstd_bw_add (&bw, code[src[i - 2]], nb[src[i - 2]]);
+		zstd_bw_add (&bw, code[src[i - 3]], nb[src[i - 3]]);
+		zstd_bw_add (&bw, code[src[i - 4]], nb[src[i - 4]]);
+		zstd_bw_flush (&bw);
+		i -= 4;
 	}
-	(void)flush;
+	while (i > 0) {
+		i--;
+		zstd_bw_add (&bw, code[src[i]], nb[src[i]]);
+	}
+	return zstd_bw_close (&bw);
+}
 
-	zstd_decompress_context *ctx = (zstd_decompress_context *)strm->state;
+/* Literals section header of a raw or RLE section */
+static size_t zstd_write_lit_header(uint8_t *dst, unsigned type, size_t n) {
+	if (n < 32) {
+		dst[0] = (uint8_t)(type | (n << 3));
+		return 1;
+	}
+	if (n < 4096) {
+		dst[0] = (uint8_t)(type | (1 << 2) | ((n & 15) << 4));
+		dst[1] = (uint8_t)(n >> 4);
+		return 2;
+	}
+	dst[0] = (uint8_t)(type | (3 << 2) | ((n & 15) << 4));
+	dst[1] = (uint8_t)(n >> 4);
+	dst[2] = (uint8_t)(n >> 12);
+	return 3;
+}
 
-	/* Check if we need to parse the frame header */
-	if (strm->total_in == 0) {
-		/* Need at least 5 bytes for the frame header */
-		if (strm->avail_in < 5) {
-			return Z_BUF_ERROR;
+/* Huffman-coded literals section, 0 when it would not beat raw literals */
+static size_t zstd_encode_huf_literals(const uint8_t *lit, size_t n, const uint32_t *hist, unsigned max_sym, uint8_t *dst, size_t cap) {
+	uint8_t nb[256];
+	uint8_t w[256];
+	uint16_t code[256];
+	size_t raw_size = n + (n < 32? 1: n < 4096? 2: 3);
+	if (cap > raw_size) {
+		cap = raw_size;
+	}
+	unsigned max_bits = zstd_huf_lengths (hist, max_sym, nb);
+
+	/* Canonical codes in the order the decoder fills its table:
+	 * by increasing weight, then by symbol */
+	uint32_t rank[ZSTD_HUF_MAX_BITS + 2] = { 0 };
+	for (unsigned s = 0; s <= max_sym; s++) {
+		w[s] = nb[s]? (uint8_t)(max_bits + 1 - nb[s]): 0;
+		if (w[s]) {
+			rank[w[s]] += 1u << (w[s] - 1);
+		}
+	}
+	uint32_t next = 0;
+	for (unsigned k = 1; k <= max_bits; k++) {
+		uint32_t cur = next;
+		next += rank[k];
+		rank[k] = cur;
+	}
+	for (unsigned s = 0; s <= max_sym; s++) {
+		if (w[s]) {
+			code[s] = (uint16_t)(rank[w[s]] >> (w[s] - 1));
+			rank[w[s]] += 1u << (w[s] - 1);
 		}
+	}
 
-		/* Check magic number */
-		uint32_t magic = read_le32 (strm->next_in);
-		if (magic != ZSTD_MAGIC_NUMBER) {
-			return Z_DATA_ERROR;
+	int four = n >= 256;
+	size_t lh = !four || n < 1024? 3: n < 16384? 4: 5;
+	if (cap <= lh) {
+		return 0;
+	}
+	uint8_t *op = dst + lh;
+	uint8_t *oend = dst + cap;
+	/* the weight of the last symbol is implied */
+	size_t tn = zstd_huf_write_weights (op, (size_t)(oend - op), w, max_sym);
+	if (!tn) {
+		return 0;
+	}
+	op += tn;
+	if (!four) {
+		size_t sn = zstd_huf_stream (op, (size_t)(oend - op), lit, n, code, nb);
+		if (!sn) {
+			return 0;
+		}
+		op += sn;
+	} else {
+		size_t seg = (n + 3) / 4;
+		uint8_t *jump = op;
+		if (oend - op < 6) {
+			return 0;
+		}
+		op += 6;
+		for (int k = 0; k < 4; k++) {
+			size_t start = (size_t)k * seg;
+			size_t len = k < 3? seg: n - 3 * seg;
+			size_t sn = zstd_huf_stream (op, (size_t)(oend - op), lit + start, len, code, nb);
+			if (!sn) {
+				return 0;
+			}
+			if (k < 3) {
+				zstd_write_le16 (jump + 2 * k, (uint32_t)sn);
+			}
+			op += sn;
 		}
+	}
+	if ((size_t)(op - dst) >= raw_size) {
+		return 0;
+	}
+	uint64_t comp = (uint64_t)(op - dst - lh);
+	uint64_t sf = !four? 0: n < 1024? 1: n < 16384? 2: 3;
+	uint64_t v = 2 | (sf << 2) | ((uint64_t)n << 4);
+	if (lh == 3) {
+		v |= comp << 14;
+	} else if (lh == 4) {
+		v |= comp << 18;
+	} else {
+		v |= comp << 22;
+	}
+	for (size_t i = 0; i < lh; i++) {
+		dst[i] = (uint8_t)(v >> (8 * i));
+	}
+	return (size_t)(op - dst);
+}
 
-		/* Read window descriptor */
-		uint8_t window_descriptor = strm->next_in[4];
-		ctx->window_log = window_descriptor & 0x0F;
-
-		/* Advance past header */
-		strm->next_in += 5;
-		strm->avail_in -= 5;
-		strm->total_in += 5;
-	}
-
-	/* Process blocks */
-	while (strm->avail_in > 0 || ctx->current_block_remaining > 0) {
-		/* If we're still outputting from the current block */
-		if (ctx->current_block_remaining > 0) {
-			uint32_t copy_size = ctx->current_block_remaining;
-			if (copy_size > strm->avail_out) {
-				copy_size = strm->avail_out;
-			}
-
-			/* Copy data to output */
-			memcpy (strm->next_out,
-				ctx->decompress_buffer +
-					(ctx->current_block_size - ctx->current_block_remaining),
-				copy_size);
-
-			/* Update counters */
-			strm->next_out += copy_size;
-			strm->avail_out -= copy_size;
-			strm->total_out += copy_size;
-			ctx->current_block_remaining -= copy_size;
-
-			/* Copy to window buffer, handling wrap-around */
-			const uint8_t *data = strm->next_out - copy_size;
-			size_t space_left = ctx->window_size - ctx->window_pos;
-			if (copy_size <= space_left) {
-				/* Data fits without wrapping */
-				memcpy (ctx->window_buffer + ctx->window_pos, data, copy_size);
-				ctx->window_pos += copy_size;
-			} else {
-				/* Data wraps around the circular buffer */
-				memcpy (ctx->window_buffer + ctx->window_pos, data, space_left);
-				memcpy (ctx->window_buffer, data + space_left, copy_size - space_left);
-				ctx->window_pos = copy_size - space_left;
-			}
-
-			/* Check if we're out of output space */
-			if (strm->avail_out == 0) {
-				return Z_OK;
-			}
-		}
-
-		/* Start a new block if possible */
-		if (strm->avail_in >= 3) {
-			/* Parse block header */
-			uint8_t block_header = strm->next_in[0];
-			ctx->is_last_block = block_header & 0x01;
-			uint8_t block_type = (block_header >> 1) & 0x03;
-
-			/* Get block size */
-			uint32_t block_size = ((uint32_t)strm->next_in[2] << 8) |
-				strm->next_in[1];
-
-			/* Skip header */
-			strm->next_in += 3;
-			strm->avail_in -= 3;
-			strm->total_in += 3;
-
-			/* Process based on block type */
-			if (block_type == 0) {
-				/* Raw block */
-				if (strm->avail_in < block_size) {
-					/* Not enough input data */
-					strm->next_in -= 3;
-					strm->avail_in += 3;
-					strm->total_in -= 3;
-					return Z_BUF_ERROR;
-				}
+/* Literals section: Huffman, RLE or raw, whichever is smallest */
+static size_t zstd_encode_literals(const uint8_t *lit, size_t n, uint8_t *dst, size_t cap) {
+	if (n >= 64) {
+		uint32_t hist[256] = { 0 };
+		unsigned max_sym = 0;
+		unsigned distinct = 0;
+		for (size_t i = 0; i < n; i++) {
+			hist[lit[i]]++;
+		}
+		for (unsigned s = 0; s < 256; s++) {
+			if (hist[s]) {
+				max_sym = s;
+				distinct++;
+			}
+		}
+		if (distinct == 1) {
+			if (cap < 4) {
+				return 0;
+			}
+			size_t h = zstd_write_lit_header (dst, 1, n);
+			dst[h] = lit[0];
+			return h + 1;
+		}
+		size_t sz = zstd_encode_huf_literals (lit, n, hist, max_sym, dst, cap);
+		if (sz) {
+			return sz;
+		}
+	}
+	if (cap < n + 3) {
+		return 0;
+	}
+	size_t h = zstd_write_lit_header (dst, 0, n);
+	memcpy (dst + h, lit, n);
+	return h + n;
+}
 
-				/* Copy raw block to output if space allows */
-				if (strm->avail_out >= block_size) {
-					memcpy (strm->next_out, strm->next_in, block_size);
-					strm->next_out += block_size;
-					strm->avail_out -= block_size;
-					strm->total_out += block_size;
-
-					/* Copy to window buffer, handling wrap-around */
-					size_t space_left = ctx->window_size - ctx->window_pos;
-					if (block_size <= space_left) {
-						/* Data fits without wrapping */
-						memcpy (ctx->window_buffer + ctx->window_pos,
-							strm->next_in,
-							block_size);
-						ctx->window_pos += block_size;
-					} else {
-						/* Data wraps around the circular buffer */
-						memcpy (ctx->window_buffer + ctx->window_pos,
-							strm->next_in,
-							space_left);
-						memcpy (ctx->window_buffer,
-							strm->next_in + space_left,
-							block_size - space_left);
-						ctx->window_pos = block_size - space_left;
-					}
+/* --- Compression: sequences --- */
+
+static const uint8_t zstd_ll_code_tab[64] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21,
+	22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24
+};
+
+static const uint8_t zstd_ml_code_tab[128] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 32, 33, 33, 34, 34, 35, 35, 36, 36, 36, 36, 37, 37, 37, 37,
+	38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39,
+	40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42
+};
+
+static inline unsigned zstd_ll_code(uint32_t ll) {
+	return ll < 64? zstd_ll_code_tab[ll]: zstd_highbit (ll) + 19;
+}
 
-					/* Advance input */
-					strm->next_in += block_size;
-					strm->avail_in -= block_size;
-					strm->total_in += block_size;
-				} else {
-					/* Store in temporary buffer to output in chunks */
-					if (block_size > ctx->decompress_buffer_size) {
-						/* Reallocate buffer if needed */
-						free (ctx->decompress_buffer);
-						ctx->decompress_buffer_size = block_size;
-						ctx->decompress_buffer = (uint8_t *)malloc (ctx->decompress_buffer_size);
-						if (!ctx->decompress_buffer) {
-							return Z_MEM_ERROR;
-						}
-					}
+static inline unsigned zstd_ml_code(uint32_t ml) {
+	uint32_t v = ml - 3;
+	return v < 128? zstd_ml_code_tab[v]: zstd_highbit (v) + 36;
+}
 
-					/* Copy to buffer */
-					memcpy (ctx->decompress_buffer, strm->next_in, block_size);
-					ctx->current_block_size = block_size;
-					ctx->current_block_remaining = block_size;
+/* log2(v) in 1/256 bit units, v > 0 */
+static inline uint32_t zstd_log2_fp(uint32_t v) {
+	unsigned h = zstd_highbit (v);
+	return (h << 8) + ((((uint64_t)v << 8) >> h) & 255);
+}
 
-					/* Advance input */
-					strm->next_in += block_size;
-					strm->avail_in -= block_size;
-					strm->total_in += block_size;
+/* Estimated cost in 1/256 bits of coding counts with a distribution,
+ * UINT64_MAX when some present symbol has no cell */
+static uint64_t zstd_table_cost(const int16_t *norm, unsigned norm_max, unsigned log, const uint32_t *count, unsigned max_sym) {
+	uint64_t cost = 0;
+	if (max_sym > norm_max) {
+		return UINT64_MAX;
+	}
+	for (unsigned s = 0; s <= max_sym; s++) {
+		if (!count[s]) {
+			continue;
+		}
+		if (!norm[s]) {
+			return UINT64_MAX;
+		}
+		uint32_t p = norm[s] < 0? 1u: (uint32_t)norm[s];
+		cost += (uint64_t)count[s] * ((log << 8) - zstd_log2_fp (p));
+	}
+	return cost;
+}
 
-					/* Process from buffer on next iteration */
-					continue;
-				}
-			} else if (block_type == 2) {
-				/* Compressed block */
-				if (strm->avail_in < block_size) {
-					/* Not enough input data */
-					strm->next_in -= 3;
-					strm->avail_in += 3;
-					strm->total_in -= 3;
-					return Z_BUF_ERROR;
-				}
+/* Choose predefined, RLE or an FSE table for one symbol stream, writing
+ * its description at *op. Returns the compression mode or -1. */
+static int zstd_choose_table(zstd_fse_ctable *ct, const zstd_fse_ctable *pre, const int16_t *pre_norm, unsigned pre_max, unsigned pre_log,
+	const uint8_t *codes, size_t n, unsigned max_log, uint8_t **op, uint8_t *oend, const zstd_fse_ctable **use) {
+	uint32_t count[ZSTD_ML_MAX + 1] = { 0 };
+	unsigned max_sym = 0;
+	for (size_t i = 0; i < n; i++) {
+		count[codes[i]]++;
+		max_sym = codes[i] > max_sym? codes[i]: max_sym;
+	}
+	if (count[codes[0]] == n) {
+		if (oend - *op < 1) {
+			return -1;
+		}
+		*(*op)++ = codes[0];
+		ct->rle = 1;
+		*use = ct;
+		return 1;
+	}
+	uint64_t pre_cost = zstd_table_cost (pre_norm, pre_max, pre_log, count, max_sym);
+	int16_t norm[ZSTD_ML_MAX + 1];
+	unsigned log = zstd_fse_table_log (max_log, n, max_sym);
+	zstd_fse_normalize (norm, log, count, n, max_sym);
+	uint8_t hdr[96];
+	size_t hn = zstd_fse_write_ncount (hdr, sizeof (hdr), norm, max_sym, log);
+	uint64_t fse_cost = hn? (uint64_t)hn * 8 * 256 + zstd_table_cost (norm, max_sym, log, count, max_sym): UINT64_MAX;
+	if (pre_cost <= fse_cost) {
+		if (pre_cost == UINT64_MAX) {
+			return -1;
+		}
+		*use = pre;
+		return 0;
+	}
+	if ((size_t)(oend - *op) < hn) {
+		return -1;
+	}
+	memcpy (*op, hdr, hn);
+	*op += hn;
+	zstd_fse_build_ctable (ct, norm, max_sym, log);
+	*use = ct;
+	return 2;
+}
 
-				/* Decompress the block */
-				int decompressed_size = decompress_block (
-					strm->next_in, block_size, ctx->decompress_buffer, ctx->decompress_buffer_size);
+/* Sequences section, 0 on overflow */
+static size_t zstd_encode_sequences(zstd_compress_context *c, uint8_t *dst, size_t cap) {
+	size_t n = c->n_seq;
+	uint8_t *op = dst;
+	uint8_t *oend = dst + cap;
+	if (cap < 4) {
+		return 0;
+	}
+	if (n < 128) {
+		*op++ = (uint8_t)n;
+	} else if (n < 0x7F00) {
+		*op++ = (uint8_t)((n >> 8) + 128);
+		*op++ = (uint8_t)n;
+	} else {
+		*op++ = 255;
+		zstd_write_le16 (op, (uint32_t)(n - 0x7F00));
+		op += 2;
+	}
+	if (n == 0) {
+		return (size_t)(op - dst);
+	}
+	for (size_t i = 0; i < n; i++) {
+		c->ll_code[i] = (uint8_t)zstd_ll_code (c->seqs[i].lit_len);
+		c->ml_code[i] = (uint8_t)zstd_ml_code (c->seqs[i].match_len);
+		c->of_code[i] = (uint8_t)zstd_highbit (c->seqs[i].off_base);
+	}
+	uint8_t *modes = op++;
+	const zstd_fse_ctable *llt, *oft, *mlt;
+	int ll_mode = zstd_choose_table (&c->ll_ct, &c->ll_pre, zstd_ll_norm, ZSTD_LL_MAX, ZSTD_LL_PRE_LOG, c->ll_code, n, ZSTD_LL_LOG, &op, oend, &llt);
+	int of_mode = ll_mode < 0? -1: zstd_choose_table (&c->of_ct, &c->of_pre, zstd_of_norm, ZSTD_OF_PRE_MAX, ZSTD_OF_PRE_LOG, c->of_code, n, ZSTD_OF_LOG, &op, oend, &oft);
+	int ml_mode = of_mode < 0? -1: zstd_choose_table (&c->ml_ct, &c->ml_pre, zstd_ml_norm, ZSTD_ML_MAX, ZSTD_ML_PRE_LOG, c->ml_code, n, ZSTD_ML_LOG, &op, oend, &mlt);
+	if (ml_mode < 0) {
+		return 0;
+	}
+	*modes = (uint8_t)((ll_mode << 6) | (of_mode << 4) | (ml_mode << 2));
+
+	/* The decoder walks the sequences forward from the end of the
+	 * stream, so emit them last to first */
+	zstd_bitw bw;
+	zstd_bw_init (&bw, op, (size_t)(oend - op));
+	size_t i = n - 1;
+	const zstd_seq *sq = &c->seqs[i];
+	uint32_t ml_state = zstd_fse_init_state (mlt, c->ml_code[i]);
+	uint32_t of_state = zstd_fse_init_state (oft, c->of_code[i]);
+	uint32_t ll_state = zstd_fse_init_state (llt, c->ll_code[i]);
+	zstd_bw_add (&bw, sq->lit_len - zstd_ll_base[c->ll_code[i]], zstd_ll_bits[c->ll_code[i]]);
+	zstd_bw_add (&bw, sq->match_len - zstd_ml_base[c->ml_code[i]], zstd_ml_bits[c->ml_code[i]]);
+	zstd_bw_flush (&bw);
+	zstd_bw_add (&bw, sq->off_base, c->of_code[i]);
+	zstd_bw_flush (&bw);
+	while (i-- > 0) {
+		sq = &c->seqs[i];
+		zstd_fse_encode (&bw, oft, &of_state, c->of_code[i]);
+		zstd_fse_encode (&bw, mlt, &ml_state, c->ml_code[i]);
+		zstd_fse_encode (&bw, llt, &ll_state, c->ll_code[i]);
+		zstd_bw_flush (&bw);
+		zstd_bw_add (&bw, sq->lit_len - zstd_ll_base[c->ll_code[i]], zstd_ll_bits[c->ll_code[i]]);
+		zstd_bw_add (&bw, sq->match_len - zstd_ml_base[c->ml_code[i]], zstd_ml_bits[c->ml_code[i]]);
+		zstd_bw_flush (&bw);
+		zstd_bw_add (&bw, sq->off_base, c->of_code[i]);
+		zstd_bw_flush (&bw);
+	}
+	zstd_fse_flush_state (&bw, mlt, ml_state);
+	zstd_fse_flush_state (&bw, oft, of_state);
+	zstd_fse_flush_state (&bw, llt, ll_state);
+	size_t sn = zstd_bw_close (&bw);
+	if (!sn) {
+		return 0;
+	}
+	return (size_t)(op - dst) + sn;
+}
 
-				if (decompressed_size <= 0) {
-					return Z_DATA_ERROR;
-				}
+/* --- Compression: match finder --- */
+
+/* Level presets: window log, hash log, chain depth, lazy, nice length */
+static const struct {
+	uint8_t window_log;
+	uint8_t hash_log;
+	uint16_t depth;
+	uint8_t lazy;
+	uint16_t nice;
+} zstd_levels[10] = {
+	{ 19, 16, 1, 0, 16 }, /* 0: unused, see zstdInit */
+	{ 19, 16, 1, 0, 16 },
+	{ 19, 17, 2, 0, 24 },
+	{ 20, 17, 4, 0, 32 },
+	{ 20, 17, 8, 1, 48 },
+	{ 21, 18, 16, 1, 64 },
+	{ 21, 18, 32, 1, 96 },
+	{ 22, 19, 64, 1, 128 },
+	{ 22, 19, 128, 1, 192 },
+	{ 22, 20, 256, 1, 258 },
+};
+
+static inline uint32_t zstd_hash4(const uint8_t *p, unsigned log) {
+	return (read_le32 (p) * 2654435761u) >> (32 - log);
+}
 
-				/* Output if space allows */
-				if (strm->avail_out >= (uint32_t)decompressed_size) {
-					memcpy (strm->next_out, ctx->decompress_buffer, decompressed_size);
-					strm->next_out += decompressed_size;
-					strm->avail_out -= decompressed_size;
-					strm->total_out += decompressed_size;
-
-					/* Copy to window buffer, handling wrap-around */
-					size_t space_left = ctx->window_size - ctx->window_pos;
-					if ((size_t)decompressed_size <= space_left) {
-						/* Data fits without wrapping */
-						memcpy (ctx->window_buffer + ctx->window_pos,
-							ctx->decompress_buffer,
-							decompressed_size);
-						ctx->window_pos += decompressed_size;
-					} else {
-						/* Data wraps around the circular buffer */
-						memcpy (ctx->window_buffer + ctx->window_pos,
-							ctx->decompress_buffer,
-							space_left);
-						memcpy (ctx->window_buffer,
-							ctx->decompress_buffer + space_left,
-							decompressed_size - space_left);
-						ctx->window_pos = decompressed_size - space_left;
-					}
-				} else {
-					/* Store for partial output */
-					ctx->current_block_size = decompressed_size;
-					ctx->current_block_remaining = decompressed_size;
+/* Thread every position below target into the hash chains */
+static void zstd_insert_upto(zstd_compress_context *c, size_t target) {
+	size_t stop = c->buf_len >= 4? c->buf_len - 3: 0;
+	if (target < stop) {
+		stop = target;
+	}
+	for (size_t q = c->next_ins; q < stop; q++) {
+		uint32_t h = zstd_hash4 (c->buf + q, c->hash_log);
+		c->chain[q & c->chain_mask] = c->head[h];
+		c->head[h] = (uint32_t)q + 1;
+	}
+	if (stop > c->next_ins) {
+		c->next_ins = stop;
+	}
+}
 
-					/* Process from buffer on next iteration */
-					continue;
+/* Longest match for position ip within [ip, end), 0 if below the minimum */
+static size_t zstd_find_match(zstd_compress_context *c, size_t ip, size_t end, uint32_t *off) {
+	const uint8_t *b = c->buf;
+	size_t wsize = (size_t)1 << c->window_log;
+	uint32_t cand;
+	zstd_insert_upto (c, ip);
+	if (ip < c->next_ins) {
+		cand = c->chain[ip & c->chain_mask];
+	} else {
+		uint32_t h = zstd_hash4 (b + ip, c->hash_log);
+		cand = c->head[h];
+		c->chain[ip & c->chain_mask] = cand;
+		c->head[h] = (uint32_t)ip + 1;
+		c->next_ins = ip + 1;
+	}
+	size_t best = 0;
+	size_t max_len = end - ip;
+	uint32_t cur = read_le32 (b + ip);
+	for (unsigned depth = c->depth; cand && depth > 0; depth--) {
+		size_t p = cand - 1;
+		if (ip - p >= wsize) {
+			break;
+		}
+		if (b[p + best] == b[ip + best] && read_le32 (b + p) == cur) {
+			size_t len = 4 + zstd_count (b + p + 4, b + ip + 4, b + end);
+			if (len > best) {
+				best = len;
+				*off = (uint32_t)(ip - p);
+				if (len >= c->nice || len == max_len) {
+					break;
 				}
-
-				/* Advance input */
-				strm->next_in += block_size;
-				strm->avail_in -= block_size;
-				strm->total_in += block_size;
-			} else {
-				/* Reserved or RLE block - not implemented */
-				return Z_DATA_ERROR;
 			}
-
-			/* Check if this was the last block */
-			if (ctx->is_last_block) {
-				return Z_STREAM_END;
-			}
-		} else {
-			/* Not enough input for a new block */
-			return Z_BUF_ERROR;
 		}
+		uint32_t next = c->chain[p & c->chain_mask];
+		if (next >= cand) {
+			break;
+		}
+		cand = next;
 	}
+	return best >= ZSTD_MIN_MATCH? best: 0;
+}
 
-	return Z_OK;
+/* Length of a match against the most recent offset, 0 if none */
+static inline size_t zstd_rep_match(const zstd_compress_context *c, size_t ip, size_t end, uint32_t rep) {
+	const uint8_t *b = c->buf;
+	if (rep > ip || read_le32 (b + ip) != read_le32 (b + ip - rep)) {
+		return 0;
+	}
+	return 4 + zstd_count (b + ip - rep + 4, b + ip + 4, b + end);
 }
 
-/* End a decompression stream */
-int zstdDecompressEnd(z_stream *strm) {
+static void zstd_store_seq(zstd_compress_context *c, size_t anchor, size_t ip, uint32_t off, size_t ml, uint32_t *rep) {
+	size_t ll = ip - anchor;
+	uint32_t ob;
+	memcpy (c->lits + c->n_lits, c->buf + anchor, ll);
+	c->n_lits += ll;
+	if (ll) {
+		ob = off == rep[0]? 1: off == rep[1]? 2: off == rep[2]? 3: off + 3;
+	} else {
+		ob = off == rep[1]? 1: off == rep[2]? 2: off == rep[0] - 1? 3: off + 3;
+	}
+	zstd_update_reps (rep, ob, ll == 0);
+	zstd_seq *sq = &c->seqs[c->n_seq++];
+	sq->lit_len = (uint32_t)ll;
+	sq->match_len = (uint32_t)ml;
+	sq->off_base = ob;
+}
+
+/* Gain of a match in quarter bits: length against the offset's cost */
+static inline int zstd_match_gain(size_t len, uint32_t off, uint32_t rep0) {
+	return (int)(len * 4) - (off == rep0? 0: (int)zstd_highbit (off + 3));
+}
+
+/* Split the block [bs, be) into sequences and trailing literals */
+static void zstd_parse_block(zstd_compress_context *c, size_t bs, size_t be) {
+	const uint8_t *b = c->buf;
+	uint32_t *rep = c->reps;
+	size_t ip = bs;
+	size_t anchor = bs;
+	c->n_seq = 0;
+	c->n_lits = 0;
+	while (ip + ZSTD_MIN_MATCH <= be) {
+		uint32_t off = rep[0];
+		size_t len = ip > anchor? zstd_rep_match (c, ip, be, rep[0]): 0;
+		uint32_t moff = 0;
+		size_t mlen = zstd_find_match (c, ip, be, &moff);
+		if (mlen && zstd_match_gain (mlen, moff, rep[0]) > zstd_match_gain (len, off, rep[0])) {
+			len = mlen;
+			off = moff;
+		}
+		if (len < ZSTD_MIN_MATCH) {
+			/* skip faster through data that keeps failing to match */
+			ip += c->depth == 1? 1 + ((ip - anchor) >> 8): 1;
+			continue;
+		}
+		while (c->lazy && ip + 1 + ZSTD_MIN_MATCH <= be) {
+			uint32_t off2 = 0;
+			size_t len2 = zstd_find_match (c, ip + 1, be, &off2);
+			size_t rlen = zstd_rep_match (c, ip + 1, be, rep[0]);
+			if (rlen >= len2) {
+				len2 = rlen;
+				off2 = rep[0];
+			}
+			if (len2 < ZSTD_MIN_MATCH || zstd_match_gain (len2, off2, rep[0]) <= zstd_match_gain (len, off, rep[0]) + 4) {
+				break;
+			}
+			ip++;
+			len = len2;
+			off = off2;
+		}
+		while (ip > anchor && ip > off && b[ip - 1] == b[ip - 1 - off]) {
+			ip--;
+			len++;
+		}
+		zstd_store_seq (c, anchor, ip, off, len, rep);
+		ip += len;
+		anchor = ip;
+		if (c->depth <= 2 && ip > c->next_ins + 2) {
+			/* fast levels leave the inside of matches unindexed */
+			c->next_ins = ip - 2;
+		}
+		/* a second offset that keeps matching right away */
+		while (ip + ZSTD_MIN_MATCH <= be && (len = zstd_rep_match (c, ip, be, rep[1])) != 0) {
+			zstd_store_seq (c, anchor, ip, rep[1], len, rep);
+			ip += len;
+			anchor = ip;
+		}
+	}
+	memcpy (c->lits + c->n_lits, b + anchor, be - anchor);
+	c->n_lits += be - anchor;
+}
+
+/* --- Compression: frame --- */
+
+/* Compress the pending block and queue it in the output buffer */
+static void zstd_emit_block(zstd_compress_context *c, size_t n, int last) {
+	const uint8_t *src = c->buf + c->blk_start;
+	uint8_t *hdr = c->out + c->out_len;
+	unsigned type = 0;
+	size_t body = n;
+	size_t i = 1;
+	while (i < n && src[i] == src[0]) {
+		i++;
+	}
+	if (n > 1 && i == n) {
+		type = 1;
+		hdr[3] = src[0];
+		body = 1;
+	} else if (n >= 16) {
+		uint32_t saved[3];
+		memcpy (saved, c->reps, sizeof (saved));
+		zstd_parse_block (c, c->blk_start, c->blk_start + n);
+		uint8_t *op = hdr + 3;
+		uint8_t *oend = op + n - 1;
+		size_t ln = zstd_encode_literals (c->lits, c->n_lits, op, (size_t)(oend - op));
+		size_t sn = ln? zstd_encode_sequences (c, op + ln, (size_t)(oend - op - ln)): 0;
+		if (sn) {
+			type = 2;
+			body = ln + sn;
+		} else {
+			/* raw blocks leave the offset history alone */
+			memcpy (c->reps, saved, sizeof (saved));
+		}
+	}
+	if (type == 0) {
+		memcpy (hdr + 3, src, n);
+	}
+	zstd_write_le24 (hdr, (uint32_t)(last | (type << 1) | ((type == 1? n: body) << 3)));
+	c->out_len += 3 + body;
+	c->blk_start += n;
+}
+
+/* Drop history that fell out of the window. Shifts are whole windows so
+ * chain slots keep their position. */
+static void zstd_slide(zstd_compress_context *c) {
+	size_t wsize = (size_t)1 << c->window_log;
+	if (c->blk_start < 2 * wsize) {
+		return;
+	}
+	size_t shift = (c->blk_start - wsize) & ~(wsize - 1);
+	memmove (c->buf, c->buf + shift, c->buf_len - shift);
+	c->buf_len -= shift;
+	c->blk_start -= shift;
+	c->next_ins = c->next_ins > shift? c->next_ins - shift: 0;
+	size_t hsize = (size_t)1 << c->hash_log;
+	for (size_t i = 0; i < hsize; i++) {
+		c->head[i] = c->head[i] > shift? c->head[i] - (uint32_t)shift: 0;
+	}
+	for (size_t i = 0; i <= c->chain_mask; i++) {
+		c->chain[i] = c->chain[i] > shift? c->chain[i] - (uint32_t)shift: 0;
+	}
+}
+
+/* Return p if it holds n elements of size sz, else a new zeroed block */
+static void *zstd_reserve(void *p, size_t *have, size_t n, size_t sz) {
+	if (p && n <= *have) {
+		return p;
+	}
+	free (p);
+	p = calloc (n, sz);
+	*have = p? n: 0;
+	return p;
+}
+
+/* Size the buffers, reusing those left by zstdReset when they are big
+ * enough. When the whole input arrives with the first call the frame is
+ * single-segment and everything is sized to the content. */
+static int zstd_cctx_alloc(zstd_compress_context *c, int known, size_t size) {
+	size_t wsize = (size_t)1 << c->window_log;
+	if (known) {
+		while (c->window_log > 10 && (wsize >> 1) >= size) {
+			c->window_log--;
+			wsize >>= 1;
+		}
+		c->buf_cap = size? size: 1;
+		c->blk_max = size < ZSTD_BLOCK_MAX_SIZE? (size? size: 1): ZSTD_BLOCK_MAX_SIZE;
+	} else {
+		c->buf_cap = 2 * wsize + ZSTD_BLOCK_MAX_SIZE;
+		c->blk_max = ZSTD_BLOCK_MAX_SIZE;
+	}
+	if (c->hash_log > c->window_log + 1) {
+		c->hash_log = c->window_log + 1;
+	}
+	c->single_segment = known;
+	c->chain_mask = wsize - 1;
+	size_t seq_cap = c->blk_max / ZSTD_MIN_MATCH + 1;
+	size_t hsize = (size_t)1 << c->hash_log;
+	c->buf = (uint8_t *)zstd_reserve (c->buf, &c->buf_alloc, c->buf_cap, 1);
+	/* head must start empty; stale chain links are never followed */
+	if (hsize <= c->head_alloc) {
+		memset (c->head, 0, hsize * sizeof (uint32_t));
+	} else {
+		c->head = (uint32_t *)zstd_reserve (c->head, &c->head_alloc, hsize, sizeof (uint32_t));
+	}
+	c->chain = (uint32_t *)zstd_reserve (c->chain, &c->chain_alloc, wsize, sizeof (uint32_t));
+	if (c->blk_max > c->blk_alloc) {
+		free (c->lits);
+		free (c->seqs);
+		free (c->ll_code);
+		free (c->out);
+		c->lits = (uint8_t *)malloc (c->blk_max);
+		c->seqs = (zstd_seq *)malloc (seq_cap * sizeof (zstd_seq));
+		c->ll_code = (uint8_t *)malloc (seq_cap * 3);
+		c->out = (uint8_t *)malloc (ZSTD_FRAME_HEADER_MAX + 3 + c->blk_max);
+		c->blk_alloc = c->blk_max;
+	}
+	if (!c->buf || !c->head || !c->chain || !c->lits || !c->seqs || !c->ll_code || !c->out) {
+		c->blk_alloc = 0;
+		return -1;
+	}
+	seq_cap = c->blk_alloc / ZSTD_MIN_MATCH + 1;
+	c->ml_code = c->ll_code + seq_cap;
+	c->of_code = c->ml_code + seq_cap;
+	zstd_fse_build_ctable (&c->ll_pre, zstd_ll_norm, ZSTD_LL_MAX, ZSTD_LL_PRE_LOG);
+	zstd_fse_build_ctable (&c->ml_pre, zstd_ml_norm, ZSTD_ML_MAX, ZSTD_ML_PRE_LOG);
+	zstd_fse_build_ctable (&c->of_pre, zstd_of_norm, ZSTD_OF_PRE_MAX, ZSTD_OF_PRE_LOG);
+	return 0;
+}
+
+static size_t zstd_write_frame_header(uint8_t *dst, int single_segment, uint64_t size, unsigned window_log) {
+	size_t n = 4;
+	zstd_write_le32 (dst, ZSTD_MAGIC_NUMBER);
+	if (!single_segment) {
+		dst[n++] = 0;
+		dst[n++] = (uint8_t)((window_log - 10) << 3);
+		return n;
+	}
+	if (size < 256) {
+		dst[n++] = 0x20;
+		dst[n++] = (uint8_t)size;
+	} else if (size < 65536 + 256) {
+		dst[n++] = 0x60;
+		zstd_write_le16 (dst + n, (uint32_t)(size - 256));
+		n += 2;
+	} else if (size <= 0xFFFFFFFFu) {
+		dst[n++] = 0xA0;
+		zstd_write_le32 (dst + n, (uint32_t)size);
+		n += 4;
+	} else {
+		dst[n++] = 0xE0;
+		zstd_write_le32 (dst + n, (uint32_t)size);
+		zstd_write_le32 (dst + n + 4, (uint32_t)(size >> 32));
+		n += 8;
+	}
+	return n;
+}
+
+/* Level parameters and frame state for a new frame */
+static void zstd_cctx_start(zstd_compress_context *c) {
+	const int level = c->compression_level;
+	c->window_log = zstd_levels[level].window_log;
+	c->hash_log = zstd_levels[level].hash_log;
+	c->depth = zstd_levels[level].depth;
+	c->lazy = zstd_levels[level].lazy;
+	c->nice = zstd_levels[level].nice;
+	c->reps[0] = 1;
+	c->reps[1] = 4;
+	c->reps[2] = 8;
+	c->buf_len = 0;
+	c->blk_start = 0;
+	c->next_ins = 0;
+	c->n_lits = 0;
+	c->n_seq = 0;
+	c->out_len = 0;
+	c->out_pos = 0;
+	c->started = 0;
+	c->finished = 0;
+}
+
+/* --- Zstandard API Implementation --- */
+
+/* Initialize a compression stream */
+int zstdInit(z_stream *strm, int level) {
+	if (!strm) {
+		return Z_STREAM_ERROR;
+	}
+
+	/* Setup default level */
+	if (level == Z_DEFAULT_COMPRESSION || level == 0) {
+		level = ZSTD_DEFAULT_CLEVEL;
+	}
+	if (level < 1) {
+		level = 1;
+	} else if (level > 9) {
+		level = 9;
+	}
+
+	/* Allocate compression context */
+	zstd_compress_context *ctx = (zstd_compress_context *)calloc (1, sizeof (zstd_compress_context));
+	if (!ctx) {
+		return Z_MEM_ERROR;
+	}
+
+	/* Buffers are sized on the first zstdCompress call, once it is known
+	 * whether the whole input comes at once */
+	ctx->compression_level = level;
+	zstd_cctx_start (ctx);
+
+	/* Initialize stream counters */
+	strm->state = (void *)ctx;
+	strm->total_in = 0;
+	strm->total_out = 0;
+
+	return Z_OK;
+}
+
+/* Compress data using Zstandard format */
+int zstdCompress(z_stream *strm, int flush) {
 	if (!strm || !strm->state) {
 		return Z_STREAM_ERROR;
 	}
 
-	zstd_decompress_context *ctx = (zstd_decompress_context *)strm->state;
+	zstd_compress_context *ctx = (zstd_compress_context *)strm->state;
+	if (!ctx->started) {
+		int known = flush == Z_FINISH;
+		if (zstd_cctx_alloc (ctx, known, strm->avail_in) != 0) {
+			return Z_MEM_ERROR;
+		}
+		ctx->out_len = zstd_write_frame_header (ctx->out, known, strm->avail_in, ctx->window_log);
+		ctx->started = 1;
+	}
 
-	/* Free allocated buffers */
-	free (ctx->window_buffer);
-	free (ctx->decompress_buffer);
-	if (ctx->dict) {
-		free (ctx->dict);
+	uLong in0 = strm->total_in;
+	uLong out0 = strm->total_out;
+	for (;;) {
+		/* Drain queued output first */
+		if (ctx->out_pos < ctx->out_len) {
+			size_t n = ctx->out_len - ctx->out_pos;
+			if (n > strm->avail_out) {
+				n = strm->avail_out;
+			}
+			memcpy (strm->next_out, ctx->out + ctx->out_pos, n);
+			strm->next_out += n;
+			strm->avail_out -= (uInt)n;
+			strm->total_out += n;
+			ctx->out_pos += n;
+			if (ctx->out_pos < ctx->out_len) {
+				break;
+			}
+		}
+		ctx->out_pos = ctx->out_len = 0;
+		if (ctx->finished) {
+			return Z_STREAM_END;
+		}
+
+		/* Fill the current block */
+		size_t fill = ctx->buf_len - ctx->blk_start;
+		if (fill < ctx->blk_max && strm->avail_in > 0) {
+			if (ctx->buf_len + (ctx->blk_max - fill) > ctx->buf_cap) {
+				zstd_slide (ctx);
+			}
+			size_t n = ctx->blk_max - fill;
+			if (n > ctx->buf_cap - ctx->buf_len) {
+				n = ctx->buf_cap - ctx->buf_len;
+			}
+			if (n > strm->avail_in) {
+				n = strm->avail_in;
+			}
+			if (n == 0) {
+				/* more input than announced for a single-segment frame */
+				return Z_STREAM_ERROR;
+			}
+			memcpy (ctx->buf + ctx->buf_len, strm->next_in, n);
+			strm->next_in += n;
+			strm->avail_in -= (uInt)n;
+			strm->total_in += n;
+			ctx->buf_len += n;
+			fill += n;
+		}
+
+		int last = flush == Z_FINISH && strm->avail_in == 0;
+		if (!last) {
+			if (fill < ctx->blk_max) {
+				if (strm->avail_in > 0) {
+					continue;
+				}
+				if (fill == 0 || (flush != Z_SYNC_FLUSH && flush != Z_FULL_FLUSH)) {
+					break;
+				}
+			} else if (strm->avail_in == 0 && flush == Z_NO_FLUSH) {
+				/* a full block may still turn out to be the last one */
+				break;
+			}
+		}
+		zstd_emit_block (ctx, fill, last);
+		ctx->finished = last;
+	}
+
+	if (strm->total_in == in0 && strm->total_out == out0) {
+		return Z_BUF_ERROR;
+	}
+	return Z_OK;
+}
+
+/* Start a new frame at the same level, keeping the buffers */
+int zstdReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
 	}
+	zstd_cctx_start ((zstd_compress_context *)strm->state);
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+/* End a compression stream */
+int zstdEnd(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+
+	zstd_compress_context *ctx = (zstd_compress_context *)strm->state;
+
+	/* Free allocated buffers */
+	free (ctx->buf);
+	free (ctx->head);
+	free (ctx->chain);
+	free (ctx->lits);
+	free (ctx->seqs);
+	free (ctx->ll_code);
+	free (ctx->out);
 
 	/* Free context */
 	free (ctx);
@@ -726,6 +1731,1229 @@ int zstdDecompressEnd(z_stream *strm) {
 	return Z_OK;
 }
 
+/* --- Decompression --- */
+
+/* Backward bit reader over a stream whose last byte holds the end marker */
+typedef struct {
+	const uint8_t *start;
+	const uint8_t *ptr;
+	uint64_t bits;
+	unsigned consumed;
+} zstd_bitr;
+
+static int zstd_br_init(zstd_bitr *br, const uint8_t *src, size_t n) {
+	if (n == 0 || src[n - 1] == 0) {
+		return -1;
+	}
+	br->start = src;
+	if (n >= 8) {
+		br->ptr = src + n - 8;
+		br->bits = zstd_read_le64 (br->ptr);
+		br->consumed = 8 - zstd_highbit (src[n - 1]);
+	} else {
+		br->ptr = src;
+		br->bits = 0;
+		for (size_t i = 0; i < n; i++) {
+			br->bits |= (uint64_t)src[i] << (8 * i);
+		}
+		br->consumed = 8 - zstd_highbit (src[n - 1]) + (unsigned)(8 - n) * 8;
+	}
+	return 0;
+}
+
+static inline uint64_t zstd_br_peek(const zstd_bitr *br, unsigned n) {
+	return ((br->bits << (br->consumed & 63)) >> 1) >> (63 - n);
+}
+
+static inline uint64_t zstd_br_read(zstd_bitr *br, unsigned n) {
+	uint64_t v = zstd_br_peek (br, n);
+	br->consumed += n;
+	return v;
+}
+
+/* Refill so at least 57 bits are available unless the stream runs out.
+ * Returns non-zero once more bits were read than the stream holds. */
+static inline int zstd_br_reload(zstd_bitr *br) {
+	if (br->consumed > 64) {
+		return 1;
+	}
+	if (br->ptr >= br->start + 8) {
+		br->ptr -= br->consumed >> 3;
+		br->consumed &= 7;
+	} else if (br->ptr == br->start) {
+		return 0;
+	} else {
+		size_t nb = br->consumed >> 3;
+		if (nb > (size_t)(br->ptr - br->start)) {
+			nb = (size_t)(br->ptr - br->start);
+		}
+		br->ptr -= nb;
+		br->consumed -= (unsigned)nb * 8;
+	}
+	br->bits = zstd_read_le64 (br->ptr);
+	return 0;
+}
+
+static inline int zstd_br_finished(const zstd_bitr *br) {
+	return br->ptr == br->start && br->consumed == 64;
+}
+
+/* Up to 16 bits of a forward little-endian bit stream, zeros past the end */
+static inline uint32_t zstd_nc_bits(const uint8_t *src, size_t n, size_t pos, unsigned nb) {
+	size_t i = pos >> 3;
+	uint32_t v = 0;
+	for (unsigned k = 0; k < 4 && i + k < n; k++) {
+		v |= (uint32_t)src[i + k] << (8 * k);
+	}
+	return (v >> (pos & 7)) & ((1u << nb) - 1);
+}
+
+/* Parse an FSE table description. Returns the bytes used or -1. */
+static int zstd_fse_read_ncount(int16_t *norm, unsigned *max_sym, unsigned *log, unsigned max_log, const uint8_t *src, size_t n) {
+	size_t pos = 0; /* in bits */
+	unsigned limit = *max_sym;
+	if (n == 0) {
+		return -1;
+	}
+	*log = (src[0] & 15) + 5;
+	pos = 4;
+	if (*log > max_log) {
+		return -1;
+	}
+	int size = 1 << *log;
+	int remaining = size + 1;
+	int threshold = size;
+	unsigned nb = *log + 1;
+	unsigned s = 0;
+	int prev0 = 0;
+	while (remaining > 1 && s <= limit) {
+		if (prev0) {
+			unsigned n0 = s;
+			while (zstd_nc_bits (src, n, pos, 16) == 0xFFFF) {
+				n0 += 24;
+				pos += 16;
+			}
+			while (zstd_nc_bits (src, n, pos, 2) == 3) {
+				n0 += 3;
+				pos += 2;
+			}
+			n0 += zstd_nc_bits (src, n, pos, 2);
+			pos += 2;
+			if (n0 > limit) {
+				return -1;
+			}
+			while (s < n0) {
+				norm[s++] = 0;
+			}
+		}
+		int max = (2 * threshold - 1) - remaining;
+		int count;
+		uint32_t low = zstd_nc_bits (src, n, pos, nb - 1);
+		if ((int)low < max) {
+			count = (int)low;
+			pos += nb - 1;
+		} else {
+			count = (int)zstd_nc_bits (src, n, pos, nb);
+			if (count >= threshold) {
+				count -= max;
+			}
+			pos += nb;
+		}
+		count--;
+		remaining -= count < 0? -count: count;
+		norm[s++] = (int16_t)count;
+		prev0 = count == 0;
+		while (remaining < threshold) {
+			nb--;
+			threshold >>= 1;
+		}
+	}
+	if (remaining != 1 || (pos + 7) / 8 > n) {
+		return -1;
+	}
+	*max_sym = s - 1;
+	return (int)((pos + 7) / 8);
+}
+
+static int zstd_fse_build_dtable(zstd_fse_cell *dt, const int16_t *norm, unsigned max_sym, unsigned log) {
+	uint8_t spread[1 << ZSTD_LL_LOG];
+	uint16_t next[ZSTD_ML_MAX + 1];
+	uint32_t size = 1u << log;
+	if (zstd_fse_spread (spread, norm, max_sym, log) != 0) {
+		return -1;
+	}
+	for (unsigned s = 0; s <= max_sym; s++) {
+		next[s] = (uint16_t)(norm[s] == -1? 1: norm[s]);
+	}
+	for (uint32_t u = 0; u < size; u++) {
+		unsigned s = spread[u];
+		uint32_t ns = next[s]++;
+		unsigned nb = log - zstd_highbit (ns);
+		dt[u].sym = (uint8_t)s;
+		dt[u].nb = (uint8_t)nb;
+		dt[u].base = (uint16_t)((ns << nb) - size);
+	}
+	return 0;
+}
+
+/* Huffman weights compressed with two interleaved FSE states; returns
+ * the number decoded or -1 */
+static int zstd_huf_decode_weights(uint8_t *w, const uint8_t *src, size_t n) {
+	int16_t norm[16];
+	unsigned max_sym = 15;
+	unsigned log;
+	zstd_fse_cell dt[1 << 6];
+	int hn = zstd_fse_read_ncount (norm, &max_sym, &log, 6, src, n);
+	if (hn < 0 || zstd_fse_build_dtable (dt, norm, max_sym, log) != 0) {
+		return -1;
+	}
+	zstd_bitr br;
+	if (zstd_br_init (&br, src + hn, n - (size_t)hn) != 0) {
+		return -1;
+	}
+	uint32_t s1 = (uint32_t)zstd_br_read (&br, log);
+	uint32_t s2 = (uint32_t)zstd_br_read (&br, log);
+	zstd_br_reload (&br);
+	int out = 0;
+	for (;;) {
+		if (out > 253) {
+			return -1;
+		}
+		w[out++] = dt[s1].sym;
+		s1 = dt[s1].base + (uint32_t)zstd_br_read (&br, dt[s1].nb);
+		if (zstd_br_reload (&br)) {
+			w[out++] = dt[s2].sym;
+			break;
+		}
+		w[out++] = dt[s2].sym;
+		s2 = dt[s2].base + (uint32_t)zstd_br_read (&br, dt[s2].nb);
+		if (zstd_br_reload (&br)) {
+			w[out++] = dt[s1].sym;
+			break;
+		}
+	}
+	return out;
+}
+
+/* Read a Huffman tree description into the context; returns bytes used */
+static int zstd_huf_read_table(zstd_decompress_context *d, const uint8_t *src, size_t n) {
+	uint8_t w[256];
+	int nw;
+	size_t used;
+	if (n < 1) {
+		return -1;
+	}
+	if (src[0] >= 128) {
+		nw = src[0] - 127;
+		used = 1 + (size_t)(nw + 1) / 2;
+		if (used > n) {
+			return -1;
+		}
+		for (int i = 0; i < nw; i++) {
+			uint8_t b = src[1 + i / 2];
+			w[i] = (uint8_t)((i & 1)? b & 15: b >> 4);
+		}
+	} else {
+		used = 1 + (size_t)src[0];
+		if (used > n) {
+			return -1;
+		}
+		nw = zstd_huf_decode_weights (w, src + 1, src[0]);
+		if (nw < 0) {
+			return -1;
+		}
+	}
+	uint32_t total = 0;
+	uint32_t rank[ZSTD_HUF_MAX_BITS + 2] = { 0 };
+	for (int i = 0; i < nw; i++) {
+		if (w[i] > ZSTD_HUF_MAX_BITS) {
+			return -1;
+		}
+		if (w[i]) {
+			total += 1u << (w[i] - 1);
+		}
+	}
+	if (!total) {
+		return -1;
+	}
+	unsigned log = zstd_highbit (total) + 1;
+	if (log > ZSTD_HUF_MAX_BITS) {
+		return -1;
+	}
+	uint32_t rest = (1u << log) - total;
+	if (rest & (rest - 1)) {
+		return -1;
+	}
+	w[nw++] = (uint8_t)(zstd_highbit (rest) + 1);
+	for (int i = 0; i < nw; i++) {
+		if (w[i]) {
+			rank[w[i]] += 1u << (w[i] - 1);
+		}
+	}
+	uint32_t next = 0;
+	for (unsigned k = 1; k <= log; k++) {
+		uint32_t cur = next;
+		next += rank[k];
+		rank[k] = cur;
+	}
+	for (int s = 0; s < nw; s++) {
+		if (!w[s]) {
+			continue;
+		}
+		uint32_t len = 1u << (w[s] - 1);
+		uint16_t v = (uint16_t)(s | ((log + 1 - w[s]) << 8));
+		for (uint32_t k = 0; k < len; k++) {
+			d->huf[rank[w[s]] + k] = v;
+		}
+		rank[w[s]] += len;
+	}
+	d->huf_log = log;
+	d->have_huf = 1;
+	return (int)used;
+}
+
+/* Refill without bounds checks; only valid while ptr >= start + 8 */
+static inline void zstd_br_reload_fast(zstd_bitr *br) {
+	br->ptr -= br->consumed >> 3;
+	br->consumed &= 7;
+	br->bits = zstd_read_le64 (br->ptr);
+}
+
+static inline void zstd_huf_sym(const uint16_t *tab, unsigned log, zstd_bitr *br, uint8_t *op) {
+	uint16_t v = tab[zstd_br_peek (br, log)];
+	*op = (uint8_t)v;
+	br->consumed += v >> 8;
+}
+
+/* Decode one or four Huffman streams of sz[] bytes into dst. The streams
+ * run in lockstep, four symbols each per refill, while all of them are
+ * far from their start; the tails are finished one symbol at a time. */
+static int zstd_huf_decode_streams(const zstd_decompress_context *d, const uint8_t *src, const size_t *sz, int ns, uint8_t *dst, size_t regen) {
+	const uint16_t *tab = d->huf;
+	unsigned log = d->huf_log;
+	zstd_bitr br[4];
+	uint8_t *op[4];
+	uint8_t *oend[4];
+	size_t seg = ns == 1? regen: (regen + 3) / 4;
+	if (ns > 1 && 3 * seg > regen) {
+		return -1;
+	}
+	for (int k = 0; k < ns; k++) {
+		if (zstd_br_init (&br[k], src, sz[k]) != 0) {
+			return -1;
+		}
+		src += sz[k];
+		op[k] = dst + (size_t)k * seg;
+		oend[k] = k + 1 < ns? op[k] + seg: dst + regen;
+	}
+	for (;;) {
+		int k;
+		for (k = 0; k < ns; k++) {
+			if (oend[k] - op[k] < 4 || br[k].ptr < br[k].start + 8) {
+				break;
+			}
+		}
+		if (k < ns) {
+			break;
+		}
+		for (k = 0; k < ns; k++) {
+			zstd_br_reload_fast (&br[k]);
+		}
+		for (int j = 0; j < 4; j++) {
+			for (k = 0; k < ns; k++) {
+				zstd_huf_sym (tab, log, &br[k], op[k]++);
+			}
+		}
+	}
+	for (int k = 0; k < ns; k++) {
+		while (op[k] < oend[k]) {
+			zstd_br_reload (&br[k]);
+			zstd_huf_sym (tab, log, &br[k], op[k]++);
+		}
+		if (!zstd_br_finished (&br[k])) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* Decode the literals section. Raw literals stay in src, anything else
+ * lands in d->lits; *lit_wild is how far copies may read past them.
+ * src_end bounds the readable input after src. Returns the bytes used
+ * or -1. */
+static int zstd_decode_literals(zstd_decompress_context *d, const uint8_t *src, size_t n, const uint8_t *src_end,
+	const uint8_t **lit, size_t *lit_len, const uint8_t **lit_wild) {
+	if (n < 1) {
+		return -1;
+	}
+	unsigned type = src[0] & 3;
+	unsigned sf = (src[0] >> 2) & 3;
+	*lit_wild = d->lits + sizeof (d->lits);
+	if (type < 2) {
+		size_t hl, size;
+		if ((sf & 1) == 0) {
+			hl = 1;
+			size = src[0] >> 3;
+		} else if (sf == 1) {
+			hl = 2;
+			if (n < hl) {
+				return -1;
+			}
+			size = (size_t)(src[0] >> 4) | ((size_t)src[1] << 4);
+		} else {
+			hl = 3;
+			if (n < hl) {
+				return -1;
+			}
+			size = (size_t)(src[0] >> 4) | ((size_t)src[1] << 4) | ((size_t)src[2] << 12);
+		}
+		if (size > ZSTD_BLOCK_MAX_SIZE) {
+			return -1;
+		}
+		*lit_len = size;
+		if (type == 0) {
+			if (n < hl + size) {
+				return -1;
+			}
+			*lit = src + hl;
+			*lit_wild = src_end;
+			return (int)(hl + size);
+		}
+		if (n < hl + 1) {
+			return -1;
+		}
+		memset (d->lits, src[hl], size);
+		*lit = d->lits;
+		return (int)(hl + 1);
+	}
+
+	/* Huffman-coded, with a new tree or the previous one */
+	size_t hl = sf < 2? 3: sf == 2? 4: 5;
+	unsigned bits = sf < 2? 10: sf == 2? 14: 18;
+	if (n < hl) {
+		return -1;
+	}
+	uint64_t h = 0;
+	for (size_t i = 0; i < hl; i++) {
+		h |= (uint64_t)src[i] << (8 * i);
+	}
+	size_t regen = (size_t)((h >> 4) & ((1u << bits) - 1));
+	size_t comp = (size_t)((h >> (4 + bits)) & ((1u << bits) - 1));
+	if (regen > ZSTD_BLOCK_MAX_SIZE || hl + comp > n) {
+		return -1;
+	}
+	const uint8_t *p = src + hl;
+	const uint8_t *pend = p + comp;
+	if (type == 2) {
+		int tn = zstd_huf_read_table (d, p, comp);
+		if (tn < 0) {
+			return -1;
+		}
+		p += tn;
+	} else if (!d->have_huf) {
+		return -1;
+	}
+	size_t sz[4];
+	int ns = 1;
+	if (sf == 0) {
+		sz[0] = (size_t)(pend - p);
+	} else {
+		if (pend - p < 6) {
+			return -1;
+		}
+		sz[0] = (size_t)p[0] | ((size_t)p[1] << 8);
+		sz[1] = (size_t)p[2] | ((size_t)p[3] << 8);
+		sz[2] = (size_t)p[4] | ((size_t)p[5] << 8);
+		p += 6;
+		if (sz[0] + sz[1] + sz[2] > (size_t)(pend - p)) {
+			return -1;
+		}
+		sz[3] = (size_t)(pend - p) - sz[0] - sz[1] - sz[2];
+		ns = 4;
+	}
+	if (zstd_huf_decode_streams (d, p, sz, ns, d->lits, regen) != 0) {
+		return -1;
+	}
+	*lit = d->lits;
+	*lit_len = regen;
+	return (int)(hl + comp);
+}
+
+/* Expand an FSE table for one sequence field. base and bits give the
+ * code's baseline and extra bits; NULL means offset codes (1 << code). */
+static int zstd_seq_build(zstd_seq_cell *dt, const int16_t *norm, unsigned max_sym, unsigned log, const uint32_t *base, const uint8_t *bits) {
+	zstd_fse_cell cells[1 << ZSTD_LL_LOG];
+	if (zstd_fse_build_dtable (cells, norm, max_sym, log) != 0) {
+		return -1;
+	}
+	for (uint32_t u = 0; u < (1u << log); u++) {
+		unsigned s = cells[u].sym;
+		dt[u].value = base? base[s]: 1u << s;
+		dt[u].extra = (uint8_t)(bits? bits[s]: s);
+		dt[u].next = cells[u].base;
+		dt[u].nb = cells[u].nb;
+	}
+	return 0;
+}
+
+/* Set up one sequence decoding table. Returns the bytes used or -1. */
+static int zstd_seq_table(zstd_seq_cell *dt, unsigned *log, unsigned mode, const int16_t *pre_norm, unsigned pre_max, unsigned pre_log,
+	unsigned max_sym, unsigned max_log, const uint32_t *base, const uint8_t *bits, int have, const uint8_t *src, size_t n) {
+	int16_t norm[ZSTD_ML_MAX + 1];
+	unsigned ms = max_sym;
+	int used;
+	switch (mode) {
+	case 0:
+		*log = pre_log;
+		return zstd_seq_build (dt, pre_norm, pre_max, pre_log, base, bits);
+	case 1:
+		if (n < 1 || src[0] > max_sym) {
+			return -1;
+		}
+		dt[0].value = base? base[src[0]]: 1u << src[0];
+		dt[0].extra = (uint8_t)(bits? bits[src[0]]: src[0]);
+		dt[0].next = 0;
+		dt[0].nb = 0;
+		*log = 0;
+		return 1;
+	case 2:
+		used = zstd_fse_read_ncount (norm, &ms, log, max_log, src, n);
+		if (used < 0 || zstd_seq_build (dt, norm, ms, *log, base, bits) != 0) {
+			return -1;
+		}
+		return used;
+	default:
+		return have? 0: -1;
+	}
+}
+
+/* Copy 16 bytes at a time; may write up to 15 bytes past dst + n */
+static inline void zstd_wildcopy(uint8_t *dst, const uint8_t *src, size_t n) {
+	uint8_t *end = dst + n;
+	do {
+		memcpy (dst, src, 16);
+		dst += 16;
+		src += 16;
+	} while (dst < end);
+}
+
+/* Copy a match of ml bytes from off back. Chunked copies overrun by up to
+ * 15 bytes, so they are only used when that stays below owild. */
+static inline void zstd_copy_match(uint8_t *op, size_t off, size_t ml, const uint8_t *owild) {
+	const uint8_t *match = op - off;
+	uint8_t *end = op + ml;
+	if ((size_t)(owild - op) < ml + 16) {
+		if (off >= ml) {
+			memcpy (op, match, ml);
+		} else {
+			while (op < end) {
+				*op++ = *match++;
+			}
+		}
+		return;
+	}
+	if (off >= 16) {
+		zstd_wildcopy (op, match, ml);
+	} else if (off >= 8) {
+		do {
+			memcpy (op, match, 8);
+			op += 8;
+			match += 8;
+		} while (op < end);
+	} else {
+		/* spread the pattern over 8 bytes, then copy from a distance
+		 * that is a multiple of off and at least 8 */
+		for (int k = 0; k < 8; k++) {
+			op[k] = match[k];
+		}
+		size_t dist = off * ((8 + off - 1) / off);
+		for (uint8_t *p = op + 8; p < end; p += 8) {
+			memcpy (p, p - dist, 8);
+		}
+	}
+}
+
+/* Decode one compressed block into op. base is the oldest history byte
+ * matches may reach, oend bounds the output and owild the scratch space
+ * copies may overrun into; src_end bounds the readable input after src.
+ * Returns the bytes produced or -1. */
+static int64_t zstd_decode_block(zstd_decompress_context *d, const uint8_t *src, size_t n, const uint8_t *src_end,
+	const uint8_t *base, uint8_t *op, uint8_t *oend, const uint8_t *owild) {
+	const uint8_t *lit;
+	const uint8_t *lit_wild;
+	size_t lit_len;
+	int ln = zstd_decode_literals (d, src, n, src_end, &lit, &lit_len, &lit_wild);
+	if (ln < 0) {
+		return -1;
+	}
+	const uint8_t *ip = src + ln;
+	const uint8_t *iend = src + n;
+	uint8_t *ostart = op;
+	if (ip >= iend) {
+		return -1;
+	}
+	size_t nseq = *ip++;
+	if (nseq >= 128) {
+		if (nseq == 255) {
+			if (iend - ip < 2) {
+				return -1;
+			}
+			nseq = ((size_t)ip[0] | ((size_t)ip[1] << 8)) + 0x7F00;
+			ip += 2;
+		} else {
+			if (iend - ip < 1) {
+				return -1;
+			}
+			nseq = ((nseq - 128) << 8) + *ip++;
+		}
+	}
+	const uint8_t *lend = lit + lit_len;
+	if (nseq > 0) {
+		if (ip >= iend || (*ip & 3)) {
+			return -1;
+		}
+		unsigned modes = *ip++;
+		int used = zstd_seq_table (d->ll, &d->ll_log, modes >> 6, zstd_ll_norm, ZSTD_LL_MAX, ZSTD_LL_PRE_LOG, ZSTD_LL_MAX, ZSTD_LL_LOG,
+			zstd_ll_base, zstd_ll_bits, d->have_tables, ip, (size_t)(iend - ip));
+		if (used < 0) {
+			return -1;
+		}
+		ip += used;
+		used = zstd_seq_table (d->of, &d->of_log, (modes >> 4) & 3, zstd_of_norm, ZSTD_OF_PRE_MAX, ZSTD_OF_PRE_LOG, ZSTD_OF_MAX, ZSTD_OF_LOG,
+			NULL, NULL, d->have_tables, ip, (size_t)(iend - ip));
+		if (used < 0) {
+			return -1;
+		}
+		ip += used;
+		used = zstd_seq_table (d->ml, &d->ml_log, (modes >> 2) & 3, zstd_ml_norm, ZSTD_ML_MAX, ZSTD_ML_PRE_LOG, ZSTD_ML_MAX, ZSTD_ML_LOG,
+			zstd_ml_base, zstd_ml_bits, d->have_tables, ip, (size_t)(iend - ip));
+		if (used < 0) {
+			return -1;
+		}
+		ip += used;
+		d->have_tables = 1;
+
+		zstd_bitr br;
+		if (zstd_br_init (&br, ip, (size_t)(iend - ip)) != 0) {
+			return -1;
+		}
+		uint32_t ll_state = (uint32_t)zstd_br_read (&br, d->ll_log);
+		uint32_t of_state = (uint32_t)zstd_br_read (&br, d->of_log);
+		uint32_t ml_state = (uint32_t)zstd_br_read (&br, d->ml_log);
+		zstd_br_reload (&br);
+		for (size_t i = 0; i < nseq; i++) {
+			/* a refill leaves 57 bits: the offset and match length fit,
+			 * the literal length and state updates need another refill
+			 * only when the extra bits are long */
+			const zstd_seq_cell *lc = &d->ll[ll_state];
+			const zstd_seq_cell *mc = &d->ml[ml_state];
+			const zstd_seq_cell *oc = &d->of[of_state];
+			uint32_t ob = oc->value + (uint32_t)zstd_br_read (&br, oc->extra);
+			size_t ml = mc->value + (uint32_t)zstd_br_read (&br, mc->extra);
+			if (oc->extra + mc->extra + lc->extra > 31) {
+				zstd_br_reload (&br);
+			}
+			size_t ll = lc->value + (uint32_t)zstd_br_read (&br, lc->extra);
+			if (i + 1 < nseq) {
+				ll_state = lc->next + (uint32_t)zstd_br_read (&br, lc->nb);
+				ml_state = mc->next + (uint32_t)zstd_br_read (&br, mc->nb);
+				of_state = oc->next + (uint32_t)zstd_br_read (&br, oc->nb);
+			}
+			zstd_br_reload (&br);
+			size_t off = zstd_update_reps (d->reps, ob, ll == 0);
+			if (ll > (size_t)(lend - lit) || ll + ml > (size_t)(oend - op)) {
+				return -1;
+			}
+			if ((size_t)(owild - op) >= ll + 16 && (size_t)(lit_wild - lit) >= ll + 16) {
+				zstd_wildcopy (op, lit, ll);
+			} else {
+				memcpy (op, lit, ll);
+			}
+			op += ll;
+			lit += ll;
+			if (off == 0 || off > (size_t)(op - base) || off > d->window_size) {
+				return -1;
+			}
+			zstd_copy_match (op, off, ml, owild);
+			op += ml;
+		}
+		if (!zstd_br_finished (&br)) {
+			return -1;
+		}
+	} else if (ip != iend) {
+		return -1;
+	}
+	size_t rest = (size_t)(lend - lit);
+	if (rest > (size_t)(oend - op)) {
+		return -1;
+	}
+	memcpy (op, lit, rest);
+	op += rest;
+	return op - ostart;
+}
+
+/* --- Frame checksum (XXH64, seed 0) --- */
+
+#define ZSTD_XXH_P1 0x9E3779B185EBCA87ULL
+#define ZSTD_XXH_P2 0xC2B2AE3D27D4EB4FULL
+#define ZSTD_XXH_P3 0x165667B19E3779F9ULL
+#define ZSTD_XXH_P4 0x85EBCA77C2B2AE63ULL
+#define ZSTD_XXH_P5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t zstd_rotl64(uint64_t x, unsigned r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t zstd_xxh_round(uint64_t acc, uint64_t v) {
+	acc += v * ZSTD_XXH_P2;
+	return zstd_rotl64 (acc, 31) * ZSTD_XXH_P1;
+}
+
+static void zstd_xxh_init(zstd_xxh64 *x) {
+	x->v[0] = ZSTD_XXH_P1 + ZSTD_XXH_P2;
+	x->v[1] = ZSTD_XXH_P2;
+	x->v[2] = 0;
+	x->v[3] = 0 - ZSTD_XXH_P1;
+	x->total = 0;
+	x->mem_len = 0;
+}
+
+static inline void zstd_xxh_stripe(zstd_xxh64 *x, const uint8_t *p) {
+	for (int k = 0; k < 4; k++) {
+		x->v[k] = zstd_xxh_round (x->v[k], zstd_read_le64 (p + 8 * k));
+	}
+}
+
+static void zstd_xxh_update(zstd_xxh64 *x, const uint8_t *p, size_t n) {
+	x->total += n;
+	if (x->mem_len + n < 32) {
+		memcpy (x->mem + x->mem_len, p, n);
+		x->mem_len += (unsigned)n;
+		return;
+	}
+	if (x->mem_len) {
+		size_t take = 32 - x->mem_len;
+		memcpy (x->mem + x->mem_len, p, take);
+		zstd_xxh_stripe (x, x->mem);
+		p += take;
+		n -= take;
+	}
+	for (; n >= 32; p += 32, n -= 32) {
+		zstd_xxh_stripe (x, p);
+	}
+	memcpy (x->mem, p, n);
+	x->mem_len = (unsigned)n;
+}
+
+static uint64_t zstd_xxh_digest(const zstd_xxh64 *x) {
+	uint64_t h;
+	if (x->total >= 32) {
+		h = zstd_rotl64 (x->v[0], 1) + zstd_rotl64 (x->v[1], 7) + zstd_rotl64 (x->v[2], 12) + zstd_rotl64 (x->v[3], 18);
+		for (int k = 0; k < 4; k++) {
+			h = (h ^ zstd_xxh_round (0, x->v[k])) * ZSTD_XXH_P1 + ZSTD_XXH_P4;
+		}
+	} else {
+		h = ZSTD_XXH_P5;
+	}
+	h += x->total;
+	const uint8_t *p = x->mem;
+	unsigned n = x->mem_len;
+	for (; n >= 8; p += 8, n -= 8) {
+		h ^= zstd_xxh_round (0, zstd_read_le64 (p));
+		h = zstd_rotl64 (h, 27) * ZSTD_XXH_P1 + ZSTD_XXH_P4;
+	}
+	if (n >= 4) {
+		h ^= (uint64_t)read_le32 (p) * ZSTD_XXH_P1;
+		h = zstd_rotl64 (h, 23) * ZSTD_XXH_P2 + ZSTD_XXH_P3;
+		p += 4;
+		n -= 4;
+	}
+	for (; n > 0; p++, n--) {
+		h ^= *p * ZSTD_XXH_P5;
+		h = zstd_rotl64 (h, 11) * ZSTD_XXH_P1;
+	}
+	h ^= h >> 33;
+	h *= ZSTD_XXH_P2;
+	h ^= h >> 29;
+	h *= ZSTD_XXH_P3;
+	h ^= h >> 32;
+	return h;
+}
+
+/* --- Frames --- */
+
+/* Size of the frame header starting at h, known once five bytes are in */
+static size_t zstd_header_need(const uint8_t *h, size_t n) {
+	if (n < 5) {
+		return 5;
+	}
+	if ((read_le32 (h) & 0xFFFFFFF0u) == ZSTD_SKIPPABLE_MAGIC) {
+		return 8;
+	}
+	unsigned fhd = h[4];
+	unsigned dict_flag = fhd & 3;
+	unsigned fcs_flag = fhd >> 6;
+	size_t single = (fhd >> 5) & 1;
+	return 5 + !single + (dict_flag == 3? 4: dict_flag) + (fcs_flag == 0? single: (size_t)1 << fcs_flag);
+}
+
+/* Parse a frame header and reset the per-frame state. Returns the header
+ * size, 0 when src does not hold all of it yet, or -1 with *err set. */
+static int zstd_frame_header(zstd_decompress_context *d, const uint8_t *src, size_t n, int *err) {
+	size_t need = zstd_header_need (src, n);
+	*err = Z_DATA_ERROR;
+	if (n < need) {
+		return 0;
+	}
+	uint32_t magic = read_le32 (src);
+	if ((magic & 0xFFFFFFF0u) == ZSTD_SKIPPABLE_MAGIC) {
+		d->skippable = 1;
+		d->skip_left = read_le32 (src + 4);
+		return 8;
+	}
+	if (magic != ZSTD_MAGIC_NUMBER) {
+		return -1;
+	}
+	unsigned fhd = src[4];
+	const uint8_t *ip = src + 5;
+	unsigned fcs_flag = fhd >> 6;
+	int single = (fhd >> 5) & 1;
+	unsigned dict_flag = fhd & 3;
+	if (fhd & 8) {
+		return -1;
+	}
+	size_t dict_len = dict_flag == 3? 4: dict_flag;
+	size_t fcs_len = fcs_flag == 0? (size_t)single: (size_t)1 << fcs_flag;
+	if (!single) {
+		unsigned wlog = 10 + (ip[0] >> 3);
+		uint64_t wbase = (uint64_t)1 << wlog;
+		d->window_size = wbase + (wbase / 8) * (ip[0] & 7);
+		if (d->window_size > (uint64_t)1 << ZSTD_WINDOW_LOG_MAX) {
+			return -1;
+		}
+		ip++;
+	}
+	uint32_t dict_id = 0;
+	for (size_t i = 0; i < dict_len; i++) {
+		dict_id |= (uint32_t)ip[i] << (8 * i);
+	}
+	ip += dict_len;
+	if (dict_id) {
+		*err = Z_NEED_DICT;
+		return -1;
+	}
+	d->has_content_size = fcs_len > 0;
+	d->content_size = 0;
+	for (size_t i = 0; i < fcs_len; i++) {
+		d->content_size |= (uint64_t)ip[i] << (8 * i);
+	}
+	if (fcs_len == 2) {
+		d->content_size += 256;
+	}
+	if (single) {
+		d->window_size = d->content_size;
+	}
+	d->has_checksum = (fhd >> 2) & 1;
+	d->skippable = 0;
+	d->frame_out = 0;
+	d->have_tables = 0;
+	d->have_huf = 0;
+	d->reps[0] = 1;
+	d->reps[1] = 4;
+	d->reps[2] = 8;
+	if (d->has_checksum) {
+		zstd_xxh_init (&d->xxh);
+	}
+	return (int)need;
+}
+
+/* Decode the data of one block (type 0-2) into op. Returns the bytes
+ * produced or -1. */
+static int64_t zstd_block_data(zstd_decompress_context *d, unsigned type, size_t size, const uint8_t *src, const uint8_t *src_end,
+	const uint8_t *base, uint8_t *op, uint8_t *oend, const uint8_t *owild) {
+	if (type == 2) {
+		return zstd_decode_block (d, src, size, src_end, base, op, oend, owild);
+	}
+	if (size > (size_t)(oend - op)) {
+		return -1;
+	}
+	if (type == 0) {
+		memcpy (op, src, size);
+	} else {
+		memset (op, src[0], size);
+	}
+	return (int64_t)size;
+}
+
+/* Decode a whole frame from next_in straight into next_out, used when
+ * the frame is complete in the input and its declared content size fits
+ * the output, so no window needs to be kept. Returns 1 when the frame
+ * was decoded, 0 to use the buffered path, or a negative zlib error. */
+static int zstd_decode_direct(zstd_decompress_context *d, z_stream *strm) {
+	const uint8_t *ip = strm->next_in;
+	const uint8_t *iend = ip + strm->avail_in;
+	int err;
+	int hn = zstd_frame_header (d, ip, strm->avail_in, &err);
+	if (hn <= 0) {
+		return hn < 0? err: 0;
+	}
+	if (d->skippable || !d->has_content_size || d->content_size > strm->avail_out) {
+		return 0;
+	}
+	const uint8_t *p = ip + hn;
+	for (;;) {
+		if (iend - p < 3) {
+			return 0;
+		}
+		uint32_t bh = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+		size_t size = bh >> 3;
+		if (((bh >> 1) & 3) == 3 || size > ZSTD_BLOCK_MAX_SIZE) {
+			return Z_DATA_ERROR;
+		}
+		size_t in_size = ((bh >> 1) & 3) == 1? 1: size;
+		if ((size_t)(iend - p) - 3 < in_size) {
+			return 0;
+		}
+		p += 3 + in_size;
+		if (bh & 1) {
+			break;
+		}
+	}
+	if (d->has_checksum && iend - p < 4) {
+		return 0;
+	}
+
+	uint8_t *ostart = strm->next_out;
+	uint8_t *op = ostart;
+	uint8_t *oend = ostart + d->content_size;
+	const uint8_t *owild = ostart + strm->avail_out;
+	p = ip + hn;
+	for (;;) {
+		uint32_t bh = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+		unsigned type = (bh >> 1) & 3;
+		size_t size = bh >> 3;
+		int64_t n = zstd_block_data (d, type, size, p + 3, iend, ostart, op, oend, owild);
+		if (n < 0) {
+			return Z_DATA_ERROR;
+		}
+		op += n;
+		p += 3 + (type == 1? 1: size);
+		if (bh & 1) {
+			break;
+		}
+	}
+	if ((uint64_t)(op - ostart) != d->content_size) {
+		return Z_DATA_ERROR;
+	}
+	if (d->has_checksum) {
+		zstd_xxh_update (&d->xxh, ostart, (size_t)(op - ostart));
+		if ((uint32_t)zstd_xxh_digest (&d->xxh) != read_le32 (p)) {
+			return Z_DATA_ERROR;
+		}
+		p += 4;
+	}
+
+	size_t consumed = (size_t)(p - ip);
+	size_t produced = (size_t)(op - ostart);
+	strm->next_in = p;
+	strm->avail_in -= (uInt)consumed;
+	strm->total_in += consumed;
+	strm->next_out = op;
+	strm->avail_out -= (uInt)produced;
+	strm->total_out += produced;
+	return 1;
+}
+
+/* Size the history window for a new frame: room for two windows and a
+ * block, so sliding moves each byte about once, or just the content
+ * when that is smaller */
+static int zstd_window_setup(zstd_decompress_context *d) {
+	if (d->window_size > (uint64_t)1 << ZSTD_WINDOW_LOG_MAX) {
+		return Z_DATA_ERROR;
+	}
+	uint64_t cap = 2 * d->window_size + ZSTD_BLOCK_MAX_SIZE;
+	if (d->has_content_size && d->content_size < cap) {
+		cap = d->content_size? d->content_size: 1;
+	}
+	if (cap > d->win_alloc) {
+		uint8_t *w = (uint8_t *)realloc (d->win, (size_t)cap + ZSTD_WILDCOPY_PAD);
+		if (!w) {
+			return Z_MEM_ERROR;
+		}
+		d->win = w;
+		d->win_alloc = (size_t)cap;
+	}
+	if (!d->in_buf) {
+		d->in_buf = (uint8_t *)malloc (ZSTD_BLOCK_MAX_SIZE + ZSTD_WILDCOPY_PAD);
+		if (!d->in_buf) {
+			return Z_MEM_ERROR;
+		}
+	}
+	d->win_cap = (size_t)cap;
+	d->win_pos = 0;
+	d->flush_pos = 0;
+	return Z_OK;
+}
+
+/* Move up to n input bytes into dst */
+static size_t zstd_take(z_stream *strm, uint8_t *dst, size_t n) {
+	if (n > strm->avail_in) {
+		n = strm->avail_in;
+	}
+	memcpy (dst, strm->next_in, n);
+	strm->next_in += n;
+	strm->avail_in -= (uInt)n;
+	strm->total_in += n;
+	return n;
+}
+
+/* Decode the staged or in-place block into the window */
+static int zstd_window_block(zstd_decompress_context *d, z_stream *strm) {
+	size_t in_size = d->blk_type == 1? 1: d->blk_size;
+	const uint8_t *src;
+	const uint8_t *src_end;
+	int direct = d->in_len == 0 && strm->avail_in >= in_size;
+	if (direct) {
+		src = strm->next_in;
+		src_end = src + strm->avail_in;
+	} else {
+		d->in_len += zstd_take (strm, d->in_buf + d->in_len, in_size - d->in_len);
+		if (d->in_len < in_size) {
+			return 0;
+		}
+		src = d->in_buf;
+		src_end = d->in_buf + ZSTD_BLOCK_MAX_SIZE + ZSTD_WILDCOPY_PAD;
+	}
+	if (d->win_pos + ZSTD_BLOCK_MAX_SIZE > d->win_cap) {
+		/* keep one window of history */
+		size_t keep = d->win_pos < d->window_size? d->win_pos: (size_t)d->window_size;
+		memmove (d->win, d->win + d->win_pos - keep, keep);
+		d->win_pos = keep;
+	}
+	int64_t n = zstd_block_data (d, d->blk_type, d->blk_size, src, src_end, d->win, d->win + d->win_pos,
+		d->win + d->win_cap, d->win + d->win_cap + ZSTD_WILDCOPY_PAD);
+	if (n < 0) {
+		return -1;
+	}
+	if (direct) {
+		strm->next_in += in_size;
+		strm->avail_in -= (uInt)in_size;
+		strm->total_in += in_size;
+	}
+	d->in_len = 0;
+	d->flush_pos = d->win_pos;
+	d->win_pos += (size_t)n;
+	d->frame_out += (uint64_t)n;
+	return 1;
+}
+
+/* Z_OK when a call moved any data, else Z_BUF_ERROR as zlib does */
+static inline int zstd_progress(const z_stream *strm, uLong in0, uLong out0) {
+	return (strm->total_in != in0 || strm->total_out != out0)? Z_OK: Z_BUF_ERROR;
+}
+
+/* Initialize a decompression stream */
+int zstdDecompressInit(z_stream *strm) {
+	if (!strm) {
+		return Z_STREAM_ERROR;
+	}
+
+	/* Allocate decompression context */
+	zstd_decompress_context *ctx = (zstd_decompress_context *)calloc (1, sizeof (zstd_decompress_context));
+	if (!ctx) {
+		return Z_MEM_ERROR;
+	}
+	ctx->stage = ZSTD_ST_FRAME;
+
+	/* Initialize stream */
+	strm->state = (void *)ctx;
+	strm->total_in = 0;
+	strm->total_out = 0;
+
+	return Z_OK;
+}
+
+/* Decompress data using Zstandard format. Any number of frames, including
+ * skippable ones, may follow each other. A frame that is complete in
+ * next_in and fits next_out is decoded in place; otherwise input and
+ * output may arrive in pieces and the blocks go through a history window.
+ * Returns Z_STREAM_END once a frame ends with no input left. */
+int zstdDecompress(z_stream *strm, int flush) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	(void)flush;
+
+	zstd_decompress_context *d = (zstd_decompress_context *)strm->state;
+	uLong in0 = strm->total_in;
+	uLong out0 = strm->total_out;
+	int r;
+	for (;;) {
+		switch (d->stage) {
+		case ZSTD_ST_FRAME:
+			if (d->hdr_len == 0) {
+				if (!strm->avail_in) {
+					if (d->frame_done) {
+						return Z_STREAM_END;
+					}
+					return zstd_progress (strm, in0, out0);
+				}
+				d->frame_done = 0;
+				r = zstd_decode_direct (d, strm);
+				if (r < 0) {
+					return r;
+				}
+				if (r == 1) {
+					d->frame_done = 1;
+					continue;
+				}
+			}
+			for (;;) {
+				size_t need = zstd_header_need (d->hdr, d->hdr_len);
+				if (d->hdr_len >= need) {
+					break;
+				}
+				if (!strm->avail_in) {
+					return zstd_progress (strm, in0, out0);
+				}
+				d->hdr_len += zstd_take (strm, d->hdr + d->hdr_len, need - d->hdr_len);
+			}
+			if (zstd_frame_header (d, d->hdr, d->hdr_len, &r) < 0) {
+				return r;
+			}
+			d->hdr_len = 0;
+			if (d->skippable) {
+				d->stage = ZSTD_ST_SKIP;
+				continue;
+			}
+			r = zstd_window_setup (d);
+			if (r != Z_OK) {
+				return r;
+			}
+			d->stage = ZSTD_ST_BLOCK_HDR;
+			continue;
+		case ZSTD_ST_BLOCK_HDR:
+			d->hdr_len += zstd_take (strm, d->hdr + d->hdr_len, 3 - d->hdr_len);
+			if (d->hdr_len < 3) {
+				return zstd_progress (strm, in0, out0);
+			}
+			d->hdr_len = 0;
+			{
+				uint32_t bh = (uint32_t)d->hdr[0] | ((uint32_t)d->hdr[1] << 8) | ((uint32_t)d->hdr[2] << 16);
+				d->blk_last = bh & 1;
+				d->blk_type = (bh >> 1) & 3;
+				d->blk_size = bh >> 3;
+			}
+			if (d->blk_type == 3 || d->blk_size > ZSTD_BLOCK_MAX_SIZE) {
+				return Z_DATA_ERROR;
+			}
+			d->in_len = 0;
+			d->stage = ZSTD_ST_BLOCK;
+			continue;
+		case ZSTD_ST_BLOCK:
+			r = zstd_window_block (d, strm);
+			if (r < 0) {
+				return Z_DATA_ERROR;
+			}
+			if (r == 0) {
+				return zstd_progress (strm, in0, out0);
+			}
+			d->stage = ZSTD_ST_FLUSH;
+			continue;
+		case ZSTD_ST_FLUSH:
+			{
+				size_t n = d->win_pos - d->flush_pos;
+				if (n > strm->avail_out) {
+					n = strm->avail_out;
+				}
+				memcpy (strm->next_out, d->win + d->flush_pos, n);
+				if (d->has_checksum) {
+					zstd_xxh_update (&d->xxh, d->win + d->flush_pos, n);
+				}
+				strm->next_out += n;
+				strm->avail_out -= (uInt)n;
+				strm->total_out += n;
+				d->flush_pos += n;
+			}
+			if (d->flush_pos < d->win_pos) {
+				return zstd_progress (strm, in0, out0);
+			}
+			if (!d->blk_last) {
+				d->stage = ZSTD_ST_BLOCK_HDR;
+				continue;
+			}
+			if (d->has_content_size && d->frame_out != d->content_size) {
+				return Z_DATA_ERROR;
+			}
+			d->stage = d->has_checksum? ZSTD_ST_CHECKSUM: ZSTD_ST_FRAME;
+			d->frame_done = !d->has_checksum;
+			continue;
+		case ZSTD_ST_CHECKSUM:
+			d->hdr_len += zstd_take (strm, d->hdr + d->hdr_len, 4 - d->hdr_len);
+			if (d->hdr_len < 4) {
+				return zstd_progress (strm, in0, out0);
+			}
+			d->hdr_len = 0;
+			if ((uint32_t)zstd_xxh_digest (&d->xxh) != read_le32 (d->hdr)) {
+				return Z_DATA_ERROR;
+			}
+			d->stage = ZSTD_ST_FRAME;
+			d->frame_done = 1;
+			continue;
+		default:
+			{
+				size_t n = strm->avail_in;
+				if (n > d->skip_left) {
+					n = (size_t)d->skip_left;
+				}
+				strm->next_in += n;
+				strm->avail_in -= (uInt)n;
+				strm->total_in += n;
+				d->skip_left -= n;
+			}
+			if (d->skip_left) {
+				return zstd_progress (strm, in0, out0);
+			}
+			d->stage = ZSTD_ST_FRAME;
+			d->frame_done = 1;
+			continue;
+		}
+	}
+}
+
+/* Drop any partial frame, keeping the window and staging buffers */
+int zstdDecompressReset(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+	zstd_decompress_context *d = (zstd_decompress_context *)strm->state;
+	d->stage = ZSTD_ST_FRAME;
+	d->frame_done = 0;
+	d->hdr_len = 0;
+	d->in_len = 0;
+	d->have_tables = 0;
+	d->have_huf = 0;
+	strm->total_in = 0;
+	strm->total_out = 0;
+	return Z_OK;
+}
+
+/* End a decompression stream */
+int zstdDecompressEnd(z_stream *strm) {
+	if (!strm || !strm->state) {
+		return Z_STREAM_ERROR;
+	}
+
+	/* Free context and buffers */
+	zstd_decompress_context *d = (zstd_decompress_context *)strm->state;
+	free (d->win);
+	free (d->in_buf);
+	free (d);
+	strm->state = NULL;
+
+	return Z_OK;
+}
+
 /* --- zlib compatibility layer --- */
 
 int zstdCompressInit2(z_stream *strm, int level, int windowBits, int memLevel, int strategy) {
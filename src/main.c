@@ -31,9 +31,6 @@
 extern int inflateInit2(z_stream *strm, int windowBits);
 extern int inflate(z_stream *strm, int flush);
 extern int inflateEnd(z_stream *strm);
-extern int deflateInit2(z_stream *strm, int level, int method, int windowBits, int memLevel, int strategy);
-extern int deflate(z_stream *strm, int flush);
-extern int deflateEnd(z_stream *strm);
 
 #include <limits.h>
 #include <sys/stat.h>
@@ -66,9 +63,18 @@ extern int deflateEnd(z_stream *strm);
 #define PATH_MAX 4096
 #endif
 
+#if defined(OTEZIP_ENABLE_THREADS) && !defined(_WIN32) && !defined(_WIN64) && !defined(__wasi__)
+#include <pthread.h>
+#define OTEZIP_HAVE_PTHREAD 1
+#endif
+
 /* Force overwrite flag (set via -f / --force) */
 static int g_force = 0;
 
+/* Library counters printed on exit (set via --stats) */
+static int g_show_stats = 0;
+static otezip_stats_t g_stats;
+
 /* Platform compatibility wrappers
  * - mingw/msvc provide mkdir (const char*)/_mkdir and no lstat/S_ISLNK by default.
  * - Provide small wrappers/macros so the rest of the code can use portable names. */
@@ -112,18 +118,20 @@ typedef intptr_t ssize_t;
 
 static void usage(void) {
 	puts ("mzip – minimal ZIP reader/writer (mzip.h demo)\n"
-	"Usage: mzip [-l | -x | -c | -a | -v | -d | -g] <archive.zip> [files...] [options]\n"
+	"Usage: mzip [-l | -x | -t | -c | -a | -v | -d | -g] <archive.zip> [files...] [options]\n"
 	"  -l   List contents\n"
 	"  -x   Extract all files into current directory\n"
+	"  -t   Test all files: decode them and check sizes and CRCs, writing nothing\n"
 	"  -c   Create new archive with specified files\n"
 	"  -a   Add files to existing archive\n"
 	"  -d   Decompress gzip/deflate file (gunzip mode)\n"
-	"  -g   Compress file with gzip (gzip mode)\n"
+	"  -g   Compress file with gzip (gzip mode): -g <file> [out.gz] [-j N]\n"
 	"  -v   Show version number\n\n"
 	"Options:");
 
 	/* Show compression options based on what's enabled in config */
 	puts ("  -z <method>  Use compression method (default: deflate if available, else store)");
+	puts ("      auto      Pick per file: store incompressible data, fast codec for small files, strong for large text");
 #ifdef OTEZIP_ENABLE_STORE
 	puts ("      store     Store files without compression");
 #endif
@@ -149,10 +157,66 @@ static void usage(void) {
 	"      reject (default)  - reject entries with absolute paths, empty names, '..' that escape, or symlink parents\n"
 	"      strip             - remove leading '..' components that would escape (e.g., '../../a' -> 'a')\n"
 	"      allow             - allow unsafe extraction (use with caution)\n");
+	puts ("  -j <N>          Compress (-c/-a), extract (-x) or test (-t, default: one per CPU) up to\n"
+	"                  N files in parallel, and deflate large files (-c/-a/-g) in chunks on\n"
+	"                  N threads (0 = one per CPU)\n");
 	puts ("  --verify-crc    Verify CRC32 when extracting and fail on mismatch\n");
+	puts ("  --stats         Print I/O, CRC and per-method codec counters to stderr\n");
 	puts ("  --ignore-zipbomb  Ignore zipbomb expansion checks and allow large claimed uncompressed sizes (dangerous)\n");
 }
 
+/* Start counting for za when --stats was given */
+static void watch_archive(zip_t *za) {
+	if (g_show_stats && otezip_set_stats (za, &g_stats) != 0) {
+		fprintf (stderr, "Warning: built without OTEZIP_ENABLE_STATS\n");
+		g_show_stats = 0;
+	}
+}
+
+static double ms(zip_uint64_t ns) {
+	return (double)ns / 1e6;
+}
+
+/* MB/s for bytes processed in ns */
+static double rate(zip_uint64_t bytes, zip_uint64_t ns) {
+	return ns? (double)bytes * 1e3 / (double)ns: 0.0;
+}
+
+/* Summary of g_stats, once the archive is closed */
+static void print_stats(void) {
+	const otezip_stats_t *st = &g_stats;
+	if (!g_show_stats) {
+		return;
+	}
+	fprintf (stderr, "stats: open %.3f ms\n", ms (st->open_ns));
+	fprintf (stderr, "  io     read %llu bytes in %llu calls, wrote %llu bytes in %llu calls, %llu seeks, %.3f ms\n",
+		(unsigned long long)st->bytes_read, (unsigned long long)st->reads,
+		(unsigned long long)st->bytes_written, (unsigned long long)st->writes,
+		(unsigned long long)st->seeks, ms (st->io_ns));
+	fprintf (stderr, "  crc    %llu bytes, %.3f ms (%.1f MB/s)\n", (unsigned long long)st->crc_bytes, ms (st->crc_ns), rate (st->crc_bytes, st->crc_ns));
+	fprintf (stderr, "  allocs %llu\n", (unsigned long long)st->allocs);
+	for (size_t i = 0; i < st->n_methods; i++) {
+		const otezip_method_stats_t *m = &st->methods[i];
+		const otezip_codec_t *codec = otezip_get_codec (m->method);
+		char label[16];
+		if (codec) {
+			snprintf (label, sizeof (label), "%s", codec->name);
+		} else {
+			snprintf (label, sizeof (label), "method %u", m->method);
+		}
+		if (m->compress_entries) {
+			fprintf (stderr, "  %-6s compress %llu entries, %llu -> %llu bytes, %.3f ms (%.1f MB/s)\n", label,
+				(unsigned long long)m->compress_entries, (unsigned long long)m->compress_in,
+				(unsigned long long)m->compress_out, ms (m->compress_ns), rate (m->compress_in, m->compress_ns));
+		}
+		if (m->decompress_entries) {
+			fprintf (stderr, "  %-6s decompress %llu entries, %llu -> %llu bytes, %.3f ms (%.1f MB/s)\n", label,
+				(unsigned long long)m->decompress_entries, (unsigned long long)m->decompress_in,
+				(unsigned long long)m->decompress_out, ms (m->decompress_ns), rate (m->decompress_out, m->decompress_ns));
+		}
+	}
+}
+
 static int list_files(const char *path) {
 	int err = 0;
 	zip_t *za = zip_open (path, ZIP_RDONLY, &err);
@@ -160,6 +224,7 @@ static int list_files(const char *path) {
 		fprintf (stderr, "Failed to open %s (err=%d)\n", path, err);
 		return 1;
 	}
+	watch_archive (za);
 
 	zip_uint64_t n = zip_get_num_files (za);
 	for (zip_uint64_t i = 0; i < n; ++i) {
@@ -170,11 +235,79 @@ static int list_files(const char *path) {
 	}
 
 	zip_close (za);
+	print_stats ();
 	return 0;
 }
 
-/* Function to create a new ZIP archive or add files to existing one */
-static int create_or_add_files(const char *path, char **files, int num_files, int create_mode, int compression_method) {
+static const char *test_error(int error) {
+	switch (error) {
+	case ZIP_ER_CRC:
+		return "CRC mismatch";
+	case ZIP_ER_COMPNOTSUPP:
+		return "unsupported method";
+	default:
+		return "damaged data";
+	}
+}
+
+/* -t: decode every entry on jobs threads, keeping nothing, and report
+ * each one */
+static int test_archive(const char *path, int jobs) {
+	int err = 0;
+	zip_t *za = zip_open (path, ZIP_RDONLY, &err);
+	if (!za) {
+		fprintf (stderr, "Failed to open %s (err=%d)\n", path, err);
+		return 1;
+	}
+	watch_archive (za);
+
+	zip_uint64_t n = zip_get_num_files (za);
+	otezip_test_result_t *results = (otezip_test_result_t *)calloc (n? (size_t)n: 1, sizeof (otezip_test_result_t));
+	zip_int64_t failed = results? otezip_test_archive (za, jobs, results): -1;
+	if (failed < 0) {
+		fprintf (stderr, "Failed to test %s\n", path);
+		free (results);
+		zip_close (za);
+		return 1;
+	}
+	for (zip_uint64_t i = 0; i < n; i++) {
+		const otezip_test_result_t *r = &results[i];
+		const char *name = r->name? r->name: "<unknown>";
+		if (r->error == ZIP_ER_OK) {
+			printf ("OK    %s\n", name);
+		} else {
+			printf ("FAIL  %s: %s\n", name, test_error (r->error));
+		}
+	}
+	printf ("%llu entries tested, %lld failed\n", (unsigned long long)n, (long long)failed);
+	free (results);
+	zip_close (za);
+	print_stats ();
+	return failed > 0? 1: 0;
+}
+
+/* Queued bytes after which -j flushes the batch, bounding memory use */
+#define BATCH_FLUSH_BYTES (256u * 1024u * 1024u)
+
+/* Commit queued entries and report them; names[] holds their labels
+ * and indices[] the entries they become */
+static int flush_batch(zip_t *za, int jobs, char **names, zip_int64_t *indices, int *count) {
+	int rc = otezip_batch_commit (za, jobs);
+	for (int i = 0; i < *count; i++) {
+		if (rc == 0) {
+			printf ("Added: %s (%llu bytes)\n", names[i], (unsigned long long)za->entries[indices[i]].uncomp_size);
+		}
+	}
+	if (rc != 0) {
+		fprintf (stderr, "Failed to add some files to archive\n");
+	}
+	*count = 0;
+	return rc;
+}
+
+/* Function to create a new ZIP archive or add files to existing one.
+ * With jobs > 1 files are queued and compressed in parallel. */
+static int create_or_add_files(const char *path, char **files, int num_files, int create_mode, int compression_method, int jobs) {
 	int err = 0;
 	int flags = create_mode? (ZIP_CREATE | ZIP_TRUNCATE): (ZIP_CREATE);
 
@@ -183,6 +316,8 @@ static int create_or_add_files(const char *path, char **files, int num_files, in
 		fprintf (stderr, "Failed to %s %s (err=%d)\n", create_mode? "create": "open", path, err);
 		return 1;
 	}
+	watch_archive (za);
+	otezip_set_deflate_threads (za, jobs);
 
 	/* Modify next entry to add to use specified compression method */
 	if (compression_method != 0) {
@@ -190,43 +325,33 @@ static int create_or_add_files(const char *path, char **files, int num_files, in
 		((struct zip *)za)->default_method = compression_method;
 	}
 
+	/* Labels and indices of queued files, printed once committed */
+	char **queued_names = NULL;
+	zip_int64_t *queued_indices = NULL;
+	int queued = 0;
+	zip_uint64_t queued_bytes = 0;
+	int ret = 0;
+	if (jobs > 1) {
+		queued_names = (char **)malloc ((size_t)(num_files > 0? num_files: 1) * sizeof (char *));
+		queued_indices = (zip_int64_t *)malloc ((size_t)(num_files > 0? num_files: 1) * sizeof (zip_int64_t));
+		if (!queued_names || !queued_indices) {
+			free (queued_names);
+			free (queued_indices);
+			jobs = 1;
+		}
+	}
+
 	for (int i = 0; i < num_files; i++) {
 		const char *filename = files[i];
 
-		/* Open file to read content */
-		FILE *fp = fopen (filename, "rb");
-		if (!fp) {
+		/* The file is read as it is added: small files whole, larger
+		 * ones in chunks, so memory use does not grow with file size */
+		zip_source_t *src = zip_source_file (za, filename, 0, -1);
+		if (!src) {
 			fprintf (stderr, "Cannot open file: %s\n", filename);
 			continue;
 		}
 
-		/* Get file size */
-		fseek (fp, 0, SEEK_END);
-		long file_size = ftell (fp);
-		fseek (fp, 0, SEEK_SET);
-
-		if (file_size < 0) {
-			fprintf (stderr, "Error determining file size: %s\n", filename);
-			fclose (fp);
-			continue;
-		}
-
-		/* Read file content */
-		void *buffer = malloc (file_size);
-		if (!buffer) {
-			fprintf (stderr, "Out of memory for file: %s\n", filename);
-			fclose (fp);
-			continue;
-		}
-
-		if (fread (buffer, 1, file_size, fp) != (size_t)file_size) {
-			fprintf (stderr, "Error reading file: %s\n", filename);
-			fclose (fp);
-			free (buffer);
-			continue;
-		}
-		fclose (fp);
-
 		/* Extract just the base filename */
 		const char *base_name = filename;
 		const char *slash = strrchr (filename, '/');
@@ -234,11 +359,21 @@ static int create_or_add_files(const char *path, char **files, int num_files, in
 			base_name = slash + 1;
 		}
 
-		/* Create source and add to archive */
-		zip_source_t *src = zip_source_buffer (za, buffer, file_size, 1); /* 1 = free buffer when done */
-		if (!src) {
-			fprintf (stderr, "Failed to create source for file: %s\n", filename);
-			free (buffer);
+		if (jobs > 1) {
+			zip_int64_t idx = otezip_batch_add (za, base_name, src);
+			if (idx < 0) {
+				fprintf (stderr, "Failed to add file to archive: %s\n", filename);
+				zip_source_free (src);
+				continue;
+			}
+			queued_names[queued] = (char *)base_name;
+			queued_indices[queued] = idx;
+			queued++;
+			queued_bytes += src->len == ZIP_UINT64_MAX? BATCH_FLUSH_BYTES: src->len;
+			if (queued_bytes >= BATCH_FLUSH_BYTES) {
+				ret |= flush_batch (za, jobs, queued_names, queued_indices, &queued);
+				queued_bytes = 0;
+			}
 			continue;
 		}
 
@@ -246,19 +381,25 @@ static int create_or_add_files(const char *path, char **files, int num_files, in
 		zip_int64_t idx = zip_file_add (za, base_name, src, 0);
 		if (idx < 0) {
 			fprintf (stderr, "Failed to add file to archive: %s\n", filename);
-			/* Source buffer is already freed in case of failure */
+			zip_source_free (src);
 			continue;
 		}
 
 		/* Compression method is already applied via default_method before add.
 		 * Avoid changing per-entry method post-facto to prevent header mismatch */
 
-		printf ("Added: %s (%ld bytes)\n", base_name, file_size);
+		printf ("Added: %s (%llu bytes)\n", base_name, (unsigned long long)za->entries[idx].uncomp_size);
+	}
+	if (queued > 0) {
+		ret |= flush_batch (za, jobs, queued_names, queued_indices, &queued);
 	}
+	free (queued_names);
+	free (queued_indices);
 
 	/* Close and finalize the zip file */
 	zip_close (za);
-	return 0;
+	print_stats ();
+	return ret? 1: 0;
 }
 
 /* Normalize a zip entry name into 'out'. Return 0 on success, -1 on invalid path. */
@@ -426,161 +567,402 @@ static int ensure_parent_dirs(const char *path) {
 	return 0;
 }
 
-static int extract_all(const char *path) {
-	int err = 0;
-	zip_t *za = zip_open (path, ZIP_RDONLY, &err);
-	if (!za) {
-		fprintf (stderr, "Failed to open %s (err=%d)\n", path, err);
-		return 1;
-	}
-
-	zip_uint64_t n = zip_get_num_files (za);
-	for (zip_uint64_t i = 0; i < n; ++i) {
-		zip_file_t *zf = zip_fopen_index (za, i, 0);
-		if (!zf) {
-			fprintf (stderr, "Could not read entry %llu\n", (unsigned long long)i);
+/* write () all n bytes at p, retrying short and interrupted writes */
+static int write_all(int fd, const uint8_t *p, size_t n) {
+	while (n > 0) {
+		ssize_t w = write (fd, p, n);
+		if (w < 0 && errno == EINTR) {
 			continue;
 		}
-
-		const char *raw_name = ((struct otezip_entry *)za->entries)[i].name; /* internal */
-		char fname_sanitized[PATH_MAX];
-		if (sanitize_extract_path (raw_name, fname_sanitized, sizeof (fname_sanitized)) != 0) {
-			fprintf (stderr, "Skipping suspicious entry: %s\n", raw_name? raw_name: "(null)");
-			zip_fclose (zf);
-			continue;
+		if (w <= 0) {
+			return -1;
 		}
+		p += w;
+		n -= (size_t)w;
+	}
+	return 0;
+}
 
-		/* If entry denotes a directory (name ends with '/'), create it */
-		size_t rlen = raw_name? strlen (raw_name): 0;
-		if (rlen > 0 && raw_name[rlen - 1] == '/') {
-			if (ensure_parent_dirs (fname_sanitized) != 0) {
-				fprintf (stderr, "Failed to create directory for %s\n", fname_sanitized);
-			} else {
-				if (OTEZIP_MKDIR (fname_sanitized, 0755) != 0 && errno != EEXIST) {
-					fprintf (stderr, "Failed to create directory %s\n", fname_sanitized);
-				}
+/* Write entry i, opened as zf, to disk; data holds the whole entry when
+ * it has been read already. Safe to call from several threads at once:
+ * reads go through positional I/O in the library. */
+static void extract_to(zip_t *za, zip_uint64_t i, zip_file_t *zf, const uint8_t *data) {
+	const char *raw_name = ((struct otezip_entry *)za->entries)[i].name; /* internal */
+	char fname_sanitized[PATH_MAX];
+	if (sanitize_extract_path (raw_name, fname_sanitized, sizeof (fname_sanitized)) != 0) {
+		fprintf (stderr, "Skipping suspicious entry: %s\n", raw_name? raw_name: "(null)");
+		return;
+	}
+
+	/* If entry denotes a directory (name ends with '/'), create it */
+	size_t rlen = raw_name? strlen (raw_name): 0;
+	if (rlen > 0 && raw_name[rlen - 1] == '/') {
+		if (ensure_parent_dirs (fname_sanitized) != 0) {
+			fprintf (stderr, "Failed to create directory for %s\n", fname_sanitized);
+		} else {
+			if (OTEZIP_MKDIR (fname_sanitized, 0755) != 0 && errno != EEXIST) {
+				fprintf (stderr, "Failed to create directory %s\n", fname_sanitized);
 			}
-			zip_fclose (zf);
-			continue;
 		}
+		return;
+	}
 
-		if (ensure_parent_dirs (fname_sanitized) != 0) {
-			fprintf (stderr, "Cannot ensure parent dirs for %s\n", fname_sanitized);
-			zip_fclose (zf);
-			continue;
+	if (ensure_parent_dirs (fname_sanitized) != 0) {
+		fprintf (stderr, "Cannot ensure parent dirs for %s\n", fname_sanitized);
+		return;
+	}
+
+	/* Avoid overwriting existing files unless force (-f) is specified. */
+	struct stat pst;
+	if (OTEZIP_LSTAT (fname_sanitized, &pst) == 0) {
+		if (!g_force) {
+			fprintf (stderr, "Skipping existing file (use -f to overwrite): %s\n", fname_sanitized);
+			return;
+		}
+		/* If force is set and path is a symlink, reject unless policy allows */
+		if (S_ISLNK (pst.st_mode) && g_extract_policy == POLICY_REJECT) {
+			fprintf (stderr, "Refusing to overwrite symlink: %s\n", fname_sanitized);
+			return;
 		}
+	}
 
-		/* Avoid overwriting existing files unless force (-f) is specified. */
-		struct stat pst;
-		if (OTEZIP_LSTAT (fname_sanitized, &pst) == 0) {
+	/* Determine safe mode from central directory external attributes.
+	 * Mask to 0777 to avoid applying SUID/SGID/sticky from archive. */
+	uint32_t external_attr = 0;
+	/* access internal entry data safely */
+	struct otezip_entry *entry = &((struct otezip_entry *)za->entries)[i];
+	external_attr = entry->external_attr;
+	mode_t desired_mode = (mode_t) ((external_attr >> 16) & 0777);
+	if (desired_mode == 0) {
+		desired_mode = 0644; /* fallback */
+	}
+
+	/* Open the output file atomically: try O_CREAT|O_EXCL first to avoid
+	 * TOCTOU overwrite races. If it exists and force is requested, open with
+	 * O_TRUNC to overwrite. Use low-level descriptors and write () to avoid
+	 * stdio buffering issues. */
+	int fd = -1;
+	int open_flags = O_WRONLY | O_CREAT | O_EXCL;
+	fd = open (fname_sanitized, open_flags | O_BINARY, desired_mode);
+	if (fd < 0) {
+		if (errno == EEXIST) {
 			if (!g_force) {
 				fprintf (stderr, "Skipping existing file (use -f to overwrite): %s\n", fname_sanitized);
-				zip_fclose (zf);
-				continue;
+				return;
 			}
-			/* If force is set and path is a symlink, reject unless policy allows */
-			if (S_ISLNK (pst.st_mode) && g_extract_policy == POLICY_REJECT) {
+			/* Force path: open for write/truncate but ensure it's not a symlink */
+			if (OTEZIP_LSTAT (fname_sanitized, &pst) == 0 && S_ISLNK (pst.st_mode) && g_extract_policy == POLICY_REJECT) {
 				fprintf (stderr, "Refusing to overwrite symlink: %s\n", fname_sanitized);
-				zip_fclose (zf);
-				continue;
+				return;
+			}
+			fd = open (fname_sanitized, O_WRONLY | O_TRUNC | O_NOFOLLOW | O_BINARY);
+			if (fd < 0) {
+				fprintf (stderr, "Cannot open for overwrite %s: %s\n", fname_sanitized, strerror (errno));
+				return;
 			}
+		} else {
+			fprintf (stderr, "Cannot create %s: %s\n", fname_sanitized, strerror (errno));
+			return;
 		}
+	}
 
-		/* Determine safe mode from central directory external attributes.
-		 * Mask to 0777 to avoid applying SUID/SGID/sticky from archive. */
-		uint32_t external_attr = 0;
-		/* access internal entry data safely */
-		struct otezip_entry *entry = &((struct otezip_entry *)za->entries)[i];
-		external_attr = entry->external_attr;
-		mode_t desired_mode = (mode_t) ((external_attr >> 16) & 0777);
-		if (desired_mode == 0) {
-			desired_mode = 0644; /* fallback */
+	/* After creating/opening, ensure we didn't follow a symlink to a special file. */
+	struct stat st2;
+	if (fstat (fd, &st2) != 0) {
+		fprintf (stderr, "Failed to stat %s\n", fname_sanitized);
+		close (fd);
+		return;
+	}
+	if (!S_ISREG (st2.st_mode)) {
+		fprintf (stderr, "Refusing to write non-regular file %s\n", fname_sanitized);
+		close (fd);
+		return;
+	}
+
+	/* Apply safe permissions (masking out SUID/SGID/sticky by using 0777 mask) */
+	if (OTEZIP_FCHMOD (fd, desired_mode & 0777) != 0) {
+		/* Non-fatal: warn but continue */
+		fprintf (stderr, "Warning: failed to set permissions on %s: %s\n", fname_sanitized, strerror (errno));
+	}
+
+	/* Stored entries go from the archive to fd in the kernel when they can */
+	uint64_t entry_size = entry->uncomp_size;
+	int failed;
+	if (data) {
+		failed = write_all (fd, data, (size_t)entry_size) != 0;
+	} else {
+		failed = otezip_fcopy_fd (zf, fd) != (zip_int64_t)entry_size;
+	}
+	close (fd);
+	if (failed) {
+		/* Do not leave truncated or corrupt output behind */
+		fprintf (stderr, "Could not extract entry %llu to %s\n", (unsigned long long)i, fname_sanitized);
+		remove (fname_sanitized);
+		return;
+	}
+	printf ("Extracted %s (%llu bytes)\n", fname_sanitized, (unsigned long long)entry_size);
+}
+
+/* Extract entry i of a read-only archive */
+static void extract_entry(zip_t *za, zip_uint64_t i) {
+	zip_file_t *zf = zip_fopen_index (za, i, 0);
+	if (!zf) {
+		fprintf (stderr, "Could not read entry %llu\n", (unsigned long long)i);
+		return;
+	}
+	extract_to (za, i, zf, NULL);
+	zip_fclose (zf);
+}
+
+#ifdef OTEZIP_HAVE_PTHREAD
+struct extract_item {
+	uint64_t uncomp_size;
+	zip_uint64_t index;
+};
+
+/* Entries handed out to -x -j workers, largest first */
+struct extract_queue {
+	zip_t *za;
+	struct extract_item *order;
+	zip_uint64_t count;
+	zip_uint64_t next;
+	pthread_mutex_t lock;
+};
+
+static void *extract_worker(void *arg) {
+	struct extract_queue *q = (struct extract_queue *)arg;
+	for (;;) {
+		pthread_mutex_lock (&q->lock);
+		if (q->next >= q->count) {
+			pthread_mutex_unlock (&q->lock);
+			return NULL;
 		}
+		zip_uint64_t idx = q->order[q->next++].index;
+		pthread_mutex_unlock (&q->lock);
+		extract_entry (q->za, idx);
+	}
+}
 
-		/* Open the output file atomically: try O_CREAT|O_EXCL first to avoid
-		 * TOCTOU overwrite races. If it exists and force is requested, open with
-		 * O_TRUNC to overwrite. Use low-level descriptors and write () to avoid
-		 * stdio buffering issues. */
-		int fd = -1;
-		int open_flags = O_WRONLY | O_CREAT | O_EXCL;
-		fd = open (fname_sanitized, open_flags | O_BINARY, desired_mode);
-		if (fd < 0) {
-			if (errno == EEXIST) {
-				if (!g_force) {
-					fprintf (stderr, "Skipping existing file (use -f to overwrite): %s\n", fname_sanitized);
-					zip_fclose (zf);
-					continue;
-				}
-				/* Force path: open for write/truncate but ensure it's not a symlink */
-				if (OTEZIP_LSTAT (fname_sanitized, &pst) == 0 && S_ISLNK (pst.st_mode) && g_extract_policy == POLICY_REJECT) {
-					fprintf (stderr, "Refusing to overwrite symlink: %s\n", fname_sanitized);
-					zip_fclose (zf);
-					continue;
-				}
-				fd = open (fname_sanitized, O_WRONLY | O_TRUNC | O_NOFOLLOW | O_BINARY);
-				if (fd < 0) {
-					fprintf (stderr, "Cannot open for overwrite %s: %s\n", fname_sanitized, strerror (errno));
-					zip_fclose (zf);
-					continue;
-				}
-			} else {
-				fprintf (stderr, "Cannot create %s: %s\n", fname_sanitized, strerror (errno));
-				zip_fclose (zf);
-				continue;
-			}
+/* Biggest entries first so a large file does not start last and leave the
+ * other workers idle; ties keep archive order */
+static int cmp_size_desc(const void *a, const void *b) {
+	const struct extract_item *ea = (const struct extract_item *)a;
+	const struct extract_item *eb = (const struct extract_item *)b;
+	if (ea->uncomp_size != eb->uncomp_size) {
+		return ea->uncomp_size < eb->uncomp_size? 1: -1;
+	}
+	return ea->index < eb->index? -1: ea->index > eb->index;
+}
+
+/* Run extract_entry over all entries on jobs threads (the caller is one).
+ * Returns -1 if the queue could not be set up; the caller then falls back
+ * to extracting serially. */
+static int extract_parallel(zip_t *za, zip_uint64_t n, int jobs) {
+	struct extract_queue q;
+	q.za = za;
+	q.count = n;
+	q.next = 0;
+	q.order = (struct extract_item *)malloc ((size_t)n * sizeof (struct extract_item));
+	if (!q.order) {
+		return -1;
+	}
+	for (zip_uint64_t i = 0; i < n; i++) {
+		q.order[i].uncomp_size = za->entries[i].uncomp_size;
+		q.order[i].index = i;
+	}
+	qsort (q.order, (size_t)n, sizeof (struct extract_item), cmp_size_desc);
+	if (pthread_mutex_init (&q.lock, NULL) != 0) {
+		free (q.order);
+		return -1;
+	}
+	if ((zip_uint64_t)jobs > n) {
+		jobs = (int)n;
+	}
+	pthread_t *tids = (pthread_t *)malloc ((size_t)jobs * sizeof (pthread_t));
+	int started = 0;
+	while (tids && started < jobs - 1) {
+		if (pthread_create (&tids[started], NULL, extract_worker, &q) != 0) {
+			break; /* carry on with the threads we have */
 		}
+		started++;
+	}
+	extract_worker (&q);
+	for (int t = 0; t < started; t++) {
+		pthread_join (tids[t], NULL);
+	}
+	free (tids);
+	pthread_mutex_destroy (&q.lock);
+	free (q.order);
+	return 0;
+}
 
-		/* After creating/opening, ensure we didn't follow a symlink to a special file. */
-		struct stat st2;
-		if (fstat (fd, &st2) != 0) {
-			fprintf (stderr, "Failed to stat %s\n", fname_sanitized);
-			close (fd);
-			zip_fclose (zf);
-			continue;
+/* Serial -x reads small entries whole on the calling thread and queues
+ * them, and opened large ones, for a writer thread that creates and
+ * writes the files in archive order; file system calls then overlap
+ * with decoding instead of waiting for it. */
+#define WRITE_BEHIND_ENTRY (256u * 1024u) /* largest entry read ahead */
+#define WRITE_BEHIND_BYTES (32u * 1024u * 1024u) /* most data read ahead */
+#define WRITE_BEHIND_SLOTS 256
+
+struct write_job {
+	zip_uint64_t index;
+	zip_file_t *zf;
+	uint8_t *data; /* whole entry, or NULL to copy from zf */
+	zip_uint64_t bytes;
+};
+
+struct write_queue {
+	zip_t *za;
+	struct write_job jobs[WRITE_BEHIND_SLOTS];
+	size_t head;
+	size_t count;
+	zip_uint64_t bytes; /* read ahead, not written yet */
+	int done;
+	pthread_mutex_t lock;
+	pthread_cond_t cond; /* a job was queued or written */
+};
+
+static void *write_behind_worker(void *arg) {
+	struct write_queue *q = (struct write_queue *)arg;
+	pthread_mutex_lock (&q->lock);
+	for (;;) {
+		while (q->count == 0 && !q->done) {
+			pthread_cond_wait (&q->cond, &q->lock);
 		}
-		if (!S_ISREG (st2.st_mode)) {
-			fprintf (stderr, "Refusing to write non-regular file %s\n", fname_sanitized);
-			close (fd);
-			zip_fclose (zf);
-			continue;
+		if (q->count == 0) {
+			break;
 		}
+		struct write_job job = q->jobs[q->head];
+		pthread_mutex_unlock (&q->lock);
+		extract_to (q->za, job.index, job.zf, job.data);
+		zip_fclose (job.zf);
+		free (job.data);
+		pthread_mutex_lock (&q->lock);
+		q->head = (q->head + 1) % WRITE_BEHIND_SLOTS;
+		q->count--;
+		q->bytes -= job.bytes;
+		pthread_cond_broadcast (&q->cond);
+	}
+	pthread_mutex_unlock (&q->lock);
+	return NULL;
+}
 
-		/* Apply safe permissions (masking out SUID/SGID/sticky by using 0777 mask) */
-		if (OTEZIP_FCHMOD (fd, desired_mode & 0777) != 0) {
-			/* Non-fatal: warn but continue */
-			fprintf (stderr, "Warning: failed to set permissions on %s: %s\n", fname_sanitized, strerror (errno));
+/* Wait for room, then queue job */
+static void write_behind_push(struct write_queue *q, const struct write_job *job) {
+	pthread_mutex_lock (&q->lock);
+	while (q->count == WRITE_BEHIND_SLOTS || (q->bytes > 0 && q->bytes + job->bytes > WRITE_BEHIND_BYTES)) {
+		pthread_cond_wait (&q->cond, &q->lock);
+	}
+	q->jobs[(q->head + q->count) % WRITE_BEHIND_SLOTS] = *job;
+	q->count++;
+	q->bytes += job->bytes;
+	pthread_cond_broadcast (&q->cond);
+	pthread_mutex_unlock (&q->lock);
+}
+
+/* Read all of zf into a new buffer */
+static uint8_t *read_whole(zip_file_t *zf, zip_uint64_t size) {
+	uint8_t *buf = (uint8_t *)malloc (size? (size_t)size: 1);
+	zip_uint64_t got = 0;
+	while (buf && got < size) {
+		zip_int64_t r = zip_fread (zf, buf + got, size - got);
+		if (r <= 0) {
+			free (buf);
+			return NULL;
 		}
+		got += (zip_uint64_t)r;
+	}
+	return buf;
+}
 
-		/* Write the file content */
-		size_t wrote = 0;
-		const uint8_t *data = (const uint8_t *)zf->data;
-		size_t remain = zf->size;
-		while (remain > 0) {
-			unsigned int wlen = (remain > UINT_MAX) ? UINT_MAX : (unsigned int)remain;
-			ssize_t n = write (fd, data + wrote, wlen);
-			if (n < 0) {
-				if (errno == EINTR) {
-					continue;
-				}
-				fprintf (stderr, "Write error for %s: %s\n", fname_sanitized, strerror (errno));
-				break;
+/* Returns -1 if the writer could not be started; the caller then
+ * extracts without it. */
+static int extract_write_behind(zip_t *za, zip_uint64_t n) {
+	struct write_queue *q = (struct write_queue *)calloc (1, sizeof (*q));
+	if (!q) {
+		return -1;
+	}
+	q->za = za;
+	if (pthread_mutex_init (&q->lock, NULL) != 0) {
+		free (q);
+		return -1;
+	}
+	if (pthread_cond_init (&q->cond, NULL) != 0) {
+		pthread_mutex_destroy (&q->lock);
+		free (q);
+		return -1;
+	}
+	pthread_t tid;
+	if (pthread_create (&tid, NULL, write_behind_worker, q) != 0) {
+		pthread_cond_destroy (&q->cond);
+		pthread_mutex_destroy (&q->lock);
+		free (q);
+		return -1;
+	}
+	for (zip_uint64_t i = 0; i < n; i++) {
+		struct write_job job = { i, zip_fopen_index (za, i, 0), NULL, 0 };
+		if (!job.zf) {
+			fprintf (stderr, "Could not read entry %llu\n", (unsigned long long)i);
+			continue;
+		}
+		zip_uint64_t size = za->entries[i].uncomp_size;
+		if (size <= WRITE_BEHIND_ENTRY) {
+			job.data = read_whole (job.zf, size);
+			if (!job.data) {
+				fprintf (stderr, "Could not read entry %llu\n", (unsigned long long)i);
+				zip_fclose (job.zf);
+				continue;
 			}
-			wrote += (size_t)n;
-			remain -= (size_t)n;
+			job.bytes = size;
+		} else if (job.zf->data && !job.zf->borrowed) {
+			job.bytes = size; /* methods decoded whole by zip_fopen_index */
 		}
-		close (fd);
+		write_behind_push (q, &job);
+	}
+	pthread_mutex_lock (&q->lock);
+	q->done = 1;
+	pthread_cond_broadcast (&q->cond);
+	pthread_mutex_unlock (&q->lock);
+	pthread_join (tid, NULL);
+	pthread_cond_destroy (&q->cond);
+	pthread_mutex_destroy (&q->lock);
+	free (q);
+	return 0;
+}
+#endif
 
-		/* Save size before closing – zip_fclose () frees the zip_file_t */
-		size_t entry_size = (size_t)zf->size;
-		zip_fclose (zf);
-		if (remain == 0) {
-			printf ("Extracted %s (%lu bytes)\n", fname_sanitized, (unsigned long)entry_size);
-		} else {
-			fprintf (stderr, "Failed to fully write %s\n", fname_sanitized);
-		}
+/* Extract every entry into the current directory, on jobs threads when
+ * jobs > 1 */
+static int extract_all(const char *path, int jobs) {
+	int err = 0;
+	zip_t *za = zip_open (path, ZIP_RDONLY, &err);
+	if (!za) {
+		fprintf (stderr, "Failed to open %s (err=%d)\n", path, err);
+		return 1;
+	}
+	watch_archive (za);
+
+	zip_uint64_t n = zip_get_num_files (za);
+#ifdef OTEZIP_HAVE_PTHREAD
+	if (jobs > 1 && n > 1 && extract_parallel (za, n, jobs) == 0) {
+		zip_close (za);
+		print_stats ();
+		return 0;
+	}
+	if (n > 1 && extract_write_behind (za, n) == 0) {
+		zip_close (za);
+		print_stats ();
+		return 0;
+	}
+#else
+	(void)jobs;
+#endif
+	for (zip_uint64_t i = 0; i < n; ++i) {
+		extract_entry (za, i);
 	}
 
 	zip_close (za);
+	print_stats ();
 	return 0;
 }
 
@@ -666,45 +1048,6 @@ static uint8_t *inflate_buffer(const uint8_t *input_data, size_t input_size, siz
 	return buf;
 }
 
-/* Deflate (compress) a buffer with gzip framing.
- * Returns a malloc'd buffer on success (caller frees), NULL on failure.
- * Sets *out_size to the compressed size on success. */
-static uint8_t *deflate_to_gzip(const uint8_t *input_data, size_t input_size, size_t *out_size) {
-	z_stream strm;
-	memset (&strm, 0, sizeof (strm));
-
-	if (deflateInit2 (&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
-		fprintf (stderr, "deflateInit2 failed\n");
-		return NULL;
-	}
-
-	size_t alloc = input_size + (input_size / 8) + 128;
-	if (alloc < 256) {
-		alloc = 256;
-	}
-	uint8_t *buf = (uint8_t *)malloc (alloc);
-	if (!buf) {
-		fprintf (stderr, "Out of memory for output buffer\n");
-		deflateEnd (&strm);
-		return NULL;
-	}
-
-	strm.next_in = (uint8_t *)input_data;
-	strm.avail_in = UINT_CLAMP (input_size);
-	strm.next_out = buf;
-	strm.avail_out = UINT_CLAMP (alloc);
-
-	int ret = deflate (&strm, Z_FINISH);
-	*out_size = (size_t)(strm.next_out - buf);
-	deflateEnd (&strm);
-	if (ret != Z_STREAM_END) {
-		fprintf (stderr, "deflate failed: %d\n", ret);
-		free (buf);
-		return NULL;
-	}
-	return buf;
-}
-
 /* Decompress a gzip file (gunzip mode) */
 static int gunzip_file(const char *input_path, const char *output_path) {
 	FILE *fin = fopen (input_path, "rb");
@@ -767,67 +1110,54 @@ static int gunzip_file(const char *input_path, const char *output_path) {
 	return 0;
 }
 
-/* Compress a file with gzip */
-static int gzip_file(const char *input_path, const char *output_path) {
+/* Compress a file with gzip, streaming it through jobs deflate threads */
+static int gzip_file(const char *input_path, const char *output_path, int jobs) {
 	FILE *fin = fopen (input_path, "rb");
 	if (!fin) {
 		fprintf (stderr, "Cannot open input file: %s\n", input_path);
 		return 1;
 	}
-
-	fseek (fin, 0, SEEK_END);
-	long fsize = ftell (fin);
-	fseek (fin, 0, SEEK_SET);
-
-	if (fsize < 0) {
-		fprintf (stderr, "Invalid input file size\n");
+	FILE *fout = fopen (output_path, "wb");
+	if (!fout) {
+		fprintf (stderr, "Cannot create output file: %s\n", output_path);
 		fclose (fin);
 		return 1;
 	}
-	size_t input_size = (size_t)fsize;
 
-	uint8_t *input_data = NULL;
-	if (input_size > 0) {
-		input_data = (uint8_t *)malloc (input_size);
-		if (!input_data) {
-			fprintf (stderr, "Out of memory\n");
-			fclose (fin);
-			return 1;
-		}
-		if (fread (input_data, 1, input_size, fin) != input_size) {
-			fprintf (stderr, "Failed to read input file\n");
-			free (input_data);
-			fclose (fin);
-			return 1;
-		}
-	}
+	zip_uint64_t input_size = 0;
+	zip_uint64_t output_size = 0;
+	int rc = otezip_gzip_file (fin, fout, Z_DEFAULT_COMPRESSION, jobs, &input_size, &output_size);
 	fclose (fin);
-
-	size_t output_size = 0;
-	uint8_t *output_data = deflate_to_gzip (input_data, input_size, &output_size);
-	free (input_data);
-	if (!output_data) {
-		return 1;
+	if (fclose (fout) != 0) {
+		rc = -1;
 	}
-
-	FILE *fout = fopen (output_path, "wb");
-	if (!fout) {
-		fprintf (stderr, "Cannot create output file: %s\n", output_path);
-		free (output_data);
+	if (rc != 0) {
+		fprintf (stderr, "Failed to compress %s\n", input_path);
+		remove (output_path);
 		return 1;
 	}
+	printf ("Compressed %s -> %s (%llu -> %llu bytes)\n",
+		input_path, output_path, (unsigned long long)input_size, (unsigned long long)output_size);
+	return 0;
+}
 
-	if (fwrite (output_data, 1, output_size, fout) != output_size) {
-		fprintf (stderr, "Failed to write output file\n");
-		fclose (fout);
-		free (output_data);
-		return 1;
+/* Thread count of -j: 0 means one per CPU */
+static int parse_jobs(const char *arg, int *jobs) {
+	char *end = NULL;
+	long n = arg? strtol (arg, &end, 10): -1;
+	if (!arg || !end || *end || n < 0 || n > 1024) {
+		fprintf (stderr, "Error: -j requires a thread count between 0 and 1024\n");
+		return -1;
+	}
+	*jobs = (int)n;
+	if (*jobs == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+		long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+		*jobs = cpus > 0? (int)cpus: 1;
+#else
+		*jobs = 1;
+#endif
 	}
-
-	fclose (fout);
-	free (output_data);
-	printf ("Compressed %s -> %s (%ld -> %lu bytes)\n",
-		input_path, output_path, fsize, (unsigned long)output_size);
 	return 0;
 }
 
@@ -881,14 +1211,26 @@ int main(int argc, char **argv) {
 			return 1;
 		}
 		const char *input_path = argv[2];
+		const char *named_output = NULL;
+		int jobs = 1;
+		for (int i = 3; i < argc; i++) {
+			if (strcmp (argv[i], "-j") == 0) {
+				if (parse_jobs (i + 1 < argc? argv[i + 1]: NULL, &jobs) != 0) {
+					return 1;
+				}
+				i++;
+			} else if (!named_output) {
+				named_output = argv[i];
+			}
+		}
 		char output_path[PATH_MAX];
-		if (argc >= 4) {
-			strncpy (output_path, argv[3], sizeof (output_path) - 1);
+		if (named_output) {
+			strncpy (output_path, named_output, sizeof (output_path) - 1);
 			output_path[sizeof (output_path) - 1] = '\0';
 		} else {
 			snprintf (output_path, sizeof (output_path), "%s.gz", input_path);
 		}
-		return gzip_file (input_path, output_path);
+		return gzip_file (input_path, output_path, jobs);
 	}
 
 	if (argc < 3) {
@@ -896,7 +1238,7 @@ int main(int argc, char **argv) {
 		return 1;
 	}
 
-	int mode_list = 0, mode_extract = 0, mode_create = 0, mode_append = 0;
+	int mode_list = 0, mode_extract = 0, mode_create = 0, mode_append = 0, mode_test = 0;
 
 	/* Set default compression method based on available algorithms */
 	int compression_method = 0; /* Default to store */
@@ -908,6 +1250,8 @@ int main(int argc, char **argv) {
 		mode_list = 1;
 	} else if (strcmp (argv[1], "-x") == 0) {
 		mode_extract = 1;
+	} else if (strcmp (argv[1], "-t") == 0) {
+		mode_test = 1;
 	} else if (strcmp (argv[1], "-c") == 0) {
 		mode_create = 1;
 	} else if (strcmp (argv[1], "-a") == 0) {
@@ -934,8 +1278,10 @@ int main(int argc, char **argv) {
 		num_files = argc - 3;
 
 		for (i = 3; i < argc; i++) {
-			if (strcmp (argv[i], "-z") == 0) {
-				filter_count += 2; // -z and its argument
+			if (strcmp (argv[i], "-z") == 0 || strcmp (argv[i], "-j") == 0) {
+				filter_count += 2; // -z/-j and its argument
+			} else if (strcmp (argv[i], "--stats") == 0) {
+				filter_count++;
 			}
 		}
 		num_files -= filter_count;
@@ -958,6 +1304,20 @@ int main(int argc, char **argv) {
 		}
 	}
 
+	/* Parse parallelism option: -j N; -t uses every CPU by default */
+	int jobs = 1;
+	if (mode_test) {
+		parse_jobs ("0", &jobs);
+	}
+	for (i = 3; i < argc; i++) {
+		if (strcmp (argv[i], "-j") == 0) {
+			if (parse_jobs (i + 1 < argc? argv[i + 1]: NULL, &jobs) != 0) {
+				return 1;
+			}
+			i++;
+		}
+	}
+
 	/* Parse extraction policy option: -P<policy> or --policy=<policy>
 	 * Supported: reject (default), strip, allow
 	 */
@@ -1004,6 +1364,13 @@ int main(int argc, char **argv) {
 		}
 	}
 
+	/* Parse statistics option: --stats */
+	for (i = 3; i < argc; i++) {
+		if (strcmp (argv[i], "--stats") == 0) {
+			g_show_stats = 1;
+		}
+	}
+
 	/* Parse force option: -f or --force (allow overwriting existing files) */
 	for (i = 3; i < argc; i++) {
 		if (strcmp (argv[i], "-f") == 0 || strcmp (argv[i], "--force") == 0) {
@@ -1023,7 +1390,10 @@ int main(int argc, char **argv) {
 			usage ();
 			return 1;
 		}
-		return extract_all (zip_path);
+		return extract_all (zip_path, jobs);
+	}
+	if (mode_test) {
+		return test_archive (zip_path, jobs);
 	}
 	if (mode_create || mode_append) {
 		if (argc < 4) {
@@ -1031,7 +1401,7 @@ int main(int argc, char **argv) {
 			usage ();
 			return 1;
 		}
-		return create_or_add_files (zip_path, files_to_add, num_files, mode_create, compression_method);
+		return create_or_add_files (zip_path, files_to_add, num_files, mode_create, compression_method, jobs);
 	}
 
 	usage ();
@@ -0,0 +1,689 @@
+/* bench.c - throughput and ratio benchmarks for otezip
+ *
+ * Codecs: every registered OTEZIP_METHOD_* at several levels over a
+ * synthetic corpus (text, binary, already-compressed media and a tree of
+ * small files) plus any files given with -f. Archive layer: creation and
+ * full extraction of that corpus per method, and zip_open plus
+ * zip_name_locate on archives with 10k to 1M entries. When the system
+ * libz can be loaded its compress2/uncompress are measured next to the
+ * built-in deflate for reference.
+ *
+ * Results go to stdout as one JSON document, progress to stderr. Sizes
+ * are in bytes and speeds in MB/s (10^6 bytes of uncompressed data). */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+#include "../../src/include/otezip/zip.h"
+
+struct sample {
+	char name[64];
+	uint8_t *data;
+	size_t len;
+};
+
+/* The small-file tree is archived and extracted, never fed to codecs whole */
+struct corpus {
+	struct sample *items;
+	size_t n;
+	size_t tree_first; /* items from here on are the small files */
+};
+
+static double min_time = 0.2;
+static const char *tmp_dir = "/tmp";
+static int n_threads = 1;
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static uint32_t rnd(uint32_t *s) {
+	uint32_t x = *s;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *s = x;
+}
+
+static double mb_s(size_t bytes, double seconds) {
+	return seconds > 0? (double)bytes / seconds / 1e6: 0;
+}
+
+/* ---------------------------------------------------------------- corpus */
+
+#define VOCAB 512
+
+static char vocab[VOCAB][12];
+
+static void make_vocab(void) {
+	uint32_t s = 0x9e3779b9u;
+	for (int i = 0; i < VOCAB; i++) {
+		int len = 2 + (int) (rnd (&s) % 9);
+		for (int k = 0; k < len; k++) {
+			vocab[i][k] = "etaoinshrdlucmfwypvbgkjqxz"[rnd (&s) % 26 * (rnd (&s) % 26) / 26];
+		}
+		vocab[i][len] = 0;
+	}
+}
+
+/* Lines of words drawn with a skew towards the head of the vocabulary,
+ * with some indentation and punctuation */
+static void gen_text(uint8_t *p, size_t n, uint32_t seed) {
+	size_t i = 0;
+	size_t line = 0;
+	while (i < n) {
+		uint32_t r = rnd (&seed);
+		if (line == 0 && r % 4 == 0) {
+			size_t indent = 1 + r % 3;
+			while (indent-- && i < n) {
+				p[i++] = '\t';
+			}
+		}
+		const char *w = vocab[(r >> 8) % VOCAB * ((r >> 20) % VOCAB) / VOCAB];
+		while (*w && i < n) {
+			p[i++] = (uint8_t)*w++;
+			line++;
+		}
+		if (i < n) {
+			p[i++] = (uint8_t)(r % 11 == 0? ',': r % 17 == 0? '.': ' ');
+			line++;
+		}
+		if ((line > 40 && r % 7 == 0) || line > 100) {
+			if (i < n) {
+				p[i++] = '\n';
+			}
+			line = 0;
+		}
+	}
+}
+
+/* Executable-like data: tables of small records alternating with code
+ * drawn from a skewed opcode set and low-entropy displacements */
+static void gen_binary(uint8_t *p, size_t n, uint32_t seed) {
+	size_t i = 0;
+	uint32_t id = 0;
+	while (i < n) {
+		uint32_t r = rnd (&seed);
+		size_t run = 256 + r % 4096;
+		if (r & 1) {
+			for (; run >= 16 && i + 16 <= n; run -= 16) {
+				uint32_t v = rnd (&seed);
+				uint32_t rec[4] = { id++, v % 8, 1000 + v % 64, (uint32_t)(i / 4096) };
+				memcpy (p + i, rec, 16);
+				i += 16;
+			}
+		} else {
+			for (; run > 0 && i < n; run--) {
+				uint32_t v = rnd (&seed);
+				if (v % 5 == 0 && i + 4 <= n) {
+					int32_t disp = (int32_t)(v % 512) - 256;
+					memcpy (p + i, &disp, 4);
+					i += 4;
+				} else {
+					p[i++] = (uint8_t)(0x40 + (v >> 8) % 64 * ((v >> 16) % 64) / 64);
+				}
+			}
+		}
+		if (i < n && i + 16 > n) {
+			p[i++] = 0;
+		}
+	}
+}
+
+/* Stands in for JPEG/MP4/zip payloads: no redundancy left */
+static void gen_media(uint8_t *p, size_t n, uint32_t seed) {
+	for (size_t i = 0; i < n; i++) {
+		p[i] = (uint8_t)(rnd (&seed) >> 24);
+	}
+}
+
+static struct sample *corpus_add(struct corpus *c, const char *name, size_t len) {
+	struct sample *items = (struct sample *)realloc (c->items, (c->n + 1) * sizeof (*items));
+	uint8_t *data = (uint8_t *)malloc (len? len: 1);
+	if (!items || !data) {
+		fprintf (stderr, "bench: out of memory\n");
+		exit (1);
+	}
+	c->items = items;
+	struct sample *s = &c->items[c->n++];
+	snprintf (s->name, sizeof (s->name), "%s", name);
+	s->data = data;
+	s->len = len;
+	return s;
+}
+
+static int corpus_add_file(struct corpus *c, const char *path) {
+	FILE *fp = fopen (path, "rb");
+	long len = -1;
+	if (fp && fseek (fp, 0, SEEK_END) == 0) {
+		len = ftell (fp);
+	}
+	if (len < 0 || fseek (fp, 0, SEEK_SET) != 0) {
+		fprintf (stderr, "bench: cannot read %s\n", path);
+		if (fp) {
+			fclose (fp);
+		}
+		return -1;
+	}
+	const char *base = strrchr (path, '/');
+	struct sample *s = corpus_add (c, base? base + 1: path, (size_t)len);
+	int rc = fread (s->data, 1, s->len, fp) == s->len? 0: -1;
+	fclose (fp);
+	return rc;
+}
+
+/* total bytes of each generated kind; the small files add up to as much */
+static void corpus_build(struct corpus *c, size_t total) {
+	make_vocab ();
+	gen_text (corpus_add (c, "text", total)->data, total, 1);
+	gen_binary (corpus_add (c, "binary", total)->data, total, 2);
+	gen_media (corpus_add (c, "media", total)->data, total, 3);
+	c->tree_first = c->n;
+	uint32_t seed = 4;
+	size_t sum = 0;
+	for (unsigned i = 0; sum < total; i++) {
+		uint32_t r = rnd (&seed);
+		size_t len = (size_t)64 << (r % 8); /* 64 B to 8 KiB */
+		len += r % len;
+		char name[64];
+		snprintf (name, sizeof (name), "tree/d%02u/f%05u.%s", i % 37, i, (r >> 8) % 4? "txt": "bin");
+		struct sample *s = corpus_add (c, name, len);
+		if ((r >> 8) % 4) {
+			gen_text (s->data, len, r | 1);
+		} else {
+			gen_binary (s->data, len, r | 1);
+		}
+		sum += len;
+	}
+}
+
+/* ---------------------------------------------------------------- json */
+
+static int json_first = 1;
+
+static void json_begin_array(const char *name) {
+	printf (",\n  \"%s\": [", name);
+	json_first = 1;
+}
+
+static void json_begin_item(void) {
+	printf ("%s\n    {", json_first? "": ",");
+	json_first = 0;
+}
+
+static void json_end_array(void) {
+	printf ("\n  ]");
+}
+
+/* ---------------------------------------------------------------- codecs */
+
+struct codec_run {
+	const otezip_codec_t *codec;
+	void *ctx;
+	const uint8_t *src;
+	size_t len;
+	uint8_t *dst;
+	size_t cap;
+	size_t out_len;
+	zip_uint32_t flags;
+	int rc;
+};
+
+typedef void (*bench_fn)(void *arg);
+
+/* Best time of one call of fn, repeated for at least min_time */
+static double best_time(bench_fn fn, void *arg) {
+	double best = -1;
+	double start = now ();
+	do {
+		double t = now ();
+		fn (arg);
+		t = now () - t;
+		if (best < 0 || t < best) {
+			best = t;
+		}
+	} while (now () - start < min_time);
+	return best;
+}
+
+static void run_compress(void *arg) {
+	struct codec_run *r = (struct codec_run *)arg;
+	r->out_len = r->cap;
+	r->rc = r->codec->compress (r->ctx, r->src, r->len, r->dst, &r->out_len, r->flags);
+}
+
+static void run_decompress(void *arg) {
+	struct codec_run *r = (struct codec_run *)arg;
+	r->rc = r->codec->decompress (r->ctx, r->dst, r->out_len, (uint8_t *)r->src, r->len);
+}
+
+static void json_codec(const char *method, int id, int level, const struct sample *s, size_t comp_len, double ct, double dt) {
+	json_begin_item ();
+	printf ("\"method\": \"%s\", \"id\": %d, \"level\": %d, \"corpus\": \"%s\", \"bytes\": %zu, ", method, id, level, s->name, s->len);
+	if (comp_len) {
+		printf ("\"compressed\": %zu, \"ratio\": %.4f, ", comp_len, (double)s->len / (double)comp_len);
+	} else {
+		printf ("\"compressed\": null, \"ratio\": null, ");
+	}
+	printf ("\"compress_mb_s\": %.2f, ", mb_s (s->len, ct));
+	if (dt >= 0) {
+		printf ("\"decompress_mb_s\": %.2f}", mb_s (s->len, dt));
+	} else {
+		printf ("\"decompress_mb_s\": null}");
+	}
+	fflush (stdout);
+}
+
+/* Compress and decompress s; output that does not fit the bound (data
+ * that expands) is reported with a null ratio */
+static int bench_codec(const otezip_codec_t *codec, int level, const struct sample *s) {
+	void *ectx = codec->opaque;
+	void *dctx = codec->opaque;
+	if ((codec->init && codec->init (codec->opaque, 1, &ectx) != 0) || (codec->init && codec->init (codec->opaque, 0, &dctx) != 0)) {
+		fprintf (stderr, "bench: %s: init failed\n", codec->name);
+		return -1;
+	}
+	size_t cap = codec->bound? codec->bound (s->len): s->len;
+	cap = cap < s->len + s->len / 8 + 65536? s->len + s->len / 8 + 65536: cap;
+	uint8_t *copy = (uint8_t *)malloc (s->len + 1);
+	struct codec_run r = { codec, ectx, s->data, s->len, (uint8_t *)malloc (cap), cap, 0, (zip_uint32_t)level, 0 };
+	int rc = (r.dst && copy)? 0: -1;
+	double ct = rc? 0: best_time (run_compress, &r);
+	double dt = -1;
+	size_t comp_len = 0;
+	if (!rc && r.rc == 0) {
+		comp_len = r.out_len;
+		/* decode into a copy, then check it */
+		struct codec_run d = r;
+		d.ctx = dctx;
+		d.src = copy;
+		dt = best_time (run_decompress, &d);
+		if (d.rc != 0 || memcmp (copy, s->data, s->len) != 0) {
+			fprintf (stderr, "bench: %s level %d: %s does not round trip\n", codec->name, level, s->name);
+			rc = -1;
+		}
+	} else if (!rc && r.rc != 1) {
+		fprintf (stderr, "bench: %s level %d: compressing %s failed\n", codec->name, level, s->name);
+		rc = -1;
+	}
+	if (!rc) {
+		json_codec (codec->name, codec->method, level, s, comp_len, ct, dt);
+	}
+	free (r.dst);
+	free (copy);
+	if (codec->init && codec->end) {
+		codec->end (ectx);
+		codec->end (dctx);
+	}
+	return rc;
+}
+
+#ifndef _WIN32
+/* The system zlib, resolved at run time: its symbols would clash with
+ * the built-in ones at link time */
+typedef unsigned long (*zbound_fn)(unsigned long);
+typedef int (*zcompress_fn)(uint8_t *, unsigned long *, const uint8_t *, unsigned long, int);
+typedef int (*zuncompress_fn)(uint8_t *, unsigned long *, const uint8_t *, unsigned long);
+
+static struct {
+	zbound_fn bound;
+	zcompress_fn compress2;
+	zuncompress_fn uncompress;
+	const char *version;
+} syszlib;
+
+static void syszlib_load(void) {
+	static const char *const names[] = { "libz.so.1", "libz.so", "libz.1.dylib", "libz.dylib" };
+	void *h = NULL;
+	for (size_t i = 0; !h && i < sizeof (names) / sizeof (names[0]); i++) {
+		h = dlopen (names[i], RTLD_NOW | RTLD_LOCAL);
+	}
+	if (!h) {
+		fprintf (stderr, "bench: system zlib not found, skipping it\n");
+		return;
+	}
+	const char *(*version)(void) = (const char *(*)(void))dlsym (h, "zlibVersion");
+	syszlib.bound = (zbound_fn)dlsym (h, "compressBound");
+	syszlib.compress2 = (zcompress_fn)dlsym (h, "compress2");
+	syszlib.uncompress = (zuncompress_fn)dlsym (h, "uncompress");
+	syszlib.version = version? version (): "unknown";
+	if (!syszlib.bound || !syszlib.compress2 || !syszlib.uncompress) {
+		syszlib.compress2 = NULL;
+	}
+}
+
+/* Adapters to the codec interface, so the same timing loop applies */
+static int syszlib_compress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags) {
+	(void)ctx;
+	unsigned long n = (unsigned long)*dst_len;
+	int rc = syszlib.compress2 (dst, &n, src, (unsigned long)src_len, (int)OTEZIP_COMP_LEVEL (comp_flags));
+	*dst_len = n;
+	return rc == 0? 0: -1;
+}
+
+static int syszlib_decompress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t dst_len) {
+	(void)ctx;
+	unsigned long n = (unsigned long)dst_len;
+	return syszlib.uncompress (dst, &n, src, (unsigned long)src_len) == 0 && n == dst_len? 0: -1;
+}
+
+static size_t syszlib_bound(size_t len) {
+	return (size_t)syszlib.bound ((unsigned long)len);
+}
+#endif
+
+/* ---------------------------------------------------------------- archives */
+
+static void tmp_path(char *path, size_t n, const char *what) {
+	snprintf (path, n, "%s/otezip-bench-%ld-%s.zip", tmp_dir, (long)getpid (), what);
+}
+
+static long file_size(const char *path) {
+	FILE *fp = fopen (path, "rb");
+	long n = -1;
+	if (fp && fseek (fp, 0, SEEK_END) == 0) {
+		n = ftell (fp);
+	}
+	if (fp) {
+		fclose (fp);
+	}
+	return n;
+}
+
+/* Archive every corpus item with method, then read every entry back */
+static int bench_archive(const struct corpus *c, const otezip_codec_t *codec) {
+	char path[512];
+	tmp_path (path, sizeof (path), codec->name);
+	size_t bytes = 0;
+	size_t max_len = 0;
+	for (size_t i = 0; i < c->n; i++) {
+		bytes += c->items[i].len;
+		max_len = c->items[i].len > max_len? c->items[i].len: max_len;
+	}
+
+	int err = 0;
+	int rc = 0;
+	double t = now ();
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (size_t i = 0; za && !rc && i < c->n; i++) {
+		const struct sample *s = &c->items[i];
+		zip_int64_t idx = otezip_batch_add (za, s->name, zip_source_buffer (za, s->data, s->len, 0));
+		/* queued entries take the method set on the first one */
+		if (idx < 0 || (i == 0 && zip_set_file_compression (za, 0, codec->method, 0) != 0)) {
+			rc = -1;
+		}
+	}
+	if (!za || (!rc && otezip_batch_commit (za, n_threads) != 0) || zip_close (za) != 0 || rc) {
+		fprintf (stderr, "bench: creating a %s archive failed\n", codec->name);
+		unlink (path);
+		return -1;
+	}
+	double create = now () - t;
+	long archive_bytes = file_size (path);
+
+	uint8_t *buf = (uint8_t *)malloc (max_len + 1);
+	t = now ();
+	za = buf? zip_open (path, ZIP_RDONLY, &err): NULL;
+	for (zip_uint64_t i = 0; za && !rc && i < zip_get_num_files (za); i++) {
+		zip_file_t *zf = zip_fopen_index (za, i, 0);
+		zip_int64_t n = zf? zip_fread (zf, buf, max_len + 1): -1;
+		if (n < 0 || (size_t)n != c->items[i].len) {
+			rc = -1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+	}
+	if (za) {
+		zip_close (za);
+	}
+	double extract = now () - t;
+	free (buf);
+	unlink (path);
+	if (!za || rc) {
+		fprintf (stderr, "bench: extracting the %s archive failed\n", codec->name);
+		return -1;
+	}
+	json_begin_item ();
+	printf ("\"op\": \"create\", \"method\": \"%s\", \"threads\": %d, \"files\": %zu, \"bytes\": %zu, \"archive_bytes\": %ld, \"seconds\": %.6f, \"mb_s\": %.2f}",
+		codec->name, n_threads, c->n, bytes, archive_bytes, create, mb_s (bytes, create));
+	json_begin_item ();
+	printf ("\"op\": \"extract\", \"method\": \"%s\", \"files\": %zu, \"bytes\": %zu, \"seconds\": %.6f, \"mb_s\": %.2f}",
+		codec->name, c->n, bytes, extract, mb_s (bytes, extract));
+	fflush (stdout);
+	return 0;
+}
+
+static void entry_name(char *name, size_t n, zip_uint64_t i) {
+	snprintf (name, n, "dir%03u/file%07llu.txt", (unsigned)(i % 1000), (unsigned long long)i);
+}
+
+struct open_run {
+	const char *path;
+	int rc;
+};
+
+static void run_open(void *arg) {
+	struct open_run *r = (struct open_run *)arg;
+	int err = 0;
+	zip_t *za = zip_open (r->path, ZIP_RDONLY, &err);
+	r->rc = za? 0: -1;
+	if (za) {
+		zip_close (za);
+	}
+}
+
+/* zip_open and zip_name_locate on an archive of n tiny stored entries */
+static int bench_entries(zip_uint64_t n) {
+	char path[512];
+	char name[64];
+	tmp_path (path, sizeof (path), "entries");
+	static const char payload[] = "0123456789abcdef";
+	int err = 0;
+	int rc = 0;
+	double t = now ();
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (zip_uint64_t i = 0; za && !rc && i < n; i++) {
+		entry_name (name, sizeof (name), i);
+		if (zip_file_add (za, name, zip_source_buffer (za, payload, 16, 0), 0) < 0) {
+			rc = -1;
+		}
+	}
+	if (!za || zip_close (za) != 0 || rc) {
+		fprintf (stderr, "bench: creating %llu entries failed\n", (unsigned long long)n);
+		unlink (path);
+		return -1;
+	}
+	double create = now () - t;
+	long archive_bytes = file_size (path);
+
+	struct open_run o = { path, 0 };
+	double open = best_time (run_open, &o);
+
+	/* lookups in scattered order; names are made up front */
+	zip_uint64_t lookups = n < 200000? n: 200000;
+	char (*names)[32] = (char (*)[32])malloc ((size_t)lookups * sizeof (*names));
+	zip_uint64_t *want = (zip_uint64_t *)malloc ((size_t)lookups * sizeof (*want));
+	for (zip_uint64_t i = 0; names && want && i < lookups; i++) {
+		want[i] = (i * 2654435761u) % n;
+		entry_name (names[i], sizeof (names[i]), want[i]);
+	}
+	za = (names && want && !o.rc)? zip_open (path, ZIP_RDONLY, &err): NULL;
+	double first = 0;
+	double locate = 0;
+	if (za) {
+		/* the first lookup builds the name index */
+		t = now ();
+		rc = zip_name_locate (za, names[0], 0) == (zip_int64_t)want[0]? 0: -1;
+		first = now () - t;
+		t = now ();
+		for (zip_uint64_t i = 0; !rc && i < lookups; i++) {
+			if (zip_name_locate (za, names[i], 0) != (zip_int64_t)want[i]) {
+				rc = -1;
+			}
+		}
+		locate = now () - t;
+		zip_close (za);
+	}
+	free (names);
+	free (want);
+	unlink (path);
+	if (!za || rc) {
+		fprintf (stderr, "bench: lookups in %llu entries failed\n", (unsigned long long)n);
+		return -1;
+	}
+	json_begin_item ();
+	printf ("\"op\": \"create_entries\", \"entries\": %llu, \"archive_bytes\": %ld, \"seconds\": %.6f}", (unsigned long long)n, archive_bytes, create);
+	json_begin_item ();
+	printf ("\"op\": \"zip_open\", \"entries\": %llu, \"seconds\": %.6f}", (unsigned long long)n, open);
+	json_begin_item ();
+	printf ("\"op\": \"zip_name_locate\", \"entries\": %llu, \"lookups\": %llu, \"first_seconds\": %.6f, \"ns_per_lookup\": %.1f}",
+		(unsigned long long)n, (unsigned long long)lookups, first, locate * 1e9 / (double)lookups);
+	fflush (stdout);
+	return 0;
+}
+
+/* ---------------------------------------------------------------- main */
+
+static void usage(void) {
+	fprintf (stderr, "Usage: bench [options] > results.json\n"
+		"  -s <MiB>      size of each generated corpus kind (default 4)\n"
+		"  -f <file>     add a file to the corpus (repeatable)\n"
+		"  -m <method>   only benchmark this method (repeatable)\n"
+		"  -l <levels>   comma separated levels (default 1,6,9)\n"
+		"  -n <entries>  largest entry count for zip_open/zip_name_locate (default 1000000)\n"
+		"  -t <seconds>  minimum time spent per measurement (default 0.2)\n"
+		"  -j <threads>  compress archive entries on this many threads (default 1)\n"
+		"  -d <dir>      directory for temporary archives (default /tmp)\n");
+}
+
+static const zip_uint16_t methods[] = {
+	OTEZIP_METHOD_STORE, OTEZIP_METHOD_DEFLATE, OTEZIP_METHOD_ZSTD, OTEZIP_METHOD_LZMA,
+	OTEZIP_METHOD_LZ4, OTEZIP_METHOD_BROTLI, OTEZIP_METHOD_LZFSE,
+};
+
+#define N_METHODS (sizeof (methods) / sizeof (methods[0]))
+
+static int only[N_METHODS];
+static int n_only = 0;
+
+/* A method that can compress and was not filtered out with -m */
+static const otezip_codec_t *method_codec(zip_uint16_t method) {
+	const otezip_codec_t *codec = otezip_get_codec (method);
+	int wanted = n_only == 0;
+	for (int k = 0; k < n_only; k++) {
+		wanted |= only[k] == method;
+	}
+	return (codec && codec->compress && wanted)? codec: NULL;
+}
+
+int main(int argc, char **argv) {
+	struct corpus c = { NULL, 0, 0 };
+	size_t mib = 4;
+	zip_uint64_t max_entries = 1000000;
+	int levels[16] = { 1, 6, 9 };
+	int n_levels = 3;
+	int rc = 0;
+
+	for (int i = 1; i < argc; i++) {
+		const char *arg = i + 1 < argc? argv[i + 1]: NULL;
+		if (!strcmp (argv[i], "-h") || !arg) {
+			usage ();
+			return !strcmp (argv[i], "-h")? 0: 1;
+		}
+		i++;
+		if (!strcmp (argv[i - 1], "-s")) {
+			mib = (size_t)strtoul (arg, NULL, 10);
+		} else if (!strcmp (argv[i - 1], "-f")) {
+			if (corpus_add_file (&c, arg) != 0) {
+				return 1;
+			}
+		} else if (!strcmp (argv[i - 1], "-m")) {
+			int m = otezip_method_from_string (arg);
+			if (m < 0 || n_only == (int)N_METHODS) {
+				fprintf (stderr, "bench: unknown method %s\n", arg);
+				return 1;
+			}
+			only[n_only++] = m;
+		} else if (!strcmp (argv[i - 1], "-l")) {
+			n_levels = 0;
+			for (const char *p = arg; *p && n_levels < 16; p += strspn (p, ",")) {
+				char *end;
+				levels[n_levels++] = (int)strtol (p, &end, 10);
+				p = end;
+			}
+		} else if (!strcmp (argv[i - 1], "-n")) {
+			max_entries = strtoull (arg, NULL, 10);
+		} else if (!strcmp (argv[i - 1], "-t")) {
+			min_time = strtod (arg, NULL);
+		} else if (!strcmp (argv[i - 1], "-j")) {
+			n_threads = atoi (arg);
+		} else if (!strcmp (argv[i - 1], "-d")) {
+			tmp_dir = arg;
+		} else {
+			usage ();
+			return 1;
+		}
+	}
+	/* files from -f come first, then the generated kinds */
+	corpus_build (&c, mib << 20);
+
+	printf ("{\n  \"otezip\": \"%s\", \"corpus_mib\": %zu, \"min_time\": %.3f", OTEZIP_VERSION, mib, min_time);
+
+	json_begin_array ("codecs");
+	for (size_t m = 0; m < N_METHODS; m++) {
+		const otezip_codec_t *codec = method_codec (methods[m]);
+		for (int l = 0; codec && l < (methods[m] == OTEZIP_METHOD_STORE? 1: n_levels); l++) {
+			for (size_t i = 0; i < c.tree_first; i++) {
+				int level = methods[m] == OTEZIP_METHOD_STORE? 0: levels[l];
+				fprintf (stderr, "bench: %s level %d on %s\n", codec->name, level, c.items[i].name);
+				rc |= bench_codec (codec, level, &c.items[i]);
+			}
+		}
+	}
+#ifndef _WIN32
+	syszlib_load ();
+	if (syszlib.compress2 && method_codec (OTEZIP_METHOD_DEFLATE)) {
+		otezip_codec_t sys = { "zlib-system", OTEZIP_METHOD_DEFLATE, NULL, NULL, syszlib_bound, syszlib_compress, syszlib_decompress, NULL };
+		fprintf (stderr, "bench: system zlib %s\n", syszlib.version);
+		for (int l = 0; l < n_levels; l++) {
+			for (size_t i = 0; i < c.tree_first; i++) {
+				rc |= bench_codec (&sys, levels[l], &c.items[i]);
+			}
+		}
+	}
+#endif
+	json_end_array ();
+
+	json_begin_array ("archive");
+	for (size_t m = 0; m < N_METHODS; m++) {
+		const otezip_codec_t *codec = method_codec (methods[m]);
+		if (codec) {
+			fprintf (stderr, "bench: %s archive of %zu files\n", codec->name, c.n);
+			rc |= bench_archive (&c, codec);
+		}
+	}
+	for (zip_uint64_t n = 10000; n <= max_entries; n *= 10) {
+		fprintf (stderr, "bench: archive of %llu entries\n", (unsigned long long)n);
+		rc |= bench_entries (n);
+	}
+	json_end_array ();
+	printf ("\n}\n");
+
+	for (size_t i = 0; i < c.n; i++) {
+		free (c.items[i].data);
+	}
+	free (c.items);
+	return rc? 1: 0;
+}
@@ -334,6 +334,97 @@ test_large_file() {
      fini
  }
 
+test_parallel_create() {
+     init
+     echo "[***] Testing parallel archive creation (-j)"
+     for k in 1 2 3 4 5 6 7 8; do
+         seq 1 $((k * 2000)) > "part$k.txt"
+     done
+     $MZ -c serial.zip part*.txt -z deflate >/dev/null || error "otezip -c failed"
+     $MZ -c parallel.zip part*.txt -z deflate -j 4 >/dev/null || error "otezip -c -j 4 failed"
+     $MZ -l serial.zip > serial.txt
+     $MZ -l parallel.zip > parallel.txt
+     diff -u serial.txt parallel.txt || error "entry order differs with -j"
+     unzip -t parallel.zip >/dev/null || error "unzip -t failed for -j archive"
+     mkdir -p data && cd data
+     $MZ -x ../parallel.zip >/dev/null || error "mzip -x failed for -j archive"
+     for k in 1 2 3 4 5 6 7 8; do
+         cmp -s "part$k.txt" "../part$k.txt" || error "part$k.txt mismatch (-j)"
+     done
+     cd .. && rm -rf data
+     fini
+ }
+
+test_parallel_extract() {
+     init
+     echo "[***] Testing parallel extraction (-x -j)"
+     mkdir -p src/sub
+     for k in 1 2 3 4 5 6 7 8; do
+         seq 1 $((k * 3000)) > "src/part$k.txt"
+         head -c $((k * 1000)) /dev/urandom > "src/sub/rand$k.bin"
+     done
+     $MZ -c mixed.zip src/part*.txt src/sub/rand*.bin -z deflate >/dev/null || error "otezip -c failed"
+     mkdir -p data && cd data
+     $MZ -x ../mixed.zip -j 4 >/dev/null || error "mzip -x -j 4 failed"
+     for f in ../src/part*.txt ../src/sub/rand*.bin; do
+         cmp -s "$(basename "$f")" "$f" || error "$(basename "$f") mismatch (-x -j)"
+     done
+     cd .. && rm -rf data src
+     fini
+ }
+
+test_stats() {
+     init
+     echo "[***] Testing --stats summary"
+     seq 1 20000 > a.txt
+     $MZ -c s.zip a.txt -z deflate --stats > /dev/null 2> create.txt || error "otezip -c --stats failed"
+     $MZ -l s.zip | grep -q -e '--stats' && error "--stats was added as a file"
+     grep -q 'deflate compress 1 entries' create.txt || error "no compress counters in --stats"
+     mkdir -p data && cd data
+     $MZ -x ../s.zip --stats > /dev/null 2> ../extract.txt || error "otezip -x --stats failed"
+     cmp -s a.txt ../a.txt || error "a.txt mismatch (--stats)"
+     cd ..
+     grep -q 'deflate decompress 1 entries' extract.txt || error "no decompress counters in --stats"
+     rm -rf data
+     fini
+ }
+
+test_parallel_deflate() {
+     init
+     echo "[***] Testing chunked deflate of large files (-j)"
+     seq 1 900000 > big.txt
+     $MZ -c p.zip big.txt -z deflate -j 4 >/dev/null || error "otezip -c -j 4 failed"
+     unzip -t p.zip >/dev/null || error "unzip -t failed for chunked deflate"
+     mkdir -p data && cd data
+     $MZ -x ../p.zip --verify-crc >/dev/null || error "mzip -x failed for chunked deflate"
+     cmp -s big.txt ../big.txt || error "big.txt mismatch (chunked deflate)"
+     cd .. && rm -rf data
+     $MZ -g big.txt big.gz -j 4 >/dev/null || error "otezip -g -j 4 failed"
+     if command -v gzip >/dev/null 2>&1; then
+         gzip -t big.gz || error "gzip -t failed for -g -j 4"
+     fi
+     $MZ -d big.gz big.out >/dev/null || error "otezip -d failed for -g -j 4"
+     cmp -s big.out big.txt || error "big.out mismatch (-g -j 4)"
+     fini
+ }
+
+test_integrity() {
+     init
+     echo "[***] Testing archive integrity checks (-t)"
+     seq 1 20000 > a.txt
+     head -c 50000 /dev/urandom > b.bin
+     $MZ -c t.zip a.txt b.bin -z store >/dev/null || error "otezip -c failed"
+     $MZ -t t.zip > ok.txt || error "otezip -t failed for an intact archive"
+     grep -q '^OK    a.txt$' ok.txt || error "no OK line for a.txt (-t)"
+     grep -q '^2 entries tested, 0 failed$' ok.txt || error "no summary (-t)"
+     $MZ -t t.zip -j 1 >/dev/null || error "otezip -t -j 1 failed"
+     printf 'X' | dd of=t.zip bs=1 seek=100 conv=notrunc 2>/dev/null
+     $MZ -t t.zip > bad.txt && error "otezip -t passed a damaged archive"
+     grep -q '^FAIL  a.txt: CRC mismatch$' bad.txt || error "no FAIL line for a.txt (-t)"
+     grep -q '^OK    b.bin$' bad.txt || error "b.bin not reported OK (-t)"
+     fini
+ }
+
 # Run new tests
 test_empty_files || exit 1
 test_binary_file || exit 1
@@ -341,6 +432,11 @@ test_large_random_and_fallback || exit 1
 test_duplicate_names_listing || exit 1
 test_space_in_name || exit 1
 test_large_file || exit 1
+test_parallel_create || exit 1
+test_parallel_extract || exit 1
+test_stats || exit 1
+test_parallel_deflate || exit 1
+test_integrity || exit 1
 
 # Memory leak tests with Valgrind
 check_valgrind() {
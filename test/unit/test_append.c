@@ -0,0 +1,254 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+
+static const char *const payloads[] = {
+	"alpha alpha alpha alpha alpha alpha alpha alpha",
+	"bravo",
+	"charlie charlie charlie",
+	"delta, streamed from a callback with a data descriptor",
+};
+
+/* Callback source of unknown size: streamed, followed by a descriptor */
+struct gen {
+	const char *data;
+	size_t pos;
+};
+
+static zip_int64_t gen_cb(void *userdata, void *data, zip_uint64_t len, zip_source_cmd_t cmd) {
+	struct gen *g = (struct gen *)userdata;
+	switch (cmd) {
+	case ZIP_SOURCE_OPEN:
+		g->pos = 0;
+		return 0;
+	case ZIP_SOURCE_READ: {
+		size_t n = strlen (g->data) - g->pos;
+		if (n > len) {
+			n = (size_t)len;
+		}
+		memcpy (data, g->data + g->pos, n);
+		g->pos += n;
+		return (zip_int64_t)n;
+	}
+	case ZIP_SOURCE_CLOSE:
+	case ZIP_SOURCE_FREE:
+		return 0;
+	default:
+		return -1;
+	}
+}
+
+static uint8_t *slurp(const char *path, size_t *len) {
+	FILE *fp = fopen (path, "rb");
+	uint8_t *buf = NULL;
+	long n = -1;
+	if (fp && fseek (fp, 0, SEEK_END) == 0) {
+		n = ftell (fp);
+	}
+	if (n >= 0 && fseek (fp, 0, SEEK_SET) == 0) {
+		buf = (uint8_t *)malloc ((size_t)n + 1);
+	}
+	if (buf && fread (buf, 1, (size_t)n, fp) != (size_t)n) {
+		free (buf);
+		buf = NULL;
+	}
+	if (fp) {
+		fclose (fp);
+	}
+	*len = buf? (size_t)n: 0;
+	return buf;
+}
+
+/* Check that the archive holds exactly the given names and payloads */
+static int check_archive(const char *path, const char *const *names, const char *const *want, int n) {
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_RDONLY, &err);
+	if (!za || zip_get_num_files (za) != (zip_uint64_t)n) {
+		fprintf (stderr, "unexpected archive (err %d)\n", err);
+		if (za) {
+			zip_close (za);
+		}
+		return 1;
+	}
+	for (int i = 0; i < n && !rc; i++) {
+		char out[128];
+		size_t len = strlen (want[i]);
+		zip_file_t *zf = strcmp (zip_get_name (za, i, 0), names[i]) == 0? zip_fopen_index (za, i, 0): NULL;
+		zip_int64_t got = zf? zip_fread (zf, out, sizeof (out)): -1;
+		if (got != (zip_int64_t)len || memcmp (out, want[i], len) != 0) {
+			fprintf (stderr, "%s: payload mismatch\n", names[i]);
+			rc = 1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+	}
+	zip_close (za);
+	return rc;
+}
+
+/* A codec that cannot compress anything */
+#define METHOD_BROKEN 251
+
+static int broken_compress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags) {
+	(void)ctx;
+	(void)src;
+	(void)src_len;
+	(void)dst;
+	(void)dst_len;
+	(void)comp_flags;
+	return -1;
+}
+
+static int broken_decompress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t dst_len) {
+	(void)ctx;
+	(void)src;
+	(void)src_len;
+	(void)dst;
+	(void)dst_len;
+	return -1;
+}
+
+static zip_source_t *text(zip_t *za, const char *s) {
+	return zip_source_buffer (za, s, strlen (s), 0);
+}
+
+int main(void) {
+	char path[] = "/tmp/otezip-append-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	const char *names[] = { "a.txt", "b.txt", "c.txt", "d.txt" };
+	for (int i = 0; za && i < 3; i++) {
+		if (zip_file_add (za, names[i], text (za, payloads[i]), 0) != i) {
+			rc = 1;
+		}
+	}
+	if (!za || zip_close (za) != 0 || rc) {
+		fprintf (stderr, "creating the archive failed\n");
+		unlink (path);
+		return 1;
+	}
+	size_t old_len;
+	uint8_t *old = slurp (path, &old_len);
+	uint64_t old_cd = old && old_len >= 22? (uint64_t)old[old_len - 6] | (uint64_t)old[old_len - 5] << 8 | (uint64_t)old[old_len - 4] << 16 | (uint64_t)old[old_len - 3] << 24: 0;
+
+	/* appending writes over the old directory and keeps what precedes it */
+	struct gen g = { payloads[3], 0 };
+	za = zip_open (path, ZIP_CREATE, &err);
+	if (!za || zip_set_file_compression (za, 0, ZIP_CM_DEFLATE, 0) != 0 || zip_file_add (za, names[3], zip_source_function (za, gen_cb, &g), 0) != 3) {
+		fprintf (stderr, "appending failed\n");
+		rc = 1;
+	} else if (za->entries[3].local_hdr_ofs != old_cd || !(za->entries[3].flags & 8)) {
+		fprintf (stderr, "appended at %llu, old directory at %llu\n", (unsigned long long)za->entries[3].local_hdr_ofs, (unsigned long long)old_cd);
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	size_t new_len;
+	uint8_t *cur = slurp (path, &new_len);
+	if (!rc && (!cur || new_len < old_cd || memcmp (cur, old, (size_t)old_cd) != 0)) {
+		fprintf (stderr, "existing entries were rewritten\n");
+		rc = 1;
+	}
+	free (old);
+	free (cur);
+	rc |= check_archive (path, names, payloads, 4);
+
+	/* replace and delete leave dead space behind */
+	static const char longer[] = "bravo, now long enough to move to the end of the archive";
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	if (za && (zip_file_replace (za, 1, text (za, longer), 0) != 0 || zip_delete (za, 0) != 0 || zip_delete (za, 9) == 0 || za->dead_bytes == 0)) {
+		fprintf (stderr, "replace/delete failed\n");
+		rc = 1;
+	}
+	uint64_t dead = za? za->dead_bytes: 0;
+	if (za && (zip_name_locate (za, "a.txt", 0) != -1 || zip_name_locate (za, "d.txt", 0) != 2)) {
+		fprintf (stderr, "lookups after delete failed\n");
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	const char *left_names[] = { "b.txt", "c.txt", "d.txt" };
+	const char *left[] = { longer, payloads[2], payloads[3] };
+	rc |= check_archive (path, left_names, left, 3);
+	free (slurp (path, &old_len));
+
+	/* compaction reclaims exactly the dead space */
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	if (za && (otezip_compact (za) != 0 || za->dead_bytes != 0 || za->entries[1].local_hdr_ofs != 0)) {
+		fprintf (stderr, "compaction failed\n");
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	free (slurp (path, &new_len));
+	if (!rc && new_len + dead != old_len) {
+		fprintf (stderr, "compacted %zu -> %zu, %llu dead\n", old_len, new_len, (unsigned long long)dead);
+		rc = 1;
+	}
+	rc |= check_archive (path, left_names, left, 3);
+
+	/* a replacement takes the method in force now, not the old one */
+	static const char again[] = "charlie charlie charlie charlie charlie charlie charlie charlie";
+	zip_stat_t st;
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	if (za) {
+		za->default_method = ZIP_CM_DEFLATE;
+	}
+	if (za && (zip_stat_index (za, 1, 0, &st) != 0 || st.comp_method != ZIP_CM_STORE || zip_file_replace (za, 1, text (za, again), 0) != 0 ||
+		zip_stat_index (za, 1, 0, &st) != 0 || st.comp_method != ZIP_CM_DEFLATE || st.comp_size >= st.size)) {
+		fprintf (stderr, "replacing with deflate failed\n");
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	left[1] = again;
+	rc |= check_archive (path, left_names, left, 3);
+
+	/* a replacement that fails to compress leaves the entry as it was */
+	static const otezip_codec_t broken = { "broken", METHOD_BROKEN, NULL, NULL, NULL, broken_compress, broken_decompress, NULL };
+	zip_stat_t before;
+	if (!rc && otezip_register_codec (&broken) != 0) {
+		rc = 1;
+	}
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	zip_source_t *src = za? text (za, longer): NULL;
+	if (za) {
+		za->default_method = METHOD_BROKEN;
+	}
+	if (za && (zip_stat_index (za, 0, 0, &before) != 0 || zip_file_replace (za, 0, src, 0) == 0 ||
+		zip_stat_index (za, 0, 0, &st) != 0 || st.size != before.size || st.crc != before.crc ||
+		st.comp_size != before.comp_size || st.comp_method != before.comp_method)) {
+		fprintf (stderr, "a failed replace changed the entry\n");
+		rc = 1;
+	}
+	/* a source zip_file_replace refused stays the caller's */
+	zip_source_free (src);
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	rc |= check_archive (path, left_names, left, 3);
+
+	unlink (path);
+	if (!rc) {
+		printf ("append ok\n");
+	}
+	return rc;
+}
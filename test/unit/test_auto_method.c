@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+
+/* Big enough to be streamed rather than read whole */
+#define STREAM_LEN (5u * 1024u * 1024u)
+
+static void fill_random(uint8_t *p, size_t n, uint32_t x) {
+	for (size_t i = 0; i < n; i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		p[i] = (uint8_t)x;
+	}
+}
+
+static void fill_text(uint8_t *p, size_t n) {
+	static const char words[] = "the quick brown fox jumps over the lazy dog\n";
+	for (size_t i = 0; i < n; i++) {
+		p[i] = (uint8_t)words[(i * 7 + i / 44) % (sizeof (words) - 1)];
+	}
+}
+
+static int make_temp(char *path, const uint8_t *data, size_t len) {
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return -1;
+	}
+	int rc = (len && write (fd, data, len) != (ssize_t)len)? -1: 0;
+	close (fd);
+	return rc;
+}
+
+/* Built-in deflate, wrapped to see how often an encoder is set up: once
+ * per context, and again whenever a context is handed other comp_flags */
+static otezip_codec_t builtin_deflate;
+static int encoder_setups;
+static struct {
+	void *ctx;
+	zip_uint32_t comp_flags;
+} encoders[8];
+static int n_encoders;
+
+static int counting_init(void *opaque, int encode, void **ctx) {
+	(void)opaque;
+	return builtin_deflate.init (builtin_deflate.opaque, encode, ctx);
+}
+
+static int counting_compress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags) {
+	int i = 0;
+	while (i < n_encoders && encoders[i].ctx != ctx) {
+		i++;
+	}
+	if (i == n_encoders && n_encoders < 8) {
+		encoders[n_encoders].ctx = ctx;
+		encoders[n_encoders++].comp_flags = comp_flags;
+		encoder_setups++;
+	} else if (i < n_encoders && encoders[i].comp_flags != comp_flags) {
+		encoders[i].comp_flags = comp_flags;
+		encoder_setups++;
+	}
+	return builtin_deflate.compress (ctx, src, src_len, dst, dst_len, comp_flags);
+}
+
+struct sample {
+	const char *name;
+	const uint8_t *data;
+	size_t len;
+	const char *file; /* streamed from this file instead, if set */
+	zip_uint16_t want; /* method auto should pick */
+};
+
+int main(void) {
+	static uint8_t random[300000];
+	static uint8_t text[200000];
+	static uint8_t repeated[300000];
+	fill_random (random, sizeof (random), 2463534242u);
+	fill_text (text, sizeof (text));
+	/* dense bytes that still deflate well: the trial has to notice */
+	for (size_t i = 0; i < sizeof (repeated); i++) {
+		repeated[i] = random[i % 1024];
+	}
+	uint8_t *big_random = (uint8_t *)malloc (STREAM_LEN);
+	uint8_t *big_text = (uint8_t *)malloc (STREAM_LEN);
+	fill_random (big_random, STREAM_LEN, 88172645u);
+	fill_text (big_text, STREAM_LEN);
+	char random_path[] = "/tmp/otezip-auto-rnd-XXXXXX";
+	char text_path[] = "/tmp/otezip-auto-txt-XXXXXX";
+	char path[] = "/tmp/otezip-auto-XXXXXX";
+	if (make_temp (random_path, big_random, STREAM_LEN) != 0 || make_temp (text_path, big_text, STREAM_LEN) != 0 || make_temp (path, NULL, 0) != 0) {
+		return 1;
+	}
+#ifdef OTEZIP_ENABLE_ZSTD
+	const zip_uint16_t strong = OTEZIP_METHOD_ZSTD;
+#else
+	const zip_uint16_t strong = ZIP_CM_DEFLATE;
+#endif
+	const struct sample samples[] = {
+		{ "random.bin", random, sizeof (random), NULL, ZIP_CM_STORE },
+		{ "text.txt", text, sizeof (text), NULL, strong },
+		{ "small.txt", text, 1000, NULL, ZIP_CM_DEFLATE },
+		{ "photo.JPG", text, sizeof (text), NULL, ZIP_CM_STORE },
+		{ "repeated.bin", repeated, sizeof (repeated), NULL, ZIP_CM_DEFLATE },
+		{ "stream-random.bin", big_random, STREAM_LEN, random_path, ZIP_CM_STORE },
+		{ "stream-text.log", big_text, STREAM_LEN, text_path, strong },
+	};
+	const int n = (int)(sizeof (samples) / sizeof (samples[0]));
+
+	int err = 0;
+	int rc = 0;
+	if (otezip_method_from_string ("auto") != OTEZIP_METHOD_AUTO) {
+		fprintf (stderr, "\"auto\" is not a method name\n");
+		rc = 1;
+	}
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (int i = 0; za && i < n && !rc; i++) {
+		const struct sample *s = &samples[i];
+		zip_source_t *src = s->file? zip_source_file (za, s->file, 0, -1): zip_source_buffer (za, s->data, s->len, 0);
+		zip_int64_t idx = otezip_batch_add (za, s->name, src);
+		if (idx != i || zip_set_file_compression (za, (zip_uint64_t)idx, OTEZIP_METHOD_AUTO, 0) != 0) {
+			fprintf (stderr, "adding %s failed\n", s->name);
+			rc = 1;
+		}
+	}
+	if (!za || rc || otezip_batch_commit (za, 2) != 0) {
+		fprintf (stderr, "writing failed (err %d)\n", err);
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	for (int i = 0; za && i < n; i++) {
+		const struct sample *s = &samples[i];
+		zip_stat_t st;
+		zip_stat_init (&st);
+		if (zip_stat_index (za, (zip_uint64_t)i, 0, &st) != 0 || st.comp_method != s->want) {
+			fprintf (stderr, "%s: method %u, expected %u\n", s->name, st.comp_method, s->want);
+			rc = 1;
+			continue;
+		}
+		uint8_t *out = (uint8_t *)malloc (s->len);
+		zip_file_t *zf = zip_fopen_index (za, (zip_uint64_t)i, 0);
+		size_t got = 0;
+		zip_int64_t r = 1;
+		while (zf && out && r > 0 && got < s->len) {
+			r = zip_fread (zf, out + got, s->len - got);
+			got += r > 0? (size_t)r: 0;
+		}
+		if (!zf || got != s->len || memcmp (out, s->data, s->len) != 0) {
+			fprintf (stderr, "%s: payload mismatch\n", s->name);
+			rc = 1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+		free (out);
+	}
+	if (za) {
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+
+	/* dense entries that pass the level 1 trial: the trials get their own
+	 * encoder, so the one compressing entries is set up only once */
+	const otezip_codec_t *deflate = otezip_get_codec (ZIP_CM_DEFLATE);
+	if (deflate) {
+		builtin_deflate = *deflate;
+	}
+	otezip_codec_t counting = builtin_deflate;
+	counting.init = counting_init;
+	counting.compress = counting_compress;
+	za = rc || !deflate || otezip_register_codec (&counting) != 0? NULL: zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (za) {
+		za->default_method = OTEZIP_METHOD_AUTO;
+		za->comp_flags = 9;
+	}
+	for (int i = 0; za && i < 20 && !rc; i++) {
+		char name[32];
+		snprintf (name, sizeof (name), "repeated-%d.bin", i);
+		if (zip_file_add (za, name, zip_source_buffer (za, repeated + i * 1000, 65536, 0), 0) != i) {
+			rc = 1;
+		}
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	/* one encoder for the trials and one for the entries */
+	if (!rc && (n_encoders != 2 || encoder_setups != 2)) {
+		fprintf (stderr, "%d encoders set up %d times for 20 auto entries\n", n_encoders, encoder_setups);
+		rc = 1;
+	}
+	if (deflate) {
+		otezip_register_codec (&builtin_deflate);
+	}
+
+	unlink (random_path);
+	unlink (text_path);
+	unlink (path);
+	free (big_random);
+	free (big_text);
+	if (!rc) {
+		printf ("auto method ok\n");
+	}
+	return rc;
+}
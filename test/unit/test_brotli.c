@@ -0,0 +1,344 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Include Brotli implementation */
+#define OTEZIP_ENABLE_BROTLI
+#include "../../src/lib/brotli.inc.c"
+
+/* Decode src in pieces of in_step input and out_step output bytes */
+static int brotli_decode_pieces(const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t in_step, size_t out_step, size_t *out_len) {
+	z_stream d_strm = { 0 };
+	if (brotliDecompressInit (&d_strm) != Z_OK) {
+		return Z_MEM_ERROR;
+	}
+	size_t in_pos = 0;
+	int ret = Z_OK;
+	while (ret == Z_OK || ret == Z_BUF_ERROR) {
+		size_t in_n = n - in_pos < in_step? n - in_pos: in_step;
+		size_t out_n = cap - d_strm.total_out < out_step? cap - d_strm.total_out: out_step;
+		d_strm.next_in = src + in_pos;
+		d_strm.avail_in = (uInt)in_n;
+		d_strm.next_out = dst + d_strm.total_out;
+		d_strm.avail_out = (uInt)out_n;
+		ret = brotliDecompress (&d_strm, in_pos + in_n == n? Z_FINISH: Z_NO_FLUSH);
+		in_pos += in_n - d_strm.avail_in;
+		if (ret == Z_BUF_ERROR && in_pos == n && out_n > 0) {
+			break; /* no progress with all input given */
+		}
+	}
+	*out_len = d_strm.total_out;
+	brotliDecompressEnd (&d_strm);
+	return ret;
+}
+
+/* Simple test to compress and decompress data using Brotli */
+int test_brotli_compress_decompress() {
+	const char *test_data = "Hello, this is a test of Brotli compression and decompression. "
+				"This should verify the basic functionality of our Brotli implementation.";
+	const size_t data_len = strlen (test_data);
+	uint8_t compressed[1024] = { 0 };
+	uint8_t decompressed[1024] = { 0 };
+
+	z_stream c_strm = { 0 };
+	if (brotliInit (&c_strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
+		printf ("brotliInit failed\n");
+		return 1;
+	}
+	c_strm.next_in = (uint8_t *)test_data;
+	c_strm.avail_in = data_len;
+	c_strm.next_out = compressed;
+	c_strm.avail_out = sizeof (compressed);
+	int compress_result = brotliCompress (&c_strm, Z_FINISH);
+	size_t compressed_len = c_strm.total_out;
+	brotliEnd (&c_strm);
+	if (compress_result != Z_STREAM_END) {
+		printf ("brotliCompress failed with result %d\n", compress_result);
+		return 1;
+	}
+
+	printf ("Original data size: %zu bytes\n", data_len);
+	printf ("Compressed data size: %zu bytes\n", compressed_len);
+
+	/* English text this short only shrinks through the static dictionary */
+	if (compressed_len >= data_len) {
+		printf ("ERROR: text did not shrink\n");
+		return 1;
+	}
+	size_t got = 0;
+	int ret = brotli_decode_pieces (compressed, compressed_len, decompressed, sizeof (decompressed), compressed_len, sizeof (decompressed), &got);
+	if (ret != Z_STREAM_END || got != data_len || memcmp (decompressed, test_data, data_len) != 0) {
+		printf ("ERROR: round trip failed (%d, %zu bytes)\n", ret, got);
+		return 1;
+	}
+	printf ("TEST PASSED: Brotli compression and decompression successful!\n");
+	return 0;
+}
+
+/* An empty input is a valid stream of one byte */
+int test_brotli_empty() {
+	uint8_t compressed[16];
+	uint8_t out[16];
+	z_stream c_strm = { 0 };
+	if (brotliInit (&c_strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
+		printf ("brotliInit failed\n");
+		return 1;
+	}
+	c_strm.next_in = NULL;
+	c_strm.avail_in = 0;
+	c_strm.next_out = compressed;
+	c_strm.avail_out = sizeof (compressed);
+	int ret = brotliCompress (&c_strm, Z_FINISH);
+	size_t clen = c_strm.total_out;
+	brotliEnd (&c_strm);
+	size_t got = 1;
+	int r2 = brotli_decode_pieces (compressed, clen, out, sizeof (out), clen, sizeof (out), &got);
+	if (ret != Z_STREAM_END || clen != 1 || r2 != Z_STREAM_END || got != 0) {
+		printf ("ERROR: empty stream (%d, %zu bytes, %d)\n", ret, clen, r2);
+		return 1;
+	}
+	printf ("TEST PASSED: empty Brotli stream.\n");
+	return 0;
+}
+
+/* Every quality, plus a small window, must round trip whole and in small
+ * pieces */
+int test_brotli_levels() {
+	size_t test_size = 600000;
+	size_t cap = test_size + test_size / 8 + 1024;
+	uint8_t *data = malloc (test_size);
+	uint8_t *compressed = malloc (cap);
+	uint8_t *decompressed = malloc (test_size);
+	if (!data || !compressed || !decompressed) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (compressed);
+		free (decompressed);
+		return 1;
+	}
+	/* text with repeats near and far, noise, a long run and a copy from
+	 * beyond a small window, spanning several meta-blocks */
+	uint32_t seed = 1;
+	size_t n = 0;
+	while (n < 400000) {
+		n += (size_t)sprintf ((char *)data + n, "line %u: the value is %u\n", (unsigned)(n % 1000), (unsigned)(n * 7 % 13));
+	}
+	for (; n < 520000; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	memset (data + n, 'z', 20000);
+	memcpy (data + n + 20000, data + 1000, test_size - n - 20000);
+
+	int rc = 0;
+	for (int q = 0; q <= 12 && !rc; q++) {
+		int quality = q == 12? 5: q;
+		int window_bits = q == 12? 10: 0;
+		z_stream c_strm = { 0 };
+		if (brotliCompressInit2 (&c_strm, quality, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+			printf ("brotliCompressInit2 failed\n");
+			rc = 1;
+			break;
+		}
+		c_strm.next_in = data;
+		c_strm.avail_in = (uInt)test_size;
+		c_strm.next_out = compressed;
+		c_strm.avail_out = (uInt)cap;
+		int ret = brotliCompress (&c_strm, Z_FINISH);
+		size_t clen = c_strm.total_out;
+		brotliEnd (&c_strm);
+		if (ret != Z_STREAM_END) {
+			printf ("quality %d: compression failed (%d)\n", quality, ret);
+			rc = 1;
+			break;
+		}
+		size_t got = 0;
+		int r1 = brotli_decode_pieces (compressed, clen, decompressed, test_size, clen, test_size, &got);
+		int ok1 = r1 == Z_STREAM_END && got == test_size && memcmp (decompressed, data, test_size) == 0;
+		memset (decompressed, 0, test_size);
+		int r2 = brotli_decode_pieces (compressed, clen, decompressed, test_size, 7, 1000, &got);
+		int ok2 = r2 == Z_STREAM_END && got == test_size && memcmp (decompressed, data, test_size) == 0;
+		printf ("Quality %d%s: %zu -> %zu bytes\n", quality, q == 12? " (1 KiB window)": "", test_size, clen);
+		if (!ok1 || !ok2) {
+			printf ("ERROR: quality %d round trip failed (%d, %d)\n", quality, r1, r2);
+			rc = 1;
+		}
+	}
+	if (!rc) {
+		printf ("TEST PASSED: Brotli qualities and window sizes round trip.\n");
+	}
+	free (data);
+	free (compressed);
+	free (decompressed);
+	return rc;
+}
+
+/* Stream written by Google's libbrotli (quality 11, lgwin 22, text mode)
+ * for ref_text(): context modeling and static dictionary references */
+static const uint8_t brotli_ref_stream[] = {
+	0x1b, 0xef, 0x14, 0x00, 0x8c, 0x94, 0x6e, 0xc6, 0xa2, 0xd2, 0xe1, 0x54,
+	0xca, 0x92, 0xc7, 0x99, 0x73, 0x4b, 0x10, 0x32, 0x37, 0xa8, 0xc6, 0x42,
+	0x97, 0x55, 0xd1, 0x7a, 0x44, 0x06, 0xce, 0x9c, 0xf3, 0x5f, 0x4a, 0x85,
+	0xaa, 0xf3, 0x1f, 0x02, 0xc1, 0xbf, 0xa9, 0xad, 0x71, 0xf2, 0x21, 0x36,
+	0x47, 0x18, 0xc4, 0x64, 0xf6, 0xf0, 0x63, 0xc8, 0xce, 0x11, 0x47, 0x7d,
+	0x2f, 0xc9, 0x1e, 0x88, 0xdf, 0x57, 0x33, 0xfc, 0xbe, 0xd5, 0xaf, 0xea,
+	0x5b, 0xd3, 0xd3, 0xea, 0xbe, 0x67, 0xbf, 0x47, 0x13, 0x1e, 0x78, 0x3d,
+	0x49, 0xfe, 0xfd, 0x27, 0xd7, 0x0f, 0x19, 0xf1, 0xc1, 0xd3, 0x5f, 0xcc,
+	0xd7, 0x73, 0xfe, 0x53, 0xfa, 0x87, 0x84, 0x74, 0x03, 0xb5, 0x82, 0xac,
+	0xbb, 0x14, 0x3d, 0xa1, 0xd6, 0x3b, 0x34, 0xfa, 0x94, 0x56, 0xdf, 0xd0,
+	0xe9, 0x97, 0x2b, 0x94, 0xfe, 0x3d, 0x4a, 0x0f, 0x3c, 0xe2, 0x06, 0xf0,
+	0x4b, 0x10, 0x7e, 0x07, 0x3a, 0xca, 0x57, 0xd1, 0xbe, 0x83, 0xf1, 0x13,
+	0x6c, 0xbf, 0x8b, 0xe3, 0x4f, 0x70, 0xfd, 0x0d, 0x9e, 0x7e, 0x9d, 0x58,
+	0xeb, 0xac, 0x4c, 0xc4, 0x3a, 0x91, 0x89, 0xdc, 0x27, 0x8b, 0xf2, 0x15,
+	0xb4, 0xef, 0x60, 0xfc, 0x14, 0xdb, 0xef, 0xe0, 0xf8, 0x13, 0x5c, 0x7f,
+	0x8b, 0xa7, 0x5f, 0x26, 0xd5, 0xba, 0x2a, 0x93, 0xb0, 0x2e, 0x74, 0x12,
+	0xf7, 0xc5, 0xa0, 0x7c, 0x05, 0xed, 0xbb, 0x18, 0x3f, 0xc1, 0xf6, 0x3b,
+	0x38, 0xfe, 0x14, 0xd7, 0xdf, 0xe0, 0xe9, 0x97, 0xc9, 0xb5, 0xee, 0xea,
+	0x64, 0xac, 0x1b, 0x99, 0xcc, 0x7d, 0x33, 0x28, 0x5f, 0x45, 0xfb, 0x0e,
+	0xc6, 0x4f, 0xb0, 0xfd, 0x2e, 0x8e, 0x3f, 0xc1, 0xf5, 0x37, 0x78, 0xfa,
+	0x75, 0x4a, 0xad, 0xa7, 0x32, 0x05, 0xeb, 0x41, 0xa6, 0x70, 0x3f, 0x2c,
+	0xca, 0x57, 0xd0, 0xbe, 0x83, 0xf1, 0x53, 0x6c, 0xbf, 0x83, 0xe3, 0x4f,
+	0x70, 0xfd, 0x2d, 0xde, 0x13, 0x0e,
+};
+
+static size_t ref_text(char *dst) {
+	size_t n = 0;
+	for (int i = 0; i < 60; i++) {
+		n += (size_t)sprintf (dst + n, "<li class=\"item\"><a href=\"/page/%d.html\">Chapter %d: %s</a></li>\n", i, i,
+			i % 3 == 0? "Introduction to the system": i % 3 == 1? "Configuration and management": "Frequently asked questions");
+	}
+	return n;
+}
+
+/* A stream from another encoder, whole and in pieces; cut short, it must
+ * be reported as corrupt rather than as a shorter entry */
+int test_brotli_reference_stream() {
+	char want[8192];
+	uint8_t out[8192];
+	size_t wn = ref_text (want);
+	size_t got = 0;
+	int r1 = brotli_decode_pieces (brotli_ref_stream, sizeof (brotli_ref_stream), out, sizeof (out), sizeof (brotli_ref_stream), sizeof (out), &got);
+	int ok1 = r1 == Z_STREAM_END && got == wn && memcmp (out, want, wn) == 0;
+	int r2 = brotli_decode_pieces (brotli_ref_stream, sizeof (brotli_ref_stream), out, sizeof (out), 3, 50, &got);
+	int ok2 = r2 == Z_STREAM_END && got == wn && memcmp (out, want, wn) == 0;
+	int r3 = brotli_decode_pieces (brotli_ref_stream, sizeof (brotli_ref_stream) - 20, out, sizeof (out), 64, sizeof (out), &got);
+	if (!ok1 || !ok2 || r3 != Z_DATA_ERROR) {
+		printf ("ERROR: reference stream: %d %d %d\n", r1, r2, r3);
+		return 1;
+	}
+	printf ("TEST PASSED: Brotli reference stream decodes whole and in pieces.\n");
+	return 0;
+}
+
+/* Run one whole stream through run() with Z_FINISH into dst */
+static int brotli_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *len) {
+	strm->next_in = (uint8_t *)src;
+	strm->avail_in = (uInt)n;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)cap;
+	int ret;
+	do {
+		ret = run (strm, Z_FINISH);
+	} while (ret == Z_OK && strm->avail_out > 0);
+	*len = strm->total_out;
+	return ret == Z_STREAM_END? 0: -1;
+}
+
+/* A stream reset after a large entry must encode a small one exactly
+ * like a fresh stream, and a reset decoder must read both back */
+int test_brotli_reset() {
+	size_t big = 200000;
+	size_t small = 3000;
+	size_t cap = big + big / 8 + 1024;
+	uint8_t *data = malloc (big);
+	uint8_t *c1 = malloc (cap);
+	uint8_t *c2 = malloc (cap);
+	uint8_t *ref = malloc (cap);
+	uint8_t *out = malloc (big);
+	if (!data || !c1 || !c2 || !ref || !out) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (c1);
+		free (c2);
+		free (ref);
+		free (out);
+		return 1;
+	}
+	uint32_t seed = 7;
+	size_t n = 0;
+	while (n + 64 < big) {
+		n += (size_t)sprintf ((char *)data + n, "entry %u holds %u\n", (unsigned)(n % 977), (unsigned)(n * 13 % 31));
+	}
+	for (; n < big; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	const uint8_t *second = data + 10000;
+
+	int rc = 0;
+	size_t ref_len = 0;
+	size_t len1 = 0;
+	size_t len2 = 0;
+	z_stream strm = { 0 };
+	if (brotliInit (&strm, 9) != Z_OK || brotli_pass (&strm, brotliCompress, second, small, ref, cap, &ref_len) != 0) {
+		printf ("fresh stream failed\n");
+		rc = 1;
+	}
+	brotliEnd (&strm);
+
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (brotliInit (&strm, 9) != Z_OK || brotli_pass (&strm, brotliCompress, data, big, c1, cap, &len1) != 0 ||
+		brotliReset (&strm) != Z_OK || brotli_pass (&strm, brotliCompress, second, small, c2, cap, &len2) != 0)) {
+		printf ("reset stream failed\n");
+		rc = 1;
+	}
+	brotliEnd (&strm);
+	if (!rc && (len2 != ref_len || memcmp (c2, ref, ref_len) != 0)) {
+		printf ("ERROR: reset stream output differs from a fresh one (%zu vs %zu bytes)\n", len2, ref_len);
+		rc = 1;
+	}
+
+	size_t got = 0;
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (brotliDecompressInit (&strm) != Z_OK || brotli_pass (&strm, brotliDecompress, c1, len1, out, big, &got) != 0 || got != big || memcmp (out, data, big) != 0)) {
+		printf ("ERROR: first stream does not decode\n");
+		rc = 1;
+	}
+	if (!rc && (brotliDecompressReset (&strm) != Z_OK || brotli_pass (&strm, brotliDecompress, c2, len2, out, big, &got) != 0 || got != small || memcmp (out, second, small) != 0)) {
+		printf ("ERROR: reset decoder failed on the second stream\n");
+		rc = 1;
+	}
+	brotliDecompressEnd (&strm);
+	if (!rc) {
+		printf ("TEST PASSED: %zu and %zu bytes through reset streams (%zu, %zu bytes).\n", big, small, len1, len2);
+	}
+	free (data);
+	free (c1);
+	free (c2);
+	free (ref);
+	free (out);
+	return rc;
+}
+
+int main(int argc, char *argv[]) {
+	(void)argc;
+	(void)argv;
+
+	printf ("Running Brotli basic test...\n");
+	int result1 = test_brotli_compress_decompress ();
+
+	printf ("\nRunning Brotli empty stream test...\n");
+	int result2 = test_brotli_empty ();
+
+	printf ("\nRunning Brotli quality test...\n");
+	int result3 = test_brotli_levels ();
+
+	printf ("\nRunning Brotli reference stream test...\n");
+	int result4 = test_brotli_reference_stream ();
+
+	printf ("\nRunning Brotli reset test...\n");
+	int result5 = test_brotli_reset ();
+
+	return (result1 || result2 || result3 || result4 || result5);
+}
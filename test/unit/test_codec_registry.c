@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define METHOD_RLE 250
+
+/* Calls seen by the test codecs */
+struct calls {
+	int init;
+	int end;
+	int compress;
+	int decompress;
+};
+
+static int rle_init(void *opaque, int encode, void **ctx) {
+	(void)encode;
+	((struct calls *)opaque)->init++;
+	*ctx = opaque;
+	return 0;
+}
+
+static void rle_end(void *ctx) {
+	((struct calls *)ctx)->end++;
+}
+
+/* (count, byte) pairs, runs of up to 255 */
+static int rle_compress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags) {
+	(void)comp_flags;
+	((struct calls *)ctx)->compress++;
+	size_t o = 0;
+	for (size_t i = 0; i < src_len;) {
+		size_t run = 1;
+		while (i + run < src_len && run < 255 && src[i + run] == src[i]) {
+			run++;
+		}
+		if (o + 2 > *dst_len) {
+			return 1;
+		}
+		dst[o++] = (zip_uint8_t)run;
+		dst[o++] = src[i];
+		i += run;
+	}
+	*dst_len = o;
+	return 0;
+}
+
+static int rle_decompress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t dst_len) {
+	((struct calls *)ctx)->decompress++;
+	size_t o = 0;
+	for (size_t i = 0; i + 1 < src_len; i += 2) {
+		if (src[i] > dst_len - o) {
+			return -1;
+		}
+		memset (dst + o, src[i + 1], src[i]);
+		o += src[i];
+	}
+	return (src_len % 2 == 0 && o == dst_len)? 0: -1;
+}
+
+/* Built-in zstd, wrapped by the override below */
+static otezip_codec_t builtin_zstd;
+static struct calls zstd_calls;
+
+/* ctx comes from the built-in init, kept in the override */
+static int counting_compress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t *dst_len, zip_uint32_t comp_flags) {
+	zstd_calls.compress++;
+	return builtin_zstd.compress (ctx, src, src_len, dst, dst_len, comp_flags);
+}
+
+static int counting_decompress(void *ctx, const zip_uint8_t *src, size_t src_len, zip_uint8_t *dst, size_t dst_len) {
+	zstd_calls.decompress++;
+	return builtin_zstd.decompress (ctx, src, src_len, dst, dst_len);
+}
+
+/* Write runs and noise with method, then read both back */
+static int round_trip(zip_uint16_t method, const uint8_t *runs, size_t runs_len, const uint8_t *noise, size_t noise_len) {
+	char path[] = "/tmp/otezip-codec-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	int err = -1;
+	int rc = 1;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	zip_int64_t idx = za? otezip_batch_add (za, "runs.bin", zip_source_buffer (za, runs, runs_len, 0)): -1;
+	if (idx == 0 && zip_set_file_compression (za, 0, method, 0) == 0 && zip_file_add (za, "noise.bin", zip_source_buffer (za, noise, noise_len, 0), 0) == 1) {
+		rc = 0;
+	} else {
+		fprintf (stderr, "adding entries with method %u failed\n", method);
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		rc |= check_method (za, 0, method) || check_entry (za, 0, runs, runs_len);
+		/* noise does not shrink, so it falls back to STORE */
+		rc |= check_method (za, 1, ZIP_CM_STORE) || check_entry (za, 1, noise, noise_len);
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	unlink (path);
+	return rc;
+}
+
+int main(void) {
+	enum { runs_len = 100000, noise_len = 5000 };
+	static uint8_t runs[runs_len];
+	static uint8_t noise[noise_len];
+	for (size_t i = 0; i < runs_len; i++) {
+		runs[i] = (uint8_t)('a' + (i / 1000) % 26);
+	}
+	uint32_t x = 12345;
+	for (size_t i = 0; i < noise_len; i++) {
+		x = x * 1103515245u + 12345u;
+		noise[i] = (uint8_t)(x >> 24);
+		if (i % 2) {
+			noise[i] ^= (uint8_t)i; /* no runs for RLE either */
+		}
+	}
+	int rc = 0;
+
+	/* a new method: unknown until registered */
+	struct calls rle_calls = { 0 };
+	otezip_codec_t rle = { "rle", METHOD_RLE, &rle_calls, rle_init, NULL, rle_compress, rle_decompress, rle_end };
+	if (otezip_method_from_string ("rle") != -1 || otezip_get_codec (METHOD_RLE)) {
+		fprintf (stderr, "rle known before registration\n");
+		rc = 1;
+	}
+	if (otezip_register_codec (&rle) != 0 || otezip_method_from_string ("rle") != METHOD_RLE) {
+		fprintf (stderr, "rle registration failed\n");
+		return 1;
+	}
+	rc |= round_trip (METHOD_RLE, runs, runs_len, noise, noise_len);
+	/* one context per archive: both entries are compressed with the same */
+	if (rle_calls.compress != 2 || rle_calls.decompress != 1 || rle_calls.init != 2 || rle_calls.end != 2) {
+		fprintf (stderr, "rle calls: init %d compress %d decompress %d end %d\n", rle_calls.init, rle_calls.compress, rle_calls.decompress, rle_calls.end);
+		rc = 1;
+	}
+
+	/* replacing a built-in reroutes both directions through it */
+	const otezip_codec_t *zstd = otezip_get_codec (OTEZIP_METHOD_ZSTD);
+	if (zstd) {
+		builtin_zstd = *zstd;
+		otezip_codec_t counting = builtin_zstd;
+		counting.compress = counting_compress;
+		counting.decompress = counting_decompress;
+		if (otezip_register_codec (&counting) != 0) {
+			fprintf (stderr, "zstd override failed\n");
+			rc = 1;
+		}
+		rc |= round_trip (OTEZIP_METHOD_ZSTD, runs, runs_len, noise, noise_len);
+		if (zstd_calls.compress != 2 || zstd_calls.decompress != 1) {
+			fprintf (stderr, "zstd override calls: compress %d decompress %d\n", zstd_calls.compress, zstd_calls.decompress);
+			rc = 1;
+		}
+		if (otezip_register_codec (&builtin_zstd) != 0 || otezip_get_codec (OTEZIP_METHOD_ZSTD)->compress != builtin_zstd.compress) {
+			fprintf (stderr, "restoring built-in zstd failed\n");
+			rc = 1;
+		}
+	}
+
+	/* invalid registrations are refused */
+	otezip_codec_t clash = rle;
+	clash.method = METHOD_RLE + 1;
+	otezip_codec_t nameless = rle;
+	nameless.name = NULL;
+	if (otezip_register_codec (NULL) == 0 || otezip_register_codec (&clash) == 0 || otezip_register_codec (&nameless) == 0) {
+		fprintf (stderr, "invalid codec accepted\n");
+		rc = 1;
+	}
+
+	/* a decode-only method cannot be selected for writing */
+	otezip_codec_t decode_only = { "rle-read", METHOD_RLE + 2, &rle_calls, NULL, NULL, NULL, rle_decompress, NULL };
+	char path[] = "/tmp/otezip-codec-XXXXXX";
+	int fd = mkstemp (path);
+	int err = -1;
+	zip_t *za = fd >= 0? zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err): NULL;
+	if (fd >= 0) {
+		close (fd);
+	}
+	if (!za || otezip_batch_add (za, "runs.bin", zip_source_buffer (za, runs, 10, 0)) != 0 || otezip_register_codec (&decode_only) != 0 || zip_set_file_compression (za, 0, METHOD_RLE + 2, 0) == 0 || zip_set_file_compression (za, 0, 0x10000, 0) == 0) {
+		fprintf (stderr, "decode-only or out of range method accepted\n");
+		rc = 1;
+	}
+	if (za && (zip_set_file_compression (za, 0, METHOD_RLE, 0) != 0 || zip_close (za) != 0)) {
+		fprintf (stderr, "closing with a queued rle entry failed\n");
+		rc = 1;
+	}
+	unlink (path);
+
+	if (!rc) {
+		printf ("codec registry ok\n");
+	}
+	return rc;
+}
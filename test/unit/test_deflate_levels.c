@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MDEFLATE_IMPLEMENTATION
+#include "../../src/lib/deflate.inc.c"
+
+/* Compress a mixed payload at every level with raw, zlib and gzip framing,
+ * feeding input and draining output in small odd-sized pieces, and
+ * decompress it again. Higher levels must not compress worse than level 1. */
+
+enum { payload_size = 200000 };
+
+static void fill_payload(uint8_t *p, size_t n) {
+	static const char *words[] = { "zip ", "archive ", "deflate ", "entry ", "central ", "directory ", "header " };
+	uint32_t x = 42;
+	size_t i = 0;
+	while (i < n) {
+		x = x * 1103515245u + 12345u;
+		if ((x >> 28) == 0) {
+			/* a little incompressible noise */
+			p[i++] = (uint8_t)(x >> 16);
+			continue;
+		}
+		if ((x >> 28) == 1) {
+			/* runs with a period under 8 bytes: overlapping matches */
+			size_t period = 1 + (x >> 4) % 5;
+			for (size_t k = 20 + (x >> 8) % 60; k > 0 && i < n; k--) {
+				p[i++] = (uint8_t)('a' + k % period);
+			}
+			continue;
+		}
+		const char *w = words[(x >> 16) % 7];
+		while (*w && i < n) {
+			p[i++] = (uint8_t)*w++;
+		}
+	}
+}
+
+/* Runs of text and random bytes in turn, text first, so stored blocks
+ * border Huffman ones in both orders. Returns the total length. */
+static size_t fill_mixed(uint8_t *p, const size_t *runs, int n_runs) {
+	uint32_t x = 2463534242u;
+	size_t i = 0;
+	for (int r = 0; r < n_runs; r++) {
+		if (r % 2 == 0) {
+			fill_payload (p + i, runs[r]);
+		} else {
+			for (size_t k = 0; k < runs[r]; k++) {
+				x ^= x << 13;
+				x ^= x >> 17;
+				x ^= x << 5;
+				p[i + k] = (uint8_t)x;
+			}
+		}
+		i += runs[r];
+	}
+	return i;
+}
+
+/* One deflate call over all of in, the way otezip compresses an entry */
+static long compress_once(const uint8_t *in, size_t n, uint8_t *out, size_t cap, int level, int wbits) {
+	z_stream s = { 0 };
+	if (deflateInit2 (&s, level, Z_DEFLATED, wbits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return -1;
+	}
+	s.next_in = (uint8_t *)in;
+	s.avail_in = (unsigned int)n;
+	s.next_out = out;
+	s.avail_out = (unsigned int)cap;
+	long total = deflate (&s, Z_FINISH) == Z_STREAM_END? (long)s.total_out: -1;
+	deflateEnd (&s);
+	return total;
+}
+
+static long compress_stream(const uint8_t *in, size_t n, uint8_t *out, size_t cap, int level, int wbits) {
+	z_stream s = { 0 };
+	if (deflateInit2 (&s, level, Z_DEFLATED, wbits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return -1;
+	}
+	size_t pos = 0;
+	int ret = Z_OK;
+	s.next_out = out;
+	while (ret != Z_STREAM_END) {
+		size_t chunk = n - pos < 7777? n - pos: 7777;
+		s.next_in = (uint8_t *)in + pos;
+		s.avail_in = (unsigned int)chunk;
+		int flush = pos + chunk == n? Z_FINISH: Z_NO_FLUSH;
+		do {
+			size_t room = cap - (size_t)(s.next_out - out);
+			s.avail_out = room < 91? (unsigned int)room: 91;
+			ret = deflate (&s, flush);
+			if (ret < 0 && ret != Z_BUF_ERROR) {
+				deflateEnd (&s);
+				return -1;
+			}
+		} while (s.avail_out == 0 || (flush == Z_FINISH && ret != Z_STREAM_END));
+		pos = (size_t)(s.next_in - in);
+	}
+	long total = (long)s.total_out;
+	deflateEnd (&s);
+	return total;
+}
+
+static int check_roundtrip(const uint8_t *comp, size_t comp_len, int wbits, const uint8_t *expected, size_t n) {
+	uint8_t *out = (uint8_t *)malloc (n + 1);
+	z_stream s = { 0 };
+	if (!out || inflateInit2 (&s, wbits) != Z_OK) {
+		free (out);
+		return 1;
+	}
+	s.next_in = (uint8_t *)comp;
+	s.avail_in = (unsigned int)comp_len;
+	s.next_out = out;
+	s.avail_out = (unsigned int)(n + 1);
+	int ret = inflate (&s, Z_FINISH);
+	int rc = ret != Z_STREAM_END || s.total_out != n || memcmp (out, expected, n) != 0;
+
+	/* again into small pieces, so matches reach back across calls */
+	memset (out, 0, n + 1);
+	inflateReset (&s);
+	s.next_in = (uint8_t *)comp;
+	s.avail_in = (unsigned int)comp_len;
+	s.next_out = out;
+	ret = Z_OK;
+	for (unsigned piece = 1; ret == Z_OK && s.total_out <= n; piece = piece % 97 + 1) {
+		s.avail_out = piece;
+		ret = inflate (&s, Z_NO_FLUSH);
+	}
+	rc |= ret != Z_STREAM_END || s.total_out != n || memcmp (out, expected, n) != 0;
+	inflateEnd (&s);
+	free (out);
+	return rc;
+}
+
+int main(void) {
+	static const int wrappers[] = { -MAX_WBITS, MAX_WBITS, MAX_WBITS + 16, -9 };
+	uint8_t *payload = (uint8_t *)malloc (payload_size);
+	size_t cap = compressBound (payload_size);
+	uint8_t *comp = (uint8_t *)malloc (cap);
+	if (!payload || !comp) {
+		return 1;
+	}
+	fill_payload (payload, payload_size);
+
+	long sizes[10] = { 0 };
+	for (int w = 0; w < 4; w++) {
+		for (int level = 0; level <= 9; level++) {
+			long len = compress_stream (payload, payload_size, comp, cap, level, wrappers[w]);
+			if (len < 0 || check_roundtrip (comp, (size_t)len, wrappers[w], payload, payload_size)) {
+				printf ("round trip failed: level %d windowBits %d\n", level, wrappers[w]);
+				free (payload);
+				free (comp);
+				return 1;
+			}
+			if (w == 0) {
+				sizes[level] = len;
+			}
+		}
+	}
+
+	/* the block boundaries move with the sizes of the runs */
+	static const size_t layouts[][6] = {
+		{ 1000, 20000 },
+		{ 1000, 20000, 30000, 20000, 5000 },
+		{ 0, 20000, 1000 },
+		{ 5000, 40000, 700, 33333, 12345, 50000 },
+	};
+	for (int l = 0; l < (int)(sizeof (layouts) / sizeof (layouts[0])); l++) {
+		size_t n = fill_mixed (payload, layouts[l], 6);
+		for (int level = 0; level <= 9; level++) {
+			for (int streamed = 0; streamed < 2; streamed++) {
+				long len = streamed? compress_stream (payload, n, comp, cap, level, -MAX_WBITS): compress_once (payload, n, comp, cap, level, -MAX_WBITS);
+				if (len < 0 || check_roundtrip (comp, (size_t)len, -MAX_WBITS, payload, n)) {
+					printf ("mixed round trip failed: layout %d level %d%s\n", l, level, streamed? " (streamed)": "");
+					free (payload);
+					free (comp);
+					return 1;
+				}
+			}
+		}
+	}
+	free (payload);
+	free (comp);
+
+	printf ("Compressed sizes by level:");
+	for (int level = 0; level <= 9; level++) {
+		printf (" %ld", sizes[level]);
+	}
+	printf ("\n");
+	if (sizes[0] < payload_size || sizes[9] > sizes[1] || sizes[6] > sizes[1]) {
+		printf ("ERROR: compression levels do not trade speed for ratio\n");
+		return 1;
+	}
+	printf ("TEST PASSED: all deflate levels round trip.\n");
+	return 0;
+}
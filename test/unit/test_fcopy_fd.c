@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define BIG_LEN (3u * 1024u * 1024u + 999u)
+
+struct sample {
+	const char *name;
+	zip_uint16_t method;
+	size_t len;
+};
+
+/* Copy entry index from skip on into a fresh file opened with flags and
+ * compare it with want. Returns what otezip_fcopy_fd returned, or -2
+ * when the output is wrong. */
+static zip_int64_t copy_entry(zip_t *za, zip_uint64_t index, zip_uint64_t skip, int flags, const uint8_t *want, size_t len) {
+	char out[] = "/tmp/otezip-fcopy-out-XXXXXX";
+	int fd = mkstemp (out);
+	if (fd < 0) {
+		return -2;
+	}
+	close (fd);
+	fd = open (out, O_WRONLY | O_TRUNC | flags);
+	zip_file_t *zf = fd >= 0? zip_fopen_index (za, index, 0): NULL;
+	zip_int64_t n = (zf && zip_fseek (zf, (zip_int64_t)skip, SEEK_SET) == 0)? otezip_fcopy_fd (zf, fd): -2;
+	if (zf) {
+		zip_fclose (zf);
+	}
+	if (fd >= 0) {
+		close (fd);
+	}
+	uint8_t *got = (uint8_t *)malloc (len + 1);
+	FILE *fp = fopen (out, "rb");
+	size_t r = (fp && got)? fread (got, 1, len + 1, fp): 0;
+	if (fp) {
+		fclose (fp);
+	}
+	if (n >= 0 && (n != (zip_int64_t)(len - skip) || r != len - skip || memcmp (got, want + skip, r) != 0)) {
+		n = -2;
+	}
+	free (got);
+	unlink (out);
+	return n;
+}
+
+int main(void) {
+	uint8_t *big = (uint8_t *)malloc (BIG_LEN);
+	fill_text (big, BIG_LEN, 2463534242u);
+	char path[] = "/tmp/otezip-fcopy-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	const struct sample samples[] = {
+		{ "stored.txt", ZIP_CM_STORE, BIG_LEN },
+		{ "deflate.txt", ZIP_CM_DEFLATE, BIG_LEN },
+		{ "empty.txt", ZIP_CM_STORE, 0 },
+#ifdef OTEZIP_ENABLE_ZSTD
+		{ "zstd.txt", OTEZIP_METHOD_ZSTD, 100000 },
+#endif
+	};
+	const int n = (int)(sizeof (samples) / sizeof (samples[0]));
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (int i = 0; za && i < n && !rc; i++) {
+		za->default_method = samples[i].method;
+		if (zip_file_add (za, samples[i].name, zip_source_buffer (za, big, samples[i].len, 0), 0) != i) {
+			rc = 1;
+		}
+	}
+	if (!za || rc || zip_close (za) != 0) {
+		fprintf (stderr, "creating the archive failed (err %d)\n", err);
+		return 1;
+	}
+
+	/* whole entries, the rest after a seek, and appending outputs (no
+	 * kernel copy into O_APPEND files), with and without CRC checks */
+	za = zip_open (path, ZIP_RDONLY, &err);
+	for (int verify = 0; za && verify < 2; verify++) {
+		otezip_verify_crc = verify;
+		for (int i = 0; i < n; i++) {
+			const struct sample *s = &samples[i];
+			zip_uint64_t skip = s->len / 3;
+			if (copy_entry (za, (zip_uint64_t)i, 0, 0, big, s->len) < 0 || copy_entry (za, (zip_uint64_t)i, skip, 0, big, s->len) < 0 ||
+				copy_entry (za, (zip_uint64_t)i, 0, O_APPEND, big, s->len) < 0) {
+				fprintf (stderr, "%s: copy failed (verify %d)\n", s->name, verify);
+				rc = 1;
+			}
+		}
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* a damaged stored entry is caught only when the CRC is checked */
+	FILE *fp = rc? NULL: fopen (path, "r+b");
+	zip_stat_t st;
+	zip_stat_init (&st);
+	za = fp? zip_open (path, ZIP_RDONLY, &err): NULL;
+	zip_file_t *zf = za? zip_fopen_index (za, 0, 0): NULL;
+	if (!zf || zip_stat_index (za, 0, 0, &st) != 0) {
+		rc = 1;
+	}
+	/* flip a byte of the stored data */
+	uint64_t at = zf? zf->data_ofs + 1000: 0;
+	if (zf) {
+		zip_fclose (zf);
+	}
+	if (za) {
+		zip_close (za);
+	}
+	if (fp && (fseek (fp, (long)at, SEEK_SET) != 0 || fputc ('#', fp) == EOF)) {
+		rc = 1;
+	}
+	if (fp) {
+		fclose (fp);
+	}
+	big[1000] = '#';
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	otezip_verify_crc = 1;
+	if (za && copy_entry (za, 0, 0, 0, big, BIG_LEN) != -1) {
+		fprintf (stderr, "CRC mismatch not reported\n");
+		rc = 1;
+	}
+	otezip_verify_crc = 0;
+	if (za && copy_entry (za, 0, 0, 0, big, BIG_LEN) < 0) {
+		fprintf (stderr, "unchecked copy of the damaged entry failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (path);
+	free (big);
+	if (!rc) {
+		printf ("fcopy fd ok\n");
+	}
+	return rc;
+}
@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define ENTRY_LEN (3u * 1024u * 1024u + 4321u)
+#define SPAN (256u * 1024u)
+
+static uint32_t next_rand(uint32_t *x) {
+	*x ^= *x << 13;
+	*x ^= *x >> 17;
+	*x ^= *x << 5;
+	return *x;
+}
+
+/* Read len bytes at the current position and compare them with want */
+static int check_range(zip_file_t *zf, const uint8_t *want, zip_uint64_t at, size_t len) {
+	uint8_t buf[4096];
+	if (len > sizeof (buf) || zip_ftell (zf) != (zip_int64_t)at) {
+		return 1;
+	}
+	size_t got = 0;
+	while (got < len) {
+		zip_int64_t r = zip_fread (zf, buf + got, len - got);
+		if (r <= 0) {
+			return 1;
+		}
+		got += (size_t)r;
+	}
+	return memcmp (buf, want + at, len) != 0 || zip_ftell (zf) != (zip_int64_t)(at + len);
+}
+
+/* Jump around the entry with every whence, reading a little each time */
+static int seek_around(zip_file_t *zf, const uint8_t *want, uint32_t seed) {
+	zip_uint64_t pos = 0;
+	for (int i = 0; i < 60; i++) {
+		zip_uint64_t target = next_rand (&seed) % (ENTRY_LEN - 100);
+		int whence = i % 3 == 0? SEEK_SET: i % 3 == 1? SEEK_CUR: SEEK_END;
+		zip_int64_t offset = whence == SEEK_SET? (zip_int64_t)target: whence == SEEK_CUR? (zip_int64_t)target - (zip_int64_t)pos: (zip_int64_t)target - (zip_int64_t)ENTRY_LEN;
+		size_t len = 1 + next_rand (&seed) % 99;
+		if (zip_fseek (zf, offset, whence) != 0 || check_range (zf, want, target, len) != 0) {
+			fprintf (stderr, "seek %d to %llu (whence %d) failed\n", i, (unsigned long long)target, whence);
+			return 1;
+		}
+		pos = target + len;
+	}
+	/* out of range or unknown whence: refused, position kept */
+	if (zip_fseek (zf, 1, SEEK_END) == 0 || zip_fseek (zf, -(zip_int64_t)pos - 1, SEEK_CUR) == 0 || zip_fseek (zf, 0, 42) == 0 || zip_ftell (zf) != (zip_int64_t)pos) {
+		fprintf (stderr, "bad seeks were accepted\n");
+		return 1;
+	}
+	/* the end is reachable; back at 0 a full read checks the CRC again */
+	uint8_t b;
+	if (zip_fseek (zf, 0, SEEK_END) != 0 || zip_fread (zf, &b, 1) != 0 || zip_fseek (zf, 0, SEEK_SET) != 0) {
+		return 1;
+	}
+	zip_uint64_t total = 0;
+	uint8_t buf[65536];
+	zip_int64_t r;
+	while ((r = zip_fread (zf, buf, sizeof (buf))) > 0) {
+		if (memcmp (buf, want + total, (size_t)r) != 0) {
+			return 1;
+		}
+		total += (zip_uint64_t)r;
+	}
+	return r != 0 || total != ENTRY_LEN;
+}
+
+int main(void) {
+	uint8_t *text = (uint8_t *)malloc (ENTRY_LEN);
+	uint8_t *other = (uint8_t *)malloc (ENTRY_LEN);
+	fill_text (text, ENTRY_LEN, 2463534242u);
+	fill_text (other, ENTRY_LEN, 88172645u);
+	char path[] = "/tmp/otezip-fseek-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+	otezip_verify_crc = 1;
+
+	/* stored, deflate, and deflate joined from parallel chunks */
+	const uint8_t *want[3] = { text, text, other };
+	const zip_uint16_t methods[3] = { ZIP_CM_STORE, ZIP_CM_DEFLATE, ZIP_CM_DEFLATE };
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (int i = 0; za && i < 3 && !rc; i++) {
+		char name[16];
+		snprintf (name, sizeof (name), "entry%d", i);
+		otezip_set_deflate_threads (za, i == 2? 3: 1);
+		za->default_method = methods[i];
+		if (zip_file_add (za, name, zip_source_buffer (za, want[i], ENTRY_LEN, 0), 0) != i) {
+			rc = 1;
+		}
+	}
+	if (!za || rc || zip_close (za) != 0) {
+		fprintf (stderr, "creating the archive failed (err %d)\n", err);
+		return 1;
+	}
+
+	/* without access points deflate seeks back from the start */
+	za = zip_open (path, ZIP_RDONLY, &err);
+	for (int i = 0; za && i < 3 && !rc; i++) {
+		zip_file_t *zf = zip_fopen_index (za, (zip_uint64_t)i, 0);
+		if (!zf || seek_around (zf, want[i], 123456789u + (uint32_t)i) != 0) {
+			fprintf (stderr, "entry %d: seeking without access points failed\n", i);
+			rc = 1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* with a span the first pass records points, later handles reuse them */
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za && otezip_set_seek_span (za, SPAN) != 0) {
+		rc = 1;
+	}
+	for (int i = 1; za && i < 3 && !rc; i++) {
+		zip_file_t *zf = zip_fopen_index (za, (zip_uint64_t)i, 0);
+		if (!zf || !zf->points || !zf->collect || seek_around (zf, want[i], 362436069u + (uint32_t)i) != 0) {
+			fprintf (stderr, "entry %d: seeking while recording failed\n", i);
+			rc = 1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+		zf = rc? NULL: zip_fopen_index (za, (zip_uint64_t)i, 0);
+		if (zf && (zf->collect || seek_around (zf, want[i], 521288629u + (uint32_t)i) != 0)) {
+			fprintf (stderr, "entry %d: seeking from access points failed\n", i);
+			rc = 1;
+		}
+		if (zf) {
+			zip_fclose (zf);
+		}
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (path);
+	free (text);
+	free (other);
+	if (!rc) {
+		printf ("fseek ok\n");
+	}
+	return rc;
+}
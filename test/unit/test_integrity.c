@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define BIG_LEN (3u * 1024u * 1024u + 321u)
+
+struct sample {
+	const char *name;
+	zip_uint16_t method;
+	size_t len;
+};
+
+static const struct sample samples[] = {
+	{ "stored.txt", ZIP_CM_STORE, BIG_LEN },
+	{ "deflate.txt", ZIP_CM_DEFLATE, BIG_LEN },
+	{ "small.txt", ZIP_CM_DEFLATE, 1000 },
+	{ "empty.txt", ZIP_CM_STORE, 0 },
+#ifdef OTEZIP_ENABLE_ZSTD
+	{ "zstd.txt", OTEZIP_METHOD_ZSTD, 100000 },
+#endif
+#ifdef OTEZIP_ENABLE_LZMA
+	{ "lzma.txt", OTEZIP_METHOD_LZMA, 100000 },
+#endif
+};
+
+#define N_SAMPLES ((int)(sizeof (samples) / sizeof (samples[0])))
+
+/* Test za on n_threads; want[i] is the error expected for entry i */
+static int check_results(zip_t *za, int n_threads, const int *want) {
+	otezip_test_result_t results[N_SAMPLES];
+	int n_bad = 0;
+	for (int i = 0; i < N_SAMPLES; i++) {
+		n_bad += want[i] != ZIP_ER_OK;
+	}
+	zip_int64_t failed = otezip_test_archive (za, n_threads, results);
+	if (failed != n_bad || otezip_test_archive (za, n_threads, NULL) != n_bad) {
+		fprintf (stderr, "%d threads: %lld failed, %d expected\n", n_threads, (long long)failed, n_bad);
+		return 1;
+	}
+	for (int i = 0; i < N_SAMPLES; i++) {
+		const otezip_test_result_t *r = &results[i];
+		zip_stat_t st;
+		zip_stat_init (&st);
+		if (r->index != (zip_uint64_t)i || !r->name || strcmp (r->name, samples[i].name) != 0 || zip_stat_index (za, (zip_uint64_t)i, 0, &st) != 0) {
+			fprintf (stderr, "%d threads: entry %d misreported\n", n_threads, i);
+			return 1;
+		}
+		if (want[i] == ZIP_ER_OK? (r->error != ZIP_ER_OK || r->size != st.size || r->crc != st.crc): r->error == ZIP_ER_OK) {
+			fprintf (stderr, "%d threads: %s: error %d, expected %d\n", n_threads, r->name, r->error, want[i]);
+			return 1;
+		}
+		if (want[i] > 0 && r->error != want[i]) {
+			fprintf (stderr, "%d threads: %s: error %d, expected %d\n", n_threads, r->name, r->error, want[i]);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* Overwrite the byte at ofs of the file at path */
+static int poke(const char *path, long ofs, int c) {
+	FILE *fp = fopen (path, "r+b");
+	int rc = !fp || fseek (fp, ofs, SEEK_SET) != 0 || fputc (c, fp) == EOF;
+	if (fp) {
+		fclose (fp);
+	}
+	return rc;
+}
+
+int main(void) {
+	uint8_t *big = (uint8_t *)malloc (BIG_LEN);
+	fill_text (big, BIG_LEN, 2463534242u);
+	char path[] = "/tmp/otezip-integrity-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	for (int i = 0; za && i < N_SAMPLES && !rc; i++) {
+		za->default_method = samples[i].method;
+		if (zip_file_add (za, samples[i].name, zip_source_buffer (za, big, samples[i].len, 0), 0) != i) {
+			rc = 1;
+		}
+	}
+	if (!za || rc || zip_close (za) != 0) {
+		fprintf (stderr, "creating the archive failed (err %d)\n", err);
+		return 1;
+	}
+
+	/* intact: mapped and threaded, serial, in memory, and writable */
+	int want[N_SAMPLES] = { 0 };
+	za = zip_open (path, ZIP_RDONLY, &err);
+	if (!za || check_results (za, 1, want) || check_results (za, 4, want)) {
+		rc = 1;
+	}
+	/* every method here streams through the scratch buffers: no entry is
+	 * decoded into a buffer of its own */
+	otezip_stats_t st;
+	if (za && otezip_set_stats (za, &st) == 0) {
+		if (check_results (za, 2, want) || st.allocs != 0) {
+			fprintf (stderr, "testing allocated %llu entry buffers\n", (unsigned long long)st.allocs);
+			rc = 1;
+		}
+		otezip_set_stats (za, NULL);
+	}
+	if (za) {
+		zip_close (za);
+	}
+	FILE *fp = fopen (path, "rb");
+	uint8_t *copy = (uint8_t *)malloc (2 * BIG_LEN);
+	size_t len = fp? fread (copy, 1, 2 * BIG_LEN, fp): 0;
+	if (fp) {
+		fclose (fp);
+	}
+	za = otezip_open_memory (copy, len, ZIP_RDONLY, &err);
+	if (!za || check_results (za, 3, want)) {
+		fprintf (stderr, "testing in memory failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	if (!za || check_results (za, 4, want)) {
+		fprintf (stderr, "testing a writable archive failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* damaged: a stored byte, deflate data, and an unknown method in the
+	 * directory record of the small entry */
+	zip_uint64_t data_ofs[2] = { 0, 0 };
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	for (int i = 0; za && i < 2; i++) {
+		zip_file_t *zf = zip_fopen_index (za, (zip_uint64_t)i, 0);
+		data_ofs[i] = zf? zf->data_ofs: 0;
+		if (zf) {
+			zip_fclose (zf);
+		}
+	}
+	if (za) {
+		zip_close (za);
+	}
+	long cd_small = -1;
+	for (size_t i = 0, seen = 0; i + 4 <= len; i++) {
+		if (memcmp (copy + i, "PK\1\2", 4) == 0 && seen++ == 2) {
+			cd_small = (long)i;
+			break;
+		}
+	}
+	if (!data_ofs[0] || !data_ofs[1] || cd_small < 0 || poke (path, (long)data_ofs[0] + 5000, '#') ||
+		poke (path, (long)data_ofs[1] + 20000, copy[data_ofs[1] + 20000] ^ 0x55) || poke (path, cd_small + 10, 99)) {
+		rc = 1;
+	}
+	want[0] = ZIP_ER_CRC;
+	want[1] = -1; /* undecodable or a CRC mismatch, depending on the bits */
+	want[2] = ZIP_ER_COMPNOTSUPP;
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za && (check_results (za, 1, want) || check_results (za, 4, want))) {
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (path);
+	free (copy);
+	free (big);
+	if (!rc) {
+		printf ("integrity test ok\n");
+	}
+	return rc;
+}
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+
+#define N_ENTRIES 2000
+
+static void entry_name(char *buf, size_t len, int i) {
+	snprintf (buf, len, "dir/file%04d.txt", i);
+}
+
+static int undecoded(const zip_t *za, zip_uint64_t i) {
+	return za->entries[i].name == NULL;
+}
+
+/* Read entry index whole and compare it with its expected payload */
+static int check_payload(zip_t *za, zip_uint64_t index) {
+	char want[32];
+	char got[64];
+	snprintf (want, sizeof (want), "payload %llu", (unsigned long long)index);
+	zip_file_t *zf = zip_fopen_index (za, index, 0);
+	zip_int64_t n = zf? zip_fread (zf, got, sizeof (got)): -1;
+	if (zf) {
+		zip_fclose (zf);
+	}
+	return n != (zip_int64_t)strlen (want) || memcmp (got, want, (size_t)n) != 0;
+}
+
+int main(void) {
+	char path[] = "/tmp/otezip-lazy-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+	char index_path[64];
+	snprintf (index_path, sizeof (index_path), "%s.idx", path);
+
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	char payloads[N_ENTRIES][32];
+	for (int i = 0; za && i < N_ENTRIES && !rc; i++) {
+		char name[32];
+		entry_name (name, sizeof (name), i);
+		snprintf (payloads[i], sizeof (payloads[i]), "payload %d", i);
+		if (zip_file_add (za, name, zip_source_buffer (za, payloads[i], strlen (payloads[i]), 0), 0) != i) {
+			rc = 1;
+		}
+	}
+	/* a second entry with an earlier name: lookups must find the first */
+	if (!za || rc || zip_file_add (za, "dir/file0100.txt", zip_source_buffer (za, "dup", 3, 0), 0) != N_ENTRIES || zip_close (za) != 0) {
+		fprintf (stderr, "creating the archive failed (err %d)\n", err);
+		return 1;
+	}
+
+	/* nothing is decoded before it is asked for */
+	za = zip_open (path, ZIP_RDONLY | OTEZIP_LAZY, &err);
+	if (!za || zip_get_num_files (za) != N_ENTRIES + 1 || !undecoded (za, 0) || !undecoded (za, N_ENTRIES)) {
+		fprintf (stderr, "lazy open failed (err %d)\n", err);
+		return 1;
+	}
+	const char *name = zip_get_name (za, 5, 0);
+	if (!name || strcmp (name, "dir/file0005.txt") != 0 || !undecoded (za, 6)) {
+		fprintf (stderr, "zip_get_name decoded too much or the wrong record\n");
+		rc = 1;
+	}
+	if (zip_name_locate (za, "dir/file0100.txt", 0) != 100 || !undecoded (za, 101) || check_payload (za, 100)) {
+		fprintf (stderr, "lookup before the end of the directory failed\n");
+		rc = 1;
+	}
+	if (zip_name_locate (za, "FILE1500.TXT", ZIP_FL_NOCASE | ZIP_FL_NODIR) != 1500 || zip_name_locate (za, "missing", 0) != -1) {
+		fprintf (stderr, "lookups with flags failed\n");
+		rc = 1;
+	}
+	/* everything has been seen now: the regular tables take over */
+	if (za->entries[N_ENTRIES].name == NULL || zip_name_locate (za, "dir/file1999.txt", 0) != 1999) {
+		fprintf (stderr, "lookup after a full scan failed\n");
+		rc = 1;
+	}
+	if (otezip_write_index (za, index_path) != 0) {
+		fprintf (stderr, "otezip_write_index failed\n");
+		rc = 1;
+	}
+	zip_close (za);
+
+	/* with the sidecar only the candidates are decoded */
+	za = rc? NULL: zip_open (path, ZIP_RDONLY | OTEZIP_LAZY, &err);
+	if (za && otezip_open_index (za, index_path) != 0) {
+		fprintf (stderr, "otezip_open_index failed\n");
+		rc = 1;
+	}
+	zip_stat_t st;
+	zip_stat_init (&st);
+	if (za && !rc && (zip_name_locate (za, "dir/file1999.txt", 0) != 1999 || !undecoded (za, 1998) || !undecoded (za, 0))) {
+		fprintf (stderr, "indexed lookup decoded the wrong records\n");
+		rc = 1;
+	}
+	if (za && !rc && (zip_stat (za, "dir/file0100.txt", 0, &st) != 0 || st.index != 100 || st.size != strlen (payloads[100]) || check_payload (za, 1999))) {
+		fprintf (stderr, "indexed stat or read failed\n");
+		rc = 1;
+	}
+	if (za && !rc && (zip_name_locate (za, "dir/file2000.txt", 0) != -1 || zip_name_locate (za, "dir/FILE0007.txt", ZIP_FL_NOCASE) != 7)) {
+		fprintf (stderr, "indexed misses failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* a table without an empty slot: misses end after one pass */
+	FILE *fp = rc? NULL: fopen (index_path, "r+b");
+	uint8_t hdr[56];
+	if (fp && fread (hdr, 1, sizeof (hdr), fp) == sizeof (hdr)) {
+		uint64_t slots = 0;
+		for (int k = 7; k >= 0; k--) {
+			slots = slots << 8 | hdr[48 + k];
+		}
+		uint8_t full[8] = { 0xef, 0xbe, 0xad, 0xde, 1, 0, 0, 0 };
+		fseek (fp, (long)(sizeof (hdr) + 8 * (N_ENTRIES + 1)), SEEK_SET);
+		for (uint64_t k = 0; k < slots; k++) {
+			fwrite (full, 1, sizeof (full), fp);
+		}
+	} else {
+		rc = 1;
+	}
+	if (fp) {
+		fclose (fp);
+	}
+	za = rc? NULL: zip_open (path, ZIP_RDONLY | OTEZIP_LAZY, &err);
+	if (za && (otezip_open_index (za, index_path) != 0 || zip_name_locate (za, "missing", 0) != -1)) {
+		fprintf (stderr, "full sidecar table mishandled\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* eager archives take no sidecar */
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za && (otezip_open_index (za, index_path) == 0 || otezip_write_index (za, index_path) == 0)) {
+		fprintf (stderr, "sidecar accepted without OTEZIP_LAZY\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* once the archive changes the sidecar is refused */
+	za = rc? NULL: zip_open (path, ZIP_CREATE, &err);
+	if (za && (zip_file_add (za, "late.txt", zip_source_buffer (za, "late", 4, 0), 0) != N_ENTRIES + 1 || zip_close (za) != 0)) {
+		rc = 1;
+	}
+	za = rc? NULL: zip_open (path, ZIP_RDONLY | OTEZIP_LAZY, &err);
+	if (za && (otezip_open_index (za, index_path) == 0 || zip_name_locate (za, "late.txt", 0) != N_ENTRIES + 1)) {
+		fprintf (stderr, "stale sidecar accepted\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (path);
+	unlink (index_path);
+	if (!rc) {
+		printf ("lazy open ok\n");
+	}
+	return rc;
+}
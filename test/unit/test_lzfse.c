@@ -21,6 +21,7 @@ typedef struct z_stream_s {
 #define Z_OK 0
 #define Z_STREAM_END 1
 #define Z_STREAM_ERROR -2
+#define Z_DATA_ERROR -3
 #define Z_BUF_ERROR -5
 #define Z_FINISH 4
 #define Z_DEFAULT_COMPRESSION 1
@@ -217,6 +218,241 @@ int test_lzfse_large_data() {
 	return 0;
 }
 
+/* Round trip through the zlib-style wrappers; returns the compressed size
+ * or 0 on failure */
+static size_t lzfse_round_trip(const uint8_t *data, size_t n, uint8_t *compressed, size_t cap, uint8_t *decompressed) {
+	z_stream c_strm = { 0 };
+	if (lzfseInit (&c_strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
+		return 0;
+	}
+	c_strm.next_in = (uint8_t *)data;
+	c_strm.avail_in = (uInt)n;
+	c_strm.next_out = compressed;
+	c_strm.avail_out = (uInt)cap;
+	int ret = lzfseCompress (&c_strm, Z_FINISH);
+	size_t clen = c_strm.total_out;
+	lzfseEnd (&c_strm);
+	if (ret != Z_STREAM_END) {
+		return 0;
+	}
+	z_stream d_strm = { 0 };
+	if (lzfseDecompressInit (&d_strm) != Z_OK) {
+		return 0;
+	}
+	d_strm.next_in = compressed;
+	d_strm.avail_in = (uInt)clen;
+	d_strm.next_out = decompressed;
+	d_strm.avail_out = (uInt)n;
+	ret = lzfseDecompress (&d_strm, Z_FINISH);
+	size_t dlen = d_strm.total_out;
+	lzfseDecompressEnd (&d_strm);
+	if (ret != Z_STREAM_END || dlen != n || memcmp (decompressed, data, n) != 0) {
+		return 0;
+	}
+	return clen;
+}
+
+/* Small inputs are LZVN blocks, larger ones v2 blocks, noise is stored,
+ * and every stream ends with the end-of-stream magic */
+int test_lzfse_block_types() {
+	size_t test_size = 1600000;
+	size_t cap = test_size + 4096;
+	uint8_t *data = malloc (test_size);
+	uint8_t *noise = malloc (4000);
+	uint8_t *compressed = malloc (cap);
+	uint8_t *decompressed = malloc (test_size);
+	if (!data || !noise || !compressed || !decompressed) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (noise);
+		free (compressed);
+		free (decompressed);
+		return 1;
+	}
+	/* text with short repeats (well over 10000 matches, so several
+	 * blocks), a region of noise and a long run */
+	uint32_t seed = 1;
+	size_t n = 0;
+	while (n < 1200000) {
+		n += (size_t)sprintf ((char *)data + n, "line %u: the value is %u\n", (unsigned)(n % 1000), (unsigned)(n * 7 % 13));
+	}
+	for (; n < 1400000; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t) (seed >> 16);
+	}
+	memset (data + n, 'z', test_size - n);
+	for (size_t i = 0; i < 4000; i++) {
+		seed = seed * 1103515245 + 12345;
+		noise[i] = (uint8_t) (seed >> 16);
+	}
+
+	struct {
+		const char *name;
+		const uint8_t *data;
+		size_t size;
+		const char *magic;
+	} cases[] = {
+		{ "empty", data, 0, "bvx$" },
+		{ "short text", data, 3000, "bvxn" },
+		{ "short noise", noise, 4000, "bvx-" },
+		{ "text", data, 300000, "bvx2" },
+		{ "mixed, several blocks", data, test_size, "bvx2" },
+	};
+	int rc = 0;
+	for (size_t i = 0; i < sizeof (cases) / sizeof (cases[0]); i++) {
+		size_t clen = lzfse_round_trip (cases[i].data, cases[i].size, compressed, cap, decompressed);
+		printf ("%s: %zu -> %zu bytes\n", cases[i].name, cases[i].size, clen);
+		if (!clen || memcmp (compressed, cases[i].magic, 4) != 0 || memcmp (compressed + clen - 4, "bvx$", 4) != 0) {
+			printf ("ERROR: %s: bad stream\n", cases[i].name);
+			rc = 1;
+		}
+	}
+	if (!rc && lzfse_decompress (compressed, 100, decompressed, test_size) != 0) {
+		printf ("ERROR: truncated stream accepted\n");
+		rc = 1;
+	}
+	if (!rc) {
+		printf ("TEST PASSED: LZFSE block types round trip.\n");
+	}
+	free (data);
+	free (noise);
+	free (compressed);
+	free (decompressed);
+	return rc;
+}
+
+/* Hand-assembled LZVN block using every opcode family: small and large
+ * literals, small/medium/large/previous distance, small and large matches
+ * and a nop */
+static const uint8_t lzvn_ref_stream[] = {
+	'b', 'v', 'x', 'n', 79, 0, 0, 0, 47, 0, 0, 0,
+	0xe3, 'a', 'b', 'c', /* 3 literals */
+	0x50, 0x03, 'X', /* 1 literal, match 5 at distance 3 */
+	0xf4, /* match 4, previous distance */
+	0xe0, 0x00, '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+	0xa4, 0x41, 0x00, /* match 20 at distance 16 */
+	0x87, 0x31, 0x00, 'y', 'z', /* 2 literals, match 3 at distance 49 */
+	0x4e, 'q', /* 1 literal, match 4, previous distance */
+	0x0e, /* nop */
+	0xf0, 0x04, /* match 20, previous distance */
+	0x06, 0, 0, 0, 0, 0, 0, 0, /* end of LZVN payload */
+	'b', 'v', 'x', '$'
+};
+
+int test_lzfse_lzvn_stream() {
+	const char *want = "abcXbcXbcXbcX0123456789ABCDEF0123456789ABCDEF0123yzcXbqXbcXbcX0123456789ABCDEF0";
+	const uint8_t legacy[] = { 0x06, 5, 0, 0, 0, 'h', 'e', 'l', 'l', 'o' };
+	uint8_t out[128];
+	size_t n = lzfse_decompress (lzvn_ref_stream, sizeof (lzvn_ref_stream), out, sizeof (out));
+	if (n != strlen (want) || memcmp (out, want, n) != 0) {
+		printf ("ERROR: LZVN stream decoded to %zu bytes\n", n);
+		return 1;
+	}
+	/* cut before the end-of-stream magic, or with the output one short */
+	if (lzfse_decompress (lzvn_ref_stream, sizeof (lzvn_ref_stream) - 4, out, sizeof (out)) != 0 ||
+		lzfse_decompress (lzvn_ref_stream, sizeof (lzvn_ref_stream), out, strlen (want) - 1) != 0) {
+		printf ("ERROR: damaged LZVN stream accepted\n");
+		return 1;
+	}
+	/* entries written before the real block format */
+	if (lzfse_decompress (legacy, sizeof (legacy), out, sizeof (out)) != 5 || memcmp (out, "hello", 5) != 0) {
+		printf ("ERROR: legacy raw block not decoded\n");
+		return 1;
+	}
+	printf ("TEST PASSED: LZFSE LZVN and legacy streams decode.\n");
+	return 0;
+}
+
+/* Run one whole stream through run() with Z_FINISH into dst */
+static int lzfse_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *len) {
+	strm->next_in = (uint8_t *)src;
+	strm->avail_in = (uInt)n;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)cap;
+	int ret;
+	do {
+		ret = run (strm, Z_FINISH);
+	} while (ret == Z_OK && strm->avail_out > 0);
+	*len = strm->total_out;
+	return ret == Z_STREAM_END? 0: -1;
+}
+
+/* A stream reset after a large entry must encode a small one exactly
+ * like a fresh stream, and a reset decoder must read both back */
+int test_lzfse_reset() {
+	size_t big = 200000;
+	size_t small = 3000;
+	size_t cap = big + big / 8 + 1024;
+	uint8_t *data = malloc (big);
+	uint8_t *c1 = malloc (cap);
+	uint8_t *c2 = malloc (cap);
+	uint8_t *ref = malloc (cap);
+	uint8_t *out = malloc (big);
+	if (!data || !c1 || !c2 || !ref || !out) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (c1);
+		free (c2);
+		free (ref);
+		free (out);
+		return 1;
+	}
+	uint32_t seed = 7;
+	size_t n = 0;
+	while (n + 64 < big) {
+		n += (size_t)sprintf ((char *)data + n, "entry %u holds %u\n", (unsigned)(n % 977), (unsigned)(n * 13 % 31));
+	}
+	for (; n < big; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	const uint8_t *second = data + 10000;
+
+	int rc = 0;
+	size_t ref_len = 0;
+	size_t len1 = 0;
+	size_t len2 = 0;
+	z_stream strm = { 0 };
+	if (lzfseInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK || lzfse_pass (&strm, lzfseCompress, second, small, ref, cap, &ref_len) != 0) {
+		printf ("fresh stream failed\n");
+		rc = 1;
+	}
+	lzfseEnd (&strm);
+
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (lzfseInit (&strm, Z_DEFAULT_COMPRESSION) != Z_OK || lzfse_pass (&strm, lzfseCompress, data, big, c1, cap, &len1) != 0 ||
+		lzfseReset (&strm) != Z_OK || lzfse_pass (&strm, lzfseCompress, second, small, c2, cap, &len2) != 0)) {
+		printf ("reset stream failed\n");
+		rc = 1;
+	}
+	lzfseEnd (&strm);
+	if (!rc && (len2 != ref_len || memcmp (c2, ref, ref_len) != 0)) {
+		printf ("ERROR: reset stream output differs from a fresh one (%zu vs %zu bytes)\n", len2, ref_len);
+		rc = 1;
+	}
+
+	size_t got = 0;
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (lzfseDecompressInit (&strm) != Z_OK || lzfse_pass (&strm, lzfseDecompress, c1, len1, out, big, &got) != 0 || got != big || memcmp (out, data, big) != 0)) {
+		printf ("ERROR: first stream does not decode\n");
+		rc = 1;
+	}
+	if (!rc && (lzfseDecompressReset (&strm) != Z_OK || lzfse_pass (&strm, lzfseDecompress, c2, len2, out, big, &got) != 0 || got != small || memcmp (out, second, small) != 0)) {
+		printf ("ERROR: reset decoder failed on the second stream\n");
+		rc = 1;
+	}
+	lzfseDecompressEnd (&strm);
+	if (!rc) {
+		printf ("TEST PASSED: %zu and %zu bytes through reset streams (%zu, %zu bytes).\n", big, small, len1, len2);
+	}
+	free (data);
+	free (c1);
+	free (c2);
+	free (ref);
+	free (out);
+	return rc;
+}
+
 int main(int argc, char *argv[]) {
 	(void)argc;
 	(void)argv;
@@ -226,5 +462,14 @@ int main(int argc, char *argv[]) {
 	printf ("\nRunning LZFSE large data test...\n");
 	int result2 = test_lzfse_large_data ();
 
-	return (result1 || result2);
+	printf ("\nRunning LZFSE block type test...\n");
+	int result3 = test_lzfse_block_types ();
+
+	printf ("\nRunning LZFSE LZVN stream test...\n");
+	int result4 = test_lzfse_lzvn_stream ();
+
+	printf ("\nRunning LZFSE reset test...\n");
+	int result5 = test_lzfse_reset ();
+
+	return (result1 || result2 || result3 || result4 || result5);
 }
@@ -186,6 +186,263 @@ int test_lzma_large_data() {
 	return 0;
 }
 
+/* Stream written by xz's liblzma (preset 6, .lzma format) for ref_text():
+ * unknown size in the header and an end marker after the data */
+static const uint8_t lzma_ref_stream[] = {
+	0x5d, 0x00, 0x00, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x32, 0x9b, 0x8a, 0xef, 0xf2, 0x1b, 0x4e, 0xd0, 0x53, 0x23,
+	0x7b, 0x70, 0xe6, 0x57, 0x90, 0xfb, 0x44, 0x77, 0x23, 0x44, 0x49, 0xbf,
+	0x57, 0x22, 0x1d, 0x7b, 0x3b, 0xfa, 0x3a, 0xf6, 0xfd, 0xbd, 0x02, 0xbe,
+	0xb1, 0x6e, 0xbc, 0xdf, 0x79, 0xc9, 0x6b, 0x5a, 0xe9, 0xaf, 0x49, 0x10,
+	0x46, 0xaa, 0xae, 0xcc, 0x5a, 0xb2, 0xf8, 0x06, 0xc9, 0x37, 0x37, 0x7a,
+	0xd9, 0x58, 0xaa, 0x0d, 0xc1, 0x83, 0x95, 0xf8, 0x36, 0x2f, 0xfb, 0x90,
+	0xbe, 0xda, 0x22, 0xdb, 0x79, 0x7b, 0x6b, 0x77, 0xa2, 0xe3, 0x99, 0x01,
+	0x08, 0xfd, 0x84, 0xc0, 0xac, 0xd3, 0x7c, 0xf8, 0x48, 0xf1, 0xdd, 0x3e,
+	0x18, 0xb1, 0xa7, 0xd4, 0x7e, 0xe5, 0x33, 0x13, 0x03, 0xd6, 0x4c, 0xfc,
+	0xfa, 0x01, 0x32, 0x57, 0x0c, 0x73, 0x68, 0x14, 0x94, 0x91, 0xf7, 0x1f,
+	0x72, 0xd4, 0xaa, 0xde, 0xb2, 0xff, 0x06, 0x7e, 0x43, 0xda, 0x45, 0xf3,
+	0xa6, 0x0f, 0x44, 0x48, 0xde, 0xfe, 0xa3, 0x32, 0x01, 0xf4, 0x31, 0x9f,
+	0x7f, 0x13, 0x2a, 0x36, 0x5a, 0x43, 0xd5, 0x10, 0x0e, 0x19, 0x20, 0x7d,
+	0xc2, 0xbe, 0xa5, 0x2f, 0x21, 0xb2, 0xd7, 0x39, 0xe0, 0x3f, 0x2d, 0xef,
+	0x51, 0x82, 0x2c, 0x7a, 0x79, 0x72, 0xdb, 0x7b, 0x7d, 0x56, 0x70, 0xa3,
+	0x89, 0x91, 0xca, 0x51, 0xb8, 0xd0, 0x96, 0x98, 0xa6, 0x91, 0x5b, 0x85,
+	0x63, 0x75, 0xa8, 0x16, 0x67, 0xa6, 0x85, 0x79, 0x09, 0xa6, 0x54, 0xf6,
+	0x0d, 0xac, 0x59, 0x60, 0x4f, 0x47, 0xbb, 0x5f, 0xc4, 0xda, 0x85, 0xc3,
+	0x91, 0xbf, 0x1c, 0x3c, 0xf7, 0xd8, 0x55, 0x16, 0xcf, 0x2c, 0x05, 0x83,
+	0x66, 0x09, 0xc4, 0x3a, 0x75, 0x3e, 0x09, 0x70, 0x7e, 0x0c, 0x64, 0xcc,
+	0xd3, 0x94, 0xf6, 0xac, 0xea, 0x2f, 0x2b, 0x0d, 0x3f, 0x79, 0x65, 0x17,
+	0xe4, 0x4d, 0x08, 0x78, 0x66, 0xe6, 0x5f, 0x92, 0xee, 0x17, 0x9d, 0xdd,
+	0x53, 0xf6, 0x51, 0x84, 0x97, 0x83, 0x07, 0x9a, 0x71, 0x87, 0xde, 0x05,
+	0x47, 0x67, 0x84, 0xf2, 0xdd, 0x5a, 0x7d, 0x9f, 0x2a, 0x91, 0x67, 0x8f,
+	0x33, 0x34, 0x48, 0xaf, 0x02, 0x5c, 0xdf, 0x2d, 0xbc, 0xb9, 0x9f, 0x29,
+	0x0e, 0xfa, 0x66, 0xbf, 0x1e, 0x34, 0x41, 0x6a, 0xf7, 0x34, 0x51, 0x65,
+	0x65, 0x5f, 0x50, 0xb3, 0xdd, 0xcf, 0xbd, 0x33, 0xe4, 0xd3, 0x4a, 0x84,
+	0xe5, 0x9d, 0x2b, 0xa2, 0x23, 0x9e, 0x4d, 0x1f, 0x56, 0x59, 0xf4, 0xd6,
+	0x84, 0x8a, 0x84, 0x6e, 0xf2, 0xb2, 0x29, 0xf2, 0x54, 0x12, 0x57, 0xe7,
+	0xf1, 0xea, 0xc3, 0x1e, 0x11, 0x6e, 0xf7, 0xc0, 0x06, 0x9d, 0x37, 0x18,
+	0x44, 0x0b, 0x28, 0x3b, 0xda, 0xa2, 0x41, 0xaf, 0x56, 0x5c, 0x39, 0x04,
+	0x1a, 0x7e, 0x07, 0xcf, 0xda, 0xd5, 0xf1, 0x76, 0x90, 0xf7, 0x7b, 0x27,
+	0x38, 0xd3, 0x06, 0xd3, 0x53, 0xd6, 0x5b, 0xe5, 0x54, 0xd3, 0x6e, 0x5a,
+	0xed, 0x52, 0x00, 0xe4, 0x34, 0xd8, 0x6f, 0x87, 0x15, 0x47, 0x3c, 0xb5,
+	0x45, 0x78, 0xb0, 0xde, 0x0c, 0xc9, 0xb3, 0xb6, 0xdd, 0x0c, 0x7b, 0xd8,
+	0x0d, 0xdf, 0xb7, 0x60, 0x8d, 0xfe, 0xf6, 0xe7, 0x54, 0xf2,
+};
+
+static size_t ref_text(char *dst) {
+	size_t n = 0;
+	for (int i = 0; i < 120; i++) {
+		n += (size_t)sprintf (dst + n, "entry %d of the reference stream, value %d\n", i, i * i % 97);
+	}
+	return n;
+}
+
+/* Decode src in pieces of in_step input and out_step output bytes */
+static int lzma_decode_pieces(const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t in_step, size_t out_step, size_t *out_len) {
+	z_stream d_strm = { 0 };
+	if (lzmaDecompressInit (&d_strm) != Z_OK) {
+		return Z_MEM_ERROR;
+	}
+	size_t in_pos = 0;
+	int ret = Z_OK;
+	while (ret == Z_OK || ret == Z_BUF_ERROR) {
+		size_t in_n = n - in_pos < in_step? n - in_pos: in_step;
+		size_t out_n = cap - d_strm.total_out < out_step? cap - d_strm.total_out: out_step;
+		d_strm.next_in = src + in_pos;
+		d_strm.avail_in = (uInt)in_n;
+		d_strm.next_out = dst + d_strm.total_out;
+		d_strm.avail_out = (uInt)out_n;
+		ret = lzmaDecompress (&d_strm, in_pos + in_n == n? Z_FINISH: Z_NO_FLUSH);
+		in_pos += in_n - d_strm.avail_in;
+		if (ret == Z_BUF_ERROR && in_pos == n && out_n > 0) {
+			break; /* no progress with all input given */
+		}
+	}
+	*out_len = d_strm.total_out;
+	lzmaDecompressEnd (&d_strm);
+	return ret;
+}
+
+/* Every level, plus an explicit dictionary size, must round trip through
+ * the header the decoder reads, whole and in small pieces */
+int test_lzma_levels() {
+	size_t test_size = 300000;
+	uint8_t *data = malloc (test_size);
+	uint8_t *compressed = malloc (test_size + test_size / 8 + 64);
+	uint8_t *decompressed = malloc (test_size);
+	if (!data || !compressed || !decompressed) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (compressed);
+		free (decompressed);
+		return 1;
+	}
+	/* text with repeats near and far, noise and a long run */
+	uint32_t seed = 1;
+	size_t n = 0;
+	while (n < 200000) {
+		n += (size_t)sprintf ((char *)data + n, "line %u: the value is %u\n", (unsigned)(n % 1000), (unsigned)(n * 7 % 13));
+	}
+	for (; n < 260000; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	memset (data + n, 'z', 20000);
+	memcpy (data + n + 20000, data + 1000, test_size - n - 20000);
+
+	int rc = 0;
+	for (int level = 1; level <= 10 && !rc; level++) {
+		int window_bits = level == 10? 12: 0;
+		z_stream c_strm = { 0 };
+		if (lzmaCompressInit2 (&c_strm, level == 10? 6: level, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+			printf ("lzmaCompressInit2 failed\n");
+			rc = 1;
+			break;
+		}
+		c_strm.next_in = data;
+		c_strm.avail_in = (uInt)test_size;
+		c_strm.next_out = compressed;
+		c_strm.avail_out = (uInt)(test_size + test_size / 8 + 64);
+		int ret = lzmaCompress (&c_strm, Z_FINISH);
+		size_t clen = c_strm.total_out;
+		lzmaEnd (&c_strm);
+		uint32_t dict = compressed[1] | (compressed[2] << 8) | (compressed[3] << 16) | ((uint32_t)compressed[4] << 24);
+		uint32_t want_dict = level == 10? 4096: 1u << 19; /* reduced to fit the input */
+		if (ret != Z_STREAM_END || compressed[0] != 0x5D || dict != want_dict || compressed[5] != (uint8_t)test_size || compressed[7] != (uint8_t)(test_size >> 16)) {
+			printf ("level %d: bad stream (ret %d, dict %u)\n", level, ret, (unsigned)dict);
+			rc = 1;
+			break;
+		}
+		size_t got = 0;
+		int r1 = lzma_decode_pieces (compressed, clen, decompressed, test_size, clen, test_size, &got);
+		int ok1 = r1 == Z_STREAM_END && got == test_size && memcmp (decompressed, data, test_size) == 0;
+		memset (decompressed, 0, test_size);
+		int r2 = lzma_decode_pieces (compressed, clen, decompressed, test_size, 7, 1000, &got);
+		int ok2 = r2 == Z_STREAM_END && got == test_size && memcmp (decompressed, data, test_size) == 0;
+		printf ("Level %d%s: %zu -> %zu bytes\n", level == 10? 6: level, level == 10? " (4 KiB dictionary)": "", test_size, clen);
+		if (!ok1 || !ok2) {
+			printf ("ERROR: level %d round trip failed (%d, %d)\n", level, r1, r2);
+			rc = 1;
+		}
+	}
+	if (!rc) {
+		printf ("TEST PASSED: LZMA levels and dictionary sizes round trip.\n");
+	}
+	free (data);
+	free (compressed);
+	free (decompressed);
+	return rc;
+}
+
+/* A stream from another encoder, whole and in pieces; cut short, it must
+ * be reported as corrupt rather than as a shorter entry */
+int test_lzma_reference_stream() {
+	char want[8192];
+	uint8_t out[8192];
+	size_t wn = ref_text (want);
+	size_t got = 0;
+	int r1 = lzma_decode_pieces (lzma_ref_stream, sizeof (lzma_ref_stream), out, sizeof (out), sizeof (lzma_ref_stream), sizeof (out), &got);
+	int ok1 = r1 == Z_STREAM_END && got == wn && memcmp (out, want, wn) == 0;
+	int r2 = lzma_decode_pieces (lzma_ref_stream, sizeof (lzma_ref_stream), out, sizeof (out), 3, 50, &got);
+	int ok2 = r2 == Z_STREAM_END && got == wn && memcmp (out, want, wn) == 0;
+	int r3 = lzma_decode_pieces (lzma_ref_stream, sizeof (lzma_ref_stream) - 20, out, sizeof (out), 64, sizeof (out), &got);
+	if (!ok1 || !ok2 || r3 != Z_DATA_ERROR) {
+		printf ("ERROR: reference stream: %d %d %d\n", r1, r2, r3);
+		return 1;
+	}
+	printf ("TEST PASSED: LZMA reference stream decodes whole and in pieces.\n");
+	return 0;
+}
+
+/* Run one whole stream through run() with Z_FINISH into dst */
+static int lzma_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *len) {
+	strm->next_in = (uint8_t *)src;
+	strm->avail_in = (uInt)n;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)cap;
+	int ret;
+	do {
+		ret = run (strm, Z_FINISH);
+	} while (ret == Z_OK && strm->avail_out > 0);
+	*len = strm->total_out;
+	return ret == Z_STREAM_END? 0: -1;
+}
+
+/* A stream reset after a large entry must encode a small one exactly
+ * like a fresh stream, and a reset decoder must read both back */
+int test_lzma_reset() {
+	size_t big = 200000;
+	size_t small = 3000;
+	size_t cap = big + big / 8 + 1024;
+	uint8_t *data = malloc (big);
+	uint8_t *c1 = malloc (cap);
+	uint8_t *c2 = malloc (cap);
+	uint8_t *ref = malloc (cap);
+	uint8_t *out = malloc (big);
+	if (!data || !c1 || !c2 || !ref || !out) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (c1);
+		free (c2);
+		free (ref);
+		free (out);
+		return 1;
+	}
+	uint32_t seed = 7;
+	size_t n = 0;
+	while (n + 64 < big) {
+		n += (size_t)sprintf ((char *)data + n, "entry %u holds %u\n", (unsigned)(n % 977), (unsigned)(n * 13 % 31));
+	}
+	for (; n < big; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	const uint8_t *second = data + 10000;
+
+	int rc = 0;
+	size_t ref_len = 0;
+	size_t len1 = 0;
+	size_t len2 = 0;
+	z_stream strm = { 0 };
+	if (lzmaCompressInit2 (&strm, 6, 0, 8, Z_DEFAULT_STRATEGY) != Z_OK || lzma_pass (&strm, lzmaCompress, second, small, ref, cap, &ref_len) != 0) {
+		printf ("fresh stream failed\n");
+		rc = 1;
+	}
+	lzmaEnd (&strm);
+
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (lzmaCompressInit2 (&strm, 6, 0, 8, Z_DEFAULT_STRATEGY) != Z_OK || lzma_pass (&strm, lzmaCompress, data, big, c1, cap, &len1) != 0 ||
+		lzmaReset (&strm) != Z_OK || lzma_pass (&strm, lzmaCompress, second, small, c2, cap, &len2) != 0)) {
+		printf ("reset stream failed\n");
+		rc = 1;
+	}
+	lzmaEnd (&strm);
+	if (!rc && (len2 != ref_len || memcmp (c2, ref, ref_len) != 0)) {
+		printf ("ERROR: reset stream output differs from a fresh one (%zu vs %zu bytes)\n", len2, ref_len);
+		rc = 1;
+	}
+
+	size_t got = 0;
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (lzmaDecompressInit (&strm) != Z_OK || lzma_pass (&strm, lzmaDecompress, c1, len1, out, big, &got) != 0 || got != big || memcmp (out, data, big) != 0)) {
+		printf ("ERROR: first stream does not decode\n");
+		rc = 1;
+	}
+	if (!rc && (lzmaDecompressReset (&strm) != Z_OK || lzma_pass (&strm, lzmaDecompress, c2, len2, out, big, &got) != 0 || got != small || memcmp (out, second, small) != 0)) {
+		printf ("ERROR: reset decoder failed on the second stream\n");
+		rc = 1;
+	}
+	lzmaDecompressEnd (&strm);
+	if (!rc) {
+		printf ("TEST PASSED: %zu and %zu bytes through reset streams (%zu, %zu bytes).\n", big, small, len1, len2);
+	}
+	free (data);
+	free (c1);
+	free (c2);
+	free (ref);
+	free (out);
+	return rc;
+}
+
 int main(int argc, char *argv[]) {
 	(void)argc;
 	(void)argv;
@@ -196,5 +453,14 @@ int main(int argc, char *argv[]) {
 	printf ("\nRunning LZMA large data test...\n");
 	int result2 = test_lzma_large_data ();
 
-	return (result1 || result2);
+	printf ("\nRunning LZMA level test...\n");
+	int result3 = test_lzma_levels ();
+
+	printf ("\nRunning LZMA reference stream test...\n");
+	int result4 = test_lzma_reference_stream ();
+
+	printf ("\nRunning LZMA reset test...\n");
+	int result5 = test_lzma_reset ();
+
+	return (result1 || result2 || result3 || result4 || result5);
 }
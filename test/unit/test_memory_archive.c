@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define BIG_LEN (2u * 1024u * 1024u + 555u)
+
+/* Files under /tmp named like the old temporary copies */
+static int count_tmp(void) {
+	DIR *d = opendir ("/tmp");
+	int n = 0;
+	struct dirent *de;
+	while (d && (de = readdir (d)) != NULL) {
+		n += strncmp (de->d_name, "otezip_", 7) == 0;
+	}
+	if (d) {
+		closedir (d);
+	}
+	return n;
+}
+
+/* The three entries written first, and what they hold */
+static int check_archive(zip_t *za, const uint8_t *big) {
+	return !za || check_entry (za, 0, "hello memory", 12) || check_entry (za, 1, big, BIG_LEN) || check_entry (za, 2, big + 1000, 5000);
+}
+
+int main(void) {
+	uint8_t *big = (uint8_t *)malloc (BIG_LEN);
+	fill_text (big, BIG_LEN, 2463534242u);
+	otezip_verify_crc = 1;
+	int tmp_before = count_tmp ();
+
+	/* written into a growable buffer */
+	int err = 0;
+	int rc = 0;
+	zip_t *za = otezip_open_memory (NULL, 0, ZIP_CREATE, &err);
+	if (za) {
+		za->default_method = ZIP_CM_STORE;
+	}
+	if (!za || zip_file_add (za, "hello.txt", zip_source_buffer (za, "hello memory", 12, 0), 0) != 0) {
+		rc = 1;
+	}
+	if (za) {
+		za->default_method = ZIP_CM_DEFLATE;
+	}
+	if (!za || zip_file_add (za, "big.txt", zip_source_buffer (za, big, BIG_LEN, 0), 0) != 1 ||
+		zip_file_add (za, "part.txt", zip_source_buffer (za, big + 1000, 5000, 0), 0) != 2) {
+		rc = 1;
+	}
+	void *buf = NULL;
+	zip_uint64_t len = 0;
+	if (!za || rc || otezip_close_memory (za, &buf, &len) != 0 || len < 22 || len >= BIG_LEN) {
+		fprintf (stderr, "writing in memory failed (err %d, %llu bytes)\n", err, (unsigned long long)len);
+		return 1;
+	}
+
+	/* read in place, seeks included */
+	za = otezip_open_memory (buf, len, ZIP_RDONLY, &err);
+	zip_file_t *zf = za? zip_fopen_index (za, 1, 0): NULL;
+	uint8_t b[100];
+	if (check_archive (za, big) || !zf || zip_fseek (zf, 123456, SEEK_SET) != 0 || zip_fread (zf, b, sizeof (b)) != (zip_int64_t)sizeof (b) ||
+		memcmp (b, big + 123456, sizeof (b)) != 0) {
+		fprintf (stderr, "reading in place failed (err %d)\n", err);
+		rc = 1;
+	}
+	if (zf) {
+		zip_fclose (zf);
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* zip_open_from_source owns the source from here on */
+	uint8_t *copy = (uint8_t *)malloc ((size_t)len);
+	memcpy (copy, buf, (size_t)len);
+	za = zip_open_from_source (zip_source_buffer_create (copy, len, 1, NULL), ZIP_RDONLY, NULL);
+	if (check_archive (za, big)) {
+		fprintf (stderr, "zip_open_from_source failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* appended to and compacted on a copy; the input stays as it was */
+	za = rc? NULL: otezip_open_memory (buf, len, ZIP_CREATE, &err);
+	if (za) {
+		za->default_method = ZIP_CM_DEFLATE;
+	}
+	if (!za || zip_file_add (za, "late.txt", zip_source_buffer (za, big + 7, 300, 0), 0) != 3 ||
+		zip_file_replace (za, 0, zip_source_buffer (za, "hello again", 11, 0), 0) != 0 || otezip_compact (za) != 0) {
+		rc = 1;
+	}
+	void *buf2 = NULL;
+	zip_uint64_t len2 = 0;
+	if (za && otezip_close_memory (za, &buf2, &len2) != 0) {
+		rc = 1;
+	}
+	za = rc? NULL: otezip_open_memory (buf, len, ZIP_RDONLY, &err);
+	if (check_archive (za, big) || zip_get_num_files (za) != 3) {
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+	za = rc? NULL: otezip_open_memory (buf2, len2, ZIP_RDONLY, &err);
+	if (!za || zip_get_num_files (za) != 4 || check_entry (za, 0, "hello again", 11) || check_entry (za, 1, big, BIG_LEN) ||
+		check_entry (za, 3, big + 7, 300)) {
+		fprintf (stderr, "appending in memory failed (err %d)\n", err);
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	/* refused: garbage, an existing buffer with ZIP_EXCL; a source that
+	 * could not be opened stays the caller's */
+	zip_error_t ze = { 0, 0 };
+	zip_source_t *src = zip_source_buffer_create ("PK", 2, 0, NULL);
+	if (otezip_open_memory ("not a zip archive at all", 24, ZIP_RDONLY, &err) || err == 0 ||
+		otezip_open_memory (buf, len, ZIP_CREATE | ZIP_EXCL, &err) || err != ZIP_ER_EXISTS ||
+		zip_open_from_source (src, ZIP_RDONLY, &ze) || ze.zip_err == 0) {
+		fprintf (stderr, "bad buffers were accepted\n");
+		rc = 1;
+	}
+	zip_source_free (src);
+	if (count_tmp () != tmp_before) {
+		fprintf (stderr, "memory archives left files in /tmp\n");
+		rc = 1;
+	}
+
+	/* streamed sources are read into memory first */
+	char path[] = "/tmp/otezip-mem-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0 || write (fd, buf, (size_t)len) != (ssize_t)len) {
+		rc = 1;
+	}
+	if (fd >= 0) {
+		close (fd);
+	}
+	za = rc? NULL: zip_open_from_source (zip_source_file (NULL, path, 0, -1), ZIP_RDONLY, NULL);
+	if (check_archive (za, big)) {
+		fprintf (stderr, "zip_open_from_source of a file failed\n");
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (path);
+	free (buf);
+	free (buf2);
+	free (big);
+	if (!rc) {
+		printf ("memory archive ok\n");
+	}
+	return rc;
+}
@@ -85,8 +85,101 @@ int test_custom_compress_decompress() {
 	return 0;
 }
 
+/* Run one whole stream through run() with Z_FINISH into dst */
+static int deflate_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *len) {
+	strm->next_in = (uint8_t *)src;
+	strm->avail_in = (uInt)n;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)cap;
+	int ret;
+	do {
+		ret = run (strm, Z_FINISH);
+	} while (ret == Z_OK && strm->avail_out > 0);
+	*len = strm->total_out;
+	return ret == Z_STREAM_END? 0: -1;
+}
+
+/* A stream reset after a large entry must encode a small one exactly
+ * like a fresh stream, and a reset decoder must read both back */
+int test_deflate_reset() {
+	size_t big = 200000;
+	size_t small = 3000;
+	size_t cap = big + big / 8 + 1024;
+	uint8_t *data = malloc (big);
+	uint8_t *c1 = malloc (cap);
+	uint8_t *c2 = malloc (cap);
+	uint8_t *ref = malloc (cap);
+	uint8_t *out = malloc (big);
+	if (!data || !c1 || !c2 || !ref || !out) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (c1);
+		free (c2);
+		free (ref);
+		free (out);
+		return 1;
+	}
+	uint32_t seed = 7;
+	size_t n = 0;
+	while (n + 64 < big) {
+		n += (size_t)sprintf ((char *)data + n, "entry %u holds %u\n", (unsigned)(n % 977), (unsigned)(n * 13 % 31));
+	}
+	for (; n < big; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	const uint8_t *second = data + 10000;
+
+	int rc = 0;
+	size_t ref_len = 0;
+	size_t len1 = 0;
+	size_t len2 = 0;
+	z_stream strm = { 0 };
+	if (deflateInit2 (&strm, 6, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK || deflate_pass (&strm, deflate, second, small, ref, cap, &ref_len) != 0) {
+		printf ("fresh stream failed\n");
+		rc = 1;
+	}
+	deflateEnd (&strm);
+
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (deflateInit2 (&strm, 6, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK || deflate_pass (&strm, deflate, data, big, c1, cap, &len1) != 0 ||
+		deflateReset (&strm) != Z_OK || deflate_pass (&strm, deflate, second, small, c2, cap, &len2) != 0)) {
+		printf ("reset stream failed\n");
+		rc = 1;
+	}
+	deflateEnd (&strm);
+	if (!rc && (len2 != ref_len || memcmp (c2, ref, ref_len) != 0)) {
+		printf ("ERROR: reset stream output differs from a fresh one (%zu vs %zu bytes)\n", len2, ref_len);
+		rc = 1;
+	}
+
+	size_t got = 0;
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (inflateInit2 (&strm, -MAX_WBITS) != Z_OK || deflate_pass (&strm, inflate, c1, len1, out, big, &got) != 0 || got != big || memcmp (out, data, big) != 0)) {
+		printf ("ERROR: first stream does not decode\n");
+		rc = 1;
+	}
+	if (!rc && (inflateReset (&strm) != Z_OK || deflate_pass (&strm, inflate, c2, len2, out, big, &got) != 0 || got != small || memcmp (out, second, small) != 0)) {
+		printf ("ERROR: reset decoder failed on the second stream\n");
+		rc = 1;
+	}
+	inflateEnd (&strm);
+	if (!rc) {
+		printf ("TEST PASSED: %zu and %zu bytes through reset streams (%zu, %zu bytes).\n", big, small, len1, len2);
+	}
+	free (data);
+	free (c1);
+	free (c2);
+	free (ref);
+	free (out);
+	return rc;
+}
+
 int main(void) {
 	printf ("Running custom deflate compression test...\n");
 	int result = test_custom_compress_decompress ();
+
+	printf ("\nRunning custom deflate reset test...\n");
+	result |= test_deflate_reset ();
 	return result;
 }
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+
+/* Check zip_name_locate against a plain scan for every NOCASE/NODIR
+ * combination, while the archive is being written (lookups between adds
+ * keep the index growing) and after reopening it read-only. Duplicate
+ * names must resolve to their first entry. */
+
+enum { n_files = 3000 };
+
+static void entry_name(int k, char *buf, size_t n) {
+	static const char *dirs[] = { "", "assets/", "Assets/img/", "a/b/c/" };
+	/* every 7th name repeats an earlier one */
+	int id = (k % 7 == 6)? k / 2: k;
+	snprintf (buf, n, "%s%s%d.%s", dirs[id % 4], (id % 3)? "File": "file", id % 1000, (id % 2)? "TXT": "txt");
+}
+
+static int fold(int c) {
+	return (c >= 'A' && c <= 'Z')? c + 32: c;
+}
+
+static zip_int64_t reference(zip_t *za, const char *fname, zip_flags_t flags) {
+	for (zip_uint64_t i = 0; i < za->n_entries; i++) {
+		const char *name = za->entries[i].name;
+		if (flags & ZIP_FL_NODIR) {
+			const char *slash = strrchr (name, '/');
+			name = slash? slash + 1: name;
+		}
+		const char *a = name;
+		const char *b = fname;
+		while (*a && *b && ((flags & ZIP_FL_NOCASE)? fold (*a) == fold (*b): *a == *b)) {
+			a++;
+			b++;
+		}
+		if (!*a && !*b) {
+			return (zip_int64_t)i;
+		}
+	}
+	return -1;
+}
+
+static int check_all(zip_t *za, int upto) {
+	static const char *extra[] = { "missing.txt", "", "assets/", "FILE1.TXT", "file1.txt", "ASSETS/FILE1.TXT" };
+	char name[64];
+	for (int k = -6; k < upto; k++) {
+		const char *q = name;
+		if (k < 0) {
+			q = extra[k + 6];
+		} else {
+			entry_name (k, name, sizeof (name));
+		}
+		for (zip_flags_t f = 0; f <= (zip_flags_t) (ZIP_FL_NOCASE | ZIP_FL_NODIR); f++) {
+			zip_int64_t got = zip_name_locate (za, q, f);
+			zip_int64_t want = reference (za, q, f);
+			if (got != want) {
+				fprintf (stderr, "lookup '%s' flags %d: got %lld, want %lld\n", q, f, (long long)got, (long long)want);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+int main(void) {
+	char path[] = "/tmp/otezip-names-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (!za) {
+		fprintf (stderr, "zip_open(create) failed: %d\n", err);
+		return 1;
+	}
+	za->default_method = ZIP_CM_STORE;
+	for (int k = 0; k < n_files && !rc; k++) {
+		char name[64];
+		entry_name (k, name, sizeof (name));
+		zip_source_t *src = zip_source_buffer (za, "x", 1, 0);
+		if (!src || zip_file_add (za, name, src, 0) != k) {
+			fprintf (stderr, "zip_file_add failed for %s\n", name);
+			rc = 1;
+		}
+		if (k == 10 || k == 700) {
+			rc |= check_all (za, k + 1);
+		}
+	}
+	rc |= check_all (za, n_files);
+	if (zip_close (za) != 0) {
+		rc = 1;
+	}
+
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		rc |= check_all (za, n_files);
+		zip_stat_t st;
+		if (zip_stat (za, "ASSETS/FILE1.TXT", ZIP_FL_NOCASE, &st) != 0 || st.index != (zip_uint64_t)zip_name_locate (za, "assets/File1.TXT", 0)) {
+			fprintf (stderr, "zip_stat did not honor ZIP_FL_NOCASE\n");
+			rc = 1;
+		}
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	unlink (path);
+	if (rc) {
+		return 1;
+	}
+	puts ("TEST PASSED: zip_name_locate matches a linear scan for all flags.");
+	return 0;
+}
@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+#define CHUNK (1024u * 1024u)
+
+/* Buffered entry: split in memory. Streamed one: read in chunks. */
+#define BUFFER_LEN (3u * CHUNK + 12345u)
+#define STREAM_LEN (5u * CHUNK + 777u)
+
+/* Callback source of exactly two chunks: the stream ends on a chunk edge */
+struct gen {
+	const uint8_t *data;
+	size_t len;
+	size_t pos;
+};
+
+static zip_int64_t gen_cb(void *userdata, void *data, zip_uint64_t len, zip_source_cmd_t cmd) {
+	struct gen *g = (struct gen *)userdata;
+	switch (cmd) {
+	case ZIP_SOURCE_OPEN:
+		g->pos = 0;
+		return 0;
+	case ZIP_SOURCE_READ: {
+		/* odd read sizes, so chunks are filled from several reads */
+		size_t n = g->len - g->pos;
+		if (n > len) {
+			n = (size_t)len;
+		}
+		if (n > 100000) {
+			n = 100000;
+		}
+		memcpy (data, g->data + g->pos, n);
+		g->pos += n;
+		return (zip_int64_t)n;
+	}
+	case ZIP_SOURCE_CLOSE:
+	case ZIP_SOURCE_FREE:
+		return 0;
+	default:
+		return -1;
+	}
+}
+
+static int make_temp(char *path, const uint8_t *data, size_t len) {
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return -1;
+	}
+	int rc = (len && write (fd, data, len) != (ssize_t)len)? -1: 0;
+	close (fd);
+	return rc;
+}
+
+/* Write the three entries with n_threads deflate workers; their
+ * compressed sizes go to sizes[] */
+static int write_archive(const char *path, int n_threads, const uint8_t *buf, const char *file, struct gen *g, zip_uint64_t *sizes) {
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (!za || otezip_set_deflate_threads (za, n_threads) != 0) {
+		fprintf (stderr, "zip_open failed (err %d)\n", err);
+		return 1;
+	}
+	za->default_method = ZIP_CM_DEFLATE;
+	if (zip_file_add (za, "buffer.txt", zip_source_buffer (za, buf, BUFFER_LEN, 0), 0) != 0 ||
+		zip_file_add (za, "file.txt", zip_source_file (za, file, 0, -1), 0) != 1 ||
+		zip_file_add (za, "edge.txt", zip_source_function (za, gen_cb, g), 0) != 2) {
+		fprintf (stderr, "adding with %d threads failed\n", n_threads);
+		rc = 1;
+	}
+	for (int i = 0; i < 3 && !rc; i++) {
+		if (za->entries[i].method != ZIP_CM_DEFLATE) {
+			fprintf (stderr, "entry %d: method %u\n", i, za->entries[i].method);
+			rc = 1;
+		}
+		sizes[i] = za->entries[i].comp_size;
+	}
+	if (zip_close (za) != 0) {
+		rc = 1;
+	}
+	return rc;
+}
+
+int main(void) {
+	uint8_t *buf = (uint8_t *)malloc (BUFFER_LEN);
+	uint8_t *big = (uint8_t *)malloc (STREAM_LEN);
+	uint8_t *edge = (uint8_t *)malloc (2 * CHUNK);
+	fill_text (buf, BUFFER_LEN, 2463534242u);
+	fill_text (big, STREAM_LEN, 88172645u);
+	fill_text (edge, 2 * CHUNK, 123456789u);
+	char file[] = "/tmp/otezip-pdef-src-XXXXXX";
+	char path[] = "/tmp/otezip-pdef-XXXXXX";
+	char gz[] = "/tmp/otezip-pdef-gz-XXXXXX";
+	if (make_temp (file, big, STREAM_LEN) != 0 || make_temp (path, NULL, 0) != 0 || make_temp (gz, NULL, 0) != 0) {
+		return 1;
+	}
+	otezip_verify_crc = 1;
+
+	/* the chunked stream decodes to the input and costs little ratio */
+	const uint8_t *want[3] = { buf, big, edge };
+	const size_t lens[3] = { BUFFER_LEN, STREAM_LEN, 2 * CHUNK };
+	zip_uint64_t serial[3];
+	zip_uint64_t chunked[3];
+	struct gen g = { edge, 2 * CHUNK, 0 };
+	int rc = write_archive (path, 1, buf, file, &g, serial);
+	rc |= rc? 0: write_archive (path, 4, buf, file, &g, chunked);
+	for (int i = 0; i < 3 && !rc; i++) {
+		if (chunked[i] > serial[i] + serial[i] / 100) {
+			fprintf (stderr, "entry %d: %llu bytes chunked, %llu serial\n", i, (unsigned long long)chunked[i], (unsigned long long)serial[i]);
+			rc = 1;
+		}
+	}
+	int err = 0;
+	zip_t *za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	for (int i = 0; za && i < 3; i++) {
+		if (check_entry (za, (zip_uint64_t)i, want[i], lens[i]) != 0) {
+			fprintf (stderr, "entry %d: payload mismatch\n", i);
+			rc = 1;
+		}
+	}
+	if (za) {
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+
+	/* gzip: header, the chunked stream, then CRC and length */
+	FILE *in = fopen (file, "rb");
+	FILE *out = fopen (gz, "wb");
+	zip_uint64_t in_len = 0;
+	zip_uint64_t out_len = 0;
+	if (!in || !out || otezip_gzip_file (in, out, -1, 3, &in_len, &out_len) != 0 || in_len != STREAM_LEN) {
+		fprintf (stderr, "otezip_gzip_file failed\n");
+		rc = 1;
+	}
+	if (in) {
+		fclose (in);
+	}
+	if (out) {
+		fclose (out);
+	}
+	uint8_t tail[8] = { 0 };
+	out = rc? NULL: fopen (gz, "rb");
+	if (out && (fseek (out, -8, SEEK_END) != 0 || fread (tail, 1, 8, out) != 8 || ftell (out) != (long)out_len)) {
+		rc = 1;
+	}
+	if (out) {
+		fclose (out);
+	}
+	uint32_t crc = (uint32_t)tail[0] | (uint32_t)tail[1] << 8 | (uint32_t)tail[2] << 16 | (uint32_t)tail[3] << 24;
+	uint32_t isize = (uint32_t)tail[4] | (uint32_t)tail[5] << 8 | (uint32_t)tail[6] << 16 | (uint32_t)tail[7] << 24;
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	zip_stat_t st;
+	zip_stat_init (&st);
+	if (za && (zip_stat_index (za, 1, 0, &st) != 0 || crc != st.crc || isize != STREAM_LEN)) {
+		fprintf (stderr, "gzip trailer: crc %08x, entry %08x, size %u\n", crc, st.crc, isize);
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+
+	unlink (file);
+	unlink (path);
+	unlink (gz);
+	free (buf);
+	free (big);
+	free (edge);
+	if (!rc) {
+		printf ("parallel deflate ok\n");
+	}
+	return rc;
+}
@@ -5,6 +5,64 @@
 #include <unistd.h>
 
 #include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+/* Set on a queued entry, LZMA with a 64 KiB dictionary applies to it and
+ * to the entries added after it */
+static int check_lzma_dict(void) {
+	enum { text_size = 200000 };
+	char path[] = "/tmp/otezip-lzma-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+	char *text = (char *)malloc (text_size);
+	if (!text) {
+		unlink (path);
+		return 1;
+	}
+	for (int i = 0; i < text_size; i++) {
+		text[i] = "abcdefghij\n"[(i * 7 + i / 1000) % 11];
+	}
+
+	int err = -1;
+	int rc = 1;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	zip_int64_t idx = za? otezip_batch_add (za, "queued.txt", zip_source_buffer (za, text, text_size, 0)): -1;
+	if (idx == 0 && zip_set_file_compression (za, (zip_uint64_t)idx, OTEZIP_METHOD_LZMA, 9 | OTEZIP_LZMA_DICT (16)) == 0 && zip_file_add (za, "next.txt", zip_source_buffer (za, text, 5000, 0), 0) == 1) {
+		rc = 0;
+	} else {
+		fprintf (stderr, "batch add with zip_set_file_compression failed\n");
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		rc |= check_method (za, 0, OTEZIP_METHOD_LZMA) || check_entry (za, 0, text, text_size);
+		rc |= check_method (za, 1, OTEZIP_METHOD_LZMA) || check_entry (za, 1, text, 5000);
+		/* the dictionary size is in the LZMA header after the local header */
+		uint8_t hdr[5] = { 0 };
+		FILE *fp = fopen (path, "rb");
+		if (!fp || fseek (fp, (long)za->entries[0].local_hdr_ofs + 30 + 10, SEEK_SET) != 0 || fread (hdr, 1, 5, fp) != 5 || hdr[0] != 0x5D || (hdr[1] | (hdr[2] << 8) | (hdr[3] << 16)) != 65536) {
+			fprintf (stderr, "LZMA header does not carry the 64 KiB dictionary\n");
+			rc = 1;
+		}
+		if (fp) {
+			fclose (fp);
+		}
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	free (text);
+	unlink (path);
+	return rc;
+}
 
 int main(void) {
 	enum { payload_size = 4096 };
@@ -123,6 +181,9 @@ int main(void) {
 	zip_fclose (zf);
 	zip_close (za);
 	unlink (path);
+	if (check_lzma_dict () != 0) {
+		return 1;
+	}
 	puts ("TEST PASSED: compression can be set via public API after add.");
 	return 0;
 }
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../../src/include/otezip/zip.h"
+
+#define TEXT_LEN 200000u
+
+/* Events seen by the hook */
+struct log {
+	int count[3];
+	zip_uint64_t uncomp[3];
+	zip_uint64_t dir_size;
+	int bad;
+};
+
+static void hook(void *user, const otezip_event_t *ev) {
+	struct log *l = (struct log *)user;
+	if (ev->kind < OTEZIP_EVENT_COMPRESS || ev->kind > OTEZIP_EVENT_DIRECTORY) {
+		l->bad = 1;
+		return;
+	}
+	l->count[ev->kind]++;
+	l->uncomp[ev->kind] += ev->uncomp_size;
+	if (ev->kind == OTEZIP_EVENT_DIRECTORY) {
+		l->dir_size = ev->comp_size;
+		l->bad |= ev->name != NULL;
+	} else {
+		l->bad |= !ev->name;
+	}
+}
+
+static const otezip_method_stats_t *method_stats(const otezip_stats_t *st, zip_uint16_t method) {
+	for (size_t i = 0; i < st->n_methods; i++) {
+		if (st->methods[i].method == method) {
+			return &st->methods[i];
+		}
+	}
+	return NULL;
+}
+
+/* Read entry index through zip_fread in small pieces */
+static int read_entry(zip_t *za, zip_uint64_t index, zip_uint64_t want) {
+	uint8_t buf[1000];
+	zip_file_t *zf = zip_fopen_index (za, index, 0);
+	zip_uint64_t got = 0;
+	zip_int64_t n = 1;
+	while (zf && n > 0) {
+		n = zip_fread (zf, buf, sizeof (buf));
+		got += n > 0? (zip_uint64_t)n: 0;
+	}
+	if (zf) {
+		zip_fclose (zf);
+	}
+	return !zf || n < 0 || got != want;
+}
+
+int main(void) {
+	char path[] = "/tmp/otezip-stats-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+	uint8_t *text = (uint8_t *)malloc (TEXT_LEN);
+	for (size_t i = 0; i < TEXT_LEN; i++) {
+		text[i] = (uint8_t)("lorem ipsum dolor sit amet "[i % 27]);
+	}
+	static const char small[] = "stored as is";
+
+	/* writing: every entry and the directory are reported */
+	otezip_stats_t st;
+	struct log wlog;
+	memset (&wlog, 0, sizeof (wlog));
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (!za || otezip_set_stats (za, &st) != 0 || otezip_set_event_hook (za, hook, &wlog) != 0) {
+		fprintf (stderr, "attaching failed (err %d)\n", err);
+		return 1;
+	}
+	za->default_method = ZIP_CM_DEFLATE;
+	if (zip_file_add (za, "text.txt", zip_source_buffer (za, text, TEXT_LEN, 0), 0) != 0) {
+		rc = 1;
+	}
+	za->default_method = ZIP_CM_STORE;
+	if (otezip_batch_add (za, "small.txt", zip_source_buffer (za, small, strlen (small), 0)) != 1 || otezip_batch_commit (za, 2) != 0) {
+		rc = 1;
+	}
+	if (zip_close (za) != 0 || rc) {
+		fprintf (stderr, "writing failed\n");
+		return 1;
+	}
+	struct stat sb;
+	const otezip_method_stats_t *def = method_stats (&st, ZIP_CM_DEFLATE);
+	const otezip_method_stats_t *sto = method_stats (&st, ZIP_CM_STORE);
+	if (stat (path, &sb) != 0 || st.bytes_written != (zip_uint64_t)sb.st_size) {
+		fprintf (stderr, "wrote %llu bytes, file has %lld\n", (unsigned long long)st.bytes_written, (long long)sb.st_size);
+		rc = 1;
+	}
+	if (!def || def->compress_entries != 1 || def->compress_in != TEXT_LEN || def->compress_out >= TEXT_LEN || !sto || sto->compress_entries != 1) {
+		fprintf (stderr, "unexpected codec counters\n");
+		rc = 1;
+	}
+	if (st.crc_bytes != TEXT_LEN + strlen (small) || wlog.bad || wlog.count[OTEZIP_EVENT_COMPRESS] != 2 || wlog.count[OTEZIP_EVENT_DIRECTORY] != 1) {
+		fprintf (stderr, "unexpected write events\n");
+		rc = 1;
+	}
+	if (wlog.uncomp[OTEZIP_EVENT_COMPRESS] != TEXT_LEN + strlen (small) || wlog.dir_size == 0 || wlog.dir_size >= (zip_uint64_t)sb.st_size) {
+		fprintf (stderr, "unexpected event sizes\n");
+		rc = 1;
+	}
+
+	/* reading: buffered and streamed entries alike */
+	struct log rlog;
+	memset (&rlog, 0, sizeof (rlog));
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za && (otezip_set_stats (za, &st) != 0 || otezip_set_event_hook (za, hook, &rlog) != 0)) {
+		rc = 1;
+	}
+	if (za && (read_entry (za, 0, TEXT_LEN) || read_entry (za, 1, strlen (small)))) {
+		fprintf (stderr, "reading failed\n");
+		rc = 1;
+	}
+	/* detached: nothing more is counted */
+	if (za && (otezip_set_stats (za, NULL) != 0 || otezip_set_event_hook (za, NULL, NULL) != 0 || read_entry (za, 0, TEXT_LEN))) {
+		rc = 1;
+	}
+	if (za) {
+		zip_close (za);
+	}
+	def = method_stats (&st, ZIP_CM_DEFLATE);
+	if (!rc && (!def || def->decompress_entries != 1 || def->decompress_out != TEXT_LEN || def->compress_entries != 0)) {
+		fprintf (stderr, "unexpected decoder counters\n");
+		rc = 1;
+	}
+	if (!rc && (st.crc_bytes != TEXT_LEN + strlen (small) || st.bytes_written != 0 || rlog.bad || rlog.count[OTEZIP_EVENT_DECOMPRESS] != 2 || rlog.uncomp[OTEZIP_EVENT_DECOMPRESS] != TEXT_LEN + strlen (small))) {
+		fprintf (stderr, "unexpected read counters\n");
+		rc = 1;
+	}
+
+	unlink (path);
+	free (text);
+	if (!rc) {
+		printf ("stats ok\n");
+	}
+	return rc;
+}
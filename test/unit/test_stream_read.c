@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+
+/* Build an archive with an entry per method, then read them back through
+ * zip_fread in small, odd-sized chunks so the streaming decoders have to
+ * resume across input and output boundaries. */
+
+enum { payload_size = 300000 };
+
+static void fill_payload(uint8_t *p, size_t n) {
+	uint32_t x = 12345;
+	for (size_t i = 0; i < n; i++) {
+		x = x * 1103515245u + 12345u;
+		/* mostly repetitive text with some noise */
+		p[i] = (i % 97 < 80)? (uint8_t)('a' + (i % 26)): (uint8_t)(x >> 24);
+	}
+}
+
+static int add_entry(zip_t *za, const char *name, uint16_t method, const uint8_t *data, size_t n) {
+	uint8_t *copy = (uint8_t *)malloc (n? n: 1);
+	if (!copy) {
+		return -1;
+	}
+	memcpy (copy, data, n);
+	za->default_method = method;
+	zip_source_t *src = zip_source_buffer (za, copy, n, 1);
+	if (!src) {
+		free (copy);
+		return -1;
+	}
+	if (zip_file_add (za, name, src, 0) < 0) {
+		zip_source_free (src);
+		return -1;
+	}
+	return 0;
+}
+
+/* Read entry name back in uneven, growing chunks */
+static int check_chunked(zip_t *za, const char *name, const uint8_t *expected, size_t n) {
+	zip_int64_t idx = zip_name_locate (za, name, 0);
+	if (idx < 0) {
+		fprintf (stderr, "entry %s not found\n", name);
+		return 1;
+	}
+	zip_file_t *zf = zip_fopen_index (za, (zip_uint64_t)idx, 0);
+	if (!zf) {
+		fprintf (stderr, "zip_fopen_index failed for %s\n", name);
+		return 1;
+	}
+	uint8_t *out = (uint8_t *)malloc (n + 1);
+	if (!out) {
+		zip_fclose (zf);
+		return 1;
+	}
+	size_t got = 0;
+	size_t chunk = 1;
+	for (;;) {
+		zip_int64_t r = zip_fread (zf, out + got, (got + chunk > n + 1)? n + 1 - got: chunk);
+		if (r < 0) {
+			fprintf (stderr, "zip_fread failed for %s at %zu\n", name, got);
+			free (out);
+			zip_fclose (zf);
+			return 1;
+		}
+		if (r == 0) {
+			break;
+		}
+		got += (size_t)r;
+		chunk = chunk * 3 + 7;
+		if (chunk > 70000) {
+			chunk = 13;
+		}
+	}
+	zip_fclose (zf);
+	int rc = 0;
+	if (got != n || memcmp (out, expected, n) != 0) {
+		fprintf (stderr, "data mismatch for %s (%zu of %zu bytes)\n", name, got, n);
+		rc = 1;
+	}
+	free (out);
+	return rc;
+}
+
+/* Whether entry name is decoded on demand rather than read whole, and
+ * seeks both ways land on the right bytes */
+static int check_streams(zip_t *za, const char *name, const uint8_t *expected, int streamed) {
+	zip_int64_t idx = zip_name_locate (za, name, 0);
+	zip_file_t *zf = idx >= 0? zip_fopen_index (za, (zip_uint64_t)idx, 0): NULL;
+	uint8_t b[100];
+	/* a stored entry of a mapped archive is a view of the mapping */
+	int rc = !zf || (!zf->data || zf->borrowed) != streamed;
+	if (!rc && (zip_fseek (zf, 200000, SEEK_SET) != 0 || zip_fread (zf, b, sizeof (b)) != (zip_int64_t)sizeof (b) || memcmp (b, expected + 200000, sizeof (b)) != 0)) {
+		rc = 1;
+	}
+	if (!rc && (zip_fseek (zf, 10, SEEK_SET) != 0 || zip_fread (zf, b, sizeof (b)) != (zip_int64_t)sizeof (b) || memcmp (b, expected + 10, sizeof (b)) != 0)) {
+		rc = 1;
+	}
+	if (rc) {
+		fprintf (stderr, "%s: %s, or a seek went wrong\n", name, streamed? "not streamed": "streamed");
+	}
+	if (zf) {
+		zip_fclose (zf);
+	}
+	return rc;
+}
+
+/* Methods and whether zip_fread decodes them in pieces */
+static const struct {
+	const char *name;
+	uint16_t method;
+	int streamed;
+} methods[] = {
+	{ "stored.bin", ZIP_CM_STORE, 1 },
+	{ "deflated.bin", ZIP_CM_DEFLATE, 1 },
+#ifdef OTEZIP_ENABLE_ZSTD
+	{ "zstd.bin", OTEZIP_METHOD_ZSTD, 1 },
+#endif
+#ifdef OTEZIP_ENABLE_LZMA
+	{ "lzma.bin", OTEZIP_METHOD_LZMA, 1 },
+#endif
+	/* these decoders need the whole stream */
+#ifdef OTEZIP_ENABLE_BROTLI
+	{ "brotli.bin", OTEZIP_METHOD_BROTLI, 0 },
+#endif
+#ifdef OTEZIP_ENABLE_LZFSE
+	{ "lzfse.bin", OTEZIP_METHOD_LZFSE, 0 },
+#endif
+};
+
+#define N_METHODS ((int)(sizeof (methods) / sizeof (methods[0])))
+
+int main(void) {
+	char path[] = "/tmp/otezip-stream-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+	unlink (path);
+
+	uint8_t *payload = (uint8_t *)malloc (payload_size);
+	if (!payload) {
+		perror ("malloc");
+		return 1;
+	}
+	fill_payload (payload, payload_size);
+
+	int err = -1;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (!za) {
+		fprintf (stderr, "zip_open(create) failed: %d\n", err);
+		free (payload);
+		return 1;
+	}
+	int rc = 0;
+	for (int i = 0; i < N_METHODS; i++) {
+		rc |= add_entry (za, methods[i].name, methods[i].method, payload, payload_size) != 0;
+	}
+	if (rc || add_entry (za, "empty.bin", ZIP_CM_DEFLATE, payload, 0) != 0) {
+		fprintf (stderr, "zip_file_add failed\n");
+		zip_close (za);
+		unlink (path);
+		free (payload);
+		return 1;
+	}
+	if (zip_close (za) != 0) {
+		fprintf (stderr, "zip_close failed\n");
+		unlink (path);
+		free (payload);
+		return 1;
+	}
+
+	/* mapped, then read through the input window of a writable archive */
+	static const int modes[] = { ZIP_RDONLY, ZIP_CREATE };
+	for (int m = 0; m < 2 && !rc; m++) {
+		za = zip_open (path, modes[m], &err);
+		if (!za) {
+			fprintf (stderr, "zip_open(read) failed: %d\n", err);
+			unlink (path);
+			free (payload);
+			return 1;
+		}
+		for (int i = 0; i < N_METHODS; i++) {
+			rc |= check_chunked (za, methods[i].name, payload, payload_size);
+			rc |= check_streams (za, methods[i].name, payload, methods[i].streamed);
+		}
+		rc |= check_chunked (za, "empty.bin", payload, 0);
+		zip_close (za);
+	}
+	unlink (path);
+	free (payload);
+	if (rc) {
+		return 1;
+	}
+	puts ("TEST PASSED: zip_fread streams entries of every method.");
+	return 0;
+}
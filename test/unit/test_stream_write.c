@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+/* Big enough to be streamed rather than read whole */
+#define BIG_LEN (5u * 1024u * 1024u + 123u)
+
+/* Callback source handing out data in odd-sized reads */
+struct gen {
+	const uint8_t *data;
+	size_t len;
+	size_t pos;
+	int stat_size; /* answer ZIP_SOURCE_STAT with the size */
+	size_t fail_at; /* report a read error past this offset, 0 for never */
+	int opened;
+	int closed;
+	int freed;
+};
+
+static zip_int64_t gen_cb(void *userdata, void *data, zip_uint64_t len, zip_source_cmd_t cmd) {
+	struct gen *g = (struct gen *)userdata;
+	switch (cmd) {
+	case ZIP_SOURCE_OPEN:
+		g->opened++;
+		g->pos = 0;
+		return 0;
+	case ZIP_SOURCE_READ: {
+		if (g->fail_at && g->pos > g->fail_at) {
+			return -1;
+		}
+		size_t n = g->len - g->pos;
+		if (n > 70001) {
+			n = 70001;
+		}
+		if (n > len) {
+			n = (size_t)len;
+		}
+		memcpy (data, g->data + g->pos, n);
+		g->pos += n;
+		return (zip_int64_t)n;
+	}
+	case ZIP_SOURCE_CLOSE:
+		g->closed++;
+		return 0;
+	case ZIP_SOURCE_STAT:
+		if (!g->stat_size) {
+			return -1;
+		}
+		((zip_stat_t *)data)->size = g->len;
+		((zip_stat_t *)data)->valid |= ZIP_STAT_SIZE;
+		return sizeof (zip_stat_t);
+	case ZIP_SOURCE_FREE:
+		g->freed++;
+		return 0;
+	default:
+		return -1;
+	}
+}
+
+/* Flags of the local header of entry index, -1 if unreadable */
+static int local_flags(const char *path, zip_t *za, zip_uint64_t index) {
+	uint8_t lfh[30];
+	FILE *fp = fopen (path, "rb");
+	int flags = -1;
+	if (fp && fseek (fp, (long)za->entries[index].local_hdr_ofs, SEEK_SET) == 0 && fread (lfh, 1, sizeof (lfh), fp) == sizeof (lfh)) {
+		flags = lfh[6] | (lfh[7] << 8);
+	}
+	if (fp) {
+		fclose (fp);
+	}
+	return flags;
+}
+
+static int make_temp(char *path, const uint8_t *data, size_t len) {
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return -1;
+	}
+	int rc = (len && write (fd, data, len) != (ssize_t)len)? -1: 0;
+	close (fd);
+	return rc;
+}
+
+/* Streamed entries of every kind, added one by one or in a batch */
+static int test_streamed(zip_uint16_t method, int batch) {
+	uint8_t *big = (uint8_t *)malloc (BIG_LEN);
+	uint32_t x = 2463534242u;
+	for (size_t i = 0; i < BIG_LEN; i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		big[i] = (uint8_t)("abcdefgh"[x % 8]);
+	}
+	char data_path[] = "/tmp/otezip-swdata-XXXXXX";
+	char path[] = "/tmp/otezip-swrite-XXXXXX";
+	if (make_temp (data_path, big, BIG_LEN) != 0 || make_temp (path, NULL, 0) != 0) {
+		free (big);
+		return 1;
+	}
+
+	struct gen sized = { big, BIG_LEN, 0, 1, 0, 0, 0, 0 };
+	struct gen unsized = { big + 7, 100000, 0, 0, 0, 0, 0, 0 };
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	zip_source_t *srcs[4] = {
+		zip_source_file (za, data_path, 0, -1), /* streamed */
+		zip_source_file (za, data_path, 1000, 5000), /* small: read whole */
+		zip_source_function (za, gen_cb, &sized),
+		zip_source_function (za, gen_cb, &unsized),
+	};
+	const char *names[4] = { "file.bin", "slice.bin", "sized.bin", "unsized.bin" };
+	if (za) {
+		/* zip_set_file_compression needs an entry to point at */
+		za->default_method = method;
+	} else {
+		fprintf (stderr, "zip_open(create) failed: %d\n", err);
+		rc = 1;
+	}
+	for (int i = 0; i < 4 && !rc; i++) {
+		zip_int64_t idx = batch? otezip_batch_add (za, names[i], srcs[i]): zip_file_add (za, names[i], srcs[i], 0);
+		if (idx != i) {
+			fprintf (stderr, "adding %s failed\n", names[i]);
+			rc = 1;
+		}
+	}
+	if (batch && !rc && otezip_batch_commit (za, 3) != 0) {
+		fprintf (stderr, "batch commit failed\n");
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	if (sized.opened != 1 || sized.closed != 1 || sized.freed != 1 || unsized.freed != 1) {
+		fprintf (stderr, "callback calls: open %d close %d free %d\n", sized.opened, sized.closed, sized.freed);
+		rc = 1;
+	}
+
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		rc |= check_entry (za, 0, big, BIG_LEN);
+		rc |= check_entry (za, 1, big + 1000, 5000);
+		rc |= check_entry (za, 2, big, BIG_LEN);
+		rc |= check_entry (za, 3, big + 7, 100000);
+		/* only the streamed ones are followed by a data descriptor */
+		int want[4] = { 8, 0, 8, 8 };
+		for (zip_uint64_t i = 0; i < 4; i++) {
+			if (local_flags (path, za, i) != want[i] || (za->entries[i].flags & 8) != want[i]) {
+				fprintf (stderr, "entry %llu: unexpected flags\n", (unsigned long long)i);
+				rc = 1;
+			}
+		}
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	if (rc) {
+		fprintf (stderr, "method %u%s failed\n", method, batch? " (batch)": "");
+	}
+	unlink (data_path);
+	unlink (path);
+	free (big);
+	return rc;
+}
+
+/* A source failing halfway leaves no trace; later entries still land */
+static int test_failing_source(void) {
+	static uint8_t data[300000];
+	for (size_t i = 0; i < sizeof (data); i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+	char path[] = "/tmp/otezip-swrite-XXXXXX";
+	if (make_temp (path, NULL, 0) != 0) {
+		return 1;
+	}
+	struct gen failing = { data, sizeof (data), 0, 0, 150000, 0, 0, 0 };
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	zip_source_t *src = za? zip_source_function (za, gen_cb, &failing): NULL;
+	if (!src || zip_file_add (za, "fails.bin", src, 0) >= 0 || failing.closed != 1) {
+		fprintf (stderr, "failing source was added\n");
+		rc = 1;
+	}
+	zip_source_free (src);
+	if (za && zip_file_add (za, "ok.bin", zip_source_buffer (za, data, 1000, 0), 0) != 0) {
+		fprintf (stderr, "add after a failed source failed\n");
+		rc = 1;
+	}
+	if (za && zip_close (za) != 0) {
+		rc = 1;
+	}
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		if (zip_get_num_files (za) != 1 || za->entries[0].local_hdr_ofs != 0) {
+			fprintf (stderr, "failed entry left behind\n");
+			rc = 1;
+		}
+		rc |= check_entry (za, 0, data, 1000);
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	unlink (path);
+	return rc;
+}
+
+int main(void) {
+	int rc = 0;
+	rc |= test_streamed (ZIP_CM_STORE, 0);
+	rc |= test_streamed (ZIP_CM_DEFLATE, 0);
+	rc |= test_streamed (ZIP_CM_DEFLATE, 1);
+#ifdef OTEZIP_ENABLE_ZSTD
+	rc |= test_streamed (OTEZIP_METHOD_ZSTD, 1);
+#endif
+	rc |= test_failing_source ();
+	if (!rc) {
+		printf ("stream write ok\n");
+	}
+	return rc;
+}
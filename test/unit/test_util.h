@@ -0,0 +1,66 @@
+/* Fixtures shared by the unit tests */
+#ifndef OTEZIP_TEST_UTIL_H
+#define OTEZIP_TEST_UTIL_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/include/otezip/zip.h"
+
+/* n bytes of words picked by a xorshift seeded with x: compressible,
+ * but with no period a codec could lock on to */
+static inline void fill_text(uint8_t *p, size_t n, uint32_t x) {
+	static const char *const words[] = { "alpha ", "bravo ", "charlie ", "delta ", "echo ", "foxtrot\n", "golf ", "hotel " };
+	size_t i = 0;
+	while (i < n) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		const char *w = words[x % 8];
+		while (*w && i < n) {
+			p[i++] = (uint8_t)*w++;
+		}
+	}
+}
+
+/* Read entry index whole and compare it, and its recorded size, with want */
+static inline int check_entry(zip_t *za, zip_uint64_t index, const void *want, size_t len) {
+	zip_stat_t st;
+	zip_stat_init (&st);
+	if (zip_stat_index (za, index, 0, &st) != 0 || st.size != len) {
+		fprintf (stderr, "entry %llu: unexpected size\n", (unsigned long long)index);
+		return 1;
+	}
+	uint8_t *out = (uint8_t *)malloc (len + 1);
+	zip_file_t *zf = zip_fopen_index (za, index, 0);
+	size_t got = 0;
+	zip_int64_t r = 1;
+	while (zf && out && r > 0) {
+		r = zip_fread (zf, out + got, len + 1 - got);
+		got += r > 0? (size_t)r: 0;
+	}
+	int rc = !zf || r < 0 || got != len || memcmp (out, want, len) != 0;
+	if (rc) {
+		fprintf (stderr, "entry %llu: payload mismatch\n", (unsigned long long)index);
+	}
+	if (zf) {
+		zip_fclose (zf);
+	}
+	free (out);
+	return rc;
+}
+
+/* Whether entry index was stored with method */
+static inline int check_method(zip_t *za, zip_uint64_t index, zip_uint16_t method) {
+	zip_stat_t st;
+	zip_stat_init (&st);
+	if (zip_stat_index (za, index, 0, &st) != 0 || st.comp_method != method) {
+		fprintf (stderr, "entry %llu: method %u, expected %u\n", (unsigned long long)index, st.comp_method, method);
+		return 1;
+	}
+	return 0;
+}
+
+#endif
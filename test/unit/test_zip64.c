@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/include/otezip/zip.h"
+#include "test_util.h"
+
+/* More entries than the 16-bit EOCD count can hold */
+#define MANY_ENTRIES 70000
+
+static void wr16(uint8_t *p, uint16_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+}
+
+static void wr32(uint8_t *p, uint32_t v) {
+	wr16 (p, (uint16_t)v);
+	wr16 (p + 2, (uint16_t)(v >> 16));
+}
+
+static void wr64(uint8_t *p, uint64_t v) {
+	wr32 (p, (uint32_t)v);
+	wr32 (p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Read all of entry name and compare it with want */
+static int check_named(zip_t *za, const char *name, const char *want) {
+	zip_int64_t idx = zip_name_locate (za, name, 0);
+	if (idx < 0) {
+		fprintf (stderr, "%s: not found\n", name);
+		return 1;
+	}
+	return check_entry (za, (zip_uint64_t)idx, want, strlen (want));
+}
+
+/* Archives with over 65535 entries get a ZIP64 end of central directory */
+static int test_many_entries(void) {
+	char path[] = "/tmp/otezip-zip64-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	close (fd);
+
+	int err = 0;
+	int rc = 0;
+	zip_t *za = zip_open (path, ZIP_CREATE | ZIP_TRUNCATE, &err);
+	if (!za) {
+		fprintf (stderr, "zip_open(create) failed: %d\n", err);
+		unlink (path);
+		return 1;
+	}
+	for (int i = 0; i < MANY_ENTRIES && !rc; i++) {
+		char name[32];
+		char *data = (char *)malloc (32);
+		snprintf (name, sizeof (name), "f%d", i);
+		snprintf (data, 32, "entry %d", i);
+		if (zip_file_add (za, name, zip_source_buffer (za, data, strlen (data), 1), 0) != i) {
+			fprintf (stderr, "adding %s failed\n", name);
+			rc = 1;
+		}
+	}
+	if (zip_close (za) != 0) {
+		fprintf (stderr, "zip_close failed\n");
+		rc = 1;
+	}
+
+	/* the locator sits right before the 22-byte EOCD, whose count saturates */
+	uint8_t tail[42];
+	FILE *fp = fopen (path, "rb");
+	if (!rc && (!fp || fseek (fp, -42, SEEK_END) != 0 || fread (tail, 1, sizeof (tail), fp) != sizeof (tail) ||
+		rd32 (tail) != 0x07064b50u || rd32 (tail + 20) != 0x06054b50u || tail[28] != 0xff || tail[29] != 0xff)) {
+		fprintf (stderr, "no ZIP64 end of central directory\n");
+		rc = 1;
+	}
+	if (fp) {
+		fclose (fp);
+	}
+
+	za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		if (zip_get_num_files (za) != MANY_ENTRIES) {
+			fprintf (stderr, "read back %lld entries\n", (long long)zip_get_num_files (za));
+			rc = 1;
+		}
+		rc |= check_named (za, "f0", "entry 0");
+		rc |= check_named (za, "f65535", "entry 65535");
+		rc |= check_named (za, "f69999", "entry 69999");
+		zip_close (za);
+	} else if (!rc) {
+		fprintf (stderr, "zip_open(read) failed: %d\n", err);
+		rc = 1;
+	}
+	unlink (path);
+	return rc;
+}
+
+/* A stored entry whose sizes and offset live in ZIP64 extra fields, as
+ * written by other tools for large files */
+static int test_zip64_fields(void) {
+	static const char payload[] = "sizes from the zip64 extra field";
+	const uint32_t len = sizeof (payload) - 1;
+	uint8_t buf[512];
+	size_t o = 0;
+
+	/* local header: both sizes in the extra field */
+	wr32 (buf + o, 0x04034b50u);
+	wr16 (buf + o + 4, 45);
+	wr16 (buf + o + 6, 0);
+	wr16 (buf + o + 8, 0);
+	wr32 (buf + o + 10, 0);
+	wr32 (buf + o + 14, 0); /* CRC, filled in below */
+	wr32 (buf + o + 18, 0xffffffffu);
+	wr32 (buf + o + 22, 0xffffffffu);
+	wr16 (buf + o + 26, 7);
+	wr16 (buf + o + 28, 20);
+	memcpy (buf + o + 30, "big.txt", 7);
+	o += 37;
+	wr16 (buf + o, 1);
+	wr16 (buf + o + 2, 16);
+	wr64 (buf + o + 4, len);
+	wr64 (buf + o + 12, len);
+	o += 20;
+	memcpy (buf + o, payload, len);
+	o += len;
+
+	/* central directory: sizes and local header offset in the extra */
+	size_t cd_ofs = o;
+	memset (buf + o, 0, 46);
+	wr32 (buf + o, 0x02014b50u);
+	wr16 (buf + o + 4, 0x032d);
+	wr16 (buf + o + 6, 45);
+	wr32 (buf + o + 20, 0xffffffffu);
+	wr32 (buf + o + 24, 0xffffffffu);
+	wr16 (buf + o + 28, 7);
+	wr16 (buf + o + 30, 28);
+	wr32 (buf + o + 42, 0xffffffffu);
+	memcpy (buf + o + 46, "big.txt", 7);
+	o += 53;
+	wr16 (buf + o, 1);
+	wr16 (buf + o + 2, 24);
+	wr64 (buf + o + 4, len);
+	wr64 (buf + o + 12, len);
+	wr64 (buf + o + 20, 0);
+	o += 28;
+	size_t cd_size = o - cd_ofs;
+
+	/* ZIP64 end of central directory record and locator */
+	size_t eocd64_ofs = o;
+	memset (buf + o, 0, 56 + 20 + 22);
+	wr32 (buf + o, 0x06064b50u);
+	wr64 (buf + o + 4, 44);
+	wr16 (buf + o + 12, 45);
+	wr16 (buf + o + 14, 45);
+	wr64 (buf + o + 24, 1);
+	wr64 (buf + o + 32, 1);
+	wr64 (buf + o + 40, cd_size);
+	wr64 (buf + o + 48, cd_ofs);
+	o += 56;
+	wr32 (buf + o, 0x07064b50u);
+	wr64 (buf + o + 8, eocd64_ofs);
+	wr32 (buf + o + 16, 1);
+	o += 20;
+
+	/* EOCD with every field saturated */
+	wr32 (buf + o, 0x06054b50u);
+	wr16 (buf + o + 8, 0xffff);
+	wr16 (buf + o + 10, 0xffff);
+	wr32 (buf + o + 12, 0xffffffffu);
+	wr32 (buf + o + 16, 0xffffffffu);
+	o += 22;
+
+	/* fill in the CRC the reader checks */
+	uint32_t crc = 0xffffffffu;
+	for (uint32_t i = 0; i < len; i++) {
+		crc ^= (uint8_t)payload[i];
+		for (int k = 0; k < 8; k++) {
+			crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+		}
+	}
+	crc ^= 0xffffffffu;
+	wr32 (buf + 14, crc);
+	wr32 (buf + cd_ofs + 16, crc);
+
+	char path[] = "/tmp/otezip-zip64-XXXXXX";
+	int fd = mkstemp (path);
+	if (fd < 0) {
+		perror ("mkstemp");
+		return 1;
+	}
+	int rc = write (fd, buf, o) != (ssize_t)o;
+	close (fd);
+
+	int err = 0;
+	zip_t *za = rc? NULL: zip_open (path, ZIP_RDONLY, &err);
+	if (za) {
+		zip_stat_t st;
+		zip_stat_init (&st);
+		if (zip_get_num_files (za) != 1 || zip_stat_index (za, 0, 0, &st) != 0 || st.size != len || st.comp_size != len) {
+			fprintf (stderr, "unexpected ZIP64 entry stat\n");
+			rc = 1;
+		}
+		rc |= check_named (za, "big.txt", payload);
+		zip_close (za);
+	} else {
+		fprintf (stderr, "zip_open(zip64) failed: %d\n", err);
+		rc = 1;
+	}
+	unlink (path);
+	return rc;
+}
+
+int main(void) {
+	int rc = test_many_entries ();
+	rc |= test_zip64_fields ();
+	if (!rc) {
+		printf ("zip64 ok\n");
+	}
+	return rc;
+}
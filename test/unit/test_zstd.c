@@ -185,6 +185,292 @@ int test_zstd_large_data() {
 	return 0;
 }
 
+/* Feed text through in small pieces with a small output window: the
+ * frame must carry real compressed blocks and decode back */
+static int zstd_streaming_roundtrip(uint8_t *test_data, uint8_t *compressed, uint8_t *decompressed, size_t test_size) {
+	static const char *words[] = { "zstd ", "frame ", "block ", "huffman ", "literal ", "sequence " };
+	uint32_t x = 1;
+	size_t i = 0;
+	while (i < test_size) {
+		x = x * 1103515245u + 12345u;
+		const char *w = words[(x >> 16) % 6];
+		for (size_t k = 0; w[k] && i < test_size; k++) {
+			test_data[i++] = (uint8_t)w[k];
+		}
+	}
+
+	z_stream c_strm = { 0 };
+	if (zstdInit (&c_strm, 5) != Z_OK) {
+		printf ("zstdInit failed\n");
+		return 1;
+	}
+	int ret = Z_OK;
+	size_t pos = 0;
+	c_strm.next_out = compressed;
+	while (ret != Z_STREAM_END) {
+		size_t n = test_size - pos < 7777? test_size - pos: 7777;
+		c_strm.next_in = test_data + pos;
+		c_strm.avail_in = (unsigned int)n;
+		pos += n;
+		do {
+			c_strm.avail_out = (unsigned int)(test_size - c_strm.total_out < 1000? test_size - c_strm.total_out: 1000);
+			ret = zstdCompress (&c_strm, pos == test_size? Z_FINISH: Z_NO_FLUSH);
+		} while (ret == Z_OK && (c_strm.avail_in > 0 || (pos == test_size && c_strm.avail_out == 0)));
+		if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+			printf ("zstdCompress failed with result %d\n", ret);
+			zstdEnd (&c_strm);
+			return 1;
+		}
+	}
+	size_t compressed_len = c_strm.total_out;
+	zstdEnd (&c_strm);
+	printf ("Streaming test: Original size: %zu bytes, Compressed size: %zu bytes\n", test_size, compressed_len);
+	if (compressed_len * 3 > test_size) {
+		printf ("ERROR: text did not compress\n");
+		return 1;
+	}
+
+	z_stream d_strm = { 0 };
+	if (zstdDecompressInit (&d_strm) != Z_OK) {
+		printf ("zstdDecompressInit failed\n");
+		return 1;
+	}
+	d_strm.next_in = compressed;
+	d_strm.avail_in = (unsigned int)compressed_len;
+	d_strm.next_out = decompressed;
+	d_strm.avail_out = (unsigned int)test_size;
+	ret = zstdDecompress (&d_strm, Z_FINISH);
+	size_t decompressed_len = d_strm.total_out;
+	zstdDecompressEnd (&d_strm);
+	if (ret != Z_STREAM_END || decompressed_len != test_size || memcmp (decompressed, test_data, test_size) != 0) {
+		printf ("ERROR: Streaming test failed - decompressed data does not match original!\n");
+		return 1;
+	}
+	printf ("TEST PASSED: ZSTD streaming compression and decompression successful.\n");
+	return 0;
+}
+
+int test_zstd_streaming() {
+	size_t test_size = 300000;
+	uint8_t *test_data = malloc (test_size);
+	uint8_t *compressed = malloc (test_size);
+	uint8_t *decompressed = malloc (test_size);
+	int rc = 1;
+	if (test_data && compressed && decompressed) {
+		rc = zstd_streaming_roundtrip (test_data, compressed, decompressed, test_size);
+	} else {
+		printf ("Memory allocation failed\n");
+	}
+	free (test_data);
+	free (compressed);
+	free (decompressed);
+	return rc;
+}
+
+/* Frame written by the reference zstd -19 --check for ref_text(): a
+ * compressed block with four-stream Huffman literals and a checksum */
+static const uint8_t zstd_ref_frame[] = {
+	0x28, 0xb5, 0x2f, 0xfd, 0x64, 0xa5, 0x12, 0x05, 0x0b, 0x00, 0x96, 0x58,
+	0x37, 0x15, 0xa0, 0x1b, 0x3a, 0x00, 0x29, 0xbf, 0x73, 0x7f, 0x0f, 0x00,
+	0xce, 0x91, 0x52, 0x4a, 0x99, 0x52, 0xaa, 0xe5, 0xea, 0x55, 0x3c, 0x3b,
+	0x00, 0x2e, 0x00, 0x2d, 0x00, 0xc3, 0x92, 0x94, 0xd4, 0xd9, 0x36, 0x57,
+	0x25, 0xa2, 0xa7, 0x6f, 0xb9, 0xde, 0x97, 0x26, 0xa4, 0xdd, 0xc9, 0xee,
+	0x45, 0xa6, 0xe9, 0x10, 0x7f, 0x7e, 0x49, 0x00, 0x09, 0x94, 0xc6, 0x61,
+	0xe0, 0x08, 0x08, 0x0a, 0x62, 0xb0, 0x28, 0x04, 0x0a, 0x21, 0x51, 0x16,
+	0xa5, 0x50, 0x16, 0x81, 0x62, 0x60, 0x04, 0x0a, 0x8a, 0x00, 0x09, 0x3c,
+	0x16, 0x8c, 0x44, 0x09, 0x1c, 0xba, 0xcf, 0x63, 0xbd, 0xe2, 0x14, 0x99,
+	0x73, 0xd9, 0x54, 0x5d, 0xd1, 0xd8, 0xf8, 0x4e, 0x36, 0xb6, 0xa6, 0x9d,
+	0x9c, 0x8e, 0xcc, 0xc8, 0x1a, 0x13, 0x69, 0xce, 0xde, 0xfa, 0x53, 0x33,
+	0x56, 0x89, 0x87, 0xce, 0x8c, 0x4c, 0xfd, 0xc8, 0x1f, 0xde, 0x7f, 0xd3,
+	0xd5, 0x01, 0x34, 0x73, 0xbd, 0x54, 0x9f, 0xd6, 0x6b, 0xba, 0x25, 0xce,
+	0x11, 0xb3, 0x8f, 0x94, 0x95, 0xe5, 0x21, 0xba, 0xf9, 0xcf, 0xb3, 0xdf,
+	0x1f, 0xc9, 0x90, 0xb2, 0x1b, 0xb2, 0x6a, 0x99, 0xd1, 0x67, 0xda, 0x9f,
+	0x99, 0xd4, 0x31, 0x49, 0x42, 0x76, 0x44, 0x66, 0xaf, 0x9a, 0x2c, 0x47,
+	0x8f, 0xb1, 0x2c, 0x92, 0x22, 0xda, 0xc3, 0xb9, 0xb3, 0x64, 0xd2, 0x65,
+	0xc9, 0x16, 0x61, 0xfd, 0x5e, 0x73, 0xd1, 0xe8, 0x34, 0xf7, 0x93, 0x3d,
+	0x2d, 0x21, 0xf2, 0x08, 0xe1, 0x8f, 0x46, 0x8a, 0xf4, 0xb9, 0x13, 0x3d,
+	0x2d, 0x99, 0x77, 0x72, 0xa7, 0x0b, 0x80, 0xed, 0xa8, 0x11, 0x10, 0x7e,
+	0xf6, 0xff, 0x0c, 0xc0, 0x9b, 0x36, 0x03, 0x12, 0x50, 0x90, 0x98, 0x15,
+	0xc1, 0xff, 0xdb, 0x2f, 0x6b, 0x44, 0x1b, 0x92, 0x67, 0xc2, 0x6e, 0x59,
+	0x38, 0x28, 0x73, 0xd7, 0x68, 0xe3, 0x43, 0x87, 0x87, 0x0f, 0x9b, 0x9d,
+	0xee, 0x85, 0x25, 0x52, 0xeb, 0x2d, 0x26, 0xcd, 0xe3, 0xcc, 0xf4, 0x34,
+	0x2c, 0x0c, 0xa3, 0x42, 0xea, 0xe4, 0xd0, 0xdf, 0x3b, 0x4e, 0x9c, 0xf3,
+	0xc6, 0x71, 0x4d, 0x3f, 0x46, 0x51, 0x77, 0xd8, 0x40, 0x54, 0x7c, 0x2a,
+	0x20, 0xcd, 0x89, 0x73, 0x7e, 0xc3, 0x1d, 0xa3, 0xa1, 0x40, 0x78, 0xcd,
+	0x9a, 0xce, 0x29, 0xb7, 0xd9, 0x17, 0x1c, 0x05, 0x5c, 0x8c, 0x18, 0xe7,
+	0xc8, 0x98, 0x3c, 0x26, 0x5a, 0x40, 0x8e, 0x53, 0xa1, 0xd5, 0xa2, 0x6e,
+	0x67, 0xb7, 0xbb, 0x71, 0x59, 0x6e, 0xe7, 0x27, 0x75, 0x65, 0xb1, 0x00,
+	0xb2, 0x0a, 0x84, 0xa3, 0x79, 0x5a,
+};
+
+static size_t ref_text(char *dst) {
+	size_t n = 0;
+	for (int i = 0; i < 120; i++) {
+		n += (size_t)sprintf (dst + n, "entry %d of the reference frame, value %d\n", i, i * i % 97);
+	}
+	return n;
+}
+
+/* Decode src in pieces of in_step input and out_step output bytes */
+static int zstd_decode_pieces(const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t in_step, size_t out_step, size_t *out_len) {
+	z_stream d_strm = { 0 };
+	if (zstdDecompressInit (&d_strm) != Z_OK) {
+		return Z_MEM_ERROR;
+	}
+	int ret = Z_OK;
+	size_t pos = 0;
+	d_strm.next_out = dst;
+	while (ret == Z_OK || (ret == Z_BUF_ERROR && pos < n)) {
+		size_t give = n - pos < in_step? n - pos: in_step;
+		d_strm.next_in = src + pos;
+		d_strm.avail_in = (unsigned int)give;
+		d_strm.avail_out = (unsigned int)(cap - d_strm.total_out < out_step? cap - d_strm.total_out: out_step);
+		ret = zstdDecompress (&d_strm, Z_NO_FLUSH);
+		pos += give - d_strm.avail_in;
+		if (ret == Z_STREAM_END && pos < n) {
+			ret = Z_OK;
+		}
+	}
+	*out_len = d_strm.total_out;
+	zstdDecompressEnd (&d_strm);
+	return ret;
+}
+
+/* Frames from another encoder: decoded in place, then twice in a row with
+ * a skippable frame between them through tiny buffers, and with a broken
+ * checksum */
+int test_zstd_reference_frames() {
+	static const uint8_t skip[] = { 0x5a, 0x2a, 0x4d, 0x18, 3, 0, 0, 0, 'x', 'y', 'z' };
+	size_t fn = sizeof (zstd_ref_frame);
+	char *want = malloc (2 * 6000);
+	uint8_t *src = malloc (2 * fn + sizeof (skip));
+	uint8_t *out = malloc (2 * 6000);
+	int rc = 1;
+	if (!want || !src || !out) {
+		printf ("Memory allocation failed\n");
+		free (want);
+		free (src);
+		free (out);
+		return 1;
+	}
+	size_t wn = ref_text (want);
+	memcpy (want + wn, want, wn);
+	memcpy (src, zstd_ref_frame, fn);
+	memcpy (src + fn, skip, sizeof (skip));
+	memcpy (src + fn + sizeof (skip), zstd_ref_frame, fn);
+
+	size_t got = 0;
+	int r1 = zstd_decode_pieces (src, fn, out, wn, fn, wn, &got);
+	int ok1 = r1 == Z_STREAM_END && got == wn && memcmp (out, want, wn) == 0;
+	int r2 = zstd_decode_pieces (src, 2 * fn + sizeof (skip), out, 2 * wn, 7, 100, &got);
+	int ok2 = r2 == Z_STREAM_END && got == 2 * wn && memcmp (out, want, 2 * wn) == 0;
+	src[fn - 1] ^= 0x40;
+	int r3 = zstd_decode_pieces (src, fn, out, wn, fn, wn, &got);
+	int r4 = zstd_decode_pieces (src, fn, out, wn, 5, 64, &got);
+	if (!ok1 || !ok2) {
+		printf ("ERROR: reference frames did not decode (%d, %d)\n", r1, r2);
+	} else if (r3 != Z_DATA_ERROR || r4 != Z_DATA_ERROR) {
+		printf ("ERROR: bad checksum was accepted (%d, %d)\n", r3, r4);
+	} else {
+		printf ("TEST PASSED: ZSTD reference frames decode, checksums are verified.\n");
+		rc = 0;
+	}
+	free (want);
+	free (src);
+	free (out);
+	return rc;
+}
+
+/* Run one whole stream through run() with Z_FINISH into dst */
+static int zstd_pass(z_stream *strm, int (*run)(z_stream *, int), const uint8_t *src, size_t n, uint8_t *dst, size_t cap, size_t *len) {
+	strm->next_in = (uint8_t *)src;
+	strm->avail_in = (uInt)n;
+	strm->next_out = dst;
+	strm->avail_out = (uInt)cap;
+	int ret;
+	do {
+		ret = run (strm, Z_FINISH);
+	} while (ret == Z_OK && strm->avail_out > 0);
+	*len = strm->total_out;
+	return ret == Z_STREAM_END? 0: -1;
+}
+
+/* A stream reset after a large entry must encode a small one exactly
+ * like a fresh stream, and a reset decoder must read both back */
+int test_zstd_reset() {
+	size_t big = 200000;
+	size_t small = 3000;
+	size_t cap = big + big / 8 + 1024;
+	uint8_t *data = malloc (big);
+	uint8_t *c1 = malloc (cap);
+	uint8_t *c2 = malloc (cap);
+	uint8_t *ref = malloc (cap);
+	uint8_t *out = malloc (big);
+	if (!data || !c1 || !c2 || !ref || !out) {
+		printf ("Memory allocation failed\n");
+		free (data);
+		free (c1);
+		free (c2);
+		free (ref);
+		free (out);
+		return 1;
+	}
+	uint32_t seed = 7;
+	size_t n = 0;
+	while (n + 64 < big) {
+		n += (size_t)sprintf ((char *)data + n, "entry %u holds %u\n", (unsigned)(n % 977), (unsigned)(n * 13 % 31));
+	}
+	for (; n < big; n++) {
+		seed = seed * 1103515245 + 12345;
+		data[n] = (uint8_t)(seed >> 16);
+	}
+	const uint8_t *second = data + 10000;
+
+	int rc = 0;
+	size_t ref_len = 0;
+	size_t len1 = 0;
+	size_t len2 = 0;
+	z_stream strm = { 0 };
+	if (zstdInit (&strm, 3) != Z_OK || zstd_pass (&strm, zstdCompress, second, small, ref, cap, &ref_len) != 0) {
+		printf ("fresh stream failed\n");
+		rc = 1;
+	}
+	zstdEnd (&strm);
+
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (zstdInit (&strm, 3) != Z_OK || zstd_pass (&strm, zstdCompress, data, big, c1, cap, &len1) != 0 ||
+		zstdReset (&strm) != Z_OK || zstd_pass (&strm, zstdCompress, second, small, c2, cap, &len2) != 0)) {
+		printf ("reset stream failed\n");
+		rc = 1;
+	}
+	zstdEnd (&strm);
+	if (!rc && (len2 != ref_len || memcmp (c2, ref, ref_len) != 0)) {
+		printf ("ERROR: reset stream output differs from a fresh one (%zu vs %zu bytes)\n", len2, ref_len);
+		rc = 1;
+	}
+
+	size_t got = 0;
+	memset (&strm, 0, sizeof (strm));
+	if (!rc && (zstdDecompressInit (&strm) != Z_OK || zstd_pass (&strm, zstdDecompress, c1, len1, out, big, &got) != 0 || got != big || memcmp (out, data, big) != 0)) {
+		printf ("ERROR: first stream does not decode\n");
+		rc = 1;
+	}
+	if (!rc && (zstdDecompressReset (&strm) != Z_OK || zstd_pass (&strm, zstdDecompress, c2, len2, out, big, &got) != 0 || got != small || memcmp (out, second, small) != 0)) {
+		printf ("ERROR: reset decoder failed on the second stream\n");
+		rc = 1;
+	}
+	zstdDecompressEnd (&strm);
+	if (!rc) {
+		printf ("TEST PASSED: %zu and %zu bytes through reset streams (%zu, %zu bytes).\n", big, small, len1, len2);
+	}
+	free (data);
+	free (c1);
+	free (c2);
+	free (ref);
+	free (out);
+	return rc;
+}
+
 int main(int argc, char *argv[]) {
 	(void)argc;
 	(void)argv;
@@ -194,5 +480,14 @@ int main(int argc, char *argv[]) {
 	printf ("\nRunning ZSTD large data test...\n");
 	int result2 = test_zstd_large_data ();
 
-	return (result1 || result2);
+	printf ("\nRunning ZSTD streaming test...\n");
+	int result3 = test_zstd_streaming ();
+
+	printf ("\nRunning ZSTD reference frame test...\n");
+	int result4 = test_zstd_reference_frames ();
+
+	printf ("\nRunning ZSTD reset test...\n");
+	int result5 = test_zstd_reset ();
+
+	return (result1 || result2 || result3 || result4 || result5);
 }